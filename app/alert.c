@@ -0,0 +1,96 @@
+/**
+ * alert.c
+ * Prioritised rider alerts
+ */
+
+#include "alert.h"
+#include "app_config.h"
+
+typedef struct {
+  const char *text;
+  alert_severity_t severity;
+  bool above;      /* raised when the value goes above (else below) */
+  int32_t raise;   /* raise at or beyond this value */
+  int32_t clear;   /* clear at or before this value */
+  uint32_t hold_ms;
+  uint32_t expire_ms;
+} alert_def_t;
+
+static const alert_def_t alert_defs[ALERT_COUNT] = {
+    [ALERT_BMS_FAULT] = {"BMS FAULT", ALERT_SEV_CRITICAL, true, 1, 0, 3000,
+                         5000},
+    [ALERT_OVER_TEMP] = {"BATTERY HOT", ALERT_SEV_CRITICAL, true,
+                         CONFIG_DASH_ALERT_OVER_TEMP_C,
+                         CONFIG_DASH_ALERT_OVER_TEMP_C - 5, 3000, 10000},
+    [ALERT_LOW_BATTERY] = {"LOW BATTERY", ALERT_SEV_WARNING, false,
+                           CONFIG_DASH_ALERT_LOW_SOC_PCT,
+                           CONFIG_DASH_ALERT_LOW_SOC_PCT + 3, 3000, 10000},
+    [ALERT_OVERSPEED] = {"OVERSPEED", ALERT_SEV_WARNING, true,
+                         CONFIG_DASH_ALERT_OVERSPEED_KMH + 1,
+                         CONFIG_DASH_ALERT_OVERSPEED_KMH - 3, 1000, 2000},
+};
+
+static uint32_t active_mask;
+static uint32_t version;
+static uint32_t raised_at[ALERT_COUNT];
+static uint32_t last_seen[ALERT_COUNT];
+
+static void alert_set(alert_id_t id, bool on, uint32_t now_ms) {
+  uint32_t bit = 1u << id;
+  if (on == ((active_mask & bit) != 0))
+    return;
+  if (on) {
+    active_mask |= bit;
+    raised_at[id] = now_ms;
+  } else {
+    active_mask &= ~bit;
+  }
+  version++;
+}
+
+void alert_eval(alert_id_t id, int32_t value, uint32_t now_ms) {
+  if (id >= ALERT_COUNT)
+    return;
+  const alert_def_t *d = &alert_defs[id];
+  bool active = (active_mask & (1u << id)) != 0;
+
+  last_seen[id] = now_ms;
+  if (!active) {
+    if (d->above ? value >= d->raise : value <= d->raise)
+      alert_set(id, true, now_ms);
+  } else if (d->above ? value <= d->clear : value >= d->clear) {
+    if (now_ms - raised_at[id] >= d->hold_ms)
+      alert_set(id, false, now_ms);
+  }
+}
+
+void alert_tick(uint32_t now_ms) {
+  uint32_t mask = active_mask;
+  while (mask) {
+    alert_id_t id = (alert_id_t)__builtin_ctz(mask);
+    mask &= mask - 1;
+    if (now_ms - last_seen[id] >= alert_defs[id].expire_ms &&
+        now_ms - raised_at[id] >= alert_defs[id].hold_ms)
+      alert_set(id, false, now_ms);
+  }
+}
+
+alert_id_t alert_top(void) {
+  return active_mask ? (alert_id_t)__builtin_ctz(active_mask) : ALERT_NONE;
+}
+
+uint32_t alert_active_mask(void) { return active_mask; }
+
+uint8_t alert_active_count(void) {
+  return (uint8_t)__builtin_popcount(active_mask);
+}
+
+uint32_t alert_version(void) { return version; }
+
+const char *alert_text(alert_id_t id) {
+  return id < ALERT_COUNT ? alert_defs[id].text : "";
+}
+
+alert_severity_t alert_severity(alert_id_t id) {
+  return id < ALERT_COUNT ? alert_defs[id].severity : ALERT_SEV_WARNING;
+}
@@ -0,0 +1,56 @@
+/**
+ * alert.h
+ * Prioritised rider alerts
+ *
+ * Each alert has a raise and a clear threshold (hysteresis), so a value
+ * hovering around a limit does not make the alert flicker. Evaluating a
+ * telemetry sample is O(1): one table lookup and two compares. Active alerts
+ * form a bit set ordered by priority, the top alert is its lowest set bit.
+ * Raising an alert that is already active only refreshes it. An active
+ * alert expires when its source has not reported for `expire_ms` (stale
+ * telemetry) and stays visible for at least `hold_ms` once raised.
+ *
+ * No LVGL dependency; the banner is drawn by alert_view.c.
+ */
+#ifndef ALERT_H
+#define ALERT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* In priority order, highest first */
+typedef enum {
+  ALERT_BMS_FAULT,
+  ALERT_OVER_TEMP,
+  ALERT_LOW_BATTERY,
+  ALERT_OVERSPEED,
+  ALERT_COUNT,
+  ALERT_NONE = ALERT_COUNT,
+} alert_id_t;
+
+typedef enum {
+  ALERT_SEV_WARNING,
+  ALERT_SEV_CRITICAL, /* flashing banner */
+} alert_severity_t;
+
+/* Feed one telemetry sample to alert `id`:
+ *   ALERT_BMS_FAULT    BMS protection flags (bms_fault_t), non-zero is a
+ *                      fault
+ *   ALERT_OVER_TEMP    battery temperature, deg C
+ *   ALERT_LOW_BATTERY  state of charge, %
+ *   ALERT_OVERSPEED    speed, km/h */
+void alert_eval(alert_id_t id, int32_t value, uint32_t now_ms);
+
+/* Expire stale alerts; call periodically */
+void alert_tick(uint32_t now_ms);
+
+alert_id_t alert_top(void);
+uint32_t alert_active_mask(void);
+uint8_t alert_active_count(void);
+/* Changes whenever the set of active alerts changes */
+uint32_t alert_version(void);
+
+const char *alert_text(alert_id_t id);
+alert_severity_t alert_severity(alert_id_t id);
+
+#endif /*ALERT_H*/
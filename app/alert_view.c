@@ -0,0 +1,80 @@
+/**
+ * alert_view.c
+ * Alert banner on the LVGL top layer
+ */
+
+#include "alert_view.h"
+#include "alert.h"
+#include "blink.h"
+#include <stdio.h>
+
+#define BANNER_W 200
+#define BANNER_H 36
+#define POLL_MS 100
+
+static lv_obj_t *banner;
+static lv_obj_t *banner_label;
+static uint32_t shown_version;
+
+/* Rebuild the banner only when the set of active alerts changed */
+static void banner_sync(void) {
+  alert_id_t top = alert_top();
+  uint8_t count = alert_active_count();
+  char buf[32];
+
+  shown_version = alert_version();
+  if (top == ALERT_NONE) {
+    lv_obj_add_flag(banner, LV_OBJ_FLAG_HIDDEN);
+    return;
+  }
+
+  if (count > 1)
+    snprintf(buf, sizeof(buf), "%s  +%u", alert_text(top),
+             (unsigned)(count - 1));
+  else
+    snprintf(buf, sizeof(buf), "%s", alert_text(top));
+  lv_label_set_text(banner_label, buf);
+
+  bool critical = alert_severity(top) == ALERT_SEV_CRITICAL;
+  lv_obj_set_style_bg_color(
+      banner, lv_palette_main(critical ? LV_PALETTE_RED : LV_PALETTE_AMBER), 0);
+  lv_obj_set_style_opa(banner, LV_OPA_COVER, 0);
+  lv_obj_remove_flag(banner, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void poll_timer_cb(lv_timer_t *t) {
+  LV_UNUSED(t);
+  alert_tick(lv_tick_get());
+  if (alert_version() != shown_version)
+    banner_sync();
+}
+
+/* Critical alerts flash with the shared blink phase; only the banner area
+ * is redrawn */
+static void banner_blink_cb(bool on, void *user_data) {
+  LV_UNUSED(user_data);
+  alert_id_t top = alert_top();
+  if (top == ALERT_NONE || alert_severity(top) != ALERT_SEV_CRITICAL)
+    return;
+  lv_obj_set_style_opa(banner, on ? LV_OPA_COVER : LV_OPA_50, 0);
+}
+
+void alert_view_create(const lv_font_t *font) {
+  banner = lv_obj_create(lv_layer_top());
+  lv_obj_remove_style_all(banner);
+  lv_obj_remove_flag(banner, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_size(banner, BANNER_W, BANNER_H);
+  lv_obj_align(banner, LV_ALIGN_TOP_MID, 0, 2);
+  lv_obj_set_style_radius(banner, 6, 0);
+  lv_obj_set_style_bg_opa(banner, LV_OPA_COVER, 0);
+  lv_obj_add_flag(banner, LV_OBJ_FLAG_HIDDEN);
+
+  banner_label = lv_label_create(banner);
+  lv_obj_set_style_text_font(banner_label, font, 0);
+  lv_obj_set_style_text_color(banner_label, lv_color_hex(0x000000), 0);
+  lv_obj_center(banner_label);
+
+  shown_version = alert_version();
+  lv_timer_create(poll_timer_cb, POLL_MS, NULL);
+  blink_subscribe(banner_blink_cb, NULL);
+}
@@ -0,0 +1,16 @@
+/**
+ * alert_view.h
+ * Alert banner on the LVGL top layer
+ *
+ * The banner lives on lv_layer_top(), above every page, so showing,
+ * flashing or clearing it only invalidates the banner's own area and never
+ * makes the gauge or side panels underneath rebuild their content.
+ */
+#ifndef ALERT_VIEW_H
+#define ALERT_VIEW_H
+
+#include "lvgl.h"
+
+void alert_view_create(const lv_font_t *font);
+
+#endif /*ALERT_VIEW_H*/
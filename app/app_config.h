@@ -0,0 +1,170 @@
+/**
+ * app_config.h
+ * Build-time configuration of the dashboard application.
+ *
+ * On the MCU the values come from menuconfig ("E-Bike Dashboard" menu in
+ * main/Kconfig.projbuild). The simulator has no sdkconfig, so it uses the
+ * defaults below, which mirror the Kconfig defaults.
+ */
+#ifndef APP_CONFIG_H
+#define APP_CONFIG_H
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+/* Glyph decode cache (glyph_cache.c) */
+#ifndef CONFIG_DASH_GLYPH_CACHE_SLOTS
+#define CONFIG_DASH_GLYPH_CACHE_SLOTS 48
+#endif
+#ifndef CONFIG_DASH_GLYPH_CACHE_SLOT_SIZE
+#define CONFIG_DASH_GLYPH_CACHE_SLOT_SIZE 1024
+#endif
+
+/* LVGL image cache used for RLE/LZ4 compressed images, in bytes */
+#ifndef CONFIG_DASH_IMAGE_CACHE_SIZE
+#define CONFIG_DASH_IMAGE_CACHE_SIZE (32 * 1024)
+#endif
+
+/* Page manager (page_manager.c) */
+#ifndef CONFIG_DASH_PAGE_CACHE_SIZE
+#define CONFIG_DASH_PAGE_CACHE_SIZE 3
+#endif
+#ifndef CONFIG_DASH_PAGE_POOL_SIZE
+#define CONFIG_DASH_PAGE_POOL_SIZE 48
+#endif
+#ifndef CONFIG_DASH_PAGE_UPDATE_MS
+#define CONFIG_DASH_PAGE_UPDATE_MS 100
+#endif
+
+/* Trip computer (trip.c) */
+#ifndef CONFIG_DASH_TRIP_SAMPLE_MS
+#define CONFIG_DASH_TRIP_SAMPLE_MS 20
+#endif
+/* Bool: absent from sdkconfig.h when disabled, so only default it here */
+#if !defined(ESP_PLATFORM) && !defined(CONFIG_DASH_REGEN_INDICATOR)
+#define CONFIG_DASH_REGEN_INDICATOR 1
+#endif
+
+/* Odometer journal (journal.c) */
+#ifndef CONFIG_DASH_JOURNAL_COMMIT_M
+#define CONFIG_DASH_JOURNAL_COMMIT_M 500
+#endif
+
+/* Telemetry bus (telemetry.c), samples per queued channel, power of two */
+#ifndef CONFIG_DASH_TELEMETRY_QUEUE_LEN
+#define CONFIG_DASH_TELEMETRY_QUEUE_LEN 16
+#endif
+
+/* Ride detection (ride.c) */
+#ifndef CONFIG_DASH_RIDE_START_KMH
+#define CONFIG_DASH_RIDE_START_KMH 3
+#endif
+#ifndef CONFIG_DASH_RIDE_START_MS
+#define CONFIG_DASH_RIDE_START_MS 3000
+#endif
+#ifndef CONFIG_DASH_RIDE_END_S
+#define CONFIG_DASH_RIDE_END_S 300
+#endif
+#ifndef CONFIG_DASH_PARKED_REFR_MS
+#define CONFIG_DASH_PARKED_REFR_MS 250
+#endif
+
+/* Range estimate (range.c) */
+#ifndef CONFIG_DASH_RANGE_BUCKET_M
+#define CONFIG_DASH_RANGE_BUCKET_M 100
+#endif
+#ifndef CONFIG_DASH_RANGE_DEFAULT_WHKM
+#define CONFIG_DASH_RANGE_DEFAULT_WHKM 15
+#endif
+
+/* Battery (soc.c) */
+#ifndef CONFIG_DASH_BATT_CELLS_S
+#define CONFIG_DASH_BATT_CELLS_S 13
+#endif
+#ifndef CONFIG_DASH_BATT_CAPACITY_MAH
+#define CONFIG_DASH_BATT_CAPACITY_MAH 20000
+#endif
+#ifndef CONFIG_DASH_SOC_REST_MA
+#define CONFIG_DASH_SOC_REST_MA 300
+#endif
+#ifndef CONFIG_DASH_SOC_REST_S
+#define CONFIG_DASH_SOC_REST_S 600
+#endif
+
+/* Power peaks (peak.c) */
+#ifndef CONFIG_DASH_PEAK_SHORT_S
+#define CONFIG_DASH_PEAK_SHORT_S 10
+#endif
+#ifndef CONFIG_DASH_PEAK_LONG_S
+#define CONFIG_DASH_PEAK_LONG_S 60
+#endif
+
+/* Telemetry history (history_store.c) */
+#ifndef CONFIG_DASH_HISTORY_PERIOD_MS
+#define CONFIG_DASH_HISTORY_PERIOD_MS 125
+#endif
+#ifndef CONFIG_DASH_HISTORY_LEN
+#define CONFIG_DASH_HISTORY_LEN 512
+#endif
+
+/* Alert thresholds (alert.c) */
+#ifndef CONFIG_DASH_ALERT_OVERSPEED_KMH
+#define CONFIG_DASH_ALERT_OVERSPEED_KMH 60
+#endif
+#ifndef CONFIG_DASH_ALERT_OVER_TEMP_C
+#define CONFIG_DASH_ALERT_OVER_TEMP_C 60
+#endif
+#ifndef CONFIG_DASH_ALERT_LOW_SOC_PCT
+#define CONFIG_DASH_ALERT_LOW_SOC_PCT 15
+#endif
+
+/* Indicators (blink.c) */
+#ifndef CONFIG_DASH_BLINK_HALF_PERIOD_MS
+#define CONFIG_DASH_BLINK_HALF_PERIOD_MS 500
+#endif
+
+/* Switch input (input.c) */
+#ifndef CONFIG_DASH_INPUT_DEBOUNCE_MS
+#define CONFIG_DASH_INPUT_DEBOUNCE_MS 20
+#endif
+#ifndef CONFIG_DASH_INPUT_QUEUE_LEN
+#define CONFIG_DASH_INPUT_QUEUE_LEN 32 /* power of two */
+#endif
+
+/* Wheel speed (wheel.c) */
+#ifndef CONFIG_DASH_WHEEL_CIRCUMFERENCE_MM
+#define CONFIG_DASH_WHEEL_CIRCUMFERENCE_MM 2100
+#endif
+#ifndef CONFIG_DASH_WHEEL_PULSES_PER_REV
+#define CONFIG_DASH_WHEEL_PULSES_PER_REV 1
+#endif
+#ifndef CONFIG_DASH_WHEEL_GATE_MS
+#define CONFIG_DASH_WHEEL_GATE_MS 500
+#endif
+#ifndef CONFIG_DASH_WHEEL_UPDATE_MS
+#define CONFIG_DASH_WHEEL_UPDATE_MS 50
+#endif
+#ifndef CONFIG_DASH_WHEEL_MIN_KMH
+#define CONFIG_DASH_WHEEL_MIN_KMH 2
+#endif
+
+/* BMS on CAN (bms_can.c), first of the BMS's 8 frame IDs */
+#ifndef CONFIG_DASH_BMS_CAN_BASE
+#define CONFIG_DASH_BMS_CAN_BASE 0x100
+#endif
+
+/* Display resampling (resample.c) */
+#ifndef CONFIG_DASH_RESAMPLE_DELAY_MS
+#define CONFIG_DASH_RESAMPLE_DELAY_MS 100
+#endif
+
+/* Ride log (ridelog.c) */
+#ifndef CONFIG_DASH_RIDELOG_PERIOD_MS
+#define CONFIG_DASH_RIDELOG_PERIOD_MS 20
+#endif
+#ifndef CONFIG_DASH_RIDELOG_KEY_MS
+#define CONFIG_DASH_RIDELOG_KEY_MS 2000
+#endif
+
+#endif /*APP_CONFIG_H*/
@@ -0,0 +1,26 @@
+/**
+ * asset_map.h
+ * Read-only memory mapping of asset blobs (font packs, asset packs)
+ *
+ * Implemented per platform: on the MCU `name` is a data partition mapped
+ * through the flash cache (main/asset_map_esp.c), in the simulator it is the
+ * file "<name>.bin" in $EBIKE_ASSET_DIR (simulator/src/hal/asset_map_host.c).
+ * Mapped data is used in place and never copied into RAM.
+ */
+#ifndef ASSET_MAP_H
+#define ASSET_MAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  const uint8_t *data;
+  size_t size;
+  void *handle; /* platform specific */
+} asset_map_t;
+
+bool asset_map_open(const char *name, asset_map_t *map);
+void asset_map_close(asset_map_t *map);
+
+#endif /*ASSET_MAP_H*/
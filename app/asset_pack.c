@@ -0,0 +1,171 @@
+/**
+ * asset_pack.c
+ * Zero-copy skin packs
+ *
+ * Two pack slots are used in turn: a new pack is loaded and checked in the
+ * spare slot, then the active pointer is swapped in one store.
+ */
+
+#include "asset_pack.h"
+#include "crc.h"
+#include <string.h>
+
+typedef struct {
+  asset_map_t map;
+  const asset_pack_header_t *header;
+  const asset_palette_t *palettes[ASSET_PALETTE_COUNT];
+  font_pack_t fonts[ASSET_FONT_COUNT];
+  lv_image_dsc_t images[ASSET_IMAGE_COUNT];
+  bool has_image[ASSET_IMAGE_COUNT];
+} asset_pack_t;
+
+static asset_pack_t pack_slots[2];
+static asset_pack_t *active_pack; /* NULL: compiled-in assets */
+
+static void pack_close(asset_pack_t *pack) {
+  for (int i = 0; i < ASSET_FONT_COUNT; i++)
+    font_pack_close(&pack->fonts[i]);
+  if (pack->map.data)
+    asset_map_close(&pack->map);
+  memset(pack, 0, sizeof(*pack));
+}
+
+/* The pixel data must cover stride x h for the colour format, plus the
+ * palette of indexed formats; a compressed image carries its own
+ * (method, compressed size, decompressed size) header. */
+static bool image_size_ok(const lv_image_dsc_t *img) {
+  const lv_image_header_t *h = &img->header;
+  uint32_t bpp = lv_color_format_get_bpp((lv_color_format_t)h->cf);
+  uint32_t min_stride = (h->w * bpp + 7) / 8;
+  uint32_t stride = h->stride ? h->stride : min_stride;
+
+  if (bpp == 0 || stride < min_stride)
+    return false;
+  uint64_t need = (uint64_t)stride * h->h;
+  if (LV_COLOR_FORMAT_IS_INDEXED(h->cf))
+    need += LV_COLOR_INDEXED_PALETTE_SIZE(h->cf) * sizeof(lv_color32_t);
+
+  if (h->flags & LV_IMAGE_FLAGS_COMPRESSED) {
+    uint32_t c[3]; /* method, compressed size, decompressed size */
+    if (img->data_size < sizeof(c))
+      return false;
+    memcpy(c, img->data, sizeof(c));
+    return c[1] <= img->data_size - sizeof(c) && c[2] >= need;
+  }
+  return img->data_size >= need;
+}
+
+static bool pack_load_entry(asset_pack_t *pack, const asset_pack_entry_t *e) {
+  const uint8_t *data = pack->map.data + e->offset;
+
+  switch (e->type) {
+  case ASSET_TYPE_PALETTE:
+    if (e->id >= ASSET_PALETTE_COUNT || e->size < sizeof(asset_palette_t))
+      return false;
+    pack->palettes[e->id] = (const asset_palette_t *)data;
+    return true;
+
+  case ASSET_TYPE_FONT:
+    if (e->id >= ASSET_FONT_COUNT)
+      return false;
+    return font_pack_open_mem(&pack->fonts[e->id], data, e->size);
+
+  case ASSET_TYPE_IMAGE: {
+    if (e->id >= ASSET_IMAGE_COUNT || e->size < sizeof(lv_image_header_t))
+      return false;
+    /* Descriptor in RAM, pixels stay in the mapping */
+    lv_image_dsc_t *img = &pack->images[e->id];
+    memcpy(&img->header, data, sizeof(lv_image_header_t));
+    if (img->header.magic != LV_IMAGE_HEADER_MAGIC)
+      return false;
+    img->data = data + sizeof(lv_image_header_t);
+    img->data_size = e->size - sizeof(lv_image_header_t);
+    if (!image_size_ok(img))
+      return false;
+    pack->has_image[e->id] = true;
+    return true;
+  }
+
+  default:
+    /* Unknown entry types from newer tools are skipped */
+    return true;
+  }
+}
+
+static bool pack_load(asset_pack_t *pack, const char *name) {
+  if (!asset_map_open(name, &pack->map))
+    return false;
+
+  const uint8_t *base = pack->map.data;
+  const asset_pack_header_t *h = (const asset_pack_header_t *)base;
+  size_t size = pack->map.size;
+
+  if (size < sizeof(*h) || h->magic != ASSET_PACK_MAGIC ||
+      h->version != ASSET_PACK_VERSION || h->total_size > size ||
+      h->total_size < sizeof(*h) + h->entry_count * sizeof(asset_pack_entry_t) ||
+      h->name[sizeof(h->name) - 1] != '\0')
+    return false;
+  if (crc32_update(0, base + sizeof(*h), h->total_size - sizeof(*h)) !=
+      h->crc32)
+    return false;
+
+  pack->header = h;
+  const asset_pack_entry_t *entries = (const asset_pack_entry_t *)(h + 1);
+  for (uint16_t i = 0; i < h->entry_count; i++) {
+    const asset_pack_entry_t *e = &entries[i];
+    if ((e->offset & 3u) != 0 || e->offset > h->total_size ||
+        e->size > h->total_size - e->offset)
+      return false;
+    if (!pack_load_entry(pack, e))
+      return false;
+  }
+  return true;
+}
+
+bool asset_pack_activate(const char *name) {
+  if (name == NULL) {
+    active_pack = NULL;
+    return true;
+  }
+
+  asset_pack_t *spare =
+      (active_pack == &pack_slots[0]) ? &pack_slots[1] : &pack_slots[0];
+  pack_close(spare); /* the pack before the current one */
+  if (!pack_load(spare, name)) {
+    pack_close(spare);
+    return false;
+  }
+  active_pack = spare;
+  return true;
+}
+
+void asset_pack_set_font_fallback(asset_font_id_t id,
+                                  const lv_font_t *fallback) {
+  if (active_pack == NULL || id >= ASSET_FONT_COUNT ||
+      active_pack->fonts[id].header == NULL)
+    return;
+  active_pack->fonts[id].font.fallback = fallback;
+}
+
+const char *asset_pack_active_name(void) {
+  return active_pack ? active_pack->header->name : NULL;
+}
+
+const asset_palette_t *asset_pack_palette(asset_palette_id_t id) {
+  if (active_pack == NULL || id >= ASSET_PALETTE_COUNT)
+    return NULL;
+  return active_pack->palettes[id];
+}
+
+const lv_font_t *asset_pack_font(asset_font_id_t id) {
+  if (active_pack == NULL || id >= ASSET_FONT_COUNT)
+    return NULL;
+  return font_pack_font(&active_pack->fonts[id]);
+}
+
+const lv_image_dsc_t *asset_pack_image(asset_image_id_t id) {
+  if (active_pack == NULL || id >= ASSET_IMAGE_COUNT ||
+      !active_pack->has_image[id])
+    return NULL;
+  return &active_pack->images[id];
+}
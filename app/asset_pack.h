@@ -0,0 +1,108 @@
+/**
+ * asset_pack.h
+ * Zero-copy skin packs: theme palettes, fonts, icons and gauge background
+ *
+ * A skin pack is mapped from its flash partition (an mmap'ed file in the
+ * simulator) and used in place: palettes and glyph/pixel data are read
+ * straight from the mapping; only the small LVGL descriptors live in RAM.
+ *
+ * Layout (little endian, every entry 4-byte aligned), produced by
+ * img/make-assetpack.py:
+ *
+ *   asset_pack_header_t
+ *   asset_pack_entry_t entries[entry_count]
+ *   entry data
+ *
+ * `crc32` covers everything after the header. A pack is fully validated
+ * before it becomes active, so switching skins is all-or-nothing.
+ */
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include "asset_map.h"
+#include "font_pack.h"
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ASSET_PACK_MAGIC 0x50414245u /* "EBAP" */
+#define ASSET_PACK_VERSION 1
+
+typedef enum {
+  ASSET_TYPE_PALETTE = 1, /* asset_palette_t */
+  ASSET_TYPE_FONT = 2,    /* font pack, see font_pack.h */
+  ASSET_TYPE_IMAGE = 3,   /* lv_image_header_t followed by pixel data */
+} asset_type_t;
+
+typedef enum {
+  ASSET_PALETTE_DAY,
+  ASSET_PALETTE_NIGHT,
+  ASSET_PALETTE_COUNT,
+} asset_palette_id_t;
+
+typedef enum {
+  ASSET_FONT_TITLE,
+  ASSET_FONT_VALUE,
+  ASSET_FONT_CLOCK,
+  ASSET_FONT_SPEED,
+  ASSET_FONT_ENERGY,
+  ASSET_FONT_COUNT,
+} asset_font_id_t;
+
+typedef enum {
+  ASSET_IMAGE_LEFT_TURN,
+  ASSET_IMAGE_RIGHT_TURN,
+  ASSET_IMAGE_HIGH_BEAM,
+  ASSET_IMAGE_GAUGE_BG,
+  ASSET_IMAGE_COUNT,
+} asset_image_id_t;
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entry_count;
+  uint32_t total_size;
+  uint32_t crc32;
+  char name[16];
+} asset_pack_header_t;
+
+typedef struct {
+  uint16_t type;
+  uint16_t id;
+  uint32_t offset; /* from the start of the pack */
+  uint32_t size;
+} asset_pack_entry_t;
+
+/* Theme colours, 0xRRGGBB */
+typedef struct {
+  uint32_t bg;
+  uint32_t text_main;
+  uint32_t text_dim;
+  uint32_t line;
+  uint32_t border;
+  uint32_t text_alert;
+  uint32_t needle;
+  uint32_t energy_regen;
+  uint32_t energy_consume;
+} asset_palette_t;
+
+/* Map, validate and switch to the skin pack stored under `name`.
+ * NULL switches back to the compiled-in assets. On failure the current
+ * skin stays active. The caller re-applies the theme afterwards; the
+ * previous pack stays mapped until the next switch so objects still
+ * referencing it remain valid in between. */
+bool asset_pack_activate(const char *name);
+
+/* Name of the active pack, or NULL for the compiled-in assets */
+const char *asset_pack_active_name(void);
+
+/* Assets of the active pack; NULL when the pack does not provide them */
+const asset_palette_t *asset_pack_palette(asset_palette_id_t id);
+const lv_font_t *asset_pack_font(asset_font_id_t id);
+const lv_image_dsc_t *asset_pack_image(asset_image_id_t id);
+
+/* Font used for glyphs missing from the pack font `id` */
+void asset_pack_set_font_fallback(asset_font_id_t id,
+                                  const lv_font_t *fallback);
+
+#endif /*ASSET_PACK_H*/
@@ -0,0 +1,67 @@
+/**
+ * blink.c
+ * Shared blink phase for indicators, the clock colon and flashing alerts
+ */
+
+#include "blink.h"
+#include "app_config.h"
+#include "lvgl.h"
+
+typedef struct {
+  blink_cb_t cb;
+  void *user_data;
+} blink_sub_t;
+
+static blink_sub_t subs[BLINK_MAX_SUBSCRIBERS];
+static uint8_t sub_count;
+static lv_timer_t *blink_timer;
+static volatile uint32_t edge_count;
+
+static void blink_edge(void) {
+  uint32_t edges = edge_count + 1;
+  bool on = (edges & 1u) != 0;
+
+  edge_count = edges;
+  for (uint8_t i = 0; i < sub_count; i++)
+    subs[i].cb(on, subs[i].user_data);
+}
+
+static void blink_timer_cb(lv_timer_t *t) {
+  LV_UNUSED(t);
+  blink_edge();
+}
+
+bool blink_subscribe(blink_cb_t cb, void *user_data) {
+  if (sub_count >= BLINK_MAX_SUBSCRIBERS)
+    return false;
+  if (blink_timer == NULL)
+    blink_timer = lv_timer_create(blink_timer_cb,
+                                  CONFIG_DASH_BLINK_HALF_PERIOD_MS, NULL);
+
+  subs[sub_count].cb = cb;
+  subs[sub_count].user_data = user_data;
+  sub_count++;
+  cb(blink_phase(), user_data);
+  return true;
+}
+
+void blink_unsubscribe(blink_cb_t cb, void *user_data) {
+  for (uint8_t i = 0; i < sub_count; i++) {
+    if (subs[i].cb == cb && subs[i].user_data == user_data) {
+      subs[i] = subs[--sub_count];
+      return;
+    }
+  }
+}
+
+void blink_restart(void) {
+  if (blink_timer == NULL)
+    return;
+  lv_timer_reset(blink_timer);
+  if (!blink_phase())
+    blink_edge();
+}
+
+bool blink_phase(void) { return (edge_count & 1u) != 0; }
+
+uint32_t blink_edge_count(void) { return edge_count; }
@@ -0,0 +1,37 @@
+/**
+ * blink.h
+ * Shared blink phase for indicators, the clock colon and flashing alerts
+ *
+ * One LVGL timer flips the phase every CONFIG_DASH_BLINK_HALF_PERIOD_MS and
+ * calls every subscriber from the same callback, so all blinking elements
+ * change in the same frame and their invalidated areas are redrawn in one
+ * refresh per edge.
+ *
+ * blink_phase() and blink_edge_count() read a single word and may be used
+ * from other tasks, e.g. to click the turn-signal relay sound in step with
+ * the icons.
+ */
+#ifndef BLINK_H
+#define BLINK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BLINK_MAX_SUBSCRIBERS 8
+
+typedef void (*blink_cb_t)(bool on, void *user_data);
+
+/* Subscribers are called once right away with the current phase */
+bool blink_subscribe(blink_cb_t cb, void *user_data);
+void blink_unsubscribe(blink_cb_t cb, void *user_data);
+
+/* Start a new "on" half period now, e.g. when a turn signal is switched on,
+ * so it lights in the next frame instead of up to half a period later */
+void blink_restart(void);
+
+/* true during the "on" half period */
+bool blink_phase(void);
+/* Edges since start; the phase is on when the count is odd */
+uint32_t blink_edge_count(void);
+
+#endif /*BLINK_H*/
@@ -0,0 +1,142 @@
+/**
+ * bms_can.c
+ * Battery management system on CAN: frame decoding and ID dispatch
+ */
+
+#include "bms_can.h"
+#include "app_config.h"
+#include "telemetry.h"
+#include <string.h>
+
+#if CONFIG_DASH_BMS_CAN_BASE % BMS_CAN_IDS != 0
+#error "CONFIG_DASH_BMS_CAN_BASE must be a multiple of BMS_CAN_IDS"
+#endif
+#if CONFIG_DASH_BATT_CELLS_S > BMS_MAX_CELLS
+#error "more cells in series than the BMS reports"
+#endif
+
+#define CELLS_PER_FRAME 4
+#define CELL_GROUPS \
+  ((CONFIG_DASH_BATT_CELLS_S + CELLS_PER_FRAME - 1) / CELLS_PER_FRAME)
+
+/* Bit field of a little endian frame loaded as one 64-bit word */
+#define BMS_FIELD(raw, start, len, sgn)                                        \
+  ((sgn) ? (int32_t)((int64_t)((raw) << (64 - (start) - (len))) >>            \
+                     (64 - (len)))                                             \
+         : (int32_t)(((raw) >> (start)) & ((1ull << (len)) - 1)))
+
+/* Signals per message: X(topic, start bit, length, signed, scale) */
+#define BMS_PACK_SIGNALS(X)                                                    \
+  X(TELEMETRY_PACK_VOLTAGE, 0, 16, 0, 10)                                      \
+  X(TELEMETRY_PACK_CURRENT, 16, 16, 1, 10)                                     \
+  X(TELEMETRY_BMS_SOC, 32, 10, 0, 1)                                           \
+  X(TELEMETRY_BMS_FAULTS, 42, 6, 0, 1)                                         \
+  X(TELEMETRY_BATT_TEMP, 48, 8, 1, 1)
+
+#define BMS_CAPACITY_SIGNALS(X) X(TELEMETRY_BMS_CAPACITY, 0, 16, 0, 10)
+
+#define BMS_PUBLISH(topic, start, len, sgn, scale)                             \
+  telemetry_publish(topic, BMS_FIELD(raw, start, len, sgn) * (scale), now_ms);
+
+#define BMS_SIGNAL_DECODER(name, signals)                                      \
+  static void name(uint64_t raw, uint32_t now_ms) { signals(BMS_PUBLISH) }
+
+BMS_SIGNAL_DECODER(bms_pack, BMS_PACK_SIGNALS)
+BMS_SIGNAL_DECODER(bms_capacity, BMS_CAPACITY_SIGNALS)
+
+static uint16_t cell_mv[BMS_MAX_CELLS];
+static uint8_t cell_groups_seen; /* bit per frame of the current report */
+static bms_can_stats_t stats;
+
+static void bms_cells(uint8_t group, uint64_t raw, uint32_t now_ms) {
+  if (group >= CELL_GROUPS)
+    return; /* cells this pack does not have */
+  for (uint8_t i = 0; i < CELLS_PER_FRAME; i++) {
+    uint8_t cell = group * CELLS_PER_FRAME + i;
+    if (cell < CONFIG_DASH_BATT_CELLS_S)
+      cell_mv[cell] = (uint16_t)BMS_FIELD(raw, 16 * i, 16, 0);
+  }
+  cell_groups_seen |= 1u << group;
+  if (group != CELL_GROUPS - 1)
+    return;
+  if (cell_groups_seen == (1u << CELL_GROUPS) - 1) {
+    uint16_t lo = cell_mv[0], hi = cell_mv[0];
+    for (uint8_t c = 1; c < CONFIG_DASH_BATT_CELLS_S; c++) {
+      if (cell_mv[c] < lo)
+        lo = cell_mv[c];
+      if (cell_mv[c] > hi)
+        hi = cell_mv[c];
+    }
+    telemetry_publish(TELEMETRY_CELL_MIN, lo, now_ms);
+    telemetry_publish(TELEMETRY_CELL_MAX, hi, now_ms);
+    stats.cell_reports++;
+  }
+  cell_groups_seen = 0;
+}
+
+#define BMS_CELL_DECODER(group)                                                \
+  static void bms_cells_##group(uint64_t raw, uint32_t now_ms) {               \
+    bms_cells(group, raw, now_ms);                                             \
+  }
+
+BMS_CELL_DECODER(0)
+BMS_CELL_DECODER(1)
+BMS_CELL_DECODER(2)
+BMS_CELL_DECODER(3)
+BMS_CELL_DECODER(4)
+BMS_CELL_DECODER(5)
+
+/* X(ID offset, minimum DLC, decoder); an offset outside the window fails
+ * to compile as an out of bounds initializer */
+#define BMS_MESSAGES(X)                                                        \
+  X(0, 7, bms_pack)                                                            \
+  X(1, 2, bms_capacity)                                                        \
+  X(2, 8, bms_cells_0)                                                         \
+  X(3, 8, bms_cells_1)                                                         \
+  X(4, 8, bms_cells_2)                                                         \
+  X(5, 8, bms_cells_3)                                                         \
+  X(6, 8, bms_cells_4)                                                         \
+  X(7, 8, bms_cells_5)
+
+typedef struct {
+  void (*decode)(uint64_t raw, uint32_t now_ms);
+  uint8_t min_dlc;
+} bms_message_t;
+
+#define BMS_DISPATCH_ENTRY(offset, dlc, fn) [offset] = {fn, dlc},
+static const bms_message_t bms_dispatch[BMS_CAN_IDS] = {
+    BMS_MESSAGES(BMS_DISPATCH_ENTRY)};
+
+bool bms_can_init(void) {
+  memset(cell_mv, 0, sizeof(cell_mv));
+  cell_groups_seen = 0;
+  memset(&stats, 0, sizeof(stats));
+  return bms_can_platform_init();
+}
+
+bool bms_can_frame(uint32_t id, const uint8_t *data, uint8_t dlc,
+                   uint32_t now_ms) {
+  uint32_t offset = id - CONFIG_DASH_BMS_CAN_BASE;
+  if (offset >= BMS_CAN_IDS || bms_dispatch[offset].decode == NULL) {
+    stats.ignored++;
+    return false;
+  }
+  const bms_message_t *m = &bms_dispatch[offset];
+  if (dlc < m->min_dlc || dlc > 8) {
+    stats.bad_dlc++;
+    return true;
+  }
+
+  uint64_t raw = 0;
+  for (uint8_t i = dlc; i-- > 0;)
+    raw = raw << 8 | data[i];
+  m->decode(raw, now_ms);
+  stats.frames++;
+  return true;
+}
+
+void bms_can_get_cells(uint16_t *mv) {
+  memcpy(mv, cell_mv, CONFIG_DASH_BATT_CELLS_S * sizeof(cell_mv[0]));
+}
+
+void bms_can_get_stats(bms_can_stats_t *out) { *out = stats; }
@@ -0,0 +1,72 @@
+/**
+ * bms_can.h
+ * Battery management system on CAN: frame decoding and ID dispatch
+ *
+ * The BMS sends standard 11-bit frames at CONFIG_DASH_BMS_CAN_BASE + n,
+ * signals as little endian (Intel) bit fields:
+ *
+ *   +0      pack      u16 voltage 10 mV, i16 current 10 mA (> 0:
+ *                     discharging), u10 SOC 0.1 %, u6 protection flags
+ *                     (bms_fault_t), i8 temperature deg C
+ *   +1      capacity  u16 full charge capacity 10 mAh
+ *   +2..+7  cells     4 x u16 cell voltage mV, cells 4 (n - 2) onwards
+ *
+ * Dispatch is a dense table of BMS_CAN_IDS entries indexed by the ID offset
+ * from the base, so a frame costs one range check and one indexed call, and
+ * other nodes' traffic is rejected by the same check. Each message has its
+ * own decoder generated from the signal list in bms_can.c; the start bit,
+ * length and scale of every signal are constants there, so each extraction
+ * compiles to a shift and a mask (and a sign extension).
+ *
+ * Cell voltages arrive as a burst of cell frames. Minimum and maximum are
+ * published once every frame of a report, up to the one holding cell
+ * CONFIG_DASH_BATT_CELLS_S, has been decoded.
+ */
+#ifndef BMS_CAN_H
+#define BMS_CAN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BMS_CAN_IDS 8 /* dispatch window; the base is a multiple of it */
+#define BMS_MAX_CELLS 24
+
+/* Protection flags of the pack message, published as TELEMETRY_BMS_FAULTS
+ * with every pack frame; a set flag means the BMS has tripped or is about
+ * to cut the output */
+typedef enum {
+  BMS_FAULT_CELL_OVER_VOLTAGE = 1 << 0,
+  BMS_FAULT_CELL_UNDER_VOLTAGE = 1 << 1,
+  BMS_FAULT_DISCHARGE_OVER_CURRENT = 1 << 2,
+  BMS_FAULT_CHARGE_OVER_CURRENT = 1 << 3,
+  BMS_FAULT_OVER_TEMP = 1 << 4,
+  BMS_FAULT_SHORT_CIRCUIT = 1 << 5,
+} bms_fault_t;
+
+typedef struct {
+  uint32_t frames;       /* decoded */
+  uint32_t ignored;      /* outside the window or no decoder */
+  uint32_t bad_dlc;      /* DLC too small for the message, or above 8 */
+  uint32_t cell_reports; /* complete cell reports */
+} bms_can_stats_t;
+
+/* Start the platform receiver; false when no CAN bus is configured */
+bool bms_can_init(void);
+
+/* One received frame; false if it is not a BMS message. Called by the
+ * receiver task, which is the producer of the BMS topics. */
+bool bms_can_frame(uint32_t id, const uint8_t *data, uint8_t dlc,
+                   uint32_t now_ms);
+
+/* Latest cell voltages in mV, CONFIG_DASH_BATT_CELLS_S of them, 0 before
+ * the first report. Read without a lock: a report arriving meanwhile may
+ * show through partly. */
+void bms_can_get_cells(uint16_t *mv);
+
+void bms_can_get_stats(bms_can_stats_t *out);
+
+/* Implemented per platform (main/bms_can_esp.c,
+ * simulator/src/hal/bms_can_host.c); true when a receiver was started */
+bool bms_can_platform_init(void);
+
+#endif /*BMS_CAN_H*/
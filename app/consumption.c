@@ -0,0 +1,67 @@
+/**
+ * consumption.c
+ * Rolling Wh/km over the last 1, 10 and 100 km
+ */
+
+#include "consumption.h"
+#include "trip.h"
+
+#define BUCKET_UNITS ((uint64_t)CONSUMPTION_BUCKET_M * TRIP_UNITS_PER_M)
+#define UJ_PER_MWH 3600000
+#define RING_LEN 1000 /* buckets in the longest horizon */
+
+static const uint16_t horizon_buckets[CONSUMPTION_HORIZONS] = {
+    [CONSUMPTION_1KM] = 10,
+    [CONSUMPTION_10KM] = 100,
+    [CONSUMPTION_100KM] = RING_LEN,
+};
+
+static int32_t ring_mwh[RING_LEN];
+static uint16_t ring_head;   /* next bucket to write */
+static uint32_t closed;      /* buckets closed so far */
+static int64_t sum_mwh[CONSUMPTION_HORIZONS];
+
+/* Open bucket */
+static uint64_t open_dist;
+static int64_t open_uj;
+
+static void bucket_close(int32_t mwh) {
+  for (uint8_t h = 0; h < CONSUMPTION_HORIZONS; h++) {
+    uint16_t n = horizon_buckets[h];
+    sum_mwh[h] += mwh;
+    if (closed >= n)
+      sum_mwh[h] -= ring_mwh[(ring_head + RING_LEN - n) % RING_LEN];
+  }
+  ring_mwh[ring_head] = mwh;
+  ring_head = (ring_head + 1) % RING_LEN;
+  closed++;
+}
+
+bool consumption_sample(uint16_t speed_x100, int32_t power_w, uint32_t dt_us) {
+  open_dist += (uint64_t)speed_x100 * dt_us;
+  open_uj += (int64_t)power_w * dt_us;
+  if (open_dist < BUCKET_UNITS)
+    return false;
+
+  /* The overshoot starts the next bucket; energy is not split, the error
+   * is one sample's worth */
+  int32_t mwh = (int32_t)(open_uj / UJ_PER_MWH);
+  open_uj -= (int64_t)mwh * UJ_PER_MWH;
+  open_dist -= BUCKET_UNITS;
+  bucket_close(mwh);
+  return true;
+}
+
+bool consumption_mwhkm(consumption_horizon_t h, int32_t *mwhkm) {
+  if (h >= CONSUMPTION_HORIZONS || closed == 0)
+    return false;
+  uint32_t n = closed < horizon_buckets[h] ? closed : horizon_buckets[h];
+  /* mWh over n x 100 m */
+  *mwhkm = (int32_t)(sum_mwh[h] * (1000 / CONSUMPTION_BUCKET_M) / (int32_t)n);
+  return true;
+}
+
+int32_t consumption_whkm_x10(consumption_horizon_t h) {
+  int32_t mwhkm;
+  return consumption_mwhkm(h, &mwhkm) ? mwhkm / 100 : 0;
+}
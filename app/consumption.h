@@ -0,0 +1,39 @@
+/**
+ * consumption.h
+ * Rolling Wh/km over the last 1, 10 and 100 km
+ *
+ * Net battery energy is collected per CONSUMPTION_BUCKET_M of distance. Each
+ * closed bucket enters a ring sized for the longest horizon, and every
+ * horizon keeps a running sum: the new bucket is added and the one falling
+ * out of that horizon subtracted, so an update is O(1) per horizon and the
+ * memory (4 KB) does not depend on the trip length.
+ *
+ * Time spent stopped adds its energy to the open bucket, so standby drain
+ * counts against the next 100 m.
+ */
+#ifndef CONSUMPTION_H
+#define CONSUMPTION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CONSUMPTION_BUCKET_M 100
+
+typedef enum {
+  CONSUMPTION_1KM,
+  CONSUMPTION_10KM,
+  CONSUMPTION_100KM,
+  CONSUMPTION_HORIZONS,
+} consumption_horizon_t;
+
+/* Same samples as trip_sample(); true when a bucket was closed */
+bool consumption_sample(uint16_t speed_x100, int32_t power_w, uint32_t dt_us);
+
+/* Average over the horizon, or over the distance covered so far if that
+ * is shorter; false before the first bucket */
+bool consumption_mwhkm(consumption_horizon_t h, int32_t *mwhkm);
+
+/* Same in 0.1 Wh/km, 0 before the first bucket */
+int32_t consumption_whkm_x10(consumption_horizon_t h);
+
+#endif /*CONSUMPTION_H*/
@@ -0,0 +1,40 @@
+/**
+ * crc.c
+ * CRC-32 and CRC-8 with 16-entry nibble tables (64 and 16 bytes of flash
+ * instead of 1 KB and 256 bytes)
+ */
+
+#include "crc.h"
+
+static const uint32_t crc32_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+uint32_t crc32_update(uint32_t crc, const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+    crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+static const uint8_t crc8_nibble[16] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+    0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+};
+
+/* MSB first: the high nibble is shifted out first */
+uint8_t crc8_update(uint8_t crc, const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  while (len--) {
+    crc ^= *p++;
+    crc = (uint8_t)(crc << 4) ^ crc8_nibble[crc >> 4];
+    crc = (uint8_t)(crc << 4) ^ crc8_nibble[crc >> 4];
+  }
+  return crc;
+}
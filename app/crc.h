@@ -0,0 +1,16 @@
+/**
+ * crc.h
+ * CRC-32 (IEEE 802.3, reflected, as zlib/binascii.crc32) and CRC-8
+ * (poly 0x07, init 0, not reflected: CRC-8/SMBUS)
+ */
+#ifndef CRC_H
+#define CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Start with crc = 0; feed the previous result to continue a running CRC */
+uint32_t crc32_update(uint32_t crc, const void *data, size_t len);
+uint8_t crc8_update(uint8_t crc, const void *data, size_t len);
+
+#endif /*CRC_H*/
@@ -0,0 +1,180 @@
+/**
+ * ctrl_uart.c
+ * Motor controller UART protocol: streaming frame decoder
+ *
+ * head and tail run freely and are masked on access, so the full ring is
+ * usable and the fill level is head - tail. The producer publishes head with
+ * a release store after the bytes are in, the decoder publishes tail once
+ * the frames before it are consumed, as in spsc.c.
+ */
+
+#include "ctrl_uart.h"
+#include "crc.h"
+#include "telemetry.h"
+#include <string.h>
+
+#define RING_MASK (CTRL_RX_RING - 1)
+#define AT(i) ring[(i) & RING_MASK]
+
+#define STATUS_LEN 5
+#define BATTERY_LEN 4
+#define TEMPS_LEN 2
+
+static uint8_t ring[CTRL_RX_RING];
+static uint32_t head; /* producer side */
+static uint32_t tail; /* decoder side */
+static uint32_t skip_topics; /* bit per topic another producer owns */
+typedef char ctrl_skip_fits[TELEMETRY_TOPIC_COUNT <= 32 ? 1 : -1];
+
+/* bytes and overruns are written by the producer, the rest by the decoder */
+static ctrl_stats_t stats;
+
+bool ctrl_init(uint32_t skip) {
+  skip_topics = skip;
+  head = 0;
+  tail = 0;
+  memset(&stats, 0, sizeof(stats));
+  return ctrl_platform_init();
+}
+
+uint8_t *ctrl_rx_reserve(uint32_t *len) {
+  uint32_t free_bytes =
+      CTRL_RX_RING - (head - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+  uint32_t off = head & RING_MASK;
+  uint32_t contiguous = CTRL_RX_RING - off;
+
+  *len = free_bytes < contiguous ? free_bytes : contiguous;
+  return &ring[off];
+}
+
+void ctrl_rx_commit(uint32_t len) {
+  stats.bytes += len;
+  __atomic_store_n(&head, head + len, __ATOMIC_RELEASE);
+}
+
+uint32_t ctrl_rx_write(const uint8_t *data, uint32_t len) {
+  uint32_t done = 0;
+
+  while (done < len) {
+    uint32_t space;
+    uint8_t *dst = ctrl_rx_reserve(&space);
+    if (space == 0)
+      break;
+    if (space > len - done)
+      space = len - done;
+    memcpy(dst, data + done, space);
+    ctrl_rx_commit(space);
+    done += space;
+  }
+  stats.overruns += len - done;
+  return done;
+}
+
+/* Ring index of the first sync byte in [pos, end), or `end`: memchr() over
+ * at most two runs, so garbage between frames costs no per-byte checks */
+static uint32_t find_sync(uint32_t pos, uint32_t end) {
+  while (pos != end) {
+    uint32_t off = pos & RING_MASK;
+    uint32_t run = CTRL_RX_RING - off;
+    if (run > end - pos)
+      run = end - pos;
+    const uint8_t *hit = memchr(&ring[off], CTRL_SYNC, run);
+    if (hit != NULL)
+      return pos + (uint32_t)(hit - &ring[off]);
+    pos += run;
+  }
+  return end;
+}
+
+/* CRC of `n` ring bytes from index `from`, in at most two runs */
+static uint8_t ring_crc(uint32_t from, uint32_t n) {
+  uint32_t off = from & RING_MASK;
+  uint32_t first = CTRL_RX_RING - off;
+
+  if (first >= n)
+    return crc8_update(0, &ring[off], n);
+  return crc8_update(crc8_update(0, &ring[off], first), ring, n - first);
+}
+
+static uint16_t ring_u16(uint32_t i) {
+  return (uint16_t)(AT(i) | AT(i + 1) << 8);
+}
+
+static void ctrl_publish(telemetry_topic_t topic, int32_t value,
+                         uint32_t now_ms) {
+  if (!(skip_topics & (1u << topic)))
+    telemetry_publish(topic, value, now_ms);
+}
+
+/* Publish the fields of the payload at ring index `p`; false if the frame
+ * is not one we know */
+static bool publish_frame(uint8_t type, uint32_t p, uint8_t len,
+                          uint32_t now_ms) {
+  switch (type) {
+  case CTRL_FRAME_STATUS:
+    if (len < STATUS_LEN)
+      return false;
+    ctrl_publish(TELEMETRY_SPEED, ring_u16(p), now_ms);
+    ctrl_publish(TELEMETRY_POWER, (int16_t)ring_u16(p + 2), now_ms);
+    if (AT(p + 4) != 0)
+      ctrl_publish(TELEMETRY_ASSIST, AT(p + 4), now_ms);
+    return true;
+  case CTRL_FRAME_BATTERY:
+    if (len < BATTERY_LEN)
+      return false;
+    ctrl_publish(TELEMETRY_PACK_VOLTAGE, ring_u16(p) * 10, now_ms);
+    ctrl_publish(TELEMETRY_PACK_CURRENT, (int16_t)ring_u16(p + 2) * 10,
+                 now_ms);
+    return true;
+  case CTRL_FRAME_TEMPS:
+    if (len < TEMPS_LEN)
+      return false;
+    ctrl_publish(TELEMETRY_MOTOR_TEMP, (int8_t)AT(p), now_ms);
+    ctrl_publish(TELEMETRY_CTRL_TEMP, (int8_t)AT(p + 1), now_ms);
+    return true;
+  default:
+    return false;
+  }
+}
+
+void ctrl_decode(uint32_t now_ms) {
+  uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  uint32_t pos = tail;
+
+  while (end - pos >= CTRL_FRAME_OVERHEAD) {
+    if (AT(pos) != CTRL_SYNC) {
+      uint32_t sync = find_sync(pos, end);
+      stats.skipped += sync - pos;
+      pos = sync;
+      continue;
+    }
+    uint8_t len = AT(pos + 2);
+    if (len > CTRL_MAX_PAYLOAD) {
+      pos++;
+      stats.skipped++;
+      continue;
+    }
+    /* Incomplete: the rest arrives with a later call */
+    if (end - pos < (uint32_t)CTRL_FRAME_OVERHEAD + len)
+      break;
+    if (ring_crc(pos + 1, 2u + len) != AT(pos + 3 + len)) {
+      pos++;
+      stats.crc_errors++;
+      stats.skipped++;
+      continue;
+    }
+    if (publish_frame(AT(pos + 1), pos + 3, len, now_ms))
+      stats.frames++;
+    else
+      stats.unknown++;
+    pos += CTRL_FRAME_OVERHEAD + len;
+  }
+  __atomic_store_n(&tail, pos, __ATOMIC_RELEASE);
+}
+
+void ctrl_report_load(uint32_t busy_us, uint32_t window_us) {
+  if (window_us > 0)
+    stats.load_ppm = (uint32_t)((uint64_t)busy_us * 1000000u / window_us);
+}
+
+void ctrl_get_stats(ctrl_stats_t *out) { *out = stats; }
@@ -0,0 +1,96 @@
+/**
+ * ctrl_uart.h
+ * Motor controller UART protocol: streaming frame decoder
+ *
+ * Frame layout, multi-byte fields little endian:
+ *
+ *   0xA5  type  len  payload[len]  crc8
+ *
+ * The CRC-8 (poly 0x07, init 0) covers type, len and the payload. Frames
+ * the controller sends:
+ *
+ *   CTRL_FRAME_STATUS   u16 speed 0.01 km/h, i16 power W (< 0: regen),
+ *                       u8 assist level (0: not reported)
+ *   CTRL_FRAME_BATTERY  u16 pack voltage 10 mV, i16 pack current 10 mA
+ *                       (> 0: discharging)
+ *   CTRL_FRAME_TEMPS    i8 motor deg C, i8 controller deg C
+ *
+ * A payload longer than listed is accepted and the extra bytes ignored, so
+ * the controller may append fields; unknown types are counted and skipped.
+ *
+ * The platform receives straight into a ring of CTRL_RX_RING bytes
+ * (ctrl_rx_reserve() / ctrl_rx_commit()) and ctrl_decode() parses the
+ * frames in place: fields are read from the ring, across the wrap if need
+ * be, and published on the telemetry bus without a frame buffer. A frame
+ * that is not complete yet stays in the ring for the next call, so the
+ * decoder keeps no state besides the ring indices.
+ *
+ * Resynchronisation: when the length after a sync byte is out of range or
+ * the CRC does not match, that sync byte is dropped and the scan restarts
+ * at the next sync byte, found with memchr(). A corrupt frame therefore
+ * costs at most the frames it overlaps, and a sync byte inside a payload is
+ * never taken for a frame start once the stream is aligned.
+ *
+ * The ring is lock-free single-producer / single-consumer like spsc.h, so
+ * the receiver may be a DMA callback or another task than the decoder.
+ * Whichever task calls ctrl_decode() is the single producer of the topics
+ * above while the link is configured, except those another source owns
+ * (the BMS, the wheel sensor), which are passed to ctrl_init().
+ */
+#ifndef CTRL_UART_H
+#define CTRL_UART_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CTRL_RX_RING 1024 /* power of two, > 2 frames of CTRL_MAX_PAYLOAD */
+#define CTRL_SYNC 0xA5
+#define CTRL_MAX_PAYLOAD 32
+#define CTRL_FRAME_OVERHEAD 4 /* sync, type, len, crc */
+
+typedef enum {
+  CTRL_FRAME_STATUS = 0x01,
+  CTRL_FRAME_BATTERY = 0x02,
+  CTRL_FRAME_TEMPS = 0x03,
+} ctrl_frame_type_t;
+
+typedef struct {
+  uint32_t bytes;      /* received */
+  uint32_t frames;     /* decoded and published */
+  uint32_t crc_errors; /* frame candidates with a bad CRC */
+  uint32_t skipped;    /* bytes dropped while resynchronising */
+  uint32_t unknown;    /* valid frames of an unknown type or too short */
+  uint32_t overruns;   /* bytes lost on a full ring */
+  uint32_t load_ppm;   /* decoder CPU time per wall time, millionths, as last
+                          measured by the platform (0: not yet) */
+} ctrl_stats_t;
+
+/* Reset the ring and start the platform receiver; false when no controller
+ * link is configured, in which case nothing will be published. Topics with
+ * their bit (1 << telemetry_topic_t) set in `skip` are decoded but not
+ * published. */
+bool ctrl_init(uint32_t skip);
+
+/* Producer side: contiguous free space at the write position. Receive up
+ * to `*len` bytes there, then commit what was written. */
+uint8_t *ctrl_rx_reserve(uint32_t *len);
+void ctrl_rx_commit(uint32_t len);
+
+/* Copying variant for byte-wise sources; the bytes that do not fit are
+ * counted as overruns. Returns the number of bytes stored. */
+uint32_t ctrl_rx_write(const uint8_t *data, uint32_t len);
+
+/* Consumer side, one task: decode every complete frame, time stamped
+ * `now_ms` (lv_tick_get() time base) */
+void ctrl_decode(uint32_t now_ms);
+
+void ctrl_get_stats(ctrl_stats_t *out);
+
+/* Platform side: ctrl_decode() took `busy_us` of the last `window_us` */
+void ctrl_report_load(uint32_t busy_us, uint32_t window_us);
+
+/* Implemented per platform (main/ctrl_uart_esp.c,
+ * simulator/src/hal/ctrl_uart_host.c); true when a receiver was started */
+bool ctrl_platform_init(void);
+
+#endif /*CTRL_UART_H*/
@@ -5,9 +5,37 @@
 
 #include "dashboard.h"
 #include "../img/icons.h"
+#include "alert.h"
+#include "alert_view.h"
+#include "app_config.h"
+#include "asset_pack.h"
+#include "blink.h"
+#include "bms_can.h"
+#include "consumption.h"
+#include "ctrl_uart.h"
+#include "font_pack.h"
+#include "glyph_cache.h"
+#include "histogram.h"
+#include "history_store.h"
+#include "input.h"
+#include "journal.h"
+#include "page_manager.h"
+#include "pages.h"
+#include "peak.h"
+#include "range.h"
+#include "replay.h"
+#include "resample.h"
+#include "ridelog.h"
+#include "ride.h"
+#include "soc.h"
+#include "telemetry.h"
+#include "trip.h"
+#include "vclock.h"
+#include "wheel.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
 /* Declare custom font */
@@ -17,6 +45,17 @@ LV_FONT_DECLARE(lv_font_jetbrains_mono_26)
 LV_FONT_DECLARE(lv_font_jetbrains_mono_36)
 LV_FONT_DECLARE(lv_font_jetbrains_mono_extra_bold_42)
 
+/* Custom fonts wrapped by the glyph cache (compressed glyphs are decoded once) */
+static lv_font_t font_energy_30;
+static lv_font_t font_value_26;
+static lv_font_t font_clock_36;
+static lv_font_t font_speed_42;
+
+/* CJK glyphs streamed from the "fontpack" partition, used as fallback of the
+ * title font so Chinese strings render without a compiled-in CJK font */
+static font_pack_t cjk_pack;
+static lv_font_t font_title_14;
+
 /* Global screen size constants */
 const lv_coord_t SCREEN_W = 480;
 const lv_coord_t SCREEN_H = 272;
@@ -24,9 +63,36 @@ const lv_coord_t SCREEN_H = 272;
 static lv_obj_t *left_turn_icon;
 static lv_obj_t *right_turn_icon;
 static lv_obj_t *high_beam_icon;
+static bool indicator_left;
+static bool indicator_right;
+static bool indicator_high_beam;
+/* Set once the handlebar switches report; stops the demo sources */
+static bool input_seen;
+/* Motor controller link / BMS bus / wheel sensor configured; their
+ * readings replace the demo ones */
+static bool ctrl_link;
+static bool bms_link;
+static bool wheel_link;
+/* A ride log is replayed instead of any live or demo source */
+static bool replay_link;
+/* Display refresh period multiplier */
+static uint32_t frame_decimation = 1;
 static lv_obj_t *time_label;
 static lv_obj_t *date_label;
 
+/* Latest values, shared with the other pages */
+static dash_values_t dash_values;
+
+/* Power extremes over sliding windows, fed every power sample */
+static peak_window_t power_peak_short;
+static peak_window_t power_peak_long;
+static peak_window_t regen_peak_long;
+
+/* Speed and power as of each frame's render time, for the needle and the
+ * energy bar */
+static resample_t speed_resample;
+static resample_t power_resample;
+
 /* Theme state */
 static bool dashboard_night_mode;
 static lv_color_t theme_bg;
@@ -45,6 +111,7 @@ static lv_obj_t *sep_line_right;
 static lv_obj_t *sep_line_top;
 static lv_obj_t *zero_line;
 static lv_obj_t *meter_center_circle;
+static lv_obj_t *gauge_bg_img; /* optional, provided by skin packs */
 
 /* Left panel labels */
 static lv_obj_t *left_odo_title;
@@ -85,7 +152,7 @@ static int current_gear = 1;
 static lv_style_t meter_blue_style;
 static lv_style_t meter_red_style;
 
-/* Parking mode: show "P" instead of speed for first 5 seconds */
+/* Parking mode: show "P" instead of speed while parked (ride.c) */
 static bool parking_mode = true;
 
 /* Energy bar (bottom center) */
@@ -94,11 +161,54 @@ static lv_obj_t *energy_bar_label;
 static int32_t energy_power_w;
 static lv_obj_t *energy_bar_left;
 static lv_obj_t *energy_bar_right;
+#if CONFIG_DASH_REGEN_INDICATOR
+static lv_obj_t *energy_bar_recovered; /* strip under the regen side */
+#define RECOVERED_FULL_X10 250 /* recovered share filling the regen side */
+#define RECOVERED_STRIP_H 4
+#endif
 static const int32_t ENERGY_MIN_W = -2000;
 static const int32_t ENERGY_MAX_W = 6000;
 static const int32_t ENERGY_BAR_W = 200;
 static const int32_t ENERGY_BAR_H = 50;
 
+/* Route the custom fonts through the glyph decode cache and size the LVGL
+ * image cache for the compressed icons */
+static void dashboard_init_assets(void) {
+  glyph_cache_wrap_font(&font_energy_30, &lv_font_pf_din_mono_30);
+  glyph_cache_wrap_font(&font_value_26, &lv_font_jetbrains_mono_26);
+  glyph_cache_wrap_font(&font_clock_36, &lv_font_jetbrains_mono_36);
+  glyph_cache_wrap_font(&font_speed_42, &lv_font_jetbrains_mono_extra_bold_42);
+
+  font_title_14 = lv_font_montserrat_14;
+  if (font_pack_open(&cjk_pack, "fontpack")) {
+    font_title_14.fallback = font_pack_font(&cjk_pack);
+  }
+
+  /* Optional skin stored in flash; the compiled-in skin otherwise */
+  asset_pack_activate("skin");
+
+  lv_image_cache_resize(CONFIG_DASH_IMAGE_CACHE_SIZE, false);
+}
+
+/* Font of a text role: the active skin pack's font if it has one, else the
+ * compiled-in font */
+const lv_font_t *dashboard_font(asset_font_id_t role) {
+  static const lv_font_t *const builtin[ASSET_FONT_COUNT] = {
+      [ASSET_FONT_TITLE] = &font_title_14,
+      [ASSET_FONT_VALUE] = &font_value_26,
+      [ASSET_FONT_CLOCK] = &font_clock_36,
+      [ASSET_FONT_SPEED] = &font_speed_42,
+      [ASSET_FONT_ENERGY] = &font_energy_30,
+  };
+  const lv_font_t *font = asset_pack_font(role);
+  if (font) {
+    /* Glyphs missing from the skin come from the built-in font */
+    asset_pack_set_font_fallback(role, builtin[role]);
+    return font;
+  }
+  return builtin[role];
+}
+
 /* Set theme color variables based on night mode */
 static void dashboard_init_theme_colors(void) {
   if (dashboard_night_mode) {
@@ -120,14 +230,69 @@ static void dashboard_init_theme_colors(void) {
   theme_text_alert = lv_palette_main(LV_PALETTE_RED);
   theme_energy_regen = lv_color_hex(0x67C23A);
   theme_energy_consume = lv_color_hex(0xF56C6C);
+
+  /* A skin pack may override the palette */
+  const asset_palette_t *pal = asset_pack_palette(
+      dashboard_night_mode ? ASSET_PALETTE_NIGHT : ASSET_PALETTE_DAY);
+  if (pal) {
+    theme_bg = lv_color_hex(pal->bg);
+    theme_text_main = lv_color_hex(pal->text_main);
+    theme_text_dim = lv_color_hex(pal->text_dim);
+    theme_line = lv_color_hex(pal->line);
+    theme_border = lv_color_hex(pal->border);
+    theme_text_alert = lv_color_hex(pal->text_alert);
+    theme_needle = lv_color_hex(pal->needle);
+    theme_energy_regen = lv_color_hex(pal->energy_regen);
+    theme_energy_consume = lv_color_hex(pal->energy_consume);
+  }
+}
+
+/* Apply skin fonts and images to all UI elements */
+static void dashboard_apply_skin(void) {
+  lv_obj_t *titles[] = {left_odo_title,       left_trip_title,
+                        left_ride_time_title, left_max_speed_title,
+                        left_used_title,      right_batt_cap_title,
+                        right_range_title,    right_maxp_title,
+                        right_hist_avg_title, right_trip_avg_title};
+  lv_obj_t *values[] = {left_odo_value,       left_trip_value,
+                        left_ride_time_value, left_max_speed_value,
+                        left_used_value,      right_batt_cap_value,
+                        right_range_value,    right_maxp_value,
+                        right_hist_avg_value, right_trip_avg_value};
+
+  for (size_t i = 0; i < sizeof(titles) / sizeof(titles[0]); i++) {
+    lv_obj_set_style_text_font(titles[i], dashboard_font(ASSET_FONT_TITLE), 0);
+    lv_obj_set_style_text_font(values[i], dashboard_font(ASSET_FONT_VALUE), 0);
+  }
+  lv_obj_set_style_text_font(time_label, dashboard_font(ASSET_FONT_CLOCK), 0);
+  lv_obj_set_style_text_font(meter_center_label,
+                             dashboard_font(ASSET_FONT_SPEED), 0);
+  lv_obj_set_style_text_font(energy_bar_label,
+                             dashboard_font(ASSET_FONT_ENERGY), 0);
+
+  const lv_image_dsc_t *img = asset_pack_image(ASSET_IMAGE_LEFT_TURN);
+  lv_img_set_src(left_turn_icon, img ? img : &left_turn);
+  img = asset_pack_image(ASSET_IMAGE_RIGHT_TURN);
+  lv_img_set_src(right_turn_icon, img ? img : &right_turn);
+  img = asset_pack_image(ASSET_IMAGE_HIGH_BEAM);
+  lv_img_set_src(high_beam_icon, img ? img : &high_beam);
+
+  img = asset_pack_image(ASSET_IMAGE_GAUGE_BG);
+  if (img) {
+    lv_img_set_src(gauge_bg_img, img);
+    lv_obj_clear_flag(gauge_bg_img, LV_OBJ_FLAG_HIDDEN);
+  } else {
+    lv_obj_add_flag(gauge_bg_img, LV_OBJ_FLAG_HIDDEN);
+  }
 }
 
 /* Apply theme colors to all UI elements */
 static void dashboard_apply_theme(void) {
   dashboard_init_theme_colors();
 
-  /* Screen background */
+  /* Screen background, and text colour inherited by the other pages */
   lv_obj_set_style_bg_color(scr_root, theme_bg, 0);
+  lv_obj_set_style_text_color(scr_root, theme_text_main, 0);
 
   /* Separator lines */
   lv_obj_set_style_bg_color(sep_line_left, theme_line, 0);
@@ -166,6 +331,10 @@ static void dashboard_apply_theme(void) {
   lv_obj_set_style_border_color(energy_bar_cont, theme_border, 0);
   lv_obj_set_style_text_color(energy_bar_label, theme_text_main, 0);
   lv_obj_set_style_bg_color(zero_line, theme_line, 0);
+#if CONFIG_DASH_REGEN_INDICATOR
+  lv_obj_set_style_bg_color(energy_bar_recovered,
+                            lv_color_lighten(theme_energy_regen, LV_OPA_50), 0);
+#endif
 
   /* Meter */
   lv_obj_set_style_bg_color(meter_center_circle, theme_bg, 0);
@@ -191,15 +360,36 @@ void dashboard_set_night_mode(bool enable) {
   dashboard_apply_theme();
 }
 
-static void time_timer_cb(lv_timer_t *t) {
-  time_t now = time(NULL);
+bool dashboard_get_night_mode(void) { return dashboard_night_mode; }
+
+const dash_values_t *dashboard_values(void) { return &dash_values; }
+
+/* Switch to the skin pack `name` (NULL: compiled-in skin). On failure the
+ * current skin is kept. */
+bool dashboard_set_skin(const char *name) {
+  if (!asset_pack_activate(name))
+    return false;
+  if (scr_root) {
+    dashboard_apply_skin();
+    dashboard_apply_theme();
+    page_manager_invalidate(); /* other pages pick up the new fonts */
+  }
+  return true;
+}
+
+/* Clock colon blinks with the shared phase; the date only changes daily */
+static void clock_blink_cb(bool on, void *user_data) {
+  LV_UNUSED(user_data);
+  if (!page_manager_is_visible(PAGE_HOME))
+    return;
+
+  time_t now = vclock_time();
   struct tm *tm_now = localtime(&now);
   char buf[32];
-  static bool toggle = false;
+  static int shown_mday = -1;
   static const char *weekdays[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-  toggle = !toggle;
   if (tm_now) {
-    if (toggle) {
+    if (on) {
       snprintf(buf, sizeof(buf), "%02d:%02d", tm_now->tm_hour, tm_now->tm_min);
     } else {
       snprintf(buf, sizeof(buf), "%02d %02d", tm_now->tm_hour, tm_now->tm_min);
@@ -207,20 +397,56 @@ static void time_timer_cb(lv_timer_t *t) {
     lv_label_set_text(time_label, buf);
 
     /* Update date label: MM/DD + weekday */
-    snprintf(buf, sizeof(buf), "%02d/%02d\n%s", tm_now->tm_mon + 1, tm_now->tm_mday, weekdays[tm_now->tm_wday]);
-    lv_label_set_text(date_label, buf);
+    if (tm_now->tm_mday != shown_mday) {
+      shown_mday = tm_now->tm_mday;
+      snprintf(buf, sizeof(buf), "%02d/%02d\n%s", tm_now->tm_mon + 1, tm_now->tm_mday, weekdays[tm_now->tm_wday]);
+      lv_label_set_text(date_label, buf);
+    }
   }
 }
 
+/* Show or hide an indicator icon; no invalidation if nothing changes */
+static void icon_show(lv_obj_t *icon, bool show, bool *shown) {
+  if (show == *shown)
+    return;
+  *shown = show;
+  lv_obj_set_style_img_opa(icon, show ? LV_OPA_COVER : LV_OPA_TRANSP, 0);
+}
+
+/* Turn signals blink with the shared phase, high beam is steady */
+static void icons_blink_cb(bool on, void *user_data) {
+  static bool left_shown = true;
+  static bool right_shown = true;
+  static bool high_beam_shown = true;
+  LV_UNUSED(user_data);
+
+  if (!page_manager_is_visible(PAGE_HOME))
+    return;
+  icon_show(left_turn_icon, indicator_left && on, &left_shown);
+  icon_show(right_turn_icon, indicator_right && on, &right_shown);
+  icon_show(high_beam_icon, indicator_high_beam, &high_beam_shown);
+}
+
+/* Indicator states; turn signals are drawn blinking. Changes show in the
+ * next frame: a turn signal being switched on restarts the blink phase so
+ * it starts lit. */
+void dashboard_set_indicators(bool left, bool right, bool high_beam) {
+  bool turn_on = (left && !indicator_left) || (right && !indicator_right);
+
+  indicator_left = left;
+  indicator_right = right;
+  indicator_high_beam = high_beam;
+  if (turn_on)
+    blink_restart();
+  icons_blink_cb(blink_phase(), NULL);
+}
+
 /* Update energy bar label (power in w). The displayed text is NOT clamped; only
  * the fill size is constrained to the bar range. */
-void dashboard_set_power(int w) {
+static void energy_bar_refresh(void) {
   if (!energy_bar_cont)
     return;
 
-  /* Keep raw value for label/display */
-  energy_power_w = w;
-
   /* Format and show the raw value (can be outside min/max).
      Use explicit sign and absolute parts so values between -1000 and 0 show
      "-0.xxx" correctly. */
@@ -261,6 +487,41 @@ void dashboard_set_power(int w) {
   lv_obj_set_size(energy_bar_left, left_value, ENERGY_BAR_H - 8);
   lv_obj_align(energy_bar_left, LV_ALIGN_LEFT_MID, left_size - left_value, 0);
   lv_obj_set_size(energy_bar_right, right_value, ENERGY_BAR_H - 8);
+
+#if CONFIG_DASH_REGEN_INDICATOR
+  /* Recovered share of this trip's drive energy, growing from the zero line */
+  int32_t recovered = dash_values.recovered_x10;
+  if (recovered > RECOVERED_FULL_X10)
+    recovered = RECOVERED_FULL_X10;
+  lv_coord_t recovered_w =
+      (lv_coord_t)(recovered * left_size / RECOVERED_FULL_X10);
+  lv_obj_set_size(energy_bar_recovered, recovered_w, RECOVERED_STRIP_H);
+  lv_obj_align(energy_bar_recovered, LV_ALIGN_BOTTOM_LEFT,
+               left_size - recovered_w, 0);
+#endif
+}
+
+/* Set the current power (w); the bar is redrawn while the home page is
+ * visible */
+void dashboard_set_power(int w) {
+  /* Keep raw value for label/display */
+  energy_power_w = w;
+  dash_values.power_w = w;
+
+  if (page_manager_is_visible(PAGE_HOME))
+    energy_bar_refresh();
+}
+
+/* Peaks are taken from the samples, not from the resampled values shown,
+ * so a short spike between two frames still counts */
+static void power_peaks_add(uint32_t t_ms, int32_t w) {
+  peak_window_push(&power_peak_short, t_ms, w);
+  peak_window_push(&power_peak_long, t_ms, w);
+  peak_window_push(&regen_peak_long, t_ms, w);
+  if (w > dash_values.peak_w)
+    dash_values.peak_w = w;
+  if (w < dash_values.regen_peak_w)
+    dash_values.regen_peak_w = w;
 }
 
 /* Draw top-left and top-right icons */
@@ -362,6 +623,18 @@ static void draw_energy_bar(lv_obj_t *scr) {
   lv_obj_set_style_bg_opa(energy_bar_right, LV_OPA_COVER, 0);
   lv_obj_clear_flag(energy_bar_right, LV_OBJ_FLAG_SCROLLABLE);
 
+#if CONFIG_DASH_REGEN_INDICATOR
+  energy_bar_recovered = lv_obj_create(energy_bar_cont);
+  lv_obj_set_size(energy_bar_recovered, 0, RECOVERED_STRIP_H);
+  lv_obj_align(energy_bar_recovered, LV_ALIGN_BOTTOM_LEFT, left_size, 0);
+  lv_obj_set_style_bg_color(energy_bar_recovered,
+                            lv_color_lighten(theme_energy_regen, LV_OPA_50), 0);
+  lv_obj_set_style_radius(energy_bar_recovered, 0, 0);
+  lv_obj_set_style_border_width(energy_bar_recovered, 0, 0);
+  lv_obj_set_style_bg_opa(energy_bar_recovered, LV_OPA_COVER, 0);
+  lv_obj_clear_flag(energy_bar_recovered, LV_OBJ_FLAG_SCROLLABLE);
+#endif
+
   /* Zero mark line */
   zero_line = lv_obj_create(energy_bar_cont);
   lv_obj_set_size(zero_line, 5, ENERGY_BAR_H);
@@ -373,7 +646,7 @@ static void draw_energy_bar(lv_obj_t *scr) {
   lv_obj_align(energy_bar_label, LV_ALIGN_CENTER, 0, 0);
   lv_obj_set_style_text_color(energy_bar_label, theme_text_main, 0);
   /* Make the label larger and keep it above the fill rectangles */
-  lv_obj_set_style_text_font(energy_bar_label, &lv_font_pf_din_mono_30, 0);
+  lv_obj_set_style_text_font(energy_bar_label, &font_energy_30, 0);
   lv_obj_clear_flag(energy_bar_label, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_move_foreground(energy_bar_label);
 
@@ -389,7 +662,7 @@ static void draw_current_time(lv_obj_t *scr) {
   lv_obj_set_style_text_color(time_label, theme_text_main, 0);
   /* larger clock font */
   // lv_obj_set_style_text_font(time_label, &lv_font_montserrat_36, 0);
-  lv_obj_set_style_text_font(time_label, &lv_font_jetbrains_mono_36, 0);
+  lv_obj_set_style_text_font(time_label, &font_clock_36, 0);
   // lv_obj_set_scrollbar_mode(time_label, LV_SCROLLBAR_MODE_OFF);
 
   /* Date label (right of time, smaller font) */
@@ -401,7 +674,7 @@ static void draw_current_time(lv_obj_t *scr) {
   lv_obj_set_style_text_font(date_label, &lv_font_montserrat_12, 0);
   lv_obj_set_style_text_line_space(date_label, -2, 0);
 
-  lv_timer_create(time_timer_cb, 500, NULL);
+  blink_subscribe(clock_blink_cb, NULL);
 }
 
 /* Small helper to create a title/value pair at (x,y) */
@@ -414,14 +687,14 @@ static void create_kv_pair(lv_obj_t *parent, lv_obj_t **title_out,
   lv_label_set_text(*title_out, title);
   lv_obj_set_style_text_color(*title_out, theme_text_dim, 0);
   /* slightly smaller title font */
-  lv_obj_set_style_text_font(*title_out, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(*title_out, &font_title_14, 0);
   lv_obj_set_pos(*title_out, x, y);
 
   *value_out = lv_label_create(parent);
   lv_label_set_text(*value_out, value);
   lv_obj_set_style_text_color(*value_out, theme_text_main, 0);
   /* larger value font */
-  lv_obj_set_style_text_font(*value_out, &lv_font_jetbrains_mono_26, 0);
+  lv_obj_set_style_text_font(*value_out, &font_value_26, 0);
   /* smaller gap between title and value */
   lv_obj_set_pos(*value_out, x, y + title_value_spacing);
 }
@@ -463,6 +736,11 @@ static void draw_side_panels(lv_obj_t *scr) {
 }
 
 void draw_meter(lv_obj_t *scr) {
+  /* Pre-rendered gauge background from the skin pack, behind the scale */
+  gauge_bg_img = lv_img_create(scr);
+  lv_obj_center(gauge_bg_img);
+  lv_obj_add_flag(gauge_bg_img, LV_OBJ_FLAG_HIDDEN);
+
   /* Create a scale widget (replaces the old meter widget) */
   lv_obj_t *meter = lv_scale_create(scr);
   lv_obj_center(meter);
@@ -471,7 +749,12 @@ void draw_meter(lv_obj_t *scr) {
   /* Set to round inner mode for circular gauge */
   lv_scale_set_mode(meter, LV_SCALE_MODE_ROUND_INNER);
 
-  lv_scale_set_range(meter, 0, 80);
+  /* Range in 0.1 km/h so the needle moves smoothly between whole km/h;
+   * the labels stay in km/h */
+  static const char *meter_labels[] = {"0",  "10", "20", "30", "40",
+                                       "50", "60", "70", "80", NULL};
+  lv_scale_set_range(meter, 0, 800);
+  lv_scale_set_text_src(meter, meter_labels);
 
   /* Set angle range (270 degrees) and rotation (135 degrees = bottom center) */
   lv_scale_set_angle_range(meter, 270);
@@ -495,7 +778,7 @@ void draw_meter(lv_obj_t *scr) {
 
   /* Add a blue section for 0-20 */
   lv_scale_section_t *blue_section = lv_scale_add_section(meter);
-  lv_scale_set_section_range(meter, blue_section, 0, 20);
+  lv_scale_set_section_range(meter, blue_section, 0, 200);
 
   /* Setup style for blue section */
   lv_style_init(&meter_blue_style);
@@ -506,7 +789,7 @@ void draw_meter(lv_obj_t *scr) {
 
   /* Add a red section for 60-80 */
   lv_scale_section_t *red_section = lv_scale_add_section(meter);
-  lv_scale_set_section_range(meter, red_section, 60, 80);
+  lv_scale_set_section_range(meter, red_section, 600, 800);
 
   /* Setup style for red section */
   lv_style_init(&meter_red_style);
@@ -556,7 +839,7 @@ void draw_meter(lv_obj_t *scr) {
   /* Initially show "P" for parking mode */
   lv_label_set_text(meter_center_label, "P");
   lv_obj_set_style_text_font(meter_center_label,
-                             &lv_font_jetbrains_mono_extra_bold_42, 0);
+                             &font_speed_42, 0);
   lv_obj_set_style_text_color(meter_center_label, theme_text_main, 0);
   lv_obj_set_style_text_align(meter_center_label, LV_TEXT_ALIGN_CENTER, 0);
 
@@ -593,8 +876,9 @@ void dashboard_set_gear(int gear) {
   if (gear < 1) gear = 1;
   if (gear > 3) gear = 3;
   current_gear = gear;
+  range_set_gear(gear);
 
-  if (gear_label) {
+  if (gear_label && page_manager_is_visible(PAGE_HOME)) {
     char buf[4];
     snprintf(buf, sizeof(buf), "%d", gear);
     lv_label_set_text(gear_label, buf);
@@ -606,181 +890,637 @@ void change_theme_timer_cb(lv_timer_t *t) {
   dashboard_set_night_mode(!dashboard_night_mode);
 }
 
-/* Timer callback to exit parking mode after 5 seconds */
-static void exit_parking_mode_cb(lv_timer_t *t) {
-  parking_mode = false;
+void dashboard_set_frame_decimation(uint32_t n) {
+  frame_decimation = n > 0 ? n : 1;
+}
 
-  /* Update center label to show "0" with normal color */
-  if (meter_center_label) {
-    lv_label_set_text(meter_center_label, "0");
-    lv_obj_set_style_text_color(meter_center_label, theme_text_main, 0);
+/* Show "P" or the live speed, and redraw at a low rate while parked */
+static void dashboard_set_parked(bool parked) {
+  lv_display_t *disp = lv_display_get_default();
+  lv_timer_t *refr = disp ? lv_display_get_refr_timer(disp) : NULL;
+
+  parking_mode = parked;
+  if (refr)
+    lv_timer_set_period(refr, (parked ? CONFIG_DASH_PARKED_REFR_MS
+                                      : LV_DEF_REFR_PERIOD) *
+                                  frame_decimation);
+  if (parked && meter_center_label) {
+    lv_label_set_text(meter_center_label, "P");
+    lv_scale_set_line_needle_value(meter_widget, meter_needle_line, -10, 0);
   }
-
-  /* Delete this one-shot timer */
-  lv_timer_del(t);
 }
 
-/* Animation timer: sweep meter needle from 0 to 80 and back */
-static void meter_anim_timer_cb(lv_timer_t *t) {
+/* Demo controller: stands in for the motor controller and BMS when no
+ * controller link is configured (ctrl_init()). The rider sets off after 5
+ * seconds, then the speed sweeps from 0 to 80 km/h and back. */
+static void demo_speed_timer_cb(lv_timer_t *t) {
+  static int wait = 5000 / 50;
   static int v = 0;
   static int dir = 1; /* 1: up, -1: down */
   const int min_v = 0;
   const int max_v = 80;
   const int step = 1; /* change per tick */
 
-  if (!meter_widget || !meter_needle_line) {
-    return;
-  }
-
-  /* In parking mode, keep showing "P" and needle at 0 */
-  if (parking_mode) {
-    lv_scale_set_line_needle_value(meter_widget, meter_needle_line, -10, 0);
-    return;
-  }
-
-  v += dir * step;
-  if (v >= max_v) {
-    v = max_v;
-    dir = -1;
-  } else if (v <= min_v) {
-    v = min_v;
-    dir = 1;
-  }
-
-  /* Update the needle value */
-  lv_scale_set_line_needle_value(meter_widget, meter_needle_line, -10, v);
-
-  /* Update center label with current value */
-  if (meter_center_label) {
-    char buf[16];
-    snprintf(buf, sizeof(buf), "%d", v);
-    lv_label_set_text(meter_center_label, buf);
-
-    /* Change color to red if speed exceeds 60 */
-    if (v > 60) {
-      lv_obj_set_style_text_color(meter_center_label, theme_text_alert, 0);
-    } else {
-      lv_obj_set_style_text_color(meter_center_label, theme_text_main, 0);
+  if (wait > 0) {
+    wait--;
+  } else {
+    v += dir * step;
+    if (v >= max_v) {
+      v = max_v;
+      dir = -1;
+    } else if (v <= min_v) {
+      v = min_v;
+      dir = 1;
     }
   }
+  telemetry_publish(TELEMETRY_SPEED, v * 100, lv_tick_get());
 }
 
+/* Demo indicator source: left turn, right turn, high beam pattern */
 static void update_icons_timer_cb(lv_timer_t *t) {
-  static bool toggle = false;
   static uint32_t state = 0;
-  toggle = !toggle;
   state++;
 
   if (state > 20) {
     state = 0;
   }
 
-  lv_obj_set_style_img_opa(left_turn_icon, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_img_opa(right_turn_icon, LV_OPA_TRANSP, 0);
-
-  if (state < 10) {
-    if (toggle) {
-      lv_obj_set_style_img_opa(left_turn_icon, LV_OPA_TRANSP, 0);
-    } else {
-      lv_obj_set_style_img_opa(left_turn_icon, LV_OPA_COVER, 0);
-    }
-  } else if (state < 20) {
-    if (toggle) {
-      lv_obj_set_style_img_opa(right_turn_icon, LV_OPA_TRANSP, 0);
-    } else {
-      lv_obj_set_style_img_opa(right_turn_icon, LV_OPA_COVER, 0);
-    }
-  }
-
-  if (state % 12 > 6) {
-    lv_obj_set_style_img_opa(high_beam_icon, LV_OPA_TRANSP, 0);
-  } else {
-    lv_obj_set_style_img_opa(high_beam_icon, LV_OPA_COVER, 0);
-  }
+  if (input_seen)
+    return;
+  dashboard_set_indicators(state < 10, state >= 10 && state < 20,
+                           state % 12 <= 6);
 }
 
-/* Animation timer: sweep power from -3000..9000 */
-static void energy_anim_timer_cb(lv_timer_t *t) {
-  static int32_t v = -3000;
+/* Demo controller: sweep power from -3000..9000 */
+static int32_t demo_power_w = -3000;
+
+static void demo_power_timer_cb(lv_timer_t *t) {
   static int dir = 1; /* 1: up, -1: down */
   const int32_t min_v = -3000;
   const int32_t max_v = 9000;
   const int32_t step = 100; /* change per tick (w) */
 
-  v += dir * step;
-  if (v >= max_v) {
-    v = max_v;
+  demo_power_w += dir * step;
+  if (demo_power_w >= max_v) {
+    demo_power_w = max_v;
     dir = -1;
-  } else if (v <= min_v) {
-    v = min_v;
+  } else if (demo_power_w <= min_v) {
+    demo_power_w = min_v;
     dir = 1;
   }
+  telemetry_publish(TELEMETRY_POWER, demo_power_w, lv_tick_get());
+}
 
-  /* Update the display with the swept value */
-  dashboard_set_power(v);
+/* Demo battery pack: faded to 90% of the rated capacity (so the SOC
+ * estimator has something to learn) with 60 mOhm internal resistance,
+ * discharged by the power sweep and fast-charged at 2C when nearly empty */
+#define DEMO_PACK_MAH (CONFIG_DASH_BATT_CAPACITY_MAH * 9 / 10)
+#define DEMO_PACK_MOHM 60
+
+static int32_t demo_pack_mas = DEMO_PACK_MAH * 3600; /* charge, mA x s */
+static bool demo_pack_charging;
+
+static void demo_battery_step(uint32_t dt_ms) {
+  int32_t soc_x10 =
+      (int32_t)((int64_t)demo_pack_mas * 1000 / (DEMO_PACK_MAH * 3600));
+  int32_t ocv_mv = soc_cell_ocv(soc_x10) * CONFIG_DASH_BATT_CELLS_S;
+  int32_t ma;
+  uint32_t now = lv_tick_get();
+
+  if (soc_x10 < 100)
+    demo_pack_charging = true;
+  else if (soc_x10 >= 1000)
+    demo_pack_charging = false;
+
+  if (demo_pack_charging)
+    ma = -2 * DEMO_PACK_MAH;
+  else
+    ma = (int32_t)((int64_t)demo_power_w * 1000000 / ocv_mv);
+
+  demo_pack_mas -= (int32_t)((int64_t)ma * (int32_t)dt_ms / 1000);
+  telemetry_publish(TELEMETRY_PACK_CURRENT, ma, now);
+  telemetry_publish(TELEMETRY_PACK_VOLTAGE, ocv_mv - ma * DEMO_PACK_MOHM / 1000,
+                    now);
 }
 
+/* Demo controller: battery readings and temperature. The pack readings
+ * come from the BMS or the controller when connected, the temperature
+ * from the BMS. */
 void test_value_timer_cb(lv_timer_t *t) {
   static uint32_t tick = 0;
   tick++;
+
+  if (bms_link || replay_link)
+    return;
+  if (!ctrl_link)
+    demo_battery_step(100);
+  telemetry_publish(TELEMETRY_BATT_TEMP, 25 + (int32_t)(tick / 100 % 10),
+                    lv_tick_get());
+}
+
+/* Speed and power are queued for the UI: every sample goes into the
+ * resamplers, the peaks see every power sample */
+static void ui_drain_resampled(void) {
+  telemetry_sample_t s;
+
+  while (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_SPEED, &s))
+    resample_push(&speed_resample, s.t_ms, s.value);
+  while (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_POWER, &s)) {
+    resample_push(&power_resample, s.t_ms, s.value);
+    power_peaks_add(s.t_ms, s.value);
+  }
+}
+
+/* Display refresh start: speed and power as of this frame's render time
+ * into the meter and the energy bar, so they move evenly whatever the
+ * timing of the samples */
+static void frame_start_cb(lv_event_t *e) {
+  static int shown_kmh = -1;
+  static int32_t shown_needle = -1;
+  uint32_t now = lv_tick_get();
+  int32_t v;
+  LV_UNUSED(e);
+
+  /* Unchanged values are not set again, which would redraw them */
+  ui_drain_resampled();
+  if (resample_get(&power_resample, now, &v) && v != energy_power_w)
+    dashboard_set_power(v);
+  if (!resample_get(&speed_resample, now, &v))
+    return;
+
+  int kmh = v / 100;
+  dash_values.speed_kmh = kmh;
+
+  /* In parking mode, keep showing "P" and needle at 0 */
+  if (parking_mode) {
+    shown_kmh = -1;
+    shown_needle = -1;
+    return;
+  }
+  if (!page_manager_is_visible(PAGE_HOME) || !meter_widget ||
+      !meter_needle_line)
+    return;
+
+  /* Needle in 0.1 km/h */
+  if (v / 10 != shown_needle) {
+    shown_needle = v / 10;
+    lv_scale_set_line_needle_value(meter_widget, meter_needle_line, -10,
+                                   shown_needle);
+  }
+
+  /* Center label in whole km/h, only redrawn when it changes */
+  if (meter_center_label && kmh != shown_kmh) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d", kmh);
+    lv_label_set_text(meter_center_label, buf);
+    shown_kmh = kmh;
+  }
+}
+
+/* UI subscriber: newest readings into the shown values. Speed and power
+ * are drained here as well, so a slow parked refresh does not overflow
+ * their queues. */
+static void ui_telemetry_timer_cb(lv_timer_t *t) {
+  telemetry_sample_t s;
+  LV_UNUSED(t);
+
+  ui_drain_resampled();
+  if (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_PACK_VOLTAGE, &s))
+    dash_values.batt_mv = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_PACK_CURRENT, &s))
+    dash_values.batt_ma = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_BATT_TEMP, &s))
+    dash_values.batt_temp_c = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_ASSIST, &s))
+    dashboard_set_gear(s.value);
+  if (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_CELL_MIN, &s))
+    dash_values.cell_min_mv = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_UI, TELEMETRY_CELL_MAX, &s))
+    dash_values.cell_max_mv = s.value;
+}
+
+/* Alert subscriber: every queued sample is evaluated, so a short excursion
+ * is not missed between UI frames */
+static void alert_telemetry_timer_cb(lv_timer_t *t) {
+  telemetry_sample_t s;
+  LV_UNUSED(t);
+
+  while (telemetry_poll(TELEMETRY_SUB_ALERT, TELEMETRY_SPEED, &s))
+    alert_eval(ALERT_OVERSPEED, s.value / 100, s.t_ms);
+  while (telemetry_poll(TELEMETRY_SUB_ALERT, TELEMETRY_BATT_TEMP, &s))
+    alert_eval(ALERT_OVER_TEMP, s.value, s.t_ms);
+  while (telemetry_poll(TELEMETRY_SUB_ALERT, TELEMETRY_BMS_FAULTS, &s))
+    alert_eval(ALERT_BMS_FAULT, s.value, s.t_ms);
+}
+
+/* Subscriptions of the consumers in this file; the logger subscribes on
+ * its own */
+static void dashboard_subscribe(void) {
+  static const telemetry_topic_t ui_topics[] = {
+      TELEMETRY_PACK_VOLTAGE, TELEMETRY_PACK_CURRENT, TELEMETRY_BATT_TEMP,
+      TELEMETRY_ASSIST,       TELEMETRY_CELL_MIN,     TELEMETRY_CELL_MAX,
+  };
+  static const telemetry_topic_t trip_topics[] = {
+      TELEMETRY_PACK_VOLTAGE, TELEMETRY_PACK_CURRENT,
+      TELEMETRY_BMS_SOC,      TELEMETRY_BMS_CAPACITY,
+  };
+
+  for (size_t i = 0; i < sizeof(ui_topics) / sizeof(ui_topics[0]); i++)
+    telemetry_subscribe(TELEMETRY_SUB_UI, ui_topics[i], TELEMETRY_LATEST);
+  telemetry_subscribe(TELEMETRY_SUB_UI, TELEMETRY_SPEED, TELEMETRY_QUEUE);
+  telemetry_subscribe(TELEMETRY_SUB_UI, TELEMETRY_POWER, TELEMETRY_QUEUE);
+  for (size_t i = 0; i < sizeof(trip_topics) / sizeof(trip_topics[0]); i++)
+    telemetry_subscribe(TELEMETRY_SUB_TRIP, trip_topics[i], TELEMETRY_LATEST);
+  telemetry_subscribe(TELEMETRY_SUB_TRIP, TELEMETRY_SPEED, TELEMETRY_QUEUE);
+  telemetry_subscribe(TELEMETRY_SUB_TRIP, TELEMETRY_POWER, TELEMETRY_QUEUE);
+  telemetry_subscribe(TELEMETRY_SUB_ALERT, TELEMETRY_SPEED, TELEMETRY_QUEUE);
+  telemetry_subscribe(TELEMETRY_SUB_ALERT, TELEMETRY_BATT_TEMP,
+                      TELEMETRY_QUEUE);
+  telemetry_subscribe(TELEMETRY_SUB_ALERT, TELEMETRY_BMS_FAULTS,
+                      TELEMETRY_QUEUE);
+}
+
+/* Integrate speed and power into the trip computer and the range model
+ * (trip_poll()), pack current into the SOC; the values shown are taken
+ * from them at page update rate */
+static uint32_t trip_last_sample;
+static int32_t hist_restored_mwhkm; /* from the journal, until 100 km data */
+
+/* Time spent in speed and power bands while riding, in USAGE_UNIT_MS: the
+ * speed bins are the 10 km/h meter ticks (blue section 0-20, red 60-80),
+ * the power bins split the energy bar range into 500 W steps. Lifetime
+ * totals are the journal's plus every closed trip. */
+#define USAGE_UNIT_MS 100
+#define USAGE_POWER_STEP_W 500
+
+static histogram_t usage_speed_trip, usage_speed_life;
+static histogram_t usage_power_trip, usage_power_life;
+static uint32_t usage_rem_ms;
+
+static void usage_init(void) {
+  uint8_t power_bins = (uint8_t)((ENERGY_MAX_W - ENERGY_MIN_W) /
+                                 USAGE_POWER_STEP_W);
+  histogram_init(&usage_speed_trip, 0, 10, 8);
+  histogram_init(&usage_speed_life, 0, 10, 8);
+  histogram_init(&usage_power_trip, ENERGY_MIN_W, USAGE_POWER_STEP_W,
+                 power_bins);
+  histogram_init(&usage_power_life, ENERGY_MIN_W, USAGE_POWER_STEP_W,
+                 power_bins);
+}
+
+static void usage_sample(int32_t speed_kmh, int32_t power_w, uint32_t dt_ms) {
+  usage_rem_ms += dt_ms;
+  uint32_t w = usage_rem_ms / USAGE_UNIT_MS;
+  usage_rem_ms %= USAGE_UNIT_MS;
+  if (w == 0)
+    return;
+  histogram_add(&usage_speed_trip, speed_kmh, w);
+  histogram_add(&usage_power_trip, power_w, w);
+}
+
+/* Lifetime counts of `life` plus the open trip, into `out`; returns the
+ * number of slots written */
+static uint8_t usage_pack(uint32_t *out, const histogram_t *life,
+                          const histogram_t *trip) {
+  histogram_t h = *life;
+  histogram_merge(&h, trip);
+  uint8_t n = HISTOGRAM_SLOTS(h.layout.bins);
+  memcpy(out, h.count, n * sizeof(uint32_t));
+  return n;
+}
+
+/* Values kept across power cycles */
+static void journal_collect(journal_data_t *d) {
+  trip_get_odometer(&d->odo_m, &d->drive_uj, &d->regen_uj);
+  if (!consumption_mwhkm(CONSUMPTION_100KM, &d->hist_mwhkm))
+    d->hist_mwhkm = hist_restored_mwhkm;
+
+  memset(d->hist, 0, sizeof(d->hist));
+  uint8_t n = usage_pack(d->hist, &usage_speed_life, &usage_speed_trip);
+  usage_pack(d->hist + n, &usage_power_life, &usage_power_trip);
+}
+
+static void journal_restore(void) {
+  journal_data_t d;
+  if (!journal_init(&d))
+    return;
+  trip_set_odometer(d.odo_m, d.drive_uj, d.regen_uj);
+  range_set_default(d.hist_mwhkm);
+  hist_restored_mwhkm = d.hist_mwhkm;
+
+  uint8_t n = HISTOGRAM_SLOTS(usage_speed_life.layout.bins);
+  memcpy(usage_speed_life.count, d.hist, n * sizeof(uint32_t));
+  memcpy(usage_power_life.count, d.hist + n,
+         HISTOGRAM_SLOTS(usage_power_life.layout.bins) * sizeof(uint32_t));
+}
+
+/* Ride segmentation (ride.c): a trip and its ride log open with every ride
+ * started from parked, the first one after power-up included, so energy
+ * drawn while parked stays out of the trip; the journal is flushed and the
+ * log closed when a ride ends */
+static void ride_state_cb(ride_state_t from, ride_state_t to) {
+  if (ride_parked() != parking_mode)
+    dashboard_set_parked(ride_parked());
+
+  if (ride_opens_trip(from, to)) {
+    trip_reset();
+    ridelog_start(lv_tick_get(), (uint32_t)vclock_time());
+    histogram_merge(&usage_speed_life, &usage_speed_trip);
+    histogram_merge(&usage_power_life, &usage_power_trip);
+    histogram_clear(&usage_speed_trip);
+    histogram_clear(&usage_power_trip);
+    dash_values.peak_w = 0;
+    dash_values.regen_peak_w = 0;
+  }
+  if (ride_closes_trip(from, to)) {
+    /* Stops are covered by journal_update()'s coalescing: flushing at each
+     * traffic light would cost a record per stop */
+    journal_data_t d;
+    journal_collect(&d);
+    journal_flush(&d);
+    ridelog_stop();
+  }
+}
+
+/* Logger: one snapshot of the topics per period while a trip is open */
+static void ridelog_timer_cb(lv_timer_t *t) {
+  LV_UNUSED(t);
+  ridelog_update(lv_tick_get());
+}
+
+/* Replay: the records due, published with their recorded timestamps, so
+ * the period only sets how late a sample may be picked up */
+#define REPLAY_PERIOD_MS 10
+
+static void replay_timer_cb(lv_timer_t *t) {
+  LV_UNUSED(t);
+  replay_update(lv_tick_get());
+}
+
+/* Trip subscriber: each reading holds until a newer one is published.
+ * Speed and power are queued and integrated between the producers'
+ * timestamps, up to the newest sample, so the trip does not depend on when
+ * this timer runs and a sample is not lost because another one followed it
+ * within the same period. Samples are taken in timestamp order across the
+ * two queues; one older than what is already integrated (a producer on
+ * another task running late) only replaces the held value. */
+static uint16_t trip_speed_x100;
+static int32_t trip_power_w;
+static uint32_t trip_integrated_ms; /* speed and power integrated up to */
+static bool trip_started;
+static int32_t trip_pack_mv;
+static int32_t trip_pack_ma;
+static int32_t trip_bms_capacity_mah; /* 0 until the BMS reports it */
+
+/* Integrate the held speed and power up to `t_ms` */
+static void trip_integrate(uint32_t t_ms) {
+  int32_t dt_ms = (int32_t)(t_ms - trip_integrated_ms);
+
+  if (!trip_started) {
+    trip_started = true;
+    trip_integrated_ms = t_ms;
+    return;
+  }
+  if (dt_ms <= 0)
+    return;
+  uint32_t dt_us = (uint32_t)dt_ms * 1000u;
+  trip_sample(trip_speed_x100, trip_power_w, dt_us);
+  consumption_sample(trip_speed_x100, trip_power_w, dt_us);
+  range_sample(trip_speed_x100, trip_power_w, dt_us);
+  trip_integrated_ms = t_ms;
+}
+
+static void trip_poll(void) {
+  telemetry_sample_t s, sp, pw;
+  bool has_sp = telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_SPEED, &sp);
+  bool has_pw = telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_POWER, &pw);
+
+  while (has_sp || has_pw) {
+    if (has_sp && (!has_pw || (int32_t)(sp.t_ms - pw.t_ms) <= 0)) {
+      trip_integrate(sp.t_ms);
+      trip_speed_x100 = (uint16_t)(sp.value < 0         ? 0
+                                   : sp.value > UINT16_MAX ? UINT16_MAX
+                                                           : sp.value);
+      has_sp = telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_SPEED, &sp);
+    } else {
+      trip_integrate(pw.t_ms);
+      trip_power_w = pw.value;
+      has_pw = telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_POWER, &pw);
+    }
+  }
+  if (telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_PACK_VOLTAGE, &s))
+    trip_pack_mv = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_PACK_CURRENT, &s))
+    trip_pack_ma = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_BMS_CAPACITY, &s))
+    trip_bms_capacity_mah = s.value;
+  if (telemetry_poll(TELEMETRY_SUB_TRIP, TELEMETRY_BMS_SOC, &s))
+    soc_report(s.value, trip_bms_capacity_mah);
+}
+
+static void trip_timer_cb(lv_timer_t *t) {
+  static uint32_t last_snapshot;
+  uint32_t now = lv_tick_get();
+  uint32_t dt_ms = now - trip_last_sample;
+  uint32_t dt_us = dt_ms * 1000u;
+  LV_UNUSED(t);
+
+  trip_last_sample = now;
+  trip_poll();
+  if (trip_pack_mv > 0)
+    soc_sample(trip_pack_ma, trip_pack_mv, dt_us);
+  ride_update(trip_speed_x100, trip_power_w, now);
+  if (!ride_parked())
+    usage_sample(trip_speed_x100 / 100, trip_power_w, dt_ms);
+
+  if (now - last_snapshot < CONFIG_DASH_PAGE_UPDATE_MS)
+    return;
+  last_snapshot = now;
+
+  trip_snapshot_t s;
+  trip_get_snapshot(&s);
+  dash_values.odo_x10 = s.odo_x10;
+  dash_values.trip_x10 = s.trip_x10;
+  dash_values.ride_time_s = s.ride_time_s;
+  dash_values.max_speed_kmh = s.max_speed_kmh;
+  dash_values.avg_speed_x10 = s.avg_speed_x10;
+  dash_values.used_x10 = s.used_x10;
+  dash_values.regen_wh = s.regen_wh;
+  dash_values.recovered_x10 = s.recovered_x10;
+  dash_values.life_recovered_x10 = s.life_recovered_x10;
+  dash_values.ride_avg_x10 = s.trip_avg_x10;
+  journal_data_t j;
+  journal_collect(&j);
+  journal_update(&j);
+
+  /* Side panel: recent riding, net regen clamped for display */
+  dash_values.trip_avg_x10 = consumption_whkm_x10(CONSUMPTION_10KM);
+  dash_values.hist_avg_x10 = j.hist_mwhkm / 100;
+  if (dash_values.trip_avg_x10 < 0)
+    dash_values.trip_avg_x10 = 0;
+  if (dash_values.hist_avg_x10 < 0)
+    dash_values.hist_avg_x10 = 0;
+
+  int32_t peak;
+  dash_values.peak_short_w =
+      peak_window_get(&power_peak_short, now, &peak) ? peak : 0;
+  dash_values.peak_long_w =
+      peak_window_get(&power_peak_long, now, &peak) ? peak : 0;
+  dash_values.regen_long_w =
+      peak_window_get(&regen_peak_long, now, &peak) ? peak : 0;
+
+  soc_state_t b;
+  soc_get(&b);
+  dash_values.soc_pct = b.soc_x10 / 10;
+  dash_values.batt_cap_x10 = b.capacity_wh / 100;
+  dash_values.range_km = range_km(b.remaining_wh);
+  alert_eval(ALERT_LOW_BATTERY, dash_values.soc_pct, now);
+}
+
+/* Feed the history charts, whichever page is shown */
+static void history_sample_timer_cb(lv_timer_t *t) {
+  LV_UNUSED(t);
+  int32_t power = dash_values.power_w;
+  if (power > INT16_MAX)
+    power = INT16_MAX;
+  if (power < INT16_MIN)
+    power = INT16_MIN;
+
+  int16_t sample[HISTORY_CH_COUNT] = {
+      [HISTORY_SPEED] = (int16_t)(dash_values.speed_kmh * 10),
+      [HISTORY_POWER] = (int16_t)power,
+  };
+  history_store_push(sample);
+}
+
+/* Home page data binding, called by the page manager while visible */
+static void home_update(void) {
+  const dash_values_t *v = &dash_values;
   char buf[32];
 
-  /* ODO: 总里程 0-99999.9 km */
-  int odo = (tick * 7 + 12345) % 100000;
-  snprintf(buf, sizeof(buf), "%05d.%d", odo / 10, odo % 10);
+  snprintf(buf, sizeof(buf), "%05d.%d", (int)(v->odo_x10 / 10),
+           (int)(v->odo_x10 % 10));
   lv_label_set_text(left_odo_value, buf);
 
-  /* TRIP: 单次行程 0-999.9 km */
-  int trip = (tick * 3 + 567) % 10000;
-  snprintf(buf, sizeof(buf), "%03d.%d", trip / 10, trip % 10);
+  snprintf(buf, sizeof(buf), "%03d.%d", (int)(v->trip_x10 / 10),
+           (int)(v->trip_x10 % 10));
   lv_label_set_text(left_trip_value, buf);
 
-  /* RIDE TIME: 骑行时间 HH:MM:SS */
-  int total_sec = (tick * 13 + 3661) % 86400;
+  int total_sec = v->ride_time_s;
   int h = total_sec / 3600;
   int m = (total_sec % 3600) / 60;
   int s = total_sec % 60;
   snprintf(buf, sizeof(buf), "%02d:%02d:%02d", h, m, s);
   lv_label_set_text(left_ride_time_value, buf);
 
-  /* MAX SPD: 最高速度 0-80 km/h */
-  int max_spd = (tick * 11 + 42) % 81;
-  snprintf(buf, sizeof(buf), "%d", max_spd);
+  snprintf(buf, sizeof(buf), "%d", (int)v->max_speed_kmh);
   lv_label_set_text(left_max_speed_value, buf);
 
-  /* USED: 已用电量 0-99.9 kWh */
-  int used = (tick * 5 + 123) % 1000;
-  snprintf(buf, sizeof(buf), "%d.%d", used / 10, used % 10);
+  snprintf(buf, sizeof(buf), "%d.%d", (int)(v->used_x10 / 10),
+           (int)(v->used_x10 % 10));
   lv_label_set_text(left_used_value, buf);
 
-  /* RANGE: 预估续航 0-200 km */
-  int range = (tick * 17 + 100) % 201;
-  snprintf(buf, sizeof(buf), "%d", range);
+  snprintf(buf, sizeof(buf), "%d", (int)v->range_km);
   lv_label_set_text(right_range_value, buf);
 
-  /* HIST AVG: 历史平均能耗 5.0-30.0 Wh/km */
-  int hist_avg = (tick * 7 + 120) % 251 + 50;
-  snprintf(buf, sizeof(buf), "%d.%d", hist_avg / 10, hist_avg % 10);
+  snprintf(buf, sizeof(buf), "%d.%d", (int)(v->hist_avg_x10 / 10),
+           (int)(v->hist_avg_x10 % 10));
   lv_label_set_text(right_hist_avg_value, buf);
 
-  /* TRIP AVG: 单次平均能耗 5.0-50.0 Wh/km */
-  int trip_avg = (tick * 9 + 200) % 451 + 50;
-  snprintf(buf, sizeof(buf), "%d.%d", trip_avg / 10, trip_avg % 10);
+  snprintf(buf, sizeof(buf), "%d.%d", (int)(v->trip_avg_x10 / 10),
+           (int)(v->trip_avg_x10 % 10));
   lv_label_set_text(right_trip_avg_value, buf);
 
-  /* PEAK: 峰值功率 0.000-9.999 kW */
-  int maxp = (tick * 23 + 4321) % 10000;
-  snprintf(buf, sizeof(buf), "%d.%03d", maxp / 1000, maxp % 1000);
+  snprintf(buf, sizeof(buf), "%d.%03d", (int)(v->peak_w / 1000),
+           (int)(v->peak_w % 1000));
   lv_label_set_text(right_maxp_value, buf);
 
-  /* BATT CAP: 电池容量 (固定值，但可以模拟变化) 10.0-100.0 kWh */
-  int batt_cap = (tick * 2 + 420) % 901 + 100;
-  snprintf(buf, sizeof(buf), "%d.%d", batt_cap / 10, batt_cap % 10);
+  snprintf(buf, sizeof(buf), "%d.%d", (int)(v->batt_cap_x10 / 10),
+           (int)(v->batt_cap_x10 % 10));
   lv_label_set_text(right_batt_cap_value, buf);
+
+  /* Values that changed while another page was shown */
+  energy_bar_refresh();
+  snprintf(buf, sizeof(buf), "%d", current_gear);
+  lv_label_set_text(gear_label, buf);
+}
+
+static void home_build(lv_obj_t *root) {
+  draw_separators(root);
+  draw_current_time(root);
+  draw_icons(root);
+  draw_side_panels(root);
+  draw_energy_bar(root);
+  draw_meter(root);
+}
+
+static const page_def_t page_home = {
+    .name = "home",
+    .pinned = true,
+    .build = home_build,
+    .update = home_update,
+};
+
+static const page_def_t *const dashboard_pages[PAGE_COUNT] = {
+    [PAGE_HOME] = &page_home,
+    [PAGE_TRIP] = &page_trip,
+    [PAGE_BATTERY] = &page_battery,
+    [PAGE_POWER] = &page_power,
+    [PAGE_HISTORY] = &page_history,
+    [PAGE_SETTINGS] = &page_settings,
+};
+
+/* Tap anywhere to go to the next page */
+static void screen_clicked_cb(lv_event_t *e) {
+  LV_UNUSED(e);
+  page_manager_next();
+}
+
+/* Handlebar switch events (input.c) */
+static void input_event_cb(input_id_t id, bool active) {
+  static uint32_t switches;
+
+  input_seen = true;
+  if (active)
+    switches |= 1u << id;
+  else
+    switches &= ~(1u << id);
+  telemetry_publish(TELEMETRY_SWITCHES, (int32_t)switches, lv_tick_get());
+  ride_activity(lv_tick_get());
+  /* Parked, the display refreshes slowly: show the change right away */
+  if (parking_mode) {
+    lv_display_t *disp = lv_display_get_default();
+    lv_timer_t *refr = disp ? lv_display_get_refr_timer(disp) : NULL;
+    if (refr)
+      lv_timer_ready(refr);
+  }
+  switch (id) {
+  case INPUT_LEFT_TURN:
+    dashboard_set_indicators(active, indicator_right, indicator_high_beam);
+    break;
+  case INPUT_RIGHT_TURN:
+    dashboard_set_indicators(indicator_left, active, indicator_high_beam);
+    break;
+  case INPUT_HIGH_BEAM:
+    dashboard_set_indicators(indicator_left, indicator_right, active);
+    break;
+  case INPUT_GEAR_UP:
+    if (active)
+      dashboard_set_gear(current_gear + 1);
+    break;
+  case INPUT_GEAR_DOWN:
+    if (active)
+      dashboard_set_gear(current_gear - 1);
+    break;
+  default:
+    break;
+  }
 }
 
 void test_gear_timer_cb(lv_timer_t *t) {
   static int gear = 1;
+  if (input_seen || ctrl_link || replay_link)
+    return;
   gear++;
   if (gear > 3) gear = 1;
   dashboard_set_gear(gear);
@@ -794,26 +1534,69 @@ void dashboard_create(lv_obj_t *scr) {
   /* Initialize theme colors first (needed by draw functions) */
   dashboard_night_mode = true;
   dashboard_init_theme_colors();
+  dashboard_init_assets();
+
+  peak_window_init(&power_peak_short, CONFIG_DASH_PEAK_SHORT_S * 1000, false);
+  peak_window_init(&power_peak_long, CONFIG_DASH_PEAK_LONG_S * 1000, false);
+  peak_window_init(&regen_peak_long, CONFIG_DASH_PEAK_LONG_S * 1000, true);
+  resample_init(&speed_resample, CONFIG_DASH_RESAMPLE_DELAY_MS, false);
+  resample_init(&power_resample, CONFIG_DASH_RESAMPLE_DELAY_MS, false);
+
+  /* Build the home page; the other pages are built on first navigation */
+  page_manager_init(scr_root, dashboard_pages, PAGE_COUNT);
+  lv_obj_add_event_cb(scr_root, screen_clicked_cb, LV_EVENT_CLICKED, NULL);
 
-  /* Draw all UI components */
-  draw_separators(scr_root);
-  draw_current_time(scr_root);
-  draw_icons(scr_root);
-  draw_side_panels(scr_root);
-  draw_energy_bar(scr_root);
-  draw_meter(scr_root);
+  /* Alerts are drawn on the top layer, independent of the pages */
+  alert_view_create(dashboard_font(ASSET_FONT_TITLE));
 
-  /* Apply theme to all created components */
+  /* Apply skin assets and theme to all created components */
+  dashboard_apply_skin();
   dashboard_apply_theme();
 
-  /* Start in parking mode, exit after 5 seconds */
-  parking_mode = true;
-  lv_timer_create(exit_parking_mode_cb, 5000, NULL);
+  /* Parked until the ride state machine sees the bike moving */
+  dashboard_set_parked(true);
+  ride_set_handler(ride_state_cb);
+
+  /* Consumers subscribe before any producer runs. With a controller link,
+   * a BMS bus or a wheel sensor those are the only producers of their
+   * topics, so the demo sources for them are not started. Where two could
+   * report the same reading the BMS has the pack and the wheel sensor the
+   * speed. A replayed ride log replaces all of them. */
+  dashboard_subscribe();
+  bool logging = ridelog_init();
+  lv_timer_create(ui_telemetry_timer_cb, 50, NULL);
+  if (lv_display_get_default())
+    lv_display_add_event_cb(lv_display_get_default(), frame_start_cb,
+                            LV_EVENT_REFR_START, NULL);
+  lv_timer_create(alert_telemetry_timer_cb, 100, NULL);
+  replay_link = replay_active();
+  if (replay_link) {
+    lv_timer_create(replay_timer_cb, REPLAY_PERIOD_MS, NULL);
+  } else {
+    bms_link = bms_can_init();
+    wheel_link = wheel_init();
+    ctrl_link = ctrl_init(
+        (bms_link ? 1u << TELEMETRY_PACK_VOLTAGE | 1u << TELEMETRY_PACK_CURRENT
+                  : 0) |
+        (wheel_link ? 1u << TELEMETRY_SPEED : 0));
+  }
 
   lv_timer_create(change_theme_timer_cb, 10000, NULL);
-  lv_timer_create(meter_anim_timer_cb, 50, NULL);
+  if (!ctrl_link && !wheel_link && !replay_link)
+    lv_timer_create(demo_speed_timer_cb, 50, NULL);
   lv_timer_create(update_icons_timer_cb, 500, NULL);
-  lv_timer_create(energy_anim_timer_cb, 100, NULL);
+  blink_subscribe(icons_blink_cb, NULL);
+  input_init();
+  input_set_handler(input_event_cb);
+  if (!ctrl_link && !replay_link)
+    lv_timer_create(demo_power_timer_cb, 100, NULL);
   lv_timer_create(test_value_timer_cb, 100, NULL);
   lv_timer_create(test_gear_timer_cb, 1000, NULL);
+  lv_timer_create(history_sample_timer_cb, CONFIG_DASH_HISTORY_PERIOD_MS, NULL);
+  usage_init();
+  journal_restore();
+  trip_last_sample = lv_tick_get();
+  lv_timer_create(trip_timer_cb, CONFIG_DASH_TRIP_SAMPLE_MS, NULL);
+  if (logging)
+    lv_timer_create(ridelog_timer_cb, CONFIG_DASH_RIDELOG_PERIOD_MS, NULL);
 }
@@ -5,10 +5,51 @@
 #ifndef DASHBOARD_H
 #define DASHBOARD_H
 
+#include "asset_pack.h"
 #include "lvgl.h"
 #include <stdbool.h>
 #include <stdint.h>
 
+typedef enum {
+  PAGE_HOME,
+  PAGE_TRIP,
+  PAGE_BATTERY,
+  PAGE_POWER,
+  PAGE_HISTORY,
+  PAGE_SETTINGS,
+  PAGE_COUNT,
+} page_id_t;
+
+/* Latest values shown on the pages */
+typedef struct {
+  int32_t speed_kmh;
+  int32_t power_w;
+  int32_t odo_x10;       /* 0.1 km */
+  int32_t trip_x10;      /* 0.1 km */
+  int32_t ride_time_s;
+  int32_t max_speed_kmh;
+  int32_t avg_speed_x10; /* 0.1 km/h */
+  int32_t used_x10;      /* 0.1 kWh, net of regeneration */
+  int32_t regen_wh;      /* recovered this trip */
+  int32_t recovered_x10; /* 0.1 % of drive energy, this trip */
+  int32_t life_recovered_x10; /* 0.1 % of drive energy, odometer lifetime */
+  int32_t range_km;
+  int32_t hist_avg_x10;  /* 0.1 Wh/km, last 100 km */
+  int32_t trip_avg_x10;  /* 0.1 Wh/km, last 10 km */
+  int32_t ride_avg_x10;  /* 0.1 Wh/km, whole trip */
+  int32_t peak_w;        /* this trip */
+  int32_t peak_short_w;  /* last CONFIG_DASH_PEAK_SHORT_S */
+  int32_t peak_long_w;   /* last CONFIG_DASH_PEAK_LONG_S */
+  int32_t regen_long_w;  /* most negative, last CONFIG_DASH_PEAK_LONG_S */
+  int32_t regen_peak_w;  /* most negative, this trip */
+  int32_t batt_cap_x10;  /* 0.1 kWh */
+  int32_t batt_mv;
+  int32_t batt_ma;       /* > 0: discharging */
+  int32_t batt_temp_c;
+  int32_t cell_min_mv;   /* 0: not reported by the BMS */
+  int32_t cell_max_mv;
+  int32_t soc_pct;
+} dash_values_t;
 
 extern const lv_coord_t SCREEN_W;
 extern const lv_coord_t SCREEN_H;
@@ -17,5 +58,16 @@ void dashboard_create(lv_obj_t *scr);
 void dashboard_set_power(int kw);
 void dashboard_set_night_mode(bool enable);
 void dashboard_set_gear(int gear);
+void dashboard_set_indicators(bool left, bool right, bool high_beam);
+bool dashboard_set_skin(const char *name);
+bool dashboard_get_night_mode(void);
+
+/* Draw only every n-th display frame (the simulator at a time factor or
+ * stepped); before dashboard_create() */
+void dashboard_set_frame_decimation(uint32_t n);
+
+/* For the page builders (pages.c) */
+const dash_values_t *dashboard_values(void);
+const lv_font_t *dashboard_font(asset_font_id_t role);
 
 #endif /*DASHBOARD_H*/
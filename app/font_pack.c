@@ -0,0 +1,190 @@
+/**
+ * font_pack.c
+ * Streaming bitmap font loaded from a memory-mapped font pack
+ */
+
+#include "font_pack.h"
+#include "glyph_cache.h"
+#include <string.h>
+
+static bool pack_get_glyph_dsc(const lv_font_t *font,
+                               lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                               uint32_t letter_next);
+static const void *pack_get_glyph_bitmap(lv_font_glyph_dsc_t *g_dsc,
+                                         lv_draw_buf_t *draw_buf);
+
+/* `len` is 64-bit so a corrupt count times the entry size cannot wrap */
+static bool section_ok(size_t size, uint32_t offset, uint64_t len) {
+  return (offset & 3u) == 0 && offset <= size && len <= size - offset;
+}
+
+bool font_pack_open_mem(font_pack_t *pack, const void *data, size_t size) {
+  const uint8_t *base = (const uint8_t *)data;
+  const font_pack_header_t *h = (const font_pack_header_t *)data;
+
+  memset(pack, 0, sizeof(*pack));
+  if (data == NULL || size < sizeof(*h) || ((uintptr_t)data & 3u) != 0)
+    return false;
+  if (h->magic != FONT_PACK_MAGIC || h->version != FONT_PACK_VERSION ||
+      h->bpp != 4)
+    return false;
+  /* Header, section bounds and page table only: O(1) regardless of the
+   * glyph count */
+  if (!section_ok(size, h->pages_offset, 257 * sizeof(uint32_t)) ||
+      !section_ok(size, h->glyphs_offset,
+                  (uint64_t)h->glyph_count * sizeof(font_pack_glyph_t)) ||
+      !section_ok(size, h->bitmaps_offset, h->bitmaps_size))
+    return false;
+
+  /* font_pack_find() searches glyphs[pages[p], pages[p + 1]) without
+   * further checks, so the table must be ascending and within the glyphs */
+  const uint32_t *pages = (const uint32_t *)(base + h->pages_offset);
+  for (uint32_t p = 0; p < 257; p++) {
+    if (pages[p] > h->glyph_count || (p > 0 && pages[p] < pages[p - 1]))
+      return false;
+  }
+
+  pack->header = h;
+  pack->pages = pages;
+  pack->glyphs = (const font_pack_glyph_t *)(base + h->glyphs_offset);
+  pack->bitmaps = base + h->bitmaps_offset;
+
+  lv_font_t *f = &pack->font;
+  f->get_glyph_dsc = pack_get_glyph_dsc;
+  f->get_glyph_bitmap = pack_get_glyph_bitmap;
+  f->line_height = h->line_height;
+  f->base_line = h->base_line;
+  f->subpx = LV_FONT_SUBPX_NONE;
+  f->underline_position = (int8_t)(-h->base_line / 2);
+  f->underline_thickness = 1;
+  f->dsc = pack;
+  return true;
+}
+
+bool font_pack_open(font_pack_t *pack, const char *name) {
+  asset_map_t map;
+
+  if (!asset_map_open(name, &map)) {
+    memset(pack, 0, sizeof(*pack));
+    return false;
+  }
+  if (!font_pack_open_mem(pack, map.data, map.size)) {
+    asset_map_close(&map);
+    return false;
+  }
+  pack->map = map;
+  return true;
+}
+
+void font_pack_close(font_pack_t *pack) {
+  if (pack->header == NULL)
+    return;
+  glyph_cache_invalidate(pack);
+  if (pack->map.data)
+    asset_map_close(&pack->map);
+  memset(pack, 0, sizeof(*pack));
+}
+
+const lv_font_t *font_pack_font(const font_pack_t *pack) {
+  return pack->header ? &pack->font : NULL;
+}
+
+const font_pack_glyph_t *font_pack_find(const font_pack_t *pack,
+                                        uint32_t codepoint) {
+  uint32_t lo;
+  uint32_t hi;
+
+  if (pack->header == NULL)
+    return NULL;
+
+  /* The page table narrows BMP lookups to at most 256 glyphs, the binary
+   * search finishes in <= 8 probes */
+  if (codepoint <= 0xFFFF) {
+    lo = pack->pages[codepoint >> 8];
+    hi = pack->pages[(codepoint >> 8) + 1];
+  } else {
+    lo = pack->pages[256];
+    hi = pack->header->glyph_count;
+  }
+
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    uint32_t cp = pack->glyphs[mid].codepoint;
+    if (cp == codepoint)
+      return &pack->glyphs[mid];
+    if (cp < codepoint)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return NULL;
+}
+
+static bool pack_get_glyph_dsc(const lv_font_t *font,
+                               lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                               uint32_t letter_next) {
+  const font_pack_t *pack = (const font_pack_t *)font->dsc;
+  const font_pack_glyph_t *g = font_pack_find(pack, letter);
+  LV_UNUSED(letter_next);
+
+  if (g == NULL)
+    return false;
+
+  dsc_out->adv_w = (uint16_t)((g->adv_w + 8) >> 4);
+  dsc_out->box_w = g->box_w;
+  dsc_out->box_h = g->box_h;
+  dsc_out->ofs_x = g->ofs_x;
+  dsc_out->ofs_y = g->ofs_y;
+  dsc_out->format = LV_FONT_GLYPH_FORMAT_A4;
+  dsc_out->is_placeholder = false;
+  dsc_out->gid.index = (uint32_t)(g - pack->glyphs);
+  return true;
+}
+
+/* Expand a 4 bpp glyph into the A8 layout of the draw buffer */
+static void unpack_a4(const uint8_t *src, uint8_t *dst, uint32_t w, uint32_t h,
+                      uint32_t dst_stride) {
+  uint32_t src_stride = (w + 1) / 2;
+  for (uint32_t y = 0; y < h; y++) {
+    const uint8_t *s = src + y * src_stride;
+    uint8_t *d = dst + y * dst_stride;
+    for (uint32_t x = 0; x < w; x++) {
+      uint8_t v = (x & 1) ? (s[x >> 1] & 0x0F) : (s[x >> 1] >> 4);
+      d[x] = (uint8_t)(v * 17);
+    }
+  }
+}
+
+static const void *pack_get_glyph_bitmap(lv_font_glyph_dsc_t *g_dsc,
+                                         lv_draw_buf_t *draw_buf) {
+  const font_pack_t *pack = (const font_pack_t *)g_dsc->resolved_font->dsc;
+  uint32_t glyph_id = g_dsc->gid.index;
+  uint32_t size = 0;
+
+  if (draw_buf == NULL || glyph_id >= pack->header->glyph_count)
+    return NULL;
+
+  uint32_t stride = draw_buf->header.stride;
+  uint32_t need = stride * (uint32_t)g_dsc->box_h;
+  if (need > draw_buf->data_size)
+    return NULL;
+
+  const uint8_t *cached = glyph_cache_find(pack, glyph_id, &size);
+  if (cached && size == need) {
+    memcpy(draw_buf->data, cached, size);
+    return draw_buf;
+  }
+
+  const font_pack_glyph_t *g = &pack->glyphs[glyph_id];
+  uint32_t src_len = (uint32_t)((g->box_w + 1) / 2) * g->box_h;
+  if (g->bitmap_offset > pack->header->bitmaps_size ||
+      src_len > pack->header->bitmaps_size - g->bitmap_offset)
+    return NULL;
+
+  unpack_a4(pack->bitmaps + g->bitmap_offset, draw_buf->data, g->box_w,
+            g->box_h, stride);
+  uint8_t *slot = glyph_cache_insert(pack, glyph_id, need);
+  if (slot)
+    memcpy(slot, draw_buf->data, need);
+  return draw_buf;
+}
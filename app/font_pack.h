@@ -0,0 +1,79 @@
+/**
+ * font_pack.h
+ * Streaming bitmap font loaded from a memory-mapped font pack
+ *
+ * A font pack holds a large glyph set (e.g. CJK) outside the firmware image.
+ * Opening a pack only validates its header and page table, so boot time does
+ * not depend on the font size. Glyphs are looked up on demand and only the
+ * decoded bitmaps of glyphs being drawn are kept in RAM, in the shared glyph
+ * cache.
+ *
+ * Pack layout (little endian, all sections 4-byte aligned), produced by
+ * fonts/make-fontpack.py:
+ *
+ *   font_pack_header_t
+ *   uint32_t pages[257]             first glyph index of each BMP page
+ *                                   (codepoint >> 8); pages[256] is the
+ *                                   first glyph above U+FFFF
+ *   font_pack_glyph_t glyphs[n]     sorted by codepoint
+ *   uint8_t bitmaps[]               4 bpp, rows padded to whole bytes
+ */
+#ifndef FONT_PACK_H
+#define FONT_PACK_H
+
+#include "asset_map.h"
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FONT_PACK_MAGIC 0x50464245u /* "EBFP" */
+#define FONT_PACK_VERSION 1
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t bpp;
+  uint8_t reserved;
+  uint16_t line_height;
+  int16_t base_line;
+  uint32_t glyph_count;
+  uint32_t pages_offset;
+  uint32_t glyphs_offset;
+  uint32_t bitmaps_offset;
+  uint32_t bitmaps_size;
+} font_pack_header_t;
+
+typedef struct {
+  uint32_t codepoint;
+  uint32_t bitmap_offset; /* relative to the bitmap section */
+  uint16_t adv_w;         /* advance width in 1/16 px */
+  uint8_t box_w;
+  uint8_t box_h;
+  int8_t ofs_x;
+  int8_t ofs_y;
+  uint16_t reserved;
+} font_pack_glyph_t;
+
+typedef struct {
+  asset_map_t map;
+  const font_pack_header_t *header;
+  const uint32_t *pages;
+  const font_pack_glyph_t *glyphs;
+  const uint8_t *bitmaps;
+  lv_font_t font;
+} font_pack_t;
+
+/* Map the pack stored under `name` (partition or simulator file) */
+bool font_pack_open(font_pack_t *pack, const char *name);
+/* Use a pack that is already mapped, e.g. embedded in an asset pack */
+bool font_pack_open_mem(font_pack_t *pack, const void *data, size_t size);
+void font_pack_close(font_pack_t *pack);
+
+/* LVGL font backed by the pack; valid while the pack is open */
+const lv_font_t *font_pack_font(const font_pack_t *pack);
+
+/* Glyph record of `codepoint`, or NULL if the pack does not have it */
+const font_pack_glyph_t *font_pack_find(const font_pack_t *pack,
+                                        uint32_t codepoint);
+
+#endif /*FONT_PACK_H*/
@@ -0,0 +1,212 @@
+/**
+ * glyph_cache.c
+ * LRU cache of decoded glyph bitmaps
+ *
+ * Slots live in static arrays, so the pool is placed in internal RAM and
+ * never touches the LVGL heap. Lookup is a hash over (owner, glyph id) with
+ * chaining through slot indices; recency is a doubly linked list, also by
+ * index. Both are O(1).
+ */
+
+#include "glyph_cache.h"
+#include "app_config.h"
+#include <string.h>
+
+#define SLOT_COUNT CONFIG_DASH_GLYPH_CACHE_SLOTS
+#define SLOT_SIZE CONFIG_DASH_GLYPH_CACHE_SLOT_SIZE
+#define HASH_SIZE 128 /* power of two, >= SLOT_COUNT */
+#define NIL 0xFFFF
+
+typedef struct {
+  const void *owner;
+  uint32_t glyph_id;
+  uint32_t size;
+  uint16_t prev; /* towards most recently used */
+  uint16_t next; /* towards least recently used */
+  uint16_t hnext;
+} glyph_slot_t;
+
+static uint8_t slot_data[SLOT_COUNT][SLOT_SIZE];
+static glyph_slot_t slots[SLOT_COUNT];
+static uint16_t buckets[HASH_SIZE];
+static uint16_t lru_head = NIL; /* most recently used */
+static uint16_t lru_tail = NIL; /* least recently used */
+static uint16_t slots_used;
+static bool cache_ready;
+static glyph_cache_stats_t stats;
+
+static void cache_init(void) {
+  memset(buckets, 0xFF, sizeof(buckets));
+  lru_head = NIL;
+  lru_tail = NIL;
+  slots_used = 0;
+  cache_ready = true;
+}
+
+static uint32_t hash_key(const void *owner, uint32_t glyph_id) {
+  uint32_t h = (uint32_t)(uintptr_t)owner ^ (glyph_id * 2654435761u);
+  h ^= h >> 15;
+  return h & (HASH_SIZE - 1);
+}
+
+static void lru_unlink(uint16_t i) {
+  glyph_slot_t *s = &slots[i];
+  if (s->prev != NIL)
+    slots[s->prev].next = s->next;
+  else
+    lru_head = s->next;
+  if (s->next != NIL)
+    slots[s->next].prev = s->prev;
+  else
+    lru_tail = s->prev;
+}
+
+static void lru_push_front(uint16_t i) {
+  slots[i].prev = NIL;
+  slots[i].next = lru_head;
+  if (lru_head != NIL)
+    slots[lru_head].prev = i;
+  lru_head = i;
+  if (lru_tail == NIL)
+    lru_tail = i;
+}
+
+static void lru_push_back(uint16_t i) {
+  slots[i].next = NIL;
+  slots[i].prev = lru_tail;
+  if (lru_tail != NIL)
+    slots[lru_tail].next = i;
+  lru_tail = i;
+  if (lru_head == NIL)
+    lru_head = i;
+}
+
+static void hash_remove(uint16_t i) {
+  uint16_t *link = &buckets[hash_key(slots[i].owner, slots[i].glyph_id)];
+  while (*link != NIL) {
+    if (*link == i) {
+      *link = slots[i].hnext;
+      return;
+    }
+    link = &slots[*link].hnext;
+  }
+}
+
+const uint8_t *glyph_cache_find(const void *owner, uint32_t glyph_id,
+                                uint32_t *size_out) {
+  if (!cache_ready)
+    cache_init();
+
+  uint16_t i = buckets[hash_key(owner, glyph_id)];
+  while (i != NIL) {
+    if (slots[i].owner == owner && slots[i].glyph_id == glyph_id) {
+      if (i != lru_head) {
+        lru_unlink(i);
+        lru_push_front(i);
+      }
+      stats.hits++;
+      if (size_out)
+        *size_out = slots[i].size;
+      return slot_data[i];
+    }
+    i = slots[i].hnext;
+  }
+  stats.misses++;
+  return NULL;
+}
+
+uint8_t *glyph_cache_insert(const void *owner, uint32_t glyph_id,
+                            uint32_t size) {
+  if (!cache_ready)
+    cache_init();
+
+  if (size > SLOT_SIZE) {
+    stats.bypass++;
+    return NULL;
+  }
+
+  uint16_t i;
+  if (slots_used < SLOT_COUNT) {
+    i = slots_used++;
+  } else {
+    /* Recycle the least recently used slot */
+    i = lru_tail;
+    lru_unlink(i);
+    if (slots[i].owner) {
+      hash_remove(i);
+      stats.evictions++;
+    }
+  }
+
+  glyph_slot_t *s = &slots[i];
+  s->owner = owner;
+  s->glyph_id = glyph_id;
+  s->size = size;
+  uint32_t h = hash_key(owner, glyph_id);
+  s->hnext = buckets[h];
+  buckets[h] = i;
+  lru_push_front(i);
+  return slot_data[i];
+}
+
+void glyph_cache_invalidate(const void *owner) {
+  if (!cache_ready)
+    return;
+
+  /* Released slots move to the LRU end with no owner, so they are the first
+   * to be recycled. Rare operation (font unload), so O(n) is fine. */
+  for (uint16_t i = 0; i < slots_used; i++) {
+    if (slots[i].owner != owner)
+      continue;
+    hash_remove(i);
+    lru_unlink(i);
+    lru_push_back(i);
+    slots[i].owner = NULL;
+  }
+}
+
+void glyph_cache_get_stats(glyph_cache_stats_t *out) {
+  *out = stats;
+  out->used = slots_used;
+  out->capacity = SLOT_COUNT;
+}
+
+void glyph_cache_reset_stats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+/* get_glyph_bitmap of a wrapped font: serve the decoded bitmap from the
+ * cache, or let the original font decode it and remember the result. */
+static const void *cached_get_glyph_bitmap(lv_font_glyph_dsc_t *g_dsc,
+                                           lv_draw_buf_t *draw_buf) {
+  const lv_font_t *font = g_dsc->resolved_font;
+  const lv_font_t *src = (const lv_font_t *)font->user_data;
+  uint32_t glyph_id = g_dsc->gid.index;
+  uint32_t size = 0;
+
+  if (draw_buf == NULL)
+    return src->get_glyph_bitmap(g_dsc, draw_buf);
+
+  const uint8_t *cached = glyph_cache_find(font, glyph_id, &size);
+  if (cached && size <= draw_buf->data_size) {
+    memcpy(draw_buf->data, cached, size);
+    return draw_buf;
+  }
+
+  const void *res = src->get_glyph_bitmap(g_dsc, draw_buf);
+  /* Only bitmaps decoded into draw_buf are cached; static bitmaps are
+   * already returned straight from flash. */
+  if (res == draw_buf) {
+    size = draw_buf->header.stride * (uint32_t)g_dsc->box_h;
+    uint8_t *slot = glyph_cache_insert(font, glyph_id, size);
+    if (slot)
+      memcpy(slot, draw_buf->data, size);
+  }
+  return res;
+}
+
+void glyph_cache_wrap_font(lv_font_t *out, const lv_font_t *src) {
+  *out = *src;
+  out->get_glyph_bitmap = cached_get_glyph_bitmap;
+  out->user_data = (void *)src;
+}
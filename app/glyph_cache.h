@@ -0,0 +1,44 @@
+/**
+ * glyph_cache.h
+ * LRU cache of decoded glyph bitmaps
+ *
+ * Compressed fonts have to be decoded every time a glyph is drawn. The cache
+ * keeps the decoded A8 bitmaps of recently drawn glyphs in a fixed pool in
+ * internal RAM (CONFIG_DASH_GLYPH_CACHE_SLOTS x CONFIG_DASH_GLYPH_CACHE_SLOT_SIZE),
+ * so a cached glyph costs one memcpy, the same as an uncompressed font.
+ *
+ * The cache is used from the LVGL draw unit only and is not thread-safe.
+ */
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include "lvgl.h"
+#include <stdint.h>
+
+typedef struct {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  uint32_t bypass;   /* glyphs larger than a slot, never cached */
+  uint16_t used;     /* occupied slots */
+  uint16_t capacity; /* total slots */
+} glyph_cache_stats_t;
+
+/* Make `out` a copy of `src` whose glyph bitmaps go through the cache.
+ * `src` must stay valid as long as `out` is used. */
+void glyph_cache_wrap_font(lv_font_t *out, const lv_font_t *src);
+
+/* Low level access, for font back-ends that decode glyphs themselves.
+ * `owner` identifies the font, `glyph_id` the glyph within it. */
+const uint8_t *glyph_cache_find(const void *owner, uint32_t glyph_id,
+                                uint32_t *size_out);
+uint8_t *glyph_cache_insert(const void *owner, uint32_t glyph_id,
+                            uint32_t size);
+
+/* Drop every glyph of `owner` (e.g. when a font is unloaded) */
+void glyph_cache_invalidate(const void *owner);
+
+void glyph_cache_get_stats(glyph_cache_stats_t *out);
+void glyph_cache_reset_stats(void);
+
+#endif /*GLYPH_CACHE_H*/
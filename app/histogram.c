@@ -0,0 +1,59 @@
+/**
+ * histogram.c
+ * Online histogram of a sample stream over fixed linear bins
+ */
+
+#include "histogram.h"
+#include <string.h>
+
+void histogram_init(histogram_t *h, int32_t lo, int32_t width, uint8_t bins) {
+  if (width <= 0)
+    width = 1;
+  if (bins == 0)
+    bins = 1;
+  if (bins > HISTOGRAM_MAX_BINS)
+    bins = HISTOGRAM_MAX_BINS;
+  h->layout.lo = lo;
+  h->layout.width = width;
+  h->layout.bins = bins;
+  histogram_clear(h);
+}
+
+void histogram_clear(histogram_t *h) { memset(h->count, 0, sizeof(h->count)); }
+
+uint8_t histogram_slot(const histogram_t *h, int32_t value) {
+  const histogram_layout_t *l = &h->layout;
+  if (value < l->lo)
+    return 0;
+  int64_t bin = ((int64_t)value - l->lo) / l->width;
+  if (bin >= l->bins)
+    return (uint8_t)(l->bins + 1);
+  return (uint8_t)(bin + 1);
+}
+
+static uint32_t add_sat(uint32_t a, uint32_t b) {
+  return a > UINT32_MAX - b ? UINT32_MAX : a + b;
+}
+
+void histogram_add(histogram_t *h, int32_t value, uint32_t weight) {
+  uint8_t s = histogram_slot(h, value);
+  h->count[s] = add_sat(h->count[s], weight);
+}
+
+bool histogram_merge(histogram_t *dst, const histogram_t *src) {
+  if (dst->layout.lo != src->layout.lo ||
+      dst->layout.width != src->layout.width ||
+      dst->layout.bins != src->layout.bins)
+    return false;
+  for (uint8_t i = 0; i < HISTOGRAM_SLOTS(dst->layout.bins); i++)
+    dst->count[i] = add_sat(dst->count[i], src->count[i]);
+  return true;
+}
+
+uint64_t histogram_sum(const histogram_t *h, uint8_t first, uint8_t last) {
+  uint64_t sum = 0;
+  for (uint8_t i = first; i <= last && i < HISTOGRAM_SLOTS(h->layout.bins);
+       i++)
+    sum += h->count[i];
+  return sum;
+}
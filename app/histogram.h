@@ -0,0 +1,52 @@
+/**
+ * histogram.h
+ * Online histogram of a sample stream over fixed linear bins
+ *
+ * Bins are `width` wide from `lo`, plus one bin below and one above the
+ * range, so nothing is dropped. Finding the bin is a subtraction and a
+ * division: O(1) per sample whatever the bin count, and no samples are
+ * stored. Counts are weights supplied by the caller (typically time in a
+ * fixed unit), saturating at UINT32_MAX.
+ *
+ * Histograms with the same layout merge by adding counts, e.g. trips into a
+ * lifetime total. Plain C with no LVGL or platform dependency, so the same
+ * code builds into host tools.
+ */
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HISTOGRAM_MAX_BINS 16 /* in range, excluding under and over */
+
+typedef struct {
+  int32_t lo;    /* lower edge of the first in-range bin */
+  int32_t width; /* > 0 */
+  uint8_t bins;  /* in-range bins, 1..HISTOGRAM_MAX_BINS */
+} histogram_layout_t;
+
+typedef struct {
+  histogram_layout_t layout;
+  /* [0] below lo, [1..bins] in range, [bins + 1] at or above the top */
+  uint32_t count[HISTOGRAM_MAX_BINS + 2];
+} histogram_t;
+
+/* Entries of count[] in use with `bins` in-range bins */
+#define HISTOGRAM_SLOTS(bins) ((bins) + 2)
+
+void histogram_init(histogram_t *h, int32_t lo, int32_t width, uint8_t bins);
+void histogram_clear(histogram_t *h);
+
+/* Slot of count[] that `value` falls into */
+uint8_t histogram_slot(const histogram_t *h, int32_t value);
+
+void histogram_add(histogram_t *h, int32_t value, uint32_t weight);
+
+/* dst += src; false (dst unchanged) if the layouts differ */
+bool histogram_merge(histogram_t *dst, const histogram_t *src);
+
+/* Sum of count[first..last] */
+uint64_t histogram_sum(const histogram_t *h, uint8_t first, uint8_t last);
+
+#endif /*HISTOGRAM_H*/
@@ -0,0 +1,269 @@
+/**
+ * history_chart.c
+ * Chart of one history_store channel with incremental updates
+ */
+
+#include "history_chart.h"
+#include "app_config.h"
+#include <string.h>
+
+#define SWEEP_GAP 4 /* empty columns in front of the sweep position */
+
+typedef struct {
+  history_channel_t ch;
+  history_view_t view;
+  int32_t range_min;
+  int32_t range_max;
+  uint32_t k;        /* samples per column */
+  uint32_t next_col; /* first column not final yet */
+  uint32_t samples;  /* store count at the last refresh */
+  uint16_t width;
+  int16_t *col_min;  /* per x; col_min > col_max marks an empty column */
+  int16_t *col_max;
+  lv_area_t dirty;   /* invalidated part of the chart since the last refresh */
+  bool has_dirty;
+} chart_t;
+
+static uint32_t view_k(const chart_t *c, uint32_t samples) {
+  switch (c->view) {
+  case HISTORY_VIEW_10MIN:
+    return (10 * 60 * 1000 / CONFIG_DASH_HISTORY_PERIOD_MS + c->width - 1) /
+           c->width;
+  case HISTORY_VIEW_RIDE: {
+    /* Powers of two, so the scale changes (and the chart is rebuilt) only
+     * each time the ride doubles */
+    uint32_t k = 1;
+    while ((uint64_t)k * c->width < samples)
+      k <<= 1;
+    return k;
+  }
+  default:
+    return 1;
+  }
+}
+
+static bool view_sweeps(const chart_t *c) {
+  return c->view != HISTORY_VIEW_RIDE;
+}
+
+static void column_clear(chart_t *c, uint32_t x) {
+  c->col_min[x] = 1;
+  c->col_max[x] = 0;
+}
+
+static void column_invalidate(lv_obj_t *obj, uint32_t x) {
+  lv_area_t a;
+  lv_obj_get_coords(obj, &a);
+  a.x1 += (int32_t)x;
+  a.x2 = a.x1;
+  lv_obj_invalidate_area(obj, &a);
+}
+
+/* Fill absolute column `col` from the store */
+static void column_fill(lv_obj_t *obj, chart_t *c, uint32_t col,
+                        bool invalidate) {
+  uint32_t x = view_sweeps(c) ? col % c->width : col;
+  if (x >= c->width)
+    return;
+
+  if (!history_store_range(c->ch, col * c->k, c->k, &c->col_min[x],
+                           &c->col_max[x]))
+    column_clear(c, x);
+  if (invalidate)
+    column_invalidate(obj, x);
+
+  if (view_sweeps(c)) {
+    for (uint32_t g = 1; g <= SWEEP_GAP; g++) {
+      uint32_t gx = (x + g) % c->width;
+      if (c->col_min[gx] <= c->col_max[gx]) {
+        column_clear(c, gx);
+        if (invalidate)
+          column_invalidate(obj, gx);
+      }
+    }
+  }
+}
+
+static void chart_rebuild(lv_obj_t *obj, chart_t *c) {
+  uint32_t samples = history_store_count();
+  uint32_t last = samples / c->k; /* in-progress column */
+  uint32_t first = 0;
+
+  c->samples = samples;
+  for (uint32_t x = 0; x < c->width; x++)
+    column_clear(c, x);
+  if (view_sweeps(c) && last + SWEEP_GAP + 1 > c->width)
+    first = last + SWEEP_GAP + 1 - c->width;
+  for (uint32_t col = first; col <= last; col++)
+    column_fill(obj, c, col, false);
+  c->next_col = last;
+  lv_obj_invalidate(obj);
+}
+
+void history_chart_refresh(lv_obj_t *obj) {
+  chart_t *c = (chart_t *)lv_obj_get_user_data(obj);
+  uint32_t samples = history_store_count();
+
+  if (samples == c->samples)
+    return;
+  if (samples < c->samples || view_k(c, samples) != c->k) {
+    c->k = view_k(c, samples);
+    chart_rebuild(obj, c);
+    return;
+  }
+
+  /* Redo the column that was in progress, then the new ones */
+  uint32_t last = samples / c->k;
+  uint32_t first = c->next_col;
+  if (view_sweeps(c) && last - first >= c->width)
+    first = last - c->width + 1;
+  for (uint32_t col = first; col <= last; col++)
+    column_fill(obj, c, col, true);
+  c->next_col = last;
+  c->samples = samples;
+}
+
+static int32_t value_to_y(const chart_t *c, int32_t v, int32_t h) {
+  if (v < c->range_min)
+    v = c->range_min;
+  if (v > c->range_max)
+    v = c->range_max;
+  return (h - 1) - (int32_t)((int64_t)(v - c->range_min) * (h - 1) /
+                             (c->range_max - c->range_min));
+}
+
+static void chart_draw(lv_obj_t *obj, lv_layer_t *layer) {
+  chart_t *c = (chart_t *)lv_obj_get_user_data(obj);
+  lv_area_t coords;
+  lv_area_t clip;
+
+  /* Only the columns invalidated since the last refresh, as collected by
+   * chart_display_cb(); LVGL clips each rect to the area being drawn */
+  lv_obj_get_coords(obj, &coords);
+  if (!c->has_dirty || !lv_area_intersect(&clip, &coords, &c->dirty))
+    clip = coords;
+
+  int32_t h = lv_area_get_height(&coords);
+  lv_draw_rect_dsc_t dsc;
+  lv_draw_rect_dsc_init(&dsc);
+  dsc.bg_color = lv_obj_get_style_line_color(obj, LV_PART_MAIN);
+
+  /* Zero line for signed channels */
+  if (c->range_min < 0 && c->range_max > 0) {
+    lv_area_t zero = clip;
+    zero.y1 = zero.y2 = coords.y1 + value_to_y(c, 0, h);
+    dsc.bg_opa = LV_OPA_50;
+    lv_draw_rect(layer, &dsc, &zero);
+  }
+
+  /* Only the columns inside the invalidated area */
+  dsc.bg_opa = LV_OPA_COVER;
+  for (int32_t x = clip.x1 - coords.x1; x <= clip.x2 - coords.x1; x++) {
+    if (x >= c->width || c->col_min[x] > c->col_max[x])
+      continue;
+    lv_area_t a;
+    a.x1 = a.x2 = coords.x1 + x;
+    a.y1 = coords.y1 + value_to_y(c, c->col_max[x], h);
+    a.y2 = coords.y1 + value_to_y(c, c->col_min[x], h);
+    lv_draw_rect(layer, &dsc, &a);
+  }
+}
+
+/* Collects the invalidated areas that touch the chart, whoever invalidated
+ * them, until the display has been refreshed */
+static void chart_display_cb(lv_event_t *e) {
+  lv_obj_t *obj = (lv_obj_t *)lv_event_get_user_data(e);
+  chart_t *c = (chart_t *)lv_obj_get_user_data(obj);
+  lv_area_t coords;
+  lv_area_t a;
+
+  if (lv_event_get_code(e) == LV_EVENT_REFR_READY) {
+    c->has_dirty = false;
+    return;
+  }
+  lv_obj_get_coords(obj, &coords);
+  if (!lv_area_intersect(&a, &coords, lv_event_get_invalidated_area(e)))
+    return;
+  if (c->has_dirty)
+    lv_area_join(&c->dirty, &c->dirty, &a);
+  else
+    c->dirty = a;
+  c->has_dirty = true;
+}
+
+static void chart_event_cb(lv_event_t *e) {
+  lv_obj_t *obj = lv_event_get_current_target_obj(e);
+  chart_t *c = (chart_t *)lv_obj_get_user_data(obj);
+
+  switch (lv_event_get_code(e)) {
+  case LV_EVENT_DRAW_MAIN:
+    chart_draw(obj, lv_event_get_layer(e));
+    break;
+  case LV_EVENT_DELETE:
+    lv_display_remove_event_cb_with_user_data(lv_obj_get_display(obj),
+                                              chart_display_cb, obj);
+    lv_free(c->col_min);
+    lv_free(c);
+    lv_obj_set_user_data(obj, NULL);
+    break;
+  default:
+    break;
+  }
+}
+
+lv_obj_t *history_chart_create(lv_obj_t *parent, history_channel_t ch,
+                               lv_coord_t w, lv_coord_t h) {
+  chart_t *c = lv_malloc(sizeof(chart_t));
+  int16_t *cols = lv_malloc(2 * (size_t)w * sizeof(int16_t));
+  if (c == NULL || cols == NULL) {
+    lv_free(c);
+    lv_free(cols);
+    return NULL;
+  }
+
+  memset(c, 0, sizeof(*c));
+  c->ch = ch;
+  c->view = HISTORY_VIEW_MINUTE;
+  c->range_max = 1;
+  c->width = (uint16_t)w;
+  c->col_min = cols;
+  c->col_max = cols + w;
+  c->k = 1;
+
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_size(obj, w, h);
+  lv_obj_set_user_data(obj, c);
+  lv_obj_add_event_cb(obj, chart_event_cb, LV_EVENT_ALL, NULL);
+  lv_display_add_event_cb(lv_obj_get_display(obj), chart_display_cb,
+                          LV_EVENT_INVALIDATE_AREA, obj);
+  lv_display_add_event_cb(lv_obj_get_display(obj), chart_display_cb,
+                          LV_EVENT_REFR_READY, obj);
+
+  chart_rebuild(obj, c);
+  return obj;
+}
+
+void history_chart_set_range(lv_obj_t *obj, int32_t min, int32_t max) {
+  chart_t *c = (chart_t *)lv_obj_get_user_data(obj);
+  if (max <= min)
+    return;
+  c->range_min = min;
+  c->range_max = max;
+  lv_obj_invalidate(obj);
+}
+
+void history_chart_set_view(lv_obj_t *obj, history_view_t view) {
+  chart_t *c = (chart_t *)lv_obj_get_user_data(obj);
+  if (view >= HISTORY_VIEW_COUNT || view == c->view)
+    return;
+  c->view = view;
+  c->k = view_k(c, history_store_count());
+  chart_rebuild(obj, c);
+}
+
+history_view_t history_chart_get_view(lv_obj_t *obj) {
+  const chart_t *c = (const chart_t *)lv_obj_get_user_data(obj);
+  return c->view;
+}
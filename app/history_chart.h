@@ -0,0 +1,37 @@
+/**
+ * history_chart.h
+ * Chart of one history_store channel with incremental updates
+ *
+ * Each pixel column shows the min/max of the samples it covers, read from
+ * the decimation pyramid, so filling all columns is O(width) for columns of
+ * up to 128 s (see history_store.h). history_chart_refresh() only fills the
+ * columns completed since the last call and invalidates just those columns,
+ * and drawing skips the columns outside the invalidated areas: the short
+ * views sweep across the chart (the write position wraps around, leaving a
+ * small gap in front of it), the whole ride view grows to the right and is
+ * rebuilt only when its time scale doubles.
+ */
+#ifndef HISTORY_CHART_H
+#define HISTORY_CHART_H
+
+#include "history_store.h"
+#include "lvgl.h"
+
+typedef enum {
+  HISTORY_VIEW_MINUTE, /* one sample per column */
+  HISTORY_VIEW_10MIN,
+  HISTORY_VIEW_RIDE,   /* from the first sample */
+  HISTORY_VIEW_COUNT,
+} history_view_t;
+
+/* The trace uses the object's line colour */
+lv_obj_t *history_chart_create(lv_obj_t *parent, history_channel_t ch,
+                               lv_coord_t w, lv_coord_t h);
+void history_chart_set_range(lv_obj_t *chart, int32_t min, int32_t max);
+void history_chart_set_view(lv_obj_t *chart, history_view_t view);
+history_view_t history_chart_get_view(lv_obj_t *chart);
+
+/* Pick up samples pushed since the last call */
+void history_chart_refresh(lv_obj_t *chart);
+
+#endif /*HISTORY_CHART_H*/
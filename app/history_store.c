@@ -0,0 +1,98 @@
+/**
+ * history_store.c
+ * Telemetry history as a min/max decimation pyramid
+ *
+ * Entry i of level L covers samples [i << (2L), (i + 1) << (2L)). Complete
+ * entries are in the level's ring; the entry being filled lives in an
+ * accumulator so the newest samples are visible at every level.
+ */
+
+#include "history_store.h"
+#include "app_config.h"
+#include <stddef.h>
+
+#define LEN CONFIG_DASH_HISTORY_LEN
+
+typedef struct {
+  int16_t min;
+  int16_t max;
+} minmax_t;
+
+static minmax_t rings[HISTORY_CH_COUNT][HISTORY_LEVELS][LEN];
+static minmax_t acc[HISTORY_CH_COUNT][HISTORY_LEVELS];
+static uint32_t sample_count;
+
+static uint32_t level_shift(int level) {
+  return (uint32_t)level * HISTORY_FACTOR_SHIFT;
+}
+
+void history_store_reset(void) { sample_count = 0; }
+
+uint32_t history_store_count(void) { return sample_count; }
+
+void history_store_push(const int16_t values[HISTORY_CH_COUNT]) {
+  uint32_t n = sample_count;
+
+  for (int ch = 0; ch < HISTORY_CH_COUNT; ch++) {
+    int16_t v = values[ch];
+    rings[ch][0][n % LEN] = (minmax_t){v, v};
+
+    for (int l = 1; l < HISTORY_LEVELS; l++) {
+      uint32_t mask = (1u << level_shift(l)) - 1;
+      minmax_t *a = &acc[ch][l];
+      if ((n & mask) == 0) {
+        *a = (minmax_t){v, v}; /* first sample of a new entry */
+      } else {
+        if (v < a->min)
+          a->min = v;
+        if (v > a->max)
+          a->max = v;
+      }
+      if ((n & mask) == mask) /* entry complete */
+        rings[ch][l][(n >> level_shift(l)) % LEN] = *a;
+    }
+  }
+  sample_count = n + 1;
+}
+
+/* Entry `idx` of `level`, complete or in progress */
+static const minmax_t *entry_get(int ch, int level, uint32_t idx) {
+  uint32_t complete = sample_count >> level_shift(level);
+
+  if (idx < complete)
+    return (complete - idx <= LEN) ? &rings[ch][level][idx % LEN] : NULL;
+  if (idx == complete && level > 0 &&
+      (sample_count & ((1u << level_shift(level)) - 1)) != 0)
+    return &acc[ch][level];
+  return NULL;
+}
+
+bool history_store_range(history_channel_t ch, uint32_t first, uint32_t count,
+                         int16_t *min_out, int16_t *max_out) {
+  if (ch >= HISTORY_CH_COUNT || count == 0 || first >= sample_count)
+    return false;
+  if (count > sample_count - first)
+    count = sample_count - first;
+
+  /* Coarsest level whose entries are not wider than the span */
+  int level = 0;
+  while (level + 1 < HISTORY_LEVELS &&
+         (1u << level_shift(level + 1)) <= count)
+    level++;
+
+  uint32_t lo = first >> level_shift(level);
+  uint32_t hi = (first + count - 1) >> level_shift(level);
+  bool found = false;
+
+  for (uint32_t i = lo; i <= hi; i++) {
+    const minmax_t *e = entry_get(ch, level, i);
+    if (e == NULL)
+      continue; /* too old */
+    if (!found || e->min < *min_out)
+      *min_out = e->min;
+    if (!found || e->max > *max_out)
+      *max_out = e->max;
+    found = true;
+  }
+  return found;
+}
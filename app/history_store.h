@@ -0,0 +1,51 @@
+/**
+ * history_store.h
+ * Telemetry history as a min/max decimation pyramid
+ *
+ * Samples are pushed every CONFIG_DASH_HISTORY_PERIOD_MS. Level 0 keeps the
+ * raw samples, each further level keeps the min/max of HISTORY_FACTOR
+ * entries of the level below, in rings of CONFIG_DASH_HISTORY_LEN entries.
+ * With the defaults (125 ms, 512 entries, 5 levels of factor 4) the coarsest
+ * level reaches back about 4.5 hours.
+ *
+ * A min/max query over any span reads the coarsest level whose entries are
+ * no wider than the span, widening spans whose edges are not aligned to it
+ * to whole entries. Below the top level a span is shorter than
+ * HISTORY_FACTOR entries, so it touches at most HISTORY_FACTOR + 1 of them.
+ * Spans of HISTORY_FACTOR top level entries or more (1024 samples, 128 s
+ * with the defaults) read count / 256 + 2 entries at most, bounded by
+ * CONFIG_DASH_HISTORY_LEN. A chart column therefore costs O(1) up to that
+ * width and grows linearly beyond it.
+ *
+ * No LVGL dependency; not thread-safe (push and query from the LVGL task).
+ */
+#ifndef HISTORY_STORE_H
+#define HISTORY_STORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HISTORY_LEVELS 5
+#define HISTORY_FACTOR_SHIFT 2 /* factor 4 between levels */
+#define HISTORY_FACTOR (1u << HISTORY_FACTOR_SHIFT)
+
+typedef enum {
+  HISTORY_SPEED, /* 0.1 km/h */
+  HISTORY_POWER, /* W */
+  HISTORY_CH_COUNT,
+} history_channel_t;
+
+void history_store_reset(void);
+
+/* One sample of every channel */
+void history_store_push(const int16_t values[HISTORY_CH_COUNT]);
+
+/* Samples pushed since the last reset */
+uint32_t history_store_count(void);
+
+/* Min/max of samples [first, first + count) of `ch`. Returns false when none
+ * of them is still retained. */
+bool history_store_range(history_channel_t ch, uint32_t first, uint32_t count,
+                         int16_t *min_out, int16_t *max_out);
+
+#endif /*HISTORY_STORE_H*/
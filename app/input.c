@@ -0,0 +1,162 @@
+/**
+ * input.c
+ * Handlebar switches: edge queue, debouncing and latency statistics
+ */
+
+#include "input.h"
+#include "app_config.h"
+#include "lvgl.h"
+#include "spsc.h"
+
+#if CONFIG_DASH_INPUT_QUEUE_LEN < 2 ||                                         \
+    (CONFIG_DASH_INPUT_QUEUE_LEN & (CONFIG_DASH_INPUT_QUEUE_LEN - 1)) != 0
+#error "CONFIG_DASH_INPUT_QUEUE_LEN must be a power of two"
+#endif
+
+#define DEBOUNCE_US ((uint32_t)CONFIG_DASH_INPUT_DEBOUNCE_MS * 1000u)
+
+typedef struct {
+  uint32_t t_us;
+  uint8_t id;
+  uint8_t active;
+} input_edge_t;
+
+typedef struct {
+  bool stable;       /* last delivered level */
+  bool raw;          /* last level seen */
+  bool locked;       /* inside the debounce window */
+  uint32_t lock_us;  /* start of the window */
+} input_switch_t;
+
+static const char *const input_names[INPUT_COUNT] = {
+    [INPUT_LEFT_TURN] = "left",
+    [INPUT_RIGHT_TURN] = "right",
+    [INPUT_HIGH_BEAM] = "high",
+    [INPUT_GEAR_UP] = "gear_up",
+    [INPUT_GEAR_DOWN] = "gear_down",
+};
+
+static input_edge_t edge_buf[CONFIG_DASH_INPUT_QUEUE_LEN];
+static spsc_t edge_queue;
+static input_switch_t switches[INPUT_COUNT];
+static input_handler_t input_handler;
+static lv_timer_t *settle_timer;
+static input_stats_t stats;
+
+static bool latency_pending;
+static uint32_t latency_start_us;
+
+void input_edge(input_id_t id, bool active, uint32_t t_us) {
+  input_edge_t e = {.t_us = t_us, .id = (uint8_t)id, .active = active};
+  if (id >= INPUT_COUNT)
+    return;
+  if (spsc_push(&edge_queue, &e))
+    stats.edges++;
+  else
+    stats.overruns++;
+}
+
+static void deliver(input_id_t id, bool active, uint32_t t_us) {
+  switches[id].stable = active;
+  stats.events++;
+  /* The oldest undrawn event defines the latency of the next frame */
+  if (!latency_pending) {
+    latency_pending = true;
+    latency_start_us = t_us;
+  }
+  if (input_handler)
+    input_handler(id, active);
+}
+
+/* Close the debounce window of `sw` if it ended by `t_us`; a level that
+ * changed inside the window is delivered and opens a new one */
+static void settle(input_id_t id, uint32_t t_us) {
+  input_switch_t *sw = &switches[id];
+  if (!sw->locked || t_us - sw->lock_us < DEBOUNCE_US)
+    return;
+  sw->locked = false;
+  if (sw->raw != sw->stable) {
+    sw->lock_us += DEBOUNCE_US;
+    sw->locked = true;
+    deliver(id, sw->raw, sw->lock_us);
+  }
+}
+
+void input_process(void) {
+  input_edge_t e;
+
+  while (spsc_pop(&edge_queue, &e)) {
+    input_switch_t *sw = &switches[e.id];
+    settle((input_id_t)e.id, e.t_us);
+    sw->raw = e.active;
+    if (sw->locked || sw->stable == (bool)e.active) {
+      stats.bounces++;
+      continue;
+    }
+    sw->locked = true;
+    sw->lock_us = e.t_us;
+    deliver((input_id_t)e.id, e.active, e.t_us);
+  }
+
+  /* Wake up again when the earliest open window ends */
+  uint32_t now = input_now_us();
+  uint32_t wait_us = UINT32_MAX;
+  for (uint8_t i = 0; i < INPUT_COUNT; i++) {
+    settle((input_id_t)i, now);
+    if (switches[i].locked) {
+      uint32_t left = DEBOUNCE_US - (now - switches[i].lock_us);
+      if (left < wait_us)
+        wait_us = left;
+    }
+  }
+  if (wait_us != UINT32_MAX) {
+    lv_timer_set_period(settle_timer, wait_us / 1000u + 1u);
+    lv_timer_reset(settle_timer);
+    lv_timer_resume(settle_timer);
+  }
+}
+
+static void settle_timer_cb(lv_timer_t *t) {
+  lv_timer_pause(t);
+  input_process();
+}
+
+/* End of a refresh: everything delivered before it is now on screen */
+static void refr_ready_cb(lv_event_t *e) {
+  LV_UNUSED(e);
+  if (!latency_pending)
+    return;
+  latency_pending = false;
+
+  uint32_t lat = input_now_us() - latency_start_us;
+  stats.latency_last_us = lat;
+  if (lat > stats.latency_max_us)
+    stats.latency_max_us = lat;
+  if (stats.latency_avg_us == 0)
+    stats.latency_avg_us = lat;
+  else
+    stats.latency_avg_us =
+        stats.latency_avg_us - stats.latency_avg_us / 8u + lat / 8u;
+}
+
+void input_init(void) {
+  spsc_init(&edge_queue, edge_buf, sizeof(input_edge_t),
+            CONFIG_DASH_INPUT_QUEUE_LEN);
+
+  settle_timer = lv_timer_create(settle_timer_cb, DEBOUNCE_US / 1000u, NULL);
+  lv_timer_pause(settle_timer);
+
+  lv_display_t *disp = lv_display_get_default();
+  if (disp)
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+
+  input_platform_init();
+}
+
+void input_set_handler(input_handler_t handler) { input_handler = handler; }
+
+void input_get_stats(input_stats_t *out) { *out = stats; }
+
+const char *input_name(input_id_t id) {
+  return id < INPUT_COUNT ? input_names[id] : "?";
+}
@@ -0,0 +1,69 @@
+/**
+ * input.h
+ * Handlebar switches: turn signals, high beam and gear up/down
+ *
+ * Switch edges are captured by interrupts (GPIO ISRs on the MCU, a reader
+ * thread fed through a FIFO in the simulator) and queued with their time
+ * stamp in a lock-free ring. input_process(), called by the LVGL task right
+ * before lv_timer_handler(), drains the ring, debounces and delivers events
+ * to the handler, so a change is drawn by the refresh of the same loop
+ * iteration. Nothing is polled: with the switches idle the cost is one empty
+ * ring check per loop.
+ *
+ * Debouncing accepts the first edge of a switch at once and ignores the
+ * following CONFIG_DASH_INPUT_DEBOUNCE_MS; at the end of that window the last
+ * level seen is delivered if it differs from the accepted one.
+ *
+ * Latency is measured from the edge time stamp to the end of the first
+ * display refresh after the event was delivered. Scan-out of the new frame
+ * adds up to one panel frame on top of that.
+ */
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+  INPUT_LEFT_TURN,  /* level: turn signal switch in the left position */
+  INPUT_RIGHT_TURN, /* level: turn signal switch in the right position */
+  INPUT_HIGH_BEAM,  /* level: high beam on */
+  INPUT_GEAR_UP,    /* momentary button */
+  INPUT_GEAR_DOWN,  /* momentary button */
+  INPUT_COUNT,
+} input_id_t;
+
+/* `active`: switch closed / button pressed */
+typedef void (*input_handler_t)(input_id_t id, bool active);
+
+typedef struct {
+  uint32_t edges;           /* raw edges queued by the interrupt side */
+  uint32_t overruns;        /* edges lost on a full queue */
+  uint32_t events;          /* debounced events delivered */
+  uint32_t bounces;         /* edges swallowed by the debouncer */
+  uint32_t latency_last_us; /* edge to end of refresh */
+  uint32_t latency_max_us;
+  uint32_t latency_avg_us;  /* moving average over ~8 events */
+} input_stats_t;
+
+/* Set up the queue and the platform edge source */
+void input_init(void);
+void input_set_handler(input_handler_t handler);
+
+/* Producer side: a raw edge of `id`, now at `active`, seen at `t_us`
+ * (input_now_us() time base). Safe from an ISR; all producers must be
+ * serialised, i.e. run from one interrupt level or one thread. */
+void input_edge(input_id_t id, bool active, uint32_t t_us);
+
+/* Consumer side, LVGL task only */
+void input_process(void);
+
+void input_get_stats(input_stats_t *out);
+const char *input_name(input_id_t id);
+
+/* Implemented per platform (main/input_esp.c,
+ * simulator/src/hal/input_host.c) */
+void input_platform_init(void);
+uint32_t input_now_us(void);
+
+#endif /*INPUT_H*/
@@ -0,0 +1,166 @@
+/**
+ * journal.c
+ * Append-only record journal over a ring of flash sectors
+ *
+ * Slot n of the ring is at n * JOURNAL_RECORD_SIZE. Records carry a
+ * sequence number counting every commit ever made, so the newest one is the
+ * valid record with the highest sequence.
+ */
+
+#include "journal.h"
+#include "app_config.h"
+#include "crc.h"
+#include <stddef.h>
+#include <string.h>
+
+#define SLOTS_PER_SECTOR (JOURNAL_SECTOR_SIZE / JOURNAL_RECORD_SIZE)
+#define SEQ_ERASED 0xFFFFFFFFu
+
+typedef struct {
+  uint32_t seq;
+  uint32_t odo_m;
+  uint64_t drive_uj;
+  uint64_t regen_uj;
+  int32_t hist_mwhkm;
+  uint32_t hist[JOURNAL_HIST_SLOTS];
+  uint32_t crc; /* over the fields above */
+} record_t;
+
+/* The on-flash layout is fixed */
+typedef char record_size_check[sizeof(record_t) == JOURNAL_RECORD_SIZE ? 1 : -1];
+
+static uint32_t sectors;
+static uint32_t next_slot;
+static uint32_t seq; /* of the newest record, 0 if none */
+static journal_data_t last;
+static journal_stats_t stats;
+
+static bool slot_read(uint32_t slot, record_t *r) {
+  stats.boot_reads++;
+  return journal_platform_read(slot * JOURNAL_RECORD_SIZE, r, sizeof(*r));
+}
+
+static bool record_erased(const record_t *r) {
+  const uint8_t *p = (const uint8_t *)r;
+  for (size_t i = 0; i < sizeof(*r); i++)
+    if (p[i] != 0xFF)
+      return false;
+  return true;
+}
+
+static bool record_valid(const record_t *r) {
+  return r->seq != SEQ_ERASED && r->seq != 0 &&
+         r->crc == crc32_update(0, r, offsetof(record_t, crc));
+}
+
+/* Number of written slots in `sector`, whose first slot is written */
+static uint32_t sector_fill(uint32_t sector) {
+  uint32_t lo = 1, hi = SLOTS_PER_SECTOR; /* first erased slot in [lo, hi] */
+  record_t r;
+
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (slot_read(sector * SLOTS_PER_SECTOR + mid, &r) && !record_erased(&r))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+bool journal_init(journal_data_t *out) {
+  uint32_t size = journal_platform_open();
+  record_t r, best_head;
+  int32_t best = -1;
+
+  sectors = size / JOURNAL_SECTOR_SIZE;
+  stats.sectors = sectors;
+  if (sectors == 0)
+    return false;
+
+  for (uint32_t s = 0; s < sectors; s++) {
+    if (slot_read(s * SLOTS_PER_SECTOR, &r) && record_valid(&r) &&
+        (best < 0 || r.seq > best_head.seq)) {
+      best = (int32_t)s;
+      best_head = r;
+    }
+  }
+  if (best < 0) {
+    next_slot = 0;
+    return false;
+  }
+
+  /* The last written slot may be torn: walk back to a valid record, the
+   * sector head at worst */
+  uint32_t first = (uint32_t)best * SLOTS_PER_SECTOR;
+  uint32_t slot = first + sector_fill((uint32_t)best) - 1;
+  next_slot = slot + 1;
+  for (; slot > first; slot--) {
+    if (slot_read(slot, &r) && record_valid(&r))
+      break;
+    stats.boot_skipped++;
+  }
+  if (slot == first)
+    r = best_head;
+
+  seq = r.seq;
+  last.odo_m = r.odo_m;
+  last.drive_uj = r.drive_uj;
+  last.regen_uj = r.regen_uj;
+  last.hist_mwhkm = r.hist_mwhkm;
+  memcpy(last.hist, r.hist, sizeof(last.hist));
+  *out = last;
+  return true;
+}
+
+static void commit(const journal_data_t *d) {
+  record_t r;
+
+  if (sectors == 0)
+    return;
+  uint32_t slot = next_slot % (sectors * SLOTS_PER_SECTOR);
+  if (slot % SLOTS_PER_SECTOR == 0) {
+    journal_platform_erase(slot / SLOTS_PER_SECTOR * JOURNAL_SECTOR_SIZE);
+    stats.erases++;
+  }
+
+  r.seq = seq + 1;
+  r.odo_m = d->odo_m;
+  r.drive_uj = d->drive_uj;
+  r.regen_uj = d->regen_uj;
+  r.hist_mwhkm = d->hist_mwhkm;
+  memcpy(r.hist, d->hist, sizeof(r.hist));
+  r.crc = crc32_update(0, &r, offsetof(record_t, crc));
+
+  /* A failed write leaves garbage in the slot: move past it either way */
+  next_slot = slot + 1;
+  if (!journal_platform_write(slot * JOURNAL_RECORD_SIZE, &r, sizeof(r)))
+    return;
+  seq = r.seq;
+  last = *d;
+  stats.commits++;
+}
+
+void journal_update(const journal_data_t *d) {
+  if (d->odo_m - last.odo_m >= CONFIG_DASH_JOURNAL_COMMIT_M)
+    commit(d);
+}
+
+void journal_flush(const journal_data_t *d) {
+  if (seq == 0 || d->odo_m != last.odo_m || d->drive_uj != last.drive_uj ||
+      d->regen_uj != last.regen_uj || d->hist_mwhkm != last.hist_mwhkm ||
+      memcmp(d->hist, last.hist, sizeof(d->hist)) != 0)
+    commit(d);
+}
+
+void journal_get_stats(journal_stats_t *out) {
+  *out = stats;
+  out->records = seq;
+  out->erases_10k_km = 0;
+  if (sectors != 0 && last.odo_m != 0) {
+    /* Every SLOTS_PER_SECTOR records cost one erase, spread over the ring */
+    uint64_t erases = (uint64_t)seq / SLOTS_PER_SECTOR;
+    out->erases_10k_km =
+        (uint32_t)(erases * 10000000u / sectors / last.odo_m);
+  }
+}
@@ -0,0 +1,73 @@
+/**
+ * journal.h
+ * Power-fail-safe store for the odometer, lifetime energy, the long-term
+ * consumption average and lifetime usage histograms
+ *
+ * Every commit appends one CRC-protected JOURNAL_RECORD_SIZE record to a
+ * ring of flash sectors; nothing is ever rewritten in place. A sector is
+ * erased only when the ring reaches it again, so the newest complete record
+ * always survives a brownout: a torn write fails its CRC and the previous
+ * record wins, a torn erase only affects the oldest sector.
+ *
+ * Commits are coalesced: journal_update() writes once the odometer has moved
+ * CONFIG_DASH_JOURNAL_COMMIT_M, journal_flush() writes whatever changed (end
+ * of a ride). A power cut loses at most the distance since the last commit.
+ *
+ * At boot, the first record of each sector gives the newest sector, and a
+ * binary search over its slots (written ones are contiguous from the start)
+ * the newest record: sectors + log2(records per sector) reads of 256 bytes.
+ *
+ * Wear: with the defaults (500 m, 16 sectors of 16 records), 10,000 km is
+ * 20,000 records, i.e. 78 erases per sector, against the 100,000 cycles of
+ * NOR flash. journal_get_stats() reports the figure actually measured.
+ *
+ * Not thread safe: use from the LVGL task.
+ */
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define JOURNAL_SECTOR_SIZE 4096
+#define JOURNAL_RECORD_SIZE 256
+#define JOURNAL_HIST_SLOTS 56 /* histogram counts per record */
+
+typedef struct {
+  uint32_t odo_m;
+  uint64_t drive_uj;   /* lifetime, see trip.h */
+  uint64_t regen_uj;
+  int32_t hist_mwhkm;  /* long-term consumption, 0 if unknown */
+  uint32_t hist[JOURNAL_HIST_SLOTS]; /* histogram counts, layout by caller */
+} journal_data_t;
+
+typedef struct {
+  uint32_t sectors;        /* 0: no journal area, nothing is stored */
+  uint32_t records;        /* lifetime, from the sequence number */
+  uint32_t commits;        /* since boot */
+  uint32_t erases;         /* since boot */
+  uint16_t boot_reads;     /* record reads to recover the newest */
+  uint16_t boot_skipped;   /* torn or corrupt records passed over */
+  uint32_t erases_10k_km;  /* per sector per 10,000 km, lifetime average */
+} journal_stats_t;
+
+/* Find the newest record; false if there is none (new or blank flash) */
+bool journal_init(journal_data_t *out);
+
+/* Coalesced commit, call at any rate */
+void journal_update(const journal_data_t *d);
+
+/* Commit now unless nothing changed since the last commit */
+void journal_flush(const journal_data_t *d);
+
+void journal_get_stats(journal_stats_t *out);
+
+/* Implemented per platform (main/journal_esp.c,
+ * simulator/src/hal/journal_host.c): a flash area of whole sectors that
+ * behaves like NOR flash, i.e. writes can only clear bits */
+uint32_t journal_platform_open(void); /* size in bytes, 0 if unavailable */
+bool journal_platform_read(uint32_t addr, void *buf, uint32_t len);
+bool journal_platform_write(uint32_t addr, const void *buf, uint32_t len);
+bool journal_platform_erase(uint32_t addr); /* one sector */
+
+#endif /*JOURNAL_H*/
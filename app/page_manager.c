@@ -0,0 +1,243 @@
+/**
+ * page_manager.c
+ * Multi-page UI with lazy page construction and widget recycling
+ *
+ * Resident pages are children of the parent screen, hidden unless active.
+ * The recycle pools are two hidden containers on the same screen; moving an
+ * object between a page and a pool is a re-parent, no allocation.
+ */
+
+#include "page_manager.h"
+#include "app_config.h"
+
+static const page_def_t *const *page_defs;
+static uint8_t page_count;
+static lv_obj_t *page_parent;
+static lv_obj_t *page_roots[PAGE_MANAGER_MAX_PAGES]; /* NULL: not built */
+static uint32_t page_last_used[PAGE_MANAGER_MAX_PAGES];
+static page_stats_t page_stats[PAGE_MANAGER_MAX_PAGES];
+static uint8_t active_page;
+static uint32_t use_seq;
+
+static lv_obj_t *pool_labels;
+static lv_obj_t *pool_panels;
+static uint16_t pool_reused; /* objects taken from the pools by this build */
+
+static bool switch_pending;
+static uint32_t switch_start;
+
+/* Same state for new and recycled objects, so a page looks identical
+ * whichever way its widgets were obtained */
+static void obj_reset(lv_obj_t *obj) {
+  lv_obj_remove_style_all(obj);
+  lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_SCROLLABLE |
+                              LV_OBJ_FLAG_CLICKABLE);
+}
+
+static lv_obj_t *pool_take(lv_obj_t *pool, lv_obj_t *parent) {
+  if (lv_obj_get_child_count(pool) == 0)
+    return NULL;
+  lv_obj_t *obj = lv_obj_get_child(pool, -1);
+  lv_obj_set_parent(obj, parent);
+  pool_reused++;
+  return obj;
+}
+
+lv_obj_t *page_label_create(lv_obj_t *parent) {
+  lv_obj_t *obj = pool_take(pool_labels, parent);
+  if (obj == NULL) {
+    obj = lv_label_create(parent);
+    obj_reset(obj);
+  }
+  return obj;
+}
+
+lv_obj_t *page_panel_create(lv_obj_t *parent) {
+  lv_obj_t *obj = pool_take(pool_panels, parent);
+  if (obj == NULL) {
+    obj = lv_obj_create(parent);
+    obj_reset(obj);
+  }
+  return obj;
+}
+
+static uint32_t pool_size(void) {
+  return lv_obj_get_child_count(pool_labels) +
+         lv_obj_get_child_count(pool_panels);
+}
+
+/* Post-order: children are recycled or deleted before their parent. Only
+ * labels and plain panels without event callbacks are pooled; everything
+ * else, and anything beyond the pool size, is deleted. */
+static void recycle_tree(lv_obj_t *obj) {
+  while (lv_obj_get_child_count(obj) > 0)
+    recycle_tree(lv_obj_get_child(obj, -1));
+
+  lv_obj_t *pool = NULL;
+  if (lv_obj_check_type(obj, &lv_label_class))
+    pool = pool_labels;
+  else if (lv_obj_check_type(obj, &lv_obj_class))
+    pool = pool_panels;
+
+  if (pool == NULL || lv_obj_get_event_count(obj) > 0 ||
+      pool_size() >= CONFIG_DASH_PAGE_POOL_SIZE) {
+    lv_obj_delete(obj);
+    return;
+  }
+
+  if (pool == pool_labels)
+    lv_label_set_text(obj, ""); /* free long texts */
+  obj_reset(obj);
+  lv_obj_set_parent(obj, pool);
+}
+
+static void page_evict(uint8_t id) {
+  if (page_defs[id]->release)
+    page_defs[id]->release();
+  recycle_tree(page_roots[id]);
+  page_roots[id] = NULL;
+}
+
+/* Make room in the cache for one more page, keeping `keep` */
+static void cache_make_room(uint8_t keep) {
+  for (;;) {
+    uint8_t resident = 0;
+    int victim = -1;
+    for (uint8_t i = 0; i < page_count; i++) {
+      if (page_roots[i] == NULL)
+        continue;
+      resident++;
+      if (i == keep || page_defs[i]->pinned)
+        continue;
+      if (victim < 0 || page_last_used[i] < page_last_used[victim])
+        victim = i;
+    }
+    if (resident < CONFIG_DASH_PAGE_CACHE_SIZE || victim < 0)
+      return;
+    page_evict((uint8_t)victim);
+  }
+}
+
+static uint32_t heap_used(void) {
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  return mon.total_size - mon.free_size;
+}
+
+static void page_build(uint8_t id) {
+  page_stats_t *st = &page_stats[id];
+  uint32_t used_before = heap_used();
+  uint32_t t0 = lv_tick_get();
+
+  pool_reused = 0;
+  lv_obj_t *root = page_panel_create(page_parent);
+  lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+  lv_obj_add_flag(root, LV_OBJ_FLAG_HIDDEN);
+  page_defs[id]->build(root);
+  page_roots[id] = root;
+
+  st->build_ms = lv_tick_elaps(t0);
+  st->heap_bytes = (int32_t)(heap_used() - used_before);
+  st->recycled = pool_reused;
+  st->builds++;
+}
+
+bool page_manager_show(uint8_t id) {
+  if (id >= page_count)
+    return false;
+  if (id == active_page && page_roots[id])
+    return true;
+
+  switch_start = lv_tick_get();
+  if (page_roots[id] == NULL) {
+    cache_make_room(id);
+    page_build(id);
+  }
+
+  if (page_roots[active_page])
+    lv_obj_add_flag(page_roots[active_page], LV_OBJ_FLAG_HIDDEN);
+  lv_obj_remove_flag(page_roots[id], LV_OBJ_FLAG_HIDDEN);
+  active_page = id;
+  page_last_used[id] = ++use_seq;
+  page_stats[id].shows++;
+  switch_pending = true;
+
+  /* Current values in the first frame */
+  if (page_defs[id]->update)
+    page_defs[id]->update();
+  return true;
+}
+
+void page_manager_next(void) {
+  page_manager_show((uint8_t)((active_page + 1) % page_count));
+}
+
+uint8_t page_manager_active(void) { return active_page; }
+
+bool page_manager_is_visible(uint8_t id) {
+  return id == active_page && page_roots[id] != NULL;
+}
+
+const page_def_t *page_manager_page(uint8_t id) {
+  return id < page_count ? page_defs[id] : NULL;
+}
+
+uint8_t page_manager_page_count(void) { return page_count; }
+
+void page_manager_invalidate(void) {
+  for (uint8_t i = 0; i < page_count; i++) {
+    if (page_roots[i] && !page_defs[i]->pinned)
+      page_evict(i);
+  }
+  /* Pinned pages stay built, so this only rebuilds a non-pinned active page */
+  if (page_roots[active_page] == NULL)
+    page_manager_show(active_page);
+}
+
+void page_manager_get_stats(uint8_t id, page_stats_t *out) {
+  if (id < page_count)
+    *out = page_stats[id];
+}
+
+static void update_timer_cb(lv_timer_t *t) {
+  LV_UNUSED(t);
+  if (page_roots[active_page] && page_defs[active_page]->update)
+    page_defs[active_page]->update();
+}
+
+/* End of the first refresh after a switch: the new page is on screen */
+static void refr_ready_cb(lv_event_t *e) {
+  LV_UNUSED(e);
+  if (!switch_pending)
+    return;
+  switch_pending = false;
+
+  page_stats_t *st = &page_stats[active_page];
+  st->switch_ms = lv_tick_elaps(switch_start);
+  LV_LOG_USER("page %s: switch %u ms, build %u ms, heap %d B, %u recycled",
+              page_defs[active_page]->name, (unsigned)st->switch_ms,
+              (unsigned)st->build_ms, (int)st->heap_bytes,
+              (unsigned)st->recycled);
+}
+
+void page_manager_init(lv_obj_t *parent, const page_def_t *const *pages,
+                       uint8_t count) {
+  if (count > PAGE_MANAGER_MAX_PAGES)
+    count = PAGE_MANAGER_MAX_PAGES;
+  page_defs = pages;
+  page_count = count;
+  page_parent = parent;
+
+  pool_labels = lv_obj_create(parent);
+  pool_panels = lv_obj_create(parent);
+  lv_obj_add_flag(pool_labels, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_add_flag(pool_panels, LV_OBJ_FLAG_HIDDEN);
+
+  lv_display_t *disp = lv_display_get_default();
+  if (disp)
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+  lv_timer_create(update_timer_cb, CONFIG_DASH_PAGE_UPDATE_MS, NULL);
+
+  active_page = 0;
+  page_manager_show(0);
+}
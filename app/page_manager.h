@@ -0,0 +1,68 @@
+/**
+ * page_manager.h
+ * Multi-page UI with lazy page construction and widget recycling
+ *
+ * A page's widget tree is built the first time the page is shown. Built
+ * pages stay resident (hidden) in a small LRU cache of
+ * CONFIG_DASH_PAGE_CACHE_SIZE pages; when a page is evicted its labels and
+ * plain panels go back to a shared pool of CONFIG_DASH_PAGE_POOL_SIZE objects
+ * that the next page build takes from before allocating new ones.
+ *
+ * Only the visible page's update callback runs, every
+ * CONFIG_DASH_PAGE_UPDATE_MS.
+ */
+#ifndef PAGE_MANAGER_H
+#define PAGE_MANAGER_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PAGE_MANAGER_MAX_PAGES 8
+
+typedef struct {
+  const char *name;
+  bool pinned; /* never evicted, e.g. the home page */
+  /* Create the page's widgets under `root` (a full screen panel) */
+  void (*build)(lv_obj_t *root);
+  /* Refresh the data bindings; called only while the page is visible */
+  void (*update)(void);
+  /* The page's widgets are about to be recycled: drop all references */
+  void (*release)(void);
+} page_def_t;
+
+typedef struct {
+  uint32_t builds;     /* times the page was built (first show or after eviction) */
+  uint32_t shows;      /* times the page was shown */
+  uint32_t build_ms;   /* last build time */
+  int32_t heap_bytes;  /* LVGL heap used by the last build */
+  uint32_t switch_ms;  /* last show request to end of the first refresh */
+  uint16_t recycled;   /* pooled objects reused by the last build */
+} page_stats_t;
+
+/* `pages` (indexed by page id) must stay valid; page 0 is shown first */
+void page_manager_init(lv_obj_t *parent, const page_def_t *const *pages,
+                       uint8_t count);
+
+bool page_manager_show(uint8_t id);
+void page_manager_next(void);
+uint8_t page_manager_active(void);
+bool page_manager_is_visible(uint8_t id);
+/* Page definition of `id`, NULL if out of range */
+const page_def_t *page_manager_page(uint8_t id);
+uint8_t page_manager_page_count(void);
+
+/* Drop all cached pages except pinned ones and rebuild the active page,
+ * e.g. after a skin change */
+void page_manager_invalidate(void);
+
+void page_manager_get_stats(uint8_t id, page_stats_t *out);
+
+/* Widget factories for page builders. Objects may come from the recycle pool
+ * and always start in the same clean state: no styles (not even the theme's),
+ * not scrollable, not clickable, not hidden. Builders set size, position
+ * and styles explicitly and must not attach event callbacks to them. */
+lv_obj_t *page_label_create(lv_obj_t *parent);
+lv_obj_t *page_panel_create(lv_obj_t *parent);
+
+#endif /*PAGE_MANAGER_H*/
@@ -0,0 +1,408 @@
+/**
+ * pages.c
+ * Secondary dashboard pages: trip, battery, power, history and settings
+ *
+ * Widgets come from page_label_create()/page_panel_create() so they are
+ * recycled when a page is evicted. Text colour is inherited from the screen
+ * (set by the theme); titles are dimmed with text opacity so the pages follow
+ * day/night switches without being rebuilt.
+ */
+
+#include "pages.h"
+#include "dashboard.h"
+#include "history_chart.h"
+#include "app_config.h"
+#include "bms_can.h"
+#include "ctrl_uart.h"
+#include "input.h"
+#include "journal.h"
+#include "ridelog.h"
+#include "telemetry.h"
+#include "wheel.h"
+#include <stdio.h>
+
+#define COL_W 232
+#define ROW_H 70
+#define TOP_Y 52
+
+static lv_obj_t *page_header(lv_obj_t *root, const char *title) {
+  lv_obj_t *label = page_label_create(root);
+  lv_label_set_text(label, title);
+  lv_obj_set_style_text_font(label, dashboard_font(ASSET_FONT_VALUE), 0);
+  lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 6);
+
+  lv_obj_t *line = page_panel_create(root);
+  lv_obj_set_size(line, LV_PCT(100), 2);
+  lv_obj_set_pos(line, 0, 40);
+  lv_obj_set_style_bg_opa(line, LV_OPA_50, 0);
+  lv_obj_set_style_bg_color(line, lv_palette_main(LV_PALETTE_GREY), 0);
+  return label;
+}
+
+/* Title/value cell `index` of a two column grid; returns the value label */
+static lv_obj_t *page_cell(lv_obj_t *root, int index, const char *title) {
+  lv_coord_t x = 16 + (index % 2) * COL_W;
+  lv_coord_t y = TOP_Y + (index / 2) * ROW_H;
+
+  lv_obj_t *t = page_label_create(root);
+  lv_label_set_text(t, title);
+  lv_obj_set_style_text_font(t, dashboard_font(ASSET_FONT_TITLE), 0);
+  lv_obj_set_style_text_opa(t, LV_OPA_60, 0);
+  lv_obj_set_pos(t, x, y);
+
+  lv_obj_t *v = page_label_create(root);
+  lv_label_set_text(v, "--");
+  lv_obj_set_style_text_font(v, dashboard_font(ASSET_FONT_VALUE), 0);
+  lv_obj_set_pos(v, x, y + 18);
+  return v;
+}
+
+/* ---- Trip ---- */
+
+static lv_obj_t *trip_dist;
+static lv_obj_t *trip_time;
+static lv_obj_t *trip_avg_speed;
+static lv_obj_t *trip_max_speed;
+static lv_obj_t *trip_used;
+static lv_obj_t *trip_avg_cons;
+
+static void trip_build(lv_obj_t *root) {
+  page_header(root, "TRIP");
+  trip_dist = page_cell(root, 0, "DISTANCE km");
+  trip_time = page_cell(root, 1, "RIDE TIME");
+  trip_avg_speed = page_cell(root, 2, "AVG SPD km/h");
+  trip_max_speed = page_cell(root, 3, "MAX SPD km/h");
+  trip_used = page_cell(root, 4, "USED kWh");
+  trip_avg_cons = page_cell(root, 5, "AVG Wh/km");
+}
+
+static void trip_update(void) {
+  const dash_values_t *v = dashboard_values();
+  int32_t t = v->ride_time_s;
+  int32_t avg = v->avg_speed_x10;
+
+  lv_label_set_text_fmt(trip_dist, "%d.%d", (int)(v->trip_x10 / 10),
+                        (int)(v->trip_x10 % 10));
+  lv_label_set_text_fmt(trip_time, "%02d:%02d:%02d", (int)(t / 3600),
+                        (int)(t % 3600 / 60), (int)(t % 60));
+  lv_label_set_text_fmt(trip_avg_speed, "%d.%d", (int)(avg / 10),
+                        (int)(avg % 10));
+  lv_label_set_text_fmt(trip_max_speed, "%d", (int)v->max_speed_kmh);
+  lv_label_set_text_fmt(trip_used, "%d.%d", (int)(v->used_x10 / 10),
+                        (int)(v->used_x10 % 10));
+  int32_t cons = v->ride_avg_x10 < 0 ? 0 : v->ride_avg_x10;
+  lv_label_set_text_fmt(trip_avg_cons, "%d.%d", (int)(cons / 10),
+                        (int)(cons % 10));
+}
+
+static void trip_release(void) {
+  trip_dist = trip_time = trip_avg_speed = NULL;
+  trip_max_speed = trip_used = trip_avg_cons = NULL;
+}
+
+const page_def_t page_trip = {
+    .name = "trip",
+    .build = trip_build,
+    .update = trip_update,
+    .release = trip_release,
+};
+
+/* ---- Battery ---- */
+
+static lv_obj_t *batt_soc;
+static lv_obj_t *batt_voltage;
+static lv_obj_t *batt_current;
+static lv_obj_t *batt_cells;
+static lv_obj_t *batt_temp;
+static lv_obj_t *batt_cap;
+
+static void battery_build(lv_obj_t *root) {
+  page_header(root, "BATTERY");
+  batt_soc = page_cell(root, 0, "SOC %");
+  batt_voltage = page_cell(root, 1, "VOLTAGE V");
+  batt_current = page_cell(root, 2, "CURRENT A");
+  batt_cells = page_cell(root, 3, "CELLS V min/max");
+  batt_temp = page_cell(root, 4, "TEMP C");
+  batt_cap = page_cell(root, 5, "CAPACITY kWh");
+}
+
+static void battery_update(void) {
+  const dash_values_t *v = dashboard_values();
+  int32_t ma = v->batt_ma < 0 ? -v->batt_ma : v->batt_ma;
+
+  lv_label_set_text_fmt(batt_soc, "%d", (int)v->soc_pct);
+  lv_label_set_text_fmt(batt_voltage, "%d.%02d", (int)(v->batt_mv / 1000),
+                        (int)(v->batt_mv % 1000 / 10));
+  lv_label_set_text_fmt(batt_current, "%s%d.%d", v->batt_ma < 0 ? "-" : "",
+                        (int)(ma / 1000), (int)(ma % 1000 / 100));
+  if (v->cell_max_mv > 0)
+    lv_label_set_text_fmt(batt_cells, "%d.%03d/%d.%03d",
+                          (int)(v->cell_min_mv / 1000),
+                          (int)(v->cell_min_mv % 1000),
+                          (int)(v->cell_max_mv / 1000),
+                          (int)(v->cell_max_mv % 1000));
+  lv_label_set_text_fmt(batt_temp, "%d", (int)v->batt_temp_c);
+  lv_label_set_text_fmt(batt_cap, "%d.%d", (int)(v->batt_cap_x10 / 10),
+                        (int)(v->batt_cap_x10 % 10));
+}
+
+static void battery_release(void) {
+  batt_soc = batt_voltage = batt_current = NULL;
+  batt_cells = batt_temp = batt_cap = NULL;
+}
+
+const page_def_t page_battery = {
+    .name = "battery",
+    .build = battery_build,
+    .update = battery_update,
+    .release = battery_release,
+};
+
+/* ---- Power ---- */
+
+static lv_obj_t *pwr_recovered;
+static lv_obj_t *pwr_peak_short;
+static lv_obj_t *pwr_peak_long;
+static lv_obj_t *pwr_peak_trip;
+static lv_obj_t *pwr_regen_long;
+static lv_obj_t *pwr_regen_trip;
+
+static void power_build(lv_obj_t *root) {
+  char title[24];
+
+  page_header(root, "POWER");
+  pwr_recovered = page_cell(root, 0, "RECOVERED % trip/life");
+  pwr_peak_trip = page_cell(root, 1, "PEAK TRIP kW");
+  snprintf(title, sizeof(title), "PEAK %ds kW", CONFIG_DASH_PEAK_SHORT_S);
+  pwr_peak_short = page_cell(root, 2, title);
+  snprintf(title, sizeof(title), "PEAK %ds kW", CONFIG_DASH_PEAK_LONG_S);
+  pwr_peak_long = page_cell(root, 3, title);
+  snprintf(title, sizeof(title), "REGEN %ds kW", CONFIG_DASH_PEAK_LONG_S);
+  pwr_regen_long = page_cell(root, 4, title);
+  pwr_regen_trip = page_cell(root, 5, "REGEN TRIP kW");
+}
+
+/* W as kW with three decimals */
+static void set_kw(lv_obj_t *label, int32_t w) {
+  int32_t a = w < 0 ? -w : w;
+  lv_label_set_text_fmt(label, "%s%d.%03d", w < 0 ? "-" : "", (int)(a / 1000),
+                        (int)(a % 1000));
+}
+
+static void power_update(void) {
+  const dash_values_t *v = dashboard_values();
+
+  lv_label_set_text_fmt(pwr_recovered, "%d.%d / %d.%d",
+                        (int)(v->recovered_x10 / 10),
+                        (int)(v->recovered_x10 % 10),
+                        (int)(v->life_recovered_x10 / 10),
+                        (int)(v->life_recovered_x10 % 10));
+  set_kw(pwr_peak_trip, v->peak_w);
+  set_kw(pwr_peak_short, v->peak_short_w);
+  set_kw(pwr_peak_long, v->peak_long_w);
+  set_kw(pwr_regen_long, v->regen_long_w);
+  set_kw(pwr_regen_trip, v->regen_peak_w);
+}
+
+static void power_release(void) {
+  pwr_recovered = pwr_peak_short = pwr_peak_long = NULL;
+  pwr_peak_trip = pwr_regen_long = pwr_regen_trip = NULL;
+}
+
+const page_def_t page_power = {
+    .name = "power",
+    .build = power_build,
+    .update = power_update,
+    .release = power_release,
+};
+
+/* ---- History ---- */
+
+#define CHART_W 448
+#define CHART_H 82
+
+static lv_obj_t *hist_speed;
+static lv_obj_t *hist_power;
+static lv_obj_t *hist_view;
+
+static const char *const hist_view_names[HISTORY_VIEW_COUNT] = {
+    [HISTORY_VIEW_MINUTE] = "1 MIN",
+    [HISTORY_VIEW_10MIN] = "10 MIN",
+    [HISTORY_VIEW_RIDE] = "RIDE",
+};
+
+/* Tap a chart to cycle the time span of both */
+static void hist_chart_clicked_cb(lv_event_t *e) {
+  lv_obj_t *chart = lv_event_get_current_target_obj(e);
+  history_view_t view =
+      (history_chart_get_view(chart) + 1) % HISTORY_VIEW_COUNT;
+  if (hist_speed)
+    history_chart_set_view(hist_speed, view);
+  if (hist_power)
+    history_chart_set_view(hist_power, view);
+  lv_label_set_text(hist_view, hist_view_names[view]);
+}
+
+static lv_obj_t *hist_chart(lv_obj_t *root, history_channel_t ch,
+                            const char *title, lv_coord_t y,
+                            lv_palette_t color) {
+  lv_obj_t *t = page_label_create(root);
+  lv_label_set_text(t, title);
+  lv_obj_set_style_text_font(t, dashboard_font(ASSET_FONT_TITLE), 0);
+  lv_obj_set_style_text_opa(t, LV_OPA_60, 0);
+  lv_obj_set_pos(t, 16, y);
+
+  lv_obj_t *chart = history_chart_create(root, ch, CHART_W, CHART_H);
+  if (chart == NULL)
+    return NULL;
+  lv_obj_set_pos(chart, 16, y + 18);
+  lv_obj_set_style_line_color(chart, lv_palette_main(color), 0);
+  lv_obj_add_flag(chart, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_event_cb(chart, hist_chart_clicked_cb, LV_EVENT_CLICKED, NULL);
+  return chart;
+}
+
+static void history_build(lv_obj_t *root) {
+  page_header(root, "HISTORY");
+
+  hist_view = page_label_create(root);
+  lv_label_set_text(hist_view, hist_view_names[HISTORY_VIEW_MINUTE]);
+  lv_obj_set_style_text_font(hist_view, dashboard_font(ASSET_FONT_TITLE), 0);
+  lv_obj_align(hist_view, LV_ALIGN_TOP_RIGHT, -16, 14);
+
+  hist_speed = hist_chart(root, HISTORY_SPEED, "SPEED km/h", 44,
+                          LV_PALETTE_BLUE);
+  hist_power = hist_chart(root, HISTORY_POWER, "POWER kW", 44 + CHART_H + 22,
+                          LV_PALETTE_AMBER);
+  if (hist_speed)
+    history_chart_set_range(hist_speed, 0, 800);
+  if (hist_power)
+    history_chart_set_range(hist_power, -2000, 6000);
+}
+
+static void history_update(void) {
+  if (hist_speed)
+    history_chart_refresh(hist_speed);
+  if (hist_power)
+    history_chart_refresh(hist_power);
+}
+
+static void history_release(void) {
+  hist_speed = hist_power = hist_view = NULL;
+}
+
+const page_def_t page_history = {
+    .name = "history",
+    .build = history_build,
+    .update = history_update,
+    .release = history_release,
+};
+
+/* ---- Settings ---- */
+
+static lv_obj_t *set_theme;
+static lv_obj_t *set_skin;
+static lv_obj_t *set_stats;
+
+static void settings_build(lv_obj_t *root) {
+  page_header(root, "SETTINGS");
+  set_theme = page_cell(root, 0, "THEME");
+  set_skin = page_cell(root, 1, "SKIN");
+
+  /* Page statistics, one line per page, then switch input latency, odometer
+   * journal wear, telemetry bus, controller link, BMS bus and wheel sensor
+   * counters */
+  set_stats = page_label_create(root);
+  lv_obj_set_style_text_font(set_stats, dashboard_font(ASSET_FONT_TITLE), 0);
+  lv_obj_set_style_text_opa(set_stats, LV_OPA_60, 0);
+  lv_obj_set_pos(set_stats, 16, TOP_Y + ROW_H - 16);
+}
+
+static void settings_update(void) {
+  const char *skin = asset_pack_active_name();
+  char buf[640];
+  size_t len = 0;
+  input_stats_t in;
+  journal_stats_t js;
+  telemetry_stats_t ts;
+  ctrl_stats_t cs;
+  bms_can_stats_t bs;
+  wheel_stats_t ws;
+  ridelog_stats_t rs;
+  uint32_t bus_published = 0, bus_dropped = 0;
+
+  lv_label_set_text(set_theme, dashboard_get_night_mode() ? "Night" : "Day");
+  lv_label_set_text(set_skin, skin ? skin : "Built-in");
+
+  len += snprintf(buf, sizeof(buf), "PAGE      BUILD  HEAP   SWITCH");
+  for (uint8_t i = 0; i < page_manager_page_count() && len < sizeof(buf);
+       i++) {
+    page_stats_t st;
+    page_manager_get_stats(i, &st);
+    len += snprintf(buf + len, sizeof(buf) - len, "\n%-9s %3ums %5dB %4ums",
+                    page_manager_page(i)->name, (unsigned)st.build_ms,
+                    (int)st.heap_bytes, (unsigned)st.switch_ms);
+  }
+  input_get_stats(&in);
+  if (len < sizeof(buf))
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "\nINPUT %u ev, latency %u.%ums avg %u.%ums max",
+                    (unsigned)in.events, (unsigned)(in.latency_avg_us / 1000),
+                    (unsigned)(in.latency_avg_us / 100 % 10),
+                    (unsigned)(in.latency_max_us / 1000),
+                    (unsigned)(in.latency_max_us / 100 % 10));
+  journal_get_stats(&js);
+  if (len < sizeof(buf))
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "\nJOURNAL %u rec, %u erase/sector/10k km, boot %u reads",
+                    (unsigned)js.records, (unsigned)js.erases_10k_km,
+                    (unsigned)js.boot_reads);
+  for (uint8_t i = 0; i < TELEMETRY_TOPIC_COUNT; i++) {
+    telemetry_get_stats((telemetry_topic_t)i, &ts);
+    bus_published += ts.published;
+    bus_dropped += ts.dropped;
+  }
+  if (len < sizeof(buf))
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "\nBUS %u published, %u dropped", (unsigned)bus_published,
+                    (unsigned)bus_dropped);
+  ctrl_get_stats(&cs);
+  if (cs.bytes > 0 && len < sizeof(buf))
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "\nCTRL %u frames, %u crc err, %u skipped, %u.%02u%% cpu",
+                    (unsigned)cs.frames, (unsigned)cs.crc_errors,
+                    (unsigned)cs.skipped, (unsigned)(cs.load_ppm / 10000),
+                    (unsigned)(cs.load_ppm / 100 % 100));
+  bms_can_get_stats(&bs);
+  if (bs.frames > 0 && len < sizeof(buf))
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "\nBMS %u frames, %u cell reports, %u bad DLC",
+                    (unsigned)bs.frames, (unsigned)bs.cell_reports,
+                    (unsigned)bs.bad_dlc);
+  wheel_get_stats(&ws);
+  if (ws.pulses > 0 && len < sizeof(buf))
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "\nWHEEL %u pulses, %s, latency %u.%ums max",
+                    (unsigned)ws.pulses, ws.count_mode ? "count" : "period",
+                    (unsigned)(ws.latency_max_us / 1000),
+                    (unsigned)(ws.latency_max_us / 100 % 10));
+  ridelog_get_stats(&rs);
+  if (rs.logs > 0 && len < sizeof(buf))
+    snprintf(buf + len, sizeof(buf) - len,
+             "\nLOG #%u%s, %u rec, %u KB, %u errors", (unsigned)rs.logs,
+             ridelog_active() ? " recording" : "", (unsigned)rs.records,
+             (unsigned)(rs.bytes / 1024),
+             (unsigned)(rs.write_errors + rs.full));
+  lv_label_set_text(set_stats, buf);
+}
+
+static void settings_release(void) {
+  set_theme = set_skin = set_stats = NULL;
+}
+
+const page_def_t page_settings = {
+    .name = "settings",
+    .build = settings_build,
+    .update = settings_update,
+    .release = settings_release,
+};
@@ -0,0 +1,16 @@
+/**
+ * pages.h
+ * Secondary dashboard pages, built on demand by the page manager
+ */
+#ifndef PAGES_H
+#define PAGES_H
+
+#include "page_manager.h"
+
+extern const page_def_t page_trip;
+extern const page_def_t page_battery;
+extern const page_def_t page_power;
+extern const page_def_t page_history;
+extern const page_def_t page_settings;
+
+#endif /*PAGES_H*/
@@ -0,0 +1,57 @@
+/**
+ * peak.c
+ * Sliding-window maximum / minimum of a sample stream
+ */
+
+#include "peak.h"
+
+#define RING_MASK (PEAK_RING - 1)
+
+void peak_window_init(peak_window_t *w, uint32_t window_ms, bool track_min) {
+  w->head = 0;
+  w->count = 0;
+  w->min = track_min;
+  w->slot_ms = window_ms / PEAK_SLOTS;
+  if (w->slot_ms == 0)
+    w->slot_ms = 1;
+}
+
+/* `a` is at least as extreme as `b` */
+static bool dominates(const peak_window_t *w, int32_t a, int32_t b) {
+  return w->min ? a <= b : a >= b;
+}
+
+static peak_entry_t *back(peak_window_t *w) {
+  return &w->q[(w->head + w->count - 1) & RING_MASK];
+}
+
+/* Drop entries from slots that left the window ending in `slot` */
+static void expire(peak_window_t *w, uint32_t slot) {
+  while (w->count > 0 && slot - w->q[w->head].slot >= PEAK_SLOTS) {
+    w->head = (w->head + 1) & RING_MASK;
+    w->count--;
+  }
+}
+
+void peak_window_push(peak_window_t *w, uint32_t t_ms, int32_t v) {
+  uint32_t slot = t_ms / w->slot_ms;
+
+  expire(w, slot);
+  while (w->count > 0 && dominates(w, v, back(w)->v))
+    w->count--;
+  /* An entry left in the same slot is more extreme: nothing to add */
+  if (w->count > 0 && back(w)->slot == slot)
+    return;
+
+  w->count++;
+  back(w)->slot = slot;
+  back(w)->v = v;
+}
+
+bool peak_window_get(peak_window_t *w, uint32_t t_ms, int32_t *out) {
+  expire(w, t_ms / w->slot_ms);
+  if (w->count == 0)
+    return false;
+  *out = w->q[w->head].v;
+  return true;
+}
@@ -0,0 +1,46 @@
+/**
+ * peak.h
+ * Sliding-window maximum / minimum of a sample stream
+ *
+ * Each window is a monotonic deque: a new sample removes every older entry
+ * it dominates from the back, and entries older than the window leave from
+ * the front, so the front is always the extreme of the window and a push is
+ * amortised O(1).
+ *
+ * To keep the memory fixed whatever the sample rate, time is divided into
+ * PEAK_SLOTS slots per window and samples within one slot are merged. The
+ * window edge is therefore exact to one slot (window / PEAK_SLOTS), and a
+ * window never holds more than PEAK_SLOTS + 1 entries.
+ *
+ * Several windows of different length may be fed the same samples; each
+ * costs sizeof(peak_window_t) and one push per sample.
+ */
+#ifndef PEAK_H
+#define PEAK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PEAK_SLOTS 63
+#define PEAK_RING 64 /* power of two > PEAK_SLOTS */
+
+typedef struct {
+  uint32_t slot;
+  int32_t v;
+} peak_entry_t;
+
+typedef struct {
+  peak_entry_t q[PEAK_RING];
+  uint8_t head;  /* front: the extreme */
+  uint8_t count;
+  bool min;      /* track the minimum instead of the maximum */
+  uint32_t slot_ms;
+} peak_window_t;
+
+void peak_window_init(peak_window_t *w, uint32_t window_ms, bool track_min);
+void peak_window_push(peak_window_t *w, uint32_t t_ms, int32_t v);
+
+/* Extreme of the samples in the window ending at `t_ms`; false if none */
+bool peak_window_get(peak_window_t *w, uint32_t t_ms, int32_t *out);
+
+#endif /*PEAK_H*/
@@ -0,0 +1,115 @@
+/**
+ * range.c
+ * Range estimate from remaining energy and a recency-weighted Wh/km model
+ *
+ * Consumption values are kept in mWh/km so the halving steps do not
+ * lose resolution.
+ */
+
+#include "range.h"
+#include "app_config.h"
+#include "consumption.h"
+#include "trip.h"
+#include <stdbool.h>
+
+#define BUCKET_UNITS ((uint64_t)CONFIG_DASH_RANGE_BUCKET_M * TRIP_UNITS_PER_M)
+#define EWMA_SHIFT 1              /* cell averages: weight 1/2 per bucket */
+#define MIN_MWHKM 2000            /* floor for downhill / regen buckets */
+
+typedef struct {
+  uint64_t dist;      /* current bucket, trip.h distance units */
+  int64_t energy_uj;  /* current bucket */
+  int32_t mwhkm;      /* weighted average, valid once trained */
+  bool trained;
+} range_cell_t;
+
+/* Upper band edges, 0.01 km/h */
+static const uint16_t band_edges[RANGE_SPEED_BANDS - 1] = {1000, 2000, 3000,
+                                                           4500};
+
+static range_cell_t cells[RANGE_GEARS][RANGE_SPEED_BANDS];
+static uint64_t step_dist; /* distance towards the next prediction step */
+static uint8_t gear_index;
+static int32_t predicted_mwhkm = CONFIG_DASH_RANGE_DEFAULT_WHKM * 1000;
+static int32_t shown_km = -1;
+
+static uint8_t speed_band(uint16_t speed_x100) {
+  uint8_t band = 0;
+  while (band < RANGE_SPEED_BANDS - 1 && speed_x100 >= band_edges[band])
+    band++;
+  return band;
+}
+
+/* Fold a full bucket into the cell's average */
+static void cell_close(range_cell_t *c) {
+  /* Wh/km = uJ * 100 / units, so mWh/km = uJ * 1e5 / units */
+  int64_t v = c->energy_uj * 100000 / (int64_t)c->dist;
+  if (v < MIN_MWHKM)
+    v = MIN_MWHKM;
+
+  if (c->trained) {
+    c->mwhkm += ((int32_t)v - c->mwhkm) / (1 << EWMA_SHIFT);
+  } else {
+    c->mwhkm = (int32_t)v;
+    c->trained = true;
+  }
+  c->dist = 0;
+  c->energy_uj = 0;
+}
+
+static void cell_add(range_cell_t *c, uint64_t dist, int64_t energy_uj) {
+  c->dist += dist;
+  c->energy_uj += energy_uj;
+  if (c->dist >= BUCKET_UNITS)
+    cell_close(c);
+}
+
+void range_set_default(int32_t mwhkm) {
+  if (mwhkm >= MIN_MWHKM)
+    predicted_mwhkm = mwhkm;
+}
+
+void range_set_gear(int gear) {
+  if (gear < 1)
+    gear = 1;
+  if (gear > RANGE_GEARS)
+    gear = RANGE_GEARS;
+  gear_index = (uint8_t)(gear - 1);
+}
+
+void range_sample(uint16_t speed_x100, int32_t power_w, uint32_t dt_us) {
+  uint64_t dist = (uint64_t)speed_x100 * dt_us;
+  int64_t energy = (int64_t)power_w * dt_us;
+  range_cell_t *c = &cells[gear_index][speed_band(speed_x100)];
+
+  cell_add(c, dist, energy);
+  step_dist += dist;
+  if (step_dist < BUCKET_UNITS)
+    return;
+  step_dist -= BUCKET_UNITS;
+
+  /* Once per bucket of any riding: move the prediction halfway to the model
+   * of the current conditions, or to the last kilometre's consumption */
+  int32_t target;
+  if (c->trained)
+    target = c->mwhkm;
+  else if (!consumption_mwhkm(CONSUMPTION_1KM, &target))
+    return;
+  if (target < MIN_MWHKM)
+    target = MIN_MWHKM;
+  predicted_mwhkm += (target - predicted_mwhkm) / 2;
+}
+
+int32_t range_whkm_x10(void) { return predicted_mwhkm / 100; }
+
+int32_t range_km(int32_t remaining_wh) {
+  if (remaining_wh <= 0)
+    return shown_km = 0;
+
+  int32_t km = (int32_t)((int64_t)remaining_wh * 1000 / predicted_mwhkm);
+  /* Falls show at once, rises only past the hysteresis (e.g. short regen) */
+  if (shown_km < 0 || km < shown_km ||
+      km >= shown_km + RANGE_RISE_HYSTERESIS_KM)
+    shown_km = km;
+  return shown_km;
+}
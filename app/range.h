@@ -0,0 +1,45 @@
+/**
+ * range.h
+ * Range estimate from remaining energy and a recency-weighted Wh/km model
+ *
+ * Consumption is learnt per gear and speed band: every cell collects energy
+ * over CONFIG_DASH_RANGE_BUCKET_M of its own distance and then folds the
+ * bucket's Wh/km into an exponentially weighted average (weight 1/2 per
+ * bucket).
+ *
+ * After each bucket's worth of riding, the prediction moves halfway towards
+ * the current cell's average (the rolling consumption over the last
+ * kilometre, see consumption.h, while that cell has no data),
+ * so a change of riding style shows within a few hundred metres while
+ * single fast or slow stretches do not. The displayed range additionally
+ * only rises when it gains at least RANGE_RISE_HYSTERESIS_KM.
+ *
+ * Per sample the cost is a table lookup and four additions; divisions only
+ * happen when a bucket closes and in range_km().
+ */
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <stdint.h>
+
+#define RANGE_GEARS 3
+#define RANGE_SPEED_BANDS 5
+#define RANGE_RISE_HYSTERESIS_KM 2
+
+/* Start from a consumption remembered from earlier rides (mWh/km) instead
+ * of CONFIG_DASH_RANGE_DEFAULT_WHKM */
+void range_set_default(int32_t mwhkm);
+
+/* Gear 1..RANGE_GEARS, as shown on the dashboard */
+void range_set_gear(int gear);
+
+/* Same samples as trip_sample(), after consumption_sample() */
+void range_sample(uint16_t speed_x100, int32_t power_w, uint32_t dt_us);
+
+/* Predicted consumption, 0.1 Wh/km */
+int32_t range_whkm_x10(void);
+
+/* Range for `remaining_wh`, with rise hysteresis for the display */
+int32_t range_km(int32_t remaining_wh);
+
+#endif /*RANGE_H*/
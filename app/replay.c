@@ -0,0 +1,76 @@
+/**
+ * replay.c
+ * Ride log replay: a recorded ride published on the telemetry bus
+ */
+
+#include "replay.h"
+#include "telemetry.h"
+#include <string.h>
+
+static ridelog_reader_t reader;
+static bool active;
+static bool started;
+static bool pending; /* reader.frame is decoded, not published yet */
+static uint32_t base_ms; /* lv_tick time of log time 0 */
+static replay_handler_t end_handler;
+static replay_stats_t stats;
+
+bool replay_start(ridelog_read_t read, void *ctx, uint32_t size,
+                  ridelog_seek_t by, uint32_t from) {
+  active = ridelog_open(&reader, read, ctx, size) &&
+           ridelog_seek(&reader, by, from);
+  started = false;
+  pending = false;
+  memset(&stats, 0, sizeof(stats));
+  return active;
+}
+
+void replay_set_handler(replay_handler_t handler) { end_handler = handler; }
+
+bool replay_active(void) { return active; }
+
+static void publish(uint32_t mask) {
+  uint32_t t = base_ms + reader.frame.t_ms;
+
+  mask &= ~(1u << TELEMETRY_SWITCHES);
+  for (uint8_t ch = 0; ch < TELEMETRY_TOPIC_COUNT && ch < reader.channels;
+       ch++) {
+    if (mask & 1u << ch) {
+      telemetry_publish((telemetry_topic_t)ch, reader.frame.value[ch], t);
+      stats.published++;
+    }
+  }
+  stats.records++;
+  stats.t_ms = reader.frame.t_ms;
+  stats.dist_m = (uint32_t)(reader.frame.dist / RIDELOG_UNITS_PER_M);
+}
+
+void replay_update(uint32_t now_ms) {
+  if (!active)
+    return;
+  if (!started) {
+    /* The seek left the state at the start position in the frame */
+    base_ms = now_ms - reader.frame.t_ms;
+    publish(reader.frame.valid);
+    started = true;
+  }
+
+  uint32_t elapsed = now_ms - base_ms;
+  for (;;) {
+    if (!pending) {
+      if (!ridelog_next(&reader)) {
+        active = false;
+        if (end_handler)
+          end_handler();
+        return;
+      }
+      pending = true;
+    }
+    if (reader.frame.t_ms > elapsed)
+      return;
+    publish(reader.frame.changed);
+    pending = false;
+  }
+}
+
+void replay_get_stats(replay_stats_t *out) { *out = stats; }
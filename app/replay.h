@@ -0,0 +1,49 @@
+/**
+ * replay.h
+ * Ride log replay: a recorded ride (ridelog.h) published on the telemetry
+ * bus in place of the live sources
+ *
+ * Every record is published at the time it was recorded, counted from the
+ * start of the replay, with the values the producers reported then; the
+ * consumers see the same interfaces and timestamps as on the bike. The
+ * caller's clock paces the replay, so running lv_tick faster (the
+ * simulator's time factor) replays faster without changing what the trip
+ * computer, the ride detection or the UI compute from it.
+ *
+ * While a replay is active, dashboard_create() starts none of the other
+ * sources, so every recorded topic has the replay as its single producer.
+ * The switches are not replayed: they reach the dashboard as input events,
+ * whose producer stays the switch input.
+ */
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "ridelog.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  uint32_t records;   /* replayed */
+  uint32_t published; /* samples */
+  uint32_t t_ms;      /* position in the log */
+  uint32_t dist_m;
+} replay_stats_t;
+
+/* Called once when the end of the log is reached */
+typedef void (*replay_handler_t)(void);
+
+/* Open the log and position it at `from` (ms or m, see ridelog_seek());
+ * call before dashboard_create(). False if it cannot be read. */
+bool replay_start(ridelog_read_t read, void *ctx, uint32_t size,
+                  ridelog_seek_t by, uint32_t from);
+
+void replay_set_handler(replay_handler_t handler);
+bool replay_active(void);
+
+/* Publish every record due at `now_ms` (lv_tick_get() time base); the
+ * first call publishes the state at the start position */
+void replay_update(uint32_t now_ms);
+
+void replay_get_stats(replay_stats_t *out);
+
+#endif /*REPLAY_H*/
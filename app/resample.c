@@ -0,0 +1,62 @@
+/**
+ * resample.c
+ * Timestamped sample history, read back at the display's frame times
+ */
+
+#include "resample.h"
+
+#define RING_MASK (RESAMPLE_DEPTH - 1)
+
+/* Index of the n-th newest sample, n < count */
+#define NEWEST(r, n) (((r)->head - 1u - (n)) & RING_MASK)
+
+void resample_init(resample_t *r, uint32_t delay_ms, bool hold) {
+  r->head = 0;
+  r->count = 0;
+  r->hold = hold;
+  r->delay_ms = delay_ms;
+}
+
+void resample_push(resample_t *r, uint32_t t_ms, int32_t v) {
+  if (r->count > 0) {
+    uint32_t last = r->t_ms[NEWEST(r, 0)];
+    if ((int32_t)(t_ms - last) < 0)
+      t_ms = last;
+  }
+  r->t_ms[r->head] = t_ms;
+  r->v[r->head] = v;
+  r->head = (r->head + 1) & RING_MASK;
+  if (r->count < RESAMPLE_DEPTH)
+    r->count++;
+}
+
+bool resample_get(const resample_t *r, uint32_t t_ms, int32_t *out) {
+  if (r->count == 0)
+    return false;
+
+  uint32_t at = t_ms - r->delay_ms;
+  uint8_t n;
+
+  /* Newest sample at or before `at` */
+  for (n = 0; n < r->count; n++)
+    if ((int32_t)(at - r->t_ms[NEWEST(r, n)]) >= 0)
+      break;
+  if (n == r->count) {
+    /* History does not reach back that far */
+    *out = r->v[NEWEST(r, r->count - 1)];
+    return true;
+  }
+
+  uint8_t a = NEWEST(r, n);
+  if (n == 0 || r->hold) {
+    *out = r->v[a];
+    return true;
+  }
+
+  /* a <= at < b, so the span is not zero */
+  uint8_t b = NEWEST(r, n - 1);
+  uint32_t span = r->t_ms[b] - r->t_ms[a];
+  int64_t dv = (int64_t)r->v[b] - r->v[a];
+  *out = r->v[a] + (int32_t)(dv * (int32_t)(at - r->t_ms[a]) / (int32_t)span);
+  return true;
+}
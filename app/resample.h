@@ -0,0 +1,50 @@
+/**
+ * resample.h
+ * Timestamped sample history, read back at the display's frame times
+ *
+ * Producers report at their own rate and with jitter (controller frames,
+ * BMS messages, wheel updates), while the display draws at its own frame
+ * period. Showing whatever sample came last makes the needle and the energy
+ * bar move in uneven steps whenever samples bunch up or a frame falls
+ * between two of them.
+ *
+ * A resampler keeps the last RESAMPLE_DEPTH samples of one channel with
+ * their producer timestamps and is read at a frame's render time minus a
+ * fixed delay. The value there lies between two known samples and is
+ * interpolated linearly (or held, for step-like channels), so every frame
+ * shows the reading of the same instant relative to its own time. The
+ * delay is the latency this adds: it should cover the channel's sample
+ * period plus its jitter. When the newest sample is older than the read
+ * time (a late or stopped producer) it is held, never extrapolated; when a
+ * fast producer pushes the whole history out of the delay, the oldest
+ * sample is used and the delay is effectively shorter.
+ *
+ * Fixed memory per channel, O(RESAMPLE_DEPTH) per read; not thread safe,
+ * push and read from the same task.
+ */
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RESAMPLE_DEPTH 8 /* power of two */
+
+typedef struct {
+  uint32_t t_ms[RESAMPLE_DEPTH];
+  int32_t v[RESAMPLE_DEPTH];
+  uint8_t head;  /* next slot to write */
+  uint8_t count;
+  bool hold;     /* step between samples instead of interpolating */
+  uint32_t delay_ms;
+} resample_t;
+
+void resample_init(resample_t *r, uint32_t delay_ms, bool hold);
+
+/* Timestamps must not go backwards; an older one is taken as the newest */
+void resample_push(resample_t *r, uint32_t t_ms, int32_t v);
+
+/* Value at `t_ms` - delay; false before the first sample */
+bool resample_get(const resample_t *r, uint32_t t_ms, int32_t *out);
+
+#endif /*RESAMPLE_H*/
@@ -0,0 +1,100 @@
+/**
+ * ride.c
+ * Ride segmentation state machine
+ */
+
+#include "ride.h"
+#include "app_config.h"
+#include <stddef.h>
+
+#define START_X100 (CONFIG_DASH_RIDE_START_KMH * 100)
+#define END_MS ((uint32_t)CONFIG_DASH_RIDE_END_S * 1000u)
+
+static ride_state_t state = RIDE_PARKED;
+static ride_state_t rest_state = RIDE_PARKED; /* to fall back to from STARTING */
+static uint32_t since_ms; /* start of the current dwell */
+static bool still_pending; /* riding, but standing still since still_ms */
+static uint32_t still_ms;
+static ride_handler_t handler;
+
+static const char *const state_names[RIDE_STATE_COUNT] = {
+    [RIDE_PARKED] = "parked",   [RIDE_STARTING] = "starting",
+    [RIDE_RIDING] = "riding",   [RIDE_STOPPED] = "stopped",
+    [RIDE_ENDED] = "ended",
+};
+
+static void enter(ride_state_t to, uint32_t now_ms) {
+  ride_state_t from = state;
+  state = to;
+  since_ms = now_ms;
+  if (handler)
+    handler(from, to);
+}
+
+void ride_set_handler(ride_handler_t h) { handler = h; }
+
+void ride_update(uint16_t speed_x100, int32_t power_w, uint32_t now_ms) {
+  bool moving = speed_x100 >= START_X100;
+  bool still = speed_x100 < RIDE_STILL_X100 && power_w < RIDE_IDLE_W;
+
+  switch (state) {
+  case RIDE_PARKED:
+  case RIDE_ENDED:
+    if (moving) {
+      rest_state = state;
+      enter(RIDE_STARTING, now_ms);
+    }
+    break;
+  case RIDE_STARTING:
+    if (!moving)
+      enter(rest_state, now_ms);
+    else if (now_ms - since_ms >= CONFIG_DASH_RIDE_START_MS)
+      enter(RIDE_RIDING, now_ms);
+    break;
+  case RIDE_RIDING:
+    if (!still) {
+      still_pending = false;
+    } else if (!still_pending) {
+      still_pending = true;
+      still_ms = now_ms;
+    } else if (now_ms - still_ms >= RIDE_STOP_MS) {
+      still_pending = false;
+      enter(RIDE_STOPPED, still_ms);
+    }
+    break;
+  case RIDE_STOPPED:
+    if (moving)
+      enter(RIDE_RIDING, now_ms);
+    else if (!still)
+      since_ms = now_ms; /* rolling or pedalling: not stopped yet */
+    else if (now_ms - since_ms >= END_MS)
+      enter(RIDE_ENDED, now_ms);
+    break;
+  default:
+    break;
+  }
+}
+
+void ride_activity(uint32_t now_ms) {
+  if (state == RIDE_STOPPED)
+    since_ms = now_ms;
+}
+
+ride_state_t ride_state(void) { return state; }
+
+const char *ride_state_name(ride_state_t s) {
+  return s < RIDE_STATE_COUNT ? state_names[s] : "?";
+}
+
+bool ride_parked(void) {
+  return state == RIDE_PARKED || state == RIDE_ENDED;
+}
+
+bool ride_opens_trip(ride_state_t from, ride_state_t to) {
+  return from == RIDE_STARTING && to == RIDE_RIDING;
+}
+
+bool ride_closes_trip(ride_state_t from, ride_state_t to) {
+  (void)from;
+  return to == RIDE_ENDED;
+}
@@ -0,0 +1,64 @@
+/**
+ * ride.h
+ * Ride segmentation: parked, starting, riding, stopped in a ride, ended
+ *
+ *   PARKED   --moving-------------------------> STARTING
+ *   STARTING --moving for START_MS------------> RIDING     (trip opens)
+ *   STARTING --not moving---------------------> PARKED / ENDED
+ *   RIDING   --standing still for STOP_MS-----> STOPPED
+ *   STOPPED  --moving-------------------------> RIDING
+ *   STOPPED  --still and no input for END_S---> ENDED      (trip closes)
+ *   ENDED    --moving-------------------------> STARTING
+ *
+ * "Moving" is at least CONFIG_DASH_RIDE_START_KMH; "standing still" is
+ * below RIDE_STILL_X100 with the motor idle. The dwells are
+ * CONFIG_DASH_RIDE_START_MS, RIDE_STOP_MS and CONFIG_DASH_RIDE_END_S.
+ * Switch input while stopped means the rider is still there (e.g.
+ * indicating at a junction) and restarts the end dwell.
+ *
+ * Fed from the trip sample timer; no LVGL dependency.
+ */
+#ifndef RIDE_H
+#define RIDE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RIDE_STILL_X100 100 /* 0.01 km/h */
+#define RIDE_IDLE_W 30      /* motor power still counted as idle */
+#define RIDE_STOP_MS 2000   /* passing through zero is not a stop */
+
+typedef enum {
+  RIDE_PARKED,
+  RIDE_STARTING,
+  RIDE_RIDING,
+  RIDE_STOPPED,
+  RIDE_ENDED,
+  RIDE_STATE_COUNT,
+} ride_state_t;
+
+/* Called on every state change, from ride_update() / ride_activity() */
+typedef void (*ride_handler_t)(ride_state_t from, ride_state_t to);
+
+void ride_set_handler(ride_handler_t handler);
+
+/* One sample: speed in 0.01 km/h, battery power in W, time in ms */
+void ride_update(uint16_t speed_x100, int32_t power_w, uint32_t now_ms);
+
+/* Rider input (switches) at `now_ms` */
+void ride_activity(uint32_t now_ms);
+
+ride_state_t ride_state(void);
+const char *ride_state_name(ride_state_t state);
+
+/* The bike is parked: no trip open and not about to start one */
+bool ride_parked(void);
+
+/* The transitions a handler opens and closes a trip on. STARTING is only
+ * entered from PARKED or ENDED, so every STARTING -> RIDING opens one, the
+ * first ride after power-up included: nothing of a trip survives a reboot
+ * but the odometer and lifetime figures. */
+bool ride_opens_trip(ride_state_t from, ride_state_t to);
+bool ride_closes_trip(ride_state_t from, ride_state_t to);
+
+#endif /*RIDE_H*/
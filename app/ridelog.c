@@ -0,0 +1,491 @@
+/**
+ * ridelog.c
+ * Binary ride log: compact record stream with a seekable footer index
+ */
+
+#include "ridelog.h"
+#include "app_config.h"
+#include "crc.h"
+#include "telemetry.h"
+#include <stddef.h>
+#include <string.h>
+
+#define LOG_MAGIC 0x4C524245u   /* "EBRL" */
+#define INDEX_MAGIC 0x49524245u /* "EBRI" */
+#define LENGTH_OPEN 0xFFFFFFFFu /* erased flash: patched on close */
+#define VARINT32_MAX 5
+#define VARINT64_MAX 10
+
+/* Header varint, t, distance, mask and every channel */
+#define RECORD_MAX                                                             \
+  (3 * VARINT32_MAX + VARINT64_MAX + RIDELOG_MAX_CHANNELS * VARINT32_MAX)
+
+typedef struct {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t channels;
+  uint16_t period_ms;
+  uint32_t start_time;
+  uint32_t length;
+} header_t;
+
+typedef struct {
+  uint32_t t_ms;
+  uint32_t dist_m;
+  uint32_t offset;
+} index_entry_t;
+
+typedef struct {
+  uint32_t index_offset;
+  uint32_t index_count;
+  uint32_t crc;
+  uint32_t magic;
+} trailer_t;
+
+#define FOOTER_MAX                                                             \
+  (RIDELOG_INDEX_MAX * sizeof(index_entry_t) + sizeof(trailer_t))
+
+/* The on-storage layout is fixed */
+typedef char header_size_check[sizeof(header_t) == RIDELOG_HEADER_SIZE ? 1
+                                                                       : -1];
+typedef char index_size_check[sizeof(index_entry_t) == 12 ? 1 : -1];
+typedef char trailer_size_check[sizeof(trailer_t) == 16 ? 1 : -1];
+typedef char channel_check[TELEMETRY_TOPIC_COUNT <= RIDELOG_MAX_CHANNELS ? 1
+                                                                         : -1];
+
+static uint8_t *put_varint(uint8_t *p, uint64_t v) {
+  while (v >= 0x80) {
+    *p++ = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  *p++ = (uint8_t)v;
+  return p;
+}
+
+/* Small differences of either sign to small codes; modulo 2^32 */
+static uint32_t zigzag(uint32_t d) { return d << 1 ^ (0u - (d >> 31)); }
+static uint32_t unzigzag(uint32_t z) { return z >> 1 ^ (0u - (z & 1)); }
+
+/* Distance over `dt_ms` at the recorded speed; the writer and the reader
+ * apply the same rule, so the reader's distance is exact */
+static uint64_t dist_step(uint32_t valid, const int32_t *value,
+                          uint32_t dt_ms) {
+  int32_t v = value[TELEMETRY_SPEED];
+  if (!(valid & 1u << TELEMETRY_SPEED) || v <= 0)
+    return 0;
+  return (uint64_t)(uint32_t)v * dt_ms;
+}
+
+/* Writer ---------------------------------------------------------------- */
+
+typedef enum {
+  LOG_IDLE,
+  LOG_WRITING,
+  LOG_FULL, /* open, no room for more records */
+} log_state_t;
+
+static bool enabled;
+static log_state_t state;
+static uint32_t capacity;
+static uint32_t written; /* handed to the platform */
+static uint8_t block[RIDELOG_BLOCK];
+static uint32_t block_len;
+
+static uint32_t start_ms;
+static uint32_t last_ms;     /* of the last record */
+static uint32_t last_key_ms;
+static uint64_t dist;
+static int32_t cur[TELEMETRY_TOPIC_COUNT]; /* newest samples */
+static uint32_t cur_valid;
+static int32_t last[TELEMETRY_TOPIC_COUNT]; /* as of the last record */
+static uint32_t valid;
+
+static index_entry_t index_ram[RIDELOG_INDEX_MAX];
+static uint32_t index_count;
+static ridelog_stats_t stats = {.index_stride = 1};
+
+bool ridelog_init(void) {
+  enabled = ridelog_platform_init();
+  if (enabled)
+    for (uint8_t t = 0; t < TELEMETRY_TOPIC_COUNT; t++)
+      telemetry_subscribe(TELEMETRY_SUB_LOGGER, (telemetry_topic_t)t,
+                          TELEMETRY_LATEST);
+  return enabled;
+}
+
+static bool block_flush(void) {
+  if (block_len == 0)
+    return true;
+  if (!ridelog_platform_write(written, block, block_len))
+    return false;
+  written += block_len;
+  block_len = 0;
+  return true;
+}
+
+static bool append(const void *data, uint32_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  while (len > 0) {
+    uint32_t n = RIDELOG_BLOCK - block_len;
+    if (n > len)
+      n = len;
+    memcpy(block + block_len, p, n);
+    block_len += n;
+    p += n;
+    len -= n;
+    if (block_len == RIDELOG_BLOCK && !block_flush())
+      return false;
+  }
+  return true;
+}
+
+/* A failed write leaves the log as it is: readable up to there, no index */
+static void give_up(void) {
+  stats.write_errors++;
+  state = LOG_IDLE;
+  ridelog_platform_close();
+}
+
+/* Keyframe number stats.keyframes at `offset`; every index_stride-th one is
+ * indexed, and a full index drops every other entry */
+static void index_add(uint32_t t_ms, uint32_t offset) {
+  if (stats.keyframes % stats.index_stride != 0)
+    return;
+  if (index_count == RIDELOG_INDEX_MAX) {
+    for (uint32_t i = 0; i < RIDELOG_INDEX_MAX / 2; i++)
+      index_ram[i] = index_ram[2 * i];
+    index_count = RIDELOG_INDEX_MAX / 2;
+    stats.index_stride *= 2;
+  }
+  index_ram[index_count].t_ms = t_ms;
+  index_ram[index_count].dist_m = (uint32_t)(dist / RIDELOG_UNITS_PER_M);
+  index_ram[index_count].offset = offset;
+  index_count++;
+}
+
+bool ridelog_start(uint32_t now_ms, uint32_t unix_time) {
+  if (!enabled)
+    return false;
+  ridelog_stop();
+
+  capacity = ridelog_platform_open();
+  if (capacity < RIDELOG_HEADER_SIZE + RECORD_MAX + FOOTER_MAX) {
+    if (capacity > 0)
+      ridelog_platform_close();
+    return false;
+  }
+
+  header_t h = {
+      .magic = LOG_MAGIC,
+      .version = RIDELOG_VERSION,
+      .channels = TELEMETRY_TOPIC_COUNT,
+      .period_ms = CONFIG_DASH_RIDELOG_PERIOD_MS,
+      .start_time = unix_time,
+      .length = LENGTH_OPEN,
+  };
+  written = 0;
+  block_len = 0;
+  index_count = 0;
+  valid = 0;
+  memset(last, 0, sizeof(last));
+  dist = 0;
+  start_ms = last_ms = last_key_ms = now_ms;
+  stats.logs++;
+  stats.records = 0;
+  stats.keyframes = 0;
+  stats.bytes = 0;
+  stats.index_stride = 1;
+  state = LOG_WRITING;
+  if (!append(&h, sizeof(h))) {
+    give_up();
+    return false;
+  }
+  return true;
+}
+
+void ridelog_update(uint32_t now_ms) {
+  telemetry_sample_t s;
+
+  if (!enabled)
+    return;
+  for (uint8_t t = 0; t < TELEMETRY_TOPIC_COUNT; t++) {
+    if (telemetry_poll(TELEMETRY_SUB_LOGGER, (telemetry_topic_t)t, &s)) {
+      cur[t] = s.value;
+      cur_valid |= 1u << t;
+    }
+  }
+  if (state != LOG_WRITING)
+    return;
+
+  uint32_t changed = 0;
+  for (uint8_t t = 0; t < TELEMETRY_TOPIC_COUNT; t++)
+    if ((cur_valid & 1u << t) && (!(valid & 1u << t) || cur[t] != last[t]))
+      changed |= 1u << t;
+  /* A keyframe that is due goes with the next record that has a change, so
+   * a stop where nothing changes writes nothing */
+  if (changed == 0)
+    return;
+  bool key = stats.keyframes == 0 ||
+             now_ms - last_key_ms >= CONFIG_DASH_RIDELOG_KEY_MS;
+
+  uint32_t dt = now_ms - last_ms;
+  uint8_t rec[RECORD_MAX], *p = rec;
+
+  dist += dist_step(valid, last, dt);
+  valid |= changed;
+  p = put_varint(p, (uint64_t)dt << 1 | (key ? 1 : 0));
+  if (key) {
+    p = put_varint(p, now_ms - start_ms);
+    p = put_varint(p, dist);
+    p = put_varint(p, valid);
+    for (uint8_t t = 0; t < TELEMETRY_TOPIC_COUNT; t++)
+      if (valid & 1u << t)
+        p = put_varint(p, zigzag((uint32_t)cur[t]));
+  } else {
+    p = put_varint(p, changed);
+    for (uint8_t t = 0; t < TELEMETRY_TOPIC_COUNT; t++)
+      if (changed & 1u << t)
+        p = put_varint(p, zigzag((uint32_t)cur[t] - (uint32_t)last[t]));
+  }
+
+  uint32_t len = (uint32_t)(p - rec);
+  uint32_t offset = written + block_len;
+  if (offset + len + FOOTER_MAX > capacity) {
+    stats.full++;
+    state = LOG_FULL;
+    return;
+  }
+  if (key) {
+    index_add(now_ms - start_ms, offset);
+    stats.keyframes++;
+    last_key_ms = now_ms;
+  }
+  if (!append(rec, len)) {
+    give_up();
+    return;
+  }
+  for (uint8_t t = 0; t < TELEMETRY_TOPIC_COUNT; t++)
+    if (changed & 1u << t)
+      last[t] = cur[t];
+  last_ms = now_ms;
+  stats.records++;
+  stats.bytes += len;
+}
+
+void ridelog_stop(void) {
+  if (state == LOG_IDLE)
+    return;
+
+  trailer_t tr = {
+      .index_offset = written + block_len,
+      .index_count = index_count,
+      .crc = crc32_update(0, index_ram, index_count * sizeof(index_entry_t)),
+      .magic = INDEX_MAGIC,
+  };
+  uint32_t length = tr.index_offset +
+                    index_count * (uint32_t)sizeof(index_entry_t) +
+                    (uint32_t)sizeof(tr);
+  if (!append(index_ram, index_count * (uint32_t)sizeof(index_entry_t)) ||
+      !append(&tr, sizeof(tr)) || !block_flush() ||
+      !ridelog_platform_write(offsetof(header_t, length), &length,
+                              sizeof(length))) {
+    give_up();
+    return;
+  }
+  state = LOG_IDLE;
+  ridelog_platform_close();
+}
+
+bool ridelog_active(void) { return state != LOG_IDLE; }
+
+void ridelog_get_stats(ridelog_stats_t *out) { *out = stats; }
+
+/* Reader ---------------------------------------------------------------- */
+
+static bool get_byte(ridelog_reader_t *r, uint32_t *pos, uint8_t *out) {
+  if (*pos >= r->end)
+    return false;
+  if (*pos < r->buf_addr || *pos - r->buf_addr >= r->buf_len) {
+    uint32_t n = r->end - *pos;
+    if (n > RIDELOG_BLOCK)
+      n = RIDELOG_BLOCK;
+    r->buf_len = 0;
+    if (!r->read(r->ctx, *pos, r->buf, n))
+      return false;
+    r->buf_addr = *pos;
+    r->buf_len = n;
+  }
+  *out = r->buf[*pos - r->buf_addr];
+  (*pos)++;
+  return true;
+}
+
+static bool get_varint(ridelog_reader_t *r, uint32_t *pos, uint8_t max,
+                       uint64_t *out) {
+  uint64_t v = 0;
+  uint8_t b;
+  for (uint8_t i = 0; i < max; i++) {
+    if (!get_byte(r, pos, &b))
+      return false;
+    v |= (uint64_t)(b & 0x7F) << (7 * i);
+    if (!(b & 0x80)) {
+      *out = v;
+      return true;
+    }
+  }
+  return false; /* too long: erased flash or damage */
+}
+
+static bool get_u32(ridelog_reader_t *r, uint32_t *pos, uint32_t *out) {
+  uint64_t v;
+  if (!get_varint(r, pos, VARINT32_MAX, &v) || v > UINT32_MAX)
+    return false;
+  *out = (uint32_t)v;
+  return true;
+}
+
+/* One record at `*pos` applied to `f` */
+static bool decode(ridelog_reader_t *r, uint32_t *pos, ridelog_frame_t *f) {
+  uint64_t head;
+  uint32_t mask, v;
+
+  if (!get_varint(r, pos, VARINT64_MAX, &head) || head >> 33 != 0)
+    return false;
+  uint32_t dt = (uint32_t)(head >> 1);
+  f->dist += dist_step(f->valid, f->value, dt);
+  f->t_ms += dt;
+
+  if (head & 1) {
+    if (!get_u32(r, pos, &f->t_ms) ||
+        !get_varint(r, pos, VARINT64_MAX, &f->dist) ||
+        !get_u32(r, pos, &mask))
+      return false;
+    f->valid = mask;
+  } else if (!get_u32(r, pos, &mask)) {
+    return false;
+  }
+  if (r->channels < RIDELOG_MAX_CHANNELS && mask >> r->channels != 0)
+    return false;
+
+  for (uint8_t ch = 0; ch < RIDELOG_MAX_CHANNELS; ch++) {
+    if (!(mask & 1u << ch)) {
+      if (head & 1)
+        f->value[ch] = 0;
+      continue;
+    }
+    if (!get_u32(r, pos, &v))
+      return false;
+    if (head & 1)
+      f->value[ch] = (int32_t)unzigzag(v);
+    else
+      f->value[ch] = (int32_t)((uint32_t)f->value[ch] + unzigzag(v));
+  }
+  f->valid |= mask;
+  f->changed = mask;
+  return true;
+}
+
+static bool index_valid(ridelog_reader_t *r, const trailer_t *t) {
+  uint32_t crc = 0;
+  uint32_t left = t->index_count * (uint32_t)sizeof(index_entry_t);
+  uint32_t addr = t->index_offset;
+
+  while (left > 0) {
+    uint32_t n = left < RIDELOG_BLOCK ? left : RIDELOG_BLOCK;
+    if (!r->read(r->ctx, addr, r->buf, n))
+      return false;
+    crc = crc32_update(crc, r->buf, n);
+    addr += n;
+    left -= n;
+  }
+  return crc == t->crc;
+}
+
+bool ridelog_open(ridelog_reader_t *r, ridelog_read_t read, void *ctx,
+                  uint32_t size) {
+  header_t h;
+  trailer_t t;
+
+  memset(r, 0, offsetof(ridelog_reader_t, buf));
+  r->read = read;
+  r->ctx = ctx;
+  if (size < sizeof(h) || !read(ctx, 0, &h, sizeof(h)) ||
+      h.magic != LOG_MAGIC || h.version != RIDELOG_VERSION ||
+      h.channels == 0 || h.channels > RIDELOG_MAX_CHANNELS)
+    return false;
+
+  r->channels = h.channels;
+  r->period_ms = h.period_ms;
+  r->start_time = h.start_time;
+  r->end = size;
+  r->pos = RIDELOG_HEADER_SIZE;
+
+  /* Closed: the trailer bounds the records; with an intact index seeks
+   * need not decode from the start */
+  if (h.length == LENGTH_OPEN || h.length > size ||
+      h.length < RIDELOG_HEADER_SIZE + sizeof(t) ||
+      !read(ctx, h.length - sizeof(t), &t, sizeof(t)) ||
+      t.magic != INDEX_MAGIC || t.index_offset < RIDELOG_HEADER_SIZE ||
+      t.index_count > RIDELOG_INDEX_MAX ||
+      t.index_offset + t.index_count * sizeof(index_entry_t) + sizeof(t) !=
+          h.length)
+    return true;
+  r->end = t.index_offset;
+  if (index_valid(r, &t)) {
+    r->index_offset = t.index_offset;
+    r->index_count = t.index_count;
+  }
+  return true;
+}
+
+bool ridelog_next(ridelog_reader_t *r) {
+  ridelog_frame_t f = r->frame;
+  uint32_t pos = r->pos;
+
+  if (!decode(r, &pos, &f))
+    return false;
+  r->frame = f;
+  r->pos = pos;
+  return true;
+}
+
+static uint32_t frame_key(const ridelog_frame_t *f, ridelog_seek_t by) {
+  return by == RIDELOG_BY_TIME ? f->t_ms
+                               : (uint32_t)(f->dist / RIDELOG_UNITS_PER_M);
+}
+
+bool ridelog_seek(ridelog_reader_t *r, ridelog_seek_t by, uint32_t key) {
+  index_entry_t e;
+  uint32_t lo = 0, hi = r->index_count; /* first entry past `key` */
+
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (!r->read(r->ctx, r->index_offset + mid * sizeof(e), &e, sizeof(e)))
+      return false;
+    if ((by == RIDELOG_BY_TIME ? e.t_ms : e.dist_m) <= key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  r->pos = RIDELOG_HEADER_SIZE;
+  if (lo > 0) {
+    if (!r->read(r->ctx, r->index_offset + (lo - 1) * sizeof(e), &e,
+                 sizeof(e)))
+      return false;
+    r->pos = e.offset;
+  }
+
+  /* From the keyframe up to the last record at or before `key`; the first
+   * one is taken even if it is later */
+  memset(&r->frame, 0, sizeof(r->frame));
+  if (!ridelog_next(r))
+    return false;
+  for (;;) {
+    ridelog_frame_t f = r->frame;
+    uint32_t pos = r->pos;
+    if (!decode(r, &pos, &f) || frame_key(&f, by) > key)
+      return true;
+    r->frame = f;
+    r->pos = pos;
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ * ridelog.h
+ * Binary ride log: compact record stream with a seekable footer index
+ *
+ * The logger snapshots every telemetry topic each time ridelog_update() is
+ * called, normally every CONFIG_DASH_RIDELOG_PERIOD_MS, and appends one
+ * record per snapshot in which something changed. Channel n is topic n of
+ * TELEMETRY_TOPICS; new topics are only ever added at the end there, so
+ * older logs keep their meaning. Layout, fixed fields little endian:
+ *
+ *   header   16 bytes: magic "EBRL", version, channel count, period ms,
+ *            Unix start time, log length (0xFFFFFFFF until closed)
+ *   records  keyframes and deltas, see below
+ *   index    12 bytes per entry: t ms, distance m, offset of a keyframe
+ *   trailer  16 bytes: index offset, entry count, CRC-32 of the entries,
+ *            magic "EBRI"
+ *
+ * Every record starts with the varint (dt << 1 | key): the milliseconds
+ * since the previous record and whether it is a keyframe.
+ *
+ *   delta     varint mask of the channels that changed, then for each of
+ *             them the zigzag varint of the difference to its last value
+ *   keyframe  varint t ms since the start, varint distance in
+ *             RIDELOG_UNITS_PER_M, varint mask of the channels reported so
+ *             far, then each of their values as a zigzag varint
+ *
+ * A record where nothing changed is not written; the next record's dt
+ * covers the gap. With speed, power and the pack readings changing at
+ * 50 Hz a record is about 7 bytes, 1.3 MB per hour, and a stop where no
+ * reading changes costs nothing. The distance is the speed integrated over
+ * the record times, which the reader repeats exactly.
+ *
+ * The first record at least CONFIG_DASH_RIDELOG_KEY_MS after the previous
+ * keyframe is written as a keyframe, so a stop gets none either, and
+ * decoding can start at any of them. The index keeps up to
+ * RIDELOG_INDEX_MAX of them in RAM and is written when the log is closed;
+ * on a long ride every other entry is dropped when it is full, so the
+ * memory is fixed and the index thins out evenly. Time and distance both
+ * only grow, so a seek is a binary search over the index (O(log n) reads of
+ * 12 bytes) and a decode from that keyframe forward, over at most
+ * CONFIG_DASH_RIDELOG_KEY_MS of records. A log cut short by a power loss
+ * has no index and is read from the start.
+ *
+ * Writing is buffered in blocks of RIDELOG_BLOCK bytes. The writer is not
+ * thread safe (use from the LVGL task); readers need no global state and
+ * run on the host as well.
+ */
+#ifndef RIDELOG_H
+#define RIDELOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RIDELOG_VERSION 1
+#define RIDELOG_BLOCK 512
+#define RIDELOG_INDEX_MAX 1024
+#define RIDELOG_MAX_CHANNELS 32
+#define RIDELOG_UNITS_PER_M 360000 /* 0.01 km/h x ms */
+#define RIDELOG_HEADER_SIZE 16
+
+typedef struct {
+  uint32_t logs;         /* started since boot */
+  uint32_t records;      /* current log */
+  uint32_t keyframes;    /* current log */
+  uint32_t bytes;        /* current log, records only */
+  uint32_t index_stride; /* keyframes per index entry */
+  uint32_t write_errors; /* logs given up on a failed write */
+  uint32_t full;         /* logs that reached the end of the storage */
+} ridelog_stats_t;
+
+/* Start-up, before the producers run: subscribes the logger to every
+ * topic when there is somewhere to write to; false otherwise */
+bool ridelog_init(void);
+
+/* Begin a new log at `now_ms` (lv_tick_get() time base); `unix_time` is
+ * stored in the header, 0 if the clock is not set. Closes the current log
+ * first. False when no log could be started. */
+bool ridelog_start(uint32_t now_ms, uint32_t unix_time);
+
+/* Snapshot the topics and append a record if something changed */
+void ridelog_update(uint32_t now_ms);
+
+/* Write the index and close the log */
+void ridelog_stop(void);
+
+bool ridelog_active(void);
+void ridelog_get_stats(ridelog_stats_t *out);
+
+/* Reading --------------------------------------------------------------- */
+
+/* Read `len` bytes at `addr` of the log; false past the end or on error */
+typedef bool (*ridelog_read_t)(void *ctx, uint32_t addr, void *buf,
+                               uint32_t len);
+
+/* State after a record: every channel's last value */
+typedef struct {
+  uint32_t t_ms;    /* since the start of the log */
+  uint64_t dist;    /* RIDELOG_UNITS_PER_M */
+  uint32_t valid;   /* bit per channel: reported at least once */
+  uint32_t changed; /* bit per channel: new value in this record */
+  int32_t value[RIDELOG_MAX_CHANNELS];
+} ridelog_frame_t;
+
+typedef enum {
+  RIDELOG_BY_TIME, /* ms since the start */
+  RIDELOG_BY_DIST, /* m */
+} ridelog_seek_t;
+
+typedef struct {
+  ridelog_read_t read;
+  void *ctx;
+  uint8_t channels;
+  uint16_t period_ms;
+  uint32_t start_time;
+  uint32_t end;         /* of the records */
+  uint32_t index_offset;
+  uint32_t index_count; /* 0: not closed, reads are sequential */
+  uint32_t pos;         /* of the next record */
+  ridelog_frame_t frame;
+  uint32_t buf_addr;
+  uint32_t buf_len;
+  uint8_t buf[RIDELOG_BLOCK];
+} ridelog_reader_t;
+
+/* Open a log of `size` bytes (the file, or the storage area it was
+ * written to); false if it is not a ride log */
+bool ridelog_open(ridelog_reader_t *r, ridelog_read_t read, void *ctx,
+                  uint32_t size);
+
+/* Decode the next record into r->frame; false at the end of the log or
+ * where it is damaged */
+bool ridelog_next(ridelog_reader_t *r);
+
+/* Position so that r->frame is the state at `key` (the last record at or
+ * before it) and ridelog_next() continues from there */
+bool ridelog_seek(ridelog_reader_t *r, ridelog_seek_t by, uint32_t key);
+
+/* Implemented per platform (main/ridelog_esp.c,
+ * simulator/src/hal/ridelog_host.c) */
+bool ridelog_platform_init(void);     /* true when logs can be written */
+uint32_t ridelog_platform_open(void); /* new log; capacity, 0 on failure */
+bool ridelog_platform_write(uint32_t addr, const void *buf, uint32_t len);
+void ridelog_platform_close(void);
+
+#endif /*RIDELOG_H*/
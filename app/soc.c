@@ -0,0 +1,157 @@
+/**
+ * soc.c
+ * Battery state of charge: coulomb counting with OCV correction
+ *
+ * The OCV table is a const array (flash) of a typical NMC cell at room
+ * temperature; lookups interpolate between the neighbouring points and only
+ * run at start-up and after a rest, never per sample.
+ */
+
+#include "soc.h"
+#include "app_config.h"
+
+#define NC_PER_MAH 3600000000ll /* mA x us per mAh */
+#define RATED_NC ((int64_t)CONFIG_DASH_BATT_CAPACITY_MAH * NC_PER_MAH)
+#define NOMINAL_MV (CONFIG_DASH_BATT_CELLS_S * 3600)
+#define REST_US ((uint64_t)CONFIG_DASH_SOC_REST_S * 1000000u)
+#define FADE_MIN_DSOC_X10 400 /* rest points this far apart measure capacity */
+
+typedef struct {
+  int16_t mv;
+  int16_t soc_x10;
+} ocv_point_t;
+
+/* Ascending in both columns */
+static const ocv_point_t ocv_table[] = {
+    {3000, 0},   {3300, 50},  {3450, 100}, {3550, 200},
+    {3620, 300}, {3680, 400}, {3740, 500}, {3810, 600},
+    {3890, 700}, {3980, 800}, {4080, 900}, {4200, 1000},
+};
+#define OCV_POINTS (sizeof(ocv_table) / sizeof(ocv_table[0]))
+
+static bool started;
+static int64_t capacity_nc = RATED_NC;
+static int64_t charge_nc;      /* remaining */
+static uint64_t discharged_nc; /* lifetime, for the cycle count */
+
+/* Reported by the BMS, overriding the estimate */
+static bool reported;
+static int32_t reported_soc_x10;
+static int32_t reported_mah;
+
+static uint64_t rest_us;
+static bool rest_corrected; /* correction done during the current rest */
+
+/* Last rest point and the net charge drawn since */
+static bool anchor_valid;
+static int32_t anchor_soc_x10;
+static int64_t anchor_drawn_nc;
+
+int32_t soc_from_cell_ocv(int32_t cell_mv) {
+  if (cell_mv <= ocv_table[0].mv)
+    return ocv_table[0].soc_x10;
+  for (uint8_t i = 1; i < OCV_POINTS; i++) {
+    const ocv_point_t *a = &ocv_table[i - 1];
+    const ocv_point_t *b = &ocv_table[i];
+    if (cell_mv < b->mv)
+      return a->soc_x10 +
+             (cell_mv - a->mv) * (b->soc_x10 - a->soc_x10) / (b->mv - a->mv);
+  }
+  return ocv_table[OCV_POINTS - 1].soc_x10;
+}
+
+int32_t soc_cell_ocv(int32_t soc_x10) {
+  if (soc_x10 <= ocv_table[0].soc_x10)
+    return ocv_table[0].mv;
+  for (uint8_t i = 1; i < OCV_POINTS; i++) {
+    const ocv_point_t *a = &ocv_table[i - 1];
+    const ocv_point_t *b = &ocv_table[i];
+    if (soc_x10 < b->soc_x10)
+      return a->mv + (soc_x10 - a->soc_x10) * (b->mv - a->mv) /
+                         (b->soc_x10 - a->soc_x10);
+  }
+  return ocv_table[OCV_POINTS - 1].mv;
+}
+
+static void soc_set(int32_t soc_x10) {
+  charge_nc = capacity_nc * soc_x10 / 1000;
+}
+
+/* At rest the terminal voltage is the OCV */
+static void rest_correct(int32_t pack_mv) {
+  int32_t ocv_soc = soc_from_cell_ocv(pack_mv / CONFIG_DASH_BATT_CELLS_S);
+
+  if (anchor_valid) {
+    int32_t dsoc = anchor_soc_x10 - ocv_soc;
+    /* Same sign: the charge counted explains the SOC change */
+    if ((dsoc >= FADE_MIN_DSOC_X10 && anchor_drawn_nc > 0) ||
+        (dsoc <= -FADE_MIN_DSOC_X10 && anchor_drawn_nc < 0)) {
+      int64_t measured = anchor_drawn_nc * 1000 / dsoc;
+      if (measured < RATED_NC / 2)
+        measured = RATED_NC / 2;
+      if (measured > RATED_NC * 11 / 10)
+        measured = RATED_NC * 11 / 10;
+      capacity_nc += (measured - capacity_nc) / 4;
+    }
+  }
+
+  anchor_valid = true;
+  anchor_soc_x10 = ocv_soc;
+  anchor_drawn_nc = 0;
+  soc_set(ocv_soc);
+}
+
+void soc_sample(int32_t pack_ma, int32_t pack_mv, uint32_t dt_us) {
+  if (!started) {
+    started = true;
+    soc_set(soc_from_cell_ocv(pack_mv / CONFIG_DASH_BATT_CELLS_S));
+  }
+
+  int64_t q = (int64_t)pack_ma * dt_us;
+  charge_nc -= q;
+  if (charge_nc < 0)
+    charge_nc = 0;
+  if (charge_nc > capacity_nc)
+    charge_nc = capacity_nc;
+  anchor_drawn_nc += q;
+  if (q > 0)
+    discharged_nc += (uint64_t)q;
+
+  if (pack_ma < CONFIG_DASH_SOC_REST_MA && pack_ma > -CONFIG_DASH_SOC_REST_MA) {
+    rest_us += dt_us;
+    if (!rest_corrected && rest_us >= REST_US) {
+      rest_corrected = true;
+      rest_correct(pack_mv);
+    }
+  } else {
+    rest_us = 0;
+    rest_corrected = false;
+  }
+}
+
+void soc_report(int32_t soc_x10, int32_t capacity_mah) {
+  reported = true;
+  reported_soc_x10 = soc_x10 < 0 ? 0 : soc_x10 > 1000 ? 1000 : soc_x10;
+  reported_mah = capacity_mah;
+}
+
+void soc_get(soc_state_t *out) {
+  out->soc_x10 = (int32_t)(charge_nc * 1000 / capacity_nc);
+  out->capacity_mah = (int32_t)(capacity_nc / NC_PER_MAH);
+  out->remaining_mah = (int32_t)(charge_nc / NC_PER_MAH);
+  out->health_pct = (int32_t)(capacity_nc * 100 / RATED_NC);
+  if (reported) {
+    out->soc_x10 = reported_soc_x10;
+    if (reported_mah > 0) {
+      out->capacity_mah = reported_mah;
+      out->health_pct = reported_mah * 100 / CONFIG_DASH_BATT_CAPACITY_MAH;
+    }
+    out->remaining_mah = out->capacity_mah * out->soc_x10 / 1000;
+  }
+  out->remaining_wh =
+      (int32_t)((int64_t)out->remaining_mah * NOMINAL_MV / 1000000);
+  out->capacity_wh =
+      (int32_t)((int64_t)out->capacity_mah * NOMINAL_MV / 1000000);
+  out->cycles_x10 = (int32_t)(discharged_nc * 10 / (uint64_t)RATED_NC);
+  out->rested = rest_corrected;
+}
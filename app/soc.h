@@ -0,0 +1,52 @@
+/**
+ * soc.h
+ * Battery state of charge: coulomb counting with open-circuit voltage
+ * correction and capacity fade tracking
+ *
+ * Pack current is integrated in integer nC (mA x us) at the telemetry rate.
+ * Once the pack has rested (|current| below CONFIG_DASH_SOC_REST_MA for
+ * CONFIG_DASH_SOC_REST_S) its voltage is close to the open-circuit voltage,
+ * and the SOC read from the OCV table replaces the counted one, removing
+ * the drift of the current sensor.
+ *
+ * Two such rest points at least 40% SOC apart, together with the charge
+ * counted between them, measure the usable capacity. That measurement is
+ * averaged into the learnt capacity, so fade shows up over the cycles.
+ *
+ * A BMS that reports its own SOC and capacity (soc_report()) is trusted
+ * over the estimate; the coulomb count keeps running for the cycle count.
+ *
+ * No allocation; call from the task that owns the telemetry.
+ */
+#ifndef SOC_H
+#define SOC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  int32_t soc_x10;       /* 0.1 % */
+  int32_t capacity_mah;  /* learnt usable capacity */
+  int32_t remaining_mah;
+  int32_t remaining_wh;  /* at the nominal pack voltage */
+  int32_t capacity_wh;
+  int32_t health_pct;    /* learnt vs. rated capacity */
+  int32_t cycles_x10;    /* equivalent full discharge cycles */
+  bool rested;           /* resting, SOC taken from the OCV */
+} soc_state_t;
+
+/* One sample: pack current (> 0: discharging), pack voltage, time since the
+ * previous sample. The first sample seeds the SOC from the voltage. */
+void soc_sample(int32_t pack_ma, int32_t pack_mv, uint32_t dt_us);
+
+/* SOC and full charge capacity as reported by the BMS; capacity_mah <= 0
+ * keeps the learnt capacity */
+void soc_report(int32_t soc_x10, int32_t capacity_mah);
+
+void soc_get(soc_state_t *out);
+
+/* OCV table of one cell, linearly interpolated in both directions */
+int32_t soc_from_cell_ocv(int32_t cell_mv);
+int32_t soc_cell_ocv(int32_t soc_x10);
+
+#endif /*SOC_H*/
@@ -0,0 +1,47 @@
+/**
+ * spsc.c
+ * Lock-free single-producer / single-consumer ring of fixed-size records
+ *
+ * The record is copied before the index is published (release store), and
+ * the other side reads the index with an acquire load before touching the
+ * record, which is all the ordering an SPSC ring needs on Xtensa and on the
+ * host.
+ */
+
+#include "spsc.h"
+#include <string.h>
+
+bool spsc_init(spsc_t *q, void *storage, uint16_t elem_size,
+               uint32_t capacity) {
+  if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+    return false;
+  q->buf = storage;
+  q->elem_size = elem_size;
+  q->mask = capacity - 1;
+  q->head = 0;
+  q->tail = 0;
+  return true;
+}
+
+bool spsc_push(spsc_t *q, const void *elem) {
+  uint32_t head = q->head;
+  uint32_t next = (head + 1) & q->mask;
+  if (next == __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE))
+    return false;
+  memcpy(q->buf + (size_t)head * q->elem_size, elem, q->elem_size);
+  __atomic_store_n(&q->head, next, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool spsc_pop(spsc_t *q, void *elem) {
+  uint32_t tail = q->tail;
+  if (tail == __atomic_load_n(&q->head, __ATOMIC_ACQUIRE))
+    return false;
+  memcpy(elem, q->buf + (size_t)tail * q->elem_size, q->elem_size);
+  __atomic_store_n(&q->tail, (tail + 1) & q->mask, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool spsc_empty(const spsc_t *q) {
+  return q->tail == __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+}
@@ -0,0 +1,35 @@
+/**
+ * spsc.h
+ * Lock-free single-producer / single-consumer ring of fixed-size records
+ *
+ * The producer only writes `head`, the consumer only writes `tail`, so one
+ * side may be an interrupt handler or another thread without any lock or
+ * critical section. Capacity is a power of two; one slot is never used so
+ * that a full ring can be told apart from an empty one.
+ */
+#ifndef SPSC_H
+#define SPSC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  uint8_t *buf;
+  uint16_t elem_size;
+  uint32_t mask; /* capacity - 1 */
+  uint32_t head; /* next slot to write, producer side */
+  uint32_t tail; /* next slot to read, consumer side */
+} spsc_t;
+
+/* `storage` holds `capacity` (a power of two) records of `elem_size` bytes */
+bool spsc_init(spsc_t *q, void *storage, uint16_t elem_size,
+               uint32_t capacity);
+
+/* Producer side; false when the ring is full (the record is dropped) */
+bool spsc_push(spsc_t *q, const void *elem);
+
+/* Consumer side; false when the ring is empty */
+bool spsc_pop(spsc_t *q, void *elem);
+bool spsc_empty(const spsc_t *q);
+
+#endif /*SPSC_H*/
@@ -0,0 +1,140 @@
+/**
+ * telemetry.c
+ * Telemetry bus with per-subscriber SPSC channels
+ *
+ * Latest-wins slots are a sequence lock: the producer makes the sequence
+ * odd, writes the sample and makes it even again; the consumer copies the
+ * sample between two reads of the sequence and retries if it changed. A
+ * write in progress (odd sequence) reads as "nothing new yet" rather than
+ * being waited for, so a consumer that preempted the producer cannot spin.
+ *
+ * Counters have a single writer each: `published`, `dropped` and
+ * `overwritten` belong to the producer, `delivered` to the channel's
+ * consumer.
+ */
+
+#include "telemetry.h"
+#include "app_config.h"
+#include "spsc.h"
+
+#define QUEUE_LEN CONFIG_DASH_TELEMETRY_QUEUE_LEN
+
+#if QUEUE_LEN < 2 || (QUEUE_LEN & (QUEUE_LEN - 1)) != 0
+#error "CONFIG_DASH_TELEMETRY_QUEUE_LEN must be a power of two"
+#endif
+
+typedef struct {
+  telemetry_policy_t policy;
+  spsc_t queue;
+  telemetry_sample_t storage[QUEUE_LEN];
+  uint32_t seq;      /* latest-wins: written by the producer */
+  uint32_t read_seq; /* latest-wins: last sequence polled, by the consumer */
+  telemetry_sample_t latest;
+  uint32_t delivered;
+  uint32_t dropped;
+  uint32_t overwritten;
+} channel_t;
+
+static channel_t channels[TELEMETRY_TOPIC_COUNT][TELEMETRY_SUB_COUNT];
+static uint32_t published[TELEMETRY_TOPIC_COUNT];
+
+#define TELEMETRY_TOPIC_NAME(id, name, unit) name,
+static const char *const topic_names[TELEMETRY_TOPIC_COUNT] = {
+    TELEMETRY_TOPICS(TELEMETRY_TOPIC_NAME)};
+#undef TELEMETRY_TOPIC_NAME
+
+#define TELEMETRY_TOPIC_UNIT(id, name, unit) unit,
+static const char *const topic_units[TELEMETRY_TOPIC_COUNT] = {
+    TELEMETRY_TOPICS(TELEMETRY_TOPIC_UNIT)};
+#undef TELEMETRY_TOPIC_UNIT
+
+void telemetry_subscribe(telemetry_sub_t sub, telemetry_topic_t topic,
+                         telemetry_policy_t policy) {
+  if (sub >= TELEMETRY_SUB_COUNT || topic >= TELEMETRY_TOPIC_COUNT)
+    return;
+  channel_t *c = &channels[topic][sub];
+  c->policy = policy;
+  spsc_init(&c->queue, c->storage, sizeof(telemetry_sample_t), QUEUE_LEN);
+  c->seq = 0;
+  c->read_seq = 0;
+}
+
+static void latest_write(channel_t *c, const telemetry_sample_t *s) {
+  uint32_t seq = c->seq;
+  if (seq != __atomic_load_n(&c->read_seq, __ATOMIC_RELAXED))
+    c->overwritten++; /* the previous sample was never polled */
+  __atomic_store_n(&c->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  c->latest = *s;
+  __atomic_store_n(&c->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+static bool latest_read(channel_t *c, telemetry_sample_t *out) {
+  uint32_t before, after;
+  do {
+    before = __atomic_load_n(&c->seq, __ATOMIC_ACQUIRE);
+    if (before == c->read_seq || (before & 1u) != 0)
+      return false;
+    *out = c->latest;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    after = __atomic_load_n(&c->seq, __ATOMIC_RELAXED);
+  } while (before != after);
+  __atomic_store_n(&c->read_seq, before, __ATOMIC_RELAXED);
+  return true;
+}
+
+void telemetry_publish(telemetry_topic_t topic, int32_t value, uint32_t t_ms) {
+  if (topic >= TELEMETRY_TOPIC_COUNT)
+    return;
+  telemetry_sample_t s = {t_ms, value};
+
+  published[topic]++;
+  for (uint8_t i = 0; i < TELEMETRY_SUB_COUNT; i++) {
+    channel_t *c = &channels[topic][i];
+    if (c->policy == TELEMETRY_QUEUE) {
+      if (!spsc_push(&c->queue, &s))
+        c->dropped++;
+    } else if (c->policy == TELEMETRY_LATEST) {
+      latest_write(c, &s);
+    }
+  }
+}
+
+bool telemetry_poll(telemetry_sub_t sub, telemetry_topic_t topic,
+                    telemetry_sample_t *out) {
+  if (sub >= TELEMETRY_SUB_COUNT || topic >= TELEMETRY_TOPIC_COUNT)
+    return false;
+  channel_t *c = &channels[topic][sub];
+  bool ok = false;
+
+  if (c->policy == TELEMETRY_QUEUE)
+    ok = spsc_pop(&c->queue, out);
+  else if (c->policy == TELEMETRY_LATEST)
+    ok = latest_read(c, out);
+  if (ok)
+    c->delivered++;
+  return ok;
+}
+
+void telemetry_get_stats(telemetry_topic_t topic, telemetry_stats_t *out) {
+  out->published = 0;
+  out->delivered = 0;
+  out->dropped = 0;
+  out->overwritten = 0;
+  if (topic >= TELEMETRY_TOPIC_COUNT)
+    return;
+  out->published = published[topic];
+  for (uint8_t i = 0; i < TELEMETRY_SUB_COUNT; i++) {
+    out->delivered += channels[topic][i].delivered;
+    out->dropped += channels[topic][i].dropped;
+    out->overwritten += channels[topic][i].overwritten;
+  }
+}
+
+const char *telemetry_topic_name(telemetry_topic_t topic) {
+  return topic < TELEMETRY_TOPIC_COUNT ? topic_names[topic] : "?";
+}
+
+const char *telemetry_topic_unit(telemetry_topic_t topic) {
+  return topic < TELEMETRY_TOPIC_COUNT ? topic_units[topic] : "";
+}
@@ -0,0 +1,99 @@
+/**
+ * telemetry.h
+ * Telemetry bus: statically declared topics, one lock-free channel per
+ * topic and subscriber
+ *
+ * Each topic has exactly one producer (the controller decoder, the BMS
+ * decoder, the switch input, or a demo source) and any of the subscribers
+ * below. Publishing copies the sample into every subscribed channel and
+ * never waits: a queue channel that is full drops the new sample, a
+ * latest-wins channel overwrites the unread one. Either way the producer's
+ * cost is bounded and a slow subscriber only loses its own samples.
+ *
+ *   TELEMETRY_QUEUE   spsc ring of CONFIG_DASH_TELEMETRY_QUEUE_LEN samples,
+ *                     for consumers that need every sample (alerts, the
+ *                     resampled speed and power of the UI)
+ *   TELEMETRY_LATEST  single slot under a sequence counter, for consumers
+ *                     that only want the current value (UI, trip computer,
+ *                     the logger's snapshots)
+ *
+ * Subscriptions are made at start-up, before the producers run; publish and
+ * poll may then run on different tasks or cores, or publish from an ISR.
+ */
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* X(id, name, unit) */
+#define TELEMETRY_TOPICS(X)                                                    \
+  X(SPEED, "speed", "0.01 km/h")                                               \
+  X(POWER, "power", "W, < 0: regeneration")                                    \
+  X(PACK_VOLTAGE, "voltage", "mV")                                             \
+  X(PACK_CURRENT, "current", "mA, > 0: discharging")                           \
+  X(BATT_TEMP, "batt_temp", "deg C")                                           \
+  X(MOTOR_TEMP, "motor_temp", "deg C")                                         \
+  X(CTRL_TEMP, "ctrl_temp", "deg C")                                           \
+  X(ASSIST, "assist", "level 1..3")                                            \
+  X(BMS_SOC, "soc", "0.1 %, reported by the BMS")                              \
+  X(BMS_CAPACITY, "capacity", "mAh, full charge")                              \
+  X(CELL_MIN, "cell_min", "mV, lowest cell")                                   \
+  X(CELL_MAX, "cell_max", "mV, highest cell")                                  \
+  X(SWITCHES, "switches", "bit (1 << input_id_t) per active switch")           \
+  X(BMS_FAULTS, "bms_faults", "bit per bms_fault_t, 0: none")
+
+/* X(id, name) */
+#define TELEMETRY_SUBSCRIBERS(X)                                               \
+  X(UI, "ui")                                                                  \
+  X(TRIP, "trip")                                                              \
+  X(LOGGER, "logger")                                                          \
+  X(ALERT, "alert")
+
+#define TELEMETRY_TOPIC_ENUM(id, name, unit) TELEMETRY_##id,
+typedef enum {
+  TELEMETRY_TOPICS(TELEMETRY_TOPIC_ENUM) TELEMETRY_TOPIC_COUNT
+} telemetry_topic_t;
+#undef TELEMETRY_TOPIC_ENUM
+
+#define TELEMETRY_SUB_ENUM(id, name) TELEMETRY_SUB_##id,
+typedef enum {
+  TELEMETRY_SUBSCRIBERS(TELEMETRY_SUB_ENUM) TELEMETRY_SUB_COUNT
+} telemetry_sub_t;
+#undef TELEMETRY_SUB_ENUM
+
+typedef enum {
+  TELEMETRY_OFF, /* not subscribed */
+  TELEMETRY_LATEST,
+  TELEMETRY_QUEUE,
+} telemetry_policy_t;
+
+typedef struct {
+  uint32_t t_ms; /* producer's timestamp */
+  int32_t value; /* in the topic's unit */
+} telemetry_sample_t;
+
+typedef struct {
+  uint32_t published;
+  uint32_t delivered;   /* polled, all subscribers */
+  uint32_t dropped;     /* lost on a full queue, all subscribers */
+  uint32_t overwritten; /* latest-wins samples replaced unread */
+} telemetry_stats_t;
+
+/* Start-up only */
+void telemetry_subscribe(telemetry_sub_t sub, telemetry_topic_t topic,
+                         telemetry_policy_t policy);
+
+/* Producer side, one producer per topic; never blocks */
+void telemetry_publish(telemetry_topic_t topic, int32_t value, uint32_t t_ms);
+
+/* Consumer side: the next sample (queue) or the newest unread one (latest);
+ * false if there is none */
+bool telemetry_poll(telemetry_sub_t sub, telemetry_topic_t topic,
+                    telemetry_sample_t *out);
+
+void telemetry_get_stats(telemetry_topic_t topic, telemetry_stats_t *out);
+const char *telemetry_topic_name(telemetry_topic_t topic);
+const char *telemetry_topic_unit(telemetry_topic_t topic);
+
+#endif /*TELEMETRY_H*/
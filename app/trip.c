@@ -0,0 +1,105 @@
+/**
+ * trip.c
+ * Trip computer with exact fixed-point integration
+ *
+ * Only the trip accumulators are updated per sample; the odometer and the
+ * lifetime energy counters are the trip plus everything folded in by
+ * earlier trip resets.
+ */
+
+#include "trip.h"
+
+#define UNITS_PER_M TRIP_UNITS_PER_M
+#define UNITS_PER_100M (UNITS_PER_M * 100u)
+#define UJ_PER_WH 3600000000ll
+
+typedef struct {
+  uint64_t dist;     /* distance units, see trip.h */
+  uint64_t drive_uj; /* energy drawn from the battery */
+  uint64_t regen_uj; /* energy returned by regenerative braking */
+} trip_acc_t;
+
+static trip_acc_t trip;
+static trip_acc_t odo_base; /* odometer before the current trip */
+static uint64_t ride_us;
+static uint16_t max_speed_x100;
+
+void trip_sample(uint16_t speed_x100, int32_t power_w, uint32_t dt_us) {
+  trip.dist += (uint64_t)speed_x100 * dt_us;
+  /* Drive and regen are split on the sign of the same sample */
+  if (power_w >= 0)
+    trip.drive_uj += (uint64_t)power_w * dt_us;
+  else
+    trip.regen_uj += (uint64_t)-(int64_t)power_w * dt_us;
+  if (speed_x100 != 0)
+    ride_us += dt_us;
+  if (speed_x100 > max_speed_x100)
+    max_speed_x100 = speed_x100;
+}
+
+void trip_reset(void) {
+  odo_base.dist += trip.dist;
+  odo_base.drive_uj += trip.drive_uj;
+  odo_base.regen_uj += trip.regen_uj;
+  trip.dist = 0;
+  trip.drive_uj = 0;
+  trip.regen_uj = 0;
+  ride_us = 0;
+  max_speed_x100 = 0;
+}
+
+void trip_set_odometer(uint32_t odo_m, uint64_t drive_uj, uint64_t regen_uj) {
+  odo_base.dist = (uint64_t)odo_m * UNITS_PER_M - trip.dist;
+  odo_base.drive_uj = drive_uj - trip.drive_uj;
+  odo_base.regen_uj = regen_uj - trip.regen_uj;
+}
+
+void trip_get_odometer(uint32_t *odo_m, uint64_t *drive_uj,
+                       uint64_t *regen_uj) {
+  *odo_m = (uint32_t)((odo_base.dist + trip.dist) / UNITS_PER_M);
+  *drive_uj = odo_base.drive_uj + trip.drive_uj;
+  *regen_uj = odo_base.regen_uj + trip.regen_uj;
+}
+
+/* 0.1 Wh/km: uJ * 1000 / units, with the distance scaled down first so the
+ * product cannot overflow; 0 below 100 m where the figure is meaningless */
+static int32_t wh_per_km_x10(int64_t energy_uj, uint64_t dist) {
+  if (dist < UNITS_PER_100M)
+    return 0;
+  return (int32_t)(energy_uj / (int64_t)(dist / 1000u));
+}
+
+/* Regen as 0.1 % of the drive energy */
+static int32_t recovered_x10(uint64_t drive_uj, uint64_t regen_uj) {
+  if (drive_uj < UJ_PER_WH)
+    return 0;
+  return (int32_t)(regen_uj / (drive_uj / 1000u));
+}
+
+void trip_get_snapshot(trip_snapshot_t *out) {
+  uint64_t odo_dist = odo_base.dist + trip.dist;
+  uint64_t odo_drive = odo_base.drive_uj + trip.drive_uj;
+  uint64_t odo_regen = odo_base.regen_uj + trip.regen_uj;
+  int64_t trip_net = (int64_t)trip.drive_uj - (int64_t)trip.regen_uj;
+
+  out->odo_x10 = (int32_t)(odo_dist / UNITS_PER_100M);
+  out->trip_x10 = (int32_t)(trip.dist / UNITS_PER_100M);
+  out->trip_m = (uint32_t)(trip.dist / UNITS_PER_M);
+  out->ride_time_s = (int32_t)(ride_us / 1000000u);
+  out->max_speed_kmh = max_speed_x100 / 100;
+  /* km/h * 10 = units / (10 * us) */
+  out->avg_speed_x10 =
+      ride_us ? (int32_t)(trip.dist / (ride_us * 10u)) : 0;
+  out->used_wh = (int32_t)(trip_net / UJ_PER_WH);
+  out->used_x10 = out->used_wh / 100;
+  out->trip_avg_x10 = wh_per_km_x10(trip_net, trip.dist);
+  out->hist_avg_x10 = wh_per_km_x10(
+      (int64_t)odo_drive - (int64_t)odo_regen, odo_dist);
+
+  out->drive_wh = (int32_t)(trip.drive_uj / UJ_PER_WH);
+  out->regen_wh = (int32_t)(trip.regen_uj / UJ_PER_WH);
+  out->recovered_x10 = recovered_x10(trip.drive_uj, trip.regen_uj);
+  out->life_drive_wh = (uint32_t)(odo_drive / UJ_PER_WH);
+  out->life_regen_wh = (uint32_t)(odo_regen / UJ_PER_WH);
+  out->life_recovered_x10 = recovered_x10(odo_drive, odo_regen);
+}
@@ -0,0 +1,64 @@
+/**
+ * trip.h
+ * Trip computer: odometer, trip distance, ride time, top speed and energy
+ *
+ * Speed and power samples are integrated in fixed point. Each sample costs
+ * two 64-bit multiply-adds and a compare; all unit conversions and divisions
+ * happen in trip_get_snapshot(), at display rate. The accumulators are
+ * exact integers, so there is no drift however long the ride:
+ *
+ *   distance  sum(speed_x100 * dt_us)   1 unit = 0.01 km/h * 1 us = 25/9 nm
+ *   energy    sum(power_w * dt_us)      1 unit = 1 uJ
+ *
+ * Energy drawn (drive) and energy returned by regenerative braking are
+ * integrated separately from the same samples, per trip and for the
+ * odometer lifetime; "used" is their difference.
+ *
+ * 64 bits hold well over 1,000,000 km and 2.5 GWh. Not thread safe: sample
+ * and read from the same task.
+ */
+#ifndef TRIP_H
+#define TRIP_H
+
+#include <stdint.h>
+
+#define TRIP_UNITS_PER_M 360000000ull /* distance units per metre */
+
+/* Values in the units the dashboard shows */
+typedef struct {
+  int32_t odo_x10;       /* 0.1 km */
+  int32_t trip_x10;      /* 0.1 km */
+  int32_t ride_time_s;   /* time moving since the trip reset */
+  int32_t max_speed_kmh;
+  int32_t avg_speed_x10; /* 0.1 km/h, over the ride time */
+  int32_t used_x10;      /* 0.1 kWh, net of regeneration */
+  int32_t trip_avg_x10;  /* 0.1 Wh/km, this trip */
+  int32_t hist_avg_x10;  /* 0.1 Wh/km, odometer lifetime */
+  /* Finer values for other estimators */
+  uint32_t trip_m;
+  int32_t used_wh;
+  /* Regeneration, this trip and odometer lifetime */
+  int32_t drive_wh;
+  int32_t regen_wh;
+  int32_t recovered_x10; /* regen as 0.1 % of drive */
+  uint32_t life_drive_wh;
+  uint32_t life_regen_wh;
+  int32_t life_recovered_x10;
+} trip_snapshot_t;
+
+/* One sample: speed in 0.01 km/h, battery power in W (< 0: regeneration),
+ * time since the previous sample */
+void trip_sample(uint16_t speed_x100, int32_t power_w, uint32_t dt_us);
+
+/* Start a new trip; the odometer keeps counting */
+void trip_reset(void);
+
+/* Restore the odometer and lifetime energy, e.g. from persistent storage */
+void trip_set_odometer(uint32_t odo_m, uint64_t drive_uj, uint64_t regen_uj);
+
+/* The same values, current, for storing */
+void trip_get_odometer(uint32_t *odo_m, uint64_t *drive_uj, uint64_t *regen_uj);
+
+void trip_get_snapshot(trip_snapshot_t *out);
+
+#endif /*TRIP_H*/
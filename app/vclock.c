@@ -0,0 +1,72 @@
+/**
+ * vclock.c
+ * Dashboard time base: scaled host time or a stepped virtual clock
+ */
+
+#include "vclock.h"
+
+static bool running;
+static bool stepped;
+static vclock_source_t source;
+static uint64_t source_origin; /* source() at the last rate change */
+static uint64_t origin_us;     /* vclock_us() then */
+static uint32_t rate_x1000 = 1000;
+/* Stepped: the current time. Written by the LVGL task, read from any
+ * thread, so accessed atomically: a plain 64-bit access tears on 32-bit
+ * hosts. */
+static uint64_t step_us;
+static time_t start_time; /* time of day at start_us */
+static uint64_t start_us;
+
+void vclock_run_scaled(vclock_source_t src, uint32_t rate) {
+  uint64_t now = running ? vclock_us() : src();
+
+  if (!running) {
+    start_time = time(NULL);
+    start_us = now;
+  }
+  source_origin = src();
+  origin_us = now;
+  source = src;
+  rate_x1000 = rate > 0 ? rate : 1000;
+  stepped = false;
+  running = true;
+}
+
+void vclock_run_stepped(time_t start) {
+  uint64_t now = vclock_us();
+
+  __atomic_store_n(&step_us, now, __ATOMIC_RELAXED);
+  start_time = start;
+  start_us = now;
+  __atomic_store_n(&stepped, true, __ATOMIC_RELEASE);
+  running = true;
+}
+
+/* The only writer, so a load and a store make the increment */
+void vclock_advance(uint32_t us) {
+  if (stepped)
+    __atomic_store_n(&step_us,
+                     __atomic_load_n(&step_us, __ATOMIC_RELAXED) + us,
+                     __ATOMIC_RELAXED);
+}
+
+bool vclock_stepped(void) { return stepped; }
+
+uint32_t vclock_rate(void) { return stepped ? 0 : rate_x1000; }
+
+uint64_t vclock_us(void) {
+  if (__atomic_load_n(&stepped, __ATOMIC_ACQUIRE))
+    return __atomic_load_n(&step_us, __ATOMIC_RELAXED);
+  if (source == NULL)
+    return 0;
+  return origin_us + (source() - source_origin) * rate_x1000 / 1000u;
+}
+
+uint32_t vclock_ms(void) { return (uint32_t)(vclock_us() / 1000u); }
+
+time_t vclock_time(void) {
+  if (!running)
+    return time(NULL);
+  return start_time + (time_t)((vclock_us() - start_us) / 1000000u);
+}
@@ -0,0 +1,56 @@
+/**
+ * vclock.h
+ * Dashboard time base: the LVGL tick and the time of day
+ *
+ * Everything the dashboard times runs on lv_tick_get(): the LVGL timers,
+ * the telemetry timestamps, ride detection and the trip computer. The
+ * clock display and the ride log headers take the time of day from
+ * vclock_time(). On the MCU the tick is the esp_timer interrupt, nothing
+ * here is started and vclock_time() is time(NULL).
+ *
+ * The simulator installs vclock_ms() as the LVGL tick and runs it in one of
+ * two ways:
+ *
+ *   scaled   the host's monotonic clock times a rate, 1x by default; at 10x
+ *            an hour of riding takes six minutes
+ *   stepped  time stands still between vclock_advance() calls; the
+ *            simulator loop advances it by a fixed step per iteration
+ *            without sleeping, so a run takes as long as the computation
+ *            and, given the same inputs, draws the same frames with the
+ *            same values every time
+ *
+ * Once started, the time of day begins at the host's (scaled) or at a
+ * fixed date (stepped) and then follows the tick, so the displayed minutes
+ * and a log's start time agree with the ride's timestamps.
+ *
+ * vclock_advance() belongs to the task that runs LVGL; the readers may be
+ * used from any thread.
+ */
+#ifndef VCLOCK_H
+#define VCLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+/* Host monotonic clock, us */
+typedef uint64_t (*vclock_source_t)(void);
+
+/* Run at `rate_x1000` / 1000 of `source`, starting from its current value
+ * so the tick does not jump; called again, the clock changes rate from
+ * where it is */
+void vclock_run_scaled(vclock_source_t source, uint32_t rate_x1000);
+
+/* Stop following the host: from where it is, the clock moves only by
+ * vclock_advance(), and the time of day restarts at `start` */
+void vclock_run_stepped(time_t start);
+void vclock_advance(uint32_t us);
+
+bool vclock_stepped(void);
+uint32_t vclock_rate(void); /* x1000; 0 when stepped */
+
+uint64_t vclock_us(void);
+uint32_t vclock_ms(void); /* LVGL tick callback */
+time_t vclock_time(void);
+
+#endif /*VCLOCK_H*/
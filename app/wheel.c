@@ -0,0 +1,110 @@
+/**
+ * wheel.c
+ * Wheel speed from time stamped sensor pulses
+ */
+
+#include "wheel.h"
+#include "app_config.h"
+#include "spsc.h"
+#include "telemetry.h"
+#include <string.h>
+
+#define WHEEL_QUEUE_LEN 32
+#define WHEEL_HISTORY 32 /* power of two */
+#define WHEEL_MAX_KMH 120 /* faster pulses are contact bounce */
+
+/* Distance per pulse in um; um x 360 / us gives 0.01 km/h */
+#define UM_PER_PULSE                                                           \
+  ((uint64_t)CONFIG_DASH_WHEEL_CIRCUMFERENCE_MM * 1000u /                      \
+   CONFIG_DASH_WHEEL_PULSES_PER_REV)
+#define SPEED_X100(intervals, dt_us)                                           \
+  ((uint32_t)(UM_PER_PULSE * 360u * (intervals) / (dt_us)))
+#define MIN_INTERVAL_US ((uint32_t)(UM_PER_PULSE * 360u / (WHEEL_MAX_KMH * 100)))
+#define TIMEOUT_US                                                             \
+  ((uint32_t)(UM_PER_PULSE * 360u / (CONFIG_DASH_WHEEL_MIN_KMH * 100)))
+#define GATE_US ((uint32_t)CONFIG_DASH_WHEEL_GATE_MS * 1000u)
+
+static uint32_t pulse_buf[WHEEL_QUEUE_LEN];
+static spsc_t pulse_queue;
+
+/* Accepted pulses, newest at hist[(count - 1) % WHEEL_HISTORY] */
+static uint32_t hist[WHEEL_HISTORY];
+static uint32_t count;
+static wheel_stats_t stats;
+
+#define HIST(i) hist[(i) & (WHEEL_HISTORY - 1)]
+
+bool wheel_init(void) {
+  spsc_init(&pulse_queue, pulse_buf, sizeof(pulse_buf[0]), WHEEL_QUEUE_LEN);
+  count = 0;
+  memset(&stats, 0, sizeof(stats));
+  return wheel_platform_init();
+}
+
+void wheel_pulse(uint32_t t_us) {
+  if (!spsc_push(&pulse_queue, &t_us))
+    stats.overruns++;
+}
+
+static uint32_t estimate(uint32_t now_us) {
+  if (count < 2)
+    return 0;
+  uint32_t last = count - 1;
+  uint32_t newest = HIST(last);
+  uint32_t since = now_us - newest;
+  if ((int32_t)since < 0)
+    since = 0; /* stamped a little after the update clock was read */
+  if (since >= TIMEOUT_US)
+    return 0;
+
+  /* Oldest pulse still inside the gate */
+  uint32_t first = last;
+  while (last - first < WHEEL_HISTORY - 1 && first > 0 &&
+         now_us - HIST(first - 1) <= GATE_US)
+    first--;
+
+  uint32_t speed;
+  stats.count_mode = last - first >= WHEEL_COUNT_MIN;
+  if (stats.count_mode) {
+    speed = SPEED_X100(last - first, newest - HIST(first));
+  } else {
+    uint32_t period = newest - HIST(last - 1);
+    if (period >= TIMEOUT_US)
+      return 0; /* first pulse after a stop */
+    speed = SPEED_X100(1, period);
+  }
+
+  /* No pulse for `since`: the wheel is at most this fast */
+  if (since > 0 && SPEED_X100(1, since) < speed)
+    speed = SPEED_X100(1, since);
+  return speed;
+}
+
+void wheel_update(uint32_t now_us, uint32_t now_ms) {
+  uint32_t t;
+  bool fresh = false;
+  uint32_t oldest_fresh = 0;
+
+  while (spsc_pop(&pulse_queue, &t)) {
+    if (count > 0 && t - HIST(count - 1) < MIN_INTERVAL_US) {
+      stats.glitches++;
+      continue;
+    }
+    HIST(count) = t;
+    count++;
+    stats.pulses++;
+    if (!fresh) {
+      fresh = true;
+      oldest_fresh = t;
+    }
+  }
+  /* A capture time stamp may lead the update clock by a few us */
+  if (fresh && (int32_t)(now_us - oldest_fresh) > 0 &&
+      now_us - oldest_fresh > stats.latency_max_us)
+    stats.latency_max_us = now_us - oldest_fresh;
+
+  stats.speed_x100 = estimate(now_us);
+  telemetry_publish(TELEMETRY_SPEED, (int32_t)stats.speed_x100, now_ms);
+}
+
+void wheel_get_stats(wheel_stats_t *out) { *out = stats; }
@@ -0,0 +1,68 @@
+/**
+ * wheel.h
+ * Wheel speed from time stamped sensor pulses
+ *
+ * Every pulse of the wheel sensor (a reed switch and spoke magnet, or a hub
+ * motor hall sensor) is time stamped by hardware capture on the MCU, or by
+ * the synthetic generator in the simulator, and queued in a lock-free ring.
+ * wheel_update(), run every CONFIG_DASH_WHEEL_UPDATE_MS by the platform,
+ * turns the newest pulses into a speed and publishes it; the gauge and the
+ * trip computer (odometer) both take it from the bus.
+ *
+ * The estimate adapts to the pulse rate:
+ *
+ *   count   at least WHEEL_COUNT_MIN intervals end inside the last
+ *           CONFIG_DASH_WHEEL_GATE_MS: intervals x distance per pulse over
+ *           the time from the first to the last of those pulses. Timing
+ *           edge to edge avoids the +-1 pulse error of counting over a
+ *           fixed window.
+ *   period  fewer: the last interval alone, so a slow wheel still gives a
+ *           reading per pulse instead of one per gate.
+ *
+ * Both are the same reciprocal estimate over a different number of
+ * intervals, so the switch leaves no step in the readout. Between pulses
+ * the wheel cannot be faster than one pulse distance over the time since
+ * the last pulse; once that bound falls below the estimate it is used, so
+ * braking to a stop reads as a smooth decay, and after the pulse gap of
+ * CONFIG_DASH_WHEEL_MIN_KMH the speed is 0.
+ *
+ * Latency: a pulse is in the published speed at the first update after it,
+ * so at most CONFIG_DASH_WHEEL_UPDATE_MS plus scheduling delay; the worst
+ * case seen is in wheel_stats_t.
+ */
+#ifndef WHEEL_H
+#define WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define WHEEL_COUNT_MIN 2
+
+typedef struct {
+  uint32_t pulses;         /* accepted */
+  uint32_t glitches;       /* closer than the maximum speed allows */
+  uint32_t overruns;       /* lost on a full queue */
+  uint32_t speed_x100;     /* last published, 0.01 km/h */
+  bool count_mode;         /* last estimate from the gate, not one period */
+  uint32_t latency_max_us; /* pulse to the update that published it */
+} wheel_stats_t;
+
+/* Start the platform pulse source; false when there is none, in which case
+ * nothing is published */
+bool wheel_init(void);
+
+/* Producer side: a pulse at `t_us` (the platform's microsecond time base,
+ * same as wheel_update's). Safe from an ISR; one producer. */
+void wheel_pulse(uint32_t t_us);
+
+/* Consumer side: drain the pulses, publish the speed time stamped `now_ms`
+ * (lv_tick_get() time base) */
+void wheel_update(uint32_t now_us, uint32_t now_ms);
+
+void wheel_get_stats(wheel_stats_t *out);
+
+/* Implemented per platform (main/wheel_esp.c,
+ * simulator/src/hal/wheel_host.c); true when a pulse source was started */
+bool wheel_platform_init(void);
+
+#endif /*WHEEL_H*/
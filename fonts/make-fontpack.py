@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+字体包生成脚本
+将 TTF 字体渲染为 4bpp 位图并打包为 app/font_pack.h 描述的二进制字体包,
+用于按需加载的大字库 (例如中文)。
+
+使用方法:
+    python3 make-fontpack.py [选项]
+
+示例:
+    # 16px, GB2312 一级汉字 + 中文标点
+    python3 make-fontpack.py --font NotoSansSC-Regular.ttf
+
+    # 指定字号和额外字符
+    python3 make-fontpack.py --font NotoSansSC-Regular.ttf --size 20 --symbols "续航里程"
+
+烧录:
+    模拟器直接读取 out/fontpack.bin (可用 EBIKE_ASSET_DIR 指定目录)。
+    设备上写入 fontpack 分区:
+    parttool.py write_partition --partition-name fontpack --input out/fontpack.bin
+
+依赖:
+    - freetype-py: pip3 install freetype-py
+"""
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+try:
+    import freetype
+except ImportError:
+    print("错误: 需要 freetype-py (pip3 install freetype-py)")
+    sys.exit(1)
+
+script_dir = Path(__file__).parent
+
+MAGIC = 0x50464245  # "EBFP"
+VERSION = 1
+HEADER_FMT = "<IHBBHhIIIII"
+GLYPH_FMT = "<IIHBBbbH"
+
+
+def gb2312_level1():
+    """GB2312 一级汉字 (3755 个)"""
+    chars = []
+    for hi in range(0xB0, 0xD8):
+        for lo in range(0xA1, 0xFF):
+            try:
+                chars.append(bytes([hi, lo]).decode("gb2312"))
+            except UnicodeDecodeError:
+                pass
+    return chars
+
+
+def collect_codepoints(args):
+    cps = set()
+    if not args.no_gb2312:
+        cps.update(ord(c) for c in gb2312_level1())
+    # 中文标点
+    cps.update(range(0x3000, 0x3020))
+    cps.update(range(0xFF01, 0xFF5F))
+    for r in args.range or []:
+        lo, _, hi = r.partition("-")
+        cps.update(range(int(lo, 0), int(hi or lo, 0) + 1))
+    cps.update(ord(c) for c in args.symbols)
+    return sorted(cps)
+
+
+def render_glyph(face, cp):
+    """渲染单个字形, 返回 (记录字段, 4bpp 位图) 或 None"""
+    if face.get_char_index(cp) == 0:
+        return None
+    face.load_char(chr(cp), freetype.FT_LOAD_RENDER | freetype.FT_LOAD_TARGET_NORMAL)
+    g = face.glyph
+    bmp = g.bitmap
+    w, h = bmp.width, bmp.rows
+    if w > 255 or h > 255:
+        raise ValueError(f"U+{cp:04X}: 字形过大 ({w}x{h})")
+
+    stride = (w + 1) // 2
+    data = bytearray(stride * h)
+    for y in range(h):
+        for x in range(w):
+            v = bmp.buffer[y * bmp.pitch + x] >> 4
+            if x & 1:
+                data[y * stride + (x >> 1)] |= v
+            else:
+                data[y * stride + (x >> 1)] |= v << 4
+
+    adv_w = g.advance.x >> 2  # 26.6 定点 -> 1/16 像素
+    ofs_x = g.bitmap_left
+    ofs_y = g.bitmap_top - h  # LVGL: 基线到字形底边
+    return (adv_w, w, h, ofs_x, ofs_y), bytes(data)
+
+
+def build_pack(face, cps):
+    glyphs = []
+    bitmaps = bytearray()
+    for cp in cps:
+        r = render_glyph(face, cp)
+        if r is None:
+            continue
+        (adv_w, w, h, ofs_x, ofs_y), data = r
+        glyphs.append((cp, len(bitmaps), adv_w, w, h, ofs_x, ofs_y))
+        bitmaps += data
+
+    # 页表: 每个 BMP 页 (码位 >> 8) 的第一个字形序号
+    pages = [0] * 257
+    idx = 0
+    for page in range(256):
+        while idx < len(glyphs) and (glyphs[idx][0] >> 8) < page:
+            idx += 1
+        pages[page] = idx
+    while idx < len(glyphs) and glyphs[idx][0] <= 0xFFFF:
+        idx += 1
+    pages[256] = idx
+
+    line_height = face.size.height >> 6
+    base_line = -(face.size.descender >> 6)
+
+    header_size = struct.calcsize(HEADER_FMT)
+    pages_offset = (header_size + 3) & ~3
+    glyphs_offset = pages_offset + 257 * 4
+    bitmaps_offset = glyphs_offset + len(glyphs) * struct.calcsize(GLYPH_FMT)
+
+    out = bytearray(struct.pack(HEADER_FMT, MAGIC, VERSION, 4, 0,
+                                line_height, base_line, len(glyphs),
+                                pages_offset, glyphs_offset, bitmaps_offset,
+                                len(bitmaps)))
+    out += bytes(pages_offset - len(out))
+    out += struct.pack("<257I", *pages)
+    for cp, off, adv_w, w, h, ofs_x, ofs_y in glyphs:
+        out += struct.pack(GLYPH_FMT, cp, off, adv_w, w, h, ofs_x, ofs_y, 0)
+    out += bitmaps
+    return out, len(glyphs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="字体包生成工具")
+    parser.add_argument("--font", required=True,
+                        help="包含中文字形的 TTF/OTF 字体文件")
+    parser.add_argument("--size", type=int, default=16, help="字号 (像素)")
+    parser.add_argument("--range", action="append",
+                        help="额外码位范围, 例如 0x4E00-0x9FFF (可重复)")
+    parser.add_argument("--symbols", default="", help="额外字符")
+    parser.add_argument("--no-gb2312", action="store_true",
+                        help="不包含 GB2312 一级汉字")
+    parser.add_argument("--output", default=str(script_dir / "out" / "fontpack.bin"),
+                        help="输出文件 (默认: out/fontpack.bin)")
+    args = parser.parse_args()
+
+    face = freetype.Face(args.font)
+    face.set_pixel_sizes(0, args.size)
+
+    pack, count = build_pack(face, collect_codepoints(args))
+    Path(args.output).parent.mkdir(parents=True, exist_ok=True)
+    Path(args.output).write_bytes(pack)
+    print(f"完成: {args.output} ({count} 个字形, {len(pack)} 字节)")
+
+
+if __name__ == "__main__":
+    main()
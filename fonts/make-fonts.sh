@@ -3,6 +3,14 @@ set -e
 
 OUT_DIR=out
 
+# Glyph bitmaps are RLE compressed by default; the dashboard decodes them
+# through the glyph cache (app/glyph_cache.c). Set NO_COMPRESS=1 to emit
+# plain bitmaps instead.
+COMPRESS_OPT=""
+if [ -n "$NO_COMPRESS" ]; then
+    COMPRESS_OPT="--no-compress"
+fi
+
 # use script path as cwd
 SCRIPT_DIR=$(dirname "$0")
 cd "$SCRIPT_DIR"
@@ -24,7 +32,7 @@ gen_font () {
         --format lvgl \
         -r 0x20-0x7E \
         --lv-font-name "$NAME" \
-        --no-compress \
+        $COMPRESS_OPT \
         -o "$C_FILE"
         # --symbols "0123456789.-+%kmWhAV " \
 }
@@ -32,4 +40,5 @@ gen_font () {
 gen_font "JetBrainsMonoNL-ExtraBold.ttf" 42 lv_font_jetbrains_mono_extra_bold_42
 gen_font "JetBrainsMonoNL-SemiBold.ttf" 36 lv_font_jetbrains_mono_36
 gen_font "JetBrainsMonoNL-SemiBold.ttf" 26 lv_font_jetbrains_mono_26
+gen_font "JetBrainsMonoNL-SemiBold.ttf" 30 lv_font_jetbrains_mono_30
 gen_font "PF Din Mono.ttf"              30 lv_font_pf_din_mono_30
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 26 px
  * Bpp: 4
- * Opts: --font JetBrainsMonoNL-SemiBold.ttf --size 26 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_26 --no-compress -o out/lv_font_jetbrains_mono_26.c
+ * Opts: --font JetBrainsMonoNL-SemiBold.ttf --size 26 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_26 -o out/lv_font_jetbrains_mono_26.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -25,1554 +25,1077 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0xc, 0xff, 0x60, 0xbf, 0xf5, 0xb, 0xff, 0x50,
-    0xbf, 0xf4, 0xa, 0xff, 0x40, 0xaf, 0xf4, 0xa,
-    0xff, 0x30, 0x9f, 0xf3, 0x9, 0xff, 0x20, 0x8f,
-    0xf2, 0x8, 0xff, 0x10, 0x8f, 0xf1, 0x7, 0xff,
-    0x10, 0x4a, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x55, 0x1, 0xef, 0xfa, 0x3f, 0xff, 0xd0,
-    0xaf, 0xe5,
+    0xc, 0xff, 0x30, 0x38, 0x0, 0xc0, 0x3f, 0x84,
+    0x4, 0x3, 0xff, 0x38, 0x18, 0x7, 0xc2, 0x2,
+    0x1, 0xf1, 0x80, 0x7b, 0xc0, 0x31, 0xaa, 0x84,
+    0x12, 0xa8, 0x1, 0xf0, 0xaa, 0x80, 0x7e, 0xaa,
+    0x21, 0x0, 0x39, 0xa8, 0xc, 0x0,
 
     /* U+0022 "\"" */
-    0xaf, 0xf6, 0x0, 0xdf, 0xf3, 0x9f, 0xf6, 0x0,
-    0xcf, 0xf3, 0x9f, 0xf5, 0x0, 0xcf, 0xf3, 0x8f,
-    0xf5, 0x0, 0xbf, 0xf2, 0x8f, 0xf5, 0x0, 0xbf,
-    0xf2, 0x8f, 0xf4, 0x0, 0xaf, 0xf1, 0x7f, 0xf4,
-    0x0, 0xaf, 0xf1, 0x7f, 0xf3, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf3, 0x0, 0x37, 0xfc, 0x66, 0x0, 0xe1,
+    0x0, 0xf1, 0x80, 0x78, 0x40, 0x39, 0xc0, 0x2,
+    0x1, 0xff, 0xc1, 0x10, 0x0, 0x80, 0xf, 0xc0,
+    0x3f, 0xf3, 0x80, 0x79, 0xff, 0xc6, 0x0, 0xaf,
+    0xf0, 0x80,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0xcf, 0x40, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x7, 0xfa, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0xef, 0x20, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x6f,
-    0xa0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x9, 0xf7,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x1, 0xff, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0xaf, 0x60, 0x0, 0xaf, 0x60, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0xd, 0xf3, 0x0, 0x0,
+    0x0, 0xe9, 0xf7, 0x0, 0xa7, 0xd8, 0x3, 0xca,
+    0x6, 0x1, 0x28, 0x10, 0x7, 0x88, 0x18, 0x2,
+    0x20, 0x50, 0xe, 0x11, 0x1, 0x0, 0x4, 0x40,
+    0x20, 0x1c, 0x40, 0x40, 0x12, 0x81, 0x80, 0x79,
+    0x41, 0xc0, 0x23, 0x6, 0x0, 0x8f, 0xfd, 0x20,
+    0xbf, 0xf4, 0x2, 0xfd, 0x80, 0x7f, 0xf1, 0xf,
+    0xfc, 0x41, 0xbf, 0xf0, 0x86, 0xfd, 0x80, 0x62,
+    0x2, 0x0, 0x8, 0x80, 0x80, 0x38, 0xc0, 0x80,
+    0x22, 0x2, 0x0, 0xf2, 0x83, 0x80, 0x4a, 0xe,
+    0x1, 0xee, 0xd, 0x0, 0xbc, 0x34, 0x2, 0x1f,
+    0xf3, 0x84, 0x7f, 0xcc, 0x11, 0xf8, 0x1, 0xff,
+    0xc4, 0x1f, 0xe0, 0x7, 0xfd, 0xc0, 0xf, 0xf6,
+    0x0, 0x4a, 0x6, 0x1, 0x28, 0x18, 0x7, 0x8c,
+    0x14, 0x2, 0x30, 0x50, 0xf, 0x68, 0x78, 0x5,
+    0xa1, 0xe0, 0x1e, 0x70, 0x50, 0x9, 0xc1, 0x40,
+    0x30,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xea, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7f, 0xd7,
-    0x20, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7,
-    0xff, 0xb1, 0xea, 0x3e, 0xff, 0x40, 0xbf, 0xf1,
-    0xe, 0xa0, 0x5f, 0xf8, 0xd, 0xff, 0x0, 0xea,
-    0x1, 0x88, 0x50, 0xcf, 0xf2, 0xe, 0xa0, 0x0,
-    0x0, 0x9, 0xff, 0xb0, 0xea, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x5d, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xe, 0xa5, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xea, 0x5, 0xff, 0xc0, 0x0,
-    0x0, 0xe, 0xa0, 0xf, 0xfe, 0x4f, 0xf9, 0x0,
-    0xea, 0x0, 0xff, 0xe1, 0xff, 0xe0, 0xe, 0xa0,
-    0x4f, 0xfb, 0xb, 0xff, 0xc5, 0xeb, 0x6f, 0xff,
-    0x50, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x2c, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2,
-    0x5f, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xea, 0x0, 0x0, 0x0,
+    0x0, 0xf7, 0x50, 0x7, 0xff, 0x5c, 0xdc, 0x5d,
+    0xc4, 0x1, 0xc3, 0x98, 0x80, 0x28, 0xda, 0x0,
+    0xd8, 0x60, 0x1e, 0x5b, 0x0, 0x39, 0x2, 0x70,
+    0xae, 0x8, 0x22, 0x3, 0x0, 0x14, 0x20, 0x3,
+    0xb0, 0x6, 0x3, 0x0, 0x4, 0x3, 0x23, 0xbb,
+    0x40, 0x40, 0x4, 0x1, 0x86, 0x20, 0xa0, 0xa0,
+    0x9, 0x0, 0xfe, 0xa0, 0x2, 0x70, 0x80, 0x7c,
+    0x72, 0x0, 0x10, 0x5d, 0x60, 0xe, 0x6a, 0x20,
+    0x8, 0xa7, 0x44, 0x3, 0x2e, 0xd8, 0x6, 0x2c,
+    0x0, 0xf2, 0xa, 0xd0, 0x0, 0x9c, 0x3, 0xf2,
+    0xd0, 0x2, 0xc0, 0x3f, 0x94, 0x0, 0x49, 0xfe,
+    0x90, 0xf, 0xe5, 0x0, 0x38, 0x7, 0x20, 0x1,
+    0x45, 0x0, 0x71, 0x40, 0x5a, 0xc0, 0x1c, 0x12,
+    0x20, 0x74, 0x29, 0x20, 0x5, 0x50, 0x16, 0x18,
+    0x7, 0xa2, 0x80, 0x22, 0xcd, 0xa0, 0x3b, 0xf7,
+    0x0, 0xf1, 0x28, 0xb2, 0x0, 0x7f, 0xf4, 0x80,
 
     /* U+0025 "%" */
-    0x3, 0xbe, 0xea, 0x20, 0x0, 0x0, 0x1f, 0xf2,
-    0x1f, 0xff, 0xff, 0xe1, 0x0, 0x0, 0xbf, 0x70,
-    0x8f, 0xc0, 0x1c, 0xf7, 0x0, 0x5, 0xfc, 0x0,
-    0xaf, 0x60, 0x7, 0xfa, 0x0, 0x1e, 0xf2, 0x0,
-    0xbf, 0x60, 0x7, 0xfa, 0x0, 0xaf, 0x70, 0x0,
-    0xbf, 0x60, 0x7, 0xfa, 0x5, 0xfc, 0x0, 0x0,
-    0x8f, 0xc1, 0x1d, 0xf7, 0x1e, 0xf2, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xe1, 0xaf, 0x80, 0x0, 0x0,
-    0x3, 0xbe, 0xeb, 0x24, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfd, 0x5, 0xce, 0xc7, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x7f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x8f, 0x90, 0xef, 0x80, 0x5f, 0xf2,
-    0x0, 0x3, 0xfd, 0x0, 0xff, 0x10, 0xd, 0xf4,
-    0x0, 0xd, 0xf4, 0x1, 0xff, 0x0, 0xc, 0xf5,
-    0x0, 0x8f, 0x90, 0x0, 0xff, 0x0, 0xd, 0xf4,
-    0x3, 0xfe, 0x0, 0x0, 0xdf, 0x60, 0x2f, 0xf2,
-    0xc, 0xf4, 0x0, 0x0, 0x6f, 0xfe, 0xff, 0xb0,
-    0x7f, 0xa0, 0x0, 0x0, 0x6, 0xdf, 0xd8, 0x0,
+    0x3, 0xbe, 0xe5, 0x10, 0x7, 0xf, 0xf8, 0x87,
+    0x10, 0x44, 0xb8, 0x20, 0x1a, 0x82, 0xa, 0x40,
+    0xff, 0x8c, 0x58, 0x2, 0x54, 0x37, 0x2, 0xa,
+    0x1, 0xb0, 0xd0, 0x0, 0xd8, 0x70, 0x0, 0x40,
+    0x3f, 0xac, 0x60, 0x80, 0x3f, 0xe5, 0x51, 0xb8,
+    0x4, 0x61, 0x42, 0x2a, 0xd, 0x1b, 0xe, 0x0,
+    0xd4, 0x7, 0xdc, 0x21, 0x6b, 0x17, 0x20, 0xc,
+    0x58, 0x82, 0x24, 0xc5, 0x51, 0x40, 0x7, 0x8e,
+    0xfb, 0x96, 0x54, 0x1c, 0x1, 0xff, 0xa4, 0x5c,
+    0xc0, 0x3f, 0xe4, 0x62, 0x85, 0xce, 0xc7, 0x0,
+    0xfa, 0x43, 0x9e, 0x8c, 0x4e, 0x28, 0x3, 0xa0,
+    0x98, 0xe4, 0x1f, 0xe8, 0x14, 0x80, 0x23, 0x72,
+    0x90, 0x10, 0x90, 0x52, 0x6, 0x0, 0xb8, 0x24,
+    0x4, 0x0, 0x20, 0x1, 0x1, 0x0, 0x41, 0x32,
+    0x0, 0x80, 0x70, 0x80, 0x81, 0xb8, 0xc8, 0x4,
+    0x40, 0xc0, 0x44, 0x6, 0xf, 0xa, 0x0, 0xd6,
+    0x13, 0xda, 0x8, 0x4e, 0x6a, 0x80, 0x19, 0xa4,
+    0x84, 0x9e, 0xc0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x2a, 0xef, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x96, 0xcf, 0xf9, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x7, 0xff,
-    0x20, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x13,
-    0x30, 0x0, 0x0, 0x0, 0xb, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
-    0xef, 0xf2, 0x0, 0x2c, 0xc9, 0x2, 0xff, 0xd2,
-    0x3, 0xff, 0xd0, 0xd, 0xfe, 0x20, 0x6f, 0xf6,
-    0x0, 0x7, 0xff, 0x9a, 0xff, 0x40, 0x7, 0xff,
-    0x40, 0x0, 0xb, 0xff, 0xff, 0x70, 0x0, 0x7f,
-    0xf4, 0x0, 0x0, 0x1e, 0xff, 0xa0, 0x0, 0x6,
-    0xff, 0x50, 0x0, 0x2, 0xff, 0xfd, 0x0, 0x0,
-    0x4f, 0xfb, 0x0, 0x1, 0xdf, 0xff, 0xf8, 0x0,
-    0x0, 0xdf, 0xfc, 0x89, 0xef, 0xf4, 0xaf, 0xf4,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xef,
-    0xe1, 0x0, 0x2, 0x9e, 0xfe, 0xa2, 0x0, 0x4,
-    0xff, 0xb0,
+    0x0, 0xc5, 0x5d, 0xfa, 0xe0, 0x1f, 0xe4, 0xd5,
+    0x10, 0x28, 0xd0, 0xf, 0xea, 0x0, 0x34, 0x98,
+    0x14, 0x80, 0x7c, 0x62, 0xd, 0x2d, 0x84, 0xc,
+    0x1, 0xf3, 0x80, 0x3c, 0x2, 0xa0, 0x1, 0x0,
+    0x79, 0x40, 0x18, 0x1, 0x36, 0x60, 0x80, 0x3c,
+    0x28, 0xa, 0x60, 0x1, 0x33, 0x0, 0x7e, 0x90,
+    0x6, 0x88, 0x7, 0xff, 0x5, 0x0, 0x6c, 0x3,
+    0xfe, 0xbd, 0x40, 0x2, 0xb0, 0x7, 0xf5, 0xa0,
+    0x0, 0x84, 0x24, 0x80, 0x5, 0x98, 0x90, 0x24,
+    0x2, 0xdd, 0x80, 0x1e, 0x0, 0xf3, 0x2b, 0x4,
+    0x0, 0x59, 0x1, 0xc0, 0x14, 0xd1, 0x5, 0x10,
+    0x8, 0x0, 0x80, 0x27, 0x40, 0x65, 0x8, 0x40,
+    0xf, 0xf5, 0x8, 0x1, 0x5c, 0x2, 0x10, 0x0,
+    0x80, 0x63, 0x10, 0x3, 0x80, 0x62, 0x0, 0x70,
+    0x4, 0x3e, 0x1, 0x14, 0x0, 0x48, 0x40, 0x99,
+    0x13, 0xe4, 0x16, 0xa0, 0xe8, 0x1, 0x70, 0x0,
+    0xdd, 0x84, 0x29, 0x28, 0x42, 0x84, 0x0, 0x7a,
+    0xc2, 0x2, 0xba, 0xa0, 0xa, 0x1, 0xa0,
 
     /* U+0027 "'" */
-    0xbf, 0xf5, 0xbf, 0xf4, 0xaf, 0xf4, 0xaf, 0xf4,
-    0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0x8f, 0xf2,
-    0x0, 0x0,
+    0xbf, 0xf2, 0x80, 0x42, 0x20, 0xf, 0x8c, 0x0,
+    0xe0, 0x1f, 0x84, 0x0, 0x31, 0xfe, 0x20,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x2, 0x30, 0x0, 0x0, 0x4c,
-    0xf9, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x0, 0xbf,
-    0xff, 0xb4, 0x0, 0x8f, 0xfe, 0x40, 0x0, 0x2f,
-    0xff, 0x30, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xfa, 0x0, 0x0,
-    0x5, 0xff, 0x70, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f,
-    0xf6, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0xef, 0xf2,
-    0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x1e,
-    0xff, 0x60, 0x0, 0x0, 0x5f, 0xff, 0x91, 0x0,
-    0x0, 0x7f, 0xff, 0xf7, 0x0, 0x0, 0x5e, 0xff,
-    0x90, 0x0, 0x0, 0x7, 0xd9, 0x0, 0x0, 0x0,
-    0x0, 0x10,
+    0x0, 0xf8, 0x8c, 0x3, 0x93, 0x36, 0x80, 0x34,
+    0xd9, 0x80, 0x75, 0xb0, 0x1, 0x34, 0x1, 0x8,
+    0x3, 0x76, 0x40, 0x27, 0x0, 0x6a, 0x0, 0x56,
+    0x0, 0x83, 0x0, 0xcc, 0x0, 0x70, 0xc, 0x40,
+    0x5, 0x0, 0xe7, 0x0, 0x68, 0x7, 0x18, 0x0,
+    0x40, 0x3f, 0xfd, 0xe4, 0x0, 0xe0, 0xe, 0x50,
+    0x2, 0x0, 0x70, 0x88, 0xc, 0x80, 0x39, 0x80,
+    0x10, 0x1, 0xd2, 0x20, 0xac, 0x1, 0x86, 0xc0,
+    0x13, 0x21, 0x0, 0x96, 0x0, 0xd, 0xce, 0x1,
+    0x3d, 0x8, 0x3, 0x80, 0x32, 0xf4, 0x10, 0x7,
+    0xcf, 0xb0,
 
     /* U+0029 ")" */
-    0x5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf9, 0x10,
-    0x0, 0x0, 0xf, 0xff, 0xe4, 0x0, 0x0, 0x8,
-    0xef, 0xff, 0x50, 0x0, 0x0, 0x9, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff, 0x90,
-    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0,
-    0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0,
-    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x2, 0xff, 0xb0, 0x0,
-    0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x1f, 0xff,
-    0x10, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0, 0x3d,
-    0xff, 0xe1, 0x0, 0xd, 0xff, 0xfe, 0x20, 0x0,
-    0xf, 0xff, 0xc1, 0x0, 0x0, 0xf, 0xb4, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x0, 0xfe, 0xaf, 0x91, 0x0, 0xfc, 0xde,
+    0x80, 0x1c, 0xe2, 0x3, 0x6a, 0x1, 0xa3, 0x98,
+    0x1, 0x44, 0x1, 0xd2, 0xc0, 0xe, 0x0, 0xf4,
+    0x90, 0x19, 0x80, 0x3d, 0x60, 0xa, 0x0, 0xf3,
+    0x80, 0x14, 0x3, 0xc2, 0x20, 0x20, 0xf, 0x88,
+    0x4, 0x3, 0xff, 0xda, 0x20, 0x1f, 0xc6, 0x2,
+    0x1, 0xe2, 0x10, 0x50, 0xf, 0x50, 0x3, 0x0,
+    0x38, 0x5c, 0x0, 0xc0, 0x1d, 0xa0, 0x6, 0x10,
+    0x8, 0xf4, 0xc0, 0x60, 0x2, 0xdc, 0x20, 0x1c,
+    0x10, 0x8, 0x80, 0x7, 0xe4, 0x1, 0xc9, 0x78,
+    0x20, 0x1d, 0xd6, 0x80, 0x1e,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x11,
-    0x0, 0x6, 0xff, 0x0, 0x0, 0x20, 0x9, 0xfa,
-    0x40, 0x4f, 0xe0, 0x16, 0xdf, 0x30, 0xef, 0xff,
-    0xd7, 0xfd, 0x8f, 0xff, 0xf8, 0x3, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xd7, 0x10, 0x0, 0x4, 0x8e,
-    0xff, 0xc7, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0x7d,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x5f,
-    0xf8, 0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0xbf,
-    0xf3, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x1, 0xef,
-    0xa0, 0x0, 0x0, 0x1a, 0x10, 0x0, 0x5, 0x70,
-    0x0,
+    0x0, 0xf3, 0x7f, 0x80, 0x3f, 0xfb, 0x22, 0x20,
+    0xf, 0xf1, 0x0, 0x23, 0xa9, 0x0, 0x80, 0x40,
+    0x5b, 0x74, 0x60, 0xe0, 0xb7, 0xa6, 0x7, 0x1d,
+    0x24, 0x16, 0x1a, 0xc0, 0x2, 0x80, 0x27, 0x0,
+    0x14, 0x48, 0x1c, 0xfd, 0xb8, 0x80, 0xe, 0x37,
+    0x4e, 0x20, 0x19, 0x38, 0x40, 0x2, 0xc4, 0x1,
+    0xf1, 0xc8, 0x41, 0x13, 0x40, 0x3f, 0x70, 0xb,
+    0xc0, 0x1c, 0x0, 0x7a, 0x48, 0x2c, 0x15, 0x1,
+    0xcc, 0x3, 0xb, 0x82, 0xa8, 0x1, 0x42, 0x12,
+    0x1, 0x87, 0xd6, 0xc0, 0x21, 0xb8, 0xa0, 0x0,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaa, 0xaa,
-    0xdf, 0xfb, 0xaa, 0xa9, 0x0, 0x0, 0x9, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xaa, 0x10, 0x0, 0x0,
+    0x0, 0xe9, 0xff, 0x10, 0x7, 0xff, 0xb1, 0xbf,
+    0xf3, 0x0, 0x37, 0xff, 0x0, 0x7f, 0xf0, 0x55,
+    0x78, 0x80, 0x8, 0xab, 0x31, 0xd5, 0x64, 0x0,
+    0x4d, 0x55, 0x20, 0x1f, 0xfe, 0xf, 0x55, 0x18,
+    0x6,
 
     /* U+002C "," */
-    0x1, 0x33, 0x20, 0x8f, 0xfb, 0xa, 0xff, 0x70,
-    0xdf, 0xf4, 0xf, 0xff, 0x3, 0xff, 0xc0, 0x5f,
-    0xf8, 0x8, 0xff, 0x50, 0xbf, 0xf1, 0x0,
+    0x1, 0x33, 0x10, 0x4e, 0x62, 0x40, 0x80, 0x18,
+    0xe, 0x0, 0x30, 0x20, 0x2, 0x18, 0x0, 0xc1,
+    0x80, 0x8, 0x1a, 0x0, 0xd0, 0x30, 0x2, 0x0,
 
     /* U+002D "-" */
-    0x3a, 0xaa, 0xaa, 0xaa, 0x95, 0xff, 0xff, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xff, 0xf0,
+    0x3a, 0xaf, 0xa5, 0x95, 0x7e, 0x60, 0xf, 0xe0,
 
     /* U+002E "." */
-    0x3, 0x98, 0x10, 0x2f, 0xff, 0xc0, 0x7f, 0xff,
-    0xf0, 0x5f, 0xff, 0xe0, 0x9, 0xfd, 0x40,
+    0x3, 0x98, 0x10, 0x2c, 0x67, 0xd0, 0x50, 0x8,
+    0xc0, 0x80, 0x21, 0x5, 0x60, 0x2a, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x4f, 0xf5, 0x0, 0x7f, 0x70, 0x3,
+    0x80, 0x3f, 0x94, 0x5, 0x0, 0x3f, 0x28, 0x1,
+    0xc0, 0x3f, 0xb8, 0x1, 0x40, 0x1f, 0x85, 0x0,
+    0x8c, 0x3, 0xf3, 0x0, 0x28, 0x3, 0xfa, 0x80,
+    0xc, 0x1, 0xf8, 0xc8, 0x10, 0x40, 0x3f, 0x58,
+    0x3, 0x40, 0x3f, 0x98, 0x0, 0xc0, 0x1f, 0x90,
+    0x41, 0x40, 0x3f, 0xb8, 0x1, 0xc0, 0x1f, 0xca,
+    0x2, 0x80, 0x1f, 0x98, 0x0, 0xc0, 0x1f, 0xd4,
+    0x0, 0xa0, 0xf, 0xc4, 0x60, 0x44, 0x0, 0xfc,
+    0xa0, 0xa, 0x0, 0xfe, 0xa0, 0x3, 0x0, 0x7e,
+    0x32, 0x4, 0x10, 0xf, 0xd4, 0x0, 0xe0, 0xf,
+    0xe7, 0x0, 0x28, 0x7, 0xe5, 0x10, 0x60, 0xf,
+    0xee, 0x0, 0x68, 0x7, 0xe1, 0x40, 0x14, 0x0,
+    0xfc,
 
     /* U+0030 "0" */
-    0x0, 0x2, 0x9d, 0xff, 0xc7, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x3, 0xff, 0xfc,
-    0x89, 0xef, 0xfc, 0x0, 0xbf, 0xf7, 0x0, 0x1,
-    0xcf, 0xf4, 0xf, 0xfd, 0x0, 0x0, 0x4, 0xff,
-    0x80, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xfa, 0x1f,
-    0xf9, 0x0, 0x0, 0x0, 0xff, 0xa1, 0xff, 0x90,
-    0x0, 0x0, 0xf, 0xfa, 0x1f, 0xf9, 0x6, 0xfd,
-    0x10, 0xff, 0xa1, 0xff, 0x90, 0xcf, 0xf6, 0xf,
-    0xfa, 0x1f, 0xf9, 0x8, 0xff, 0x20, 0xff, 0xa1,
-    0xff, 0x90, 0x2, 0x10, 0xf, 0xfa, 0x1f, 0xf9,
-    0x0, 0x0, 0x0, 0xff, 0xa1, 0xff, 0x90, 0x0,
-    0x0, 0xf, 0xfa, 0xf, 0xfa, 0x0, 0x0, 0x0,
-    0xff, 0xa0, 0xff, 0xd0, 0x0, 0x0, 0x4f, 0xf8,
-    0xb, 0xff, 0x70, 0x0, 0x1c, 0xff, 0x30, 0x3f,
-    0xff, 0xc8, 0x9e, 0xff, 0xb0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x2a, 0xef, 0xec,
-    0x60, 0x0,
+    0x0, 0x8a, 0x77, 0xfd, 0x8e, 0x1, 0xcd, 0xac,
+    0x40, 0x3, 0x8d, 0x10, 0x1, 0xc8, 0x0, 0xdd,
+    0x84, 0xb, 0x40, 0x10, 0x0, 0x8c, 0x89, 0xf3,
+    0x3, 0x40, 0x40, 0x27, 0x0, 0x86, 0x0, 0x18,
+    0x1, 0x38, 0x7, 0x20, 0x0, 0x84, 0x0, 0x60,
+    0x1f, 0xfc, 0xf6, 0xfd, 0x10, 0xf, 0xea, 0x2,
+    0x70, 0xf, 0xe4, 0x0, 0x20, 0x7, 0xf4, 0x6f,
+    0x10, 0x7, 0xf8, 0x84, 0x3, 0xff, 0x8c, 0x20,
+    0x3, 0x0, 0xff, 0xce, 0x1, 0xc8, 0x0, 0x20,
+    0x40, 0x27, 0x0, 0x86, 0x0, 0x16, 0x10, 0x0,
+    0x8c, 0x89, 0xf3, 0x4, 0x30, 0x39, 0x0, 0x1b,
+    0xb0, 0x81, 0xd0, 0x4, 0xda, 0xa2, 0x2, 0x73,
+    0x82, 0x0,
 
     /* U+0031 "1" */
-    0x0, 0x3, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0xa, 0xff, 0xf6, 0xbf, 0xf1,
-    0x0, 0x0, 0xcf, 0xd3, 0xb, 0xff, 0x10, 0x0,
-    0xc, 0xb1, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x40,
-    0x0, 0xb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x7, 0xaa,
-    0xaa, 0xef, 0xfa, 0xaa, 0xa2, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3,
+    0x0, 0x8f, 0x7f, 0xe1, 0x0, 0xf3, 0x61, 0x0,
+    0x7f, 0x4c, 0x80, 0x3f, 0xd4, 0xc0, 0x9, 0x40,
+    0xf, 0x98, 0xb, 0x18, 0x3, 0xf9, 0x30, 0xc0,
+    0x3f, 0xa2, 0xc4, 0x3, 0xfc, 0x80, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0x53, 0xd5, 0x65, 0x0, 0x5d,
+    0x54, 0x58, 0xab, 0x84, 0x0, 0xab, 0x84, 0x3,
+    0xff, 0x82,
 
     /* U+0032 "2" */
-    0x0, 0x2, 0x9d, 0xfe, 0xc6, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x3, 0xff, 0xfd,
-    0x9b, 0xff, 0xfb, 0x0, 0xaf, 0xf8, 0x0, 0x2,
-    0xff, 0xf3, 0xf, 0xfe, 0x0, 0x0, 0x8, 0xff,
-    0x72, 0xff, 0xa0, 0x0, 0x0, 0x5f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xa, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfe, 0xaa, 0xaa, 0xaa, 0xa8, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfd,
+    0x0, 0x8a, 0x77, 0xfb, 0x18, 0x3, 0x97, 0x58,
+    0x80, 0x4e, 0x70, 0x40, 0x7, 0x40, 0x2, 0x64,
+    0x0, 0x1d, 0x0, 0x24, 0x0, 0xfb, 0x37, 0xa0,
+    0x4, 0x30, 0x50, 0x18, 0x0, 0x89, 0xc0, 0x8,
+    0x40, 0x4, 0x0, 0xed, 0x0, 0x71, 0x7f, 0xa8,
+    0x3, 0xf0, 0x80, 0x7f, 0x60, 0x3, 0x40, 0x3f,
+    0x13, 0x0, 0x14, 0x3, 0xf7, 0x0, 0x20, 0x3,
+    0xf5, 0x18, 0x1b, 0x80, 0x7d, 0xa, 0x3, 0xa0,
+    0x1f, 0x3b, 0x80, 0x1a, 0x20, 0x1e, 0x68, 0x0,
+    0x61, 0x80, 0x79, 0x24, 0x1, 0x66, 0x1, 0xe3,
+    0xb0, 0x5, 0x20, 0x7, 0x8b, 0x0, 0x12, 0xa0,
+    0x1f, 0x78, 0x0, 0x72, 0xab, 0xd0, 0x6, 0x0,
+    0x15, 0x5f, 0xc0, 0x1f, 0xfc, 0x10,
 
     /* U+0033 "3" */
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x6, 0x99, 0x99,
-    0x99, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xe8, 0x30, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x7, 0xcc, 0xef, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf8, 0x3a, 0xa5, 0x0, 0x0, 0x5,
-    0xff, 0x73, 0xff, 0xb0, 0x0, 0x0, 0x8f, 0xf6,
-    0xe, 0xff, 0x50, 0x0, 0x3f, 0xff, 0x20, 0x7f,
-    0xff, 0xb9, 0xbf, 0xff, 0xa0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x5b, 0xef, 0xeb,
-    0x60, 0x0,
+    0xb, 0xff, 0xff, 0x0, 0x7f, 0xf0, 0xf5, 0x9b,
+    0xc8, 0x0, 0x10, 0x3, 0x4c, 0xf4, 0x28, 0xe,
+    0x0, 0x7c, 0x38, 0x21, 0xa4, 0x1, 0xe1, 0xc2,
+    0xc, 0x30, 0xf, 0xb4, 0x82, 0xcc, 0x3, 0xe9,
+    0x30, 0x1c, 0x30, 0xf, 0x8c, 0x0, 0x2f, 0x92,
+    0x1, 0xed, 0x33, 0x8, 0x1, 0xa0, 0x3, 0x9f,
+    0x31, 0xd2, 0x0, 0x71, 0x0, 0xfc, 0xca, 0x0,
+    0x40, 0xf, 0xec, 0x0, 0x10, 0x7, 0xf1, 0x80,
+    0x3c, 0xea, 0x8a, 0x1, 0xfb, 0xc1, 0x55, 0xc0,
+    0x1d, 0xa0, 0x1, 0x31, 0x4, 0x50, 0x8, 0xdc,
+    0x0, 0x81, 0x20, 0xa, 0xb9, 0xbc, 0x0, 0x29,
+    0x3, 0xa8, 0x1, 0x19, 0x0, 0x7, 0x40, 0x15,
+    0x51, 0x4, 0x5, 0x27, 0x0, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf4, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x7f, 0xfb, 0x0, 0x3, 0x43, 0x1, 0xff,
-    0xf2, 0x0, 0xd, 0xff, 0xa, 0xff, 0x80, 0x0,
-    0xd, 0xff, 0x3f, 0xfe, 0x0, 0x0, 0xd, 0xff,
-    0x5f, 0xf7, 0x0, 0x0, 0xd, 0xff, 0x5f, 0xfc,
-    0x99, 0x99, 0x9e, 0xff, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x0, 0xfa, 0xbf, 0xce, 0x1, 0xf2, 0x28, 0x13,
+    0x80, 0x7d, 0x20, 0x9, 0x0, 0xf9, 0xc8, 0x11,
+    0x0, 0x1e, 0x18, 0x0, 0x48, 0x7, 0xd6, 0x0,
+    0x72, 0x0, 0xf1, 0xa8, 0xc, 0x0, 0x7d, 0xc0,
+    0xb, 0x0, 0xf9, 0xc8, 0x11, 0x40, 0x6, 0x86,
+    0x3, 0x0, 0x9, 0x0, 0xba, 0xf0, 0x2c, 0x0,
+    0xe4, 0x1, 0xe3, 0x50, 0x18, 0x0, 0xf9, 0x80,
+    0x12, 0x1, 0xff, 0x5c, 0xcf, 0x18, 0x7, 0x1b,
+    0x37, 0x8, 0x7, 0xff, 0x9, 0x7f, 0xff, 0x10,
+    0x7, 0xff, 0x68,
 
     /* U+0035 "5" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x9, 0xff, 0xaa,
-    0xaa, 0xaa, 0xa8, 0x0, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9,
-    0x98, 0x86, 0x10, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf9, 0x29, 0x96, 0x0, 0x0, 0x3,
-    0xff, 0x92, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xf7,
-    0xe, 0xff, 0x60, 0x0, 0x1e, 0xff, 0x30, 0x6f,
-    0xff, 0xc9, 0xaf, 0xff, 0xc0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x4a, 0xef, 0xfc,
-    0x70, 0x0,
+    0x9, 0xff, 0xfe, 0xe0, 0xf, 0xfe, 0x32, 0xaf,
+    0xcc, 0x1, 0xd7, 0x55, 0xe8, 0x0, 0xff, 0xf0,
+    0x44, 0xc4, 0x18, 0x40, 0x3e, 0x66, 0x3b, 0xa7,
+    0xa0, 0x3, 0xff, 0x3c, 0x0, 0x27, 0xff, 0xb9,
+    0xc0, 0xe, 0x20, 0x1f, 0xc, 0x30, 0x1, 0xc0,
+    0x3f, 0xb4, 0x1, 0xc0, 0x1f, 0xce, 0x0, 0x12,
+    0x99, 0x30, 0x7, 0xf9, 0x99, 0x40, 0x1c, 0xa0,
+    0xe, 0x21, 0x3, 0x60, 0x8, 0x60, 0x0, 0x81,
+    0x0, 0x9, 0xc9, 0xae, 0x10, 0x33, 0x3, 0x30,
+    0x0, 0x6c, 0xa0, 0x2, 0xd0, 0xa, 0x6d, 0x44,
+    0x0, 0x71, 0xa2, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf9, 0x3, 0x10, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0xff, 0xfe, 0x60, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff,
-    0xc3, 0x1, 0x6f, 0xff, 0x40, 0x2f, 0xfe, 0x0,
-    0x0, 0x5, 0xff, 0xb0, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0xef, 0xf0, 0x7f, 0xf5, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0x3f, 0xfb, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xd, 0xff, 0x50, 0x0, 0xb, 0xff, 0x80, 0x4,
-    0xff, 0xfc, 0x89, 0xef, 0xfd, 0x10, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x2, 0x9d,
-    0xfe, 0xc7, 0x0, 0x0,
+    0x0, 0xf5, 0xff, 0x98, 0x3, 0xf9, 0x10, 0x4,
+    0xc0, 0x1f, 0xd0, 0x0, 0x80, 0xf, 0xe5, 0x30,
+    0x35, 0x0, 0xfe, 0x80, 0x7, 0x80, 0x7f, 0x31,
+    0x2, 0x18, 0x7, 0xf4, 0x0, 0x24, 0x3, 0xf9,
+    0xc4, 0x18, 0x8c, 0x40, 0x3e, 0x90, 0x1, 0xfe,
+    0x77, 0x18, 0x3, 0x38, 0x80, 0x14, 0x2, 0x19,
+    0x90, 0x5, 0x40, 0x3, 0xcf, 0xe9, 0x0, 0x32,
+    0x1, 0x10, 0x7, 0xc, 0x5, 0xa8, 0x1, 0xe0,
+    0x80, 0x6, 0x0, 0xe5, 0x10, 0x40, 0x10, 0x6,
+    0x80, 0x79, 0x40, 0x2, 0x20, 0x1, 0x80, 0x79,
+    0xc0, 0x2, 0xa0, 0xd, 0x0, 0xe1, 0x30, 0x20,
+    0x32, 0x4, 0x50, 0xd, 0x40, 0x5, 0x0, 0x48,
+    0x2, 0xb2, 0x27, 0x90, 0xa, 0x40, 0x9, 0x20,
+    0x3, 0x76, 0x10, 0x2f, 0x10, 0x9, 0xb5, 0x88,
+    0x4, 0xe3, 0x48, 0x0,
 
     /* U+0037 "7" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xfe,
-    0x99, 0x99, 0x99, 0xef, 0xf5, 0xf, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0xf, 0xfc, 0x0, 0x0,
-    0x6, 0xff, 0xa0, 0xd, 0xda, 0x0, 0x0, 0xc,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xc0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0xfc, 0xc0, 0x1f, 0xfc, 0x51, 0x66,
+    0xf0, 0x80, 0xc, 0x2, 0x29, 0x9f, 0x8, 0x1,
+    0x40, 0x3f, 0x98, 0x0, 0xa0, 0x2, 0x23, 0x0,
+    0x75, 0x0, 0x24, 0x1, 0xba, 0xa0, 0xc, 0x46,
+    0x4, 0x60, 0x1f, 0xd6, 0x0, 0xa0, 0xf, 0xf3,
+    0x80, 0x18, 0x3, 0xf9, 0x44, 0x14, 0x40, 0x3f,
+    0xa4, 0x1, 0xc0, 0x1f, 0xc4, 0x60, 0x28, 0x1,
+    0xfd, 0x40, 0x6, 0x0, 0xff, 0x30, 0x2, 0x80,
+    0x3f, 0x94, 0x41, 0x8, 0x3, 0xfb, 0x80, 0x1c,
+    0x1, 0xfc, 0x28, 0x2, 0xa0, 0x1f, 0xcc, 0x0,
+    0x70, 0xf, 0xf5, 0x0, 0x2c, 0x3, 0xf9, 0x8,
+    0xc, 0x80, 0x3c,
 
     /* U+0038 "8" */
-    0x0, 0x2, 0x9d, 0xfe, 0xc6, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x2, 0xff,
-    0xfc, 0x89, 0xef, 0xfb, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0x1e, 0xff, 0x30, 0xd, 0xff, 0x0, 0x0,
-    0x6, 0xff, 0x70, 0xe, 0xfe, 0x0, 0x0, 0x4,
-    0xff, 0x80, 0xb, 0xff, 0x0, 0x0, 0x6, 0xff,
-    0x50, 0x5, 0xff, 0x80, 0x0, 0x1d, 0xfe, 0x0,
-    0x0, 0xaf, 0xfb, 0x78, 0xef, 0xf4, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x8, 0xff, 0xc3,
-    0x1, 0x6f, 0xff, 0x20, 0x1f, 0xfd, 0x0, 0x0,
-    0x4, 0xff, 0xb0, 0x6f, 0xf7, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x1f, 0xff, 0x40, 0x0, 0xa, 0xff, 0x90, 0x8,
-    0xff, 0xfc, 0x9a, 0xef, 0xff, 0x20, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x3, 0xad,
-    0xfe, 0xc7, 0x10, 0x0,
+    0x0, 0x8a, 0x77, 0xfb, 0x18, 0x3, 0xcb, 0xac,
+    0x40, 0x27, 0x38, 0x20, 0x11, 0x50, 0x0, 0xdd,
+    0x84, 0xe, 0x80, 0x2b, 0x0, 0x36, 0x44, 0xf8,
+    0x82, 0x18, 0x1, 0x0, 0x12, 0x1, 0xc, 0x0,
+    0x10, 0x0, 0x60, 0x20, 0x1c, 0x40, 0xf, 0x0,
+    0x28, 0x8, 0x7, 0x10, 0x3, 0x40, 0x1c, 0x0,
+    0x80, 0x8, 0x6c, 0x5, 0x40, 0xa, 0xa0, 0x7b,
+    0x78, 0xf2, 0xa, 0x0, 0xd5, 0x20, 0x90, 0xe2,
+    0x7a, 0x80, 0x1a, 0x24, 0x3, 0x8f, 0xc, 0x2,
+    0x87, 0x3, 0xcf, 0xe9, 0x1, 0xc2, 0x1, 0x70,
+    0x2c, 0x30, 0x16, 0xb0, 0x4, 0x83, 0x80, 0x28,
+    0x3, 0x90, 0x81, 0x0, 0x40, 0x4, 0x1, 0xe1,
+    0x0, 0x88, 0x1, 0x80, 0x1e, 0x30, 0x10, 0x40,
+    0x3, 0x20, 0x6, 0xa0, 0x3, 0x80, 0xb8, 0x2,
+    0xf2, 0x6b, 0x94, 0x1, 0x60, 0x8, 0x60, 0x1,
+    0xb2, 0x88, 0xd, 0x90, 0x5, 0x38, 0xa4, 0x2,
+    0x71, 0xe8, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x3, 0x9d, 0xfe, 0xc6, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x5, 0xff,
-    0xfb, 0x89, 0xef, 0xfd, 0x0, 0xe, 0xff, 0x50,
-    0x0, 0xb, 0xff, 0x70, 0x4f, 0xfa, 0x0, 0x0,
-    0x1, 0xff, 0xd0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0xcf, 0xf0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0xbf,
-    0xf1, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xf0,
-    0x1f, 0xfe, 0x0, 0x0, 0x5, 0xff, 0xc0, 0xa,
-    0xff, 0xc3, 0x1, 0x6f, 0xff, 0x70, 0x1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x1a, 0xff,
-    0xff, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x13, 0x43,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x8e, 0x77, 0xfb, 0x18, 0x3, 0xcf, 0x8c,
+    0x40, 0x27, 0x3a, 0x40, 0x12, 0xc0, 0x1, 0x1d,
+    0x84, 0xb, 0xc0, 0x2b, 0x0, 0x55, 0xc4, 0xf2,
+    0x1, 0x38, 0x20, 0x82, 0xa8, 0x3, 0x50, 0x2,
+    0x80, 0x80, 0x18, 0x1, 0xc2, 0x60, 0x40, 0x20,
+    0x3, 0x0, 0xf3, 0x80, 0x4, 0x80, 0x1a, 0x1,
+    0xe5, 0x0, 0xa, 0x0, 0x18, 0x3, 0x94, 0x40,
+    0xc0, 0x54, 0x7, 0xc, 0x5, 0xa8, 0x1, 0x60,
+    0xb, 0x20, 0x3c, 0xfe, 0x90, 0x9, 0x80, 0x3,
+    0x8a, 0x1, 0x84, 0x0, 0xc2, 0x1, 0xd, 0x76,
+    0x5e, 0x8, 0x2, 0x0, 0x3c, 0x26, 0x92, 0x0,
+    0x71, 0x0, 0xfc, 0x6a, 0x3, 0x20, 0x1f, 0xde,
+    0x0, 0x91, 0x0, 0xfc, 0x86, 0x2, 0xe0, 0x1f,
+    0xd2, 0x0, 0x80, 0xf, 0xe6, 0x20, 0x26, 0x0,
+    0xfe, 0x80, 0x4, 0x0, 0x78,
 
     /* U+003A ":" */
-    0xa, 0xfe, 0x50, 0x5f, 0xff, 0xf0, 0x6f, 0xff,
-    0xf0, 0x1d, 0xff, 0x80, 0x0, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21,
-    0x0, 0x1d, 0xff, 0x80, 0x6f, 0xff, 0xf0, 0x5f,
-    0xff, 0xf0, 0xa, 0xfe, 0x50,
+    0xa, 0xfe, 0x50, 0x55, 0x0, 0xd0, 0x18, 0x7,
+    0x39, 0x0, 0x1c, 0x7, 0x75, 0xd0, 0x1, 0x10,
+    0x80, 0x7f, 0xf4, 0x8, 0x40, 0x3, 0xba, 0xe8,
+    0x7, 0x20, 0x3, 0x81, 0x80, 0x72, 0xa8, 0x6,
+    0x80,
 
     /* U+003B ";" */
-    0xa, 0xfe, 0x50, 0x6f, 0xff, 0xf0, 0x7f, 0xff,
-    0xf1, 0x1e, 0xff, 0x90, 0x0, 0x32, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xa0, 0xc, 0xff, 0x60, 0xf,
-    0xff, 0x20, 0x2f, 0xfe, 0x0, 0x4f, 0xfb, 0x0,
-    0x7f, 0xf7, 0x0, 0xaf, 0xf3, 0x0, 0xdf, 0xf0,
-    0x0, 0x23, 0x20, 0x0,
+    0xa, 0xfe, 0x50, 0x65, 0x1, 0xa0, 0x10, 0xc,
+    0x2c, 0x20, 0x6, 0x11, 0x76, 0x6c, 0x80, 0x46,
+    0x40, 0x1f, 0xfd, 0x59, 0xff, 0x50, 0x1, 0x40,
+    0x18, 0x0, 0x30, 0x2, 0x1, 0x0, 0x4, 0x81,
+    0x80, 0xa, 0x0, 0x30, 0x6, 0x0, 0x34, 0x0,
+    0x80, 0x7, 0x0, 0x18, 0x3, 0xf3, 0x40, 0x20,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x87, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xf8, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf6,
-    0x0, 0x1, 0x8f, 0xff, 0xfa, 0x20, 0x1, 0x8f,
-    0xff, 0xfa, 0x20, 0x0, 0x8f, 0xff, 0xfa, 0x20,
-    0x0, 0x0, 0xef, 0xf9, 0x20, 0x0, 0x0, 0x0,
-    0xef, 0xc5, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xd5, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xd6,
-    0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xd4, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0xff, 0xe4, 0x8c, 0x38, 0x7, 0xc3, 0x1c,
+    0xfe, 0x1, 0xc3, 0x1c, 0xe0, 0xe, 0x0, 0x86,
+    0x39, 0xc0, 0xb, 0xac, 0x3, 0x1c, 0xe0, 0x5,
+    0xda, 0x20, 0x8e, 0x70, 0x2, 0xed, 0x10, 0x4,
+    0xc0, 0x6, 0xda, 0x20, 0xf, 0x8f, 0x8, 0x3,
+    0xe2, 0x3, 0xad, 0x50, 0xf, 0x64, 0x90, 0x15,
+    0x6b, 0x0, 0x73, 0x6c, 0x90, 0x14, 0xeb, 0x0,
+    0x73, 0x6c, 0x90, 0x14, 0xea, 0x0, 0x73, 0x6c,
+    0x90, 0x16, 0x0, 0x7c, 0xdb, 0x24, 0x1, 0xfe,
+    0x6d, 0xa0,
 
     /* U+003D "=" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x8a, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8a, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xdf, 0xff, 0xf3, 0x80, 0x7f, 0xe5, 0x5f, 0xf8,
+    0xe2, 0xab, 0xfc, 0x80, 0x1f, 0xfc, 0xc8, 0xaa,
+    0xff, 0x22, 0xaf, 0xfc, 0x60, 0x1f, 0xf8,
 
     /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xd5, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xd3, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0xf8, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xf6, 0x0, 0x1, 0x8f, 0xff,
-    0xfb, 0x30, 0x1, 0x8f, 0xff, 0xfb, 0x30, 0x0,
-    0x8f, 0xff, 0xfb, 0x30, 0x0, 0x0, 0xef, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0xeb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xd6, 0xa0, 0x1f, 0xe5, 0xad, 0x50,
+    0xf, 0xc6, 0x5, 0x5a, 0xa0, 0x1e, 0xd8, 0x10,
+    0x2a, 0xd5, 0x0, 0xe7, 0xe9, 0x10, 0x2a, 0xd5,
+    0x0, 0xe6, 0xe9, 0x10, 0x2a, 0xd3, 0x0, 0xe6,
+    0xe9, 0x20, 0x2b, 0x0, 0xf9, 0xac, 0x40, 0x3f,
+    0x3f, 0x48, 0x87, 0x0, 0x43, 0x1f, 0x2, 0x9,
+    0x8c, 0x3, 0x1c, 0xe0, 0x4, 0xcb, 0x30, 0x8e,
+    0x70, 0x2, 0x65, 0x98, 0x4, 0xc0, 0x4, 0xcb,
+    0x30, 0xf, 0x26, 0x59, 0x80, 0x7d, 0x96, 0x60,
+    0x1f, 0xc0,
 
     /* U+003F "?" */
-    0xcf, 0xff, 0xec, 0x60, 0x0, 0xcf, 0xff, 0xff,
-    0xfd, 0x10, 0x8b, 0xbb, 0xdf, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x4f,
-    0xfa, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0xf9,
-    0x0, 0x0, 0x17, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0xa0, 0x0, 0xef, 0xff, 0xf9, 0x0, 0x0,
-    0xef, 0xd6, 0x20, 0x0, 0x0, 0xef, 0xc0, 0x0,
-    0x0, 0x0, 0xce, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x45, 0x30, 0x0, 0x0, 0x6, 0xff, 0xf3,
-    0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0, 0x3,
-    0xef, 0xc1, 0x0, 0x0,
+    0xcf, 0xfb, 0xb1, 0x80, 0x3e, 0x13, 0x9d, 0x10,
+    0x44, 0xc4, 0x0, 0x2d, 0x8, 0xbb, 0xb7, 0x4,
+    0xd, 0x40, 0x38, 0xe8, 0x1, 0xe0, 0x1e, 0x40,
+    0x3, 0x0, 0x78, 0x40, 0xe, 0x1, 0xe6, 0x0,
+    0x10, 0x6, 0x17, 0x80, 0x5, 0x0, 0x3b, 0xfa,
+    0x0, 0xa, 0x60, 0x1f, 0x35, 0x0, 0x71, 0x4e,
+    0xc8, 0x7, 0x85, 0x88, 0x3, 0x88, 0x58, 0x3,
+    0xec, 0xea, 0x0, 0xff, 0xe2, 0xa2, 0x98, 0x7,
+    0x9a, 0xeb, 0xc, 0x3, 0xbc, 0x2, 0x50, 0xe,
+    0xa1, 0x3, 0x70, 0xc,
 
     /* U+0040 "@" */
-    0x0, 0x1, 0x8c, 0xef, 0xda, 0x30, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x5, 0xff,
-    0xd6, 0x32, 0x5c, 0xff, 0x70, 0x1e, 0xfc, 0x0,
-    0x0, 0x0, 0xaf, 0xf1, 0x6f, 0xf2, 0x0, 0x0,
-    0x0, 0x1f, 0xf6, 0xbf, 0xb0, 0x0, 0x0, 0x0,
-    0xc, 0xf9, 0xdf, 0x80, 0x0, 0x0, 0x0, 0xb,
-    0xfb, 0xff, 0x60, 0x0, 0x3b, 0xdb, 0x4a, 0xfb,
-    0xff, 0x60, 0x1, 0xff, 0xff, 0xfd, 0xfb, 0xff,
-    0x60, 0x8, 0xff, 0x40, 0x6f, 0xfb, 0xff, 0x60,
-    0xb, 0xf9, 0x0, 0xd, 0xfb, 0xff, 0x60, 0xd,
-    0xf7, 0x0, 0xa, 0xfb, 0xff, 0x60, 0xd, 0xf7,
-    0x0, 0xa, 0xfb, 0xff, 0x60, 0xd, 0xf7, 0x0,
-    0xa, 0xfb, 0xff, 0x60, 0xd, 0xf7, 0x0, 0xa,
-    0xfb, 0xff, 0x60, 0xc, 0xf9, 0x0, 0xd, 0xf9,
-    0xff, 0x60, 0x7, 0xff, 0x41, 0x7f, 0xf4, 0xff,
-    0x60, 0x0, 0xdf, 0xff, 0xff, 0xb0, 0xdf, 0x80,
-    0x0, 0x19, 0xef, 0xd7, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfa, 0x65, 0x55, 0x10,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x1, 0x7c, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x86, 0x33, 0xbf, 0x68, 0xc0, 0x39, 0x79,
+    0xcc, 0x40, 0x97, 0x20, 0x2, 0x5a, 0x2, 0x9c,
+    0xda, 0x30, 0x77, 0x0, 0xd8, 0x1e, 0xb1, 0x92,
+    0xe2, 0x84, 0xb, 0x88, 0x70, 0x7, 0xac, 0x0,
+    0xfa, 0x8, 0x40, 0x1e, 0x13, 0xf, 0x60, 0x30,
+    0xf, 0xce, 0x4, 0x40, 0xe0, 0x8, 0xef, 0x6d,
+    0x4, 0x3, 0xe1, 0xc4, 0x24, 0xb7, 0x0, 0xfa,
+    0x40, 0x17, 0xf2, 0x40, 0x1f, 0x18, 0x32, 0x3,
+    0x10, 0x7, 0xcc, 0x1c, 0x1, 0x38, 0x7, 0xff,
+    0x94, 0x43, 0x80, 0x27, 0x2, 0x0, 0xeb, 0x6,
+    0x41, 0x72, 0xd, 0x0, 0xe7, 0x20, 0xbe, 0x80,
+    0x44, 0x10, 0x70, 0x5, 0x8c, 0x20, 0x51, 0x60,
+    0xc0, 0x80, 0x10, 0xcf, 0x7e, 0xb8, 0x3, 0x80,
+    0xcc, 0x1, 0xfe, 0x51, 0xd, 0x20, 0xf, 0xf6,
+    0x80, 0xed, 0x32, 0xac, 0x20, 0x18, 0xec, 0x41,
+    0x66, 0xaa, 0x40, 0xe, 0x4f, 0x83, 0x10, 0xf,
+    0x80,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0x6d,
-    0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0x39, 0xff,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x6, 0xff, 0x30,
-    0x0, 0x0, 0xd, 0xfc, 0x2, 0xff, 0x70, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0x5f, 0xf5, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0x9f,
-    0xf1, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0xdf, 0xe0,
-    0x0, 0x4f, 0xf7, 0x0, 0x1, 0xff, 0xd6, 0x66,
-    0x7f, 0xfa, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0xc, 0xff, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0xf, 0xfc, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x4f,
-    0xf8, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0xcf, 0xf1, 0x0,
-    0x0, 0x0, 0x7f, 0xf6,
+    0x0, 0xc5, 0xff, 0x60, 0x7, 0xf2, 0x0, 0x46,
+    0x1, 0xfd, 0x80, 0x18, 0xc0, 0x3f, 0x20, 0x28,
+    0x1, 0x0, 0x3e, 0x21, 0xc, 0x20, 0xc0, 0xf,
+    0x90, 0x0, 0xa8, 0x8, 0x1, 0xf7, 0x80, 0xf,
+    0xc0, 0x6, 0x1, 0xe4, 0x3, 0x4, 0x0, 0x20,
+    0x7, 0x9, 0x2, 0x1, 0x0, 0x30, 0x3, 0x90,
+    0x1, 0xa0, 0x4, 0x4, 0x0, 0xec, 0x0, 0x20,
+    0x0, 0xc0, 0x6, 0x1, 0x90, 0x4, 0x40, 0xc,
+    0x0, 0x20, 0x4, 0x24, 0x6, 0xcd, 0x18, 0x3,
+    0x40, 0x25, 0x0, 0x14, 0xcd, 0x0, 0x4, 0x0,
+    0xb0, 0x3, 0xf8, 0x48, 0x0, 0x80, 0xf, 0xfe,
+    0x90, 0x2, 0x0, 0xc, 0xc, 0x3, 0x90, 0x1,
+    0x80, 0x80, 0x4, 0x0, 0xe2, 0x10, 0x40, 0xc0,
+    0x6, 0x80, 0x79, 0x40, 0x49, 0x0, 0x8, 0x1,
+    0xec, 0x0, 0x20,
 
     /* U+0042 "B" */
-    0xcf, 0xff, 0xff, 0xfc, 0x81, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0xcf, 0xf7, 0x77,
-    0x9e, 0xff, 0xd0, 0xc, 0xff, 0x0, 0x0, 0x1d,
-    0xff, 0x40, 0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf8,
-    0xc, 0xff, 0x0, 0x0, 0x3, 0xff, 0x80, 0xcf,
-    0xf0, 0x0, 0x0, 0x5f, 0xf6, 0xc, 0xff, 0x0,
-    0x0, 0xd, 0xfe, 0x0, 0xcf, 0xf6, 0x66, 0x8e,
-    0xff, 0x40, 0xc, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0xc,
-    0xff, 0x0, 0x1, 0x6e, 0xff, 0x20, 0xcf, 0xf0,
-    0x0, 0x0, 0x4f, 0xfa, 0xc, 0xff, 0x0, 0x0,
-    0x0, 0xef, 0xe0, 0xcf, 0xf0, 0x0, 0x0, 0xd,
-    0xff, 0xc, 0xff, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0xcf, 0xf0, 0x0, 0x0, 0x9f, 0xfa, 0xc, 0xff,
-    0x77, 0x79, 0xdf, 0xff, 0x30, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0xc, 0xff, 0xff, 0xff, 0xea,
-    0x20, 0x0,
+    0xcf, 0xff, 0x64, 0x8, 0x7, 0xf8, 0xdf, 0xc8,
+    0x3, 0xa2, 0x26, 0x10, 0x1f, 0x0, 0xe7, 0x7a,
+    0x7c, 0x80, 0x90, 0x3, 0xf0, 0xd8, 0x3, 0x0,
+    0x3f, 0x94, 0x3, 0xff, 0x30, 0x3, 0x80, 0x3f,
+    0xa0, 0x5, 0x80, 0x33, 0x35, 0x1c, 0x41, 0x40,
+    0x1d, 0x33, 0x38, 0x9e, 0xa0, 0x7, 0xf8, 0xf1,
+    0x0, 0x3b, 0xfe, 0xe9, 0x11, 0x59, 0x0, 0x7c,
+    0x2d, 0x40, 0x8, 0x0, 0xfe, 0x41, 0x4, 0x0,
+    0xff, 0x18, 0x8, 0x7, 0xf8, 0x80, 0x40, 0x3f,
+    0xa4, 0x0, 0x80, 0x19, 0xde, 0x9d, 0x60, 0x4,
+    0x80, 0x68, 0x89, 0x88, 0x1, 0x26, 0x1, 0xf8,
+    0x57, 0x58, 0x0,
 
     /* U+0043 "C" */
-    0x0, 0x18, 0xdf, 0xfd, 0x81, 0x0, 0x3, 0xef,
-    0xff, 0xff, 0xfe, 0x30, 0x1e, 0xff, 0xea, 0xae,
-    0xff, 0xe0, 0x7f, 0xfb, 0x0, 0x0, 0xbf, 0xf7,
-    0xbf, 0xf2, 0x0, 0x0, 0x3f, 0xfb, 0xcf, 0xf0,
-    0x0, 0x0, 0xb, 0xb8, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0,
-    0xb, 0xb8, 0xbf, 0xf2, 0x0, 0x0, 0x3f, 0xfb,
-    0x7f, 0xfb, 0x0, 0x0, 0xbf, 0xf7, 0x1e, 0xff,
-    0xea, 0xae, 0xff, 0xe0, 0x3, 0xef, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0x18, 0xdf, 0xfd, 0x81, 0x0,
+    0x0, 0xc, 0x6f, 0xfb, 0x60, 0x40, 0x23, 0xf7,
+    0x20, 0x1, 0x3f, 0x98, 0xe, 0x88, 0xa, 0xa8,
+    0x40, 0x74, 0x18, 0x41, 0x3a, 0xa9, 0xc8, 0x2,
+    0xf8, 0x0, 0x90, 0xd, 0x0, 0xc, 0x70, 0x1,
+    0x0, 0x63, 0x44, 0x18, 0x80, 0x7e, 0xbb, 0x40,
+    0x7, 0xff, 0xfc, 0x3, 0xf8, 0x40, 0x3f, 0x5d,
+    0xa1, 0xc0, 0x4, 0x1, 0x8d, 0x10, 0x78, 0x0,
+    0x90, 0xd, 0x0, 0xc, 0x61, 0x4, 0xea, 0xa7,
+    0x20, 0xb, 0x8e, 0x88, 0xa, 0xa8, 0x40, 0x74,
+    0x0, 0x7e, 0xe4, 0x0, 0x27, 0xf3, 0x0,
 
     /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xeb, 0x40, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0xdf, 0xf9, 0x99, 0xcf,
-    0xff, 0x90, 0xdf, 0xf0, 0x0, 0x4, 0xff, 0xf1,
-    0xdf, 0xf0, 0x0, 0x0, 0x8f, 0xf6, 0xdf, 0xf0,
-    0x0, 0x0, 0x4f, 0xf8, 0xdf, 0xf0, 0x0, 0x0,
-    0x3f, 0xf9, 0xdf, 0xf0, 0x0, 0x0, 0x3f, 0xfa,
-    0xdf, 0xf0, 0x0, 0x0, 0x3f, 0xfa, 0xdf, 0xf0,
-    0x0, 0x0, 0x3f, 0xfa, 0xdf, 0xf0, 0x0, 0x0,
-    0x3f, 0xfa, 0xdf, 0xf0, 0x0, 0x0, 0x3f, 0xfa,
-    0xdf, 0xf0, 0x0, 0x0, 0x3f, 0xfa, 0xdf, 0xf0,
-    0x0, 0x0, 0x3f, 0xf9, 0xdf, 0xf0, 0x0, 0x0,
-    0x4f, 0xf8, 0xdf, 0xf0, 0x0, 0x0, 0x8f, 0xf6,
-    0xdf, 0xf0, 0x0, 0x4, 0xff, 0xf1, 0xdf, 0xf9,
-    0x99, 0xcf, 0xff, 0x80, 0xdf, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0xdf, 0xff, 0xff, 0xeb, 0x40, 0x0,
+    0xdf, 0xfe, 0xeb, 0x40, 0xf, 0xe1, 0x4b, 0xa0,
+    0xe, 0x66, 0x8c, 0x0, 0xb2, 0x1, 0xa6, 0x6c,
+    0xb0, 0x3, 0x8, 0x7, 0xc8, 0xe0, 0x7, 0x0,
+    0xfd, 0x80, 0xe, 0x0, 0xfc, 0xe0, 0x1, 0x0,
+    0xff, 0x8c, 0x3, 0xff, 0xf6, 0x60, 0x1f, 0x9c,
+    0x0, 0x20, 0x1f, 0xb0, 0x1, 0xc0, 0x1f, 0x23,
+    0x80, 0x1c, 0x2, 0x99, 0xb2, 0xc0, 0xe, 0x20,
+    0x13, 0x34, 0x60, 0x5, 0x80, 0xf, 0x85, 0x2e,
+    0x80, 0x0,
 
     /* U+0045 "E" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x9f, 0xfa, 0x99, 0x99,
-    0x99, 0x95, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf9, 0x77, 0x77, 0x77, 0x50, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x99, 0x99, 0x99, 0x95, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x9f, 0xff, 0xf4, 0x80, 0x7f, 0xf0, 0xd5, 0x9b,
+    0xec, 0x0, 0xa6, 0x7f, 0x28, 0x7, 0xff, 0x9e,
+    0x9d, 0xfc, 0xa0, 0x19, 0xa2, 0x3d, 0xc0, 0x1f,
+    0xfc, 0x4c, 0xff, 0xf5, 0x80, 0x7f, 0xfd, 0x26,
+    0x7f, 0x28, 0x4, 0xac, 0xdf, 0x60, 0x7, 0xfe,
 
     /* U+0046 "F" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xbf, 0xfa, 0xaa, 0xaa,
-    0xaa, 0xa8, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xfb, 0xbb, 0xbb, 0xbb, 0xb1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xf6, 0x0, 0x7f, 0xf0, 0xd5, 0x7f,
+    0x20, 0x5, 0x55, 0xfa, 0x0, 0x3f, 0xfe, 0x7f,
+    0xff, 0x84, 0x3, 0xff, 0x86, 0x89, 0xf8, 0x3,
+    0x55, 0xdf, 0xc2, 0x1, 0xff, 0xff, 0x0, 0xfe,
 
     /* U+0047 "G" */
-    0x0, 0x29, 0xdf, 0xfd, 0x71, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x2f, 0xff, 0xda, 0xae,
-    0xff, 0xd0, 0x9f, 0xfa, 0x0, 0x1, 0xdf, 0xf5,
-    0xdf, 0xf1, 0x0, 0x0, 0x5f, 0xf9, 0xef, 0xe0,
-    0x0, 0x0, 0x1b, 0xb7, 0xef, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x5, 0x99, 0x99, 0x96, 0xef, 0xe0, 0xa, 0xff,
-    0xff, 0xfb, 0xef, 0xe0, 0xa, 0xff, 0xff, 0xfb,
-    0xef, 0xe0, 0x0, 0x0, 0x1f, 0xfb, 0xef, 0xe0,
-    0x0, 0x0, 0x1f, 0xfb, 0xef, 0xe0, 0x0, 0x0,
-    0x2f, 0xfa, 0xcf, 0xf1, 0x0, 0x0, 0x4f, 0xf9,
-    0x9f, 0xf9, 0x0, 0x1, 0xcf, 0xf5, 0x2f, 0xff,
-    0xd9, 0xae, 0xff, 0xd0, 0x4, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x29, 0xdf, 0xfd, 0x81, 0x0,
+    0x0, 0x14, 0xef, 0xfb, 0x5c, 0x40, 0x25, 0xd6,
+    0x20, 0x1, 0x46, 0x10, 0x15, 0x0, 0x9, 0x54,
+    0x20, 0x5e, 0x16, 0x0, 0x5d, 0xaa, 0x79, 0x1,
+    0x2a, 0x0, 0x2c, 0x2, 0x18, 0x0, 0x61, 0x80,
+    0x88, 0x3, 0x22, 0x5c, 0x1, 0xf8, 0x6e, 0xce,
+    0x1, 0xff, 0xd1, 0x59, 0x9e, 0x60, 0xe, 0xf6,
+    0x6e, 0xd0, 0xf, 0xfe, 0x2d, 0x7f, 0xb8, 0x3,
+    0xff, 0x96, 0x60, 0x1, 0x20, 0x11, 0x0, 0x66,
+    0x0, 0x1a, 0x80, 0x20, 0x2, 0x18, 0x0, 0x65,
+    0x80, 0x1b, 0x66, 0xbc, 0xc0, 0x94, 0xac, 0x0,
+    0x4c, 0xa2, 0x3, 0xe0, 0x4, 0xd6, 0x20, 0x1,
+    0x3f, 0x90, 0x0,
 
     /* U+0048 "H" */
-    0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0,
-    0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0,
-    0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6,
-    0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0,
-    0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0,
-    0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6,
-    0xcf, 0xf9, 0x99, 0x99, 0xcf, 0xf6, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6,
-    0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0,
-    0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0,
-    0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6,
-    0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0,
-    0x0, 0x0, 0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0,
-    0x6f, 0xf6, 0xcf, 0xf0, 0x0, 0x0, 0x6f, 0xf6,
+    0xcf, 0xf0, 0x7, 0x37, 0xf9, 0x80, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfa, 0x67, 0xa8, 0x3, 0xcc, 0xdc,
+    0x60, 0x1f, 0xfc, 0x6f, 0xfe, 0x90, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0x30,
 
     /* U+0049 "I" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x4a, 0xaa, 0xdf, 0xfb,
-    0xaa, 0xa0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x4a, 0xaa,
-    0xdf, 0xfb, 0xaa, 0xa0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x7f, 0xff, 0xf0, 0x80, 0x7f, 0xe3, 0x55, 0x88,
+    0x0, 0x8a, 0xb0, 0xa5, 0x54, 0xe0, 0x8, 0xaa,
+    0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0x92, 0xaa, 0x70, 0x4, 0x55, 0x40, 0x6a, 0xb1,
+    0x0, 0x11, 0x56, 0x10, 0xf, 0xfc,
 
     /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0xf, 0xfd, 0x0, 0x0, 0x0, 0xdf,
-    0xf0, 0xd, 0xff, 0x10, 0x0, 0x1, 0xff, 0xe0,
-    0x9, 0xff, 0xa0, 0x0, 0xa, 0xff, 0xa0, 0x2,
-    0xff, 0xfd, 0xaa, 0xdf, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1, 0x9d,
-    0xff, 0xd9, 0x20, 0x0,
+    0x0, 0xff, 0x5f, 0xf8, 0x40, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xaf, 0xfb, 0x40,
+    0x3c, 0xc0, 0x1, 0x2, 0x2, 0x10, 0xc, 0x24,
+    0x2, 0x0, 0x40, 0x5, 0x80, 0x6b, 0x0, 0x20,
+    0x2, 0xc0, 0xb, 0xb5, 0x4d, 0x50, 0x4, 0x0,
+    0xa, 0xc0, 0x4, 0xaa, 0x20, 0x5, 0x90, 0x4,
+    0x9c, 0xc4, 0x0, 0x26, 0xd4, 0x0, 0x0,
 
     /* U+004B "K" */
-    0xdf, 0xf0, 0x0, 0x0, 0xd, 0xff, 0x3d, 0xff,
-    0x0, 0x0, 0x4, 0xff, 0xc0, 0xdf, 0xf0, 0x0,
-    0x0, 0xbf, 0xf4, 0xd, 0xff, 0x0, 0x0, 0x3f,
-    0xfd, 0x0, 0xdf, 0xf0, 0x0, 0xa, 0xff, 0x50,
-    0xd, 0xff, 0x0, 0x2, 0xff, 0xd0, 0x0, 0xdf,
-    0xf0, 0x0, 0x9f, 0xf6, 0x0, 0xd, 0xff, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0xdf, 0xf8, 0x8b, 0xff,
-    0x70, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x0, 0xd,
-    0xff, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0xdf, 0xf4, 0x0, 0xd, 0xff, 0x0, 0x6,
-    0xff, 0xb0, 0x0, 0xdf, 0xf0, 0x0, 0xe, 0xff,
-    0x20, 0xd, 0xff, 0x0, 0x0, 0x8f, 0xfa, 0x0,
-    0xdf, 0xf0, 0x0, 0x1, 0xff, 0xf1, 0xd, 0xff,
-    0x0, 0x0, 0x9, 0xff, 0x80, 0xdf, 0xf0, 0x0,
-    0x0, 0x2f, 0xff, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0xbf, 0xf7,
+    0xdf, 0xf0, 0x7, 0xb7, 0xfc, 0x60, 0x1f, 0x90,
+    0x80, 0xcc, 0x1, 0xfb, 0xc0, 0x10, 0x1, 0xf8,
+    0xd0, 0x9, 0x0, 0x3f, 0x48, 0x2, 0x0, 0x3f,
+    0x12, 0x81, 0x28, 0x7, 0xeb, 0x0, 0x58, 0x7,
+    0xe1, 0x60, 0x16, 0x0, 0xf4, 0x42, 0x80, 0x12,
+    0x1, 0xf3, 0xb9, 0x0, 0xc, 0x1, 0xff, 0x90,
+    0x3, 0xef, 0xf5, 0x80, 0x24, 0x3, 0xf9, 0x8,
+    0xd, 0x0, 0x3f, 0xac, 0x1, 0xe0, 0x1f, 0xcc,
+    0x20, 0x84, 0x1, 0xfc, 0xc0, 0x8, 0x0, 0xfe,
+    0x90, 0x2, 0x88, 0x7, 0xe1, 0x60, 0x4, 0x80,
+    0x7f, 0x58, 0x1, 0xc0, 0x3f, 0x89, 0x0, 0xe,
 
     /* U+004C "L" */
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa,
-    0xaa, 0xaa, 0xaa, 0xa3, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0xbf, 0xf0, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfe, 0x9b, 0xaa, 0xf8, 0xc0, 0x25,
+    0x5f, 0xe0, 0xf, 0xfc,
 
     /* U+004D "M" */
-    0x5f, 0xff, 0x90, 0x0, 0xf, 0xff, 0xf5, 0xff,
-    0xfe, 0x0, 0x5, 0xfe, 0xff, 0x5f, 0xed, 0xf2,
-    0x0, 0x9f, 0xbf, 0xf5, 0xff, 0x9f, 0x60, 0xd,
-    0xf8, 0xff, 0x5f, 0xf6, 0xfa, 0x2, 0xfc, 0x7f,
-    0xf5, 0xff, 0x3f, 0xe0, 0x6f, 0x88, 0xff, 0x5f,
-    0xf2, 0xcf, 0x3a, 0xf3, 0x9f, 0xf5, 0xff, 0x37,
-    0xf7, 0xef, 0x9, 0xff, 0x5f, 0xf4, 0x3f, 0xef,
-    0xa0, 0xaf, 0xf5, 0xff, 0x40, 0xef, 0xf6, 0xa,
-    0xff, 0x5f, 0xf4, 0xa, 0xff, 0x10, 0xaf, 0xf5,
-    0xff, 0x40, 0x13, 0x30, 0xb, 0xff, 0x5f, 0xf4,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0xff, 0x40, 0x0,
-    0x0, 0xb, 0xff, 0x5f, 0xf4, 0x0, 0x0, 0x0,
-    0xbf, 0xf5, 0xff, 0x40, 0x0, 0x0, 0xb, 0xff,
-    0x5f, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0xff,
-    0x40, 0x0, 0x0, 0xb, 0xff, 0x5f, 0xf4, 0x0,
-    0x0, 0x0, 0xbf, 0xf5, 0xff, 0x40, 0x0, 0x0,
-    0xb, 0xff,
+    0x5f, 0xfa, 0x40, 0x37, 0xfe, 0x0, 0xce, 0x1,
+    0x28, 0x8, 0x6, 0x12, 0x12, 0x0, 0x60, 0x28,
+    0x6, 0x14, 0x4, 0x0, 0x20, 0x18, 0x7, 0x78,
+    0x60, 0x11, 0xf, 0xc0, 0x39, 0x41, 0x1, 0x1,
+    0x3c, 0x3, 0x84, 0xc4, 0xf0, 0x2c, 0x40, 0x38,
+    0x6c, 0x11, 0x0, 0x60, 0x1e, 0x74, 0x9, 0x15,
+    0x3, 0x0, 0xf1, 0x88, 0x83, 0x0, 0x3f, 0x90,
+    0x0, 0xe0, 0x1f, 0xd7, 0x98, 0x10, 0x10, 0xf,
+    0x84, 0xcc, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe4,
+    0x80,
 
     /* U+004E "N" */
-    0xef, 0xfd, 0x0, 0x0, 0x1f, 0xf8, 0xef, 0xff,
-    0x20, 0x0, 0x1f, 0xf8, 0xef, 0xff, 0x70, 0x0,
-    0x1f, 0xf8, 0xef, 0xff, 0xd0, 0x0, 0x1f, 0xf8,
-    0xef, 0xbf, 0xf2, 0x0, 0x1f, 0xf8, 0xef, 0x9d,
-    0xf7, 0x0, 0x1f, 0xf8, 0xef, 0xa8, 0xfd, 0x0,
-    0x1f, 0xf8, 0xef, 0xa2, 0xff, 0x20, 0x1f, 0xf8,
-    0xef, 0xb0, 0xdf, 0x70, 0x1f, 0xf8, 0xef, 0xb0,
-    0x8f, 0xd0, 0x1f, 0xf8, 0xef, 0xb0, 0x3f, 0xf2,
-    0x1f, 0xf8, 0xef, 0xb0, 0xd, 0xf7, 0x1f, 0xf8,
-    0xef, 0xb0, 0x8, 0xfd, 0x1f, 0xf8, 0xef, 0xb0,
-    0x3, 0xff, 0x2f, 0xf8, 0xef, 0xb0, 0x0, 0xdf,
-    0x7f, 0xf8, 0xef, 0xb0, 0x0, 0x8f, 0xce, 0xf8,
-    0xef, 0xb0, 0x0, 0x3f, 0xff, 0xf8, 0xef, 0xb0,
-    0x0, 0xd, 0xff, 0xf8, 0xef, 0xb0, 0x0, 0x8,
-    0xff, 0xf8, 0xef, 0xb0, 0x0, 0x3, 0xff, 0xf8,
+    0xef, 0xf6, 0x80, 0x61, 0xff, 0x40, 0x4, 0x44,
+    0x0, 0xff, 0x94, 0x3, 0xfe, 0xa0, 0xf, 0xe4,
+    0x2, 0x20, 0x7, 0xe2, 0x20, 0x28, 0x7, 0xe3,
+    0x50, 0xa0, 0xf, 0xea, 0x2, 0x20, 0x7, 0xc2,
+    0x44, 0x5, 0x0, 0xfe, 0x50, 0xa0, 0xf, 0xeb,
+    0x2, 0x20, 0x7, 0xe3, 0x20, 0x50, 0xf, 0xe5,
+    0xa, 0x0, 0xfe, 0xb0, 0x23, 0x0, 0xfc, 0x64,
+    0xa, 0x1, 0xfc, 0xa1, 0x62, 0x1, 0xfa, 0xc0,
+    0xc4, 0x3, 0xf1, 0x90, 0x7, 0xfc, 0xa0, 0x1f,
+    0xf5, 0x80, 0x60,
 
     /* U+004F "O" */
-    0x0, 0x29, 0xdf, 0xfc, 0x70, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x1f, 0xff, 0xd9, 0xaf,
-    0xff, 0xa0, 0x8f, 0xf9, 0x0, 0x1, 0xef, 0xf2,
-    0xcf, 0xf1, 0x0, 0x0, 0x7f, 0xf6, 0xef, 0xe0,
-    0x0, 0x0, 0x5f, 0xf7, 0xef, 0xe0, 0x0, 0x0,
-    0x4f, 0xf8, 0xef, 0xe0, 0x0, 0x0, 0x4f, 0xf8,
-    0xef, 0xe0, 0x0, 0x0, 0x4f, 0xf8, 0xef, 0xe0,
-    0x0, 0x0, 0x4f, 0xf8, 0xef, 0xe0, 0x0, 0x0,
-    0x4f, 0xf8, 0xef, 0xe0, 0x0, 0x0, 0x4f, 0xf8,
-    0xef, 0xe0, 0x0, 0x0, 0x4f, 0xf8, 0xef, 0xe0,
-    0x0, 0x0, 0x4f, 0xf8, 0xef, 0xe0, 0x0, 0x0,
-    0x5f, 0xf7, 0xcf, 0xf1, 0x0, 0x0, 0x7f, 0xf6,
-    0x8f, 0xf9, 0x0, 0x1, 0xef, 0xf2, 0x1f, 0xff,
-    0xd9, 0xaf, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0x29, 0xef, 0xfc, 0x70, 0x0,
+    0x0, 0x14, 0xef, 0xfb, 0x1c, 0x3, 0x26, 0xb1,
+    0x0, 0xe, 0x30, 0x40, 0x6c, 0x0, 0x4c, 0xa0,
+    0x3, 0xb0, 0x90, 0x3, 0x6c, 0xd7, 0x8, 0x29,
+    0x20, 0x2, 0x0, 0x21, 0x90, 0x2, 0x10, 0x8,
+    0x80, 0x31, 0x0, 0x4, 0x3, 0xf0, 0x80, 0x3c,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xc5, 0x10, 0x7,
+    0x90, 0x8, 0x80, 0x31, 0x0, 0x5, 0x0, 0x10,
+    0x1, 0xc, 0x80, 0x12, 0x40, 0xd, 0xb3, 0x5c,
+    0x20, 0xa4, 0x34, 0x0, 0x26, 0x50, 0x1, 0xd8,
+    0x1, 0x75, 0x84, 0x0, 0x71, 0x82, 0x0,
 
     /* U+0050 "P" */
-    0xdf, 0xff, 0xff, 0xfe, 0xa4, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0xdf, 0xf9, 0x99,
-    0x9c, 0xff, 0xf7, 0xd, 0xff, 0x0, 0x0, 0x6,
-    0xff, 0xe0, 0xdf, 0xf0, 0x0, 0x0, 0xb, 0xff,
-    0x4d, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0xdf,
-    0xf0, 0x0, 0x0, 0x7, 0xff, 0x6d, 0xff, 0x0,
-    0x0, 0x0, 0xbf, 0xf4, 0xdf, 0xf0, 0x0, 0x0,
-    0x6f, 0xfe, 0xd, 0xff, 0x99, 0x99, 0xcf, 0xff,
-    0x70, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x90, 0xd,
-    0xff, 0xff, 0xff, 0xea, 0x40, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xdf, 0xff, 0x75, 0x20, 0x7, 0xf8, 0x56, 0xe4,
+    0x3, 0x99, 0xb1, 0x80, 0x19, 0xc0, 0x34, 0xce,
+    0xc9, 0x0, 0x48, 0x7, 0xf3, 0x20, 0xa, 0x0,
+    0x7f, 0x60, 0x0, 0x80, 0x3f, 0xf9, 0x58, 0x0,
+    0x20, 0xf, 0xcc, 0x80, 0x28, 0x1, 0x4c, 0xec,
+    0x90, 0x4, 0x80, 0x66, 0x6c, 0x60, 0x6, 0x70,
+    0xf, 0xc2, 0xb7, 0x20, 0x1d, 0xff, 0xba, 0x90,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xc7,
 
     /* U+0051 "Q" */
-    0x0, 0x2, 0x9d, 0xfe, 0xc6, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x3, 0xff, 0xfd,
-    0x9a, 0xef, 0xfb, 0x0, 0xaf, 0xf8, 0x0, 0x1,
-    0xdf, 0xf3, 0xf, 0xfe, 0x0, 0x0, 0x5, 0xff,
-    0x80, 0xff, 0xc0, 0x0, 0x0, 0x2f, 0xfa, 0x1f,
-    0xfb, 0x0, 0x0, 0x2, 0xff, 0xa1, 0xff, 0xb0,
-    0x0, 0x0, 0x2f, 0xfa, 0x1f, 0xfb, 0x0, 0x0,
-    0x2, 0xff, 0xa1, 0xff, 0xb0, 0x0, 0x0, 0x2f,
-    0xfa, 0x1f, 0xfb, 0x0, 0x0, 0x2, 0xff, 0xa1,
-    0xff, 0xb0, 0x0, 0x0, 0x2f, 0xfa, 0x1f, 0xfb,
-    0x0, 0x0, 0x2, 0xff, 0xa1, 0xff, 0xb0, 0x0,
-    0x0, 0x2f, 0xfa, 0xf, 0xfc, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0xef, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0xa, 0xff, 0x90, 0x0, 0x1d, 0xff, 0x30, 0x3f,
-    0xff, 0xd9, 0xaf, 0xff, 0xc0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x29, 0xdf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xa0,
+    0x0, 0x8a, 0x77, 0xfb, 0x18, 0x3, 0x97, 0x58,
+    0x80, 0x4e, 0x70, 0x40, 0x7, 0x40, 0x2, 0x65,
+    0x10, 0x3a, 0x0, 0x48, 0x1, 0xf6, 0x6b, 0xc8,
+    0x10, 0xc1, 0x40, 0x60, 0x2, 0x18, 0x0, 0x58,
+    0x4, 0x40, 0x1c, 0xe0, 0x2, 0x10, 0x3, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xf9, 0xa2, 0x0, 0x70,
+    0xf, 0xf0, 0x81, 0x80, 0x73, 0x80, 0x8, 0x10,
+    0x1, 0x20, 0x10, 0xc0, 0x2, 0xc2, 0x40, 0xd,
+    0xb3, 0x5c, 0x40, 0x66, 0x3, 0xa0, 0x1, 0x32,
+    0x80, 0xb, 0x40, 0x25, 0xd6, 0x20, 0xd, 0xa2,
+    0x1, 0x8a, 0x77, 0xd4, 0x0, 0xe0, 0x1f, 0xd6,
+    0x0, 0x91, 0x0, 0xfc, 0x2e, 0x3, 0x20, 0x1f,
+    0xd2, 0x0, 0x71, 0x0, 0xfc, 0x30, 0x0, 0xb0,
 
     /* U+0052 "R" */
-    0xcf, 0xff, 0xff, 0xfd, 0x81, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0xcf, 0xf9, 0x99,
-    0xae, 0xff, 0xf1, 0xc, 0xff, 0x0, 0x0, 0xb,
-    0xff, 0x90, 0xcf, 0xf0, 0x0, 0x0, 0x1f, 0xfe,
-    0xc, 0xff, 0x0, 0x0, 0x0, 0xef, 0xf0, 0xcf,
-    0xf0, 0x0, 0x0, 0xd, 0xff, 0xc, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xd0, 0xcf, 0xf0, 0x0, 0x0,
-    0xaf, 0xf8, 0xc, 0xff, 0x99, 0x9a, 0xef, 0xff,
-    0x10, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x40, 0xc,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0xcf, 0xf0,
-    0x1, 0xff, 0xe0, 0x0, 0xc, 0xff, 0x0, 0x9,
-    0xff, 0x50, 0x0, 0xcf, 0xf0, 0x0, 0x2f, 0xfd,
-    0x0, 0xc, 0xff, 0x0, 0x0, 0xbf, 0xf4, 0x0,
-    0xcf, 0xf0, 0x0, 0x4, 0xff, 0xb0, 0xc, 0xff,
-    0x0, 0x0, 0xd, 0xff, 0x30, 0xcf, 0xf0, 0x0,
-    0x0, 0x6f, 0xfa, 0xc, 0xff, 0x0, 0x0, 0x0,
-    0xef, 0xf1,
+    0xcf, 0xff, 0x6c, 0x8, 0x7, 0xf8, 0x9f, 0xd0,
+    0x3, 0x99, 0xa5, 0x10, 0x1b, 0x10, 0xd, 0x33,
+    0x57, 0x20, 0x2, 0x0, 0x3f, 0xa8, 0x0, 0xe0,
+    0x1f, 0xc2, 0x20, 0x10, 0xf, 0xf1, 0x80, 0x7f,
+    0xc2, 0x40, 0x40, 0x1f, 0xd6, 0x0, 0x50, 0xd,
+    0x33, 0x57, 0x28, 0x2, 0x40, 0x33, 0x34, 0xa2,
+    0x0, 0xb1, 0x0, 0xfe, 0x3e, 0x40, 0xe, 0xff,
+    0x70, 0x0, 0x84, 0x3, 0xf0, 0xb0, 0xa, 0x80,
+    0x7f, 0x58, 0x2, 0x0, 0x3f, 0x89, 0x0, 0x90,
+    0x3, 0xfb, 0xc0, 0x1e, 0x1, 0xfc, 0x84, 0x8,
+    0x60, 0x1f, 0xd6, 0x0, 0x90, 0xf, 0xe6, 0x10,
+    0x51,
 
     /* U+0053 "S" */
-    0x0, 0x2, 0x9d, 0xfe, 0xb6, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x2, 0xff, 0xfc,
-    0x9a, 0xff, 0xfa, 0x0, 0x9f, 0xf8, 0x0, 0x2,
-    0xef, 0xf1, 0xc, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0x50, 0xdf, 0xe0, 0x0, 0x0, 0x14, 0x41, 0xc,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfb,
-    0x61, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfd, 0x3b, 0xb5, 0x0, 0x0, 0x0,
-    0xdf, 0xe3, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfc,
-    0xe, 0xff, 0x50, 0x0, 0xa, 0xff, 0x80, 0x6f,
-    0xff, 0xc9, 0xae, 0xff, 0xe1, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x3a, 0xef, 0xfd,
-    0x81, 0x0,
+    0x0, 0x8a, 0x77, 0xfa, 0xd8, 0x3, 0x97, 0x58,
+    0x80, 0x52, 0x70, 0x2, 0x2a, 0x0, 0x1b, 0x28,
+    0x0, 0xe8, 0x1, 0x60, 0x7, 0xc9, 0xad, 0x10,
+    0x51, 0x5, 0x0, 0x40, 0x4, 0x52, 0x0, 0x40,
+    0x10, 0x10, 0xe, 0x6b, 0xb2, 0x0, 0x80, 0x90,
+    0x6, 0x14, 0x40, 0x85, 0x80, 0x3d, 0x0, 0x3f,
+    0x39, 0x1, 0x5f, 0xdb, 0x8, 0x7, 0x61, 0x80,
+    0x49, 0x3c, 0xe0, 0x18, 0x72, 0x90, 0x3, 0x44,
+    0x0, 0x39, 0x6f, 0xed, 0x40, 0xe, 0x80, 0x1f,
+    0x25, 0x48, 0x3, 0x80, 0x3f, 0x98, 0x0, 0xe7,
+    0x76, 0x50, 0xf, 0x10, 0x18, 0x22, 0x38, 0x3,
+    0x84, 0x80, 0x8c, 0x41, 0x14, 0x3, 0x58, 0x1,
+    0x2, 0x0, 0x15, 0x93, 0x5c, 0xa0, 0x32, 0xc,
+    0xe0, 0x3, 0x65, 0x10, 0x1d, 0x10, 0x4, 0x62,
+    0x88, 0x0, 0x9f, 0xcc, 0x0,
 
     /* U+0054 "T" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x6a, 0xaa,
-    0xad, 0xff, 0xba, 0xaa, 0xa2, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x30, 0x0, 0x0,
+    0xaf, 0xff, 0xfc, 0x80, 0x1f, 0xfc, 0x2c, 0x55,
+    0xc4, 0x0, 0x45, 0x5c, 0xcc, 0xaa, 0xc8, 0x0,
+    0x8a, 0xac, 0x40, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xf8,
 
     /* U+0055 "U" */
-    0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0,
-    0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0, 0x0, 0x0,
-    0x5f, 0xf8, 0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8,
-    0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0,
-    0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0, 0x0, 0x0,
-    0x5f, 0xf8, 0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8,
-    0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0,
-    0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0, 0x0, 0x0,
-    0x5f, 0xf8, 0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8,
-    0xef, 0xe0, 0x0, 0x0, 0x5f, 0xf8, 0xef, 0xe0,
-    0x0, 0x0, 0x5f, 0xf8, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xcf, 0xf1, 0x0, 0x0, 0x8f, 0xf6,
-    0x8f, 0xfa, 0x0, 0x2, 0xef, 0xf2, 0x2f, 0xff,
-    0xd9, 0xaf, 0xff, 0xb0, 0x5, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x2a, 0xef, 0xfc, 0x70, 0x0,
+    0xef, 0xe0, 0xe, 0x5f, 0xf4, 0x0, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1e, 0x30, 0x10, 0xf,
+    0xde, 0x20, 0x1, 0x0, 0xda, 0x0, 0x14, 0x0,
+    0x58, 0x4, 0x4c, 0x0, 0x4a, 0x0, 0x2e, 0xcd,
+    0x68, 0x82, 0x11, 0x28, 0x0, 0x4c, 0xa0, 0x2,
+    0xa0, 0x2, 0xea, 0x88, 0x0, 0xe3, 0x44, 0x0,
 
     /* U+0056 "V" */
-    0xcf, 0xf1, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x4f, 0xf8,
-    0x0, 0x0, 0x0, 0xef, 0xe0, 0xf, 0xfc, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0xc, 0xff, 0x0, 0x0,
-    0x5, 0xff, 0x60, 0x8, 0xff, 0x30, 0x0, 0x9,
-    0xff, 0x20, 0x5, 0xff, 0x70, 0x0, 0xd, 0xfe,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0xf, 0xfb, 0x0,
-    0x0, 0xdf, 0xe0, 0x0, 0x4f, 0xf7, 0x0, 0x0,
-    0x9f, 0xf2, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x5f,
-    0xf6, 0x0, 0xbf, 0xf0, 0x0, 0x0, 0x1f, 0xfa,
-    0x0, 0xef, 0xb0, 0x0, 0x0, 0xe, 0xfd, 0x2,
-    0xff, 0x70, 0x0, 0x0, 0xa, 0xff, 0x15, 0xff,
-    0x30, 0x0, 0x0, 0x6, 0xff, 0x49, 0xff, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x7c, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xbf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xc0, 0x0, 0x0,
+    0xcf, 0xf0, 0x80, 0x79, 0xff, 0xcc, 0x80, 0x4,
+    0x0, 0xf6, 0x0, 0x13, 0x0, 0x1a, 0x1, 0xe5,
+    0x1, 0x24, 0x0, 0x20, 0x7, 0x10, 0x82, 0x0,
+    0xc, 0xc, 0x3, 0x9c, 0x1, 0x80, 0x4, 0x0,
+    0x18, 0x6, 0xc0, 0x2, 0x0, 0x34, 0x0, 0x80,
+    0x19, 0x0, 0x48, 0x0, 0x80, 0xc, 0x0, 0xc4,
+    0xa, 0x1, 0x9, 0x2, 0x80, 0x48, 0x0, 0xc0,
+    0xc, 0x80, 0x24, 0x0, 0x30, 0x2, 0x0, 0x6c,
+    0x0, 0x20, 0x3, 0x0, 0x6, 0x1, 0x90, 0x1,
+    0x80, 0x5, 0x4, 0x0, 0xe1, 0x10, 0x38, 0x10,
+    0x86, 0x0, 0x79, 0x0, 0x85, 0xc0, 0x8, 0x1,
+    0xec, 0x0, 0x2e, 0x0, 0xc, 0x3, 0xc8, 0x0,
+    0x35, 0x3, 0x0, 0xf8, 0x84, 0x30, 0xc1, 0x0,
+    0x3f, 0x20, 0x20, 0x3, 0x0, 0x3f, 0x68, 0x6,
+    0x40, 0xf, 0xc8, 0x1, 0x18, 0x7, 0x0,
 
     /* U+0057 "W" */
-    0x8f, 0xe0, 0x0, 0x8f, 0xf3, 0x0, 0x4f, 0xf1,
-    0x6f, 0xf0, 0x0, 0xaf, 0xf5, 0x0, 0x5f, 0xf0,
-    0x4f, 0xf1, 0x0, 0xce, 0xf7, 0x0, 0x7f, 0xe0,
-    0x3f, 0xf3, 0x0, 0xec, 0xf9, 0x0, 0x8f, 0xc0,
-    0x1f, 0xf4, 0x0, 0xfa, 0xfa, 0x0, 0xaf, 0xa0,
-    0xf, 0xf6, 0x2, 0xf8, 0xec, 0x0, 0xbf, 0x80,
-    0xe, 0xf7, 0x4, 0xf6, 0xce, 0x0, 0xdf, 0x70,
-    0xc, 0xf9, 0x6, 0xf4, 0xaf, 0x0, 0xef, 0x50,
-    0xa, 0xfa, 0x8, 0xf3, 0x8f, 0x20, 0xff, 0x30,
-    0x9, 0xfc, 0xa, 0xf1, 0x7f, 0x41, 0xff, 0x10,
-    0x7, 0xfd, 0xc, 0xf0, 0x5f, 0x53, 0xff, 0x0,
-    0x5, 0xff, 0xe, 0xd0, 0x3f, 0x74, 0xfe, 0x0,
-    0x3, 0xff, 0x1f, 0xb0, 0x1f, 0x96, 0xfc, 0x0,
-    0x2, 0xff, 0x4f, 0x90, 0xf, 0xb7, 0xfa, 0x0,
-    0x0, 0xff, 0x7f, 0x70, 0xe, 0xd9, 0xf9, 0x0,
-    0x0, 0xef, 0xaf, 0x50, 0xc, 0xea, 0xf7, 0x0,
-    0x0, 0xdf, 0xcf, 0x40, 0xa, 0xfc, 0xf5, 0x0,
-    0x0, 0xbf, 0xef, 0x20, 0x9, 0xfe, 0xf3, 0x0,
-    0x0, 0x9f, 0xff, 0x0, 0x7, 0xff, 0xf2, 0x0,
-    0x0, 0x8f, 0xfe, 0x0, 0x5, 0xff, 0xf0, 0x0,
+    0x8f, 0xe0, 0xa, 0x3f, 0xc6, 0x0, 0x4f, 0xf0,
+    0xf0, 0x8, 0x4, 0x40, 0x6, 0x0, 0x8, 0x0,
+    0x48, 0x0, 0x20, 0x6, 0x10, 0x20, 0x1, 0x0,
+    0x83, 0x80, 0x8, 0x0, 0x44, 0xe, 0x0, 0x78,
+    0x10, 0x10, 0x1, 0xc0, 0x2, 0xc0, 0x60, 0x2,
+    0x6, 0x1, 0x0, 0x10, 0x10, 0x10, 0xb0, 0x0,
+    0x40, 0x80, 0x2, 0x2, 0xc, 0x1c, 0x44, 0x0,
+    0x30, 0x78, 0x0, 0x83, 0x80, 0x80, 0x98, 0x40,
+    0x6, 0x4, 0x0, 0x60, 0x30, 0xe0, 0x72, 0x2,
+    0x1, 0x6, 0x0, 0x18, 0x30, 0x10, 0x17, 0x83,
+    0x8, 0x0, 0x80, 0x1c, 0x2, 0xc, 0x2, 0x40,
+    0x24, 0x0, 0x10, 0x1, 0x1, 0x1, 0x10, 0x18,
+    0x9, 0xc0, 0x40, 0x26, 0x0, 0x8, 0x98, 0x8,
+    0x38, 0x80, 0x80, 0x21, 0x0, 0x28, 0x10, 0x8,
+    0x10, 0x83, 0x0, 0x44, 0x0, 0x30, 0xe0, 0x0,
+    0xb7, 0x1, 0x80, 0x61, 0xd, 0x2, 0x0, 0x11,
+    0x98, 0x38, 0x3, 0x18, 0x30, 0x8, 0x1, 0x85,
+    0x80, 0x80, 0x33, 0x1, 0x3, 0x0, 0xc, 0x8,
+    0x18, 0x3, 0x10, 0x8, 0x10, 0x3, 0x80, 0x40,
+    0x40, 0x30, 0x80, 0x4, 0x2, 0x20, 0x8, 0x80,
+    0x0,
 
     /* U+0058 "X" */
-    0x8, 0xff, 0x90, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0x1f, 0xff, 0x10, 0x0, 0x6, 0xff, 0x90, 0x0,
-    0x8f, 0xf9, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x1,
-    0xff, 0xf1, 0x0, 0x6f, 0xf9, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0xd, 0xff, 0x10, 0x0, 0x0, 0xe,
-    0xff, 0x15, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x3a, 0xff, 0x50,
-    0x0, 0x0, 0x3, 0xff, 0xb0, 0x2f, 0xfd, 0x0,
-    0x0, 0x0, 0xbf, 0xf3, 0x0, 0xaf, 0xf6, 0x0,
-    0x0, 0x4f, 0xfb, 0x0, 0x3, 0xff, 0xd0, 0x0,
-    0xc, 0xff, 0x30, 0x0, 0xb, 0xff, 0x60, 0x5,
-    0xff, 0xb0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0xdf,
-    0xf3, 0x0, 0x0, 0x0, 0xbf, 0xf7,
+    0x8, 0xff, 0x48, 0x7, 0xb7, 0xfc, 0x41, 0x20,
+    0x6, 0x10, 0xc, 0xc4, 0xc, 0x40, 0x2e, 0x0,
+    0x80, 0xd, 0x60, 0xb, 0x0, 0xa4, 0x0, 0xc2,
+    0x0, 0x62, 0x6, 0x20, 0x8, 0x60, 0x1, 0x20,
+    0xb, 0x0, 0x40, 0x7, 0x38, 0x83, 0x8a, 0x90,
+    0x38, 0x80, 0x7a, 0x40, 0xd, 0x0, 0x9, 0x0,
+    0xf9, 0xc4, 0x20, 0x81, 0xc4, 0x3, 0xf4, 0x80,
+    0x43, 0x0, 0x1f, 0xce, 0x20, 0x6, 0x0, 0xff,
+    0x10, 0x80, 0x10, 0x3, 0xfd, 0x0, 0x11, 0xa0,
+    0x7, 0xe2, 0x50, 0x40, 0x4, 0x0, 0x7e, 0x90,
+    0x4, 0x28, 0x1a, 0x80, 0x78, 0xd0, 0x10, 0xe0,
+    0x1, 0x0, 0x1e, 0x80, 0x4, 0x1, 0x28, 0x13,
+    0x0, 0x64, 0x40, 0x21, 0x80, 0x24, 0x1, 0x60,
+    0x1a, 0x0, 0x10, 0x1, 0x1a, 0x1, 0x30, 0x1,
+    0x4c, 0x10, 0xc0, 0x34, 0x0, 0x20, 0x1, 0x0,
+    0x8, 0x0, 0xe3, 0x40, 0x17,
 
     /* U+0059 "Y" */
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x2,
-    0xff, 0xc0, 0x0, 0x0, 0x2f, 0xfb, 0x0, 0xb,
-    0xff, 0x30, 0x0, 0x9, 0xff, 0x40, 0x0, 0x3f,
-    0xfa, 0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0xcf,
-    0xf2, 0x0, 0x7f, 0xf6, 0x0, 0x0, 0x5, 0xff,
-    0x80, 0xd, 0xfe, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xf6,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0xcf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
+    0x1f, 0xf7, 0x0, 0x7c, 0x9f, 0xe9, 0x16, 0x1,
+    0x50, 0xf, 0x78, 0x2, 0xc2, 0xc0, 0x12, 0x1,
+    0xc4, 0x80, 0x84, 0x4, 0x80, 0x66, 0x0, 0xd6,
+    0x0, 0xf0, 0xa, 0x0, 0x12, 0x1, 0x98, 0x9,
+    0x0, 0x23, 0x30, 0x29, 0x0, 0x1c, 0x1, 0x60,
+    0x1d, 0x20, 0xa, 0x0, 0x50, 0xb, 0x0, 0x72,
+    0x88, 0x38, 0x21, 0x4, 0x80, 0x7d, 0x20, 0x6,
+    0xf0, 0x3, 0x0, 0x7c, 0xe0, 0xa, 0x40, 0x61,
+    0x0, 0xfc, 0xe0, 0x60, 0xb, 0x0, 0xfe, 0xa0,
+    0x9, 0x8, 0x3, 0xf8, 0x90, 0x1, 0xe0, 0x1f,
+    0xf1, 0x0, 0x1c, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xc8,
 
     /* U+005A "Z" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x7a, 0xaa, 0xaa, 0xaa,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x7, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x2, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf4, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb,
-    0xaa, 0xaa, 0xaa, 0xa4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xbf, 0xff, 0xf1, 0x80, 0x7f, 0xec, 0x55, 0xf8,
+    0x3, 0x3d, 0x57, 0xb8, 0x0, 0x66, 0x0, 0xfa,
+    0x40, 0x1e, 0x1, 0xf3, 0x10, 0x21, 0x80, 0x7d,
+    0x0, 0x9, 0x0, 0xf9, 0xc4, 0x18, 0x80, 0x3c,
+    0x30, 0x0, 0x80, 0xf, 0xa0, 0x1, 0x2, 0x1,
+    0xe2, 0x60, 0x17, 0x0, 0xfa, 0x40, 0x16, 0x1,
+    0xf2, 0x20, 0xd, 0x40, 0x3e, 0x80, 0x4, 0x0,
+    0x7c, 0xc6, 0x8, 0x80, 0xf, 0xa0, 0x1, 0x20,
+    0x1f, 0x38, 0x83, 0x10, 0x7, 0xd4, 0x0, 0x2a,
+    0xaf, 0x90, 0xc0, 0x8, 0xab, 0xf1, 0x80, 0x7f,
+    0xe0,
 
     /* U+005B "[" */
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfe, 0xff,
-    0xfa, 0xaa, 0x9f, 0xfe, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0xff, 0xe0, 0x0, 0xf,
-    0xfe, 0x0, 0x0, 0xff, 0xe0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0xff, 0xe0, 0x0, 0xf, 0xfe, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0xf, 0xfe, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0xff, 0xfa, 0xaa,
-    0x9f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe0,
+    0xff, 0xf7, 0x0, 0x7f, 0x95, 0x67, 0x0, 0xd,
+    0x55, 0x20, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x48,
+    0xd5, 0x52, 0x1, 0x2a, 0xce, 0x1, 0xf0,
 
     /* U+005C "\\" */
-    0x1f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xa0,
+    0x1f, 0xf6, 0x80, 0x7f, 0xa, 0x1, 0x18, 0x7,
+    0xf7, 0x0, 0x28, 0x3, 0xf9, 0x40, 0xe, 0x1,
+    0xfe, 0x60, 0x15, 0x0, 0xfe, 0xd0, 0x7, 0x0,
+    0x7f, 0x20, 0x82, 0x8, 0x7, 0xf3, 0x0, 0x1c,
+    0x3, 0xfa, 0x80, 0x14, 0x1, 0xfc, 0x46, 0x6,
+    0x40, 0x1f, 0xd4, 0x0, 0xa0, 0xf, 0xe7, 0x0,
+    0x30, 0x7, 0xf0, 0xa0, 0xa, 0x0, 0x7f, 0x70,
+    0x3, 0x40, 0x3f, 0x94, 0x41, 0x80, 0x3f, 0xce,
+    0x0, 0x50, 0xf, 0xea, 0x0, 0x70, 0x7, 0xf1,
+    0x90, 0x20, 0x80, 0x7f, 0x50, 0x1, 0x80, 0x3f,
+    0x94, 0x1, 0x40, 0x1f, 0xc4, 0x60, 0x44, 0x0,
+    0xfe, 0xa0, 0x5, 0x0, 0x7f, 0x30, 0x1, 0x80,
+    0x3f, 0xca, 0x2, 0x80, 0x1f, 0xdc, 0x0, 0xe0,
 
     /* U+005D "]" */
-    0x4f, 0xff, 0xff, 0xf9, 0x4f, 0xff, 0xff, 0xf9,
-    0x2a, 0xaa, 0xbf, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x4f, 0xf9,
-    0x2a, 0xaa, 0xbf, 0xf9, 0x4f, 0xff, 0xff, 0xf9,
-    0x4f, 0xff, 0xff, 0xf9,
+    0x4f, 0xff, 0x48, 0x7, 0xe6, 0x55, 0x90, 0x2,
+    0x2a, 0xab, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xc2, 0xaa, 0xbc, 0x2, 0x65, 0x59, 0x0, 0x3f,
+    0xe0,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x4, 0x88, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xef,
-    0x70, 0x0, 0x0, 0x3, 0xff, 0x38, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x2f, 0xf4, 0x0, 0x0,
-    0x2f, 0xf5, 0x0, 0xbf, 0xb0, 0x0, 0x8, 0xfe,
-    0x0, 0x4, 0xff, 0x20, 0x0, 0xff, 0x80, 0x0,
-    0xe, 0xf9, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x8f,
-    0xf1, 0xd, 0xfb, 0x0, 0x0, 0x1, 0xff, 0x70,
+    0x0, 0xe4, 0x88, 0x10, 0x7, 0xf5, 0x3b, 0xac,
+    0x3, 0xf3, 0x8, 0x1, 0x80, 0x3f, 0x50, 0x30,
+    0x83, 0x80, 0x78, 0xcc, 0x14, 0xc1, 0x40, 0x1e,
+    0x90, 0x33, 0x50, 0x12, 0x0, 0x62, 0x50, 0x90,
+    0x24, 0xf, 0x0, 0xd4, 0x2, 0xa0, 0xf, 0x4,
+    0x20, 0x9, 0xc1, 0x80, 0x24, 0x10, 0xb0, 0x3,
+    0x0, 0x28, 0x3, 0x30, 0x30, 0x85, 0x82, 0x10,
+    0x6, 0x90, 0x3, 0x0,
 
     /* U+005F "_" */
-    0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x38, 0x8f, 0xfc, 0x8, 0xef, 0xff, 0x80, 0x3f,
+    0xf8, 0x60,
 
     /* U+0060 "`" */
-    0x8, 0xbb, 0x40, 0x0, 0x2e, 0xfe, 0x10, 0x0,
-    0x4f, 0xfb, 0x0, 0x0, 0x6f, 0xf8,
+    0x8, 0xbb, 0x20, 0x5, 0x4a, 0x94, 0x20, 0x2,
+    0xa0, 0x1a, 0x0, 0x92, 0x41, 0x20,
 
     /* U+0061 "a" */
-    0x0, 0x3, 0xae, 0xff, 0xd8, 0x10, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x3, 0xff, 0xf9,
-    0x77, 0xcf, 0xfd, 0x0, 0x9f, 0xf4, 0x0, 0x0,
-    0xcf, 0xf3, 0x2, 0x33, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x2a, 0xef, 0xff, 0xff, 0xff, 0x60, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xe, 0xff, 0x60, 0x0,
-    0x6, 0xff, 0x64, 0xff, 0x90, 0x0, 0x0, 0x6f,
-    0xf6, 0x5f, 0xf7, 0x0, 0x0, 0x8, 0xff, 0x64,
-    0xff, 0xc0, 0x0, 0x2, 0xef, 0xf6, 0xe, 0xff,
-    0xc7, 0x69, 0xfd, 0xff, 0x60, 0x5f, 0xff, 0xff,
-    0xfe, 0x7f, 0xf6, 0x0, 0x3b, 0xef, 0xd9, 0x15,
-    0xff, 0x60,
+    0x0, 0x8e, 0xbb, 0xfd, 0xb0, 0x20, 0x19, 0xf1,
+    0x44, 0x0, 0x4f, 0xe6, 0x0, 0x38, 0x0, 0x34,
+    0x40, 0xc0, 0x78, 0x1, 0x40, 0xb, 0x97, 0x76,
+    0x18, 0x11, 0x85, 0xe6, 0x10, 0x3, 0x58, 0x1,
+    0x40, 0x8c, 0xc0, 0x1c, 0x20, 0x1c, 0x55, 0xdf,
+    0xfa, 0x40, 0x32, 0x6a, 0x88, 0x7, 0xf5, 0x0,
+    0x27, 0xff, 0x48, 0x4, 0x82, 0xc, 0xc0, 0xf,
+    0xc2, 0x0, 0xe0, 0xe, 0xe0, 0x8, 0x40, 0x16,
+    0x1, 0x89, 0x80, 0x24, 0x10, 0x3c, 0x76, 0x9d,
+    0x30, 0xd, 0x60, 0x3, 0x89, 0x61, 0xa0, 0xc,
+    0xb8, 0x82, 0x4, 0xde, 0x40, 0x10,
 
     /* U+0062 "b" */
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x4c, 0xff, 0xb3, 0x0, 0xdf, 0xf5, 0xff, 0xff,
-    0xff, 0x40, 0xdf, 0xee, 0xd9, 0x9e, 0xff, 0xe0,
-    0xdf, 0xfb, 0x0, 0x0, 0xdf, 0xf4, 0xdf, 0xf2,
-    0x0, 0x0, 0x6f, 0xf7, 0xdf, 0xf0, 0x0, 0x0,
-    0x4f, 0xf8, 0xdf, 0xf0, 0x0, 0x0, 0x4f, 0xf8,
-    0xdf, 0xf0, 0x0, 0x0, 0x4f, 0xf8, 0xdf, 0xf0,
-    0x0, 0x0, 0x4f, 0xf8, 0xdf, 0xf0, 0x0, 0x0,
-    0x4f, 0xf8, 0xdf, 0xf2, 0x0, 0x0, 0x6f, 0xf7,
-    0xdf, 0xfa, 0x0, 0x0, 0xdf, 0xf4, 0xdf, 0xfd,
-    0xd9, 0x9e, 0xff, 0xe0, 0xdf, 0xf5, 0xff, 0xff,
-    0xff, 0x40, 0xdf, 0xf0, 0x4c, 0xff, 0xb3, 0x0,
+    0xdf, 0xf0, 0x7, 0xff, 0xc5, 0x33, 0xfd, 0x66,
+    0x1, 0xcb, 0x66, 0x0, 0x4c, 0x40, 0x8, 0x6c,
+    0x99, 0x82, 0x0, 0xa0, 0x8, 0x57, 0x66, 0x5c,
+    0x40, 0x28, 0x1, 0x48, 0x6, 0xb0, 0x1, 0x80,
+    0x44, 0x1, 0x88, 0x1, 0xe0, 0x1f, 0xfe, 0x72,
+    0x0, 0xc4, 0x0, 0xf0, 0xa, 0x0, 0x35, 0x80,
+    0xc, 0x2, 0x7d, 0x99, 0x71, 0x0, 0xa0, 0x5,
+    0x4, 0xcc, 0x10, 0x5, 0x0, 0x65, 0xb3, 0x0,
+    0x26, 0x20, 0x0,
 
     /* U+0063 "c" */
-    0x0, 0x18, 0xdf, 0xfd, 0x92, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x1f, 0xff, 0xda, 0x9d,
-    0xff, 0xf1, 0x8f, 0xfa, 0x0, 0x0, 0xaf, 0xf8,
-    0xcf, 0xf1, 0x0, 0x0, 0x1f, 0xfc, 0xef, 0xe0,
-    0x0, 0x0, 0x1, 0x21, 0xef, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x0, 0x0, 0x2, 0x22, 0xcf, 0xf1, 0x0, 0x0,
-    0x1f, 0xfb, 0x8f, 0xfa, 0x0, 0x0, 0xaf, 0xf8,
-    0x1f, 0xff, 0xd9, 0x9d, 0xff, 0xf1, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x19, 0xdf, 0xfd,
-    0x92, 0x0,
+    0x0, 0xc, 0x6f, 0xfb, 0x64, 0x80, 0x24, 0xe7,
+    0x20, 0x1, 0x36, 0xa0, 0xd, 0x80, 0x9, 0x58,
+    0x80, 0x16, 0x32, 0x0, 0x5d, 0xa9, 0xd5, 0x0,
+    0x4a, 0x0, 0x2c, 0x3, 0x58, 0x1, 0x8, 0x4,
+    0x40, 0x18, 0x7b, 0x74, 0x1, 0xfc, 0x24, 0x20,
+    0x1f, 0xfd, 0x52, 0x2c, 0x2, 0x20, 0xc, 0x3b,
+    0xa9, 0x40, 0x5, 0x80, 0x6b, 0x0, 0x1c, 0x80,
+    0x17, 0x66, 0x5a, 0xa0, 0x9, 0x1b, 0x0, 0x13,
+    0x30, 0x80, 0x16, 0x20, 0x9c, 0xc4, 0x0, 0x26,
+    0xd4, 0x0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x7d,
-    0xfe, 0x91, 0x5f, 0xf6, 0xa, 0xff, 0xff, 0xfd,
-    0x6f, 0xf6, 0x5f, 0xff, 0xc9, 0xaf, 0xcf, 0xf6,
-    0xbf, 0xf7, 0x0, 0x2, 0xff, 0xf6, 0xef, 0xf0,
-    0x0, 0x0, 0x9f, 0xf6, 0xff, 0xe0, 0x0, 0x0,
-    0x6f, 0xf6, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xf6,
-    0xff, 0xd0, 0x0, 0x0, 0x6f, 0xf6, 0xff, 0xd0,
-    0x0, 0x0, 0x6f, 0xf6, 0xff, 0xe0, 0x0, 0x0,
-    0x6f, 0xf6, 0xef, 0xf0, 0x0, 0x0, 0x9f, 0xf6,
-    0xbf, 0xf7, 0x0, 0x2, 0xff, 0xf6, 0x5f, 0xff,
-    0xc8, 0xaf, 0xcf, 0xf6, 0xa, 0xff, 0xff, 0xfd,
-    0x6f, 0xf6, 0x0, 0x7d, 0xfe, 0x91, 0x5f, 0xf6,
+    0x0, 0xfc, 0xdf, 0xe6, 0x0, 0xff, 0xf3, 0x3e,
+    0xff, 0x48, 0x98, 0x6, 0xa8, 0x20, 0x16, 0xc3,
+    0x0, 0x95, 0x40, 0x3, 0x65, 0x2a, 0x0, 0xb8,
+    0x1, 0x19, 0x35, 0xa6, 0x1, 0x28, 0x1, 0xc0,
+    0x22, 0x60, 0x8, 0x40, 0x40, 0x3b, 0xc0, 0x38,
+    0xc0, 0x3f, 0xfa, 0xe6, 0x1, 0xfc, 0x20, 0x20,
+    0x1d, 0xe0, 0x12, 0x80, 0x1c, 0x2, 0x26, 0x0,
+    0xb8, 0x1, 0x19, 0x15, 0xa6, 0x1, 0x2a, 0x80,
+    0x6, 0xea, 0x54, 0x1, 0xaa, 0x8, 0x5, 0xb0,
+    0xc0, 0x20,
 
     /* U+0065 "e" */
-    0x0, 0x29, 0xdf, 0xec, 0x70, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x2f, 0xff, 0x85, 0x6b,
-    0xff, 0xc0, 0x9f, 0xf4, 0x0, 0x0, 0xaf, 0xf3,
-    0xef, 0xd0, 0x0, 0x0, 0x3f, 0xf7, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
-    0x1, 0x10, 0x9f, 0xf7, 0x0, 0x0, 0xaf, 0xf4,
-    0x2f, 0xff, 0xb7, 0x8c, 0xff, 0xd0, 0x5, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x29, 0xef, 0xfc,
-    0x70, 0x0,
+    0x0, 0x14, 0xef, 0xf6, 0x38, 0x6, 0x5d, 0x62,
+    0x1, 0x38, 0xd1, 0x2, 0xa0, 0x3, 0xd4, 0xa0,
+    0x16, 0x85, 0x80, 0x2e, 0x15, 0xad, 0x40, 0xcc,
+    0xe0, 0x48, 0x1, 0xa4, 0x0, 0x82, 0xc, 0x1,
+    0xc4, 0x0, 0xe0, 0x2, 0x7f, 0xf7, 0x0, 0x7f,
+    0xf1, 0x53, 0xff, 0xf4, 0x80, 0x7f, 0xe1, 0x5,
+    0x0, 0xf0, 0x88, 0x1c, 0x5, 0xc0, 0x35, 0x77,
+    0x12, 0xc0, 0x11, 0x6f, 0x18, 0xa0, 0x48, 0x54,
+    0x0, 0x48, 0x73, 0x1, 0xf0, 0x2, 0xeb, 0x8,
+    0x0, 0xe3, 0x88, 0x0,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x8d, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x4f,
-    0xfe, 0x99, 0x99, 0x70, 0x0, 0x8, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf3, 0x0, 0x0, 0x6, 0xaa, 0xad,
-    0xff, 0xba, 0xaa, 0xa8, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30,
-    0x0, 0x0,
+    0x0, 0xf4, 0x6f, 0xfe, 0xd0, 0xe, 0xb7, 0x20,
+    0xf, 0xe4, 0x40, 0xb, 0x36, 0xa0, 0xd, 0x80,
+    0xb, 0x99, 0xce, 0x1, 0x84, 0x0, 0xc0, 0x1f,
+    0xfd, 0x36, 0xaa, 0x90, 0x1, 0x15, 0x5a, 0x31,
+    0x56, 0x20, 0x2, 0x2a, 0xf0, 0x7, 0xff, 0x6,
+    0xbf, 0xe6, 0x0, 0x67, 0xfe, 0xd0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0x78,
 
     /* U+0067 "g" */
-    0x0, 0x6c, 0xfe, 0xa2, 0x5f, 0xf6, 0x9, 0xff,
-    0xff, 0xfe, 0x7f, 0xf6, 0x4f, 0xff, 0xc9, 0xaf,
-    0xef, 0xf6, 0xaf, 0xf9, 0x0, 0x2, 0xff, 0xf6,
-    0xdf, 0xf0, 0x0, 0x0, 0x9f, 0xf6, 0xef, 0xe0,
-    0x0, 0x0, 0x6f, 0xf6, 0xef, 0xe0, 0x0, 0x0,
-    0x6f, 0xf6, 0xef, 0xe0, 0x0, 0x0, 0x6f, 0xf6,
-    0xef, 0xe0, 0x0, 0x0, 0x6f, 0xf6, 0xdf, 0xf0,
-    0x0, 0x0, 0x9f, 0xf6, 0xaf, 0xf7, 0x0, 0x1,
-    0xff, 0xf6, 0x4f, 0xff, 0xb7, 0x9e, 0xef, 0xf6,
-    0xa, 0xff, 0xff, 0xfe, 0x7f, 0xf6, 0x0, 0x6d,
-    0xfe, 0xa2, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x78,
-    0x88, 0x9d, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0xff, 0xff, 0xfd, 0x81, 0x0,
+    0x0, 0x36, 0x7f, 0x51, 0x2f, 0xf9, 0x82, 0x64,
+    0x60, 0x2b, 0x84, 0x1, 0x23, 0x0, 0xd, 0x94,
+    0x64, 0x2, 0xe0, 0x3, 0x64, 0xd6, 0x88, 0x4,
+    0xe0, 0x9, 0x0, 0x89, 0x80, 0x23, 0x1, 0x0,
+    0xef, 0x0, 0xff, 0xed, 0x98, 0x8, 0x7, 0x78,
+    0x4, 0xe0, 0x7, 0x0, 0x85, 0x80, 0x2e, 0x0,
+    0x45, 0xbc, 0xf8, 0x80, 0x48, 0xa0, 0x4, 0x86,
+    0x9, 0x0, 0xd5, 0x24, 0x2, 0xb8, 0x20, 0x1c,
+    0xdb, 0xfd, 0x44, 0x1, 0xff, 0x84, 0x0, 0x60,
+    0x1f, 0xa8, 0x0, 0xe0, 0x7, 0x88, 0xa7, 0x48,
+    0xc, 0x80, 0x10, 0xef, 0x31, 0x0, 0xf0, 0x7,
+    0xe2, 0x7f, 0x20,
 
     /* U+0068 "h" */
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x5c, 0xfe, 0xb3, 0x0, 0xdf, 0xf5, 0xff, 0xff,
-    0xff, 0x40, 0xdf, 0xfd, 0xd8, 0x9e, 0xff, 0xd0,
-    0xdf, 0xfa, 0x0, 0x1, 0xef, 0xf4, 0xdf, 0xf2,
-    0x0, 0x0, 0x8f, 0xf6, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
+    0xdf, 0xf0, 0x7, 0xff, 0xc5, 0x73, 0xfa, 0xcc,
+    0x3, 0x96, 0x8c, 0x5, 0x31, 0x0, 0x34, 0x13,
+    0xb0, 0x80, 0x24, 0x3, 0x3e, 0xc4, 0xf8, 0x81,
+    0x20, 0x5, 0x0, 0x10, 0xb0, 0x0, 0x80, 0x22,
+    0x0, 0xda, 0x0, 0x10, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x54,
 
     /* U+0069 "i" */
-    0x0, 0x0, 0x3d, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x89, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x3a, 0xaa, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xe0, 0x0, 0x0, 0x8a, 0xaa, 0xaf,
-    0xff, 0xaa, 0xaa, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70,
+    0x0, 0xc7, 0xbf, 0x20, 0x1f, 0xd0, 0x40, 0xc4,
+    0x1, 0xf8, 0x80, 0x23, 0x0, 0xfd, 0x2e, 0xd6,
+    0x20, 0x1f, 0xd1, 0x28, 0x1, 0xff, 0xc6, 0x6f,
+    0xff, 0x70, 0x7, 0xff, 0x19, 0x57, 0x80, 0x3f,
+    0x1d, 0x56, 0x10, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x62, 0x2a, 0xb0, 0x80, 0xd5, 0x64, 0x65, 0x5c,
+    0x1, 0x2a, 0xe3, 0x0, 0xff, 0xe0, 0x80,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x29, 0x81, 0x0, 0x0, 0x0,
-    0xef, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x6e, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xf9, 0xef, 0xff, 0xff, 0xff, 0xf9,
-    0x8a, 0xaa, 0xaa, 0xbf, 0xf9, 0x0, 0x0, 0x0,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x4f,
-    0xf9, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0,
-    0x3, 0xef, 0xf3, 0x7a, 0xaa, 0xcf, 0xff, 0xb0,
-    0xcf, 0xff, 0xff, 0xfc, 0x10, 0xcf, 0xff, 0xfc,
-    0x70, 0x0,
+    0x0, 0xf1, 0x4c, 0x8, 0x7, 0xb1, 0x9f, 0x40,
+    0x3c, 0x20, 0x2, 0x0, 0xf4, 0x88, 0xac, 0x3,
+    0xcd, 0xdc, 0x50, 0xf, 0xf7, 0x7f, 0xfe, 0x90,
+    0xf, 0xf3, 0x2a, 0xf2, 0x0, 0x51, 0x55, 0xd0,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xeb, 0x38, 0x7,
+    0xf1, 0x80, 0x38, 0x3, 0x8e, 0x40, 0x8, 0xf5,
+    0x56, 0x60, 0x41, 0xe, 0xd5, 0x63, 0x0, 0x1d,
+    0x0, 0x78, 0xe3, 0x4, 0x0,
 
     /* U+006B "k" */
-    0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x20, 0x0, 0x0, 0xef, 0xf3, 0xbf,
-    0xf2, 0x0, 0x0, 0x9f, 0xf8, 0xb, 0xff, 0x20,
-    0x0, 0x3f, 0xfe, 0x0, 0xbf, 0xf2, 0x0, 0xc,
-    0xff, 0x50, 0xb, 0xff, 0x20, 0x7, 0xff, 0xb0,
-    0x0, 0xbf, 0xf2, 0x1, 0xff, 0xf2, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xb, 0xff, 0x87, 0x9f,
-    0xfd, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0xbf, 0xf7,
-    0x0, 0xb, 0xff, 0x20, 0x2, 0xff, 0xf1, 0x0,
-    0xbf, 0xf2, 0x0, 0x9, 0xff, 0xa0, 0xb, 0xff,
-    0x20, 0x0, 0x1e, 0xff, 0x30, 0xbf, 0xf2, 0x0,
-    0x0, 0x6f, 0xfc, 0xb, 0xff, 0x20, 0x0, 0x0,
-    0xcf, 0xf6,
+    0xbf, 0xf1, 0x0, 0x7f, 0xfe, 0xbb, 0xfc, 0x60,
+    0x1f, 0xa4, 0x41, 0xcc, 0x3, 0xe3, 0x60, 0x18,
+    0x0, 0xfd, 0xe0, 0xb, 0x0, 0xfc, 0xe6, 0x8,
+    0xa0, 0x1f, 0xc, 0x0, 0x24, 0x3, 0xdb, 0xfc,
+    0x0, 0x82, 0x0, 0xff, 0x8c, 0x3, 0xe7, 0x86,
+    0x0, 0x48, 0x7, 0xd4, 0xf2, 0x80, 0x4e, 0x1,
+    0xfd, 0x20, 0x8, 0x10, 0xf, 0xc4, 0xc0, 0xb,
+    0x0, 0xfe, 0x81, 0x5, 0x30, 0xf, 0xc3, 0x0,
+    0xf, 0x0, 0xfe, 0x63, 0x3, 0x60,
 
     /* U+006C "l" */
-    0x4f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2a,
-    0xaa, 0xac, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xca, 0xaa, 0xa4, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xf7,
+    0x4f, 0xff, 0x98, 0x3, 0xff, 0x92, 0xca, 0xb8,
+    0xc0, 0x3f, 0x8a, 0xab, 0x58, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xd1, 0x10, 0xf,
+    0xfe, 0x11, 0x80, 0x30, 0x3, 0xfe, 0x40, 0x2,
+    0xe5, 0x56, 0x40, 0xe, 0x19, 0x0, 0x1a, 0xae,
+    0x30, 0xf, 0x35, 0x98, 0x7, 0x80,
 
     /* U+006D "m" */
-    0xaf, 0xc4, 0xdf, 0x90, 0x4d, 0xfa, 0x0, 0xaf,
-    0xce, 0xff, 0xf7, 0xff, 0xff, 0x90, 0xaf, 0xf8,
-    0x3d, 0xff, 0x83, 0xdf, 0xf0, 0xaf, 0xf0, 0x6,
-    0xff, 0x0, 0x6f, 0xf2, 0xaf, 0xe0, 0x5, 0xff,
-    0x0, 0x5f, 0xf3, 0xaf, 0xe0, 0x5, 0xff, 0x0,
-    0x5f, 0xf3, 0xaf, 0xe0, 0x5, 0xff, 0x0, 0x5f,
-    0xf3, 0xaf, 0xe0, 0x5, 0xff, 0x0, 0x5f, 0xf3,
-    0xaf, 0xe0, 0x5, 0xff, 0x0, 0x5f, 0xf3, 0xaf,
-    0xe0, 0x5, 0xff, 0x0, 0x5f, 0xf3, 0xaf, 0xe0,
-    0x5, 0xff, 0x0, 0x5f, 0xf3, 0xaf, 0xe0, 0x5,
-    0xff, 0x0, 0x5f, 0xf3, 0xaf, 0xe0, 0x5, 0xff,
-    0x0, 0x5f, 0xf3, 0xaf, 0xe0, 0x5, 0xff, 0x0,
-    0x5f, 0xf3, 0xaf, 0xe0, 0x5, 0xff, 0x0, 0x5f,
-    0xf3,
+    0xaf, 0xc4, 0xdf, 0x90, 0x4d, 0xfa, 0x0, 0xea,
+    0x20, 0x67, 0xb2, 0x5, 0x90, 0x8, 0xdb, 0x8,
+    0x21, 0xf0, 0x81, 0x80, 0x34, 0x1d, 0x80, 0x20,
+    0xec, 0x0, 0x40, 0x1, 0x0, 0x18, 0x6, 0x30,
+    0x0, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfe, 0xa0,
 
     /* U+006E "n" */
-    0xdf, 0xf0, 0x5c, 0xfe, 0xb3, 0x0, 0xdf, 0xf5,
-    0xff, 0xff, 0xff, 0x40, 0xdf, 0xfd, 0xd8, 0x9e,
-    0xff, 0xd0, 0xdf, 0xfa, 0x0, 0x1, 0xef, 0xf4,
-    0xdf, 0xf2, 0x0, 0x0, 0x8f, 0xf6, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7,
+    0xdf, 0xf0, 0x2e, 0x7f, 0x59, 0x80, 0x72, 0xd1,
+    0x80, 0xa6, 0x20, 0x6, 0x82, 0x76, 0x10, 0x4,
+    0x80, 0x67, 0xd8, 0x9f, 0x10, 0x24, 0x0, 0xa0,
+    0x2, 0x16, 0x0, 0x10, 0x4, 0x40, 0x1b, 0x40,
+    0x2, 0x1, 0xff, 0xff, 0x0, 0xff, 0xea, 0x80,
 
     /* U+006F "o" */
-    0x0, 0x29, 0xdf, 0xfc, 0x70, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x2f, 0xff, 0xd9, 0xae,
-    0xff, 0xb0, 0x9f, 0xf8, 0x0, 0x1, 0xdf, 0xf3,
-    0xef, 0xf0, 0x0, 0x0, 0x6f, 0xf7, 0xff, 0xd0,
-    0x0, 0x0, 0x3f, 0xf9, 0xff, 0xd0, 0x0, 0x0,
-    0x3f, 0xf9, 0xff, 0xd0, 0x0, 0x0, 0x3f, 0xf9,
-    0xff, 0xd0, 0x0, 0x0, 0x3f, 0xf9, 0xff, 0xd0,
-    0x0, 0x0, 0x3f, 0xf9, 0xef, 0xf0, 0x0, 0x0,
-    0x6f, 0xf7, 0x9f, 0xf8, 0x0, 0x1, 0xdf, 0xf3,
-    0x2f, 0xff, 0xc9, 0xae, 0xff, 0xb0, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x29, 0xef, 0xfc,
-    0x70, 0x0,
+    0x0, 0x14, 0xef, 0xfb, 0x1c, 0x3, 0x2e, 0xb1,
+    0x0, 0xe, 0x34, 0x40, 0xa8, 0x0, 0x4c, 0xa2,
+    0x5, 0x41, 0x60, 0x7, 0xd9, 0xaf, 0x20, 0x43,
+    0x70, 0x4, 0x0, 0x43, 0x60, 0x4, 0x10, 0x20,
+    0xe, 0x50, 0x7, 0x0, 0x7f, 0xf9, 0x4, 0x8,
+    0x3, 0x94, 0x1, 0xce, 0x0, 0x80, 0x8, 0x6c,
+    0x0, 0x96, 0x0, 0x7c, 0x9a, 0xf2, 0x4, 0x32,
+    0xa0, 0x1, 0xb2, 0x88, 0x15, 0x0, 0x17, 0x58,
+    0x40, 0x7, 0x1a, 0x20,
 
     /* U+0070 "p" */
-    0xdf, 0xf0, 0x4c, 0xff, 0xb3, 0x0, 0xdf, 0xf5,
-    0xff, 0xff, 0xff, 0x40, 0xdf, 0xfd, 0xd9, 0x9e,
-    0xff, 0xe0, 0xdf, 0xfb, 0x0, 0x0, 0xdf, 0xf4,
-    0xdf, 0xf2, 0x0, 0x0, 0x6f, 0xf7, 0xdf, 0xf0,
-    0x0, 0x0, 0x4f, 0xf8, 0xdf, 0xf0, 0x0, 0x0,
-    0x4f, 0xf8, 0xdf, 0xf0, 0x0, 0x0, 0x4f, 0xf8,
-    0xdf, 0xf0, 0x0, 0x0, 0x4f, 0xf8, 0xdf, 0xf0,
-    0x0, 0x0, 0x4f, 0xf8, 0xdf, 0xf2, 0x0, 0x0,
-    0x6f, 0xf7, 0xdf, 0xfa, 0x0, 0x0, 0xdf, 0xf4,
-    0xdf, 0xed, 0xd9, 0x9e, 0xff, 0xe0, 0xdf, 0xf4,
-    0xff, 0xff, 0xff, 0x40, 0xdf, 0xf0, 0x4c, 0xff,
-    0xb3, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf0, 0x26, 0x7f, 0xac, 0xc0, 0x39, 0x6c,
+    0xc0, 0x9, 0x88, 0x1, 0xa0, 0x99, 0x82, 0x0,
+    0xa0, 0xc, 0xdb, 0x32, 0xe2, 0x1, 0x40, 0xa,
+    0x40, 0x35, 0x80, 0xc, 0x2, 0x20, 0xc, 0x40,
+    0xf, 0x0, 0xff, 0xf3, 0x90, 0x6, 0x20, 0x7,
+    0x80, 0x50, 0x1, 0xac, 0x0, 0x60, 0x1, 0x7d,
+    0x99, 0x71, 0x0, 0xa0, 0x0, 0x64, 0x99, 0x82,
+    0x0, 0xa0, 0xc, 0x96, 0x60, 0x4, 0xc4, 0x0,
+    0xe4, 0xcf, 0xf5, 0x98, 0x7, 0xff, 0x98,
 
     /* U+0071 "q" */
-    0x0, 0x7d, 0xfe, 0x91, 0x5f, 0xf6, 0xa, 0xff,
-    0xff, 0xfd, 0x6f, 0xf6, 0x5f, 0xff, 0xc8, 0xaf,
-    0xcf, 0xf6, 0xbf, 0xf7, 0x0, 0x2, 0xff, 0xf6,
-    0xef, 0xf0, 0x0, 0x0, 0x9f, 0xf6, 0xff, 0xd0,
-    0x0, 0x0, 0x6f, 0xf6, 0xff, 0xd0, 0x0, 0x0,
-    0x6f, 0xf6, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xf6,
-    0xff, 0xd0, 0x0, 0x0, 0x6f, 0xf6, 0xff, 0xd0,
-    0x0, 0x0, 0x6f, 0xf6, 0xef, 0xf0, 0x0, 0x0,
-    0x9f, 0xf6, 0xbf, 0xf7, 0x0, 0x2, 0xff, 0xf6,
-    0x5f, 0xff, 0xc8, 0xaf, 0xcf, 0xf6, 0xa, 0xff,
-    0xff, 0xfd, 0x6f, 0xf6, 0x0, 0x7d, 0xfe, 0x91,
-    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
+    0x0, 0x3e, 0xff, 0x48, 0xaf, 0xf9, 0x82, 0xa0,
+    0x80, 0x5b, 0xc, 0x2, 0x55, 0x0, 0xd, 0xd4,
+    0xa8, 0x2, 0xe0, 0x4, 0x64, 0x56, 0x98, 0x4,
+    0xa0, 0x7, 0x0, 0x89, 0x80, 0x21, 0x2, 0x0,
+    0xef, 0x0, 0xff, 0xf3, 0x88, 0x10, 0x7, 0x78,
+    0x4, 0xa0, 0x7, 0x0, 0x89, 0x80, 0x2e, 0x0,
+    0x46, 0x45, 0x69, 0x80, 0x4a, 0xa0, 0x1, 0xba,
+    0x95, 0x0, 0x6a, 0x82, 0x1, 0x6c, 0x30, 0xe,
+    0x7d, 0xfe, 0x91, 0x30, 0xf, 0xff, 0x38,
 
     /* U+0072 "r" */
-    0x4f, 0xf7, 0x19, 0xef, 0xd8, 0x0, 0x4, 0xff,
-    0x8c, 0xff, 0xff, 0xfc, 0x0, 0x4f, 0xfc, 0xfa,
-    0x8b, 0xff, 0xf7, 0x4, 0xff, 0xf3, 0x0, 0x6,
-    0xff, 0xd0, 0x4f, 0xfb, 0x0, 0x0, 0xe, 0xff,
-    0x4, 0xff, 0x80, 0x0, 0x0, 0xcf, 0xf0, 0x4f,
-    0xf8, 0x0, 0x0, 0x8, 0xbb, 0x4, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x4f, 0xf3, 0x8c, 0xf7, 0xec, 0x0, 0x7b, 0xf5,
+    0x84, 0x9, 0xf0, 0x3, 0x90, 0xd5, 0xd0, 0x0,
+    0x6e, 0x1, 0x8f, 0x2a, 0x2e, 0x40, 0x14, 0x1,
+    0x90, 0xc0, 0x26, 0x10, 0x20, 0xc, 0x60, 0x1c,
+    0x40, 0x1f, 0xf9, 0x12, 0x0, 0xff, 0x45, 0xd8,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xc5,
 
     /* U+0073 "s" */
-    0x0, 0x8, 0xdf, 0xff, 0xea, 0x30, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x8, 0xff, 0xd6,
-    0x55, 0x9f, 0xff, 0x10, 0xcf, 0xf1, 0x0, 0x0,
-    0x8f, 0xf5, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf9, 0x31, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x36, 0x8a,
-    0xdf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x5, 0x54, 0x0, 0x0, 0x1, 0xff, 0xa0,
-    0xff, 0xe0, 0x0, 0x0, 0x4f, 0xf9, 0xa, 0xff,
-    0xd7, 0x66, 0x8f, 0xff, 0x40, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x8, 0xdf, 0xff, 0xeb,
-    0x50, 0x0,
+    0x0, 0xa3, 0x7f, 0xee, 0xa3, 0x0, 0x87, 0x5c,
+    0x80, 0x21, 0x5c, 0x60, 0x4, 0x90, 0x14, 0xd5,
+    0x18, 0x1, 0x22, 0x8, 0x0, 0xc6, 0x55, 0x4b,
+    0x80, 0x10, 0x4, 0x4, 0x40, 0x1a, 0x3f, 0xca,
+    0xe, 0x3, 0x26, 0x20, 0x1f, 0x70, 0x1, 0xb3,
+    0xbf, 0x65, 0x0, 0x24, 0x91, 0x0, 0xc4, 0xd7,
+    0x0, 0x13, 0x76, 0x4b, 0xa9, 0x0, 0x1c, 0xc0,
+    0x31, 0xb4, 0x56, 0xc0, 0x2, 0xc1, 0x54, 0x80,
+    0x1c, 0xc0, 0x2, 0xa, 0xa8, 0x3, 0x94, 0x0,
+    0x60, 0xa0, 0x3a, 0xec, 0xc8, 0xb0, 0x6, 0x85,
+    0x90, 0x14, 0x4c, 0x9c, 0x0, 0xa8, 0x3, 0xae,
+    0x40, 0x10, 0xa5, 0x50, 0x0,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x9a,
-    0xaa, 0xff, 0xfa, 0xaa, 0xaa, 0x60, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0xaa, 0xaa, 0x50, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x2,
-    0xae, 0xff, 0xff, 0x80,
+    0x0, 0xdd, 0xfc, 0x1, 0xff, 0xe1, 0xff, 0xc2,
+    0x3, 0xff, 0xd4, 0x1, 0xff, 0xc1, 0x65, 0x58,
+    0x2, 0x55, 0xec, 0x9a, 0xa8, 0x40, 0x6a, 0xb9,
+    0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0x83, 0x1,
+    0x10, 0x7, 0xf2, 0x0, 0x3e, 0xab, 0x28, 0x6,
+    0xb1, 0x1, 0x55, 0xda, 0x1, 0x8b, 0x14, 0x40,
+    0x38,
 
     /* U+0075 "u" */
-    0xef, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xef, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xef, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xef, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
-    0xef, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xef, 0xf0,
-    0x0, 0x0, 0x5f, 0xf7, 0xef, 0xf0, 0x0, 0x0,
-    0x5f, 0xf7, 0xef, 0xf0, 0x0, 0x0, 0x5f, 0xf7,
-    0xef, 0xf0, 0x0, 0x0, 0x5f, 0xf7, 0xdf, 0xf0,
-    0x0, 0x0, 0x6f, 0xf7, 0xcf, 0xf2, 0x0, 0x0,
-    0x8f, 0xf5, 0x8f, 0xfa, 0x0, 0x2, 0xff, 0xf1,
-    0x1f, 0xff, 0xd9, 0xaf, 0xff, 0xa0, 0x4, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x29, 0xef, 0xfc,
-    0x60, 0x0,
+    0xef, 0xf0, 0x7, 0x2f, 0xf9, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfc, 0x93, 0x0, 0xf8, 0xc0, 0x21,
+    0x0, 0x10, 0x6, 0xe0, 0x1, 0x20, 0x2, 0x0,
+    0x22, 0x70, 0x2, 0x48, 0x1, 0x76, 0x6b, 0x40,
+    0xa, 0x22, 0xb0, 0x1, 0x32, 0x80, 0xe, 0x80,
+    0x9, 0xac, 0x20, 0x3, 0x9c, 0x0, 0x0,
 
     /* U+0076 "v" */
-    0xaf, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0xf4, 0x5f,
-    0xf9, 0x0, 0x0, 0x0, 0xff, 0xe0, 0xf, 0xfe,
-    0x0, 0x0, 0x4, 0xff, 0xa0, 0xb, 0xff, 0x30,
-    0x0, 0x9, 0xff, 0x50, 0x6, 0xff, 0x80, 0x0,
-    0xe, 0xff, 0x0, 0x1, 0xff, 0xd0, 0x0, 0x3f,
-    0xfa, 0x0, 0x0, 0xbf, 0xf2, 0x0, 0x8f, 0xf5,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0xdf, 0xf0, 0x0,
-    0x0, 0x1f, 0xfb, 0x1, 0xff, 0xb0, 0x0, 0x0,
-    0xc, 0xff, 0x6, 0xff, 0x60, 0x0, 0x0, 0x7,
-    0xff, 0x5a, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff,
-    0x9e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0,
-    0x0,
+    0xaf, 0xf2, 0x0, 0x7a, 0xbf, 0xc9, 0xe0, 0xd,
+    0x0, 0xf2, 0x80, 0xa2, 0x80, 0x1c, 0x3, 0x90,
+    0x0, 0x80, 0x4, 0x1, 0x30, 0xd, 0xa0, 0xf,
+    0x0, 0x68, 0x2, 0xc0, 0x33, 0x80, 0x14, 0x0,
+    0xe0, 0x5, 0x0, 0x8c, 0x41, 0x40, 0x21, 0x40,
+    0x22, 0x0, 0x2c, 0x1, 0xe0, 0x1b, 0x40, 0x8,
+    0x0, 0x50, 0x2, 0x80, 0x67, 0x0, 0x68, 0x9,
+    0x2, 0x0, 0x70, 0x98, 0x20, 0x38, 0x3, 0x40,
+    0x3d, 0x60, 0x5, 0xc0, 0x3, 0x80, 0x79, 0x40,
+    0x18, 0x80, 0x82, 0x1, 0xe2, 0x30, 0x71, 0xd,
+    0x0, 0xfd, 0x60, 0x20, 0x7, 0x0, 0xfc, 0xa0,
+    0x11, 0x88, 0x6,
 
     /* U+0077 "w" */
-    0x5f, 0xf0, 0x0, 0x8f, 0xf2, 0x0, 0x4f, 0xe2,
-    0xff, 0x10, 0xb, 0xff, 0x50, 0x7, 0xfc, 0xf,
-    0xf3, 0x0, 0xde, 0xf7, 0x0, 0x9f, 0x90, 0xdf,
-    0x60, 0xf, 0xbf, 0xa0, 0xb, 0xf7, 0xb, 0xf8,
-    0x3, 0xf8, 0xfd, 0x0, 0xef, 0x40, 0x9f, 0xa0,
-    0x6f, 0x6c, 0xf0, 0xf, 0xf2, 0x6, 0xfc, 0x8,
-    0xf3, 0xaf, 0x22, 0xff, 0x0, 0x4f, 0xe0, 0xbf,
-    0x17, 0xf5, 0x4f, 0xd0, 0x1, 0xff, 0x1e, 0xe0,
-    0x5f, 0x77, 0xfa, 0x0, 0xf, 0xf4, 0xfc, 0x2,
-    0xfa, 0x9f, 0x80, 0x0, 0xcf, 0x8f, 0x90, 0xf,
-    0xcb, 0xf5, 0x0, 0xa, 0xfc, 0xf6, 0x0, 0xde,
-    0xcf, 0x30, 0x0, 0x7f, 0xff, 0x40, 0xb, 0xfe,
-    0xf0, 0x0, 0x5, 0xff, 0xf1, 0x0, 0x9f, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x6, 0xff, 0xb0,
-    0x0,
+    0x5f, 0xf0, 0x5, 0x1f, 0xe2, 0x0, 0x27, 0xf3,
+    0x80, 0x4, 0x0, 0x60, 0x7, 0x0, 0x18, 0x11,
+    0x0, 0x4, 0x0, 0x61, 0x2, 0x0, 0x70, 0x28,
+    0x10, 0x28, 0x0, 0x94, 0x34, 0x0, 0x41, 0xc0,
+    0xc1, 0xc0, 0x60, 0x60, 0xe0, 0x5, 0x3, 0x2,
+    0x2, 0x5, 0xe, 0x32, 0x0, 0x8, 0x30, 0x78,
+    0x30, 0x70, 0x2b, 0x1, 0x10, 0x0, 0x40, 0x40,
+    0x40, 0x60, 0x5a, 0xe, 0xc0, 0x40, 0x5, 0x1,
+    0x12, 0x88, 0x88, 0x8, 0xc1, 0xc0, 0x2, 0x0,
+    0x51, 0x20, 0x70, 0xde, 0x2, 0x0, 0x8c, 0x30,
+    0x14, 0x8, 0x18, 0x83, 0x40, 0x26, 0x4, 0xf,
+    0x0, 0x11, 0x1c, 0x18, 0x2, 0xd0, 0x30, 0x20,
+    0x3, 0x9, 0x1, 0x80, 0x44, 0x1, 0x28, 0x0,
+    0x80, 0x44, 0x1, 0x98, 0x2, 0x10, 0x7, 0x80,
+    0x14, 0x0,
 
     /* U+0078 "x" */
-    0x3f, 0xfe, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x9,
-    0xff, 0x80, 0x0, 0xe, 0xff, 0x30, 0x0, 0xef,
-    0xf2, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x4f, 0xfc,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0xa, 0xff, 0x5b,
-    0xff, 0x40, 0x0, 0x0, 0x1, 0xef, 0xef, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0x28, 0xff, 0x90, 0x0, 0x0, 0x9f, 0xf8,
-    0x0, 0xdf, 0xf3, 0x0, 0x4, 0xff, 0xd0, 0x0,
-    0x4f, 0xfd, 0x0, 0xd, 0xff, 0x40, 0x0, 0xa,
-    0xff, 0x80, 0x8f, 0xfa, 0x0, 0x0, 0x1, 0xff,
-    0xf2,
+    0x3f, 0xf7, 0x0, 0x72, 0xff, 0xb4, 0xd, 0x80,
+    0x60, 0x3, 0x58, 0x3, 0x80, 0x12, 0x20, 0xe4,
+    0x0, 0x81, 0x6, 0x30, 0xa, 0x80, 0x1c, 0x4,
+    0xe0, 0x32, 0x1, 0x91, 0x40, 0xd6, 0x40, 0x14,
+    0x1, 0xeb, 0x10, 0xb4, 0x5, 0x40, 0xf, 0xd,
+    0x80, 0x80, 0xd8, 0x7, 0xe4, 0x0, 0x90, 0x40,
+    0x3f, 0x58, 0x4, 0xa8, 0x1, 0xf2, 0xa8, 0x10,
+    0x1, 0x40, 0x1e, 0x1b, 0x0, 0x4b, 0x80, 0xc8,
+    0x7, 0x40, 0x83, 0x94, 0x10, 0x31, 0x80, 0x48,
+    0xc0, 0x50, 0x0, 0x90, 0x7, 0x0, 0x52, 0x0,
+    0x90, 0x9, 0x14, 0xa, 0x2, 0x8, 0x15, 0x0,
+    0x35, 0x80, 0x1c, 0x80,
 
     /* U+0079 "y" */
-    0xaf, 0xf5, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x4f,
-    0xfb, 0x0, 0x0, 0x0, 0xff, 0xe0, 0xe, 0xff,
-    0x10, 0x0, 0x5, 0xff, 0x80, 0x8, 0xff, 0x60,
-    0x0, 0xb, 0xff, 0x30, 0x2, 0xff, 0xc0, 0x0,
-    0x1f, 0xfd, 0x0, 0x0, 0xcf, 0xf2, 0x0, 0x5f,
-    0xf7, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0xbf, 0xf2,
-    0x0, 0x0, 0xf, 0xfd, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x9, 0xff, 0x35, 0xff, 0x70, 0x0, 0x0,
-    0x3, 0xff, 0x8b, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xdf, 0xce, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0x0, 0x0,
+    0xaf, 0xf2, 0x80, 0x7a, 0xff, 0xc9, 0xc0, 0xe,
+    0x0, 0xf2, 0x0, 0xa2, 0x4, 0x10, 0x40, 0x32,
+    0x80, 0x18, 0x0, 0xc0, 0x7, 0x0, 0xdc, 0x0,
+    0xb0, 0x5, 0x0, 0x28, 0x2, 0x14, 0x2, 0x30,
+    0x1, 0x18, 0x19, 0x0, 0x10, 0x1, 0x40, 0x1a,
+    0x80, 0xa, 0x0, 0xe0, 0x2, 0x80, 0x66, 0x0,
+    0x50, 0xa, 0x1, 0x90, 0x7, 0x30, 0x11, 0xa0,
+    0x2, 0xc0, 0x3d, 0x40, 0xb, 0xe0, 0x3, 0x0,
+    0x78, 0xc8, 0x11, 0x41, 0x4, 0x3, 0xea, 0x3,
+    0x10, 0xd0, 0xf, 0xcc, 0x1, 0x98, 0x3, 0xf0,
+    0xa0, 0x1, 0x40, 0x3f, 0xc4, 0x0, 0xf0, 0xf,
+    0xf3, 0x80, 0x14, 0x3, 0xf9, 0x4, 0x18, 0x3,
+    0xfd, 0xc0, 0xd, 0x0, 0xff, 0x28, 0xa, 0x0,
+    0x7f, 0x28, 0x1, 0xc0, 0x3e,
 
     /* U+007A "z" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x59, 0x99, 0x99, 0x9b,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x20, 0x0, 0x0, 0x1, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x6, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0xfc, 0x99, 0x99, 0x99, 0x93, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf6,
+    0x9f, 0xff, 0xf1, 0x0, 0x7f, 0xec, 0x66, 0xf2,
+    0x0, 0x46, 0xb3, 0x3e, 0x70, 0x3, 0x88, 0x7,
+    0xa8, 0xc1, 0x20, 0x3, 0xcc, 0xa0, 0x56, 0x1,
+    0xe3, 0x90, 0x7, 0x80, 0x78, 0x74, 0x1, 0x64,
+    0x1, 0xed, 0x10, 0x84, 0x0, 0xf4, 0x98, 0x2b,
+    0x80, 0x79, 0x98, 0x7, 0x40, 0x1e, 0x39, 0x1,
+    0xd0, 0xf, 0xbc, 0x0, 0x51, 0x33, 0xe3, 0x10,
+    0x1, 0xb3, 0x7c, 0xa0, 0x1f, 0xf8,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0x30, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xba, 0x20, 0x0, 0x0, 0xf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xa3, 0x0, 0x0, 0x1, 0xaa, 0xaa, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xba, 0x20, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x2,
-    0x9e, 0xff, 0x30,
+    0x0, 0xf8, 0xa7, 0xbf, 0xc6, 0x1, 0xe3, 0xd6,
+    0x10, 0xf, 0xef, 0x0, 0x91, 0x44, 0x3, 0xc6,
+    0x0, 0xeb, 0xa2, 0x0, 0xfc, 0x62, 0x1, 0xfc,
+    0x20, 0x20, 0x1f, 0xe3, 0x2, 0x0, 0xff, 0x30,
+    0x7, 0xfe, 0x10, 0x1, 0x0, 0x7f, 0x8, 0x0,
+    0xc0, 0x3f, 0x22, 0x0, 0x84, 0x2, 0x2f, 0xfd,
+    0x60, 0x7e, 0x1, 0xfe, 0x5f, 0x20, 0xc, 0x6a,
+    0xb8, 0x57, 0x18, 0x3, 0xd, 0x56, 0xe1, 0x8,
+    0x0, 0xff, 0x20, 0x9, 0x0, 0x7f, 0xe3, 0x0,
+    0xfe, 0x60, 0x0, 0x80, 0x7f, 0x8, 0x7, 0xfe,
+    0x20, 0x20, 0xf, 0xfc, 0x20, 0x1f, 0xf8, 0xc8,
+    0x3, 0xf9, 0x0, 0x1b, 0x74, 0x40, 0x1e, 0x90,
+    0x9, 0x14, 0x40, 0x3c, 0x5a, 0xc2, 0x1, 0x0,
 
     /* U+007C "|" */
-    0x13, 0x30, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3,
-    0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3,
-    0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3,
-    0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3,
-    0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3,
-    0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3,
-    0x9f, 0xf3, 0x9f, 0xf3,
+    0x13, 0x30, 0x46, 0x60, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfc, 0x90,
 
     /* U+007D "}" */
-    0x9f, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x6a, 0xcf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x2b, 0xff, 0xff, 0xfb, 0x0, 0x2,
-    0xff, 0xfb, 0xaa, 0xa7, 0x0, 0x9, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xa0, 0x0, 0x0, 0x6a, 0xcf, 0xff, 0x60,
-    0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x60, 0x0, 0x0, 0x0,
+    0x9f, 0xf6, 0x30, 0x7, 0xf8, 0xe7, 0x0, 0x3d,
+    0xea, 0x60, 0x3, 0x60, 0xe, 0x6a, 0xc9, 0x0,
+    0x60, 0x7, 0xe4, 0x0, 0xff, 0x98, 0x0, 0x40,
+    0x1f, 0x88, 0x1, 0xc0, 0x1f, 0xb8, 0x0, 0xa0,
+    0x1f, 0x88, 0x0, 0x40, 0x1f, 0x84, 0x3, 0xfe,
+    0xc0, 0x4, 0x8, 0x7, 0xce, 0xc0, 0xdd, 0xff,
+    0x58, 0x6, 0xb4, 0x0, 0xfe, 0x2d, 0x40, 0x45,
+    0x5b, 0x0, 0x2b, 0x0, 0x55, 0xd5, 0x4e, 0x1,
+    0x10, 0x1, 0x0, 0x3f, 0x8, 0x0, 0xc0, 0x3f,
+    0x10, 0x1, 0x80, 0x3f, 0x70, 0x0, 0x80, 0x3f,
+    0x10, 0x3, 0x80, 0x3f, 0x30, 0x0, 0x80, 0x3f,
+    0x28, 0x7, 0xe6, 0xac, 0x80, 0x6, 0x0, 0x77,
+    0xa9, 0x80, 0x11, 0x80, 0x3f, 0x1c, 0xd8, 0x7,
+    0x80,
 
     /* U+007E "~" */
-    0x0, 0x9e, 0xfb, 0x20, 0x0, 0x4a, 0xa0, 0xb,
-    0xff, 0xff, 0xe2, 0x0, 0x7f, 0xf0, 0x3f, 0xfa,
-    0x7f, 0xfd, 0x0, 0x7f, 0xf0, 0x5f, 0xf1, 0x4,
-    0xff, 0xb6, 0xdf, 0xd0, 0x6f, 0xf1, 0x0, 0x8f,
-    0xff, 0xff, 0x50, 0x4a, 0xa0, 0x0, 0x6, 0xef,
-    0xd5, 0x0
+    0x0, 0x4f, 0x7d, 0x90, 0x4, 0x95, 0x40, 0x5,
+    0xb0, 0x82, 0x61, 0x0, 0xd, 0x54, 0x6, 0x80,
+    0xb0, 0x3, 0xe0, 0x1e, 0x60, 0x5, 0xbd, 0x81,
+    0x5b, 0x50, 0x10, 0x18, 0x6, 0x47, 0x4, 0x92,
+    0x8, 0x2, 0x55, 0x8, 0x2, 0x24, 0x40, 0xa9,
+    0x40,
 };
 
 
@@ -1584,99 +1107,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 250, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 250, .box_w = 5, .box_h = 20, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 50, .adv_w = 250, .box_w = 10, .box_h = 9, .ofs_x = 3, .ofs_y = 11},
-    {.bitmap_index = 95, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 245, .adv_w = 250, .box_w = 13, .box_h = 27, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 421, .adv_w = 250, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 581, .adv_w = 250, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 751, .adv_w = 250, .box_w = 4, .box_h = 9, .ofs_x = 6, .ofs_y = 11},
-    {.bitmap_index = 769, .adv_w = 250, .box_w = 9, .box_h = 27, .ofs_x = 4, .ofs_y = -4},
-    {.bitmap_index = 891, .adv_w = 250, .box_w = 10, .box_h = 27, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 1026, .adv_w = 250, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 1131, .adv_w = 250, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1216, .adv_w = 250, .box_w = 5, .box_h = 9, .ofs_x = 5, .ofs_y = -4},
-    {.bitmap_index = 1239, .adv_w = 250, .box_w = 9, .box_h = 3, .ofs_x = 3, .ofs_y = 8},
-    {.bitmap_index = 1253, .adv_w = 250, .box_w = 6, .box_h = 5, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1268, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1431, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1561, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1691, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1821, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1951, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2071, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2201, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2341, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2481, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2621, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2761, .adv_w = 250, .box_w = 6, .box_h = 15, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 2806, .adv_w = 250, .box_w = 6, .box_h = 20, .ofs_x = 5, .ofs_y = -5},
-    {.bitmap_index = 2866, .adv_w = 250, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 2962, .adv_w = 250, .box_w = 12, .box_h = 9, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3016, .adv_w = 250, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3112, .adv_w = 250, .box_w = 10, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3212, .adv_w = 250, .box_w = 14, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3387, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3527, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3657, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3777, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3897, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4017, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4137, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4257, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4377, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4497, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4637, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4767, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4887, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5017, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5137, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5257, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5387, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 5550, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5680, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5810, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5950, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6070, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6210, .adv_w = 250, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6370, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6520, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6670, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6790, .adv_w = 250, .box_w = 7, .box_h = 25, .ofs_x = 5, .ofs_y = -3},
-    {.bitmap_index = 6878, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7041, .adv_w = 250, .box_w = 8, .box_h = 25, .ofs_x = 3, .ofs_y = -3},
-    {.bitmap_index = 7141, .adv_w = 250, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 7213, .adv_w = 250, .box_w = 14, .box_h = 3, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7234, .adv_w = 250, .box_w = 7, .box_h = 4, .ofs_x = 3, .ofs_y = 17},
-    {.bitmap_index = 7248, .adv_w = 250, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7346, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7466, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7556, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7676, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7766, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7896, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8016, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8136, .adv_w = 250, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8273, .adv_w = 250, .box_w = 10, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8403, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8533, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8683, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8788, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8878, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8968, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 9088, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 9208, .adv_w = 250, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9306, .adv_w = 250, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9404, .adv_w = 250, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9528, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9618, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9723, .adv_w = 250, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9836, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9941, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10081, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10171, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 10334, .adv_w = 250, .box_w = 4, .box_h = 26, .ofs_x = 6, .ofs_y = -3},
-    {.bitmap_index = 10386, .adv_w = 250, .box_w = 12, .box_h = 25, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 10536, .adv_w = 250, .box_w = 14, .box_h = 6, .ofs_x = 1, .ofs_y = 7}
+    {.bitmap_index = 38, .adv_w = 250, .box_w = 10, .box_h = 9, .ofs_x = 3, .ofs_y = 11},
+    {.bitmap_index = 72, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 193, .adv_w = 250, .box_w = 13, .box_h = 27, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 321, .adv_w = 250, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 460, .adv_w = 250, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 603, .adv_w = 250, .box_w = 4, .box_h = 9, .ofs_x = 6, .ofs_y = 11},
+    {.bitmap_index = 618, .adv_w = 250, .box_w = 9, .box_h = 27, .ofs_x = 4, .ofs_y = -4},
+    {.bitmap_index = 700, .adv_w = 250, .box_w = 10, .box_h = 27, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 785, .adv_w = 250, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 865, .adv_w = 250, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 898, .adv_w = 250, .box_w = 5, .box_h = 9, .ofs_x = 5, .ofs_y = -4},
+    {.bitmap_index = 922, .adv_w = 250, .box_w = 9, .box_h = 3, .ofs_x = 3, .ofs_y = 8},
+    {.bitmap_index = 930, .adv_w = 250, .box_w = 6, .box_h = 5, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 945, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 1050, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1148, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1198, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1300, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1402, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1477, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1561, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1677, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1768, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1899, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2016, .adv_w = 250, .box_w = 6, .box_h = 15, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 2049, .adv_w = 250, .box_w = 6, .box_h = 20, .ofs_x = 5, .ofs_y = -5},
+    {.bitmap_index = 2097, .adv_w = 250, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 2171, .adv_w = 250, .box_w = 12, .box_h = 9, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 2194, .adv_w = 250, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 2268, .adv_w = 250, .box_w = 10, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2344, .adv_w = 250, .box_w = 14, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 2473, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2588, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2679, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2758, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2824, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2864, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2896, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2987, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3015, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3053, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3108, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3196, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3216, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3289, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3364, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3443, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3505, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 3609, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3698, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3815, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3843, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3891, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4010, .adv_w = 250, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4171, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4296, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4385, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4466, .adv_w = 250, .box_w = 7, .box_h = 25, .ofs_x = 5, .ofs_y = -3},
+    {.bitmap_index = 4489, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4593, .adv_w = 250, .box_w = 8, .box_h = 25, .ofs_x = 3, .ofs_y = -3},
+    {.bitmap_index = 4618, .adv_w = 250, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 4678, .adv_w = 250, .box_w = 14, .box_h = 3, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4688, .adv_w = 250, .box_w = 7, .box_h = 4, .ofs_x = 3, .ofs_y = 17},
+    {.bitmap_index = 4702, .adv_w = 250, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4788, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4855, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4929, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5003, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5079, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5131, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5222, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5264, .adv_w = 250, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5319, .adv_w = 250, .box_w = 10, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5380, .adv_w = 250, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5450, .adv_w = 250, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5496, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5536, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5576, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5644, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5715, .adv_w = 250, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5786, .adv_w = 250, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5832, .adv_w = 250, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5925, .adv_w = 250, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5974, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6021, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6112, .adv_w = 250, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6226, .adv_w = 250, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6318, .adv_w = 250, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 6427, .adv_w = 250, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6489, .adv_w = 250, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 6593, .adv_w = 250, .box_w = 4, .box_h = 26, .ofs_x = 6, .ofs_y = -3},
+    {.bitmap_index = 6604, .adv_w = 250, .box_w = 12, .box_h = 25, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 6709, .adv_w = 250, .box_w = 14, .box_h = 6, .ofs_x = 1, .ofs_y = 7}
 };
 
 /*---------------------
@@ -1718,7 +1241,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 30 px
  * Bpp: 4
- * Opts: --font JetBrainsMonoNL-SemiBold.ttf --size 30 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_30 --no-compress -o out/lv_font_jetbrains_mono_30.c
+ * Opts: --font JetBrainsMonoNL-SemiBold.ttf --size 30 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_30 -o out/lv_font_jetbrains_mono_30.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -25,1911 +25,1248 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0xd, 0xff, 0xd0, 0xc, 0xff, 0xc0, 0xc, 0xff,
-    0xc0, 0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb,
-    0xff, 0xb0, 0xa, 0xff, 0xa0, 0xa, 0xff, 0xa0,
-    0x9, 0xff, 0x90, 0x9, 0xff, 0x90, 0x9, 0xff,
-    0x80, 0x8, 0xff, 0x80, 0x8, 0xff, 0x80, 0x7,
-    0xff, 0x70, 0x7, 0xff, 0x70, 0x3, 0x77, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xcc,
-    0x80, 0x4f, 0xff, 0xf4, 0x4f, 0xff, 0xf5, 0xa,
-    0xff, 0xa0,
+    0xd, 0xff, 0x68, 0x0, 0x40, 0x2, 0x1, 0xf9,
+    0xc0, 0xe, 0x1, 0xff, 0xc2, 0x10, 0x0, 0x80,
+    0x7e, 0x30, 0x1, 0x80, 0x7f, 0xc2, 0x0, 0x10,
+    0xf, 0xfb, 0xc0, 0x1e, 0x1, 0xf9, 0x22, 0x8,
+    0x0, 0x37, 0x71, 0x80, 0x7e, 0x7c, 0xc4, 0x2,
+    0x41, 0x99, 0xd0, 0x3, 0x85, 0x14, 0x0, 0xaa,
 
     /* U+0022 "\"" */
-    0x1f, 0xff, 0x60, 0x6, 0xff, 0xf1, 0x1f, 0xff,
-    0x50, 0x5, 0xff, 0xf1, 0x1f, 0xff, 0x50, 0x5,
-    0xff, 0xf1, 0xf, 0xff, 0x50, 0x5, 0xff, 0xf0,
-    0xf, 0xff, 0x40, 0x4, 0xff, 0xf0, 0xf, 0xff,
-    0x40, 0x4, 0xff, 0xf0, 0xf, 0xff, 0x40, 0x3,
-    0xff, 0xf0, 0xe, 0xff, 0x30, 0x3, 0xff, 0xf0,
-    0xe, 0xff, 0x30, 0x3, 0xff, 0xe0, 0x1, 0x11,
-    0x0, 0x0, 0x11, 0x10,
+    0x1f, 0xf9, 0x80, 0xd, 0xff, 0x8, 0x6, 0x30,
+    0x1, 0x80, 0x7f, 0xf1, 0x4, 0x3, 0xfc, 0x20,
+    0x18, 0x40, 0x2, 0x1, 0xff, 0xcb, 0x70, 0xe,
+    0x10, 0x3, 0x80, 0x7f, 0xf1, 0x44, 0x1, 0xfd,
+    0xc3, 0x0, 0x1f, 0x73, 0xc0,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0xff, 0x50,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x5f, 0xf0, 0x0, 0x6, 0xff, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0xc, 0xf9, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x4, 0x57, 0xff, 0x65, 0x55, 0x8f, 0xf5, 0x54,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0x0, 0x8, 0xfd, 0x0, 0x0, 0xaf, 0xb0, 0x0,
-    0x0, 0xb, 0xfa, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0xff, 0x50, 0x0,
-    0x44, 0x4f, 0xf7, 0x44, 0x46, 0xff, 0x64, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x9f, 0xc0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x0, 0xe, 0xf7, 0x0, 0x0,
-    0x0, 0xff, 0x60, 0x0, 0x1f, 0xf4, 0x0, 0x0,
-    0x2, 0xff, 0x30, 0x0, 0x4f, 0xf1, 0x0, 0x0,
-    0x5, 0xff, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x8, 0xfd, 0x0, 0x0, 0x9f, 0xc0, 0x0, 0x0,
+    0x0, 0xec, 0xf9, 0x0, 0xdb, 0xee, 0x1, 0xe3,
+    0xf, 0x0, 0xc4, 0x4, 0x1, 0xc4, 0x0, 0x50,
+    0x8, 0xc0, 0xe, 0x1, 0xce, 0x0, 0x30, 0x9,
+    0x40, 0x4, 0x1, 0xda, 0x4, 0x1, 0xbc, 0xc,
+    0x3, 0xc6, 0xe, 0x1, 0x94, 0x14, 0x2, 0xef,
+    0xf2, 0x2, 0xff, 0xe3, 0x6, 0xff, 0x0, 0x7f,
+    0xf1, 0x6a, 0x90, 0x0, 0x9a, 0xa9, 0xc0, 0x15,
+    0x4b, 0x4, 0x52, 0x0, 0x32, 0xad, 0xe0, 0x2a,
+    0xa4, 0x0, 0xb4, 0x8, 0x3, 0x68, 0x28, 0x7,
+    0x8c, 0x1c, 0x3, 0x38, 0x18, 0x7, 0x94, 0x34,
+    0x3, 0x10, 0x68, 0x4, 0x89, 0x8, 0x1, 0x12,
+    0x60, 0x1, 0xa1, 0x85, 0xdc, 0x0, 0x8b, 0xba,
+    0x40, 0x13, 0x7a, 0x1, 0xff, 0xc5, 0xff, 0x30,
+    0x1f, 0xfe, 0x40, 0x5f, 0xf7, 0x0, 0x4a, 0xa,
+    0x1, 0x94, 0x34, 0x3, 0xc6, 0x1e, 0x1, 0x8,
+    0x80, 0xc0, 0x38, 0x80, 0xa, 0x1, 0x28, 0x1,
+    0x40, 0x39, 0xc0, 0x6, 0x1, 0x18, 0x8, 0x80,
+    0x3b, 0x40, 0x80, 0x37, 0x1, 0x0, 0x70,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x6, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x5e, 0xf6, 0x30, 0x0, 0x0,
-    0x0, 0x2, 0xbf, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xcf, 0xff, 0xae, 0xf9, 0xff, 0xfe, 0x10,
-    0x3, 0xff, 0xf4, 0xd, 0xf0, 0x3f, 0xff, 0x70,
-    0x7, 0xff, 0xd0, 0xd, 0xf0, 0xa, 0xff, 0xa0,
-    0x8, 0xff, 0xb0, 0xd, 0xf0, 0x3, 0x88, 0x60,
-    0x7, 0xff, 0xe0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf7, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xae, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf9, 0x40, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x7f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x4, 0xff, 0xf0,
-    0xf, 0xff, 0x40, 0xd, 0xf0, 0x3, 0xff, 0xf0,
-    0xd, 0xff, 0x90, 0xd, 0xf0, 0x8, 0xff, 0xd0,
-    0x8, 0xff, 0xf7, 0xd, 0xf0, 0x6f, 0xff, 0x80,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xff, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0xf9, 0x9c, 0x3, 0xff, 0x85, 0x70, 0x1,
+    0xff, 0xe0, 0x25, 0x30, 0x63, 0x0, 0xfc, 0x57,
+    0xb4, 0x21, 0x39, 0xa6, 0x1, 0xc5, 0x88, 0x1,
+    0xe2, 0xc4, 0x0, 0xdc, 0x20, 0x5, 0x10, 0x60,
+    0xa, 0x84, 0x0, 0x66, 0x0, 0x5d, 0x18, 0x4e,
+    0x0, 0x5, 0x80, 0x8, 0x0, 0x24, 0x0, 0xc6,
+    0xa0, 0xd, 0x0, 0x78, 0x1, 0x80, 0x3d, 0x2e,
+    0xec, 0x0, 0x78, 0x1, 0x40, 0x3c, 0x71, 0x6,
+    0x0, 0x18, 0x0, 0x5c, 0x3, 0xfe, 0x42, 0x0,
+    0x45, 0x18, 0x7, 0xfa, 0x40, 0x25, 0x10, 0x94,
+    0x0, 0xf9, 0x28, 0x3, 0x9a, 0xf5, 0x0, 0x3c,
+    0xbc, 0xe2, 0x1, 0x8a, 0xd8, 0x3, 0xc3, 0x1c,
+    0x40, 0x20, 0x14, 0x90, 0x7, 0xfb, 0xa0, 0x2,
+    0x80, 0xf, 0xf9, 0xd8, 0x0, 0x80, 0x1f, 0xfb,
+    0x40, 0x2, 0x0, 0xff, 0x90, 0x3, 0xce, 0x1,
+    0xc4, 0x0, 0xd0, 0xf, 0x58, 0x0, 0x80, 0xa,
+    0x0, 0x67, 0x0, 0xcc, 0xe0, 0x5, 0x0, 0x48,
+    0x80, 0x23, 0xc8, 0x3e, 0x40, 0x5, 0x20, 0x1,
+    0xc2, 0x0, 0xfc, 0x5e, 0x20, 0x11, 0x6c, 0x98,
+    0x6, 0x39, 0xd2, 0x0, 0xf3, 0x67, 0x90, 0x7e,
+    0x30, 0x7, 0xff, 0xa0,
 
     /* U+0025 "%" */
-    0x1, 0x9e, 0xfe, 0xa1, 0x0, 0x0, 0x0, 0x1e,
-    0xf7, 0xd, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0xbf, 0xc0, 0x6f, 0xf8, 0x37, 0xff, 0x80, 0x0,
-    0x6, 0xff, 0x20, 0xaf, 0xd0, 0x0, 0xaf, 0xc0,
-    0x0, 0x2f, 0xf6, 0x0, 0xaf, 0xc0, 0x0, 0x9f,
-    0xd0, 0x0, 0xcf, 0xb0, 0x0, 0xaf, 0xc0, 0x0,
-    0x9f, 0xd0, 0x7, 0xfe, 0x10, 0x0, 0xaf, 0xd0,
-    0x0, 0xbf, 0xc0, 0x2f, 0xf5, 0x0, 0x0, 0x6f,
-    0xf9, 0x47, 0xff, 0x90, 0xcf, 0xa0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xfe, 0x18, 0xfe, 0x10, 0x0,
-    0x0, 0x1, 0x9e, 0xfe, 0xa1, 0x3f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x2a, 0xef, 0xe9, 0x10, 0x0, 0x0, 0x1,
-    0xef, 0x81, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xa, 0xfc, 0x9, 0xff, 0x73, 0x9f, 0xf6, 0x0,
-    0x0, 0x5f, 0xf2, 0xc, 0xfb, 0x0, 0xe, 0xfa,
-    0x0, 0x1, 0xef, 0x70, 0xd, 0xf9, 0x0, 0xc,
-    0xfb, 0x0, 0xb, 0xfc, 0x0, 0xd, 0xf9, 0x0,
-    0xc, 0xfb, 0x0, 0x6f, 0xf2, 0x0, 0xc, 0xfa,
-    0x0, 0xd, 0xfa, 0x2, 0xff, 0x60, 0x0, 0x9,
-    0xff, 0x52, 0x7f, 0xf6, 0xc, 0xfb, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xd0, 0x7f, 0xe1, 0x0,
-    0x0, 0x0, 0x2a, 0xef, 0xe9, 0x10,
+    0x1, 0x9e, 0xfe, 0xa1, 0x0, 0xf0, 0xf7, 0xb8,
+    0x63, 0x8, 0xa, 0xf8, 0x80, 0x75, 0x9, 0xbb,
+    0x10, 0x3e, 0x40, 0xc, 0x80, 0x66, 0x40, 0xe0,
+    0xc0, 0x28, 0x37, 0x50, 0x40, 0x8, 0xa4, 0x24,
+    0x80, 0x21, 0x0, 0x8c, 0x4, 0x2, 0xe0, 0x46,
+    0x0, 0xff, 0xe0, 0xb9, 0x8d, 0x0, 0x70, 0x80,
+    0x44, 0x2, 0x5, 0x1, 0x62, 0x1, 0x60, 0x14,
+    0xa3, 0xa0, 0x28, 0x70, 0x2a, 0x80, 0x33, 0x10,
+    0x35, 0xc0, 0xc, 0x40, 0xc6, 0xc0, 0x3d, 0x8c,
+    0x20, 0x2b, 0xe4, 0xe1, 0x42, 0x1, 0xe1, 0x9e,
+    0xfe, 0xa1, 0xe0, 0x64, 0x0, 0xff, 0xe0, 0xc9,
+    0x12, 0x40, 0x3f, 0xf8, 0x28, 0xc1, 0xc5, 0x5d,
+    0xfd, 0x22, 0x1, 0xe1, 0xa0, 0x72, 0xc5, 0x10,
+    0x16, 0xc0, 0xf, 0x58, 0x9c, 0x40, 0x42, 0x31,
+    0x80, 0x98, 0x3, 0x2a, 0x83, 0x81, 0x41, 0x1c,
+    0xe4, 0x43, 0x0, 0x21, 0xb0, 0x82, 0x1, 0x2,
+    0x0, 0x88, 0x4, 0x2, 0xa1, 0x37, 0x0, 0xff,
+    0xe0, 0xb2, 0x7, 0x0, 0x42, 0x6, 0x1, 0x8,
+    0x8, 0x14, 0x84, 0x90, 0x4, 0xa0, 0xaa, 0x27,
+    0x20, 0xc0, 0xe0, 0x46, 0x0, 0xd0, 0x21, 0x5b,
+    0x0, 0x4c, 0xe6, 0x34, 0x1, 0xc3, 0x8a, 0x20,
+    0x2d, 0x80,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x4, 0xbe, 0xfe, 0xa3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0xce,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x40, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf4, 0x0, 0x0, 0xab, 0xb1, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a,
-    0xef, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1, 0x11,
-    0x0, 0x9f, 0xff, 0xc9, 0xdf, 0xfa, 0x0, 0x5,
-    0xff, 0xf2, 0x1f, 0xff, 0x70, 0x2, 0xef, 0xf7,
-    0x3, 0xff, 0xf4, 0x4, 0xff, 0xe0, 0x0, 0x4,
-    0xff, 0xf5, 0xef, 0xf7, 0x0, 0x5f, 0xfc, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfa, 0x0, 0x6, 0xff,
-    0xc0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x40, 0x0, 0xf, 0xff, 0xa1, 0x0, 0x5f,
-    0xff, 0xaf, 0xfe, 0x10, 0x0, 0x8f, 0xff, 0xfd,
-    0xef, 0xff, 0x80, 0xaf, 0xfb, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0x90, 0x1, 0xef, 0xf7, 0x0,
-    0x0, 0x5b, 0xef, 0xea, 0x30, 0x0, 0x4, 0xff,
-    0xf3,
+    0x0, 0xe4, 0xbe, 0xfe, 0xa3, 0x0, 0xff, 0xa2,
+    0xd0, 0x40, 0x57, 0x18, 0x3, 0xf9, 0x5c, 0x0,
+    0x26, 0x20, 0x9, 0x40, 0xf, 0xdc, 0x0, 0x4e,
+    0xce, 0x40, 0x7, 0x80, 0x7e, 0x60, 0x7, 0x80,
+    0x52, 0x0, 0x40, 0xf, 0xc2, 0x1, 0xe2, 0x54,
+    0x40, 0x80, 0x7d, 0x60, 0x8, 0x0, 0xd5, 0x76,
+    0x10, 0xf, 0x9c, 0x80, 0xdc, 0x3, 0xff, 0x87,
+    0xc0, 0x8, 0x40, 0xf, 0xfe, 0xa, 0xc8, 0x80,
+    0x28, 0x80, 0x3f, 0xeb, 0xa5, 0x10, 0x0, 0xf8,
+    0x7, 0x8, 0xc0, 0x9, 0x40, 0x1, 0xb1, 0x1,
+    0x50, 0x4, 0xbd, 0xd1, 0xb, 0x0, 0x23, 0x27,
+    0xc4, 0x15, 0xc0, 0xe8, 0x1, 0x64, 0xa0, 0x1,
+    0x70, 0x1, 0x50, 0x2, 0x17, 0x40, 0x10, 0x80,
+    0x20, 0x2, 0x0, 0xc8, 0xe0, 0xa, 0x10, 0x57,
+    0x0, 0x18, 0x7, 0xe8, 0x40, 0x8, 0xe8, 0x2,
+    0x30, 0xf, 0xec, 0x0, 0x90, 0x3, 0x8, 0x0,
+    0xc0, 0x39, 0x20, 0x2, 0x74, 0x0, 0x90, 0x2,
+    0xa1, 0x0, 0x2d, 0x80, 0x14, 0x1, 0x42, 0x1,
+    0x38, 0x1, 0x7b, 0x7a, 0x80, 0xf, 0x4a, 0x3,
+    0x40, 0x14, 0x28, 0x4, 0x42, 0x0, 0x68, 0xb,
+    0x10, 0x47, 0x0, 0xaa, 0x88, 0x20, 0x2b, 0x92,
+    0x0, 0x1a, 0x0, 0x41, 0x80,
 
     /* U+0027 "'" */
-    0xcf, 0xfc, 0xbf, 0xfb, 0xbf, 0xfb, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0x9f, 0xf9, 0x9f, 0xf9,
-    0x8f, 0xf9, 0x1, 0x10,
+    0xcf, 0xf6, 0x38, 0x1, 0xc0, 0x30, 0x80, 0x4,
+    0x3, 0xf1, 0x80, 0xc, 0x3, 0x8, 0x5, 0x1d,
+    0xc9,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0,
-    0x6d, 0xf8, 0x0, 0x0, 0x2d, 0xff, 0xf8, 0x0,
-    0x4, 0xff, 0xff, 0xf7, 0x0, 0x3f, 0xff, 0xf8,
-    0x10, 0x0, 0xdf, 0xff, 0x30, 0x0, 0x7, 0xff,
-    0xf4, 0x0, 0x0, 0xd, 0xff, 0xa0, 0x0, 0x0,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x6f, 0xfe, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0,
-    0xbf, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0,
-    0x0, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x20, 0x0, 0x0, 0xe, 0xff,
-    0x90, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x0, 0x0,
-    0x1, 0xef, 0xfe, 0x20, 0x0, 0x0, 0x4f, 0xff,
-    0xf6, 0x0, 0x0, 0x6, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x4e, 0xff, 0xf8, 0x0, 0x0, 0x1, 0x8f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x54,
+    0x0, 0xfc, 0x46, 0x1, 0xe6, 0xdd, 0x58, 0x6,
+    0x2d, 0x92, 0x0, 0xe4, 0xd2, 0x0, 0xbc, 0x0,
+    0x76, 0x1, 0x3f, 0x38, 0x3, 0x80, 0x2c, 0x81,
+    0x0, 0x39, 0x0, 0x2c, 0xc0, 0x35, 0x0, 0x15,
+    0x0, 0x31, 0x90, 0x2, 0x40, 0x39, 0x40, 0x2,
+    0x60, 0x1d, 0xe0, 0x4, 0x0, 0xf1, 0x80, 0xc,
+    0x3, 0xc2, 0x0, 0x10, 0xf, 0xff, 0x60, 0x80,
+    0x7f, 0x18, 0x0, 0x80, 0x3d, 0xc0, 0x7, 0x0,
+    0xf2, 0x0, 0x8, 0x80, 0x1c, 0x62, 0x0, 0xb0,
+    0xf, 0x30, 0x1, 0x8c, 0x3, 0xa4, 0x40, 0x1a,
+    0x40, 0x18, 0x68, 0x0, 0x3a, 0xc0, 0x19, 0x24,
+    0x2, 0x9e, 0x60, 0x9, 0xac, 0x40, 0x3, 0xc0,
+    0x19, 0x3d, 0xc0, 0x3f, 0xc, 0x7d, 0x60,
 
     /* U+0029 ")" */
-    0x32, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xd6, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xd2, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x40, 0x0, 0x1, 0x8f, 0xff, 0xf3,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x70, 0x0, 0x0, 0xa, 0xff, 0xd0,
-    0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xef, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
-    0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xfb,
-    0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0,
-    0x8f, 0xfb, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0xdf,
-    0xf7, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0,
-    0x9, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x2, 0xef, 0xfe, 0x0, 0x0, 0x6f, 0xff,
-    0xf4, 0x0, 0x6e, 0xff, 0xff, 0x60, 0x0, 0x8f,
-    0xff, 0xe4, 0x0, 0x0, 0x8f, 0xf8, 0x10, 0x0,
-    0x0, 0x45, 0x0, 0x0, 0x0, 0x0,
+    0x32, 0x0, 0xfd, 0x7b, 0xa6, 0x0, 0xfc, 0x53,
+    0xa4, 0x1, 0xbc, 0x2, 0x2d, 0x40, 0x9, 0xf9,
+    0xc0, 0x2b, 0x30, 0x8, 0x63, 0x0, 0x2e, 0x0,
+    0xe3, 0xb0, 0x1, 0x38, 0x7, 0x22, 0x80, 0x28,
+    0x3, 0xd2, 0x0, 0x23, 0x0, 0xe3, 0x10, 0x2,
+    0x80, 0x79, 0x0, 0x1e, 0x1, 0xe3, 0x0, 0x18,
+    0x7, 0x84, 0x0, 0x20, 0x1f, 0xfe, 0xc1, 0x0,
+    0x8, 0x7, 0x8c, 0x0, 0x60, 0x1e, 0x70, 0x7,
+    0x0, 0x71, 0x10, 0x0, 0x80, 0x1d, 0x60, 0x1,
+    0x30, 0xc, 0x6c, 0x0, 0x60, 0xc, 0x5a, 0x0,
+    0x18, 0x0, 0x9b, 0x44, 0x1, 0x40, 0x6, 0xe9,
+    0x0, 0xa5, 0x0, 0x1c, 0x20, 0x1, 0xb6, 0x0,
+    0xf3, 0xfa, 0x0, 0x6c, 0xaf, 0x81, 0x0, 0xe0,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x2a, 0x40, 0x0, 0x5f, 0xf5, 0x0, 0x4, 0xa2,
-    0x8f, 0xfe, 0x81, 0x3f, 0xf3, 0x18, 0xef, 0xf8,
-    0xcf, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff, 0xfc,
-    0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x50,
-    0x0, 0x1, 0x59, 0xef, 0xfe, 0x95, 0x10, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfb, 0xbf, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xf3, 0x3f, 0xfe, 0x10, 0x0,
-    0x0, 0xb, 0xff, 0xa0, 0xa, 0xff, 0xb0, 0x0,
-    0x0, 0x6f, 0xfe, 0x10, 0x1, 0xef, 0xf6, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x0, 0x4f, 0xf6, 0x0,
-    0x0, 0x2, 0x70, 0x0, 0x0, 0x7, 0x20, 0x0,
+    0x0, 0xf3, 0x7f, 0x98, 0x3, 0xff, 0xc0, 0x60,
+    0x3, 0x0, 0xf1, 0x52, 0x0, 0x7f, 0x92, 0x8a,
+    0x96, 0xfa, 0x5, 0x80, 0xc, 0x31, 0xd6, 0xb4,
+    0x80, 0x1, 0x7e, 0xa0, 0x5, 0x73, 0x88, 0x1,
+    0x32, 0x90, 0x2, 0x60, 0x3, 0x0, 0x49, 0x58,
+    0xb, 0x7d, 0x4c, 0x20, 0x1, 0x6a, 0xeb, 0x50,
+    0xc, 0x2b, 0xe2, 0x0, 0x1f, 0x51, 0x0, 0xf9,
+    0x24, 0x11, 0x1, 0x28, 0x1, 0xf0, 0xd0, 0x2,
+    0x20, 0x0, 0xa1, 0x0, 0xf5, 0x8, 0x29, 0x99,
+    0x40, 0x68, 0x3, 0x99, 0x0, 0x6c, 0x1, 0x62,
+    0x8, 0xc0, 0x1f, 0x50, 0x80, 0x6, 0x80, 0x3e,
+    0x6d, 0x84, 0x0, 0xc9, 0x1a, 0xc0, 0x0,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x35, 0x53, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0xf1, 0xaa, 0x8c, 0x3, 0xff, 0x55, 0x60,
+    0xf, 0xff, 0xd1, 0x7f, 0xf3, 0x0, 0x1b, 0xff,
+    0x88, 0x3, 0xff, 0xa8, 0x5f, 0xfc, 0xc0, 0x6,
+    0xff, 0xe2, 0x0, 0xff, 0xff, 0x80, 0x70,
 
     /* U+002C "," */
-    0x1, 0x44, 0x41, 0x8, 0xff, 0xf3, 0xb, 0xff,
-    0xf0, 0xd, 0xff, 0xb0, 0xf, 0xff, 0x80, 0x3f,
-    0xff, 0x40, 0x6f, 0xff, 0x0, 0x9f, 0xfc, 0x0,
-    0xbf, 0xf8, 0x0, 0xef, 0xf5, 0x0,
+    0x1, 0x44, 0x84, 0x26, 0xee, 0x20, 0x30, 0x8,
+    0xc1, 0x80, 0x8, 0x0, 0x20, 0x1, 0x81, 0x80,
+    0x58, 0xa, 0x1, 0x20, 0x78, 0x0, 0xc0, 0x4,
+    0x0, 0x40, 0x2, 0x80, 0x34, 0x0,
 
     /* U+002D "-" */
-    0xcf, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff,
-    0xff, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xfc,
+    0xcf, 0xff, 0xd8, 0x1, 0xff, 0xc8,
 
     /* U+002E "." */
-    0x0, 0x33, 0x0, 0xc, 0xff, 0xc0, 0x7f, 0xff,
-    0xf7, 0x9f, 0xff, 0xf9, 0x6f, 0xff, 0xf6, 0x8,
-    0xee, 0x80,
+    0x0, 0x19, 0x80, 0x2c, 0xcc, 0xe, 0x60, 0x3,
+    0x7e, 0x0, 0xdd, 0xe0, 0x1b, 0xd9, 0xc4, 0x4e,
+    0xc0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x87, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0x24, 0x41, 0xc0, 0x3f, 0xd0, 0xee,
+    0xe0, 0xf, 0xe2, 0x30, 0x5, 0x0, 0x7f, 0x50,
+    0x0, 0x8c, 0x3, 0xf9, 0x80, 0xa, 0x1, 0xfc,
+    0x82, 0x0, 0xa0, 0xf, 0xee, 0x0, 0x19, 0x0,
+    0x7f, 0x28, 0x2, 0x80, 0x3f, 0x94, 0x2, 0x60,
+    0xf, 0xee, 0x0, 0x28, 0x7, 0xf0, 0xa0, 0x3,
+    0x80, 0x3f, 0x98, 0x0, 0x28, 0x1, 0xfd, 0x40,
+    0x6, 0x0, 0xfe, 0x32, 0x0, 0x50, 0x7, 0xf5,
+    0x0, 0xc, 0x80, 0x3f, 0x9c, 0x1, 0x40, 0x1f,
+    0xca, 0x20, 0x7, 0x0, 0xfe, 0xe0, 0x2, 0x8,
+    0x7, 0xe1, 0x40, 0x7, 0x0, 0x7f, 0x30, 0x0,
+    0x54, 0x3, 0xfa, 0xc0, 0xe, 0x1, 0xfc, 0x46,
+    0x0, 0xa0, 0xf, 0xea, 0x0, 0x11, 0x80, 0x7f,
+    0x30, 0x2, 0x80, 0x3f, 0x90, 0x40, 0xc, 0x1,
+    0xfd, 0xc0, 0x4, 0x10, 0xf, 0xe5, 0x0, 0x70,
+    0x7, 0xf3, 0x0, 0x4a, 0x1, 0xfd, 0x40, 0x6,
+    0x0, 0xff, 0x0,
 
     /* U+0030 "0" */
-    0x0, 0x3, 0xad, 0xff, 0xda, 0x30, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xff,
-    0xff, 0xee, 0xff, 0xff, 0x90, 0x3f, 0xff, 0xb2,
-    0x0, 0x2b, 0xff, 0xf3, 0x8f, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xf8, 0xbf, 0xf7, 0x0, 0x0, 0x0,
-    0x7f, 0xfb, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x5f,
-    0xfc, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xfc,
-    0xcf, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xfc, 0xcf,
-    0xf5, 0x5, 0xee, 0x50, 0x5f, 0xfc, 0xcf, 0xf5,
-    0xd, 0xff, 0xd0, 0x5f, 0xfc, 0xcf, 0xf5, 0xb,
-    0xff, 0xb0, 0x5f, 0xfc, 0xcf, 0xf5, 0x1, 0x88,
-    0x10, 0x5f, 0xfc, 0xcf, 0xf5, 0x0, 0x0, 0x0,
-    0x5f, 0xfc, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x5f,
-    0xfc, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x5f, 0xfc,
-    0xbf, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xfa, 0x8f,
-    0xfd, 0x0, 0x0, 0x0, 0xdf, 0xf8, 0x3f, 0xff,
-    0xb1, 0x0, 0x1b, 0xff, 0xf2, 0x9, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0x80, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x3, 0xad, 0xff, 0xd9,
-    0x30, 0x0,
+    0x0, 0x8e, 0xb7, 0xfd, 0xb4, 0x60, 0x1d, 0x38,
+    0xa4, 0x0, 0x25, 0xc9, 0x0, 0xa5, 0x80, 0x21,
+    0x10, 0x4, 0xd2, 0x6, 0xc0, 0x4, 0xde, 0xe6,
+    0xa0, 0x1, 0x8e, 0xc0, 0x5, 0x64, 0x0, 0x2b,
+    0x20, 0x5, 0x98, 0x2, 0x80, 0x3d, 0x40, 0x3,
+    0x70, 0x1, 0x0, 0x78, 0x80, 0xe, 0x1, 0xff,
+    0xd5, 0x5e, 0xe2, 0x80, 0x7f, 0xa0, 0x45, 0x0,
+    0x1f, 0xe6, 0x0, 0x30, 0x7, 0xfa, 0x9d, 0xd4,
+    0x1, 0xfe, 0x18, 0x80, 0x80, 0x7f, 0xf5, 0x5c,
+    0x0, 0x40, 0x1e, 0x20, 0x3, 0x18, 0x2, 0x80,
+    0x3d, 0x40, 0x2, 0xb0, 0x1, 0x58, 0x80, 0x6,
+    0xc8, 0x1, 0x46, 0xc0, 0x4, 0xee, 0xc8, 0x0,
+    0x72, 0x9, 0x50, 0x8, 0x44, 0x1, 0x34, 0x0,
+    0x55, 0x8a, 0x40, 0x2, 0x6c, 0x90, 0x0,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x3d, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xba, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff,
-    0x70, 0x9f, 0xfa, 0x0, 0x0, 0x6, 0xfd, 0x30,
-    0x9, 0xff, 0xa0, 0x0, 0x0, 0x6a, 0x0, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x1, 0x0, 0x0, 0x9,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0xc7, 0xbf, 0xf5, 0x0, 0x7e, 0x7c, 0x20,
+    0xf, 0xf0, 0xdc, 0x0, 0x7f, 0xc7, 0xe8, 0x0,
+    0x45, 0x0, 0xfc, 0xa2, 0x0, 0x8b, 0x30, 0xf,
+    0xf1, 0x63, 0x80, 0x7f, 0xcb, 0xa6, 0x1, 0xff,
+    0x3d, 0x0, 0x7f, 0xf0, 0x44, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xe1, 0x37, 0xff,
+    0x30, 0x1, 0x7f, 0xf2, 0x80, 0x7f, 0xf0, 0x8c,
+    0x3, 0xff, 0x86,
 
     /* U+0032 "2" */
-    0x0, 0x3, 0x9d, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x2f, 0xff, 0xc3,
-    0x0, 0x4e, 0xff, 0xf1, 0x9f, 0xfe, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0xcf, 0xf7, 0x0, 0x0, 0x0,
-    0xcf, 0xf9, 0x89, 0x93, 0x0, 0x0, 0x0, 0xaf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff,
+    0x0, 0x8e, 0x77, 0xfd, 0xb2, 0x60, 0x1d, 0x18,
+    0xc4, 0x0, 0x26, 0xc8, 0x0, 0xa1, 0xc0, 0x3f,
+    0x3b, 0x80, 0x9c, 0x0, 0x79, 0xfe, 0xb1, 0x0,
+    0x40, 0xd8, 0x0, 0x70, 0xc0, 0x9, 0x80, 0x13,
+    0x28, 0x2, 0x40, 0x38, 0x8c, 0x1, 0xc8, 0xcc,
+    0x40, 0xf, 0x30, 0x0, 0xe2, 0x64, 0x60, 0x1e,
+    0x60, 0x1, 0x80, 0x7f, 0x9, 0x80, 0x34, 0x3,
+    0xfa, 0xc0, 0x2, 0x80, 0x1f, 0x99, 0x40, 0x10,
+    0x1, 0xf9, 0x24, 0x0, 0xac, 0x1, 0xf2, 0x58,
+    0x0, 0xe8, 0x3, 0xe4, 0xb0, 0x1, 0x68, 0x7,
+    0xc7, 0x60, 0x2, 0xc1, 0x0, 0xf1, 0xe0, 0x0,
+    0xb0, 0x40, 0x3c, 0x78, 0x0, 0x2c, 0x10, 0xf,
+    0x16, 0x80, 0xb, 0x4, 0x3, 0xc5, 0x82, 0x5,
+    0x82, 0x1, 0xf5, 0x88, 0x0, 0xbb, 0xff, 0xee,
+    0x0, 0xff, 0xe0, 0x88, 0x7, 0xff, 0x8,
 
     /* U+0033 "3" */
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x5,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0x93, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x9, 0xbb, 0xdf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x80, 0x44, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0xf, 0xff, 0x50, 0x0, 0x0, 0xc, 0xff, 0x70,
-    0xdf, 0xfa, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x7,
-    0xff, 0xf9, 0x10, 0x4, 0xdf, 0xff, 0x0, 0xd,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0x60, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x6,
-    0xbe, 0xff, 0xd9, 0x20, 0x0,
+    0x5, 0xff, 0xff, 0xc0, 0x1f, 0xfc, 0x61, 0x1f,
+    0xc0, 0x1e, 0x5e, 0xef, 0xb4, 0x2, 0x90, 0xf,
+    0xe3, 0xc0, 0x4, 0xb0, 0x7, 0xe3, 0xc0, 0x4,
+    0xb0, 0x7, 0xe3, 0xc0, 0x4, 0xb0, 0x7, 0xe4,
+    0xc0, 0x5, 0x30, 0x7, 0xf4, 0x0, 0x51, 0x26,
+    0x1, 0xff, 0x89, 0xb2, 0x0, 0x3e, 0x54, 0x41,
+    0x0, 0x4e, 0xe0, 0xf, 0x4d, 0xdb, 0x74, 0x60,
+    0x8, 0x10, 0xf, 0xe2, 0xe0, 0x9, 0x0, 0x3f,
+    0xc4, 0x60, 0xd, 0x0, 0xff, 0x98, 0x3, 0x22,
+    0x40, 0x1f, 0xfa, 0xee, 0x50, 0xf, 0x30, 0x3,
+    0xc0, 0x80, 0x1e, 0x1, 0xc6, 0x60, 0x1, 0x5,
+    0x0, 0x16, 0x44, 0x0, 0x9c, 0x1, 0x28, 0x39,
+    0x0, 0x1b, 0xb9, 0xf6, 0x40, 0x9, 0x0, 0xbc,
+    0x80, 0x21, 0x0, 0xd0, 0xc0, 0x11, 0x6c, 0xa0,
+    0x80, 0x9, 0xb5, 0xc0, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x50, 0x0, 0x3c, 0xcb, 0x0, 0xef,
-    0xfb, 0x0, 0x0, 0x4f, 0xff, 0x9, 0xff, 0xf1,
-    0x0, 0x0, 0x4f, 0xff, 0xf, 0xff, 0x60, 0x0,
-    0x0, 0x4f, 0xff, 0xf, 0xff, 0x10, 0x0, 0x0,
-    0x4f, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff,
+    0x0, 0xfc, 0xdf, 0xf2, 0x0, 0x7e, 0x18, 0x0,
+    0x32, 0x0, 0x7e, 0xb1, 0x1, 0x90, 0xf, 0xca,
+    0xa0, 0x5, 0x0, 0x7e, 0x1b, 0x0, 0x2a, 0x0,
+    0x7e, 0xb1, 0x1, 0xb0, 0xf, 0xc8, 0xa0, 0xb,
+    0x10, 0xf, 0xd4, 0x0, 0x55, 0x0, 0x7e, 0x91,
+    0x1, 0xb0, 0xf, 0xc8, 0xc0, 0xb, 0x10, 0x1,
+    0xe6, 0x2c, 0x1, 0x40, 0x4, 0x50, 0x9, 0xcc,
+    0xc8, 0x12, 0x20, 0xa, 0x0, 0xfe, 0x60, 0x4,
+    0x88, 0x7, 0xfe, 0x70, 0xf, 0xfe, 0xf, 0x7f,
+    0xf5, 0x80, 0x7f, 0xf5, 0x3f, 0xff, 0xac, 0x3,
+    0xff, 0xde,
 
     /* U+0035 "5" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x3f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xea, 0x40, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x2e, 0xee,
-    0xee, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfa, 0x34, 0x41, 0x0, 0x0, 0x0, 0x8f, 0xfa,
-    0xef, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0xbf,
-    0xfc, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x6f, 0xff,
-    0xa1, 0x0, 0x3c, 0xff, 0xf2, 0xc, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0x80, 0x1, 0xcf, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9,
-    0x30, 0x0,
+    0x3f, 0xff, 0xfb, 0x80, 0x3f, 0xf9, 0xe6, 0x1,
+    0x8b, 0xff, 0xf6, 0x80, 0x7f, 0xfc, 0xb, 0xff,
+    0x75, 0x20, 0x7, 0xfc, 0x2b, 0x74, 0x0, 0x11,
+    0xf8, 0x3, 0x2c, 0x81, 0x77, 0x7b, 0xf0, 0x80,
+    0xc, 0x40, 0x1f, 0x8f, 0x0, 0x25, 0x0, 0xfe,
+    0x14, 0x0, 0x70, 0x7, 0xf8, 0xc0, 0x6, 0x64,
+    0x40, 0x80, 0x7f, 0xb6, 0xec, 0xe0, 0x1e, 0x20,
+    0x1, 0xa8, 0x2, 0x80, 0x38, 0x54, 0x1, 0xda,
+    0x0, 0x3a, 0x10, 0x1, 0xe8, 0x4, 0xac, 0x60,
+    0x5, 0xee, 0x7e, 0x18, 0x1, 0xc8, 0x34, 0xc0,
+    0x21, 0x0, 0xcd, 0x0, 0x1, 0xca, 0x41, 0x0,
+    0x13, 0x64, 0x80, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x7c, 0xfe, 0xc7, 0x10, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x1, 0xff, 0xff, 0xc8, 0x8c, 0xff, 0xfe, 0x10,
-    0x8, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0x80,
-    0xd, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xe0,
-    0x1f, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0xf2,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf2,
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0xf1,
-    0xd, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xc0,
-    0x6, 0xff, 0xfa, 0x10, 0x1, 0xaf, 0xff, 0x50,
-    0x0, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0xfa, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
+    0x0, 0xfa, 0x7f, 0xdc, 0x20, 0x1f, 0xe2, 0x60,
+    0x4, 0x8, 0x7, 0xfa, 0x40, 0x6, 0xc0, 0x1f,
+    0xe3, 0x40, 0x7, 0x80, 0x7f, 0xde, 0x0, 0x63,
+    0x0, 0xff, 0x29, 0x80, 0xc0, 0x7, 0xfd, 0x60,
+    0x8, 0x10, 0xf, 0xf3, 0x88, 0x1b, 0x0, 0x7f,
+    0x86, 0x0, 0x17, 0x9f, 0xd8, 0xe2, 0x1, 0xd0,
+    0x1, 0x41, 0x80, 0x9c, 0x61, 0x0, 0x42, 0xc0,
+    0x11, 0xbb, 0x8c, 0x0, 0x58, 0x20, 0x9, 0x0,
+    0xab, 0x22, 0x19, 0x40, 0x1, 0x90, 0x2, 0x80,
+    0x1d, 0x40, 0x32, 0xb8, 0x1, 0x80, 0x48, 0x1,
+    0x20, 0x1e, 0xa0, 0x0, 0x91, 0x0, 0x21, 0x0,
+    0xf1, 0x0, 0x42, 0x1, 0xff, 0xc3, 0x12, 0x0,
+    0x8c, 0x3, 0xc6, 0x1, 0x18, 0x90, 0x2, 0x0,
+    0x3d, 0x0, 0x3, 0x10, 0xb0, 0x2, 0x50, 0x80,
+    0x6, 0x90, 0x1, 0x20, 0x6, 0x40, 0x2, 0xf7,
+    0x65, 0x0, 0x2a, 0x80, 0x2b, 0x60, 0x8, 0x44,
+    0x1, 0x35, 0x0, 0x74, 0xe3, 0x10, 0x0, 0x9b,
+    0x24, 0x2,
 
     /* U+0037 "7" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf,
-    0xff, 0xee, 0xee, 0xee, 0xef, 0xff, 0x9c, 0xff,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xf5, 0xcf, 0xf7,
-    0x0, 0x0, 0x0, 0x8f, 0xfe, 0xc, 0xff, 0x70,
-    0x0, 0x0, 0xe, 0xff, 0x80, 0x68, 0x83, 0x0,
-    0x0, 0x5, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xfe, 0xc, 0x80, 0x7f, 0xf1, 0xc4,
+    0x7e, 0x0, 0xfa, 0x3b, 0xbd, 0x80, 0x16, 0x0,
+    0x7f, 0xa8, 0x0, 0x2a, 0x1, 0xfe, 0x60, 0x3,
+    0x5, 0x3b, 0x90, 0x3, 0x94, 0x40, 0x14, 0xd,
+    0x10, 0x30, 0xe, 0x90, 0x2, 0x10, 0x7, 0xf1,
+    0x98, 0x1, 0xe0, 0x1f, 0xea, 0x0, 0xa, 0x0,
+    0x7f, 0xb, 0x0, 0x24, 0x3, 0xfc, 0xc0, 0x13,
+    0x0, 0x7f, 0xa8, 0x0, 0xa2, 0x1, 0xfc, 0x84,
+    0x0, 0xe0, 0xf, 0xf7, 0x0, 0x9, 0x0, 0x3f,
+    0x85, 0x40, 0x16, 0x1, 0xfe, 0x90, 0x9, 0xc0,
+    0x3f, 0xcc, 0x0, 0x61, 0x0, 0xfe, 0x51, 0x0,
+    0x50, 0x7, 0xfa, 0x40, 0x6, 0x60, 0xf, 0xe2,
+    0x30, 0x5, 0x0, 0x7f, 0xac, 0x0, 0x2c, 0x1,
+    0xf0,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x9f, 0xff, 0xfe, 0xef, 0xff, 0xf9, 0x0,
-    0x2, 0xff, 0xfb, 0x10, 0x1, 0xbf, 0xff, 0x20,
-    0x7, 0xff, 0xe0, 0x0, 0x0, 0xe, 0xff, 0x70,
-    0x8, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0x90,
-    0x7, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0x70,
-    0x3, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x9f, 0xfd, 0x41, 0x14, 0xdf, 0xfa, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x2, 0x9f, 0xff, 0xff, 0xf9, 0x20, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0xcf, 0xff, 0xf7, 0x0,
-    0x4, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0x40,
-    0xd, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xd0,
-    0x1f, 0xff, 0x10, 0x0, 0x0, 0x1, 0xff, 0xf1,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0x2f, 0xff, 0x20, 0x0, 0x0, 0x2, 0xff, 0xf1,
-    0xe, 0xff, 0x90, 0x0, 0x0, 0x9, 0xff, 0xe0,
-    0x8, 0xff, 0xf9, 0x10, 0x1, 0x9f, 0xff, 0x80,
-    0x0, 0xcf, 0xff, 0xfe, 0xef, 0xff, 0xfc, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfd, 0xa4, 0x0, 0x0,
+    0x0, 0xc7, 0x3b, 0xfe, 0xd9, 0x30, 0xf, 0xa7,
+    0x18, 0x80, 0x4, 0xd9, 0x20, 0x1d, 0x2c, 0x1,
+    0x8, 0x80, 0x26, 0x90, 0x8, 0x98, 0x0, 0x9d,
+    0xd9, 0x0, 0xc, 0x40, 0x5, 0x0, 0xd, 0x88,
+    0x0, 0x6c, 0x40, 0xa, 0x0, 0xf0, 0x2, 0x0,
+    0x79, 0x0, 0x1c, 0x0, 0xf0, 0x0, 0x80, 0x78,
+    0x40, 0x1c, 0x0, 0x40, 0x2, 0x8, 0x6, 0x14,
+    0x0, 0x20, 0x0, 0xd8, 0x1, 0x88, 0x22, 0x4c,
+    0x0, 0x29, 0x80, 0x52, 0xe0, 0x57, 0xdc, 0xb2,
+    0x7, 0xa0, 0xe, 0xa6, 0x0, 0xf3, 0x50, 0x7,
+    0x3e, 0xb0, 0x0, 0xcc, 0x0, 0x6d, 0x70, 0x9,
+    0x20, 0x0, 0xff, 0x98, 0xf7, 0x0, 0x42, 0x0,
+    0x24, 0x0, 0xf0, 0x1, 0xa1, 0xc0, 0x12, 0x2,
+    0x40, 0x9, 0x0, 0xf4, 0x80, 0x8, 0x48, 0x2,
+    0x10, 0xf, 0x8, 0x4, 0x42, 0x1, 0x10, 0x7,
+    0x88, 0x2, 0x22, 0x8, 0x2, 0xc0, 0x3d, 0x60,
+    0x1, 0x10, 0x30, 0x1, 0xa4, 0x40, 0x3, 0x2c,
+    0x0, 0x60, 0x4, 0x18, 0x1, 0xbb, 0xb3, 0x0,
+    0xe, 0x0, 0x2d, 0x40, 0x8, 0x44, 0x1, 0x26,
+    0x80, 0x61, 0xbb, 0x29, 0x0, 0x9, 0x6e, 0xc2,
+    0x0,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xfa, 0x0,
-    0x6, 0xff, 0xf9, 0x10, 0x1, 0x9f, 0xff, 0x60,
-    0xd, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0xc0,
-    0x1f, 0xff, 0x20, 0x0, 0x0, 0x2, 0xff, 0xf1,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0xf1,
-    0xc, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xd0,
-    0x5, 0xff, 0xfc, 0x30, 0x4, 0xcf, 0xff, 0x70,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x6, 0x89, 0x6a, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0xc7, 0x3b, 0xfe, 0xd9, 0x30, 0xf, 0xab,
+    0x18, 0x80, 0x4, 0xd9, 0x20, 0x1d, 0x6a, 0x1,
+    0x11, 0x0, 0x26, 0xa0, 0x9, 0x90, 0x0, 0xdd,
+    0xba, 0xe6, 0x0, 0x2b, 0x0, 0x2c, 0x0, 0xb2,
+    0x20, 0x1, 0x95, 0x0, 0x50, 0x9, 0x0, 0x20,
+    0x3, 0xd0, 0x0, 0x31, 0x20, 0x8, 0x80, 0x3c,
+    0x40, 0x11, 0x0, 0x7f, 0xf1, 0x8, 0x2, 0x30,
+    0xf, 0x18, 0x4, 0x42, 0x60, 0x8, 0x0, 0xf4,
+    0x0, 0x8, 0x42, 0x40, 0x9, 0x86, 0x0, 0x4c,
+    0x40, 0x5, 0x0, 0x15, 0x80, 0x7, 0x9f, 0xeb,
+    0x30, 0x9, 0x80, 0x29, 0x80, 0xf, 0xe6, 0x10,
+    0xc, 0xff, 0x2e, 0xd2, 0xa0, 0x14, 0x0, 0x7c,
+    0xd1, 0x2a, 0xa0, 0x3, 0x88, 0x7, 0xfb, 0xc0,
+    0x3, 0x0, 0x1f, 0xe5, 0x30, 0x4, 0x0, 0x7f,
+    0xd0, 0x0, 0x26, 0x0, 0xff, 0x39, 0x0, 0x24,
+    0x3, 0xfc, 0x30, 0x0, 0x44, 0x0, 0x7f, 0xa0,
+    0x2, 0x90, 0xf, 0xf1, 0x30, 0x1, 0x88, 0x3,
+    0xc0,
 
     /* U+003A ":" */
-    0x9, 0xee, 0x90, 0x7f, 0xff, 0xf7, 0x9f, 0xff,
-    0xf9, 0x5f, 0xff, 0xf5, 0x6, 0xbb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xbb, 0x60, 0x5f,
-    0xff, 0xf5, 0x9f, 0xff, 0xf9, 0x7f, 0xff, 0xf7,
-    0x9, 0xee, 0x90,
+    0x9, 0xee, 0x48, 0x3b, 0x8, 0x99, 0xf8, 0x3,
+    0x76, 0x0, 0x6c, 0x59, 0x44, 0x4a, 0x83, 0x5d,
+    0x98, 0x3, 0xff, 0xb4, 0xd7, 0x66, 0x5, 0x94,
+    0x44, 0xae, 0x0, 0x6c, 0xe0, 0xd, 0xce, 0xc2,
+    0x26, 0x70,
 
     /* U+003B ";" */
-    0x0, 0xaf, 0xfa, 0x0, 0x7f, 0xff, 0xf7, 0xa,
-    0xff, 0xff, 0xa0, 0x6f, 0xff, 0xf6, 0x0, 0x7c,
-    0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x24, 0x44, 0x10, 0xa, 0xff,
-    0xf1, 0x0, 0xdf, 0xfd, 0x0, 0xf, 0xff, 0x90,
-    0x3, 0xff, 0xf5, 0x0, 0x5f, 0xff, 0x10, 0x8,
-    0xff, 0xe0, 0x0, 0xbf, 0xfa, 0x0, 0xe, 0xff,
-    0x60, 0x1, 0xff, 0xf2, 0x0,
+    0x0, 0x57, 0xfa, 0x80, 0xe, 0xa0, 0x5, 0x70,
+    0xd0, 0xd, 0xa1, 0x80, 0x1b, 0x1, 0xa0, 0xcd,
+    0xc, 0x0, 0x7c, 0xc3, 0x80, 0x7f, 0xf8, 0x49,
+    0x12, 0x10, 0x4, 0x5d, 0xc0, 0x13, 0x80, 0x8,
+    0x40, 0x4, 0x0, 0x40, 0x1, 0x80, 0x58, 0x0,
+    0x60, 0x9, 0x0, 0x1a, 0x0, 0x11, 0x0, 0xc,
+    0x0, 0x80, 0x12, 0x80, 0x30, 0x0, 0x22, 0x0,
+    0x20, 0x0,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xf9, 0x0, 0x0, 0x0,
-    0x3, 0xaf, 0xff, 0xf9, 0x0, 0x0, 0x3, 0xbf,
-    0xff, 0xfd, 0x60, 0x0, 0x3, 0xbf, 0xff, 0xfd,
-    0x50, 0x0, 0x3, 0xbf, 0xff, 0xfd, 0x50, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xff, 0x81, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe6, 0x95, 0x48, 0x7, 0xf1, 0x56,
+    0xa8, 0x7, 0xe3, 0xad, 0x50, 0xf, 0xc7, 0x78,
+    0xa0, 0x2, 0x99, 0x0, 0x47, 0x78, 0x80, 0x2,
+    0xad, 0x60, 0x1, 0xde, 0x20, 0x0, 0xab, 0x54,
+    0x2, 0x7c, 0x40, 0x1, 0xde, 0xa8, 0x7, 0x70,
+    0x1, 0x6f, 0x10, 0x3, 0xfc, 0xc4, 0x1, 0xfd,
+    0xc0, 0x3, 0x9e, 0x60, 0xf, 0x9f, 0x10, 0x0,
+    0x33, 0xce, 0x1, 0xe3, 0xbc, 0x40, 0x0, 0xc7,
+    0x38, 0x7, 0x8e, 0xf1, 0x0, 0x3, 0x1f, 0x2,
+    0x1, 0xc7, 0x78, 0xa0, 0x13, 0xc0, 0x7, 0xc7,
+    0x5a, 0xa0, 0x1f, 0xf8, 0xab, 0x54, 0x3, 0xff,
+    0x15, 0x48,
 
     /* U+003D "=" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x7f, 0xff, 0xfd, 0x0, 0x1f, 0xfd, 0x7, 0xff,
+    0xff, 0xd0, 0x1, 0xff, 0xde, 0x7f, 0xff, 0xfc,
+    0xe0, 0x1f, 0xfc, 0x1f, 0x0, 0xff, 0xe1, 0x0,
 
     /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8a,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xfb,
-    0x40, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xaf, 0xf9, 0x0, 0x0,
-    0x0, 0x5, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xfb, 0x40, 0x0, 0x6, 0xdf, 0xff,
-    0xfb, 0x30, 0x0, 0x6, 0xef, 0xff, 0xfb, 0x30,
-    0x0, 0x0, 0x8f, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x9f, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x8a, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x45, 0x10, 0x7, 0xfc, 0x2b,
+    0xb4, 0x60, 0x1f, 0xc2, 0x0, 0x5c, 0xb3, 0x0,
+    0xfa, 0x20, 0x20, 0x4, 0xcb, 0x30, 0xf, 0x3f,
+    0x40, 0x80, 0x13, 0x2c, 0xc0, 0x3c, 0xfd, 0x22,
+    0x0, 0x4c, 0xb4, 0x0, 0xf3, 0x74, 0x90, 0x1,
+    0x2e, 0x0, 0x3e, 0x6d, 0xa3, 0x0, 0x8, 0x7,
+    0xf0, 0xb0, 0x7, 0xf9, 0x76, 0xd4, 0x0, 0x20,
+    0x1c, 0xbb, 0x44, 0x0, 0x4b, 0x80, 0x9, 0xb6,
+    0x88, 0x0, 0x99, 0x68, 0x0, 0x6e, 0x92, 0x0,
+    0x26, 0x59, 0x80, 0x51, 0x22, 0x0, 0x4c, 0xb3,
+    0x0, 0xe1, 0x0, 0x2e, 0xd9, 0x80, 0x7c, 0x2b,
+    0xb4, 0x40, 0x1f, 0xd1, 0x44, 0x1, 0xff, 0x0,
 
     /* U+003F "?" */
-    0x5f, 0xff, 0xfe, 0xc8, 0x20, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x1, 0x11, 0x13, 0x7e, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfb,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0,
-    0x1, 0x5e, 0xff, 0xf2, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x1f, 0xff, 0xb9, 0x30, 0x0, 0x0, 0x1f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x54, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xdb, 0x20,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5e,
-    0xfd, 0x30, 0x0, 0x0,
+    0x5f, 0xfd, 0xd9, 0x4, 0x1, 0xf8, 0x4d, 0xf5,
+    0xc0, 0x3f, 0xe8, 0x60, 0x5e, 0xed, 0x90, 0x20,
+    0x9, 0x10, 0x11, 0xc6, 0xf8, 0x1, 0x30, 0x7,
+    0xc4, 0xc0, 0xd, 0x0, 0xfd, 0xc0, 0x6, 0x0,
+    0xfd, 0xc0, 0x7, 0x0, 0xf8, 0x5c, 0x0, 0x60,
+    0x1c, 0x2b, 0xe2, 0x0, 0xa0, 0x1, 0x7f, 0xba,
+    0x84, 0x0, 0xe4, 0x0, 0x30, 0xf, 0x34, 0x0,
+    0x7c, 0x8d, 0x92, 0x1, 0xfa, 0xe4, 0xc0, 0x3f,
+    0xf8, 0xa3, 0x54, 0xb0, 0xf, 0xe5, 0x52, 0x0,
+    0x7f, 0xf2, 0xe, 0xf6, 0xc8, 0x3, 0xee, 0x42,
+    0x48, 0x0, 0xf8, 0xc0, 0x21, 0x0, 0xfa, 0xc4,
+    0xa, 0x0, 0x38,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xbf, 0xff, 0xb8, 0x78, 0xcf, 0xff, 0x60,
-    0x7, 0xff, 0xd2, 0x0, 0x0, 0x3, 0xef, 0xf2,
-    0xf, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x9f, 0xf2, 0x0, 0x0, 0x1, 0x10, 0xc, 0xfe,
-    0xbf, 0xf0, 0x0, 0x3, 0xdf, 0xfd, 0x4c, 0xff,
-    0xdf, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0xff,
-    0xdf, 0xf0, 0x0, 0x9f, 0xfa, 0x11, 0xaf, 0xff,
-    0xdf, 0xf0, 0x0, 0xdf, 0xf0, 0x0, 0xf, 0xff,
-    0xdf, 0xf0, 0x0, 0xef, 0xc0, 0x0, 0xc, 0xff,
-    0xdf, 0xf0, 0x0, 0xef, 0xc0, 0x0, 0xc, 0xff,
-    0xdf, 0xf0, 0x0, 0xef, 0xc0, 0x0, 0xc, 0xff,
-    0xdf, 0xf0, 0x0, 0xef, 0xc0, 0x0, 0xc, 0xff,
-    0xdf, 0xf0, 0x0, 0xef, 0xd0, 0x0, 0xd, 0xff,
-    0xdf, 0xf0, 0x0, 0xbf, 0xf1, 0x0, 0x2f, 0xfc,
-    0xdf, 0xf0, 0x0, 0x5f, 0xfd, 0x56, 0xdf, 0xf6,
-    0xdf, 0xf0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xb0,
-    0xcf, 0xf0, 0x0, 0x0, 0x6c, 0xff, 0xc7, 0x0,
-    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfb, 0xa9, 0x99, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0xc7, 0x3b, 0xfe, 0xec, 0x71, 0x0, 0xf4,
+    0xe3, 0x10, 0x0, 0x4e, 0x39, 0x80, 0x35, 0xb0,
+    0x1, 0x1e, 0x1c, 0xc0, 0x12, 0xc0, 0x7, 0x40,
+    0x2d, 0xb8, 0x78, 0xcc, 0x8, 0x49, 0x4, 0x0,
+    0xe1, 0x0, 0x71, 0xd8, 0x2, 0x98, 0x1, 0x22,
+    0x1, 0xf2, 0x80, 0x13, 0xc0, 0xa, 0x1, 0xc2,
+    0x20, 0x1, 0x81, 0x10, 0x0, 0x40, 0x11, 0xef,
+    0x73, 0x50, 0x0, 0x2c, 0x1, 0xc5, 0x84, 0x0,
+    0x2b, 0x10, 0xf, 0xd6, 0x0, 0x5e, 0xe2, 0x90,
+    0x7, 0xe4, 0x0, 0x50, 0x8a, 0x80, 0x3f, 0x8c,
+    0xc, 0x3, 0x18, 0x7, 0xff, 0xb8, 0x40, 0x30,
+    0x80, 0x7e, 0x50, 0x21, 0x0, 0x11, 0x0, 0xc0,
+    0x3d, 0xc0, 0xc, 0x56, 0xf0, 0x5, 0x0, 0x79,
+    0x54, 0x5, 0x52, 0x40, 0x8c, 0x20, 0x1e, 0xa9,
+    0x30, 0x1, 0xc5, 0x83, 0x0, 0xc, 0x3, 0x36,
+    0x7f, 0xb1, 0xc0, 0x18, 0x0, 0xa0, 0xf, 0xfc,
+    0xe0, 0x6, 0x30, 0xf, 0xf8, 0x64, 0x1, 0x8c,
+    0x1, 0xff, 0x32, 0x80, 0x27, 0xee, 0xa6, 0x60,
+    0xf, 0x54, 0x0, 0x48, 0xac, 0xd0, 0x7, 0xcf,
+    0xae, 0x62, 0x1, 0xf8,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfd, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfa, 0xaf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf7, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf4, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xc0, 0xc, 0xff, 0x40, 0x0,
-    0x0, 0x8, 0xff, 0x80, 0x9, 0xff, 0x80, 0x0,
-    0x0, 0xc, 0xff, 0x50, 0x5, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0x10, 0x1, 0xff, 0xf1, 0x0,
-    0x0, 0x4f, 0xfd, 0x0, 0x0, 0xdf, 0xf4, 0x0,
-    0x0, 0x8f, 0xfa, 0x0, 0x0, 0xaf, 0xf9, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x4, 0xff, 0xfb, 0xbb, 0xbb, 0xbf, 0xff, 0x50,
-    0x9, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0x90,
-    0xd, 0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xd0,
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0xf1,
-    0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
+    0x0, 0xe4, 0xff, 0xc8, 0x1, 0xfe, 0xc0, 0xd,
+    0x80, 0x1f, 0xe4, 0x0, 0xc8, 0x1, 0xfe, 0x30,
+    0x22, 0x1, 0x80, 0x7f, 0x20, 0x1, 0xdc, 0x0,
+    0x40, 0xf, 0xd8, 0x0, 0xdd, 0x0, 0x30, 0x3,
+    0xf2, 0x0, 0xd, 0x0, 0x8, 0x1, 0xf8, 0xc0,
+    0x8, 0x60, 0x3, 0x0, 0xf9, 0x0, 0x6, 0x0,
+    0x30, 0x2, 0x0, 0x7b, 0x0, 0x8, 0x0, 0x50,
+    0x6, 0x0, 0x79, 0x0, 0x1a, 0x0, 0xc0, 0x2,
+    0x0, 0x78, 0xc0, 0x8, 0x0, 0x40, 0x1, 0x88,
+    0x6, 0x40, 0x1, 0x8, 0x0, 0x48, 0x0, 0xa0,
+    0x1b, 0x0, 0xe, 0x1, 0x9c, 0x1, 0xa0, 0x19,
+    0x0, 0xb, 0xff, 0x94, 0x0, 0x80, 0x10, 0x98,
+    0x7, 0xf8, 0x84, 0x0, 0xa0, 0x12, 0x27, 0x80,
+    0x24, 0x0, 0x68, 0x1, 0x2e, 0xfc, 0x80, 0xc,
+    0x0, 0x20, 0x3, 0x0, 0x3d, 0x80, 0x4, 0x1,
+    0x20, 0x2, 0x0, 0x79, 0x0, 0x4, 0x28, 0x1,
+    0x18, 0x7, 0x8c, 0x40, 0x9, 0x80, 0x4, 0x0,
+    0xfc, 0xa0, 0xc,
 
     /* U+0042 "B" */
-    0x7f, 0xff, 0xff, 0xff, 0xea, 0x50, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x7f,
-    0xff, 0xdd, 0xde, 0xff, 0xff, 0xb0, 0x7, 0xff,
-    0xb0, 0x0, 0x1, 0xbf, 0xff, 0x40, 0x7f, 0xfb,
-    0x0, 0x0, 0x0, 0xdf, 0xf8, 0x7, 0xff, 0xb0,
-    0x0, 0x0, 0x9, 0xff, 0xa0, 0x7f, 0xfb, 0x0,
-    0x0, 0x0, 0xaf, 0xf8, 0x7, 0xff, 0xb0, 0x0,
-    0x0, 0x1e, 0xff, 0x30, 0x7f, 0xfb, 0x0, 0x1,
-    0x4d, 0xff, 0x90, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x70, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0x93, 0x0, 0x7, 0xff, 0xeb, 0xbb, 0xce, 0xff,
-    0xf6, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x7, 0xff,
-    0xf4, 0x7, 0xff, 0xb0, 0x0, 0x0, 0x9, 0xff,
-    0xc0, 0x7f, 0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x7, 0xff, 0xb0, 0x0, 0x0, 0x1, 0xff, 0xf2,
-    0x7f, 0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x17,
-    0xff, 0xb0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x7f,
-    0xfb, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x7, 0xff,
-    0xfd, 0xdd, 0xef, 0xff, 0xfe, 0x10, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x7, 0xff, 0xff,
-    0xff, 0xfe, 0xb6, 0x0, 0x0,
+    0x7f, 0xff, 0xba, 0x94, 0x3, 0xff, 0xa, 0xd5,
+    0x88, 0x7, 0x88, 0xa1, 0x0, 0x92, 0x80, 0x39,
+    0x37, 0x6e, 0xe2, 0x0, 0x11, 0x0, 0x1f, 0xc3,
+    0x64, 0x0, 0xc0, 0xf, 0xf9, 0x0, 0x4, 0x1,
+    0xff, 0x18, 0x0, 0x80, 0x3f, 0xc2, 0x80, 0xb,
+    0x0, 0xfc, 0x29, 0x82, 0xc, 0x60, 0x19, 0x3f,
+    0xee, 0xb2, 0x18, 0x90, 0xf, 0xfc, 0xe8, 0x1,
+    0xe1, 0x44, 0x8c, 0x41, 0xb1, 0x80, 0x39, 0x6e,
+    0xec, 0xe8, 0x0, 0x4a, 0x0, 0x7f, 0x9d, 0x80,
+    0x10, 0x1, 0xff, 0x58, 0x0, 0xc0, 0x3f, 0xe3,
+    0x0, 0x88, 0x3, 0xfc, 0x60, 0x11, 0x80, 0x7f,
+    0xa8, 0x0, 0x22, 0x0, 0xfe, 0x87, 0x0, 0x38,
+    0x6, 0x4d, 0xdb, 0xbd, 0xc0, 0x3, 0x0, 0x1c,
+    0x45, 0x8, 0x4, 0x58, 0x20, 0x1f, 0xc2, 0x93,
+    0xa4, 0x0,
 
     /* U+0043 "C" */
-    0x0, 0x2, 0x8d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xe, 0xff, 0xe5,
-    0x0, 0x2a, 0xff, 0xf5, 0x4f, 0xff, 0x30, 0x0,
-    0x0, 0xcf, 0xfb, 0x6f, 0xfe, 0x0, 0x0, 0x0,
-    0x7f, 0xfd, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x15,
-    0x54, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x14, 0x44,
-    0x6f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x4f,
-    0xff, 0x30, 0x0, 0x0, 0xcf, 0xfb, 0xe, 0xff,
-    0xe4, 0x0, 0x1a, 0xff, 0xf5, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x2, 0x8d, 0xff, 0xeb,
-    0x50, 0x0,
+    0x0, 0x8a, 0x37, 0xfd, 0xd6, 0xa0, 0x1c, 0xda,
+    0xe4, 0x0, 0x14, 0xab, 0x10, 0x2, 0xc8, 0x7,
+    0xe4, 0xd0, 0x5, 0x80, 0x6, 0xbf, 0xda, 0xa0,
+    0x3, 0x54, 0x10, 0x6, 0xa8, 0x0, 0xa8, 0xc0,
+    0x1c, 0x40, 0x1, 0x30, 0xe, 0xb0, 0x3, 0x8,
+    0x0, 0x80, 0x3c, 0xd5, 0x49, 0x0, 0xff, 0xa,
+    0xa9, 0x0, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x51,
+    0x44, 0x84, 0x0, 0x40, 0x1e, 0x6b, 0xb4, 0x90,
+    0x0, 0x4c, 0x3, 0xac, 0x0, 0xc8, 0x20, 0xd,
+    0x40, 0x0, 0xd1, 0x80, 0x38, 0x2c, 0x0, 0x37,
+    0xfe, 0xe5, 0x0, 0x1a, 0x82, 0xc8, 0x7, 0xe4,
+    0xd0, 0x9, 0xb5, 0xc8, 0x0, 0x29, 0x56, 0x20,
 
     /* U+0044 "D" */
-    0x8f, 0xff, 0xff, 0xfe, 0xc7, 0x10, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x8f, 0xff,
-    0xee, 0xef, 0xff, 0xff, 0x40, 0x8f, 0xfb, 0x0,
-    0x0, 0x5e, 0xff, 0xe0, 0x8f, 0xfb, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x8f, 0xfb, 0x0, 0x0, 0x0,
-    0xbf, 0xf9, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8f,
-    0xfa, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xfb,
-    0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x8f, 0xfb,
-    0x0, 0x0, 0x0, 0x8f, 0xfb, 0x8f, 0xfb, 0x0,
-    0x0, 0x0, 0x8f, 0xfb, 0x8f, 0xfb, 0x0, 0x0,
-    0x0, 0x8f, 0xfb, 0x8f, 0xfb, 0x0, 0x0, 0x0,
-    0x8f, 0xfb, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8f,
-    0xfb, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xfa,
-    0x8f, 0xfb, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x8f,
-    0xfb, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x8f, 0xfb,
-    0x0, 0x0, 0x5e, 0xff, 0xe0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0xc7,
-    0x10, 0x0,
+    0x8f, 0xff, 0x76, 0x38, 0x80, 0x7f, 0x84, 0xe3,
+    0x94, 0x3, 0xc2, 0x30, 0x6, 0xa4, 0x0, 0xc9,
+    0xdd, 0x7d, 0x8, 0x2, 0x80, 0x3f, 0x97, 0x40,
+    0x2, 0xa0, 0x1f, 0xc6, 0x80, 0xc, 0x0, 0xff,
+    0x18, 0x0, 0xc0, 0x3f, 0xf8, 0x22, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xec, 0x8, 0x7, 0xf8, 0xc0,
+    0x6, 0x1, 0xfc, 0x68, 0x0, 0xc0, 0xf, 0xcb,
+    0xa0, 0x1, 0x50, 0x9, 0x3f, 0xf5, 0x8, 0x2,
+    0x80, 0x3f, 0xe1, 0xa4, 0x0, 0xfc, 0x27, 0x1e,
+    0xa0, 0x0,
 
     /* U+0045 "E" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3f, 0xff,
-    0xee, 0xee, 0xee, 0xee, 0xea, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x3f, 0xff, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x80, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xee,
-    0xee, 0xee, 0xee, 0xea, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb,
+    0x3f, 0xff, 0xfd, 0x60, 0x1f, 0xfc, 0x61, 0x1f,
+    0xf0, 0x6, 0xee, 0xfe, 0xa0, 0xf, 0xff, 0xf7,
+    0xff, 0xea, 0x0, 0xff, 0xe3, 0x91, 0x7f, 0x0,
+    0x76, 0xef, 0xe8, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf0, 0xbb, 0xbf, 0xa8, 0x3, 0x8, 0xff, 0x80,
+    0x3f, 0xf8, 0x40,
 
     /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x5f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x5f, 0xff, 0xfd, 0xc0, 0x1f, 0xfd, 0x32, 0xff,
+    0xfe, 0xe0, 0xf, 0xff, 0xe9, 0x7f, 0xff, 0x10,
+    0x7, 0xff, 0x4c, 0x7f, 0xff, 0x88, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xe7,
 
     /* U+0047 "G" */
-    0x0, 0x2, 0x9d, 0xff, 0xea, 0x40, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xd4,
-    0x0, 0x2b, 0xff, 0xf4, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0xdf, 0xf9, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0x8f, 0xfc, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x12,
-    0x22, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x0, 0x8f, 0xff, 0xff, 0xfd, 0x9f, 0xfa, 0x0,
-    0x8f, 0xff, 0xff, 0xfd, 0x9f, 0xfa, 0x0, 0x7e,
-    0xee, 0xff, 0xfd, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0x7f, 0xfd, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x7f,
-    0xfd, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x8f, 0xfc, 0x0, 0x0, 0x0, 0x9f, 0xfb, 0x5f,
-    0xff, 0x20, 0x0, 0x0, 0xef, 0xf9, 0x1f, 0xff,
-    0xd3, 0x0, 0x2b, 0xff, 0xf3, 0x7, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xa0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xea,
-    0x40, 0x0,
+    0x0, 0x8a, 0x77, 0xfd, 0xd4, 0x80, 0x1d, 0x1a,
+    0xc4, 0x0, 0x15, 0xbb, 0x0, 0x4e, 0xe0, 0xf,
+    0xc9, 0x60, 0x30, 0x0, 0x2b, 0xff, 0x6a, 0x0,
+    0x11, 0x20, 0xb, 0xd0, 0x0, 0x56, 0x40, 0xd,
+    0xd0, 0x0, 0xc8, 0x3, 0x94, 0x0, 0xa2, 0x0,
+    0x60, 0xf, 0x4e, 0xeb, 0x80, 0x3f, 0xc2, 0x45,
+    0x0, 0x7f, 0xf5, 0xa3, 0xff, 0xda, 0x1, 0xff,
+    0xc8, 0xf1, 0x18, 0x3, 0xfc, 0xfd, 0xd4, 0x0,
+    0x7f, 0xf4, 0x84, 0x40, 0x6, 0x0, 0xf7, 0x0,
+    0x1f, 0x40, 0x6, 0x40, 0x1c, 0xe0, 0x2, 0x40,
+    0xb, 0xcc, 0x0, 0x56, 0x20, 0xa, 0x18, 0x0,
+    0x16, 0x7f, 0x6a, 0x0, 0x14, 0xc1, 0xdc, 0x1,
+    0x84, 0x2, 0x5a, 0x0, 0xa3, 0x18, 0x80, 0x2,
+    0xb7, 0x40, 0x0,
 
     /* U+0048 "H" */
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf,
-    0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf,
-    0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0xf7,
+    0x7f, 0xf6, 0x0, 0x7b, 0x3f, 0xce, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xee, 0x1f, 0xff, 0x8c, 0x3,
+    0xff, 0xac, 0x7f, 0xfe, 0x30, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xa8,
 
     /* U+0049 "I" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xa,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
+    0x1f, 0xff, 0xfc, 0x20, 0x1f, 0xfc, 0x21, 0x0,
+    0xff, 0xe1, 0x7f, 0xe5, 0x0, 0x2f, 0xfe, 0x10,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xe3, 0xff, 0x94, 0x0, 0xbf, 0xf8, 0x44, 0x1,
+    0xff, 0xcf,
 
     /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x18, 0xaa, 0x40, 0x0, 0x0, 0x3, 0xff, 0xf1,
-    0xcf, 0xf8, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x8,
-    0xff, 0xe0, 0x0, 0x0, 0xc, 0xff, 0xc0, 0x3f,
-    0xff, 0xc3, 0x0, 0x1a, 0xff, 0xf6, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x39,
-    0xdf, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0xff, 0x17, 0xfc, 0x20, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xc2, 0x2a, 0x88,
+    0x1, 0xe1, 0x0, 0xc8, 0xaa, 0xc0, 0xf, 0x30,
+    0x4, 0x28, 0x0, 0x60, 0xf, 0x48, 0x0, 0xc2,
+    0xc0, 0x3, 0x86, 0x0, 0x1a, 0x30, 0x5, 0x1,
+    0xb0, 0x0, 0xf3, 0xfd, 0xca, 0x0, 0x36, 0x0,
+    0x4b, 0x0, 0x7e, 0x3d, 0x0, 0xd3, 0x8c, 0x40,
+    0x1, 0x5a, 0xc1, 0x0, 0x0,
 
     /* U+004B "K" */
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x67,
-    0xff, 0xc0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x7f,
-    0xfc, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x8f, 0xfe, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x7, 0xff, 0xc0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x7f, 0xfc, 0x0,
-    0x1, 0xff, 0xf7, 0x0, 0x7, 0xff, 0xc0, 0x0,
-    0x8f, 0xfe, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x1f,
-    0xff, 0x70, 0x0, 0x7, 0xff, 0xfd, 0xde, 0xff,
-    0xe0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x2f, 0xff, 0x70,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0xbf, 0xfe, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0xc, 0xff, 0xd0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x7,
-    0xff, 0xc0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0xd, 0xff, 0xc0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x37, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xef, 0xfb,
+    0x7f, 0xf6, 0x0, 0x78, 0x7f, 0xe6, 0x0, 0xff,
+    0x40, 0x0, 0x58, 0x3, 0xf8, 0x58, 0x1, 0x20,
+    0x1f, 0xe9, 0x0, 0xb, 0x80, 0x7f, 0xb, 0x80,
+    0x24, 0x3, 0xfd, 0x20, 0x1, 0x70, 0xf, 0xe1,
+    0x70, 0x4, 0x80, 0x7f, 0xa4, 0x0, 0x2e, 0x1,
+    0xfc, 0x2e, 0x0, 0x90, 0xf, 0x8f, 0x75, 0xe0,
+    0x1, 0x70, 0xf, 0xc4, 0x41, 0x0, 0x38, 0x7,
+    0xff, 0x9, 0xc0, 0x3f, 0x1f, 0xfb, 0x40, 0x2,
+    0xe0, 0x1f, 0xe2, 0x40, 0x4, 0x80, 0x7f, 0xd0,
+    0x0, 0x16, 0x0, 0xff, 0x19, 0x80, 0x16, 0x1,
+    0xff, 0x40, 0x0, 0x94, 0x3, 0xfc, 0x86, 0x0,
+    0x90, 0xf, 0xfa, 0x40, 0x6, 0x80, 0x1f, 0xe5,
+    0x20, 0x4, 0x0, 0x7f, 0xd6, 0x0, 0x33, 0x0,
+    0x7f, 0x98, 0x40, 0x10,
 
     /* U+004C "L" */
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9,
+    0x3f, 0xf8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xf7, 0x7f, 0xff,
+    0xa4, 0x3, 0xff, 0xa0,
 
     /* U+004D "M" */
-    0x1f, 0xff, 0xf7, 0x0, 0x0, 0x8f, 0xff, 0xf1,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0xcf, 0xef, 0xf1,
-    0x1f, 0xfc, 0xff, 0x0, 0x1, 0xff, 0xbf, 0xf1,
-    0x1f, 0xfa, 0xff, 0x40, 0x5, 0xfe, 0x9f, 0xf1,
-    0x1f, 0xfa, 0xbf, 0x90, 0xa, 0xf9, 0xaf, 0xf1,
-    0x1f, 0xfb, 0x6f, 0xd0, 0xe, 0xf4, 0xbf, 0xf1,
-    0x1f, 0xfc, 0x2f, 0xf1, 0x3f, 0xf0, 0xcf, 0xf1,
-    0x1f, 0xfd, 0xd, 0xf6, 0x7f, 0xb0, 0xdf, 0xf1,
-    0x1f, 0xfe, 0x8, 0xfa, 0xcf, 0x60, 0xdf, 0xf1,
-    0x1f, 0xfe, 0x4, 0xff, 0xff, 0x20, 0xef, 0xf1,
-    0x1f, 0xfe, 0x0, 0xff, 0xfd, 0x0, 0xef, 0xf1,
-    0x1f, 0xff, 0x0, 0xaf, 0xf8, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x25, 0x51, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0x1f, 0xfc, 0xe0, 0x1a, 0x3f, 0xf0, 0x80, 0x76,
+    0x0, 0x64, 0x1, 0x0, 0xf1, 0x82, 0x0, 0x42,
+    0x60, 0xa0, 0x1e, 0x60, 0x2, 0x0, 0x10, 0x4,
+    0x80, 0x3e, 0x40, 0xd0, 0x7, 0x83, 0x98, 0x7,
+    0x87, 0x41, 0x0, 0x8, 0x1a, 0x20, 0x1e, 0x74,
+    0x2, 0x13, 0x10, 0x47, 0x0, 0xf0, 0x91, 0x1,
+    0xd0, 0x10, 0x4, 0x3, 0xc6, 0xa, 0x19, 0x61,
+    0xa0, 0x1f, 0xec, 0x5, 0x30, 0x40, 0x30, 0xf,
+    0xc8, 0x1, 0x11, 0x0, 0x3f, 0x8, 0x1, 0x40,
+    0xa, 0x0, 0x10, 0xf, 0xe8, 0xaa, 0x48, 0x7,
+    0xfe, 0x25, 0x50, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfd, 0xe0,
 
     /* U+004E "N" */
-    0x9f, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xf9, 0x9f,
-    0xff, 0xf1, 0x0, 0x0, 0x7f, 0xf9, 0x9f, 0xff,
-    0xf6, 0x0, 0x0, 0x7f, 0xf9, 0x9f, 0xff, 0xfc,
-    0x0, 0x0, 0x7f, 0xf9, 0x9f, 0xfc, 0xff, 0x10,
-    0x0, 0x7f, 0xf9, 0x9f, 0xf8, 0xff, 0x70, 0x0,
-    0x7f, 0xf9, 0x9f, 0xf5, 0xef, 0xc0, 0x0, 0x7f,
-    0xf9, 0x9f, 0xf5, 0x8f, 0xf2, 0x0, 0x7f, 0xf9,
-    0x9f, 0xf6, 0x3f, 0xf7, 0x0, 0x7f, 0xf9, 0x9f,
-    0xf6, 0xd, 0xfd, 0x0, 0x7f, 0xf9, 0x9f, 0xf7,
-    0x8, 0xff, 0x30, 0x7f, 0xf9, 0x9f, 0xf7, 0x2,
-    0xff, 0x80, 0x6f, 0xf9, 0x9f, 0xf7, 0x0, 0xdf,
-    0xe0, 0x6f, 0xf9, 0x9f, 0xf7, 0x0, 0x7f, 0xf3,
-    0x6f, 0xf9, 0x9f, 0xf7, 0x0, 0x2f, 0xf9, 0x5f,
-    0xf9, 0x9f, 0xf7, 0x0, 0xc, 0xfe, 0x4f, 0xf9,
-    0x9f, 0xf7, 0x0, 0x6, 0xff, 0x8f, 0xf9, 0x9f,
-    0xf7, 0x0, 0x1, 0xff, 0xcf, 0xf9, 0x9f, 0xf7,
-    0x0, 0x0, 0xbf, 0xff, 0xf9, 0x9f, 0xf7, 0x0,
-    0x0, 0x6f, 0xff, 0xf9, 0x9f, 0xf7, 0x0, 0x0,
-    0x1f, 0xff, 0xf9, 0x9f, 0xf7, 0x0, 0x0, 0xb,
-    0xff, 0xf9,
+    0x9f, 0xfa, 0xc0, 0x39, 0xff, 0xd2, 0x1, 0x90,
+    0x40, 0x3f, 0xf8, 0x2e, 0x1, 0xff, 0xc1, 0xa0,
+    0xf, 0xf8, 0xc0, 0xc4, 0x3, 0xfc, 0x80, 0x6,
+    0x0, 0xff, 0x68, 0x85, 0x80, 0x7f, 0xcc, 0x6,
+    0x40, 0x1f, 0xc7, 0x60, 0x5, 0x0, 0xff, 0x19,
+    0x5, 0x0, 0x7f, 0x8, 0x28, 0x11, 0x80, 0x7f,
+    0xa8, 0x1, 0x60, 0x20, 0x1f, 0x88, 0x80, 0xc0,
+    0x1f, 0xf5, 0x0, 0x98, 0x7, 0xf9, 0x40, 0x14,
+    0x60, 0x1f, 0xc4, 0x60, 0xe2, 0x1, 0xfe, 0xa0,
+    0x1c, 0x0, 0xff, 0x38, 0x1, 0x0, 0x3f, 0xc2,
+    0x80, 0x60, 0x1f, 0xf6, 0x80, 0x7f, 0xf0, 0x5c,
+    0x3, 0xff, 0x82, 0x28, 0x1, 0x80,
 
     /* U+004F "O" */
-    0x0, 0x3, 0x9d, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x1f, 0xff, 0xc3,
-    0x0, 0x3c, 0xff, 0xf1, 0x5f, 0xff, 0x10, 0x0,
-    0x1, 0xff, 0xf5, 0x8f, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0xf8, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0,
-    0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9,
-    0x8f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x5f,
-    0xff, 0x10, 0x0, 0x1, 0xff, 0xf5, 0x1f, 0xff,
-    0xc3, 0x0, 0x3c, 0xff, 0xf1, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3, 0xad, 0xff, 0xda,
-    0x30, 0x0,
+    0x0, 0x8e, 0x77, 0xfd, 0xb2, 0x60, 0x1d, 0x18,
+    0xc4, 0x0, 0x26, 0xc8, 0x0, 0x9d, 0xc0, 0x1f,
+    0x9d, 0xc0, 0x30, 0x0, 0x3c, 0xff, 0x61, 0x80,
+    0x20, 0x50, 0x2, 0xd3, 0x0, 0x1e, 0x80, 0x49,
+    0xa0, 0x3, 0x10, 0xc, 0x26, 0x0, 0xd1, 0x0,
+    0x30, 0x7, 0x98, 0x0, 0x20, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0x38, 0x80, 0x18, 0x3, 0xcc, 0x0,
+    0x1d, 0x0, 0x18, 0x80, 0x61, 0x30, 0x6, 0xa0,
+    0x5, 0xa6, 0x0, 0x3d, 0x0, 0x90, 0x60, 0x0,
+    0x79, 0xfe, 0xc3, 0x0, 0x40, 0x83, 0xb8, 0x3,
+    0xf3, 0xb8, 0x2, 0x8c, 0x52, 0x0, 0x12, 0xe4,
+    0x0, 0x0,
 
     /* U+0050 "P" */
-    0x7f, 0xff, 0xff, 0xff, 0xec, 0x82, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x7f,
-    0xff, 0xee, 0xee, 0xff, 0xff, 0xf6, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x5e, 0xff, 0xf0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x67, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xcf, 0xf9, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xa7, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xcf, 0xf9, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x67, 0xff, 0xc0, 0x0, 0x0,
-    0x5e, 0xff, 0xf0, 0x7f, 0xff, 0xee, 0xee, 0xff,
-    0xff, 0xf5, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xec, 0x82,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xbb, 0x20, 0x80, 0x3f, 0xe1, 0x37,
+    0xd6, 0x0, 0xf0, 0x8e, 0x0, 0xd2, 0xc0, 0x18,
+    0xfb, 0xb7, 0xd0, 0x80, 0x24, 0x3, 0xfc, 0xba,
+    0x1, 0x30, 0x7, 0xf8, 0xcc, 0x0, 0xf0, 0xf,
+    0xf9, 0x80, 0x6, 0x1, 0xff, 0x30, 0x0, 0xc0,
+    0x3f, 0xc6, 0x60, 0x7, 0x80, 0x7f, 0x2e, 0x80,
+    0x4c, 0x1, 0x1f, 0x76, 0xfa, 0x10, 0x5, 0x0,
+    0x70, 0x8e, 0x0, 0xd2, 0xa0, 0x1f, 0xc2, 0x6f,
+    0xac, 0x1, 0xc7, 0xff, 0xbb, 0x20, 0x80, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfe, 0x40,
 
     /* U+0051 "Q" */
-    0x0, 0x3, 0xad, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x2, 0xff,
-    0xfc, 0x30, 0x3, 0xcf, 0xff, 0x20, 0x8f, 0xfe,
-    0x10, 0x0, 0x1, 0xef, 0xf8, 0xb, 0xff, 0x90,
-    0x0, 0x0, 0x9, 0xff, 0xa0, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0xc, 0xff, 0x70, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0xc, 0xff, 0x70, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0xcf, 0xf7, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0xc, 0xff, 0x70, 0x0, 0x0, 0x7,
-    0xff, 0xc0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0xc, 0xff, 0x70, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0xc, 0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xc0,
-    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x8,
-    0xff, 0xe1, 0x0, 0x0, 0x1e, 0xff, 0x80, 0x2f,
-    0xff, 0xc2, 0x0, 0x2c, 0xff, 0xf2, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x39,
-    0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfb, 0x0,
+    0x0, 0x8e, 0xb7, 0xfd, 0xb2, 0x60, 0x1e, 0x9c,
+    0x52, 0x0, 0x13, 0x64, 0x0, 0x69, 0x60, 0xf,
+    0xcf, 0x0, 0x2, 0x60, 0x1, 0xe7, 0xfb, 0xc,
+    0x0, 0xe4, 0x14, 0x0, 0x1d, 0x30, 0x1, 0xe8,
+    0x80, 0x28, 0xc, 0x0, 0xe2, 0x1, 0x85, 0xc0,
+    0x4, 0xe, 0x0, 0xe0, 0xf, 0x70, 0x1, 0x80,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0x16, 0x0, 0x70,
+    0x7, 0xb8, 0x0, 0xc0, 0x40, 0x7, 0x10, 0xc,
+    0x2e, 0x0, 0x20, 0xa0, 0x0, 0xe9, 0x0, 0xb,
+    0x44, 0x1, 0x40, 0x4e, 0x0, 0x3d, 0xff, 0x69,
+    0x80, 0x1c, 0x80, 0x10, 0xc0, 0x1f, 0x9a, 0x0,
+    0x34, 0xe3, 0x10, 0x6, 0x49, 0x0, 0xf1, 0xce,
+    0xfd, 0x0, 0x11, 0x0, 0x1f, 0xe5, 0x40, 0x4,
+    0x80, 0x7f, 0xd2, 0x0, 0x27, 0x0, 0xff, 0x14,
+    0x0, 0x20, 0x80, 0x3f, 0xce, 0x40, 0x9, 0x0,
 
     /* U+0052 "R" */
-    0x7f, 0xff, 0xff, 0xff, 0xeb, 0x50, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x7f,
-    0xff, 0xee, 0xef, 0xff, 0xff, 0xd1, 0x7, 0xff,
-    0xc0, 0x0, 0x1, 0x9f, 0xff, 0x80, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xf1, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x37, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xf2, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x7, 0xff, 0xc0, 0x0, 0x2,
-    0xaf, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x7f, 0xff, 0xee, 0xef, 0xff, 0x70,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0xdf, 0xf9, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0x6, 0xff, 0xf1, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0xe, 0xff, 0x80, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xf7, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xf4,
+    0x7f, 0xff, 0xba, 0xd4, 0x3, 0xff, 0xa, 0x56,
+    0x10, 0x7, 0x84, 0x60, 0xc, 0x7e, 0x20, 0x18,
+    0xfb, 0xaf, 0xe6, 0x0, 0x14, 0x80, 0x7f, 0xc,
+    0xa8, 0x1, 0x80, 0x3f, 0xe9, 0x0, 0x8, 0x80,
+    0x3f, 0xc4, 0x1, 0x10, 0x7, 0xf8, 0x80, 0x21,
+    0x0, 0xff, 0x48, 0x0, 0x48, 0x3, 0xf1, 0x52,
+    0x80, 0x18, 0x3, 0x1f, 0xfe, 0xd5, 0x0, 0x14,
+    0x0, 0x7f, 0xe3, 0xc0, 0xf, 0x8, 0xc0, 0x14,
+    0x60, 0x80, 0x71, 0xf7, 0x44, 0x0, 0xe0, 0xf,
+    0xfa, 0xc0, 0xc, 0x20, 0x1f, 0xe6, 0x10, 0x4,
+    0x80, 0x7f, 0xd2, 0x0, 0x60, 0xf, 0xf9, 0x80,
+    0x2, 0xe0, 0x1f, 0xe1, 0x60, 0x4, 0x80, 0x7f,
+    0xd6, 0x0, 0x16, 0x0, 0xff, 0x12, 0x0, 0x2c,
+    0x3, 0xfe, 0x80, 0x1, 0x20,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x82, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x8f, 0xff, 0xfe, 0xff, 0xff, 0xf6, 0x0,
-    0x1, 0xff, 0xfb, 0x20, 0x3, 0xdf, 0xfe, 0x0,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0x40,
-    0x8, 0xff, 0xa0, 0x0, 0x0, 0xb, 0xee, 0x50,
-    0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfe, 0x72, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xea, 0x50, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xef, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe0,
-    0x4, 0x44, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
-    0xf, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0xf0,
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x9, 0xff, 0xd0,
-    0x7, 0xff, 0xfa, 0x20, 0x1, 0x9f, 0xff, 0x70,
-    0x0, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xfd, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfd, 0xa5, 0x0, 0x0,
+    0x0, 0xc7, 0x3b, 0xfe, 0xd8, 0x20, 0xf, 0xa7,
+    0x18, 0x80, 0x4, 0xfa, 0xe0, 0x1d, 0xc, 0x1,
+    0x8, 0x6, 0x86, 0x0, 0x85, 0xc0, 0x9, 0xbd,
+    0xf8, 0x40, 0x8, 0x0, 0x9c, 0x0, 0x36, 0x40,
+    0x3, 0xc0, 0x0, 0xa0, 0x3, 0x80, 0x8, 0x1,
+    0xc2, 0x82, 0x30, 0x7, 0xfe, 0xbe, 0xe2, 0x80,
+    0x34, 0x0, 0xa4, 0x1, 0xff, 0x28, 0x80, 0x31,
+    0xc8, 0x3, 0xfd, 0x40, 0x1, 0x8d, 0xea, 0x50,
+    0xf, 0x93, 0x4, 0x2, 0x15, 0xae, 0x50, 0xf,
+    0x1f, 0x52, 0x0, 0x61, 0xa7, 0x0, 0xf9, 0x6f,
+    0xf1, 0xc4, 0x1, 0x6, 0x1, 0xfc, 0x71, 0xe4,
+    0x0, 0x90, 0xf, 0xf8, 0x60, 0x0, 0x80, 0x4,
+    0x48, 0x3, 0xe7, 0x0, 0x8, 0x2, 0xee, 0x30,
+    0xf, 0x8, 0x7, 0x18, 0x2, 0x40, 0x3d, 0x40,
+    0x2, 0x0, 0x58, 0x1, 0x68, 0x80, 0x3, 0x2c,
+    0x0, 0xa0, 0x3, 0x98, 0x1, 0x77, 0xfb, 0x8c,
+    0x0, 0x27, 0x0, 0xb5, 0x0, 0x30, 0x80, 0x47,
+    0x80, 0x18, 0x6e, 0xca, 0x40, 0x2, 0x5a, 0xc1,
+    0x0, 0x0,
 
     /* U+0054 "T" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfe, 0x14, 0x0, 0x7f, 0xf4, 0xfd,
+    0xff, 0xf9, 0x40, 0xb, 0xff, 0xce, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfe, 0x60,
 
     /* U+0055 "U" */
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0,
-    0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0,
-    0x0, 0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0xaf, 0xf9, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x8f, 0xfc, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x5f,
-    0xff, 0x20, 0x0, 0x2, 0xff, 0xf5, 0x1f, 0xff,
-    0xd3, 0x0, 0x3d, 0xff, 0xf1, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x3, 0xad, 0xff, 0xda,
-    0x30, 0x0,
+    0x9f, 0xf5, 0x0, 0x7a, 0xbf, 0xd2, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf8, 0x84,
+    0x3, 0xff, 0x8, 0x4, 0xc0, 0x1e, 0x60, 0x7,
+    0xe8, 0x0, 0xc8, 0x3, 0x11, 0x80, 0x9, 0x0,
+    0x2f, 0x30, 0x1, 0xf8, 0x4, 0x83, 0x0, 0x2,
+    0xcf, 0xf6, 0x10, 0x2, 0x4, 0x1d, 0x80, 0x3f,
+    0x33, 0x80, 0x53, 0x8a, 0x40, 0x2, 0x5c, 0x90,
+    0x0,
 
     /* U+0056 "V" */
-    0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x1f, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0xf1,
-    0xd, 0xff, 0x60, 0x0, 0x0, 0x6, 0xff, 0xd0,
-    0x9, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0x90,
-    0x5, 0xff, 0xe0, 0x0, 0x0, 0xd, 0xff, 0x50,
-    0x1, 0xff, 0xf2, 0x0, 0x0, 0x1f, 0xff, 0x10,
-    0x0, 0xdf, 0xf6, 0x0, 0x0, 0x5f, 0xfd, 0x0,
-    0x0, 0x9f, 0xfa, 0x0, 0x0, 0x9f, 0xf9, 0x0,
-    0x0, 0x4f, 0xfe, 0x0, 0x0, 0xcf, 0xf5, 0x0,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0xff, 0xf1, 0x0,
-    0x0, 0xc, 0xff, 0x50, 0x4, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0xff, 0x90, 0x7, 0xff, 0x90, 0x0,
-    0x0, 0x4, 0xff, 0xd0, 0xb, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xff, 0xf1, 0xf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xcf, 0xf4, 0x2f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfb, 0x9f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0xcf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x9f, 0xf5, 0x80, 0x7e, 0xbf, 0xf4, 0xe0, 0x1,
+    0x0, 0x3f, 0x28, 0x3, 0x10, 0x2, 0x30, 0xf,
+    0x10, 0x80, 0x10, 0x48, 0x0, 0xa0, 0x1e, 0x40,
+    0x1, 0x8, 0x20, 0x3, 0x0, 0x3d, 0x80, 0x4,
+    0x0, 0x60, 0x1, 0x0, 0x3c, 0xe0, 0xc, 0x0,
+    0x20, 0x0, 0x48, 0x3, 0x9, 0x0, 0x10, 0x0,
+    0x24, 0x0, 0x40, 0xc, 0x80, 0x2, 0x10, 0x9,
+    0x0, 0x18, 0x1, 0xb0, 0x0, 0x80, 0x1b, 0x40,
+    0x8, 0x1, 0x94, 0x1, 0x80, 0x19, 0x40, 0x2,
+    0x20, 0x8, 0xc0, 0x8, 0x1, 0x84, 0xc0, 0x8,
+    0x0, 0x40, 0x1, 0x8, 0x7, 0x20, 0x3, 0x0,
+    0x6, 0x0, 0x40, 0xf, 0x60, 0x1, 0x0, 0x18,
+    0x0, 0xd0, 0xf, 0x20, 0x0, 0x84, 0x10, 0x0,
+    0xa0, 0x1f, 0x18, 0x1, 0x48, 0x0, 0x62, 0x1,
+    0xf2, 0x0, 0x31, 0x0, 0x8, 0x1, 0xfb, 0x0,
+    0x7, 0xe0, 0xc, 0x0, 0xfc, 0x80, 0x5, 0x50,
+    0x1, 0x0, 0x3f, 0x8c, 0x4, 0xc0, 0xc0, 0x3f,
+    0xc8, 0x1, 0x90, 0x3, 0xfd, 0x80, 0x1b, 0x0,
+    0x38,
 
     /* U+0057 "W" */
-    0x6f, 0xf5, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x4f,
-    0xf6, 0x5f, 0xf7, 0x0, 0xa, 0xff, 0xc0, 0x0,
-    0x6f, 0xf4, 0x3f, 0xf9, 0x0, 0xc, 0xff, 0xe0,
-    0x0, 0x7f, 0xf3, 0x1f, 0xfa, 0x0, 0xe, 0xed,
-    0xf0, 0x0, 0x9f, 0xf1, 0xf, 0xfc, 0x0, 0xf,
-    0xdc, 0xf2, 0x0, 0xaf, 0xf0, 0xe, 0xfd, 0x0,
-    0x2f, 0xbb, 0xf4, 0x0, 0xcf, 0xd0, 0xc, 0xff,
-    0x0, 0x5f, 0xa9, 0xf5, 0x0, 0xef, 0xb0, 0xa,
-    0xff, 0x0, 0x7f, 0x87, 0xf7, 0x0, 0xff, 0xa0,
-    0x8, 0xff, 0x20, 0x9f, 0x65, 0xf9, 0x1, 0xff,
-    0x80, 0x7, 0xff, 0x30, 0xbf, 0x43, 0xfb, 0x2,
-    0xff, 0x60, 0x5, 0xff, 0x50, 0xdf, 0x22, 0xfd,
-    0x4, 0xff, 0x40, 0x3, 0xff, 0x70, 0xff, 0x0,
-    0xff, 0x5, 0xff, 0x20, 0x1, 0xff, 0x81, 0xfe,
-    0x0, 0xef, 0x17, 0xff, 0x0, 0x0, 0xff, 0xa3,
-    0xfc, 0x0, 0xcf, 0x39, 0xff, 0x0, 0x0, 0xef,
-    0xb5, 0xfa, 0x0, 0xaf, 0x5a, 0xfd, 0x0, 0x0,
-    0xcf, 0xd7, 0xf8, 0x0, 0x8f, 0x7c, 0xfb, 0x0,
-    0x0, 0xaf, 0xe9, 0xf6, 0x0, 0x7f, 0x8d, 0xf9,
-    0x0, 0x0, 0x8f, 0xfa, 0xf4, 0x0, 0x5f, 0xaf,
-    0xf7, 0x0, 0x0, 0x7f, 0xfd, 0xf2, 0x0, 0x3f,
-    0xcf, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xf2, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0xd, 0xff, 0xf0, 0x0,
+    0x6f, 0xf2, 0x80, 0x51, 0xfe, 0xa0, 0x9, 0x3f,
+    0xcc, 0x60, 0x2, 0x0, 0x88, 0x0, 0xc0, 0x11,
+    0x0, 0x9, 0x80, 0x1c, 0x1, 0x30, 0x0, 0x80,
+    0x21, 0x0, 0x39, 0x0, 0xc, 0x2, 0x21, 0x21,
+    0x0, 0xb8, 0x0, 0x42, 0x0, 0x60, 0x8, 0x4c,
+    0x40, 0x80, 0x6, 0x0, 0x10, 0x10, 0x10, 0x1,
+    0x3, 0x38, 0x30, 0x1, 0x80, 0x80, 0x4, 0x4,
+    0x0, 0x70, 0x12, 0x1, 0x0, 0x10, 0x30, 0x1,
+    0x80, 0x31, 0x1, 0x70, 0x10, 0x0, 0x40, 0x40,
+    0x4, 0x0, 0x20, 0xe0, 0xe2, 0xe, 0x1, 0x0,
+    0x10, 0x3, 0xc0, 0x2, 0x4, 0x4, 0xc0, 0x40,
+    0x60, 0xe, 0x0, 0x10, 0x1, 0x81, 0x81, 0x84,
+    0x18, 0x18, 0x0, 0x40, 0x6, 0x0, 0x10, 0x10,
+    0x11, 0x0, 0x80, 0x40, 0xc, 0x0, 0x20, 0x7,
+    0x88, 0x8, 0x0, 0x40, 0x48, 0x0, 0x40, 0x1,
+    0x0, 0x11, 0x0, 0x80, 0x4, 0x5, 0xc0, 0x1e,
+    0x10, 0x16, 0x6, 0x0, 0x30, 0x31, 0x81, 0x0,
+    0x62, 0x6, 0x20, 0x20, 0x1, 0x1, 0x30, 0x30,
+    0x6, 0x60, 0x3e, 0xe, 0x0, 0x78, 0x78, 0x81,
+    0x0, 0x62, 0x1, 0x30, 0x20, 0x1, 0x1, 0x10,
+    0x38, 0x3, 0x78, 0x1, 0xc1, 0x80, 0xc, 0xc,
+    0x0, 0x20, 0xc, 0x40, 0x2, 0x2, 0x0, 0x10,
+    0x18, 0x0, 0x40, 0x33, 0x0, 0x42, 0x1, 0x8,
+    0x6, 0x60, 0xc, 0x40, 0x11, 0x0, 0x62, 0x0,
+    0x88, 0x0,
 
     /* U+0058 "X" */
-    0x5f, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0xc, 0xff, 0xc0, 0x0, 0x0, 0xa, 0xff, 0xc0,
-    0x4, 0xff, 0xf5, 0x0, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0xbf, 0xfd, 0x0, 0x0, 0xbf, 0xfb, 0x0,
-    0x0, 0x3f, 0xff, 0x50, 0x3, 0xff, 0xf2, 0x0,
-    0x0, 0xa, 0xff, 0xd0, 0xc, 0xff, 0x90, 0x0,
-    0x0, 0x2, 0xff, 0xf5, 0x4f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x9f, 0xfc, 0xbf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfe, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf7, 0x8f, 0xfd, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xe0, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0xe, 0xff, 0x70, 0x8, 0xff, 0xe0, 0x0,
-    0x0, 0x8f, 0xfe, 0x0, 0x1, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xf6, 0x0, 0x0, 0x8f, 0xff, 0x10,
-    0x9, 0xff, 0xd0, 0x0, 0x0, 0xe, 0xff, 0x90,
-    0x2f, 0xff, 0x50, 0x0, 0x0, 0x7, 0xff, 0xf2,
-    0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
+    0x5f, 0xf9, 0x0, 0x3c, 0x5f, 0xf2, 0xa8, 0xc0,
+    0x10, 0x1, 0xe8, 0x0, 0x1a, 0x84, 0x0, 0xd,
+    0x40, 0x31, 0xa8, 0x2, 0x0, 0x8, 0x80, 0x4,
+    0x0, 0x68, 0x0, 0x22, 0x0, 0x28, 0x0, 0x12,
+    0x80, 0xd, 0x0, 0x12, 0x1, 0x8d, 0x40, 0x10,
+    0x0, 0xf0, 0x3, 0x10, 0x7, 0x40, 0x0, 0x95,
+    0xc, 0x1, 0x0, 0x1e, 0x26, 0x0, 0x4f, 0x80,
+    0x1c, 0x40, 0x3e, 0x80, 0x1, 0xa0, 0xc, 0x0,
+    0x7e, 0x18, 0x0, 0xd0, 0x1, 0xfe, 0x71, 0x0,
+    0xb, 0x0, 0x7f, 0x8c, 0x40, 0x2, 0x60, 0x1f,
+    0xe8, 0x0, 0xde, 0x1, 0xfc, 0x88, 0x1, 0x0,
+    0x1a, 0x80, 0x7e, 0x90, 0x4, 0xb8, 0x2, 0x0,
+    0x3e, 0x62, 0x1, 0x79, 0x0, 0x13, 0x0, 0x7a,
+    0x0, 0x12, 0x2, 0xe0, 0x8, 0x0, 0xe8, 0x10,
+    0x17, 0x0, 0x48, 0x0, 0x60, 0x2, 0x17, 0x0,
+    0x40, 0x4, 0x2e, 0x0, 0x71, 0x0, 0x40, 0x0,
+    0x98, 0x3, 0x40, 0x80, 0x20, 0x9, 0x80, 0x10,
+    0x1, 0xe9, 0x0, 0x31, 0x48, 0x0, 0x94, 0x3,
+    0xce, 0x20, 0x9,
 
     /* U+0059 "Y" */
-    0xe, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xd0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x60, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0,
-    0x5f, 0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
-    0x0, 0xdf, 0xf7, 0x0, 0x0, 0x1f, 0xff, 0x50,
-    0x0, 0x4, 0xff, 0xf1, 0x0, 0x0, 0x8, 0xff,
-    0xc0, 0x0, 0xb, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xf4, 0x0, 0x3f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0xfb, 0x0, 0xaf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x21, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x97, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xed, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x40, 0x7, 0xe7, 0xff, 0x68, 0x2,
+    0x0, 0xc, 0x1, 0xfa, 0x40, 0x16, 0x0, 0x61,
+    0x1, 0x60, 0xf, 0x28, 0x80, 0xb0, 0x5, 0x20,
+    0x8, 0x0, 0xf4, 0x0, 0x24, 0x3, 0x30, 0x0,
+    0x54, 0x3, 0x21, 0x0, 0x18, 0x3, 0xb, 0x80,
+    0x24, 0x3, 0x78, 0x1, 0xc4, 0x3, 0xa4, 0x0,
+    0x68, 0x0, 0x34, 0x0, 0x48, 0x7, 0x85, 0x80,
+    0x1e, 0x0, 0x90, 0x3, 0x8, 0x7, 0xd6, 0x0,
+    0x42, 0x15, 0x0, 0x58, 0x7, 0xe2, 0x50, 0x5,
+    0xb0, 0x1, 0x48, 0x3, 0xfa, 0x40, 0xf, 0x40,
+    0x9, 0x0, 0xff, 0x1a, 0x0, 0x90, 0x21, 0x80,
+    0x7f, 0xde, 0x1, 0xbc, 0x3, 0xff, 0x21, 0x80,
+    0xd, 0x0, 0x3f, 0xf8, 0x2c, 0x0, 0x60, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xb8,
 
     /* U+005A "Z" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8,
+    0x5f, 0xff, 0xfc, 0x60, 0x1f, 0xfd, 0x5, 0xff,
+    0xfc, 0xe0, 0x11, 0x0, 0x7e, 0x27, 0x0, 0x48,
+    0x80, 0x7e, 0x90, 0x1, 0x30, 0x7, 0xe4, 0x40,
+    0x2, 0x40, 0x3f, 0xa4, 0x0, 0xa8, 0x1, 0xf9,
+    0xc8, 0x1, 0x60, 0x1f, 0x86, 0x0, 0xe, 0x20,
+    0x1f, 0xac, 0x0, 0x30, 0x1, 0xf8, 0xd4, 0x1,
+    0x60, 0x1f, 0xde, 0x0, 0x45, 0x0, 0xfc, 0xc6,
+    0x0, 0x90, 0xf, 0xc3, 0x0, 0x6, 0x20, 0xf,
+    0xd0, 0x20, 0x30, 0x1, 0xf8, 0x98, 0x1, 0x2,
+    0x1, 0xfb, 0x80, 0x6, 0xc0, 0x1f, 0x94, 0xc0,
+    0x1e, 0x1, 0xfd, 0xa0, 0x16, 0x7f, 0xfe, 0x80,
+    0xf, 0xfe, 0x80,
 
     /* U+005B "[" */
-    0x2f, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff,
-    0xfb, 0x2f, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xf1,
-    0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0xf1, 0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x2,
-    0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff, 0x10, 0x0,
-    0x2, 0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff, 0x10,
-    0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff,
-    0x10, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0x2f,
-    0xff, 0x10, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0,
-    0x2f, 0xff, 0x10, 0x0, 0x2, 0xff, 0xf1, 0x0,
-    0x0, 0x2f, 0xff, 0x10, 0x0, 0x2, 0xff, 0xf1,
-    0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0xf1, 0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x2,
-    0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff, 0x10, 0x0,
-    0x2, 0xff, 0xf1, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xb2, 0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff,
-    0xff, 0xff, 0xb0,
+    0x2f, 0xff, 0xac, 0x3, 0xff, 0x95, 0xdf, 0xf5,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfe, 0x8e, 0xff, 0xac, 0x3, 0xff, 0x8c,
 
     /* U+005C "\\" */
-    0x78, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfc,
+    0x78, 0x81, 0x80, 0x7f, 0xb9, 0xdd, 0xe0, 0x1f,
+    0xea, 0x0, 0x19, 0x0, 0x7f, 0x19, 0x0, 0x28,
+    0x3, 0xfc, 0xa0, 0x6, 0x0, 0xff, 0x50, 0x0,
+    0x50, 0x3, 0xf8, 0x8c, 0x1, 0xc0, 0x1f, 0xea,
+    0x0, 0x28, 0x7, 0xf9, 0x80, 0x25, 0x0, 0xff,
+    0x28, 0x3, 0x80, 0x3f, 0xdc, 0x0, 0x41, 0x0,
+    0xfe, 0x41, 0x0, 0x30, 0x7, 0xf9, 0x80, 0x14,
+    0x1, 0xfe, 0xa0, 0x1, 0x18, 0x7, 0xf1, 0x18,
+    0x2, 0x80, 0x3f, 0xd4, 0x0, 0x70, 0xf, 0xf3,
+    0x80, 0x5, 0x40, 0x3f, 0x85, 0x0, 0x1c, 0x1,
+    0xfe, 0xe0, 0x2, 0x8, 0x7, 0xf2, 0x88, 0x1,
+    0xc0, 0x3f, 0xce, 0x0, 0xa0, 0xf, 0xf5, 0x0,
+    0xc, 0x80, 0x3f, 0x8c, 0x80, 0x14, 0x1, 0xfe,
+    0xa0, 0x3, 0x0, 0x7f, 0x98, 0x0, 0x28, 0x1,
+    0xfc, 0x28, 0x0, 0xe0, 0xf, 0xf7, 0x0, 0x14,
+    0x3, 0xfc, 0xa0, 0x13, 0x0, 0x7f, 0x98, 0x1,
+    0x40,
 
     /* U+005D "]" */
-    0xbf, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff,
-    0xf3, 0xbf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x1,
-    0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff, 0x30, 0x0,
-    0x1, 0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff,
-    0x30, 0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x1f,
-    0xff, 0x30, 0x0, 0x1, 0xff, 0xf3, 0x0, 0x0,
-    0x1f, 0xff, 0x30, 0x0, 0x1, 0xff, 0xf3, 0x0,
-    0x0, 0x1f, 0xff, 0x30, 0x0, 0x1, 0xff, 0xf3,
-    0x0, 0x0, 0x1f, 0xff, 0x30, 0x0, 0x1, 0xff,
-    0xf3, 0x0, 0x0, 0x1f, 0xff, 0x30, 0x0, 0x1,
-    0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff, 0x30, 0x0,
-    0x1, 0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x1f, 0xff,
-    0x30, 0x0, 0x1, 0xff, 0xf3, 0xbf, 0xff, 0xff,
-    0xff, 0x3b, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff,
-    0xff, 0xff, 0x30,
+    0xbf, 0xff, 0x88, 0x3, 0xf0, 0x80, 0x7f, 0x5f,
+    0xfd, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xa2, 0xff, 0xee, 0x0, 0xff, 0xe5,
+    0x0,
 
     /* U+005E "^" */
-    0x0, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xb9, 0xff, 0x10, 0x0, 0x0, 0x7, 0xff, 0x53,
-    0xff, 0x80, 0x0, 0x0, 0xe, 0xfe, 0x0, 0xdf,
-    0xe0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0xcf, 0xf1, 0x0, 0x1f, 0xfd, 0x0,
-    0x3, 0xff, 0xa0, 0x0, 0x9, 0xff, 0x40, 0xa,
-    0xff, 0x30, 0x0, 0x3, 0xff, 0xb0, 0x2f, 0xfd,
-    0x0, 0x0, 0x0, 0xcf, 0xf2, 0x9f, 0xf6, 0x0,
-    0x0, 0x0, 0x6f, 0xf9,
+    0x0, 0xeb, 0xff, 0x60, 0x7, 0xf1, 0x20, 0x0,
+    0xcc, 0x1, 0xfa, 0xc0, 0x2, 0x12, 0x1, 0xf0,
+    0xb0, 0x23, 0x82, 0x88, 0x7, 0x98, 0x1, 0xd4,
+    0x0, 0x90, 0xf, 0x48, 0xa, 0x99, 0x3, 0x0,
+    0x72, 0x88, 0x30, 0x2, 0xc0, 0x58, 0x3, 0x48,
+    0x2, 0x40, 0xe, 0x0, 0xb0, 0x8, 0xcc, 0xa,
+    0x20, 0x1, 0x60, 0x24, 0x0, 0x48, 0x2, 0x40,
+    0x35, 0x0, 0x3c, 0x9, 0x40, 0x8c, 0x3, 0x19,
+    0x81, 0xa, 0xc0, 0x16, 0x1, 0xea, 0x0, 0x58,
 
     /* U+005F "_" */
-    0x2d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd2,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x2d, 0xdf, 0xfe, 0x11, 0x9, 0x17, 0xff, 0x8,
+    0x40, 0x3f, 0xf8, 0x80,
 
     /* U+0060 "`" */
-    0x14, 0x44, 0x10, 0x0, 0xc, 0xff, 0xb0, 0x0,
-    0x1, 0xef, 0xf7, 0x0, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0x5, 0xff, 0xe1,
+    0x14, 0x48, 0x40, 0x21, 0x8b, 0xb5, 0x0, 0x6d,
+    0x10, 0x47, 0x0, 0x87, 0x40, 0x10, 0x80, 0x11,
+    0xd0, 0x2, 0x84,
 
     /* U+0061 "a" */
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x9f, 0xff, 0xfc, 0xcf, 0xff, 0xfa, 0x0, 0x1f,
-    0xff, 0x70, 0x0, 0x9, 0xff, 0xf2, 0x3, 0xbb,
-    0xa0, 0x0, 0x0, 0xf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x3,
-    0x45, 0x55, 0x5d, 0xff, 0x70, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x9f, 0xfe, 0x51, 0x0,
-    0x0, 0xcf, 0xf7, 0xf, 0xff, 0x60, 0x0, 0x0,
-    0xc, 0xff, 0x71, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0x70, 0xef, 0xfd, 0x20, 0x0, 0x3d, 0xff,
-    0xf7, 0x7, 0xff, 0xff, 0xcb, 0xdf, 0xfc, 0xff,
-    0x70, 0xa, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0xf7,
-    0x0, 0x5, 0xcf, 0xfd, 0xa3, 0xb, 0xff, 0x70,
+    0x0, 0xc9, 0x5b, 0xfe, 0xea, 0x50, 0xf, 0x55,
+    0xa9, 0x0, 0x5, 0x6a, 0xc0, 0x34, 0xa8, 0x4,
+    0x66, 0x0, 0x92, 0x80, 0x2, 0xc0, 0x8, 0xfc,
+    0xc7, 0xb0, 0x1, 0x48, 0x9, 0x10, 0xae, 0x1,
+    0xa4, 0x2, 0x40, 0x3b, 0xb5, 0x0, 0x78, 0xc0,
+    0x2, 0x1, 0xc6, 0x8a, 0xb8, 0x40, 0x3d, 0x3f,
+    0x97, 0x55, 0x88, 0x3, 0xe, 0xb0, 0x7, 0xfe,
+    0x82, 0x1, 0xae, 0xff, 0xc6, 0x1, 0x98, 0x1,
+    0xa, 0x20, 0x1f, 0x84, 0x2, 0x40, 0xf, 0xfe,
+    0x13, 0x0, 0x70, 0x98, 0x4, 0x22, 0x0, 0x49,
+    0x0, 0x47, 0x80, 0x1d, 0x20, 0x2, 0xdc, 0xbd,
+    0xc2, 0x30, 0xc, 0xea, 0x1, 0x1a, 0x10, 0x4b,
+    0x80, 0x75, 0x50, 0xc0, 0x4, 0xb8, 0xc0, 0x18,
 
     /* U+0062 "b" */
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x3, 0xbe, 0xfd,
-    0x80, 0x0, 0x7f, 0xfb, 0x4f, 0xff, 0xff, 0xfd,
-    0x10, 0x7f, 0xfb, 0xef, 0xfe, 0xff, 0xff, 0xb0,
-    0x7f, 0xff, 0xd3, 0x0, 0x1b, 0xff, 0xf2, 0x7f,
-    0xff, 0x30, 0x0, 0x0, 0xef, 0xf7, 0x7f, 0xfe,
-    0x0, 0x0, 0x0, 0xbf, 0xf9, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x9f, 0xf9, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x9f, 0xfa, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x9f, 0xf9,
-    0x7f, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x7f,
-    0xff, 0x30, 0x0, 0x0, 0xef, 0xf7, 0x7f, 0xff,
-    0xd3, 0x0, 0x1b, 0xff, 0xf3, 0x7f, 0xfb, 0xef,
-    0xfe, 0xff, 0xff, 0xb0, 0x7f, 0xfb, 0x4f, 0xff,
-    0xff, 0xfd, 0x10, 0x7f, 0xfb, 0x3, 0xbe, 0xfd,
-    0x81, 0x0,
+    0x7f, 0xf6, 0x0, 0x7f, 0xfe, 0x5c, 0xe, 0xfb,
+    0xf6, 0x0, 0x3e, 0x4c, 0x41, 0x2, 0x7d, 0x10,
+    0xe, 0xa0, 0x0, 0x80, 0x45, 0x40, 0x19, 0xf,
+    0x3f, 0xb8, 0x80, 0x4, 0x20, 0xd, 0xc6, 0x0,
+    0x1b, 0x10, 0x2, 0x80, 0x42, 0x60, 0x1c, 0xa0,
+    0xe, 0x0, 0x88, 0x3, 0xc4, 0x1, 0xff, 0xc4,
+    0x30, 0xf, 0xfe, 0xe9, 0x80, 0x44, 0x1, 0xe2,
+    0x0, 0xf0, 0x98, 0x7, 0x28, 0x3, 0x80, 0x37,
+    0x18, 0x0, 0x6c, 0x40, 0x8, 0x1, 0x21, 0xe7,
+    0xf7, 0x10, 0x0, 0x86, 0x1, 0xa8, 0x0, 0x20,
+    0x11, 0x50, 0x7, 0x26, 0x20, 0x81, 0x3e, 0x8,
+    0x0,
 
     /* U+0063 "c" */
-    0x0, 0x2, 0x8d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x6, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xd0, 0xe, 0xff, 0xd4,
-    0x0, 0x19, 0xff, 0xf6, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0xaf, 0xfc, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x4d, 0xdb, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x4d, 0xdb, 0x5f, 0xff, 0x20, 0x0,
-    0x0, 0xaf, 0xfc, 0xe, 0xff, 0xd4, 0x0, 0x18,
-    0xff, 0xf6, 0x6, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xd0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x2, 0x9d, 0xff, 0xeb, 0x50, 0x0,
+    0x0, 0x8a, 0x37, 0xfd, 0xd6, 0xa0, 0x1c, 0xda,
+    0xe4, 0x0, 0x14, 0xac, 0x10, 0x3, 0x48, 0x6,
+    0x10, 0x8, 0xf0, 0x1, 0x0, 0x2, 0xbf, 0xee,
+    0x30, 0x0, 0x99, 0x44, 0x1, 0xe8, 0x0, 0x19,
+    0x50, 0x5, 0x10, 0x0, 0xc8, 0x3, 0xb8, 0x88,
+    0xfe, 0x0, 0x60, 0xf, 0x26, 0xea, 0xc4, 0x3,
+    0xff, 0xba, 0x20, 0x1f, 0xfc, 0x1f, 0x0, 0x30,
+    0x7, 0x93, 0x75, 0x64, 0x0, 0x32, 0x0, 0xee,
+    0x22, 0x3a, 0x88, 0x3, 0xd0, 0x0, 0x30, 0xa0,
+    0xa, 0x8, 0x0, 0x15, 0xff, 0x71, 0xc0, 0x4,
+    0xc0, 0xd0, 0x1, 0x84, 0x2, 0x3c, 0x0, 0x9f,
+    0x58, 0x80, 0x2, 0x95, 0x82, 0x0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x0, 0x8, 0xdf, 0xeb, 0x30,
-    0xbf, 0xf7, 0x1, 0xdf, 0xff, 0xff, 0xf5, 0xbf,
-    0xf7, 0xb, 0xff, 0xff, 0xef, 0xfe, 0xbf, 0xf7,
-    0x2f, 0xff, 0xb1, 0x0, 0x3d, 0xff, 0xf7, 0x7f,
-    0xfe, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x9f, 0xfb,
-    0x0, 0x0, 0x0, 0xef, 0xf7, 0x9f, 0xf9, 0x0,
-    0x0, 0x0, 0xcf, 0xf7, 0xaf, 0xf9, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0xaf, 0xf9, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0xcf,
-    0xf7, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0x9f, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xf7, 0x7f,
-    0xfe, 0x0, 0x0, 0x3, 0xff, 0xf7, 0x3f, 0xff,
-    0xb1, 0x0, 0x3d, 0xff, 0xf7, 0xb, 0xff, 0xff,
-    0xef, 0xfe, 0xbf, 0xf7, 0x1, 0xdf, 0xff, 0xff,
-    0xf4, 0xbf, 0xf7, 0x0, 0x18, 0xdf, 0xeb, 0x30,
-    0xbf, 0xf7,
+    0x0, 0xff, 0x67, 0xf9, 0xc0, 0x3f, 0xfd, 0xf1,
+    0xbf, 0xd6, 0x60, 0xe0, 0x18, 0x75, 0xc8, 0x5,
+    0x31, 0x40, 0x3a, 0x88, 0x2, 0x10, 0x5, 0x80,
+    0x62, 0x40, 0x2, 0x77, 0x3f, 0xd, 0x0, 0x25,
+    0x0, 0xd, 0x88, 0x0, 0xf8, 0x3, 0x70, 0x1,
+    0x40, 0x38, 0xc4, 0x3, 0xc4, 0x1, 0xe2, 0x0,
+    0x8c, 0x3, 0xff, 0xba, 0x60, 0x1f, 0xfc, 0x42,
+    0x0, 0xf1, 0x0, 0x5c, 0x0, 0x50, 0xe, 0x31,
+    0x0, 0x90, 0x0, 0x36, 0x20, 0x3, 0xe0, 0xc,
+    0x68, 0x0, 0x4e, 0xe7, 0xe1, 0xa0, 0x6, 0xa2,
+    0x0, 0x84, 0x1, 0x40, 0x1c, 0x38, 0xe4, 0x2,
+    0x98, 0x80, 0x18,
 
     /* U+0065 "e" */
-    0x0, 0x2, 0x9d, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xfd, 0xaa, 0xdf, 0xff, 0x70, 0x1f, 0xff, 0x80,
-    0x0, 0x8, 0xff, 0xf1, 0x6f, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xf6, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x8f, 0xf9, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x7f,
-    0xfa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xbf,
-    0xf9, 0x55, 0x55, 0x55, 0x55, 0x53, 0xaf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0,
-    0x0, 0x79, 0x94, 0x1f, 0xff, 0xa1, 0x0, 0x7,
-    0xff, 0xf3, 0x7, 0xff, 0xff, 0xdc, 0xff, 0xff,
-    0xa0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x3, 0x9d, 0xff, 0xda, 0x40, 0x0,
+    0x0, 0x8a, 0x77, 0xfd, 0xb2, 0x60, 0x1d, 0x1a,
+    0xc4, 0x0, 0x26, 0xc8, 0x0, 0x9d, 0xc0, 0x2,
+    0x55, 0x10, 0x1, 0xdc, 0x3, 0x0, 0x7, 0xda,
+    0xa6, 0xb8, 0x2, 0x5, 0xc0, 0x5, 0x0, 0x1a,
+    0x8, 0x0, 0xfe, 0x0, 0x50, 0xf, 0x28, 0x3,
+    0xcc, 0x1, 0xe0, 0x1e, 0xf0, 0x1, 0x88, 0x2,
+    0x3f, 0xfd, 0x0, 0x1, 0x0, 0xff, 0xe2, 0xb5,
+    0x57, 0xf4, 0x8, 0x3, 0x95, 0x7f, 0x8c, 0xc0,
+    0xe, 0x0, 0xff, 0x78, 0x1, 0x0, 0x3c, 0xf3,
+    0x24, 0x70, 0x1, 0x50, 0x80, 0x4f, 0xc, 0xc7,
+    0x18, 0x0, 0x2f, 0x6e, 0x7c, 0x0, 0x14, 0xc1,
+    0xdc, 0x1, 0x11, 0x80, 0x4b, 0x40, 0x14, 0x63,
+    0x10, 0x0, 0x96, 0xe8, 0x0,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xee, 0xee, 0xe0, 0x0,
-    0x0, 0xaf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0xf9, 0xb3, 0xff, 0xc0, 0x1e, 0xa9, 0x30,
+    0xf, 0xf9, 0x14, 0x2, 0x11, 0xe0, 0xe, 0xe0,
+    0x1, 0x77, 0x78, 0x3, 0x84, 0x0, 0xa2, 0x1,
+    0xfe, 0x70, 0x7, 0x80, 0x7f, 0xf6, 0x1f, 0xff,
+    0x18, 0x2, 0x3f, 0xfc, 0x1, 0xff, 0xc3, 0x10,
+    0xf, 0xfe, 0x13, 0x7f, 0xe3, 0x0, 0x47, 0xff,
+    0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
 
     /* U+0067 "g" */
-    0x0, 0x7, 0xdf, 0xeb, 0x40, 0xbf, 0xf7, 0x1,
-    0xdf, 0xff, 0xff, 0xf6, 0xbf, 0xf7, 0xa, 0xff,
-    0xff, 0xef, 0xff, 0xcf, 0xf7, 0x2f, 0xff, 0xc2,
-    0x0, 0x3e, 0xff, 0xf7, 0x6f, 0xff, 0x10, 0x0,
-    0x3, 0xff, 0xf7, 0x8f, 0xfb, 0x0, 0x0, 0x0,
-    0xef, 0xf7, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xcf,
-    0xf7, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x8f, 0xfc,
-    0x0, 0x0, 0x0, 0xef, 0xf7, 0x6f, 0xff, 0x20,
-    0x0, 0x5, 0xff, 0xf7, 0x1f, 0xff, 0xd4, 0x11,
-    0x6e, 0xff, 0xf7, 0x8, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xf7, 0x0, 0xaf, 0xff, 0xff, 0xf3, 0xcf,
-    0xf7, 0x0, 0x4, 0x9b, 0xb8, 0x10, 0xcf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xf1, 0x0, 0x4d, 0xdd,
-    0xdd, 0xff, 0xff, 0x90, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xeb,
-    0x50, 0x0,
+    0x0, 0x9f, 0x7f, 0xad, 0x2, 0xff, 0xce, 0x3,
+    0xb0, 0x40, 0x29, 0x6c, 0x1, 0xd6, 0x40, 0x10,
+    0x80, 0x25, 0xc0, 0x22, 0x50, 0x1, 0xef, 0x7e,
+    0x9, 0x80, 0x48, 0x1, 0x69, 0x0, 0xf, 0x40,
+    0x37, 0x0, 0x10, 0x40, 0x31, 0x88, 0x4, 0x20,
+    0x1, 0x0, 0xf1, 0x0, 0x7f, 0xf8, 0x44, 0x0,
+    0xc0, 0x1e, 0x20, 0xb, 0x80, 0x6, 0x40, 0x19,
+    0x44, 0x2, 0x70, 0xb, 0xd0, 0x44, 0xd6, 0x1,
+    0x85, 0xc0, 0x5, 0x7d, 0xc9, 0x4, 0x0, 0xd0,
+    0xa0, 0x1e, 0xd7, 0x0, 0xea, 0xb6, 0x44, 0x3f,
+    0x18, 0x7, 0xc9, 0x37, 0x68, 0x10, 0xf, 0xfe,
+    0x19, 0x80, 0x8, 0x3, 0xf0, 0xd0, 0x4, 0x80,
+    0x4, 0xdd, 0xee, 0x50, 0x3, 0x8, 0x0, 0x48,
+    0xb8, 0x2, 0x49, 0x0, 0xfe, 0x14, 0xab, 0x0,
+    0x0,
 
     /* U+0068 "h" */
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x4, 0xbe, 0xfd,
-    0x80, 0x0, 0x7f, 0xfc, 0x5f, 0xff, 0xff, 0xfd,
-    0x10, 0x7f, 0xfc, 0xef, 0xed, 0xff, 0xff, 0xb0,
-    0x7f, 0xff, 0xd3, 0x0, 0x2c, 0xff, 0xf2, 0x7f,
-    0xff, 0x30, 0x0, 0x2, 0xff, 0xf6, 0x7f, 0xfe,
-    0x0, 0x0, 0x0, 0xdf, 0xf8, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf,
-    0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0xbf, 0xf8,
+    0x7f, 0xf6, 0x0, 0x7f, 0xfe, 0xd2, 0xfb, 0xf6,
+    0x0, 0x3e, 0x5b, 0x41, 0x2, 0x7d, 0x10, 0xe,
+    0xb0, 0x12, 0x0, 0x8a, 0x80, 0x31, 0x9b, 0x3b,
+    0x74, 0x60, 0x4, 0x20, 0xd, 0xc6, 0x0, 0x2e,
+    0x0, 0x90, 0x2, 0x13, 0x0, 0xc4, 0x40, 0x7,
+    0x0, 0x44, 0x1, 0xe6, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xfe, 0x0,
 
     /* U+0069 "i" */
-    0x0, 0x0, 0x2, 0xcf, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf6, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb,
+    0x0, 0xe2, 0xcf, 0xc2, 0x0, 0xff, 0x41, 0x81,
+    0xc8, 0x7, 0xf8, 0x40, 0x3f, 0xf8, 0x50, 0x20,
+    0x3e, 0x1, 0xfe, 0x3e, 0xde, 0x40, 0xf, 0xfc,
+    0x40, 0x1f, 0xfc, 0xbf, 0xff, 0xcc, 0x1, 0xff,
+    0xd8, 0xff, 0xe2, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0x47, 0xff, 0x10, 0x2, 0x7f,
+    0xf5, 0x8, 0x7, 0xff, 0x4, 0x40, 0x3f, 0xf8,
+    0x60,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xe3, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0x0, 0x0, 0x2, 0x7f,
-    0xff, 0xc0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x6f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x6f, 0xff,
-    0xff, 0xc8, 0x10, 0x0,
+    0x0, 0xfe, 0x20, 0xf, 0xe4, 0xed, 0xe3, 0x0,
+    0xfb, 0xc4, 0x6, 0x0, 0x3f, 0xe1, 0x0, 0xfa,
+    0x4c, 0xe, 0x0, 0x3e, 0x2c, 0xfc, 0x20, 0xf,
+    0xfe, 0x64, 0xff, 0xff, 0x98, 0x3, 0xff, 0x8,
+    0x7, 0xfd, 0x1f, 0xff, 0x10, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xf0, 0x60, 0x3, 0x0, 0xfc, 0x20,
+    0x1, 0x0, 0xf9, 0x80, 0x25, 0x0, 0xe2, 0x79,
+    0x0, 0x18, 0xb7, 0xfe, 0xd8, 0x0, 0xbc, 0x3,
+    0xfd, 0x66, 0x1, 0xf1, 0xbf, 0x20, 0x0,
 
     /* U+006B "k" */
-    0x5f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe0,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x5f, 0xfe, 0x0,
-    0x0, 0x0, 0xdf, 0xfc, 0x5, 0xff, 0xe0, 0x0,
-    0x0, 0x7f, 0xff, 0x30, 0x5f, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0x90, 0x5, 0xff, 0xe0, 0x0, 0xa,
-    0xff, 0xe0, 0x0, 0x5f, 0xfe, 0x0, 0x4, 0xff,
-    0xf5, 0x0, 0x5, 0xff, 0xe0, 0x0, 0xdf, 0xfb,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x5f, 0xff, 0xdd, 0xdf, 0xff, 0x50, 0x0,
-    0x5, 0xff, 0xe0, 0x0, 0xbf, 0xfe, 0x10, 0x0,
-    0x5f, 0xfe, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x5,
-    0xff, 0xe0, 0x0, 0x8, 0xff, 0xf3, 0x0, 0x5f,
-    0xfe, 0x0, 0x0, 0xd, 0xff, 0xc0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x4f, 0xff, 0x60, 0x5f, 0xfe,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x15, 0xff, 0xe0,
-    0x0, 0x0, 0x1, 0xff, 0xfa,
+    0x5f, 0xf7, 0x0, 0x7f, 0xff, 0xc0, 0x3c, 0x7f,
+    0xf3, 0x0, 0x7f, 0xb8, 0x0, 0x6c, 0x1, 0xfc,
+    0xe4, 0x0, 0xf0, 0xf, 0xe1, 0x80, 0x3, 0x18,
+    0x7, 0xf5, 0x80, 0x6, 0x40, 0x3f, 0x91, 0x40,
+    0x16, 0x1, 0xfe, 0x90, 0x2, 0x28, 0x7, 0x87,
+    0xfe, 0x20, 0x4, 0x80, 0x7f, 0xf0, 0x48, 0x80,
+    0x1f, 0x88, 0xa0, 0x1, 0x28, 0x7, 0xc3, 0xbb,
+    0x20, 0x2, 0xc4, 0x3, 0xfd, 0x20, 0x1, 0x80,
+    0xf, 0xf1, 0x38, 0x1, 0x8c, 0x3, 0xfd, 0x4,
+    0x0, 0xf0, 0xf, 0xfa, 0x40, 0x6, 0xc0, 0x1f,
+    0xe4, 0x50, 0x4, 0x88, 0x7, 0xfa, 0xc0, 0x2b,
 
     /* U+006C "l" */
-    0x2f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xae,
-    0xff, 0xff, 0xfa,
+    0x2f, 0xff, 0xd4, 0x1, 0xff, 0xcc, 0x30, 0xf,
+    0xfe, 0x20, 0xff, 0xf3, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfc,
+    0x20, 0x6, 0x0, 0xff, 0xe0, 0xf0, 0x0, 0xd4,
+    0x3, 0xff, 0x30, 0x80, 0x2b, 0xff, 0xa8, 0x3,
+    0xea, 0x0, 0xff, 0xe2, 0x26, 0xa8, 0x80, 0x78,
 
     /* U+006D "m" */
-    0x6f, 0xf5, 0x6e, 0xe9, 0x0, 0x9e, 0xe9, 0x0,
-    0x6f, 0xf9, 0xff, 0xff, 0x98, 0xff, 0xff, 0x90,
-    0x6f, 0xfe, 0xa8, 0xff, 0xfe, 0x8a, 0xff, 0xf1,
-    0x6f, 0xfb, 0x0, 0x7f, 0xf7, 0x0, 0xbf, 0xf4,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
-    0x6f, 0xf8, 0x0, 0x5f, 0xf5, 0x0, 0x8f, 0xf6,
+    0x6f, 0xf2, 0xb7, 0x72, 0x40, 0x13, 0xdc, 0x90,
+    0xe, 0xc9, 0x11, 0x34, 0xc3, 0x8, 0x9a, 0x40,
+    0x33, 0xab, 0x80, 0x19, 0x8e, 0xa0, 0x6, 0x10,
+    0x9, 0x6a, 0x20, 0x0, 0x98, 0xa4, 0x0, 0x28,
+    0x4, 0x60, 0x2, 0x0, 0x10, 0x0, 0xc0, 0x4,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf7, 0x80,
 
     /* U+006E "n" */
-    0x7f, 0xfb, 0x4, 0xbe, 0xfd, 0x80, 0x0, 0x7f,
-    0xfb, 0x5f, 0xff, 0xff, 0xfd, 0x10, 0x7f, 0xfc,
-    0xef, 0xed, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xd3,
-    0x0, 0x2c, 0xff, 0xf2, 0x7f, 0xff, 0x30, 0x0,
-    0x2, 0xff, 0xf6, 0x7f, 0xfe, 0x0, 0x0, 0x0,
-    0xdf, 0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf,
-    0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0xbf, 0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf,
-    0xf8, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xf8,
+    0x7f, 0xf5, 0x82, 0x5f, 0x7e, 0xc0, 0x7, 0xcb,
+    0x68, 0x20, 0x4f, 0xa2, 0x1, 0x9e, 0xc0, 0x48,
+    0x2, 0x2a, 0x0, 0xc6, 0x6c, 0xed, 0xd1, 0x80,
+    0x10, 0x80, 0x37, 0x18, 0x0, 0xb8, 0x2, 0x40,
+    0x8, 0x4c, 0x3, 0x11, 0x0, 0x1c, 0x1, 0x10,
+    0x7, 0x98, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xf8,
 
     /* U+006F "o" */
-    0x0, 0x3, 0x9d, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x1f, 0xff, 0xc2,
-    0x0, 0x3c, 0xff, 0xf1, 0x6f, 0xfe, 0x10, 0x0,
-    0x1, 0xef, 0xf6, 0x9f, 0xfa, 0x0, 0x0, 0x0,
-    0xaf, 0xf9, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xfa, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xfb,
-    0xbf, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0xbf,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0xfa, 0x9f, 0xfa, 0x0,
-    0x0, 0x0, 0xaf, 0xf9, 0x6f, 0xfe, 0x10, 0x0,
-    0x1, 0xef, 0xf6, 0x1f, 0xff, 0xc2, 0x0, 0x2c,
-    0xff, 0xf1, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0x9d, 0xff, 0xd9, 0x30, 0x0,
+    0x0, 0x8e, 0x77, 0xfd, 0xb2, 0x60, 0x1d, 0x18,
+    0xc4, 0x0, 0x26, 0xc8, 0x0, 0x9d, 0xc0, 0x1f,
+    0x9d, 0xc0, 0x30, 0x0, 0x3d, 0xff, 0x61, 0x80,
+    0x20, 0x5c, 0x0, 0x3a, 0x40, 0x3, 0xd1, 0x0,
+    0x3f, 0x80, 0x10, 0x40, 0x30, 0xa0, 0x3, 0xcc,
+    0x0, 0x40, 0x1e, 0x20, 0x1, 0x88, 0x7, 0xfe,
+    0x10, 0xf, 0xfe, 0x80, 0x80, 0x7f, 0xe1, 0x30,
+    0x1, 0x0, 0x78, 0x80, 0x7, 0xe0, 0x4, 0x10,
+    0xc, 0x28, 0x0, 0xf7, 0x0, 0xe, 0x90, 0x0,
+    0xb4, 0x40, 0xe, 0x30, 0x0, 0x3d, 0xff, 0x69,
+    0x80, 0x20, 0x41, 0xdc, 0x1, 0xf9, 0xdc, 0x1,
+    0x46, 0x31, 0x0, 0x9, 0xb2, 0x0, 0x0,
 
     /* U+0070 "p" */
-    0x7f, 0xfb, 0x3, 0xbe, 0xfd, 0x80, 0x0, 0x7f,
-    0xfb, 0x4f, 0xff, 0xff, 0xfd, 0x10, 0x7f, 0xfb,
-    0xef, 0xfe, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xd3,
-    0x0, 0x1b, 0xff, 0xf2, 0x7f, 0xff, 0x30, 0x0,
-    0x0, 0xef, 0xf7, 0x7f, 0xfe, 0x0, 0x0, 0x0,
-    0xbf, 0xf9, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x9f,
-    0xf9, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x9f, 0xfa,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0xbf, 0xf9, 0x7f, 0xff, 0x30, 0x0,
-    0x0, 0xef, 0xf7, 0x7f, 0xfe, 0xd3, 0x0, 0x1b,
-    0xff, 0xf2, 0x7f, 0xfb, 0xef, 0xfe, 0xff, 0xff,
-    0xb0, 0x7f, 0xfb, 0x4f, 0xff, 0xff, 0xfd, 0x10,
-    0x7f, 0xfb, 0x3, 0xbe, 0xfd, 0x80, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x7f, 0xf5, 0x81, 0xdf, 0x7e, 0xc0, 0x7, 0xc9,
+    0x88, 0x20, 0x4f, 0xa2, 0x1, 0xd4, 0x0, 0x10,
+    0x8, 0xa8, 0x3, 0x21, 0xe7, 0xf7, 0x10, 0x0,
+    0x84, 0x1, 0xb8, 0xc0, 0x3, 0x62, 0x0, 0x50,
+    0x8, 0x4c, 0x3, 0x94, 0x1, 0xc0, 0x11, 0x0,
+    0x78, 0x80, 0x3f, 0xf8, 0x86, 0x1, 0xff, 0xdd,
+    0x30, 0x8, 0x80, 0x3c, 0x40, 0x1e, 0x13, 0x0,
+    0xe5, 0x0, 0x70, 0x4, 0x3c, 0x60, 0x1, 0xb1,
+    0x0, 0x28, 0x4, 0xa7, 0x9f, 0xdc, 0x40, 0x2,
+    0x10, 0x6, 0xa0, 0x0, 0x80, 0x45, 0x40, 0x1c,
+    0x98, 0x82, 0x4, 0xfa, 0x20, 0x19, 0xc0, 0xef,
+    0xbf, 0x60, 0x3, 0xff, 0xde,
 
     /* U+0071 "q" */
-    0x0, 0x8, 0xdf, 0xeb, 0x30, 0xbf, 0xf7, 0x1,
-    0xdf, 0xff, 0xff, 0xf4, 0xbf, 0xf7, 0xb, 0xff,
-    0xff, 0xef, 0xfe, 0xbf, 0xf7, 0x3f, 0xff, 0xb1,
-    0x0, 0x3d, 0xff, 0xf7, 0x7f, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xf7, 0x9f, 0xfb, 0x0, 0x0, 0x0,
-    0xef, 0xf7, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0xcf,
-    0xf7, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0xaf, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x9f, 0xf9,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x9f, 0xfb, 0x0,
-    0x0, 0x0, 0xef, 0xf7, 0x7f, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xf7, 0x3f, 0xff, 0xa1, 0x0, 0x3d,
-    0xff, 0xf7, 0xb, 0xff, 0xff, 0xef, 0xfe, 0xbf,
-    0xf7, 0x1, 0xdf, 0xff, 0xff, 0xf4, 0xbf, 0xf7,
-    0x0, 0x18, 0xdf, 0xeb, 0x30, 0xbf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf7,
+    0x0, 0xa3, 0x7f, 0xac, 0xc2, 0xff, 0xce, 0x3,
+    0xae, 0x40, 0x29, 0x88, 0x1, 0xd4, 0x40, 0x10,
+    0x80, 0x28, 0x3, 0x1a, 0x0, 0x13, 0xb9, 0xf8,
+    0x68, 0x1, 0x20, 0x0, 0x6c, 0x40, 0x7, 0xc0,
+    0x1b, 0x80, 0xa, 0x1, 0xc6, 0x20, 0x1e, 0x20,
+    0xf, 0x10, 0x4, 0x60, 0x1f, 0xfd, 0xd3, 0x0,
+    0xff, 0xe2, 0x10, 0x7, 0x88, 0x2, 0xe0, 0x2,
+    0x80, 0x71, 0x88, 0x4, 0x80, 0x1, 0xa1, 0x0,
+    0x1f, 0x0, 0x63, 0x40, 0x2, 0xf7, 0x3f, 0xd,
+    0x0, 0x35, 0x10, 0x4, 0x20, 0xa, 0x0, 0xe1,
+    0xc7, 0x20, 0x14, 0xc4, 0x0, 0xf0, 0xc6, 0xff,
+    0x59, 0x83, 0x80, 0x7f, 0xfb, 0xc0,
 
     /* U+0072 "r" */
-    0xef, 0xf5, 0x7, 0xdf, 0xfc, 0x50, 0x0, 0xef,
-    0xf5, 0xbf, 0xff, 0xff, 0xfa, 0x0, 0xef, 0xfa,
-    0xff, 0xef, 0xff, 0xff, 0x50, 0xef, 0xff, 0x91,
-    0x0, 0x4e, 0xff, 0xc0, 0xef, 0xfd, 0x0, 0x0,
-    0x6, 0xff, 0xf0, 0xef, 0xf8, 0x0, 0x0, 0x2,
-    0xff, 0xf2, 0xef, 0xf6, 0x0, 0x0, 0x0, 0xff,
-    0xf3, 0xef, 0xf5, 0x0, 0x0, 0x0, 0xaa, 0xa2,
-    0xef, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf2, 0x83, 0xef, 0xfb, 0x14, 0x3, 0xeb,
+    0x82, 0x0, 0x1d, 0x50, 0x3, 0xbd, 0x0, 0x40,
+    0x32, 0xa8, 0x3, 0x2b, 0x77, 0x3e, 0xc4, 0x1,
+    0x20, 0x18, 0xa4, 0x40, 0x9, 0x0, 0x3, 0x0,
+    0xca, 0x1, 0xc8, 0x1, 0x10, 0x5, 0xc0, 0x1c,
+    0x40, 0x10, 0x80, 0x46, 0x1, 0xe5, 0x58, 0x40,
+    0x3f, 0xd5, 0x51, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfb, 0x20,
 
     /* U+0073 "s" */
-    0x0, 0x29, 0xdf, 0xff, 0xfc, 0x70, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x1f, 0xff,
-    0xfb, 0xaa, 0xcf, 0xff, 0xe0, 0x6f, 0xfe, 0x20,
-    0x0, 0x4, 0xff, 0xf5, 0x8f, 0xfa, 0x0, 0x0,
-    0x0, 0x67, 0x73, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc7, 0x53, 0x10, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0x57, 0xac, 0xef, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfb, 0xae, 0xe7, 0x0, 0x0,
-    0x0, 0x7f, 0xfb, 0x8f, 0xfe, 0x20, 0x0, 0x2,
-    0xef, 0xf9, 0x2f, 0xff, 0xfc, 0xbb, 0xcf, 0xff,
-    0xf3, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x29, 0xdf, 0xff, 0xfd, 0x92, 0x0,
+    0x0, 0x14, 0xef, 0xfe, 0xc7, 0x0, 0xc9, 0xac,
+    0x40, 0x18, 0xe3, 0x88, 0x6, 0xc0, 0x24, 0x55,
+    0x18, 0x0, 0x70, 0x1c, 0x0, 0x3b, 0x75, 0x4c,
+    0xb0, 0x0, 0xaf, 0x0, 0x10, 0x80, 0x32, 0x4c,
+    0x41, 0xbc, 0x0, 0xc0, 0x1e, 0x67, 0x71, 0xa0,
+    0x0, 0xf1, 0xd4, 0xc4, 0x3, 0x8d, 0x0, 0x7,
+    0x15, 0x9d, 0xf6, 0x80, 0x15, 0xa8, 0x7, 0xc9,
+    0x70, 0x1, 0x57, 0x54, 0x29, 0x88, 0x4, 0xe6,
+    0x1, 0xa, 0xbd, 0x67, 0x60, 0x80, 0x28, 0x3,
+    0xf8, 0xe4, 0x0, 0x55, 0xdc, 0x70, 0xf, 0xf1,
+    0x8, 0xa4, 0x80, 0x31, 0x48, 0x0, 0xa8, 0x0,
+    0x3b, 0x97, 0x6c, 0xd1, 0x0, 0x51, 0x50, 0x4,
+    0x68, 0x83, 0x0, 0xa4, 0xc1, 0x75, 0x88, 0x3,
+    0x13, 0x6b, 0x0,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0x18, 0x88, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x20, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x1, 0x9e, 0xff, 0xff, 0xfa,
+    0x0, 0xc3, 0x11, 0x8, 0x7, 0xf8, 0xdd, 0xe3,
+    0x0, 0xff, 0xf3, 0xe7, 0xfd, 0xa0, 0x16, 0xff,
+    0xf6, 0x0, 0x7f, 0xf4, 0xb3, 0xfe, 0xd0, 0xb,
+    0x7f, 0xfb, 0x0, 0x3f, 0xff, 0xe0, 0x1f, 0xfe,
+    0x53, 0x0, 0xff, 0xe1, 0x8, 0x5, 0x0, 0x1f,
+    0xf2, 0x80, 0x17, 0xff, 0xa4, 0x3, 0xac, 0x40,
+    0x3e, 0x30, 0xe, 0x1f, 0x61, 0x0, 0xf0,
 
     /* U+0075 "u" */
-    0x8f, 0xfb, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x8f, 0xfb,
-    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x8f, 0xfb, 0x0,
-    0x0, 0x0, 0xbf, 0xf8, 0x8f, 0xfb, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x8f, 0xfb, 0x0, 0x0, 0x0,
-    0xbf, 0xf8, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0xbf,
-    0xf8, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x8f, 0xfb, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x8f, 0xfb,
-    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x7f, 0xfd, 0x0,
-    0x0, 0x0, 0xdf, 0xf7, 0x4f, 0xff, 0x30, 0x0,
-    0x3, 0xff, 0xf4, 0xe, 0xff, 0xd3, 0x0, 0x3d,
-    0xff, 0xe0, 0x6, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0x50, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x3, 0x9d, 0xff, 0xd9, 0x20, 0x0,
+    0x8f, 0xf5, 0x80, 0x7a, 0xff, 0xd0, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xfa, 0xf8, 0x1, 0x80, 0x3c,
+    0xc0, 0xf, 0x30, 0x1, 0x18, 0x6, 0x32, 0x0,
+    0x1a, 0x8, 0x3, 0x8c, 0x0, 0x7c, 0x0, 0x14,
+    0x8, 0x0, 0x16, 0x77, 0x30, 0x80, 0x16, 0x0,
+    0x68, 0x0, 0x84, 0x40, 0x14, 0x28, 0x4, 0xf8,
+    0xc4, 0x0, 0x26, 0xd7, 0x0, 0x0,
 
     /* U+0076 "v" */
-    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf7,
-    0x2f, 0xff, 0x30, 0x0, 0x0, 0x3, 0xff, 0xf2,
-    0xd, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xd0,
-    0x8, 0xff, 0xd0, 0x0, 0x0, 0xd, 0xff, 0x80,
-    0x2, 0xff, 0xf2, 0x0, 0x0, 0x2f, 0xff, 0x20,
-    0x0, 0xdf, 0xf7, 0x0, 0x0, 0x7f, 0xfd, 0x0,
-    0x0, 0x8f, 0xfc, 0x0, 0x0, 0xcf, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0x10, 0x1, 0xff, 0xf3, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x6, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0xff, 0xb0, 0xb, 0xff, 0x80, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0xf, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xdf, 0xf5, 0x4f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf9, 0x8f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0xcf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x7f, 0xf7, 0x0, 0x7e, 0xef, 0xf3, 0xa8, 0x0,
+    0x4c, 0x3, 0xc6, 0x20, 0x5, 0x22, 0x0, 0x2c,
+    0x3, 0xd6, 0x0, 0x22, 0x2, 0x80, 0x14, 0x3,
+    0xca, 0x0, 0x50, 0x5, 0x0, 0x8, 0x80, 0x18,
+    0x88, 0x0, 0xa0, 0x1, 0x10, 0x0, 0xa0, 0x19,
+    0x40, 0x4, 0x40, 0x9, 0x40, 0x16, 0x1, 0xac,
+    0x0, 0xa0, 0x1a, 0xc0, 0x6, 0x20, 0x1, 0x30,
+    0x5, 0x80, 0x63, 0x20, 0x3, 0x80, 0x1c, 0x0,
+    0x46, 0x1, 0xca, 0x0, 0xd0, 0x6, 0x80, 0x14,
+    0x3, 0xd6, 0x0, 0x40, 0x2, 0x0, 0x2c, 0x3,
+    0xc6, 0x40, 0x5, 0x40, 0x0, 0x98, 0x7, 0xca,
+    0x0, 0xcc, 0x0, 0x1c, 0x3, 0xf5, 0x80, 0x11,
+    0x0, 0xa, 0x0, 0xfc, 0x62, 0x4, 0x60, 0x26,
+    0x1, 0xfc, 0xc0, 0x19, 0xc0, 0x3f, 0xd6, 0x1,
+    0xb4, 0x3, 0x80,
 
     /* U+0077 "w" */
-    0x3f, 0xf6, 0x0, 0x8, 0xff, 0x80, 0x0, 0x5f,
-    0xf3, 0x1f, 0xf9, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x7f, 0xf1, 0xe, 0xfb, 0x0, 0xd, 0xff, 0xe0,
-    0x0, 0xaf, 0xe0, 0xc, 0xfd, 0x0, 0xf, 0xee,
-    0xf1, 0x0, 0xcf, 0xb0, 0x9, 0xff, 0x0, 0x3f,
-    0xcc, 0xf3, 0x0, 0xef, 0x90, 0x7, 0xff, 0x20,
-    0x6f, 0xaa, 0xf6, 0x1, 0xff, 0x60, 0x4, 0xff,
-    0x40, 0x8f, 0x77, 0xf9, 0x3, 0xff, 0x40, 0x2,
-    0xff, 0x60, 0xbf, 0x55, 0xfc, 0x5, 0xff, 0x10,
-    0x0, 0xff, 0x80, 0xef, 0x22, 0xfe, 0x8, 0xff,
-    0x0, 0x0, 0xdf, 0xa1, 0xff, 0x0, 0xff, 0x1a,
-    0xfc, 0x0, 0x0, 0xaf, 0xd3, 0xfd, 0x0, 0xdf,
-    0x4c, 0xf9, 0x0, 0x0, 0x8f, 0xf6, 0xfa, 0x0,
-    0xbf, 0x6e, 0xf7, 0x0, 0x0, 0x5f, 0xf9, 0xf8,
-    0x0, 0x8f, 0x9f, 0xf4, 0x0, 0x0, 0x3f, 0xfd,
-    0xf5, 0x0, 0x6f, 0xcf, 0xf2, 0x0, 0x0, 0x1f,
-    0xff, 0xf2, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0xe, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xd0, 0x0,
-    0x0, 0xc, 0xff, 0xd0, 0x0, 0xe, 0xff, 0xa0,
-    0x0,
+    0x3f, 0xf3, 0x0, 0x51, 0xfe, 0x80, 0x9, 0x7f,
+    0xc6, 0x40, 0xf, 0x0, 0x8c, 0x0, 0x60, 0x11,
+    0x0, 0x8, 0x44, 0x4, 0x1, 0x30, 0x1, 0x40,
+    0x2d, 0x1, 0x10, 0x10, 0x30, 0x4, 0x42, 0x38,
+    0x0, 0xc0, 0xa0, 0x5, 0x2, 0x0, 0x18, 0x11,
+    0x0, 0x80, 0x4, 0x4, 0x0, 0xe0, 0x1, 0x2,
+    0x83, 0x30, 0x14, 0x4, 0x41, 0xe0, 0x3, 0x0,
+    0x30, 0x70, 0x6e, 0x83, 0xc0, 0x80, 0x4, 0x0,
+    0x60, 0x1, 0x1, 0x81, 0x10, 0x14, 0x18, 0x0,
+    0xa0, 0x2, 0x0, 0x70, 0x28, 0x3b, 0x80, 0x83,
+    0x40, 0x2, 0x1, 0x10, 0x10, 0x88, 0x8, 0x80,
+    0x22, 0x20, 0x30, 0xc, 0xe0, 0xe4, 0x4, 0x0,
+    0x20, 0x56, 0x5, 0x0, 0xc4, 0x4, 0xa0, 0xe0,
+    0x6, 0x2, 0x20, 0x70, 0x6, 0xd0, 0x7, 0x81,
+    0x0, 0xc, 0x3c, 0x40, 0xc0, 0x33, 0x0, 0x10,
+    0x34, 0x1, 0xc0, 0xa0, 0x6, 0x0, 0xc4, 0x0,
+    0x20, 0x70, 0x2, 0x81, 0x80, 0x8, 0x3, 0x8,
+    0x80, 0x22, 0x0, 0x10, 0x4, 0x40, 0x1e, 0x20,
+    0x1, 0x0, 0x42, 0x20, 0x3, 0x80, 0x40,
 
     /* U+0078 "x" */
-    0x1e, 0xff, 0xa0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x5, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xff, 0x60,
-    0x0, 0xbf, 0xfe, 0x0, 0x0, 0xdf, 0xfb, 0x0,
-    0x0, 0x1e, 0xff, 0x80, 0x8, 0xff, 0xf1, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x2f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xbf, 0xfa, 0xaf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfe, 0xef, 0xf6, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf6, 0x6f, 0xff, 0x20, 0x0,
-    0x0, 0xb, 0xff, 0xd0, 0xd, 0xff, 0xb0, 0x0,
-    0x0, 0x6f, 0xff, 0x30, 0x3, 0xff, 0xf6, 0x0,
-    0x1, 0xff, 0xf9, 0x0, 0x0, 0x9f, 0xff, 0x10,
-    0xb, 0xff, 0xe0, 0x0, 0x0, 0xe, 0xff, 0xb0,
-    0x6f, 0xff, 0x50, 0x0, 0x0, 0x5, 0xff, 0xf5,
+    0x1e, 0xff, 0x50, 0x7, 0xab, 0xfe, 0x11, 0x58,
+    0x1, 0x50, 0x3, 0x22, 0x80, 0x24, 0x41, 0x50,
+    0x1, 0x40, 0x1a, 0x40, 0x8, 0xc0, 0x15, 0x8,
+    0xc, 0x0, 0x20, 0x80, 0x14, 0x1, 0x86, 0x0,
+    0xe, 0x44, 0x70, 0x4, 0x88, 0x7, 0x32, 0x0,
+    0x22, 0x0, 0x3, 0x60, 0xf, 0xa8, 0x0, 0xaa,
+    0x0, 0x70, 0x7, 0xe1, 0x90, 0xd, 0x4, 0x1,
+    0xfc, 0x80, 0x19, 0x40, 0x3f, 0xdc, 0x1, 0xb8,
+    0x3, 0xf9, 0x8c, 0x4, 0x40, 0x6c, 0x1, 0xf1,
+    0x48, 0x2, 0x20, 0x0, 0x92, 0x0, 0xf4, 0x80,
+    0x9, 0x98, 0x40, 0x9, 0x0, 0xe6, 0x40, 0x7,
+    0x0, 0x38, 0x0, 0x8c, 0x1, 0xc, 0x80, 0x18,
+    0xc0, 0x6, 0xc0, 0x9, 0x10, 0x5, 0x0, 0x6,
+    0x40, 0x34, 0x88, 0x2, 0x81, 0x90, 0x1, 0x60,
+    0x1e, 0xb0, 0x2, 0x28,
 
     /* U+0079 "y" */
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf7,
-    0x1f, 0xff, 0x50, 0x0, 0x0, 0x4, 0xff, 0xf1,
-    0xa, 0xff, 0xb0, 0x0, 0x0, 0xa, 0xff, 0xb0,
-    0x4, 0xff, 0xf1, 0x0, 0x0, 0xf, 0xff, 0x50,
-    0x0, 0xdf, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0xbf, 0xf9, 0x0,
-    0x0, 0x1f, 0xff, 0x30, 0x1, 0xff, 0xf3, 0x0,
-    0x0, 0xa, 0xff, 0x90, 0x6, 0xff, 0xe0, 0x0,
-    0x0, 0x4, 0xff, 0xf0, 0xc, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xef, 0xf5, 0x1f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x7f, 0xfb, 0x6f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xbf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x3, 0xf7, 0x7f, 0x9d, 0x80, 0x25,
+    0x0, 0xf2, 0x8, 0x1, 0x85, 0x40, 0x1c, 0x1,
+    0xee, 0x0, 0x20, 0x87, 0x0, 0x10, 0x40, 0x39,
+    0x40, 0x1c, 0x0, 0x42, 0x0, 0x30, 0x6, 0x50,
+    0x9, 0x40, 0x2a, 0x0, 0x50, 0x6, 0xe0, 0x3,
+    0x0, 0x66, 0x0, 0x11, 0x80, 0x5, 0x0, 0x14,
+    0x1, 0x85, 0x40, 0x14, 0x0, 0x70, 0x0, 0x98,
+    0x7, 0x70, 0x1, 0x80, 0x14, 0x0, 0x60, 0xf,
+    0x20, 0x80, 0x14, 0x4c, 0x1, 0x40, 0x1f, 0x48,
+    0x3, 0x9c, 0x0, 0x64, 0x1, 0xf3, 0x0, 0x13,
+    0x40, 0x14, 0x1, 0xf8, 0x50, 0x0, 0x80, 0x7,
+    0x0, 0xfe, 0xf0, 0xc, 0xa2, 0x1, 0xfc, 0x82,
+    0x1, 0x70, 0x7, 0xfc, 0xe0, 0x1, 0x40, 0xf,
+    0xf9, 0x40, 0xc, 0x1, 0xff, 0x11, 0x80, 0x28,
+    0x3, 0xfe, 0xa0, 0x1, 0x90, 0x7, 0xfc, 0xc0,
+    0xb, 0x0, 0xff, 0x94, 0x40, 0xc, 0x1, 0xff,
+    0x70, 0x1, 0x4, 0x3, 0xe0,
 
     /* U+007A "z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2e, 0xee,
-    0xee, 0xee, 0xef, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xee, 0xee, 0xee, 0xee,
-    0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0x3f, 0xff, 0xfc, 0x40, 0x1f, 0xfc, 0x21, 0x1f,
+    0xe0, 0xe, 0x2e, 0xef, 0xbc, 0x40, 0x6, 0x40,
+    0x1f, 0xb4, 0x40, 0x74, 0x3, 0xf5, 0x18, 0x3,
+    0x44, 0x3, 0xe7, 0x50, 0x5, 0x18, 0x7, 0xc9,
+    0x0, 0x7, 0x50, 0xf, 0x8a, 0xc0, 0x9, 0x0,
+    0x1f, 0xf, 0x80, 0xa, 0xc0, 0x3f, 0x51, 0x0,
+    0xf8, 0x7, 0xe8, 0x40, 0x5, 0x10, 0x7, 0xca,
+    0xe0, 0x9, 0x40, 0xf, 0x8e, 0x80, 0xc, 0xc0,
+    0xf, 0xc8, 0x1, 0x3f, 0x77, 0xe7, 0x0, 0xc2,
+    0x3f, 0xc0, 0x1f, 0xfc, 0x30,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xef, 0xf3, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xdf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf5, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0xef, 0xf3,
+    0x0, 0xfc, 0xb7, 0xdf, 0xe3, 0x0, 0xfa, 0xa8,
+    0x82, 0x1, 0xfc, 0xea, 0x1, 0xff, 0xa8, 0x0,
+    0x37, 0xfe, 0x30, 0xf, 0x10, 0x2, 0x10, 0x3,
+    0xf8, 0x40, 0x4, 0x1, 0xfe, 0x30, 0x1, 0x0,
+    0x7f, 0x84, 0x0, 0x20, 0x1f, 0xe6, 0x0, 0x70,
+    0x7, 0xf8, 0xc0, 0x6, 0x1, 0xfe, 0x10, 0x0,
+    0x80, 0x7f, 0x88, 0x0, 0x20, 0x1f, 0xc8, 0xa0,
+    0xf, 0x0, 0xdb, 0xff, 0xac, 0x1, 0xa, 0x1,
+    0xfe, 0x3c, 0x70, 0xf, 0xf8, 0xf2, 0x0, 0x3b,
+    0x7f, 0xf5, 0x0, 0x1d, 0x40, 0x3f, 0x95, 0x40,
+    0xf, 0x0, 0xff, 0x10, 0x0, 0x40, 0x3f, 0xc2,
+    0x0, 0x10, 0xf, 0xf1, 0x80, 0xc, 0x3, 0xfc,
+    0xc0, 0xe, 0x0, 0xff, 0x8, 0x0, 0x40, 0x3f,
+    0xc6, 0x0, 0x20, 0xf, 0xf0, 0x80, 0x8, 0x3,
+    0xfc, 0x40, 0x8, 0x40, 0xf, 0xea, 0x0, 0xd,
+    0xff, 0x8c, 0x3, 0xce, 0xa0, 0x1f, 0xfc, 0x1a,
+    0xa2, 0x8, 0x4,
 
     /* U+007C "|" */
-    0x58, 0x85, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa, 0xaf, 0xfa,
-    0xaf, 0xfa,
+    0x58, 0x82, 0xfb, 0xbb, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfd, 0x50,
 
     /* U+007D "}" */
-    0x3f, 0xfe, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x9f, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xb5, 0x0,
-    0x0, 0x0, 0x0,
+    0x3f, 0xf7, 0x5a, 0x80, 0x7f, 0xc2, 0x95, 0x60,
+    0x1f, 0xfc, 0x14, 0x80, 0xf, 0x1f, 0xfa, 0xc4,
+    0x0, 0xc0, 0x1f, 0xc9, 0x60, 0x1, 0x0, 0xff,
+    0x8, 0x7, 0xff, 0x4, 0x80, 0x4, 0x1, 0xfe,
+    0xe0, 0x3, 0x80, 0x7f, 0x88, 0x0, 0x40, 0x1f,
+    0xe6, 0x0, 0x70, 0x7, 0xf8, 0x80, 0x6, 0x1,
+    0xff, 0xc1, 0x30, 0xf, 0xf3, 0x80, 0x2c, 0xc0,
+    0x3f, 0xa5, 0x0, 0xb3, 0xff, 0x68, 0x7, 0x5b,
+    0x80, 0x7f, 0xc3, 0x8e, 0x1, 0xff, 0x41, 0x81,
+    0x67, 0xfe, 0xd0, 0xc, 0xe0, 0xb, 0x30, 0xf,
+    0xfc, 0x60, 0x1f, 0xe2, 0x0, 0x18, 0x7, 0xf9,
+    0x80, 0x1c, 0x1, 0xfe, 0x20, 0x1, 0x80, 0x7f,
+    0xb8, 0x0, 0xc0, 0x1f, 0xe2, 0x0, 0x10, 0x7,
+    0xf8, 0x40, 0x3f, 0xf2, 0x40, 0x0, 0x40, 0x3c,
+    0x7f, 0xeb, 0x20, 0x3, 0x0, 0x7f, 0xe4, 0x80,
+    0xf, 0xe1, 0x4a, 0xb0, 0xf, 0x80,
 
     /* U+007E "~" */
-    0x0, 0x6, 0x99, 0x50, 0x0, 0x0, 0x23, 0x30,
-    0x2, 0xef, 0xff, 0xfc, 0x10, 0x0, 0xbf, 0xf2,
-    0xc, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xbf, 0xf2,
-    0x1f, 0xfe, 0x22, 0xdf, 0xf9, 0x0, 0xcf, 0xf2,
-    0x2f, 0xfb, 0x0, 0x2f, 0xff, 0xcc, 0xff, 0xe0,
-    0x2f, 0xfb, 0x0, 0x4, 0xff, 0xff, 0xff, 0x50,
-    0x1a, 0xa7, 0x0, 0x0, 0x3b, 0xff, 0xc4, 0x0
+    0x0, 0x9a, 0x64, 0xa0, 0x1c, 0x46, 0x60, 0x1,
+    0x74, 0xb3, 0x2b, 0x4, 0x2, 0x9c, 0xc1, 0x7,
+    0x8, 0x6, 0x3d, 0x0, 0xf8, 0x4c, 0x7, 0x74,
+    0x40, 0x72, 0x0, 0x70, 0x8, 0xc0, 0xa, 0x44,
+    0xf0, 0x3, 0x66, 0xc, 0x4, 0x80, 0x3c, 0x56,
+    0x0, 0x33, 0x0, 0x2c, 0xd, 0x55, 0x80, 0x12,
+    0x62, 0x0, 0xe, 0xd4, 0x0,
 };
 
 
@@ -1941,99 +1278,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 288, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 288, .box_w = 6, .box_h = 22, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 66, .adv_w = 288, .box_w = 12, .box_h = 10, .ofs_x = 3, .ofs_y = 12},
-    {.bitmap_index = 126, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 302, .adv_w = 288, .box_w = 16, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 550, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 748, .adv_w = 288, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 957, .adv_w = 288, .box_w = 4, .box_h = 10, .ofs_x = 7, .ofs_y = 12},
-    {.bitmap_index = 977, .adv_w = 288, .box_w = 10, .box_h = 30, .ofs_x = 5, .ofs_y = -4},
-    {.bitmap_index = 1127, .adv_w = 288, .box_w = 10, .box_h = 30, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 1277, .adv_w = 288, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1405, .adv_w = 288, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1525, .adv_w = 288, .box_w = 6, .box_h = 10, .ofs_x = 6, .ofs_y = -5},
-    {.bitmap_index = 1555, .adv_w = 288, .box_w = 10, .box_h = 3, .ofs_x = 4, .ofs_y = 9},
-    {.bitmap_index = 1570, .adv_w = 288, .box_w = 6, .box_h = 6, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 1588, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 1791, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1945, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2110, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2264, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2429, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2583, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2737, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2913, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3078, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3254, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3430, .adv_w = 288, .box_w = 6, .box_h = 17, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 3481, .adv_w = 288, .box_w = 7, .box_h = 22, .ofs_x = 5, .ofs_y = -5},
-    {.bitmap_index = 3558, .adv_w = 288, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3684, .adv_w = 288, .box_w = 14, .box_h = 10, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 3754, .adv_w = 288, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3880, .adv_w = 288, .box_w = 12, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4012, .adv_w = 288, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4228, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4404, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4569, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4723, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4877, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5031, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5185, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5339, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5493, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5647, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5812, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5977, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6131, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6307, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6461, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6615, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6780, .adv_w = 288, .box_w = 15, .box_h = 27, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 6983, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7148, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7324, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7500, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7654, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7830, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8028, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8204, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8402, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8556, .adv_w = 288, .box_w = 9, .box_h = 29, .ofs_x = 5, .ofs_y = -3},
-    {.bitmap_index = 8687, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 8890, .adv_w = 288, .box_w = 9, .box_h = 29, .ofs_x = 4, .ofs_y = -3},
-    {.bitmap_index = 9021, .adv_w = 288, .box_w = 14, .box_h = 12, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 9105, .adv_w = 288, .box_w = 16, .box_h = 3, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 9129, .adv_w = 288, .box_w = 8, .box_h = 5, .ofs_x = 4, .ofs_y = 20},
-    {.bitmap_index = 9149, .adv_w = 288, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9277, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9431, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9550, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9704, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9823, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9988, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 10142, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10296, .adv_w = 288, .box_w = 15, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10476, .adv_w = 288, .box_w = 12, .box_h = 30, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 10656, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10821, .adv_w = 288, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11008, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11144, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11263, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11382, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11536, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11690, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11809, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11928, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12093, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12212, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12348, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12501, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12637, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 12813, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12932, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 13135, .adv_w = 288, .box_w = 4, .box_h = 29, .ofs_x = 7, .ofs_y = -3},
-    {.bitmap_index = 13193, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 13396, .adv_w = 288, .box_w = 16, .box_h = 7, .ofs_x = 1, .ofs_y = 7}
+    {.bitmap_index = 48, .adv_w = 288, .box_w = 12, .box_h = 10, .ofs_x = 3, .ofs_y = 12},
+    {.bitmap_index = 85, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 228, .adv_w = 288, .box_w = 16, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 392, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 562, .adv_w = 288, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 735, .adv_w = 288, .box_w = 4, .box_h = 10, .ofs_x = 7, .ofs_y = 12},
+    {.bitmap_index = 752, .adv_w = 288, .box_w = 10, .box_h = 30, .ofs_x = 5, .ofs_y = -4},
+    {.bitmap_index = 855, .adv_w = 288, .box_w = 10, .box_h = 30, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 959, .adv_w = 288, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1054, .adv_w = 288, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1085, .adv_w = 288, .box_w = 6, .box_h = 10, .ofs_x = 6, .ofs_y = -5},
+    {.bitmap_index = 1115, .adv_w = 288, .box_w = 10, .box_h = 3, .ofs_x = 4, .ofs_y = 9},
+    {.bitmap_index = 1121, .adv_w = 288, .box_w = 6, .box_h = 6, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 1138, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 1269, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1380, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1439, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1558, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1675, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1757, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1849, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1987, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2092, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2253, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2390, .adv_w = 288, .box_w = 6, .box_h = 17, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 2424, .adv_w = 288, .box_w = 7, .box_h = 22, .ofs_x = 5, .ofs_y = -5},
+    {.bitmap_index = 2482, .adv_w = 288, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 2572, .adv_w = 288, .box_w = 14, .box_h = 10, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 2596, .adv_w = 288, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 2692, .adv_w = 288, .box_w = 12, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2783, .adv_w = 288, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 2939, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3078, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3192, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3288, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3362, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3405, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3433, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3540, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3567, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3601, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3662, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3770, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3790, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3880, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3974, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4064, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4141, .adv_w = 288, .box_w = 15, .box_h = 27, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 4261, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4370, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4516, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4543, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4600, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4745, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4939, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5086, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5195, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5286, .adv_w = 288, .box_w = 9, .box_h = 29, .ofs_x = 5, .ofs_y = -3},
+    {.bitmap_index = 5309, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 5438, .adv_w = 288, .box_w = 9, .box_h = 29, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 5463, .adv_w = 288, .box_w = 14, .box_h = 12, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 5535, .adv_w = 288, .box_w = 16, .box_h = 3, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 5547, .adv_w = 288, .box_w = 8, .box_h = 5, .ofs_x = 4, .ofs_y = 20},
+    {.bitmap_index = 5566, .adv_w = 288, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5670, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5759, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5853, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5944, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6045, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6100, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6213, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6264, .adv_w = 288, .box_w = 15, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6321, .adv_w = 288, .box_w = 12, .box_h = 30, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6392, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6480, .adv_w = 288, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6528, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6578, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6626, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6721, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6814, .adv_w = 288, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6908, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6966, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7073, .adv_w = 288, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7128, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7182, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7297, .adv_w = 288, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7448, .adv_w = 288, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7564, .adv_w = 288, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 7697, .adv_w = 288, .box_w = 14, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7774, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 7905, .adv_w = 288, .box_w = 4, .box_h = 29, .ofs_x = 7, .ofs_y = -3},
+    {.bitmap_index = 7916, .adv_w = 288, .box_w = 14, .box_h = 29, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 8042, .adv_w = 288, .box_w = 16, .box_h = 7, .ofs_x = 1, .ofs_y = 7}
 };
 
 /*---------------------
@@ -2075,7 +1412,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
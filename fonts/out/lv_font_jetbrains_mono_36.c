@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 36 px
  * Bpp: 4
- * Opts: --font JetBrainsMonoNL-SemiBold.ttf --size 36 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_36 --no-compress -o out/lv_font_jetbrains_mono_36.c
+ * Opts: --font JetBrainsMonoNL-SemiBold.ttf --size 36 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_36 -o out/lv_font_jetbrains_mono_36.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -25,2586 +25,1528 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0x6, 0xff, 0xff, 0x0, 0x5f, 0xff, 0xf0, 0x5,
-    0xff, 0xfe, 0x0, 0x4f, 0xff, 0xe0, 0x4, 0xff,
-    0xfe, 0x0, 0x4f, 0xff, 0xd0, 0x3, 0xff, 0xfd,
-    0x0, 0x3f, 0xff, 0xc0, 0x2, 0xff, 0xfc, 0x0,
-    0x2f, 0xff, 0xc0, 0x1, 0xff, 0xfb, 0x0, 0x1f,
-    0xff, 0xb0, 0x1, 0xff, 0xfa, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0xff, 0xfa, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0xff, 0xf9, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x23, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x77, 0x30, 0xa, 0xff, 0xff,
-    0x40, 0xff, 0xff, 0xfa, 0xe, 0xff, 0xff, 0x80,
-    0x4d, 0xff, 0xa0,
+    0x6, 0xff, 0xc0, 0x3, 0x0, 0xff, 0x8, 0x0,
+    0x40, 0x3f, 0xf8, 0xa6, 0x0, 0x70, 0xf, 0xf0,
+    0x80, 0x4, 0x3, 0xff, 0x82, 0x60, 0x13, 0x80,
+    0x7f, 0xf0, 0x44, 0x0, 0x20, 0x1f, 0xfc, 0x53,
+    0x0, 0xff, 0xe0, 0x88, 0x5, 0xb9, 0x89, 0x0,
+    0x88, 0xcc, 0x20, 0x1f, 0xe5, 0x77, 0x18, 0x2,
+    0xa9, 0x10, 0xc4, 0x5, 0x0, 0xdc, 0x2, 0x1,
+    0x88, 0x28, 0x80, 0xb, 0x0,
 
     /* U+0022 "\"" */
-    0x5f, 0xff, 0xe0, 0x0, 0x4f, 0xff, 0xf5, 0xff,
-    0xfd, 0x0, 0x4, 0xff, 0xfe, 0x4f, 0xff, 0xd0,
-    0x0, 0x3f, 0xff, 0xe4, 0xff, 0xfc, 0x0, 0x3,
-    0xff, 0xfd, 0x3f, 0xff, 0xc0, 0x0, 0x2f, 0xff,
-    0xd3, 0xff, 0xfc, 0x0, 0x2, 0xff, 0xfd, 0x2f,
-    0xff, 0xb0, 0x0, 0x1f, 0xff, 0xc2, 0xff, 0xfb,
-    0x0, 0x1, 0xff, 0xfc, 0x2f, 0xff, 0xb0, 0x0,
-    0x1f, 0xff, 0xc1, 0xff, 0xfa, 0x0, 0x0, 0xff,
-    0xfb, 0xb, 0xbb, 0x70, 0x0, 0xb, 0xbb, 0x80,
+    0x5f, 0xfb, 0x80, 0x24, 0xff, 0xc0, 0x18, 0xc0,
+    0x3e, 0x11, 0x0, 0x7c, 0xe0, 0x1f, 0x84, 0x3,
+    0xe3, 0x70, 0xf, 0x84, 0x3, 0xff, 0x8a, 0x20,
+    0x13, 0x80, 0x46, 0x1, 0x8, 0x7, 0xff, 0x38,
+    0xc0, 0x21, 0x0, 0x84, 0x2, 0x71, 0x44, 0xb4,
+    0x3, 0x22, 0x46,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0,
-    0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0xcf, 0xf0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x0,
-    0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x0, 0x5, 0xff, 0x70, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x5, 0xbb, 0xcf, 0xfe, 0xbb, 0xbb,
-    0xbf, 0xff, 0xbb, 0xb3, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x6f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xa0, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
-    0x8b, 0xbc, 0xff, 0xdb, 0xbb, 0xbb, 0xff, 0xeb,
-    0xbb, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0,
-    0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x0, 0x0, 0x9f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xcf,
-    0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xf4, 0x7f, 0x94, 0x3, 0x1f, 0xfa, 0x40,
+    0x3f, 0x18, 0x1, 0xc0, 0x32, 0x80, 0x3c, 0x3,
+    0xf2, 0x80, 0x8, 0x3, 0x78, 0x1, 0x40, 0x3e,
+    0x11, 0x1, 0x80, 0x72, 0x80, 0xc, 0x3, 0xe5,
+    0x0, 0x28, 0x7, 0x18, 0x10, 0x7, 0xe3, 0x0,
+    0x78, 0x6, 0x20, 0x3, 0x80, 0x7e, 0xd0, 0x2,
+    0x80, 0x67, 0x0, 0x68, 0x6, 0x7f, 0xf9, 0x40,
+    0x19, 0xff, 0xa8, 0x1, 0x1f, 0xe5, 0x0, 0xff,
+    0xe4, 0x92, 0x20, 0xc0, 0x2, 0x89, 0xc0, 0x12,
+    0x24, 0xc0, 0xb7, 0x69, 0x0, 0x35, 0xdf, 0x0,
+    0xe, 0xee, 0x30, 0xc, 0x40, 0xd, 0x0, 0xc6,
+    0x0, 0x60, 0xf, 0xda, 0x0, 0x70, 0xc, 0xa0,
+    0xd, 0x0, 0xfc, 0xe0, 0x2, 0x0, 0xde, 0x0,
+    0x30, 0xf, 0xc4, 0x6, 0x1, 0xca, 0x0, 0x50,
+    0xf, 0x8c, 0x0, 0xc0, 0x1c, 0x40, 0x22, 0x0,
+    0xd1, 0x76, 0xf0, 0x3, 0xdd, 0xf0, 0x80, 0x2e,
+    0xe0, 0x1, 0xa2, 0xc, 0x0, 0x48, 0x9c, 0x0,
+    0x14, 0x48, 0x40, 0x3f, 0xf9, 0x37, 0xfe, 0x10,
+    0x1f, 0xfe, 0x50, 0x6, 0x7f, 0xc2, 0x1, 0x8,
+    0x81, 0x40, 0x39, 0xc0, 0x6, 0x1, 0xf2, 0x80,
+    0xc, 0x3, 0x88, 0x8, 0x3, 0xf1, 0x80, 0x34,
+    0x3, 0x18, 0x1, 0xc0, 0x3f, 0x68, 0x1, 0xc0,
+    0x32, 0x80, 0x34, 0x3, 0xf3, 0x80, 0x8, 0x3,
+    0x78, 0x0, 0xc0, 0x3f, 0x10, 0x18, 0x7, 0x28,
+    0x1, 0x40, 0x3c,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xff, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d,
-    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x6, 0xff, 0xff, 0x64, 0xff, 0x29, 0xff, 0xff,
-    0x40, 0xb, 0xff, 0xf5, 0x3, 0xff, 0x0, 0x8f,
-    0xff, 0xa0, 0xf, 0xff, 0xf0, 0x3, 0xff, 0x0,
-    0x1f, 0xff, 0xd0, 0xf, 0xff, 0xe0, 0x3, 0xff,
-    0x0, 0x7, 0x88, 0x70, 0xf, 0xff, 0xf0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf7,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x63, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xe9, 0x30, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x4b, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0xe, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0xb, 0xff, 0xf4,
-    0x9f, 0xff, 0x50, 0x3, 0xff, 0x0, 0xa, 0xff,
-    0xf3, 0x7f, 0xff, 0x80, 0x3, 0xff, 0x0, 0xd,
-    0xff, 0xf2, 0x3f, 0xff, 0xf3, 0x3, 0xff, 0x0,
-    0x8f, 0xff, 0xd0, 0xc, 0xff, 0xff, 0x97, 0xff,
-    0x5b, 0xff, 0xff, 0x60, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x7d, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0xff, 0xc0, 0x1f, 0xff, 0x82, 0x40,
+    0x2, 0x90, 0x7, 0xf9, 0xf7, 0x50, 0x0, 0xad,
+    0xd2, 0x80, 0x78, 0x72, 0x8, 0x3, 0xc5, 0x56,
+    0x1, 0xda, 0x60, 0x1f, 0xe4, 0xa0, 0x9, 0x8c,
+    0x2, 0x9b, 0x0, 0x6b, 0x0, 0x4a, 0x80, 0xd,
+    0x0, 0xa9, 0x9c, 0x0, 0x52, 0xe0, 0x17, 0x0,
+    0x10, 0x2, 0x50, 0xf, 0x48, 0x4, 0xe0, 0x1c,
+    0x20, 0x1f, 0xc, 0x3b, 0xa8, 0x3, 0x84, 0x3,
+    0xf3, 0xc4, 0x1c, 0x0, 0x40, 0x13, 0x80, 0x7f,
+    0xf0, 0x54, 0x2, 0x86, 0x0, 0xff, 0xd2, 0x20,
+    0x14, 0xe8, 0x7, 0xfc, 0x36, 0x1, 0x84, 0x1,
+    0xd2, 0x60, 0x1f, 0x2d, 0x0, 0x78, 0x5b, 0x2c,
+    0x40, 0x3c, 0xbc, 0xe2, 0x1, 0xe4, 0xf2, 0x0,
+    0xf0, 0xc7, 0x50, 0x7, 0x87, 0x0, 0x3f, 0x98,
+    0x1, 0x68, 0x1, 0xc, 0x0, 0x7f, 0xc9, 0x6c,
+    0x1, 0x30, 0x7, 0xff, 0x6, 0x44, 0x0, 0x24,
+    0x1, 0xff, 0xc1, 0x50, 0x9, 0xa7, 0xfe, 0x50,
+    0xf, 0xc2, 0x1, 0x3f, 0x0, 0x5a, 0x1, 0xf9,
+    0xc0, 0x21, 0x40, 0x9, 0xcc, 0x3, 0xd0, 0x40,
+    0x2, 0x21, 0x98, 0x2, 0xc9, 0x40, 0x2, 0xdb,
+    0x80, 0x56, 0x0, 0xe0, 0xc, 0xd0, 0x0, 0xa4,
+    0x0, 0x91, 0x80, 0x5, 0x82, 0x1, 0xfe, 0x5b,
+    0x0, 0xc7, 0xd0, 0x40, 0x1e, 0x4b, 0xa0, 0xf,
+    0x9f, 0x7a, 0x40, 0x19, 0xf6, 0x80, 0x1f, 0xe1,
+    0x50, 0x1, 0x80, 0x7f, 0xfc, 0x40,
 
     /* U+0025 "%" */
-    0x0, 0x4b, 0xef, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xe1, 0x7, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x2f, 0xff,
-    0xc9, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x5f, 0xf9,
-    0x0, 0x7f, 0xfa, 0x0, 0xa, 0xff, 0x70, 0x0,
-    0x1, 0xef, 0xd0, 0x0, 0x9f, 0xf5, 0x0, 0x5,
-    0xff, 0x90, 0x0, 0xb, 0xff, 0x30, 0x0, 0x9f,
-    0xf5, 0x0, 0x4, 0xff, 0xa0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x9f, 0xf5, 0x0, 0x4, 0xff, 0x90,
-    0x2, 0xff, 0xc0, 0x0, 0x0, 0x9f, 0xf6, 0x0,
-    0x6, 0xff, 0x90, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x6f, 0xfe, 0x30, 0x3e, 0xff, 0x60, 0x8f, 0xf6,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xfd,
-    0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xd2, 0xe, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x89, 0x84, 0x0, 0xaf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
-    0x7, 0xcf, 0xfd, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x80, 0xcf, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x2f, 0xfc, 0x8, 0xff, 0xfa,
-    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
-    0xd, 0xff, 0x50, 0x2, 0xff, 0xf1, 0x0, 0x0,
-    0x8, 0xff, 0x60, 0xf, 0xff, 0x0, 0x0, 0xcf,
-    0xf3, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0xdf, 0xe1,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0xbf, 0xf3, 0x0,
-    0x9, 0xff, 0x50, 0x0, 0xf, 0xfe, 0x0, 0x0,
-    0xcf, 0xf3, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0xd,
-    0xff, 0x30, 0x1, 0xff, 0xf1, 0x1, 0xef, 0xe0,
-    0x0, 0x0, 0x7, 0xff, 0xf9, 0x8e, 0xff, 0xb0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfe, 0x10, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+    0x0, 0x25, 0xf7, 0xf5, 0x18, 0x7, 0xe1, 0xef,
+    0xe1, 0x7, 0xb4, 0x10, 0x15, 0xc6, 0x0, 0xfa,
+    0xc4, 0x28, 0x4a, 0x0, 0x6, 0xc6, 0x0, 0x91,
+    0x0, 0xe5, 0x50, 0x32, 0x2, 0x80, 0x17, 0x27,
+    0x14, 0x0, 0xc0, 0x18, 0x6c, 0xa, 0x40, 0x1c,
+    0x0, 0xf0, 0xb, 0xc0, 0x1c, 0x1, 0xa8, 0x43,
+    0x80, 0x3f, 0xc2, 0x0, 0x30, 0x9, 0xd0, 0x1c,
+    0xc0, 0x3f, 0xf8, 0x26, 0x0, 0x28, 0x3, 0x80,
+    0xf, 0x8c, 0x2, 0x20, 0xe, 0xf0, 0x7, 0x0,
+    0x77, 0x80, 0x20, 0xc0, 0xe0, 0x1, 0xe1, 0x4,
+    0x12, 0x40, 0x1c, 0xc2, 0x3, 0x9f, 0x82, 0x4,
+    0xc6, 0xe0, 0x8c, 0x1, 0xf6, 0x10, 0x7, 0x17,
+    0x86, 0x80, 0xd0, 0x7, 0xe2, 0xda, 0x76, 0x7b,
+    0xd2, 0xa1, 0xb, 0x10, 0xf, 0xf2, 0xc4, 0xc2,
+    0x2, 0xa8, 0x19, 0x40, 0x3f, 0xf8, 0x83, 0x60,
+    0x52, 0x1, 0xff, 0xc5, 0xa1, 0xe, 0x7, 0xcf,
+    0xf6, 0xc0, 0x80, 0x7f, 0x32, 0x3, 0x9e, 0x41,
+    0x80, 0x9, 0xf0, 0x40, 0x3e, 0x29, 0x3, 0x88,
+    0x18, 0x1, 0x54, 0x0, 0x2a, 0x0, 0xfb, 0x80,
+    0x1c, 0xa, 0x0, 0xaa, 0xb4, 0x0, 0x82, 0x1,
+    0xd0, 0x61, 0x24, 0x4, 0x0, 0x50, 0x1, 0x18,
+    0x0, 0x80, 0x31, 0xb8, 0x23, 0x0, 0x61, 0x0,
+    0xce, 0x1, 0xf7, 0x0, 0xd0, 0x7, 0xff, 0x16,
+    0x48, 0x2c, 0x40, 0x3f, 0xce, 0x1, 0xc8, 0xc0,
+    0xaa, 0x0, 0xc4, 0x2, 0x60, 0x1, 0x30, 0x1,
+    0x0, 0xd0, 0xd, 0x0, 0x75, 0x0, 0x32, 0x63,
+    0xc0, 0x8, 0x21, 0x42, 0x14, 0x1, 0xe7, 0x30,
+    0x3, 0x38, 0x80, 0xd0, 0x32, 0x3, 0xa0, 0x7,
+    0xd9, 0x6, 0x0, 0x27, 0xf1, 0x0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x28, 0xdf, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x44,
-    0x8f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x70, 0x0, 0x0,
-    0xef, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf9, 0x0, 0x0, 0x8, 0xbb, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xcc, 0xff, 0xfa, 0x0, 0x0, 0x4f, 0xff,
-    0xc0, 0xc, 0xff, 0xf9, 0x0, 0xb, 0xff, 0xf7,
-    0x0, 0x2f, 0xff, 0xe1, 0x1, 0xff, 0xfd, 0x0,
-    0x0, 0x1d, 0xff, 0xf4, 0x1d, 0xff, 0xf3, 0x0,
-    0x3f, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xff, 0xec,
-    0xff, 0xf5, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x4f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfa,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xef, 0xff, 0x40, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x96, 0x59, 0xff, 0xff, 0x55, 0xff, 0xfa, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xa, 0xff, 0xf6, 0x0, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x1e, 0xff, 0xf2, 0x0,
-    0x0, 0x5, 0xbe, 0xfe, 0xc7, 0x10, 0x0, 0x0,
-    0x4f, 0xff, 0xd0,
+    0x0, 0xf1, 0x46, 0xff, 0xb6, 0x4c, 0x3, 0xff,
+    0x84, 0xba, 0xe4, 0x0, 0x26, 0xc8, 0x0, 0xff,
+    0xc9, 0x40, 0x1f, 0x9e, 0x40, 0x3f, 0xe9, 0x0,
+    0x92, 0xec, 0xe0, 0x13, 0x18, 0x7, 0xf1, 0x10,
+    0x0, 0x76, 0x88, 0x89, 0x0, 0xa8, 0x3, 0xf8,
+    0x40, 0x2b, 0x0, 0xcc, 0x20, 0x4, 0x0, 0xfe,
+    0x10, 0xb, 0x80, 0x39, 0x91, 0xc, 0x1, 0xfc,
+    0x44, 0x0, 0x38, 0x80, 0x68, 0xbb, 0x80, 0x3f,
+    0xd0, 0x0, 0x1b, 0x0, 0xff, 0xe3, 0x2a, 0x80,
+    0xa, 0xe0, 0x1f, 0xfc, 0x6a, 0x10, 0x4, 0x20,
+    0x7, 0xff, 0xc, 0xeb, 0xc4, 0x2, 0xa2, 0x0,
+    0xff, 0xe0, 0xb6, 0x28, 0x7, 0xf, 0x80, 0x7f,
+    0xe3, 0x90, 0xc, 0x66, 0x0, 0x15, 0x0, 0x64,
+    0xff, 0xb0, 0x1, 0xe0, 0x13, 0x7e, 0x61, 0x0,
+    0xa, 0xe0, 0x2, 0xb0, 0x0, 0xe8, 0x9, 0x80,
+    0xa, 0x40, 0x2a, 0x20, 0x4, 0x20, 0xf8, 0x5,
+    0xa2, 0x4, 0x1, 0x20, 0x6, 0x1e, 0x0, 0xab,
+    0x48, 0x1, 0x46, 0x1, 0xe1, 0x0, 0xe3, 0xa0,
+    0x0, 0x98, 0x2, 0x14, 0x2, 0x70, 0xf, 0xf2,
+    0xb8, 0x6, 0x57, 0x0, 0xce, 0x1, 0xff, 0x68,
+    0x6, 0xd0, 0xe, 0x10, 0x8, 0xc0, 0x3c, 0x54,
+    0x1, 0xa0, 0xc0, 0x31, 0x8, 0x1, 0x10, 0x1,
+    0x8b, 0x0, 0x3d, 0xc0, 0x1c, 0xc0, 0x15, 0xcb,
+    0x2c, 0xe8, 0x80, 0x2a, 0x80, 0x2, 0xa0, 0xd,
+    0x24, 0x1, 0x34, 0xd3, 0x0, 0x52, 0xab, 0x0,
+    0x15, 0x80, 0x21, 0xf3, 0x0, 0xf8, 0x65, 0x80,
+    0x16, 0x20, 0x9, 0x20, 0x8, 0xb2, 0x90, 0x40,
+    0x4e, 0x3d, 0x80, 0x21, 0xa0, 0xb, 0xc0,
 
     /* U+0027 "'" */
-    0x5f, 0xff, 0xe4, 0xff, 0xfe, 0x4f, 0xff, 0xd3,
-    0xff, 0xfd, 0x3f, 0xff, 0xd2, 0xff, 0xfc, 0x2f,
-    0xff, 0xc1, 0xff, 0xfb, 0x1f, 0xff, 0xb1, 0xff,
-    0xfb, 0xb, 0xbb, 0x70,
+    0x5f, 0xfb, 0x84, 0x3, 0xf1, 0xb8, 0x7, 0xf0,
+    0x80, 0x42, 0x1, 0xc6, 0x1, 0x38, 0x7, 0xf8,
+    0x51, 0x2c,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xb6, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0xf7, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xf7, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6,
-    0x0, 0x6, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x3f,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0xdf, 0xff, 0xc0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1,
+    0x0, 0xfc, 0x2d, 0x6c, 0x1, 0xe1, 0x8e, 0x94,
+    0x10, 0xe, 0x4f, 0x70, 0xf, 0xcf, 0x62, 0x1,
+    0x84, 0x2, 0x68, 0x0, 0x86, 0x39, 0x80, 0x7,
+    0x20, 0x11, 0xfb, 0x88, 0x5, 0xc0, 0x11, 0xe0,
+    0x80, 0x65, 0x20, 0x0, 0xe8, 0x7, 0xb8, 0x2,
+    0x91, 0x0, 0xe1, 0x40, 0x9, 0xc0, 0x3c, 0xa0,
+    0x12, 0x80, 0x7c, 0x60, 0x16, 0x80, 0x7d, 0xe0,
+    0x11, 0x80, 0x7c, 0x40, 0x13, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xf8, 0x86, 0x1, 0x38, 0x7, 0xc2,
+    0x1, 0x10, 0x7, 0xda, 0x1, 0x78, 0x7, 0xce,
+    0x1, 0x38, 0x7, 0xc4, 0x40, 0x0, 0xa8, 0x7,
+    0xd4, 0x1, 0x40, 0x7, 0xcc, 0x20, 0x2, 0x90,
+    0xf, 0xc, 0x0, 0x4d, 0x0, 0x1e, 0x65, 0x0,
+    0x9f, 0xc, 0x3, 0xa9, 0x0, 0x23, 0xcd, 0x40,
+    0xd, 0x6c, 0x1, 0x88, 0xc0, 0x3a, 0x6c, 0x80,
+    0x3f, 0xc9, 0xb4, 0x80, 0x1f, 0xe5, 0xbf, 0x60,
 
     /* U+0029 ")" */
-    0xb9, 0x40, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd,
-    0x50, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfb, 0x10,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x1e, 0xff, 0xf9, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xe1, 0x0, 0x0, 0x7e,
-    0xff, 0xff, 0x40, 0x0, 0x9e, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xdf, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0xdf, 0xff, 0xa1, 0x0, 0x0, 0x0, 0xdd, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xb9, 0x40, 0xf, 0xe6, 0x65, 0xea, 0x80, 0x7f,
+    0x8a, 0xac, 0x40, 0x38, 0x40, 0x32, 0x79, 0x0,
+    0x6c, 0xc2, 0x0, 0x43, 0x82, 0x1, 0x8e, 0xe8,
+    0x2, 0x1d, 0x0, 0xf2, 0xd8, 0x4, 0x6c, 0x1,
+    0xe4, 0x80, 0xa, 0x0, 0x3e, 0x72, 0x0, 0xa,
+    0x80, 0x7d, 0x60, 0x17, 0x80, 0x7c, 0xe0, 0x12,
+    0x0, 0x7c, 0x24, 0x0, 0x11, 0x0, 0x7c, 0xc0,
+    0x11, 0x80, 0x7c, 0x20, 0x10, 0x80, 0x7f, 0xce,
+    0x1, 0xff, 0xfb, 0x70, 0xf, 0x84, 0x2, 0x10,
+    0xf, 0x98, 0x2, 0x30, 0xf, 0x88, 0x2, 0x10,
+    0xf, 0x28, 0x4, 0x80, 0x1f, 0x70, 0x5, 0x80,
+    0x1e, 0x44, 0x0, 0x4c, 0x1, 0xc3, 0x40, 0x13,
+    0x8, 0x6, 0x2c, 0x10, 0x0, 0xc0, 0x6, 0x7c,
+    0x20, 0xa, 0x84, 0x1, 0x3d, 0x2, 0x1, 0x52,
+    0x0, 0x48, 0x20, 0x10, 0xda, 0x80, 0x7e, 0x5f,
+    0x40, 0xf, 0x13, 0x6d, 0x8, 0x7, 0xbf, 0x64,
+    0x80, 0x3f, 0x0,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xb5, 0x0, 0x0, 0xcf, 0xf6,
-    0x0, 0x2, 0x7d, 0x70, 0x3f, 0xff, 0xf9, 0x30,
-    0xaf, 0xf4, 0x5, 0xcf, 0xff, 0xd0, 0x9f, 0xff,
-    0xff, 0xfb, 0xaf, 0xf7, 0xef, 0xff, 0xff, 0xf3,
-    0x16, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x40, 0x0, 0x2, 0x8c, 0xff, 0xff, 0xff,
-    0xff, 0xb6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0xcf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xd0, 0x4f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x40, 0xb, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfa, 0x0, 0x1, 0xef, 0xfe, 0x10, 0x0,
-    0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
-    0x90, 0x0, 0x0, 0x2, 0xdf, 0x30, 0x0, 0x0,
-    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
+    0x0, 0xfd, 0xbf, 0xe7, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf0, 0xb6, 0xd4, 0x3, 0x8, 0x0, 0x40,
+    0x22, 0x7d, 0x70, 0x32, 0x4a, 0xf9, 0x30, 0x60,
+    0x1, 0x2, 0xe6, 0xc1, 0x50, 0x50, 0x6, 0x6c,
+    0xb0, 0x8, 0xfa, 0x8c, 0x2, 0x23, 0x89, 0x30,
+    0xc, 0x8a, 0x0, 0x81, 0x0, 0xcb, 0x66, 0x2d,
+    0x9a, 0xe6, 0x1, 0xf9, 0x27, 0xe9, 0x0, 0x31,
+    0x46, 0x7b, 0x0, 0x6b, 0xfb, 0x60, 0xf, 0xf3,
+    0x30, 0x3, 0x48, 0x80, 0x7f, 0xc9, 0x20, 0x9,
+    0x30, 0x2d, 0x0, 0xff, 0xd, 0x0, 0x9, 0xa0,
+    0x0, 0x74, 0x1, 0xfd, 0x42, 0x0, 0x90, 0x44,
+    0x0, 0x15, 0x40, 0x1f, 0x3a, 0x0, 0x15, 0x0,
+    0x14, 0x20, 0xb, 0x10, 0xe, 0x18, 0x0, 0x15,
+    0x0, 0x43, 0x60, 0x1, 0x80, 0xe, 0x1d, 0x20,
+    0xe0, 0xe, 0x56, 0x6, 0x90, 0xf, 0x16, 0xd9,
+    0x80, 0x7a, 0x6e, 0x40, 0x30,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x1e, 0xee, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x68, 0x88, 0x88, 0x8f, 0xff, 0xd8,
-    0x88, 0x88, 0x83, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0,
-    0x0,
+    0x0, 0xf0, 0xf7, 0x54, 0x1, 0xff, 0xc2, 0x11,
+    0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x56, 0x7f,
+    0xf7, 0x0, 0x49, 0xff, 0xe6, 0x0, 0xff, 0xec,
+    0x53, 0xbf, 0x80, 0x22, 0x77, 0xf2, 0xb4, 0x47,
+    0x48, 0x4, 0xd1, 0x1e, 0x30, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xc,
 
     /* U+002C "," */
-    0x0, 0xef, 0xff, 0x80, 0x1f, 0xff, 0xf5, 0x4,
-    0xff, 0xff, 0x10, 0x7f, 0xff, 0xd0, 0xa, 0xff,
-    0xf9, 0x0, 0xdf, 0xff, 0x50, 0xf, 0xff, 0xf2,
-    0x2, 0xff, 0xfe, 0x0, 0x5f, 0xff, 0xa0, 0x8,
-    0xff, 0xf6, 0x0, 0xbf, 0xff, 0x20, 0x0,
+    0x0, 0x77, 0xfd, 0x0, 0x22, 0x0, 0xb4, 0x14,
+    0x3, 0x20, 0x18, 0x4, 0x42, 0x1a, 0x1, 0x20,
+    0x1, 0xc0, 0x2c, 0x0, 0x10, 0x4, 0xe0, 0x40,
+    0x10, 0x90, 0x38, 0x4, 0x80, 0xd, 0x0, 0xb0,
+    0x0, 0x60, 0x12, 0x0, 0x0,
 
     /* U+002D "-" */
-    0x78, 0x88, 0x88, 0x88, 0x88, 0x84, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x78, 0x8f, 0xf2, 0x43, 0xbf, 0xfb, 0x40, 0x3f,
+    0xf9, 0x80,
 
     /* U+002E "." */
-    0x0, 0x2, 0x10, 0x0, 0x4e, 0xff, 0xb1, 0x1f,
-    0xff, 0xff, 0x94, 0xff, 0xff, 0xfe, 0x4f, 0xff,
-    0xff, 0xd0, 0xef, 0xff, 0xf8, 0x2, 0xbf, 0xe8,
-    0x0,
+    0x0, 0x88, 0x40, 0x24, 0xed, 0xeb, 0x11, 0x58,
+    0x80, 0x12, 0x14, 0x3, 0x9c, 0x3, 0xc6, 0x82,
+    0x1, 0x94, 0x31, 0x0, 0x5e, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x88,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0xe0, 0xbc, 0x41, 0xc0, 0x3f, 0xf8,
+    0x29, 0xe, 0xeb, 0x0, 0xff, 0xe0, 0xf0, 0x5,
+    0x40, 0x1f, 0xfc, 0x15, 0x0, 0x9c, 0x3, 0xff,
+    0x30, 0x4, 0xa2, 0x1, 0xff, 0xa8, 0x2, 0xe0,
+    0xf, 0xfc, 0x46, 0x0, 0x14, 0x0, 0xff, 0xd4,
+    0x1, 0x30, 0x7, 0xff, 0x5, 0x80, 0x2a, 0x0,
+    0xff, 0xc8, 0x20, 0x3, 0x20, 0xf, 0xfd, 0xc0,
+    0x15, 0x0, 0x7f, 0xe1, 0x50, 0x9, 0x80, 0x3f,
+    0xf3, 0x80, 0x4a, 0x1, 0xff, 0xc1, 0xa0, 0xb,
+    0x80, 0x3f, 0xf1, 0x18, 0x0, 0x50, 0x3, 0xff,
+    0x50, 0x4, 0xc0, 0x1f, 0xfc, 0x16, 0x0, 0xa8,
+    0x3, 0xff, 0x20, 0x80, 0xc, 0x80, 0x3f, 0xf7,
+    0x0, 0x54, 0x1, 0xff, 0x85, 0x40, 0x26, 0x0,
+    0xff, 0xcc, 0x1, 0x30, 0x7, 0xff, 0x6, 0x80,
+    0x2a, 0x0, 0xff, 0xc6, 0x40, 0x2, 0x30, 0xf,
+    0xfd, 0x40, 0x15, 0x0, 0x7f, 0xf0, 0x5c, 0x2,
+    0x60, 0xf, 0xfc, 0xa2, 0x0, 0x41, 0x0, 0xff,
+    0xdc, 0x1, 0x70, 0x7, 0xfe, 0x14, 0x0, 0x94,
+    0x3, 0xff, 0x30, 0x4, 0xc0, 0x1f, 0xfc, 0x1a,
+    0x0, 0xa8, 0x3, 0xff, 0x19, 0x0, 0x8, 0xc0,
+    0x3f, 0xf5, 0x0, 0x54, 0x1, 0xff, 0xc1, 0x60,
+    0x9, 0x80, 0x3f, 0xf2, 0x80, 0x48, 0x20, 0x1f,
+    0xf8,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x4f, 0xff, 0xfd, 0x75, 0x69, 0xff,
-    0xff, 0xd0, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0x61, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfb, 0x4f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xd5, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfe, 0x5f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf5, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x5f, 0xff, 0x60,
-    0x0, 0x32, 0x0, 0xc, 0xff, 0xf5, 0xff, 0xf6,
-    0x1, 0xdf, 0xf8, 0x0, 0xcf, 0xff, 0x5f, 0xff,
-    0x60, 0x6f, 0xff, 0xf0, 0xc, 0xff, 0xf5, 0xff,
-    0xf6, 0x5, 0xff, 0xfe, 0x0, 0xcf, 0xff, 0x5f,
-    0xff, 0x60, 0x9, 0xfe, 0x40, 0xc, 0xff, 0xf5,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x5f, 0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf5, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x5f, 0xff, 0x60, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xe4, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfd, 0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xb0, 0xcf, 0xff, 0x90, 0x0, 0x0,
-    0x2e, 0xff, 0xf5, 0x4, 0xff, 0xff, 0xd7, 0x56,
-    0x9f, 0xff, 0xfd, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xed, 0xa4, 0x0, 0x0,
+    0x0, 0xc2, 0xf7, 0xdf, 0xed, 0xa5, 0x0, 0xf9,
+    0xba, 0x10, 0x40, 0x4, 0xb5, 0xa4, 0x1, 0xa2,
+    0x40, 0x3f, 0x8b, 0x48, 0x0, 0x8e, 0x1, 0x14,
+    0x54, 0xb0, 0x6, 0xf0, 0x4, 0x0, 0x4d, 0xae,
+    0xad, 0x3a, 0x20, 0x2, 0x61, 0x30, 0x1, 0x48,
+    0x7, 0x15, 0x0, 0x5a, 0xa0, 0x12, 0x80, 0x7c,
+    0x82, 0x0, 0x61, 0x0, 0xb8, 0x3, 0xf1, 0x0,
+    0xc, 0x3, 0xff, 0x88, 0x20, 0x1f, 0xfc, 0xd3,
+    0x20, 0xf, 0xfe, 0x8, 0xee, 0x6c, 0x0, 0x7f,
+    0xe7, 0x20, 0x3, 0x80, 0x7f, 0xe3, 0x0, 0x84,
+    0x3, 0xff, 0x2b, 0x0, 0xd0, 0x7, 0xff, 0x6,
+    0x7f, 0x90, 0x3, 0xff, 0xd8, 0x22, 0x0, 0xb8,
+    0x3, 0xf1, 0x0, 0xd, 0x40, 0x25, 0x0, 0xf9,
+    0x4, 0x0, 0xc2, 0x60, 0x2, 0x90, 0xe, 0x2a,
+    0x0, 0xb8, 0x20, 0x2, 0x6d, 0x75, 0x69, 0xd1,
+    0x0, 0x12, 0x82, 0x38, 0x4, 0x51, 0x52, 0xc0,
+    0x10, 0xf8, 0x5, 0x10, 0x0, 0xfe, 0x3c, 0x20,
+    0xc, 0xfd, 0x8, 0x20, 0x24, 0xb7, 0x84, 0x0,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xfe, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfb, 0x1e, 0xff, 0xf0,
-    0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0xef, 0xd3, 0x0, 0xe, 0xff,
-    0xf0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0xef,
-    0xff, 0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0xe,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x78, 0x88, 0x88, 0x8f, 0xff,
-    0xf8, 0x88, 0x88, 0x5e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xae, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0xe8, 0xff, 0xe0, 0xf, 0xe2, 0xc7, 0x0,
+    0xff, 0xe0, 0xb6, 0x98, 0x7, 0xfe, 0x1a, 0x90,
+    0x8, 0x40, 0x3f, 0xd8, 0xa0, 0x12, 0x78, 0x80,
+    0x7f, 0x18, 0x5, 0x16, 0x20, 0x1f, 0xf8, 0xb1,
+    0xc0, 0x3f, 0xf8, 0x2b, 0xa6, 0x1, 0xff, 0xc1,
+    0xba, 0x0, 0xff, 0xe1, 0xa8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xfa, 0x78, 0x8f,
+    0x8, 0x5, 0x11, 0xcb, 0x2e, 0xfe, 0x0, 0xce,
+    0xfd, 0xe0, 0x1f, 0xfd, 0x60,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x16, 0xbd, 0xfe, 0xd9, 0x40, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x4, 0xff, 0xff, 0xe9, 0x78,
-    0xcf, 0xff, 0xfc, 0x0, 0xc, 0xff, 0xfb, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x40, 0x2f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x90, 0x5f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xc0, 0x5c,
-    0xcc, 0x50, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2,
+    0x0, 0xc2, 0xd7, 0xbf, 0xdb, 0x28, 0x1, 0xf9,
+    0x7e, 0x50, 0x80, 0x49, 0xae, 0xc2, 0x1, 0xcf,
+    0x42, 0x1, 0xf9, 0x3c, 0x40, 0x24, 0x80, 0x8,
+    0x5a, 0x1c, 0xc0, 0x21, 0xd0, 0xa, 0x0, 0x24,
+    0xe9, 0x78, 0xc9, 0x0, 0x8d, 0x0, 0x8c, 0x0,
+    0x36, 0x1, 0xcc, 0xa0, 0x16, 0x83, 0x80, 0x4c,
+    0x1, 0xf7, 0x0, 0x4a, 0x0, 0x33, 0xb4, 0x3,
+    0xe6, 0x0, 0x84, 0x17, 0x32, 0x50, 0xf, 0x84,
+    0x2, 0x60, 0xf, 0xfe, 0xd, 0x80, 0x46, 0x1,
+    0xff, 0xc1, 0x60, 0xa, 0xc0, 0x3f, 0xf4, 0x88,
+    0x0, 0xcc, 0x1, 0xff, 0x2b, 0x0, 0x5e, 0x1,
+    0xff, 0x25, 0x0, 0x4e, 0x60, 0x1f, 0xe4, 0xb0,
+    0x9, 0x60, 0x3, 0xfc, 0x96, 0x1, 0x25, 0x0,
+    0x7f, 0x92, 0xc0, 0x24, 0xb0, 0xf, 0xf1, 0xd8,
+    0x4, 0x96, 0x1, 0xfe, 0x3c, 0x0, 0x92, 0xc0,
+    0x3f, 0xc7, 0x80, 0x12, 0x58, 0x7, 0xf8, 0xf0,
+    0x2, 0x4b, 0x0, 0xff, 0x1e, 0x80, 0x4b, 0x60,
+    0x1f, 0xe1, 0xd1, 0x0, 0x8a, 0x23, 0xfc, 0x26,
+    0x20, 0x19, 0xdf, 0xfe, 0x30, 0xf, 0xfe, 0xc0,
 
     /* U+0033 "3" */
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x57, 0x77, 0x77, 0x77, 0x77, 0xcf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x6, 0xbb, 0xbc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x46, 0x66, 0x10, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xa9, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x7f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x72, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x6f, 0xff, 0xf2, 0xa, 0xff, 0xff, 0xc7, 0x67,
-    0xcf, 0xff, 0xfa, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x3, 0x9d,
-    0xef, 0xed, 0x93, 0x0, 0x0,
+    0xd, 0xff, 0xff, 0xe1, 0x0, 0x7f, 0xf6, 0x22,
+    0x3f, 0xc6, 0x1, 0x10, 0x1, 0x5d, 0xff, 0x9,
+    0x80, 0xf, 0x0, 0x3f, 0xcd, 0x20, 0x3, 0xd1,
+    0x0, 0xfe, 0x79, 0x0, 0x1e, 0x8, 0x7, 0xf3,
+    0xc0, 0x0, 0xf0, 0x3, 0xfc, 0xf0, 0x0, 0x3c,
+    0x0, 0xff, 0x34, 0x0, 0x56, 0x60, 0x1f, 0xee,
+    0x0, 0xd1, 0x9a, 0xa0, 0x1f, 0xfc, 0x32, 0xa8,
+    0x0, 0xfb, 0x91, 0x23, 0x0, 0xce, 0xc0, 0x1e,
+    0x6b, 0xbb, 0x39, 0x40, 0x29, 0x0, 0xff, 0x86,
+    0x8c, 0x2, 0x50, 0xf, 0xfd, 0x40, 0x16, 0x0,
+    0x7f, 0xe5, 0x0, 0x8c, 0x3, 0xff, 0x88, 0x28,
+    0xcd, 0x8, 0x7, 0xfc, 0x3b, 0x33, 0x20, 0x7,
+    0xce, 0x1, 0x1f, 0x0, 0x5e, 0x1, 0xf7, 0x0,
+    0x5c, 0xa0, 0x12, 0xb0, 0x7, 0x32, 0x80, 0x4a,
+    0x4a, 0x1, 0x4e, 0x3b, 0x3e, 0x48, 0x4, 0xa4,
+    0x16, 0x40, 0x11, 0xc4, 0xc1, 0x80, 0x45, 0x60,
+    0x1, 0xc4, 0x0, 0xfe, 0x4c, 0x10, 0x8, 0x6f,
+    0x18, 0x84, 0x4, 0x9b, 0x2c, 0x40, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff,
-    0x3, 0xff, 0xff, 0x30, 0x0, 0x0, 0xef, 0xff,
-    0xd, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xaf, 0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
+    0x0, 0xfe, 0x6f, 0xfb, 0x84, 0x3, 0xf8, 0x60,
+    0x2, 0xb1, 0x0, 0xfe, 0xb1, 0x0, 0x2a, 0x80,
+    0x3f, 0x95, 0x40, 0x1, 0xb0, 0xf, 0xe1, 0xb0,
+    0xa, 0x4, 0x3, 0xfa, 0xc4, 0x0, 0x8c, 0x1,
+    0xfc, 0x8a, 0x1, 0x48, 0x7, 0xfa, 0x80, 0x29,
+    0x20, 0xf, 0xe9, 0x10, 0x1, 0xb0, 0x7, 0xf2,
+    0x30, 0x5, 0xc0, 0x1f, 0xe9, 0x0, 0xa0, 0x80,
+    0x3f, 0xa0, 0x80, 0x4, 0xe0, 0x1b, 0xbf, 0xe0,
+    0x37, 0x0, 0xb8, 0x3, 0xfd, 0xc0, 0x13, 0x98,
+    0x7, 0xf3, 0x90, 0x0, 0xa0, 0x3, 0xfd, 0xa0,
+    0x14, 0x80, 0x7f, 0xf0, 0xd8, 0x3, 0xff, 0x87,
+    0xbf, 0xff, 0x8, 0x7, 0xff, 0x5f, 0xa2, 0x3f,
+    0xe0, 0xc, 0x8e, 0xff, 0xf0, 0x80, 0x7f, 0xfd,
+    0xc0,
 
     /* U+0035 "5" */
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0xaf, 0xff, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x60, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xfe, 0xa6, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x4, 0x77,
-    0x77, 0x77, 0x78, 0xcf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfd, 0x49, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x80, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x4f, 0xff, 0xf3, 0x7, 0xff, 0xff, 0xd8, 0x67,
-    0xbf, 0xff, 0xfb, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x2, 0x8c,
-    0xef, 0xfd, 0x94, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xe0, 0xe8, 0x7, 0xff, 0x71,
+    0xdf, 0xfd, 0x60, 0x1e, 0x88, 0xff, 0x30, 0x7,
+    0xff, 0xfb, 0xff, 0xba, 0x98, 0x3, 0xff, 0x84,
+    0x2b, 0x3a, 0x60, 0x1f, 0xfc, 0x32, 0xc2, 0x0,
+    0x74, 0x47, 0xce, 0x60, 0x1b, 0xc0, 0x8, 0xef,
+    0xf4, 0x65, 0x0, 0x44, 0x80, 0x1f, 0xf2, 0xb8,
+    0x5, 0xa0, 0x1f, 0xfa, 0xc0, 0x22, 0x0, 0xff,
+    0xc4, 0x1, 0x38, 0x7, 0xff, 0x10, 0x52, 0x66,
+    0x30, 0xf, 0xf8, 0x4d, 0x9a, 0x40, 0xf, 0x88,
+    0x2, 0x73, 0x0, 0xac, 0x3, 0xeb, 0x0, 0x8d,
+    0x0, 0x23, 0x90, 0xe, 0x47, 0x0, 0xac, 0x20,
+    0x2, 0x6d, 0x86, 0x7b, 0xb0, 0x4, 0x86, 0xe,
+    0x80, 0x11, 0x3c, 0xc2, 0x0, 0x43, 0x40, 0x15,
+    0xb0, 0x7, 0xf1, 0xf8, 0x80, 0x69, 0xd7, 0x31,
+    0x0, 0x13, 0x5e, 0x8, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xb7, 0xcf, 0xfd,
-    0x93, 0x0, 0x0, 0x1, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0xe, 0xff, 0xff,
-    0x72, 0x0, 0x3a, 0xff, 0xff, 0x60, 0x5f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x9f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3,
-    0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf6, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf7, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf7, 0xbf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf5, 0x7f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf1, 0x1f, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xb0, 0x7, 0xff,
-    0xff, 0xd8, 0x66, 0x9f, 0xff, 0xff, 0x20, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x17, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0,
+    0x0, 0xfd, 0xbf, 0xf4, 0x0, 0x7f, 0xe6, 0x20,
+    0x0, 0xc0, 0x7, 0xfe, 0x80, 0xa, 0xc0, 0x3f,
+    0xf4, 0x8, 0x0, 0xd4, 0x3, 0xfe, 0x27, 0x0,
+    0xb8, 0x3, 0xff, 0x40, 0x4, 0xc4, 0x1, 0xff,
+    0x1a, 0x80, 0x6, 0x0, 0x3f, 0xf7, 0x80, 0x50,
+    0x20, 0x1f, 0xf2, 0x98, 0x0, 0x98, 0x3, 0xff,
+    0x58, 0x5, 0x20, 0x1f, 0xf9, 0xc4, 0x0, 0x87,
+    0x9f, 0xed, 0x93, 0x0, 0xe1, 0x80, 0x9, 0xa0,
+    0xc0, 0x4, 0xd9, 0x20, 0x1a, 0x40, 0x31, 0x0,
+    0x7c, 0xd4, 0x1, 0x30, 0x6, 0x8d, 0xff, 0x62,
+    0x80, 0x4a, 0xc0, 0xa2, 0x1, 0x6b, 0x90, 0x0,
+    0xe9, 0xc0, 0x2b, 0xc, 0x0, 0xa0, 0x80, 0x3d,
+    0x4, 0x0, 0x23, 0x50, 0x9, 0x80, 0x3f, 0x28,
+    0x4, 0xa4, 0x1, 0x8, 0x7, 0xed, 0x0, 0x84,
+    0xc0, 0x3f, 0xf1, 0x80, 0x66, 0x0, 0x8c, 0x3,
+    0xf7, 0x80, 0x45, 0x80, 0x14, 0x80, 0x7c, 0x2c,
+    0x1, 0x23, 0x0, 0x4b, 0x0, 0x1c, 0x38, 0x1,
+    0x20, 0x8a, 0x0, 0x27, 0xd8, 0x66, 0x4f, 0x10,
+    0x5, 0x20, 0x7, 0x50, 0x8, 0x9e, 0x64, 0xc0,
+    0x1a, 0xc8, 0x2, 0xa9, 0x0, 0xfe, 0x2c, 0x40,
+    0xe, 0x6e, 0x83, 0x10, 0x1, 0x2d, 0x69, 0x80,
+    0x40,
 
     /* U+0037 "7" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x4f, 0xff, 0xc7, 0x77, 0x77,
-    0x77, 0x7a, 0xff, 0xfd, 0x4f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf7, 0x4f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf1, 0x4f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xa0, 0x3a,
-    0xaa, 0x60, 0x0, 0x0, 0x0, 0xef, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0,
+    0x4f, 0xff, 0xfe, 0x27, 0x0, 0x7f, 0xf7, 0xe,
+    0x23, 0xf2, 0x80, 0x46, 0x1, 0x95, 0xdf, 0xf0,
+    0x80, 0x54, 0x1, 0xff, 0x89, 0x0, 0x26, 0x0,
+    0xff, 0xd4, 0x1, 0x28, 0xba, 0xad, 0xe0, 0x1f,
+    0x30, 0x5, 0x20, 0x75, 0x53, 0x0, 0x79, 0x84,
+    0x0, 0x66, 0x0, 0xff, 0xd4, 0x1, 0x50, 0x7,
+    0xfe, 0x33, 0x0, 0x5, 0x80, 0x3f, 0xf4, 0x80,
+    0x4c, 0x1, 0xff, 0x85, 0x40, 0x2a, 0x0, 0xff,
+    0xcc, 0x1, 0x21, 0x0, 0x7f, 0xe9, 0x0, 0xbc,
+    0x3, 0xff, 0x28, 0x80, 0x5, 0x0, 0x3f, 0xf4,
+    0x80, 0x52, 0x1, 0xff, 0x88, 0xc0, 0x26, 0x0,
+    0xff, 0xd6, 0x1, 0x28, 0x80, 0x7f, 0xe6, 0x0,
+    0xa4, 0x3, 0xff, 0x30, 0x4, 0x66, 0x0, 0xff,
+    0xd6, 0x1, 0x50, 0x7, 0xfe, 0x42, 0x0, 0xb,
+    0x0, 0x7f, 0xef, 0x0, 0x98, 0x3, 0xff, 0xa,
+    0x0, 0x54, 0x1, 0xff, 0xa4, 0x2, 0x42, 0x0,
+    0xfc,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x16, 0xbe, 0xfe, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x4, 0xff, 0xff, 0xd7, 0x55,
-    0x9f, 0xff, 0xfd, 0x0, 0xb, 0xff, 0xfa, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0x50, 0xf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0xf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0,
-    0xd, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x70, 0x6, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0x10, 0x0, 0xaf, 0xff, 0xc6, 0x44, 0x8f,
-    0xff, 0xf5, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x0, 0x2, 0x9f, 0xff,
-    0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x8, 0xff,
-    0xff, 0x72, 0x0, 0x4b, 0xff, 0xff, 0x20, 0x2f,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb0,
-    0x9f, 0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf2, 0xcf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf7, 0xcf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf6, 0x9f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf3, 0x4f, 0xff, 0xf6,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xd0, 0xb, 0xff,
-    0xff, 0xd8, 0x66, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x27, 0xce, 0xfe, 0xda, 0x50,
-    0x0, 0x0,
+    0x0, 0xc2, 0xd7, 0xdf, 0xdb, 0x48, 0x1, 0xf9,
+    0xba, 0x50, 0x40, 0x49, 0x6f, 0x8, 0x3, 0xa2,
+    0x40, 0x3f, 0x8f, 0x8, 0x2, 0x47, 0x0, 0x8a,
+    0x2a, 0x8c, 0x1, 0xf, 0x80, 0x5e, 0x1, 0x2e,
+    0xba, 0xaa, 0x74, 0x40, 0x4, 0xa0, 0x4, 0x0,
+    0xac, 0x3, 0x8a, 0x0, 0x2f, 0x1, 0x0, 0x8c,
+    0x40, 0x3c, 0x80, 0x10, 0x80, 0x80, 0x4e, 0x1,
+    0xff, 0x8, 0x0, 0x80, 0x8, 0x1, 0xf2, 0x0,
+    0x5a, 0x0, 0xb0, 0xa, 0x80, 0x38, 0xa0, 0x2,
+    0x60, 0x3, 0x28, 0x1, 0x71, 0x91, 0x11, 0xa2,
+    0x0, 0xa1, 0x0, 0xaa, 0x4, 0xe, 0x6e, 0xce,
+    0x0, 0x3c, 0x50, 0xe, 0x57, 0x0, 0xf8, 0xa8,
+    0xc0, 0x3a, 0x35, 0x80, 0x3e, 0x29, 0xe3, 0x0,
+    0xa1, 0xc0, 0x28, 0xdf, 0xf5, 0xa0, 0x0, 0x70,
+    0x80, 0x9c, 0x0, 0x3a, 0xe4, 0x0, 0x4b, 0x80,
+    0xa, 0x42, 0xc0, 0x28, 0x20, 0xf, 0x39, 0x80,
+    0x10, 0x94, 0x2, 0x60, 0xf, 0xd6, 0x1, 0x20,
+    0x80, 0x7f, 0xe1, 0x0, 0x84, 0x40, 0x11, 0x0,
+    0x7e, 0xe0, 0x8, 0x54, 0x2, 0xa0, 0xf, 0xcc,
+    0x1, 0x2e, 0x80, 0x4e, 0xc0, 0x1c, 0x38, 0x20,
+    0x2, 0x34, 0x40, 0x5, 0x3b, 0xc, 0xc9, 0xe3,
+    0x0, 0xa4, 0x1, 0x66, 0x1, 0x13, 0xcc, 0x98,
+    0x3, 0x42, 0x0, 0x58, 0xe0, 0x1f, 0xc3, 0x6e,
+    0x1, 0xd1, 0xb0, 0x62, 0x2, 0x4b, 0x5c, 0x80,
+    0x10,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x7, 0xff, 0xff, 0xd7, 0x56,
-    0x9f, 0xff, 0xfe, 0x10, 0x2f, 0xff, 0xf7, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0xa0, 0x7f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0xbf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf7,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf7, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf6, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf3, 0x3f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xe0, 0xb, 0xff, 0xff, 0x72,
-    0x0, 0x4b, 0xff, 0xff, 0x80, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x5b, 0xef, 0xfd, 0xaf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xc2, 0xf9, 0xdf, 0xed, 0xa5, 0x0, 0xfc,
+    0xfd, 0x6, 0x20, 0x2, 0x5a, 0xd2, 0x0, 0xea,
+    0x80, 0xf, 0xe2, 0xd4, 0x0, 0x9d, 0x40, 0x22,
+    0x8a, 0x96, 0x0, 0xd4, 0x20, 0x50, 0x1, 0x46,
+    0xba, 0xb4, 0xf1, 0x80, 0x6, 0xc1, 0x40, 0x25,
+    0x70, 0xe, 0x1d, 0x0, 0x94, 0x70, 0x2, 0x90,
+    0xf, 0x85, 0x80, 0x24, 0x60, 0x8, 0xc0, 0x3f,
+    0x78, 0x4, 0x40, 0x1f, 0xfc, 0x13, 0x0, 0xc2,
+    0x1, 0x8, 0x7, 0xed, 0x0, 0x85, 0x40, 0x26,
+    0x0, 0xfc, 0xa0, 0x12, 0xd0, 0x5, 0x4, 0x1,
+    0xe8, 0x20, 0x0, 0x99, 0x90, 0x2, 0xd7, 0x20,
+    0x2, 0x5b, 0x80, 0x4c, 0x0, 0xa1, 0x0, 0xa3,
+    0x7f, 0xd6, 0x80, 0x1a, 0x80, 0x3, 0xe6, 0x1,
+    0xff, 0x29, 0x0, 0x43, 0x94, 0x82, 0x0, 0x25,
+    0x0, 0xd0, 0x1, 0xe5, 0xbe, 0xff, 0x6b, 0x80,
+    0x4c, 0x40, 0x1f, 0xf3, 0x90, 0x0, 0x60, 0x3,
+    0xfe, 0x18, 0x0, 0xa0, 0x40, 0x3f, 0xe8, 0x0,
+    0x89, 0x80, 0x3f, 0xe2, 0x60, 0xa, 0x40, 0x3f,
+    0xf4, 0x80, 0x48, 0x80, 0xf, 0xf9, 0x50, 0x2,
+    0x90, 0xf, 0xfd, 0x0, 0x13, 0x10, 0x7, 0xfc,
+    0xe4, 0x0, 0x18, 0x0, 0xff, 0x86, 0x0, 0x29,
+    0x10, 0xf, 0x80,
 
     /* U+003A ":" */
-    0x3, 0xcf, 0xe9, 0x1, 0xff, 0xff, 0xf9, 0x5f,
-    0xff, 0xff, 0xe4, 0xff, 0xff, 0xfd, 0xc, 0xff,
-    0xff, 0x60, 0x6, 0x98, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x69, 0x83, 0x0, 0xcf, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0x90, 0x3c, 0xfe, 0x90,
+    0x3, 0xcf, 0xe9, 0x1, 0xc3, 0x1, 0x69, 0x40,
+    0xe, 0x71, 0x0, 0xe3, 0x43, 0x0, 0xd6, 0x19,
+    0x2c, 0xf8, 0xc0, 0x6, 0x98, 0x30, 0xf, 0xff,
+    0x43, 0x4c, 0x18, 0x3, 0x25, 0x9f, 0x19, 0xc,
+    0x3, 0x58, 0x80, 0x71, 0xa0, 0x7, 0x38, 0xe1,
+    0x80, 0xb4, 0x80,
 
     /* U+003B ";" */
-    0x3, 0xcf, 0xea, 0x10, 0x1f, 0xff, 0xff, 0xa0,
-    0x5f, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff, 0xe0,
-    0xd, 0xff, 0xff, 0x70, 0x0, 0x7a, 0x95, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x60,
-    0x4, 0xff, 0xff, 0x20, 0x7, 0xff, 0xfe, 0x0,
-    0xa, 0xff, 0xfa, 0x0, 0xd, 0xff, 0xf6, 0x0,
-    0xf, 0xff, 0xf2, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x5f, 0xff, 0xb0, 0x0, 0x8f, 0xff, 0x70, 0x0,
-    0xbf, 0xff, 0x30, 0x0, 0xdf, 0xfe, 0x0, 0x0,
+    0x3, 0xcf, 0xea, 0x10, 0x1c, 0x30, 0x15, 0xb0,
+    0x40, 0xe, 0x50, 0x10, 0xe, 0x10, 0x42, 0x0,
+    0xd2, 0x0, 0xd8, 0x56, 0xa7, 0x0, 0x9e, 0xa5,
+    0x40, 0x3f, 0xfe, 0xe3, 0xff, 0x98, 0x0, 0xa0,
+    0x19, 0x0, 0x6, 0x1, 0x9, 0x0, 0x34, 0x2,
+    0x40, 0x9, 0xc0, 0x2c, 0x0, 0x88, 0x2, 0x40,
+    0x1, 0x80, 0x42, 0x40, 0x6, 0x0, 0x94, 0x2,
+    0xd0, 0xb, 0x0, 0x23, 0x0, 0x90, 0x2, 0x60,
+    0x0, 0x98, 0x4,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xcb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x7, 0xef, 0xff,
-    0xff, 0xb4, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x0, 0x18, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7e, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x47,
+    0x0, 0xff, 0xe2, 0x10, 0x7, 0xff, 0x9, 0x72,
+    0x40, 0x3f, 0xf2, 0xed, 0x18, 0x7, 0xfc, 0xdb,
+    0x44, 0x1, 0xff, 0x37, 0x49, 0x0, 0x47, 0xe0,
+    0x1e, 0x7e, 0x91, 0x0, 0x92, 0xf1, 0x0, 0x21,
+    0x8e, 0x81, 0x0, 0x97, 0x2d, 0x0, 0x21, 0x8e,
+    0x71, 0x0, 0x97, 0x68, 0xc0, 0x3b, 0x9c, 0x3,
+    0x37, 0x51, 0x0, 0x78, 0x40, 0x21, 0x8e, 0x91,
+    0x0, 0xff, 0xcc, 0xa2, 0x1, 0xff, 0xc2, 0x7d,
+    0xb3, 0x0, 0xfe, 0x17, 0x0, 0xc9, 0x98, 0x40,
+    0xf, 0xd1, 0xd0, 0x20, 0x11, 0xde, 0xa8, 0x7,
+    0xc2, 0xfd, 0x2, 0x1, 0x15, 0x6b, 0x0, 0x7e,
+    0x7e, 0x91, 0x0, 0x8a, 0x79, 0xc0, 0x3f, 0x37,
+    0x49, 0x0, 0x43, 0x16, 0x1, 0xfc, 0xdb, 0x44,
+    0x1, 0xff, 0xc3, 0x5d, 0xb3, 0x0, 0xff, 0xe1,
+    0xa6, 0x5e, 0x0,
 
     /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xff, 0xff, 0xe1, 0xc8, 0x7, 0xff, 0x52, 0x1d,
+    0xff, 0xf8, 0x5a, 0xf1, 0x1f, 0xfc, 0x24, 0x0,
+    0xff, 0xf2, 0x3c, 0x47, 0xff, 0x9, 0x21, 0xdf,
+    0xff, 0x85, 0xa0, 0x1f, 0xfd, 0x40,
 
     /* U+003E ">" */
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x6, 0xef, 0xff, 0xff, 0xc5, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x18, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x2, 0x0, 0xff, 0xe1, 0x8e, 0xd1, 0x0, 0x7f,
+    0xf0, 0xd7, 0x68, 0xc0, 0x3f, 0xf8, 0x6b, 0x96,
+    0x60, 0x1f, 0xc2, 0xc0, 0x19, 0x32, 0xd0, 0x3,
+    0xf4, 0xf3, 0x80, 0x64, 0xbc, 0x40, 0xf, 0x86,
+    0x3a, 0x4, 0x2, 0x3b, 0xc5, 0x0, 0xf8, 0x5f,
+    0xa4, 0x40, 0x23, 0xad, 0x50, 0xf, 0xcd, 0xd2,
+    0x40, 0x11, 0x55, 0x0, 0x3f, 0x9b, 0x68, 0xc0,
+    0x21, 0x0, 0xff, 0x97, 0xd0, 0x3, 0xff, 0x82,
+    0xb9, 0x84, 0x0, 0xff, 0x9b, 0x68, 0xc0, 0x22,
+    0xf0, 0xf, 0x37, 0x49, 0x0, 0x47, 0x5a, 0x80,
+    0x19, 0xfa, 0x44, 0x2, 0x3b, 0xc5, 0x0, 0x86,
+    0x3e, 0x4, 0x2, 0x4c, 0xc2, 0x0, 0x77, 0x38,
+    0x6, 0x4c, 0xb3, 0x0, 0xf0, 0x80, 0x65, 0xdb,
+    0x30, 0xf, 0xf9, 0xb6, 0x88, 0x3, 0xfe, 0x6e,
+    0x92, 0x0, 0xff, 0xc0,
 
     /* U+003F "?" */
-    0x9f, 0xff, 0xff, 0xdc, 0x71, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x59, 0x99, 0x99,
-    0xbf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0, 0x4, 0x44,
-    0x6a, 0xff, 0xff, 0xc0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x0, 0xe, 0xff, 0xfe, 0xc6, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x77, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    0x9f, 0xfe, 0xdc, 0x71, 0x0, 0xff, 0x11, 0xc7,
+    0x40, 0x7, 0xff, 0x5, 0xec, 0x1, 0x8c, 0xdc,
+    0x80, 0x19, 0x20, 0x16, 0x67, 0xaf, 0x94, 0x2,
+    0x72, 0x0, 0xf8, 0x69, 0x0, 0x25, 0x0, 0xfe,
+    0xf0, 0xb, 0x40, 0x3f, 0x98, 0x2, 0x10, 0xf,
+    0xe1, 0x0, 0x84, 0x3, 0xfa, 0xc0, 0x22, 0x0,
+    0xfc, 0x8e, 0x1, 0x58, 0x4, 0x89, 0x35, 0x58,
+    0x4, 0x66, 0x0, 0xaa, 0xed, 0x2a, 0x1, 0xb8,
+    0x3, 0xfe, 0x1c, 0x20, 0xf, 0xc2, 0x73, 0xc6,
+    0x1, 0xf9, 0x3b, 0x18, 0x3, 0xff, 0xaf, 0xdd,
+    0x58, 0x7, 0xfc, 0x22, 0x0, 0xff, 0xe6, 0xab,
+    0xb8, 0xc0, 0x3f, 0xa6, 0xa2, 0x18, 0xa0, 0x1f,
+    0x9c, 0x3, 0x78, 0x7, 0xe3, 0x0, 0xc4, 0x1,
+    0xfb, 0x88, 0x0, 0x92, 0x1, 0xe0,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x6a, 0xdf, 0xfe, 0xc9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfe, 0xef, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x9f,
-    0xff, 0xd5, 0x10, 0x0, 0x28, 0xff, 0xfd, 0x0,
-    0x4, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe0, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x5f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf5,
-    0x7f, 0xfd, 0x0, 0x0, 0x3, 0xbe, 0xfd, 0x70,
-    0xff, 0xf5, 0x9f, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf9, 0xff, 0xf6, 0x9f, 0xfb, 0x0, 0x0,
-    0xdf, 0xff, 0xb8, 0xcf, 0xff, 0xf6, 0x9f, 0xfb,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x9, 0xff, 0xf6,
-    0x9f, 0xfb, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xf6, 0x9f, 0xfb, 0x0, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xf6, 0x9f, 0xfb, 0x0, 0x8,
-    0xff, 0xb0, 0x0, 0x0, 0xff, 0xf6, 0x9f, 0xfb,
-    0x0, 0x8, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xf6,
-    0x9f, 0xfb, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0,
-    0xff, 0xf6, 0x9f, 0xfb, 0x0, 0x7, 0xff, 0xb0,
-    0x0, 0x0, 0xff, 0xf5, 0x9f, 0xfb, 0x0, 0x7,
-    0xff, 0xd0, 0x0, 0x0, 0xff, 0xf5, 0x9f, 0xfb,
-    0x0, 0x4, 0xff, 0xf2, 0x0, 0x5, 0xff, 0xf2,
-    0x9f, 0xfb, 0x0, 0x0, 0xef, 0xfc, 0x30, 0x4e,
-    0xff, 0xd0, 0x9f, 0xfb, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x9f, 0xfc, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x7f, 0xfd,
-    0x0, 0x0, 0x0, 0x16, 0x9a, 0x95, 0x0, 0x0,
-    0x5f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfa, 0x52, 0x11, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x59, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0xf3, 0x56, 0xff, 0xbb, 0x24, 0xc0, 0x3f,
+    0x9b, 0xe5, 0x48, 0x0, 0x26, 0xd9, 0x62, 0x1,
+    0xea, 0x90, 0xc, 0x22, 0x0, 0xc9, 0xe4, 0x1,
+    0xa5, 0x40, 0x5, 0x5d, 0xd7, 0xeb, 0x80, 0x7,
+    0xc0, 0x24, 0x60, 0x2, 0x6a, 0x88, 0x4, 0x51,
+    0x80, 0x2, 0x80, 0x7, 0x80, 0xa, 0xc0, 0x3f,
+    0x1c, 0x0, 0x18, 0x5, 0x0, 0x16, 0x1, 0xfe,
+    0x50, 0x0, 0x92, 0x0, 0x4c, 0x1, 0xfe, 0x20,
+    0x9, 0xc8, 0x0, 0x40, 0x1c, 0x77, 0xdf, 0xae,
+    0x1, 0xdc, 0x0, 0x10, 0xc, 0x78, 0x82, 0x5,
+    0x12, 0x1, 0x18, 0x4, 0xe0, 0x1b, 0x80, 0x24,
+    0x73, 0x60, 0xf, 0xf8, 0xc8, 0x1, 0x37, 0x18,
+    0xc0, 0x1f, 0xf2, 0x80, 0x5, 0x80, 0x28, 0x0,
+    0xff, 0x84, 0x0, 0x40, 0x18, 0x40, 0x3f, 0xef,
+    0x0, 0x38, 0x7, 0xff, 0xb3, 0xc0, 0x3f, 0xe3,
+    0x0, 0xff, 0x30, 0x7, 0xff, 0x10, 0xc0, 0x4,
+    0x40, 0x9, 0x40, 0x27, 0x0, 0xf9, 0x4, 0x1,
+    0xc6, 0x9, 0x60, 0x2, 0x20, 0x7, 0xeb, 0x0,
+    0x1e, 0x7d, 0x88, 0x3, 0x80, 0x33, 0x80, 0x65,
+    0x90, 0xf, 0xd, 0x98, 0x70, 0x0, 0x40, 0x39,
+    0xba, 0x59, 0x5a, 0xb9, 0x0, 0x4, 0x0, 0x21,
+    0x0, 0xe1, 0x69, 0xa9, 0x50, 0xc, 0x80, 0x13,
+    0x0, 0x7f, 0xf0, 0xc5, 0x0, 0x10, 0x40, 0x1f,
+    0xfc, 0x38, 0x0, 0xb0, 0xc0, 0x3f, 0xf8, 0x47,
+    0x0, 0x1, 0xca, 0x52, 0x11, 0xc0, 0x1f, 0x9d,
+    0xc0, 0x12, 0xd6, 0xf7, 0x6a, 0x0, 0xfd, 0x16,
+    0x40, 0x1f, 0xfc, 0x64, 0xda, 0x62, 0x0, 0xff,
+    0x80,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf8, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0xbf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf1, 0x8f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xa0, 0xf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0xc,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x20, 0x8, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfe, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfa, 0x0, 0x1, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xfd, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf2,
-    0x0, 0x0, 0x9f, 0xff, 0x10, 0x0, 0x0, 0xc,
-    0xff, 0xe0, 0x0, 0x0, 0x5f, 0xff, 0x50, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xcf,
-    0xff, 0x33, 0x33, 0x33, 0x38, 0xff, 0xf6, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfa, 0x0, 0x4, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfe, 0x0, 0x8, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x20, 0xd, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x70,
-    0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xb0, 0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0,
+    0x0, 0xfb, 0xbf, 0xf3, 0x80, 0x7f, 0xf0, 0x48,
+    0x40, 0x36, 0x0, 0x7f, 0xf0, 0x50, 0x3, 0x90,
+    0x3, 0xff, 0x83, 0x80, 0x2, 0x0, 0x90, 0x3,
+    0xff, 0x20, 0x1, 0x44, 0x1, 0x80, 0x1f, 0xf1,
+    0x8, 0x3, 0x54, 0x0, 0x80, 0x1f, 0xf2, 0x0,
+    0x48, 0x60, 0x3, 0x0, 0xff, 0xb4, 0x0, 0x22,
+    0xc0, 0x9, 0x0, 0x3f, 0xca, 0x0, 0x40, 0x40,
+    0xb, 0x0, 0x3f, 0x8c, 0x40, 0x18, 0x0, 0x30,
+    0x2, 0x80, 0x7f, 0x20, 0x4, 0x80, 0x4, 0x0,
+    0x10, 0x80, 0x7e, 0xc0, 0x0, 0x90, 0x3, 0x40,
+    0x24, 0x0, 0xfc, 0x80, 0x4, 0x0, 0x90, 0x2,
+    0xc0, 0xf, 0x8c, 0x2, 0xc0, 0x8, 0x48, 0x0,
+    0x80, 0x1f, 0x20, 0x4, 0x80, 0x19, 0x0, 0x4,
+    0x20, 0x1e, 0xb0, 0x0, 0x90, 0x6, 0xc0, 0x9,
+    0x0, 0x3c, 0x60, 0x1, 0xff, 0xea, 0x0, 0xbc,
+    0x3, 0x90, 0x3, 0xff, 0x82, 0x80, 0x1d, 0x80,
+    0x1f, 0xfc, 0x11, 0x20, 0xc, 0x80, 0x16, 0x67,
+    0xce, 0x1, 0x20, 0x6, 0x30, 0x1, 0x9f, 0xea,
+    0x0, 0xb0, 0x2, 0x40, 0x9, 0x0, 0x3e, 0x21,
+    0x0, 0x20, 0x5, 0x80, 0x16, 0x80, 0x7e, 0x50,
+    0x0, 0x90, 0x1, 0x40, 0x24, 0x0, 0xfd, 0x80,
+    0x12, 0x80, 0x90, 0x0, 0x84, 0x3, 0xf2, 0x0,
+    0x58, 0x8, 0x1, 0x38, 0x7, 0xf1, 0x80, 0x48,
+    0x0,
 
     /* U+0042 "B" */
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0xf, 0xff, 0xe5, 0x55, 0x56, 0xaf, 0xff,
-    0xff, 0x10, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xf7, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xa0, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0xf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf7, 0xf, 0xff, 0xd0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0x10, 0xff, 0xfe, 0x33,
-    0x33, 0x48, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x60, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0xff,
-    0xfd, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xe1, 0xf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa0,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf5, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x2f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xe0, 0xff, 0xfe, 0x55, 0x55, 0x58,
-    0xdf, 0xff, 0xf6, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x82, 0x0, 0x0,
+    0xff, 0xfe, 0xda, 0x60, 0xf, 0xfe, 0x11, 0x2c,
+    0xf2, 0x0, 0x7f, 0xf0, 0xc6, 0xd4, 0x3, 0x86,
+    0xab, 0x4a, 0x80, 0x6a, 0x10, 0xc, 0x6a, 0xb9,
+    0xab, 0x44, 0x2, 0x60, 0xf, 0xf8, 0xa0, 0x2,
+    0xd0, 0xf, 0xfc, 0xe0, 0x13, 0x0, 0x7f, 0xf1,
+    0x1c, 0x3, 0xff, 0x20, 0x5, 0x80, 0x1f, 0xf0,
+    0xc0, 0x4, 0xc0, 0x18, 0xcf, 0x92, 0x38, 0x80,
+    0x16, 0x20, 0x18, 0x73, 0x35, 0xb8, 0x0, 0xf1,
+    0x0, 0x3f, 0xf8, 0x27, 0x46, 0x1, 0xff, 0xc2,
+    0x39, 0xd2, 0x0, 0xe2, 0xff, 0xec, 0x50, 0x1,
+    0x60, 0x80, 0x7f, 0x8e, 0xa0, 0x0, 0x36, 0x1,
+    0xff, 0x9c, 0x80, 0xa, 0x20, 0x1f, 0xf9, 0x40,
+    0x25, 0x0, 0xff, 0xde, 0x1, 0x10, 0x7, 0xfe,
+    0xe0, 0x8, 0xc0, 0x3f, 0xf3, 0x80, 0x4e, 0x1,
+    0xff, 0x50, 0x80, 0x4, 0x80, 0x23, 0x55, 0xe8,
+    0xd5, 0x0, 0xa0, 0x3, 0xd, 0x57, 0x39, 0x0,
+    0x4a, 0xc0, 0x1f, 0xfc, 0x27, 0xa0, 0xf, 0xf8,
+    0x4d, 0xf6, 0x0, 0x20,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x6a, 0xef, 0xfe, 0xb6, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0xef, 0xff, 0xfa, 0x77, 0x9f, 0xff,
-    0xff, 0x10, 0x7f, 0xff, 0xe2, 0x0, 0x0, 0x1c,
-    0xff, 0xf9, 0xc, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xe0, 0xef, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x5, 0x77, 0x70, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x57,
-    0x77, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf0, 0xcf, 0xff, 0x40, 0x0, 0x0, 0x2,
-    0xff, 0xfe, 0x7, 0xff, 0xfe, 0x20, 0x0, 0x1,
-    0xcf, 0xff, 0x90, 0xe, 0xff, 0xff, 0xa7, 0x79,
-    0xff, 0xff, 0xf2, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x6, 0xae,
-    0xff, 0xeb, 0x60, 0x0, 0x0,
+    0x0, 0xcd, 0x5d, 0xfe, 0xeb, 0x60, 0xf, 0x8f,
+    0xa5, 0x44, 0x0, 0x29, 0x3c, 0x80, 0x19, 0x30,
+    0x40, 0x3f, 0xd, 0xa8, 0x5, 0x40, 0x19, 0x62,
+    0xc, 0x1, 0xa8, 0x41, 0xc4, 0x0, 0x3b, 0x4e,
+    0xe9, 0xe3, 0x0, 0xa0, 0x2c, 0x2, 0xa2, 0x0,
+    0xc3, 0xc0, 0x13, 0x81, 0x0, 0x48, 0x1, 0xe2,
+    0x20, 0x0, 0x40, 0x40, 0x2, 0x1, 0xfa, 0x23,
+    0x0, 0x7f, 0xf0, 0x55, 0xde, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0x8a, 0xef,
+    0x0, 0x80, 0x4, 0x3, 0xf4, 0x46, 0x2, 0x0,
+    0x90, 0x3, 0xc4, 0x40, 0x0, 0x85, 0x80, 0x54,
+    0x40, 0x18, 0x78, 0x2, 0x70, 0x71, 0x0, 0xe,
+    0xd3, 0xba, 0x78, 0xc0, 0x2b, 0x0, 0x50, 0x6,
+    0x58, 0x83, 0x0, 0x6a, 0x20, 0x2, 0x60, 0x80,
+    0x7e, 0x1a, 0x50, 0xc, 0x7d, 0x2a, 0x20, 0x1,
+    0x49, 0xe5, 0x0, 0x80,
 
     /* U+0044 "D" */
-    0xf, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0x20, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xfe, 0x77, 0x77, 0x9d, 0xff,
-    0xff, 0x90, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x20, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf8, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xb0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfd, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xd0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfd, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xd0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xd0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfd, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xd0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x80, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf2, 0xf, 0xff, 0xe7, 0x77, 0x79,
-    0xef, 0xff, 0xf9, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x71, 0x0, 0x0,
+    0xf, 0xff, 0xdd, 0x8e, 0x40, 0x1f, 0xfc, 0x11,
+    0x38, 0xd8, 0x0, 0xff, 0xe2, 0x3e, 0x0, 0x78,
+    0x62, 0x33, 0x10, 0x4, 0x72, 0x1, 0xe7, 0x7d,
+    0x3a, 0xe0, 0x13, 0x10, 0x7, 0xfd, 0xa, 0x1,
+    0x50, 0x7, 0xfe, 0x90, 0x8, 0xc0, 0x3f, 0xf1,
+    0x0, 0x4c, 0x1, 0xff, 0x84, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xe3, 0x88, 0x7,
+    0xff, 0x10, 0x80, 0x26, 0x0, 0xff, 0xd2, 0x1,
+    0x18, 0x7, 0xfd, 0xa, 0x1, 0x50, 0x7, 0x3b,
+    0xe9, 0xe7, 0x0, 0x98, 0x80, 0x30, 0xc4, 0x66,
+    0x10, 0x9, 0x24, 0x3, 0xff, 0x84, 0xf6, 0x1,
+    0xff, 0x9, 0xc7, 0x40, 0x4,
 
     /* U+0045 "E" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x9f, 0xff, 0x87, 0x77, 0x77, 0x77, 0x77, 0x75,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x75, 0x55, 0x55, 0x55, 0x55, 0x20,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x86, 0x66, 0x66, 0x66, 0x66, 0x65,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x9f, 0xff, 0xfe, 0x16, 0x80, 0x7f, 0xf6, 0x1e,
+    0x23, 0xfe, 0x0, 0xd6, 0xef, 0xfe, 0x50, 0xf,
+    0xff, 0xf8, 0x7, 0xf2, 0x2a, 0xff, 0x10, 0x7,
+    0x45, 0x57, 0xf5, 0x80, 0x7f, 0xf6, 0x73, 0xff,
+    0xfa, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0xeb,
+    0x66, 0xff, 0x28, 0x6, 0x79, 0x9f, 0xf4, 0x0,
+    0x7f, 0xf5, 0x0,
 
     /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1d, 0xff, 0xf8, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x80, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf9,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xfe, 0x18, 0x80, 0x7f, 0xf6, 0x9d,
+    0xff, 0xf0, 0x80, 0x68, 0x8f, 0xfc, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xea, 0x4c, 0xff, 0xc2, 0x1,
+    0xcc, 0xdf, 0xf1, 0x80, 0x7f, 0xf6, 0xfb, 0xff,
+    0xfc, 0x40, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0x24,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x6, 0xbe, 0xff, 0xea, 0x60, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x2f, 0xff, 0xff, 0xa7, 0x8a, 0xff,
-    0xff, 0xf1, 0x9, 0xff, 0xfc, 0x10, 0x0, 0x2,
-    0xdf, 0xff, 0x70, 0xef, 0xff, 0x20, 0x0, 0x0,
-    0x4, 0xff, 0xfc, 0xf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x22, 0x22, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x5, 0x66, 0x66, 0x66, 0x66, 0x2f, 0xff,
-    0xc0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xf2, 0xff,
-    0xfc, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xc0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xf2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfd, 0xe, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xb0, 0x9f, 0xff, 0xc1, 0x0, 0x0,
-    0x2e, 0xff, 0xf6, 0x2, 0xff, 0xff, 0xe9, 0x66,
-    0xaf, 0xff, 0xfd, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x7b,
-    0xef, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0xe6, 0xbe, 0xff, 0x75, 0x30, 0x7, 0xcb,
+    0xd2, 0x82, 0x0, 0x15, 0x9e, 0x40, 0xc, 0xd4,
+    0x20, 0x1f, 0x86, 0xd0, 0x0, 0x52, 0x1, 0x96,
+    0x1d, 0x40, 0x35, 0x88, 0x58, 0x4, 0x7d, 0x4f,
+    0x15, 0xa4, 0x1, 0x30, 0x38, 0x5, 0xc2, 0x1,
+    0x8a, 0x40, 0x2b, 0x1, 0x0, 0x11, 0x0, 0x3c,
+    0x80, 0x11, 0x8, 0x4, 0x20, 0x1f, 0xb7, 0x6c,
+    0x30, 0xf, 0xfc, 0x45, 0x80, 0x3f, 0xfb, 0xca,
+    0xcd, 0xf8, 0x3, 0xf4, 0x4c, 0xfe, 0x0, 0xff,
+    0xef, 0x6f, 0xfe, 0x10, 0xf, 0xfe, 0xc9, 0x80,
+    0x7f, 0xe1, 0x0, 0x84, 0x2, 0x10, 0xf, 0xf8,
+    0x80, 0x40, 0x4, 0x40, 0xf, 0x28, 0x4, 0xc0,
+    0xe0, 0x17, 0x8, 0x6, 0x2b, 0x0, 0xb4, 0x2c,
+    0x2, 0x3f, 0x96, 0x65, 0x68, 0x80, 0x9, 0x80,
+    0xa4, 0x2, 0x16, 0x99, 0x28, 0x6, 0xf0, 0x9,
+    0xa8, 0x3, 0xf8, 0xb4, 0x80, 0x32, 0xfc, 0x20,
+    0x80, 0x5, 0x6b, 0x48, 0x0,
 
     /* U+0048 "H" */
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0x77, 0x77, 0x77, 0x7a, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8,
+    0xff, 0xc0, 0x1f, 0x2f, 0xfd, 0x0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xb, 0xff,
+    0xea, 0x0, 0xff, 0xee, 0x44, 0x7c, 0xa0, 0x1f,
+    0x9d, 0xfe, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0x84,
 
     /* U+0049 "I" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x38, 0x88, 0x89, 0xff, 0xfe, 0x88, 0x88, 0x80,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x38, 0x88, 0x89, 0xff, 0xfe, 0x88, 0x88, 0x80,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x7f, 0xff, 0xfe, 0x10, 0x80, 0x7f, 0xf5, 0x11,
+    0xdf, 0x30, 0x4, 0x2e, 0xfc, 0x27, 0x11, 0xa8,
+    0x2, 0x28, 0x8e, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfe, 0x43,
+    0x88, 0xd4, 0x1, 0x14, 0x47, 0x2, 0x3b, 0xe6,
+    0x0, 0x85, 0xdf, 0x84, 0x3, 0xff, 0xa8,
 
     /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf1, 0x8e, 0xee, 0x30, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf1, 0x8f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x5f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xc0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0x70, 0x7, 0xff,
-    0xff, 0xd8, 0x67, 0xaf, 0xff, 0xfe, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0,
+    0x0, 0xff, 0xe0, 0xe7, 0xfc, 0x20, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xe8, 0xee, 0x8c, 0x3, 0xff,
+    0x84, 0x23, 0x28, 0x7, 0xe3, 0x0, 0x87, 0x40,
+    0x2a, 0x0, 0xf9, 0x40, 0x23, 0x5, 0x0, 0x8e,
+    0x0, 0x38, 0xec, 0x2, 0xb0, 0x4, 0x0, 0x4f,
+    0xb0, 0xcf, 0x58, 0x20, 0x1, 0x70, 0x3, 0xa0,
+    0x4, 0x4f, 0x30, 0xa0, 0x1b, 0x40, 0x35, 0xb0,
+    0x7, 0xf1, 0x61, 0x80, 0x74, 0xeb, 0x98, 0x80,
+    0x9, 0x6b, 0x4c, 0x2,
 
     /* U+004B "K" */
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x40, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfc, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf4, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xc0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x40, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0xdf, 0xff, 0x40,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x5, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x55, 0x5b, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x2, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0xaf, 0xff, 0xb0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff, 0xf3,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0xa, 0xff,
-    0xfa, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x20, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xa0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfa, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x90, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf1,
+    0xff, 0xb8, 0x3, 0xf3, 0xff, 0xd8, 0x1, 0xff,
+    0xc1, 0x90, 0xa, 0x0, 0x3f, 0xf3, 0x8, 0x0,
+    0xd0, 0x3, 0xff, 0x40, 0x5, 0x0, 0x1f, 0xf9,
+    0x84, 0x0, 0x68, 0x1, 0xff, 0xa0, 0x2, 0x80,
+    0xf, 0xfc, 0xc2, 0x0, 0x34, 0x0, 0xff, 0xd6,
+    0x1, 0x40, 0x7, 0xfe, 0x52, 0x0, 0x1a, 0x0,
+    0x7f, 0xe8, 0x0, 0xa0, 0x3, 0xff, 0x29, 0x0,
+    0xd, 0x0, 0x3f, 0xf, 0xfd, 0x40, 0x14, 0x80,
+    0x7f, 0xf1, 0x5, 0x40, 0x3f, 0xf8, 0x82, 0x60,
+    0x1f, 0xea, 0xa9, 0x0, 0x28, 0x0, 0xfe, 0x15,
+    0x5a, 0x40, 0x24, 0x30, 0xf, 0xfc, 0x4a, 0x1,
+    0x40, 0x7, 0xff, 0x6, 0x0, 0x24, 0x30, 0xf,
+    0xfc, 0x4a, 0x1, 0x48, 0x7, 0xff, 0x6, 0x40,
+    0x25, 0x20, 0xf, 0xfc, 0x68, 0x1, 0x40, 0x7,
+    0xff, 0x6, 0x0, 0x25, 0x20, 0xf, 0xfc, 0x68,
+    0x1, 0x40, 0x7, 0xff, 0x7, 0xc0, 0x25, 0x20,
+    0xf, 0xfc, 0x86, 0x1, 0x58, 0x7, 0xff, 0x6,
+    0x0, 0x26, 0x10,
 
     /* U+004C "L" */
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xb8, 0x88, 0x88, 0x88, 0x88, 0x87,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0x7f, 0xf9, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xcf, 0xb1, 0x1f, 0xe7, 0x0, 0xc8, 0xef,
+    0xfe, 0x90, 0xf, 0xfe, 0xa0,
 
     /* U+004D "M" */
-    0xbf, 0xff, 0xfb, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf5, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf5, 0xbf, 0xfd, 0xff, 0x40, 0x0, 0xc,
-    0xfe, 0xdf, 0xf5, 0xbf, 0xfa, 0xff, 0x90, 0x0,
-    0xf, 0xfa, 0xef, 0xf5, 0xbf, 0xf8, 0xef, 0xd0,
-    0x0, 0x5f, 0xf5, 0xff, 0xf5, 0xbf, 0xf9, 0x9f,
-    0xf2, 0x0, 0x9f, 0xf1, 0xff, 0xf5, 0xbf, 0xfa,
-    0x5f, 0xf6, 0x0, 0xef, 0xc1, 0xff, 0xf5, 0xbf,
-    0xfb, 0xf, 0xfb, 0x3, 0xff, 0x71, 0xff, 0xf5,
-    0xbf, 0xfc, 0xb, 0xff, 0x7, 0xff, 0x22, 0xff,
-    0xf5, 0xbf, 0xfd, 0x6, 0xff, 0x4c, 0xfd, 0x3,
-    0xff, 0xf5, 0xbf, 0xfe, 0x2, 0xff, 0x9f, 0xf8,
-    0x4, 0xff, 0xf5, 0xbf, 0xfe, 0x0, 0xdf, 0xff,
-    0xf4, 0x4, 0xff, 0xf5, 0xbf, 0xfe, 0x0, 0x8f,
-    0xff, 0xf0, 0x5, 0xff, 0xf5, 0xbf, 0xfe, 0x0,
-    0x3f, 0xff, 0xa0, 0x5, 0xff, 0xf5, 0xbf, 0xfe,
-    0x0, 0x8, 0x99, 0x30, 0x5, 0xff, 0xf5, 0xbf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5,
-    0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf5, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf5, 0xbf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xbf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf5, 0xbf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0xbf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0xbf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5,
-    0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf5, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5,
+    0xbf, 0xfd, 0x60, 0x1c, 0x5f, 0xfc, 0xa0, 0x1c,
+    0x80, 0x1c, 0xa0, 0x1f, 0xc4, 0x0, 0x40, 0xd,
+    0x60, 0x24, 0x1, 0xe7, 0x0, 0x68, 0x6, 0x30,
+    0x43, 0x0, 0xf1, 0x8, 0x20, 0x4, 0xa0, 0xf,
+    0x10, 0xf, 0xb, 0x81, 0x10, 0x1, 0x80, 0x4,
+    0x0, 0xf8, 0xf0, 0x0, 0x80, 0x7, 0x3, 0x0,
+    0xfc, 0x2a, 0x0, 0xd0, 0x31, 0xb, 0x0, 0xfc,
+    0xe0, 0x80, 0x80, 0x80, 0x5, 0x30, 0xf, 0x84,
+    0x34, 0x0, 0x96, 0x4, 0x41, 0x0, 0xf8, 0xc1,
+    0x0, 0x1a, 0x60, 0xa0, 0xe0, 0x1f, 0xc4, 0x40,
+    0x60, 0x6, 0x0, 0x7f, 0xe5, 0x0, 0xc8, 0x2,
+    0x1, 0xfe, 0xb0, 0x9, 0x40, 0x3f, 0xf8, 0x26,
+    0xec, 0xc9, 0x0, 0xff, 0x8, 0x5, 0x13, 0x23,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfb, 0x20,
 
     /* U+004E "N" */
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xb1, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xef,
-    0xfb, 0x1f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xe,
-    0xff, 0xb1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xef, 0xfb, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xe, 0xff, 0xb1, 0xff, 0xfa, 0xff, 0xc0, 0x0,
-    0x0, 0xef, 0xfb, 0x1f, 0xff, 0x6f, 0xff, 0x20,
-    0x0, 0xe, 0xff, 0xb1, 0xff, 0xf5, 0xbf, 0xf7,
-    0x0, 0x0, 0xef, 0xfb, 0x1f, 0xff, 0x66, 0xff,
-    0xd0, 0x0, 0xe, 0xff, 0xb1, 0xff, 0xf7, 0x1f,
-    0xff, 0x30, 0x0, 0xef, 0xfb, 0x1f, 0xff, 0x70,
-    0xaf, 0xf8, 0x0, 0xe, 0xff, 0xb1, 0xff, 0xf8,
-    0x5, 0xff, 0xe0, 0x0, 0xef, 0xfb, 0x1f, 0xff,
-    0x80, 0xf, 0xff, 0x40, 0xe, 0xff, 0xb1, 0xff,
-    0xf8, 0x0, 0xaf, 0xf9, 0x0, 0xef, 0xfb, 0x1f,
-    0xff, 0x80, 0x4, 0xff, 0xe0, 0xe, 0xff, 0xb1,
-    0xff, 0xf8, 0x0, 0xe, 0xff, 0x50, 0xef, 0xfb,
-    0x1f, 0xff, 0x80, 0x0, 0x9f, 0xfa, 0xd, 0xff,
-    0xb1, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xf0, 0xcf,
-    0xfb, 0x1f, 0xff, 0x80, 0x0, 0xd, 0xff, 0x6b,
-    0xff, 0xb1, 0xff, 0xf8, 0x0, 0x0, 0x8f, 0xfb,
-    0xaf, 0xfb, 0x1f, 0xff, 0x80, 0x0, 0x2, 0xff,
-    0xfb, 0xff, 0xb1, 0xff, 0xf8, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xfb, 0x1f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xb1, 0xff, 0xf8, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xb1, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xfb,
+    0x1f, 0xfe, 0x0, 0xfb, 0xbf, 0xd6, 0x1, 0xe5,
+    0x0, 0xff, 0xe2, 0x70, 0x7, 0xff, 0x11, 0x4,
+    0x3, 0xff, 0x88, 0xe0, 0x1f, 0xfc, 0x15, 0x0,
+    0x50, 0x7, 0xff, 0x7, 0x0, 0x6, 0x40, 0x1f,
+    0xf8, 0xd0, 0x0, 0xa0, 0x1f, 0xf8, 0xf4, 0x1,
+    0x40, 0x1f, 0xf8, 0x5c, 0x0, 0x46, 0x1, 0xff,
+    0x85, 0x40, 0x16, 0x1, 0xff, 0x78, 0x78, 0x1,
+    0x80, 0x3f, 0xf8, 0x2a, 0x0, 0x14, 0x0, 0xff,
+    0xe0, 0xa8, 0x3, 0x40, 0x3f, 0xf8, 0x3c, 0x0,
+    0x70, 0xf, 0xfe, 0xa, 0x8, 0xa, 0x80, 0x7f,
+    0xf0, 0x5c, 0x1, 0xe0, 0x60, 0x1f, 0xf5, 0x0,
+    0x14, 0x4, 0x3, 0xfe, 0x32, 0x0, 0x33, 0x80,
+    0x7f, 0xe5, 0x0, 0x68, 0x80, 0x7f, 0xea, 0x0,
+    0x20, 0x80, 0x7f, 0xe2, 0x30, 0x2, 0x0, 0x7f,
+    0xf0, 0x6c, 0x3, 0xff, 0x88, 0xc0, 0x1f, 0xfc,
+    0x41, 0x30, 0xf, 0xfe, 0x25, 0x0, 0x70,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x2f, 0xff, 0xfe, 0x97, 0x7b, 0xff,
-    0xff, 0xb0, 0x9, 0xff, 0xfc, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x20, 0xdf, 0xff, 0x20, 0x0, 0x0,
-    0x8, 0xff, 0xf7, 0xf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfb, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xb2, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfb, 0x2f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xb2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfb, 0x2f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb2, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb, 0x2f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfb, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xb0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0xd, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x70, 0x9f, 0xff, 0xc1, 0x0, 0x0,
-    0x4f, 0xff, 0xf2, 0x2, 0xff, 0xff, 0xe9, 0x77,
-    0xbf, 0xff, 0xfb, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xfd, 0xa4, 0x0, 0x0,
+    0x0, 0xc2, 0xf7, 0xdf, 0xed, 0xa4, 0x0, 0xf9,
+    0x7a, 0x10, 0x40, 0x4, 0xb7, 0x82, 0x1, 0x9a,
+    0x80, 0x3f, 0x8f, 0xc4, 0x0, 0x52, 0x1, 0xb,
+    0x44, 0x10, 0x2, 0x1a, 0x0, 0x58, 0x4, 0x7d,
+    0x2e, 0xeb, 0xb0, 0x4, 0x84, 0x8, 0x1, 0x70,
+    0x7, 0x23, 0x80, 0x4a, 0x4, 0x0, 0x22, 0x0,
+    0x7b, 0x0, 0x2d, 0x10, 0x8, 0x40, 0x3e, 0x60,
+    0x8, 0x4c, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xe3, 0x98, 0x7, 0xff, 0x10, 0x40,
+    0x21, 0x0, 0xf9, 0x80, 0x22, 0x2, 0x0, 0x11,
+    0x0, 0x3d, 0x80, 0x17, 0x2, 0x0, 0x5c, 0x20,
+    0x19, 0x1c, 0x2, 0x50, 0xb0, 0x8, 0xfe, 0x5d,
+    0xd7, 0x60, 0x9, 0x8, 0xa, 0x40, 0x21, 0x68,
+    0x82, 0x0, 0x43, 0x40, 0x13, 0x50, 0x7, 0xf1,
+    0xf8, 0x80, 0x65, 0xe8, 0x41, 0x0, 0x12, 0xde,
+    0x8, 0x0,
 
     /* U+0050 "P" */
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x30, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0xff, 0xff, 0x77, 0x77, 0x78,
-    0xcf, 0xff, 0xfd, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x60, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xd0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x80, 0xff, 0xfe, 0x0, 0x0, 0x1,
-    0x5d, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0xff,
-    0xff, 0x66, 0x66, 0x65, 0x30, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xff, 0xfe, 0xec, 0x93, 0x0, 0xff, 0xe1, 0x9,
+    0xb6, 0x58, 0x80, 0x7f, 0xf1, 0x13, 0xc8, 0x3,
+    0xd1, 0x1c, 0xe6, 0x1, 0xf, 0x80, 0x70, 0xbb,
+    0xf4, 0x65, 0x0, 0x44, 0xc0, 0x1f, 0xf9, 0x5c,
+    0x2, 0xd0, 0xf, 0xfe, 0xc, 0x80, 0x4a, 0x1,
+    0xff, 0xc1, 0x10, 0x8, 0x40, 0x3f, 0xfa, 0x68,
+    0x1, 0x10, 0x7, 0xff, 0x6, 0x40, 0x25, 0x0,
+    0xff, 0xa, 0xe9, 0x0, 0x54, 0x1, 0x87, 0xff,
+    0xba, 0x88, 0x2, 0x92, 0x0, 0xff, 0xe1, 0xc3,
+    0x0, 0x7f, 0xf0, 0x97, 0x1c, 0x3, 0xe9, 0x9e,
+    0xac, 0xfa, 0x30, 0xf, 0x85, 0x9b, 0x94, 0xc0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe,
+    0x38,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x17, 0xbe, 0xfe, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x4, 0xff, 0xff, 0xe8, 0x67,
-    0xaf, 0xff, 0xfd, 0x0, 0xc, 0xff, 0xfb, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x50, 0x1f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x5f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf0, 0x5f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf0, 0x5f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf0, 0x5f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x5f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x5f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x4f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xd0, 0x1f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xb0, 0xc, 0xff, 0xfb,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x4, 0xff,
-    0xff, 0xe8, 0x67, 0xaf, 0xff, 0xfd, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x16, 0xbd, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xe0,
+    0x0, 0xc2, 0xf7, 0xdf, 0xdb, 0x48, 0x1, 0xf9,
+    0xba, 0x10, 0x40, 0x49, 0x6f, 0x8, 0x3, 0xa2,
+    0x40, 0x3f, 0x8f, 0x8, 0x2, 0x47, 0x0, 0x85,
+    0xe6, 0x14, 0x2, 0x1f, 0x0, 0xa0, 0x2, 0x4e,
+    0x86, 0x7a, 0xc0, 0x8, 0x94, 0x4, 0xc0, 0x3,
+    0x60, 0x1c, 0x72, 0x1, 0x70, 0x28, 0x4, 0x80,
+    0x1f, 0x38, 0x4, 0xc0, 0x20, 0x11, 0x0, 0x7c,
+    0x20, 0x11, 0x80, 0x7f, 0xf1, 0x44, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe8, 0x88,
+    0x8, 0x4, 0x40, 0x1f, 0x8, 0x4, 0x60, 0xa0,
+    0x12, 0x88, 0x7, 0x9c, 0x2, 0x60, 0x13, 0x0,
+    0xa8, 0x3, 0x8e, 0x40, 0x2e, 0x0, 0x40, 0x4,
+    0x9d, 0xc, 0xf5, 0x80, 0x11, 0x28, 0x1, 0x20,
+    0x2, 0x17, 0x98, 0x50, 0x8, 0x7c, 0x3, 0x3d,
+    0x0, 0x7f, 0x1e, 0x10, 0x7, 0x2f, 0x4a, 0x10,
+    0x7, 0x79, 0x0, 0x7c, 0x2d, 0x7b, 0xf0, 0x1,
+    0x70, 0x7, 0xff, 0x5, 0xc8, 0x0, 0x4e, 0x1,
+    0xff, 0xc1, 0xe0, 0xa, 0x4, 0x3, 0xff, 0x1b,
+    0x0, 0x54, 0x1, 0xff, 0xc1, 0x81, 0x0, 0x22,
+    0x80, 0x7f, 0xe1, 0xb0, 0xa, 0xc0,
 
     /* U+0052 "R" */
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xb6, 0x10, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xf, 0xff, 0xf7, 0x77, 0x77, 0x9e, 0xff,
-    0xff, 0x50, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xfd, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x6f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf7, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf4, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x28, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xf6, 0x66, 0x8f, 0xff, 0xd0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0xcf, 0xff, 0x50, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x5, 0xff, 0xfc, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0xd, 0xff, 0xf4,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x6f, 0xff,
-    0xb0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x30, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x7,
-    0xff, 0xfb, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf2, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xa0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x2f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf9,
+    0xff, 0xfe, 0xdb, 0x61, 0x0, 0xff, 0xe0, 0x92,
+    0x4f, 0x30, 0x7, 0xff, 0x12, 0x60, 0x3, 0xd1,
+    0x1c, 0xc2, 0x1, 0x3a, 0x80, 0x61, 0x77, 0xe9,
+    0xf3, 0x0, 0xa0, 0x3, 0xfe, 0x1d, 0x0, 0x88,
+    0xc0, 0x3f, 0xe1, 0x50, 0x9, 0x40, 0x3f, 0xf1,
+    0x0, 0x42, 0x1, 0xff, 0xc4, 0x10, 0xf, 0xfc,
+    0x80, 0x11, 0x0, 0x7f, 0xcc, 0x60, 0x12, 0x0,
+    0x7f, 0x14, 0x48, 0x4, 0xe0, 0x18, 0x7f, 0xfb,
+    0x5c, 0x2, 0x28, 0x0, 0xff, 0xe1, 0x17, 0x80,
+    0x7f, 0xf0, 0x9f, 0x48, 0x3, 0xd3, 0x33, 0x80,
+    0x45, 0x0, 0x1f, 0xb, 0x35, 0x6, 0x0, 0x25,
+    0x0, 0xff, 0xd2, 0x1, 0x48, 0x7, 0xfe, 0x52,
+    0x0, 0x1a, 0x0, 0x7f, 0xeb, 0x0, 0xbc, 0x3,
+    0xff, 0x30, 0x80, 0x10, 0xc0, 0x3f, 0xf4, 0x80,
+    0x50, 0x1, 0xff, 0x98, 0x2, 0x42, 0x0, 0xff,
+    0x85, 0x80, 0x28, 0x0, 0xff, 0xd0, 0x1, 0x29,
+    0x0, 0x7f, 0xc2, 0xa0, 0x15, 0x80,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x16, 0xbe, 0xfe, 0xd9, 0x30, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x3, 0xff, 0xff, 0xe8, 0x67,
-    0xbf, 0xff, 0xfa, 0x0, 0xa, 0xff, 0xfa, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x10, 0xe, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x60, 0xf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x70, 0xf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x73, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xfb, 0x50, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x6,
-    0xbf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xcf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf3, 0x47, 0x77, 0x10, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf4, 0x9f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf3, 0x6f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xf1, 0x1f, 0xff, 0xf7,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xc0, 0x9, 0xff,
-    0xff, 0xd8, 0x66, 0x9e, 0xff, 0xff, 0x40, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xdb, 0x61,
-    0x0, 0x0,
+    0x0, 0xc2, 0xd7, 0xdf, 0xdb, 0x26, 0x1, 0xf9,
+    0xba, 0x50, 0x40, 0x49, 0xb2, 0x84, 0x3, 0x9e,
+    0x40, 0x3f, 0x97, 0x0, 0x31, 0xc0, 0x4, 0x2f,
+    0x30, 0x80, 0x11, 0x50, 0x5, 0x20, 0x12, 0xf4,
+    0x33, 0xdd, 0x80, 0x25, 0x10, 0x2, 0x0, 0x54,
+    0x1, 0xc8, 0xe0, 0x13, 0x80, 0x4, 0x0, 0x80,
+    0x1f, 0x60, 0x4, 0x20, 0x1c, 0xe0, 0x1f, 0x27,
+    0xfc, 0xe0, 0x1, 0x0, 0x19, 0x0, 0x7f, 0xf0,
+    0x5c, 0x2, 0xf2, 0x0, 0xff, 0xd0, 0x1, 0x16,
+    0xe3, 0x98, 0x7, 0xf0, 0xd0, 0x6, 0x38, 0xcf,
+    0xb5, 0x0, 0xf9, 0x6c, 0x40, 0x3c, 0x95, 0xa6,
+    0x1, 0xe4, 0xe9, 0x40, 0xf, 0x16, 0x20, 0x7,
+    0xcd, 0x7f, 0x8e, 0x60, 0x1a, 0xc4, 0x3, 0xf8,
+    0xe3, 0x30, 0x20, 0x14, 0x0, 0x7f, 0xe3, 0xc0,
+    0x9, 0x80, 0x3f, 0xf8, 0x24, 0x80, 0x11, 0xa3,
+    0xbc, 0x20, 0x1f, 0x8c, 0x2, 0x7d, 0x88, 0x94,
+    0x3, 0xf1, 0x0, 0x4f, 0xe0, 0x17, 0x0, 0x7c,
+    0x28, 0x1, 0x13, 0x80, 0x4a, 0xe0, 0x1c, 0x34,
+    0x20, 0x3, 0x11, 0x30, 0x5, 0x1b, 0xc, 0xc9,
+    0xf4, 0x0, 0xa0, 0x1, 0x26, 0x1, 0x13, 0xcc,
+    0x98, 0x40, 0x28, 0x40, 0xb, 0x18, 0x3, 0xf8,
+    0x69, 0xc0, 0x3a, 0x75, 0xcc, 0x40, 0x4, 0x93,
+    0xea, 0x1, 0x0,
 
     /* U+0054 "T" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0x88, 0x88, 0x88,
-    0x9f, 0xff, 0xe8, 0x88, 0x88, 0x86, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xfe, 0x2e, 0x0, 0x7f, 0xf6, 0x8d,
+    0xdf, 0xcc, 0x1, 0xb, 0xbf, 0xa8, 0x62, 0x3d,
+    0x60, 0x11, 0x44, 0x79, 0x80, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xcc,
 
     /* U+0055 "U" */
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xb1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xb1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xb1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xb1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xb1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfb, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xb1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xb1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xb1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xb1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xa0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf9, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x70, 0x9f, 0xff, 0xd1, 0x0, 0x0,
-    0x4f, 0xff, 0xf2, 0x2, 0xff, 0xff, 0xe8, 0x67,
-    0xbf, 0xff, 0xfb, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x1, 0x7c,
-    0xef, 0xfd, 0xa5, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x3e, 0x3f, 0xfa, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xe0, 0x40, 0x3f, 0xe1, 0x10, 0x4,
+    0x40, 0x1f, 0x30, 0x4, 0x60, 0x40, 0x11, 0x80,
+    0x7b, 0x0, 0x2e, 0x4, 0x0, 0xb8, 0x40, 0x32,
+    0x30, 0x4, 0xa1, 0x60, 0x11, 0x7c, 0x33, 0xdd,
+    0x80, 0x24, 0x20, 0x29, 0x0, 0x85, 0xe6, 0x10,
+    0x2, 0x1a, 0x0, 0x9a, 0x40, 0x3f, 0x8b, 0x4,
+    0x3, 0x37, 0x41, 0x88, 0x0, 0x96, 0xb4, 0x80,
+    0x0,
 
     /* U+0056 "V" */
-    0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xb0, 0xd, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x70, 0x8, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x30,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfa, 0x0, 0x0, 0xcf, 0xff, 0x10,
-    0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x8f,
-    0xff, 0x50, 0x0, 0x0, 0xa, 0xff, 0xf2, 0x0,
-    0x0, 0x4f, 0xff, 0x90, 0x0, 0x0, 0xe, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x0,
-    0x2f, 0xff, 0xa0, 0x0, 0x0, 0xc, 0xff, 0xf1,
-    0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x8,
-    0xff, 0xf5, 0x0, 0x0, 0x9f, 0xff, 0x20, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0xdf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x0, 0x1,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x10, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x40, 0x8, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0xc, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf0, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf3, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf7, 0xbf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0,
+    0x5f, 0xfa, 0x80, 0x3f, 0xdf, 0xf8, 0x10, 0x2,
+    0x40, 0xf, 0xe4, 0x0, 0x90, 0x4, 0x80, 0x2,
+    0x40, 0x1f, 0x8c, 0x2, 0xc0, 0x2, 0x80, 0x4e,
+    0x1, 0xfb, 0x0, 0x24, 0x0, 0x60, 0x5, 0x80,
+    0x1f, 0x90, 0x0, 0x26, 0x0, 0x40, 0x9, 0x0,
+    0x3e, 0x30, 0x9, 0x0, 0x31, 0x80, 0x8, 0x40,
+    0x3c, 0x80, 0x16, 0x0, 0x64, 0x0, 0x90, 0x3,
+    0xda, 0x1, 0x20, 0x6, 0xc0, 0xb, 0x0, 0x3c,
+    0x80, 0x1, 0x20, 0xc, 0x80, 0x12, 0x0, 0x71,
+    0x8, 0x1, 0x0, 0x3c, 0x60, 0x2, 0x10, 0xc,
+    0x80, 0x16, 0x0, 0x79, 0x0, 0x24, 0x0, 0xde,
+    0x1, 0x20, 0x7, 0xb0, 0x2, 0xc0, 0xc, 0x80,
+    0x2, 0x20, 0x7, 0x90, 0x2, 0x40, 0x8, 0x48,
+    0x0, 0x80, 0x1f, 0x90, 0x0, 0x42, 0x0, 0x40,
+    0xb, 0x0, 0x3f, 0x60, 0x4, 0xa0, 0xd, 0x0,
+    0x90, 0x3, 0xf2, 0x0, 0x58, 0x0, 0x40, 0x1,
+    0x8, 0x7, 0xe3, 0x0, 0x90, 0x0, 0x60, 0x4,
+    0x0, 0xff, 0x20, 0x0, 0xc1, 0x0, 0x2c, 0x0,
+    0xff, 0x60, 0x4, 0x66, 0x0, 0x90, 0x3, 0xfc,
+    0x80, 0x12, 0x60, 0x0, 0xc4, 0x3, 0xfc, 0x60,
+    0x16, 0xa8, 0x1, 0x0, 0x3f, 0xf2, 0x0, 0x10,
+    0x40, 0x18, 0x1, 0xff, 0xb0, 0x0, 0x20, 0x12,
+    0x0, 0x7f, 0xe5, 0x0, 0xe3, 0x0, 0xff, 0xe0,
+    0x90, 0x80, 0x64, 0x0, 0xf8,
 
     /* U+0057 "W" */
-    0x5f, 0xff, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x5, 0xff, 0xe3, 0xff, 0xf2, 0x0, 0x2, 0xff,
-    0xfe, 0x0, 0x0, 0x6f, 0xfc, 0x1f, 0xff, 0x30,
-    0x0, 0x4f, 0xff, 0xf0, 0x0, 0x8, 0xff, 0xb0,
-    0xff, 0xf5, 0x0, 0x6, 0xfd, 0xff, 0x20, 0x0,
-    0xaf, 0xf9, 0xe, 0xff, 0x70, 0x0, 0x8f, 0xbf,
-    0xf3, 0x0, 0xb, 0xff, 0x70, 0xcf, 0xf8, 0x0,
-    0xb, 0xf9, 0xef, 0x50, 0x0, 0xdf, 0xf5, 0xa,
-    0xff, 0xa0, 0x0, 0xdf, 0x7d, 0xf7, 0x0, 0xe,
-    0xff, 0x30, 0x8f, 0xfb, 0x0, 0xf, 0xf6, 0xbf,
-    0x90, 0x0, 0xff, 0xf1, 0x7, 0xff, 0xd0, 0x1,
-    0xff, 0x49, 0xfb, 0x0, 0x2f, 0xff, 0x0, 0x5f,
-    0xfe, 0x0, 0x3f, 0xf2, 0x7f, 0xd0, 0x3, 0xff,
-    0xe0, 0x3, 0xff, 0xf0, 0x5, 0xff, 0x5, 0xff,
-    0x0, 0x5f, 0xfc, 0x0, 0x1f, 0xff, 0x10, 0x7f,
-    0xe0, 0x4f, 0xf1, 0x7, 0xff, 0xa0, 0x0, 0xff,
-    0xf3, 0x9, 0xfc, 0x2, 0xff, 0x30, 0x8f, 0xf8,
-    0x0, 0xe, 0xff, 0x50, 0xbf, 0xa0, 0xf, 0xf5,
-    0xa, 0xff, 0x60, 0x0, 0xcf, 0xf6, 0xd, 0xf8,
-    0x0, 0xef, 0x70, 0xbf, 0xf4, 0x0, 0xa, 0xff,
-    0x80, 0xff, 0x60, 0xc, 0xf9, 0xd, 0xff, 0x20,
-    0x0, 0x8f, 0xf9, 0x2f, 0xf4, 0x0, 0xaf, 0xb0,
-    0xff, 0xf1, 0x0, 0x6, 0xff, 0xb4, 0xff, 0x20,
-    0x9, 0xfd, 0xf, 0xff, 0x0, 0x0, 0x5f, 0xfc,
-    0x6f, 0xf0, 0x0, 0x7f, 0xf2, 0xff, 0xd0, 0x0,
-    0x3, 0xff, 0xe8, 0xfe, 0x0, 0x5, 0xff, 0x4f,
-    0xfb, 0x0, 0x0, 0x1f, 0xff, 0x9f, 0xc0, 0x0,
-    0x3f, 0xf7, 0xff, 0x90, 0x0, 0x0, 0xff, 0xfb,
-    0xfa, 0x0, 0x1, 0xff, 0xaf, 0xf7, 0x0, 0x0,
-    0xd, 0xff, 0xdf, 0x80, 0x0, 0xf, 0xfd, 0xff,
-    0x50, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0xf4, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x40, 0x0, 0xc, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x8f, 0xff, 0xf2, 0x0, 0x0, 0xaf, 0xff, 0xf0,
-    0x0,
+    0x5f, 0xf8, 0x3, 0xbf, 0xec, 0x0, 0xcb, 0xfe,
+    0xe6, 0x0, 0x88, 0x2, 0x20, 0x8, 0x80, 0x31,
+    0x80, 0x8, 0x80, 0x10, 0x80, 0x4c, 0x1, 0x8,
+    0x6, 0xe0, 0x3, 0x88, 0x4, 0xc0, 0x11, 0x1,
+    0x0, 0x8, 0x2, 0x20, 0x1, 0x0, 0x80, 0x8,
+    0x2, 0xe0, 0x60, 0x0, 0x80, 0x42, 0x0, 0xe0,
+    0x20, 0x7, 0x80, 0x46, 0x4, 0x20, 0xc0, 0x13,
+    0x0, 0x8, 0x18, 0x0, 0x40, 0x13, 0x7, 0x18,
+    0x10, 0x4, 0x60, 0x6, 0x2, 0x0, 0x8, 0x4,
+    0x40, 0x2c, 0x1c, 0x1, 0x8, 0x0, 0x83, 0xc0,
+    0xc, 0x0, 0x10, 0x1, 0x10, 0x8, 0x0, 0x40,
+    0x10, 0x81, 0x0, 0xc, 0x0, 0x40, 0x6, 0xe0,
+    0x60, 0x0, 0x80, 0x4, 0x0, 0xc0, 0x1, 0x0,
+    0x30, 0x0, 0x88, 0x4, 0x0, 0x60, 0x1, 0x0,
+    0x8, 0x2, 0x10, 0x20, 0x10, 0x10, 0x0, 0x81,
+    0x0, 0x18, 0x0, 0x20, 0x11, 0x7, 0x1, 0x3,
+    0x0, 0x8, 0x3c, 0x0, 0x40, 0x10, 0x80, 0x18,
+    0x8, 0x18, 0x8, 0x0, 0xc0, 0x40, 0xe, 0x0,
+    0x88, 0x0, 0x60, 0xc0, 0x40, 0x1, 0x2, 0x1,
+    0x0, 0x10, 0x4, 0xc0, 0xe, 0x2, 0xe, 0x0,
+    0x10, 0x70, 0x30, 0x1, 0x80, 0x22, 0x0, 0x9,
+    0x0, 0x8, 0x0, 0xc0, 0x40, 0x40, 0x3, 0x0,
+    0xb8, 0x0, 0x4c, 0x0, 0x60, 0x1, 0x83, 0x0,
+    0x61, 0x0, 0x8c, 0x0, 0xe4, 0x0, 0x20, 0x7,
+    0x1, 0x10, 0x0, 0x40, 0x19, 0x80, 0x5, 0xc0,
+    0x20, 0x11, 0x0, 0x18, 0x0, 0xc0, 0x18, 0x80,
+    0x2, 0x20, 0x20, 0x9, 0x80, 0x6, 0x0, 0x20,
+    0xc, 0x20, 0x11, 0x3, 0x0, 0x44, 0x0, 0xd0,
+    0x7, 0x0, 0x71, 0x0, 0x18, 0x8, 0x2, 0x10,
+    0x3, 0x80, 0x8, 0x3, 0x84, 0x0, 0x41, 0xc0,
+    0x18, 0x80, 0x80, 0x2, 0x1, 0xcc, 0x1, 0x88,
+    0x3, 0x8, 0x6, 0x60, 0xe, 0x20, 0xc, 0xc0,
+    0x19, 0x80, 0x31, 0x0, 0x0,
 
     /* U+0058 "X" */
-    0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xa0, 0x8, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x20, 0x0, 0xef, 0xff, 0x50,
-    0x0, 0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x6f,
-    0xff, 0xd0, 0x0, 0x0, 0x2f, 0xff, 0xe1, 0x0,
-    0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0xaf, 0xff,
-    0x70, 0x0, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x2,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x60, 0xb, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf6, 0xbf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf7, 0xef, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xe0, 0x7f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x70, 0xe, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf6, 0x0, 0x0, 0xef, 0xff,
-    0x50, 0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0,
-    0x6f, 0xff, 0xd0, 0x0, 0x0, 0xdf, 0xff, 0x50,
-    0x0, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x6, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x10,
-    0xe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x80, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf2,
+    0x1f, 0xfc, 0x80, 0x1f, 0xa3, 0xfe, 0xa0, 0x17,
+    0x0, 0xa4, 0x3, 0xe1, 0x70, 0xa, 0x0, 0x10,
+    0x20, 0x2, 0x50, 0xf, 0x40, 0x4, 0xe4, 0x1,
+    0x40, 0x5, 0x0, 0x1c, 0x4c, 0x0, 0x19, 0x0,
+    0xcc, 0x40, 0x2, 0x60, 0xd, 0x0, 0x14, 0x88,
+    0x7, 0x40, 0x5, 0x60, 0x11, 0x28, 0x0, 0x9c,
+    0x3, 0xca, 0x60, 0x2, 0x60, 0x4, 0x80, 0x50,
+    0x1, 0xfb, 0xc0, 0x28, 0x3, 0x40, 0x1, 0xa8,
+    0x7, 0xe3, 0x40, 0x0, 0xb4, 0x0, 0x5e, 0x1,
+    0xfe, 0x90, 0xa, 0x10, 0x0, 0xa6, 0x1, 0xfe,
+    0x26, 0x0, 0x8, 0x5, 0x0, 0x1f, 0xfa, 0x0,
+    0x39, 0x88, 0x3, 0xff, 0xb, 0x80, 0x68, 0x0,
+    0xff, 0xe1, 0x20, 0x6, 0x60, 0xf, 0xfe, 0xa,
+    0x98, 0x6, 0x91, 0x0, 0xff, 0xd0, 0x1, 0xc3,
+    0x20, 0x1f, 0xf3, 0x90, 0x2, 0x4, 0x0, 0xe4,
+    0x1, 0xfc, 0x30, 0x0, 0x17, 0x90, 0xa, 0x0,
+    0x3f, 0xa0, 0x2, 0x90, 0x71, 0x0, 0x29, 0x80,
+    0x7c, 0x4c, 0x0, 0x17, 0x0, 0x48, 0x5, 0xe0,
+    0x1f, 0x48, 0x5, 0x0, 0x13, 0x88, 0x0, 0xd4,
+    0x3, 0x91, 0x0, 0x2, 0x60, 0xd, 0x0, 0x14,
+    0x0, 0x74, 0x80, 0x50, 0x1, 0xcc, 0x40, 0x2,
+    0x60, 0x9, 0x88, 0x0, 0x6a, 0x1, 0xe8, 0x0,
+    0xa0, 0x40, 0x10, 0x1, 0x40, 0x7, 0xca, 0x60,
+    0x1, 0x90, 0x81, 0x0, 0x22, 0x0, 0x3f, 0x40,
+    0x4, 0xe4,
 
     /* U+0059 "Y" */
-    0xbf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf5, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xd0, 0xc, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0,
-    0x0, 0xcf, 0xff, 0x30, 0x0, 0x0, 0x8, 0xff,
-    0xf6, 0x0, 0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0,
-    0x1f, 0xff, 0xe0, 0x0, 0x0, 0xd, 0xff, 0xf2,
-    0x0, 0x0, 0x7f, 0xff, 0x70, 0x0, 0x0, 0x6,
-    0xff, 0xfa, 0x0, 0x0, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x6, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0xd,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf0, 0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf6, 0xaf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf9, 0x40, 0x3f, 0xd7, 0xff, 0x2c, 0x0,
+    0x50, 0x1, 0xfc, 0x48, 0x0, 0x25, 0x33, 0x0,
+    0x9, 0x0, 0x3f, 0x40, 0x5, 0x0, 0x8, 0x0,
+    0xa0, 0x3, 0xe1, 0x50, 0x0, 0xa8, 0x1, 0xc,
+    0x0, 0x66, 0x0, 0xf4, 0x80, 0x50, 0x1, 0xa4,
+    0x2, 0x80, 0xe, 0x17, 0x0, 0xb, 0x0, 0x65,
+    0x20, 0x2, 0x10, 0x6, 0x60, 0xa, 0x40, 0x3d,
+    0x60, 0x14, 0x0, 0x69, 0x0, 0x9c, 0x3, 0xcc,
+    0x20, 0x5, 0x10, 0x3, 0x8, 0x1, 0xc0, 0x3f,
+    0x40, 0x5, 0x0, 0xb, 0x0, 0xa4, 0x3, 0xf3,
+    0x8, 0x1, 0x81, 0x8, 0x0, 0xc2, 0x1, 0xfd,
+    0x20, 0x13, 0x70, 0x5, 0x0, 0x1f, 0xe6, 0x0,
+    0xa9, 0x40, 0xc, 0x20, 0x1f, 0xe1, 0x70, 0x1,
+    0x80, 0x56, 0x1, 0xff, 0xa4, 0x3, 0x94, 0x80,
+    0x3f, 0xf0, 0xb0, 0x6, 0x90, 0xf, 0xfe, 0x15,
+    0x80, 0x46, 0x60, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xb2,
 
     /* U+005A "Z" */
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x68, 0x88, 0x88, 0x88, 0x88, 0x8f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x50, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xd, 0xff, 0xff, 0xe1, 0x20, 0x7, 0xff, 0x5e,
+    0xdd, 0xff, 0xc0, 0x19, 0xc1, 0xa2, 0x3f, 0xbc,
+    0x2, 0x33, 0x0, 0x7f, 0x86, 0x0, 0x2f, 0x0,
+    0xff, 0xac, 0x2, 0x63, 0x0, 0xff, 0x1a, 0x80,
+    0x6, 0x0, 0x3f, 0xee, 0x0, 0xa0, 0x40, 0x3f,
+    0xcc, 0x40, 0x3, 0x60, 0xf, 0xf0, 0xc8, 0x5,
+    0xe0, 0x1f, 0xf5, 0x80, 0x4a, 0x60, 0x1f, 0xe3,
+    0x50, 0xa, 0xc0, 0x3f, 0xef, 0x0, 0xa0, 0x40,
+    0x3f, 0xcc, 0x60, 0x2, 0x70, 0xf, 0xf0, 0xc0,
+    0x5, 0x20, 0x1f, 0xf4, 0x8, 0x1, 0x50, 0x3,
+    0xfc, 0x6c, 0x1, 0x58, 0x7, 0xfd, 0xe0, 0x14,
+    0x8, 0x7, 0xf9, 0x8c, 0x0, 0x4e, 0x1, 0xfe,
+    0x18, 0x0, 0xa4, 0x3, 0xfe, 0x81, 0x0, 0x22,
+    0x0, 0x3f, 0xe6, 0x0, 0x8a, 0x23, 0xfc, 0xa0,
+    0x1c, 0xce, 0xff, 0xef, 0x0, 0xff, 0xeb, 0x0,
 
     /* U+005B "[" */
-    0x78, 0x88, 0x88, 0x88, 0x83, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x88, 0x88, 0x83, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0xff, 0xf7,
+    0x78, 0x8f, 0xc7, 0xe, 0xff, 0x90, 0x3, 0xff,
+    0x96, 0x3f, 0xfc, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xa0,
+    0x31, 0x1c, 0x60, 0x19, 0xdf, 0x90, 0x3, 0xff,
+    0x90,
 
     /* U+005C "\\" */
-    0x48, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xe0,
+    0x48, 0x89, 0x0, 0x3f, 0xf8, 0x2e, 0xfa, 0x40,
+    0x3f, 0xf8, 0x26, 0x40, 0x2, 0x30, 0xf, 0xfe,
+    0xd, 0x0, 0x54, 0x1, 0xff, 0xc1, 0x60, 0x9,
+    0x80, 0x3f, 0xf8, 0x22, 0x80, 0x12, 0x80, 0x7f,
+    0xf0, 0x78, 0x2, 0x90, 0xf, 0xfe, 0xa, 0x88,
+    0x0, 0xc8, 0x3, 0xff, 0x82, 0xe0, 0x15, 0x0,
+    0x7f, 0xf0, 0x68, 0x2, 0x60, 0xf, 0xfe, 0x9,
+    0x90, 0x0, 0x50, 0x3, 0xff, 0x83, 0x60, 0x17,
+    0x0, 0x7f, 0xf0, 0x5c, 0x2, 0x50, 0xf, 0xfe,
+    0x8, 0xa8, 0x4, 0xc0, 0x1f, 0xfc, 0x1e, 0x0,
+    0xa8, 0x3, 0xff, 0x82, 0x82, 0x0, 0x32, 0x0,
+    0xff, 0xe0, 0xb0, 0x5, 0x40, 0x1f, 0xfc, 0x1a,
+    0x0, 0x98, 0x3, 0xff, 0x82, 0x46, 0x0, 0x14,
+    0x0, 0xff, 0xe0, 0xd0, 0x5, 0xc0, 0x1f, 0xfc,
+    0x17, 0x0, 0x94, 0x40, 0x3f, 0xf0, 0xa8, 0x4,
+    0xe0, 0x1f, 0xfc, 0x1e, 0x0, 0xa8, 0x3, 0xff,
+    0x82, 0x82, 0x0, 0x32, 0x0, 0xff, 0xe0, 0xb0,
+    0x5, 0x40, 0x1f, 0xfc, 0x1a, 0x0, 0x98, 0x3,
+    0xff, 0x82, 0x46, 0x0, 0x15, 0x0, 0xff, 0xe0,
+    0xd0, 0x5, 0xc0, 0x1f, 0xfc, 0x16, 0x0, 0x90,
+    0x40, 0x3f, 0xf8, 0x2a, 0x1, 0x30, 0x7, 0xff,
+    0x6, 0x40, 0x2a, 0x0, 0xff, 0xe0, 0x99, 0x0,
+    0x8, 0xc0, 0x3f, 0xf8, 0x34, 0x1, 0x50, 0x7,
+    0xff, 0x5, 0x80, 0x27, 0x0,
 
     /* U+005D "]" */
-    0x68, 0x88, 0x88, 0x88, 0x84, 0xdf, 0xff, 0xff,
-    0xff, 0xf9, 0xdf, 0xff, 0xff, 0xff, 0xf9, 0xdf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9,
-    0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9,
-    0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9,
-    0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x68, 0x88,
-    0x8a, 0xff, 0xf9, 0xdf, 0xff, 0xff, 0xff, 0xf9,
-    0xdf, 0xff, 0xff, 0xff, 0xf9, 0xdf, 0xff, 0xff,
-    0xff, 0xf9,
+    0x68, 0x8f, 0xc9, 0x6e, 0xff, 0xb4, 0x3, 0xff,
+    0x91, 0xbf, 0xfa, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x45,
+    0xa2, 0x37, 0x0, 0x6b, 0x77, 0xca, 0x1, 0xff,
+    0xcc,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xef, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x49, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x3f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xef, 0xf7, 0x0,
-    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10,
-    0x5, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff, 0x90,
-    0x0, 0xe, 0xff, 0x70, 0x0, 0x4, 0xff, 0xf2,
-    0x0, 0x0, 0x8f, 0xfe, 0x0, 0x0, 0xcf, 0xfb,
-    0x0, 0x0, 0x1, 0xff, 0xf5, 0x0, 0x3f, 0xff,
-    0x50, 0x0, 0x0, 0xa, 0xff, 0xd0, 0xa, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x42, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb,
+    0x0, 0xf1, 0xff, 0xdc, 0x1, 0xff, 0xa4, 0x2,
+    0x15, 0x0, 0xff, 0x12, 0x80, 0x69, 0x0, 0xff,
+    0x58, 0x1, 0x44, 0xc, 0xc0, 0x1f, 0x85, 0x80,
+    0x1c, 0xe0, 0x9, 0x0, 0xfc, 0xc0, 0x1, 0x4a,
+    0x0, 0x29, 0x0, 0x7d, 0x20, 0x9, 0x3, 0x30,
+    0x2, 0xc0, 0x3c, 0xc2, 0x0, 0x60, 0x4, 0x80,
+    0x18, 0x40, 0x3a, 0xc0, 0xc, 0x20, 0x5, 0x10,
+    0x3, 0x0, 0x64, 0x20, 0x5, 0x80, 0x66, 0x0,
+    0x48, 0x6, 0x80, 0x2, 0x10, 0x6, 0x90, 0x0,
+    0xa8, 0x0, 0xcc, 0x0, 0xe0, 0xe, 0x15, 0x0,
+    0x40, 0x2, 0x40, 0x4, 0xa0, 0x1e, 0xe0, 0x1,
+    0x21, 0x28, 0x2, 0x80, 0x3e, 0x42, 0x0, 0x78,
 
     /* U+005F "_" */
-    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x52, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7,
+    0x45, 0x5f, 0xfe, 0x21, 0x4d, 0x57, 0xff, 0x11,
+    0x40, 0x3f, 0xfb, 0x0,
 
     /* U+0060 "`" */
-    0x2f, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0xe1,
-    0x0, 0x0, 0x7f, 0xff, 0xb0, 0x0, 0x0, 0x9f,
-    0xff, 0x80, 0x0, 0x0, 0xcf, 0xff, 0x40,
+    0x2f, 0xfc, 0x60, 0x11, 0x58, 0x5, 0xa2, 0x1,
+    0x24, 0x0, 0x6, 0x80, 0x33, 0xb0, 0x1, 0x20,
+    0x3, 0x49, 0x80, 0x1d, 0x0,
 
     /* U+0061 "a" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x4f, 0xff, 0xfb, 0x54, 0x47, 0xef,
-    0xff, 0xd0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0x40, 0x8a, 0xa9, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf9, 0x0, 0x3, 0x9d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x9, 0xff, 0xff,
-    0xdb, 0xbb, 0xbb, 0xcf, 0xff, 0x93, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x5, 0xff, 0xf9, 0x9f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x9b, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf9, 0xbf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x99,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf9,
-    0x4f, 0xff, 0xfd, 0x63, 0x46, 0xbf, 0xdf, 0xff,
-    0x90, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xf9, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf6, 0x3f,
-    0xff, 0x90, 0x0, 0x5a, 0xef, 0xfd, 0x92, 0x3,
-    0xff, 0xf9,
+    0x0, 0xc2, 0xf7, 0xdf, 0xee, 0xb6, 0x0, 0xf9,
+    0xfa, 0x10, 0x40, 0x2, 0x93, 0xc8, 0x1, 0xa6,
+    0x0, 0x3f, 0x86, 0xd0, 0x0, 0x8c, 0x1, 0x25,
+    0x5d, 0xa0, 0x40, 0x29, 0x0, 0x70, 0x5, 0x36,
+    0xa8, 0x87, 0xf1, 0x0, 0x12, 0x1, 0x2a, 0x99,
+    0x80, 0x1c, 0x32, 0x1, 0x18, 0x45, 0x52, 0x40,
+    0x3e, 0x20, 0xb, 0x80, 0x3f, 0xf9, 0x7, 0x3b,
+    0xff, 0xea, 0x0, 0xf4, 0xe3, 0x10, 0x7, 0xfe,
+    0x96, 0x0, 0x89, 0x13, 0x8c, 0x3, 0x1b, 0x0,
+    0x57, 0xb7, 0x7d, 0x20, 0x1a, 0x80, 0x29, 0x40,
+    0xf, 0xf8, 0x80, 0x24, 0x0, 0xff, 0xe2, 0x30,
+    0x7, 0xd8, 0x1, 0x88, 0x2, 0xf0, 0xf, 0x23,
+    0x0, 0x6d, 0x0, 0x93, 0x58, 0xd1, 0xae, 0xc4,
+    0x1, 0x91, 0x0, 0x11, 0x4e, 0x5c, 0xa0, 0x50,
+    0x7, 0x5a, 0x0, 0x7e, 0x94, 0x0, 0xf5, 0xd2,
+    0x88, 0x0, 0x9b, 0x58, 0x3, 0x80,
 
     /* U+0062 "b" */
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x6c, 0xff, 0xea, 0x30, 0x0,
-    0xff, 0xfd, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xff, 0xfd, 0xff, 0x96, 0x7a, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x2e, 0xff, 0xf5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x2e, 0xff, 0xf5,
-    0xff, 0xfe, 0xfe, 0x96, 0x79, 0xff, 0xff, 0xe0,
-    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xff, 0xfe, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xfe, 0x0, 0x6c, 0xff, 0xea, 0x30, 0x0,
+    0xff, 0xb8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xcb,
+    0x6c, 0xff, 0x75, 0x18, 0x7, 0x8c, 0x2e, 0x4c,
+    0x0, 0x2b, 0x8e, 0x1, 0xe8, 0x40, 0xf, 0xa1,
+    0x40, 0x39, 0xc1, 0xa6, 0x14, 0x3, 0x58, 0x6,
+    0x22, 0x74, 0xb3, 0xd6, 0x88, 0x0, 0x54, 0x3,
+    0x48, 0x80, 0x62, 0x80, 0xb, 0x0, 0x32, 0x0,
+    0x79, 0x40, 0x22, 0x0, 0x84, 0x3, 0xe1, 0x0,
+    0xff, 0xe3, 0xb8, 0x7, 0xff, 0xcd, 0xc0, 0x21,
+    0x0, 0xf8, 0x40, 0x3f, 0x20, 0x7, 0x90, 0x2,
+    0x20, 0xd, 0x22, 0x1, 0x8a, 0x40, 0x2c, 0x0,
+    0x84, 0xbe, 0x59, 0xe7, 0x44, 0x0, 0x2a, 0x1,
+    0x9c, 0x5a, 0x61, 0x80, 0x34, 0x0, 0x74, 0x20,
+    0x7, 0xd0, 0xc0, 0x1e, 0xb9, 0x30, 0x0, 0xae,
+    0x38, 0x0,
 
     /* U+0063 "c" */
-    0x0, 0x0, 0x6, 0xae, 0xff, 0xeb, 0x71, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x67,
-    0x9f, 0xff, 0xff, 0x30, 0x8, 0xff, 0xfd, 0x10,
-    0x0, 0x1, 0xbf, 0xff, 0xa0, 0xd, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xa, 0xdd, 0xd1, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xa, 0xee, 0xe1, 0xd, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x8,
-    0xff, 0xfd, 0x10, 0x0, 0x1, 0xbf, 0xff, 0xa0,
-    0x1, 0xff, 0xff, 0xf9, 0x67, 0x9e, 0xff, 0xff,
-    0x30, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x6, 0xae, 0xff,
-    0xeb, 0x71, 0x0, 0x0,
+    0x0, 0xe6, 0xae, 0xff, 0x75, 0xb8, 0x80, 0x7c,
+    0x9d, 0x2a, 0x20, 0x1, 0x48, 0xe6, 0x0, 0xe5,
+    0xb1, 0x0, 0xfe, 0x97, 0x0, 0x86, 0x80, 0x33,
+    0x4c, 0x30, 0x6, 0x83, 0x0, 0x48, 0x4, 0x5d,
+    0x2c, 0xf3, 0xc8, 0x1, 0x48, 0x1, 0x40, 0x2e,
+    0x10, 0xc, 0x34, 0x1, 0x28, 0x0, 0x80, 0x2,
+    0x60, 0x1e, 0x15, 0x22, 0x84, 0x40, 0x11, 0x0,
+    0x7e, 0xad, 0xd8, 0x40, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfc, 0x31, 0x0, 0x88, 0x3, 0xf5, 0x77, 0x42,
+    0x4, 0x0, 0x13, 0x0, 0xf0, 0xa8, 0x8e, 0x5,
+    0x0, 0xb8, 0x40, 0x30, 0xd0, 0x4, 0xa0, 0x9,
+    0x0, 0x8b, 0xa5, 0x9e, 0x7d, 0x0, 0x29, 0x0,
+    0xd, 0x0, 0x66, 0x98, 0x61, 0x0, 0xa0, 0xc0,
+    0x25, 0xb1, 0x0, 0xfe, 0x97, 0x0, 0xe4, 0xe9,
+    0x51, 0x0, 0xa, 0x47, 0x30, 0x4,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x6b, 0xef, 0xea,
-    0x20, 0x4f, 0xff, 0x90, 0x1, 0xcf, 0xff, 0xff,
-    0xff, 0x64, 0xff, 0xf9, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0x6f, 0xff, 0x90, 0x5f, 0xff, 0xfd,
-    0x86, 0x7b, 0xfd, 0xff, 0xf9, 0xc, 0xff, 0xfa,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x90, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xb, 0xff, 0xf9, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x92, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf9, 0x2f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x92,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf9,
-    0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x92, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf9, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x91, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf9, 0xf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0xcf, 0xff, 0xa0, 0x0, 0x0,
-    0x6f, 0xff, 0xf9, 0x6, 0xff, 0xff, 0xd8, 0x66,
-    0xbf, 0xdf, 0xff, 0x90, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xff, 0xf9, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xf6, 0x4f, 0xff, 0x90, 0x0, 0x6, 0xce,
-    0xfe, 0xa3, 0x4, 0xff, 0xf9,
+    0x0, 0xff, 0xcb, 0xff, 0x48, 0x7, 0xff, 0xfc,
+    0x3, 0x84, 0x3, 0xf3, 0x5f, 0x7f, 0x51, 0x0,
+    0x7e, 0x1c, 0x94, 0x10, 0x15, 0xd6, 0x0, 0xfb,
+    0x4c, 0x3, 0xe9, 0x20, 0xe, 0x53, 0x0, 0x89,
+    0xe6, 0x10, 0x2c, 0x3, 0xa4, 0x2, 0x5d, 0x86,
+    0x7b, 0x92, 0x0, 0xe3, 0x0, 0xac, 0x3, 0x99,
+    0x0, 0x30, 0x80, 0x46, 0x20, 0x1e, 0xd0, 0xc,
+    0x60, 0x13, 0x80, 0x7c, 0x60, 0x1f, 0xff, 0xf0,
+    0xf, 0xfe, 0x11, 0x80, 0x4e, 0x1, 0xf1, 0x80,
+    0x61, 0x0, 0x8c, 0x40, 0x3d, 0xa0, 0x1c, 0x60,
+    0x15, 0x80, 0x73, 0x20, 0x7, 0x50, 0x4, 0xbb,
+    0xc, 0xcb, 0x92, 0x0, 0xe6, 0x30, 0x8, 0x9e,
+    0x64, 0x81, 0x60, 0x1e, 0xd3, 0x0, 0xfa, 0x48,
+    0x3, 0xc3, 0x92, 0x62, 0x2, 0xb8, 0xc0, 0x1c,
 
     /* U+0065 "e" */
-    0x0, 0x0, 0x7, 0xbe, 0xfe, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x2f, 0xff, 0xf8, 0x20, 0x14, 0xcf,
-    0xff, 0xc0, 0xa, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x40, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf9, 0x2f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xb3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfd, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x3f, 0xff, 0xdb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x93, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x27, 0x77, 0x40,
-    0xaf, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xf6,
-    0x2, 0xff, 0xff, 0xc6, 0x45, 0x7d, 0xff, 0xfe,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x7b, 0xef, 0xfd, 0xa5,
-    0x0, 0x0,
+    0x0, 0xe7, 0xbe, 0xfe, 0xda, 0x40, 0xf, 0x97,
+    0xa1, 0x4, 0x4, 0x96, 0xf0, 0x80, 0x33, 0x50,
+    0x80, 0x7e, 0x3c, 0x10, 0x1, 0x48, 0x4, 0xfb,
+    0xfd, 0x66, 0x0, 0x1d, 0x0, 0x40, 0x5, 0x50,
+    0x40, 0x29, 0x88, 0x0, 0x34, 0x5, 0x0, 0x1a,
+    0x80, 0x7a, 0x0, 0x2d, 0x20, 0x9, 0x40, 0x3e,
+    0x30, 0x8, 0x84, 0x2, 0x10, 0xf, 0xc2, 0x0,
+    0x60, 0xc, 0xff, 0xff, 0x84, 0x3, 0xff, 0x98,
+    0x48, 0x9f, 0xf8, 0x3, 0x2d, 0xdf, 0xfd, 0x20,
+    0x1f, 0xfc, 0x51, 0x0, 0x88, 0x3, 0xff, 0x10,
+    0x4, 0x80, 0x1f, 0x13, 0xbc, 0x80, 0xa0, 0x1,
+    0x90, 0xf, 0x4c, 0x44, 0x41, 0x0, 0x13, 0x63,
+    0x22, 0xbe, 0xa0, 0x0, 0x58, 0xa, 0x40, 0x23,
+    0x9b, 0xa8, 0x20, 0xb, 0x40, 0x26, 0xa0, 0xf,
+    0xe2, 0xc3, 0x0, 0xcb, 0xf0, 0x82, 0x0, 0x25,
+    0xad, 0x30, 0x0,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xce, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xa7, 0x77, 0x77, 0x71, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x18, 0x88, 0x88, 0xcf, 0xff, 0xb8,
-    0x88, 0x88, 0x88, 0x10, 0x0, 0x0, 0x8, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x7c, 0xef, 0xff, 0x18, 0x7, 0xc3,
+    0xb0, 0x62, 0x1, 0xff, 0xc2, 0xd2, 0x0, 0xff,
+    0xe2, 0x19, 0x80, 0x25, 0x88, 0xf1, 0x0, 0x79,
+    0x0, 0x26, 0xa7, 0x7f, 0x8, 0x7, 0xbc, 0x2,
+    0xf0, 0xf, 0xff, 0xa9, 0x7f, 0xf3, 0x80, 0x53,
+    0xff, 0xf1, 0x80, 0x7f, 0xf6, 0x8d, 0xdf, 0x8c,
+    0x2, 0x47, 0x7f, 0x88, 0x62, 0x39, 0x0, 0x2d,
+    0x88, 0xf8, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x4,
 
     /* U+0067 "g" */
-    0x0, 0x0, 0x6b, 0xef, 0xda, 0x30, 0x4f, 0xff,
-    0x80, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x64, 0xff,
-    0xf8, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0x80, 0x5f, 0xff, 0xfd, 0x86, 0x6b, 0xfe,
-    0xff, 0xf8, 0xb, 0xff, 0xfb, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x80, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xb, 0xff, 0xf8, 0x1f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x81, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf8, 0x2f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x82, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf8, 0x2f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x81, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf8, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0xdf,
-    0xff, 0x70, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0x82, 0x1, 0x5e, 0xff, 0xff, 0x80,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf8,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xfa, 0x4f, 0xff,
-    0x80, 0x0, 0x2a, 0xff, 0xff, 0xe7, 0x4, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x23, 0x10, 0x0, 0x5f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf3, 0x0, 0x2, 0x55, 0x55, 0x56,
-    0x8f, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfe, 0xb7, 0x0, 0x0,
+    0x0, 0xcd, 0x7d, 0xfb, 0x46, 0x9, 0xff, 0x40,
+    0x0, 0x72, 0x50, 0x40, 0x97, 0x18, 0x3, 0xea,
+    0x30, 0xf, 0xa4, 0xc0, 0x39, 0x50, 0x2, 0x27,
+    0x99, 0x20, 0x48, 0x7, 0x70, 0x4, 0x9b, 0xc,
+    0xcb, 0xa1, 0x0, 0xe4, 0x0, 0xa8, 0x3, 0x95,
+    0x0, 0x30, 0x80, 0x44, 0x20, 0x1e, 0xd0, 0xf,
+    0xc2, 0x1, 0xf1, 0x80, 0x63, 0x0, 0xff, 0xf3,
+    0x18, 0x7, 0xff, 0x10, 0x40, 0x23, 0x0, 0xfb,
+    0x0, 0x38, 0x80, 0x27, 0x0, 0xe1, 0x60, 0xe,
+    0xa0, 0xa, 0x20, 0x40, 0x2b, 0xe0, 0x1e, 0x61,
+    0x0, 0x9f, 0x7f, 0xa8, 0x58, 0x3, 0x87, 0x44,
+    0x3, 0xe5, 0xd0, 0xf, 0x1e, 0x28, 0x6, 0x18,
+    0xa0, 0xf, 0xc5, 0x5f, 0xb9, 0xdc, 0x70, 0x10,
+    0xf, 0xf1, 0x18, 0x80, 0x7f, 0xf2, 0x34, 0x2,
+    0xf0, 0xf, 0xf8, 0x9c, 0x2, 0x40, 0x8, 0x95,
+    0x79, 0xa3, 0x40, 0x22, 0x30, 0x9, 0x2a, 0xba,
+    0x5c, 0x3, 0x70, 0x7, 0xff, 0x8, 0x6c, 0xc0,
+    0x3f, 0xe1, 0x48, 0xe4, 0x0, 0x0,
 
     /* U+0068 "h" */
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x7c, 0xff, 0xd9, 0x20, 0x0,
-    0xff, 0xfe, 0x1c, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xff, 0xfe, 0xfe, 0x85, 0x59, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
+    0xff, 0xb8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xcb,
+    0x7c, 0xff, 0x6c, 0x90, 0x7, 0xc3, 0x90, 0x60,
+    0x2, 0x6d, 0x70, 0xf, 0x41, 0x80, 0x7d, 0xa,
+    0x1, 0xcc, 0x2f, 0x54, 0x60, 0xd, 0x60, 0x18,
+    0x4b, 0xe1, 0x55, 0x38, 0x1, 0xa, 0x0, 0x69,
+    0x10, 0xc, 0x6c, 0x1, 0x60, 0x6, 0x40, 0xf,
+    0x60, 0x4, 0x20, 0x10, 0x80, 0x7c, 0xc0, 0x11,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfd, 0xe0,
 
     /* U+0069 "i" */
-    0x0, 0x0, 0x0, 0x4, 0xbd, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xdf, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0x88, 0x88, 0x9f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x8, 0x88, 0x88, 0x89,
-    0xff, 0xfd, 0x88, 0x88, 0x88, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0,
+    0x0, 0xf9, 0x2f, 0x68, 0x80, 0x3f, 0xf8, 0x23,
+    0x68, 0x4b, 0x80, 0x1f, 0xfc, 0x15, 0x0, 0xc2,
+    0x40, 0x1f, 0xf9, 0x80, 0x30, 0x90, 0x7, 0xfe,
+    0x2a, 0x20, 0x3d, 0x0, 0xff, 0xe1, 0x2e, 0xfe,
+    0x18, 0x7, 0xff, 0x89, 0x7f, 0xff, 0xac, 0x3,
+    0xff, 0xc4, 0xef, 0xe6, 0x0, 0xff, 0xc5, 0x11,
+    0xd4, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xfe, 0xe2, 0x3d, 0x40, 0x13, 0x44, 0x78,
+    0x5, 0xdf, 0xcc, 0x1, 0x13, 0xbf, 0x80, 0x3f,
+    0xfb, 0x60,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x9d, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x88, 0x88, 0x88, 0x88, 0x8e,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0x80, 0x7, 0x88, 0x88, 0x8c, 0xff, 0xff, 0xf1,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x0,
+    0x0, 0xfe, 0x2b, 0xfe, 0x70, 0xf, 0xf7, 0x20,
+    0xc, 0x28, 0x7, 0xf1, 0x80, 0x6d, 0x0, 0xfe,
+    0x40, 0xd, 0x80, 0x1f, 0xd4, 0xc4, 0x72, 0x80,
+    0x1f, 0xc3, 0x3b, 0x8c, 0x1, 0xff, 0xd3, 0x1f,
+    0xff, 0xfe, 0x8, 0x80, 0x7f, 0xf4, 0x85, 0xdf,
+    0xf8, 0x40, 0x3a, 0x23, 0xf8, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x98, 0x80,
+    0x7f, 0x88, 0x3, 0xff, 0x82, 0xa0, 0x11, 0x80,
+    0x7f, 0x1d, 0x80, 0x48, 0x0, 0x78, 0x8e, 0xcc,
+    0x8, 0x5, 0x20, 0x9, 0x77, 0xe3, 0x0, 0xd6,
+    0x20, 0x1f, 0xf0, 0xda, 0x0, 0x7f, 0xa, 0x4f,
+    0x20, 0x4,
 
     /* U+006B "k" */
-    0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0xcf,
-    0xff, 0x10, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20,
-    0xcf, 0xff, 0x10, 0x0, 0x0, 0xd, 0xff, 0xf7,
-    0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xc0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x3, 0xff,
-    0xff, 0x30, 0x0, 0xcf, 0xff, 0x10, 0x0, 0xc,
-    0xff, 0xf8, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0,
-    0x7f, 0xff, 0xd0, 0x0, 0x0, 0xcf, 0xff, 0x10,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x65, 0x56, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0xaf, 0xff,
-    0xc0, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x1f,
-    0xff, 0xf6, 0x0, 0x0, 0xcf, 0xff, 0x10, 0x0,
-    0x7, 0xff, 0xfe, 0x10, 0x0, 0xcf, 0xff, 0x10,
-    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0xcf, 0xff,
-    0x10, 0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0xcf,
-    0xff, 0x10, 0x0, 0x0, 0xa, 0xff, 0xfc, 0x0,
-    0xcf, 0xff, 0x10, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x60, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf1,
+    0xcf, 0xf8, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xfd,
+    0xc9, 0xff, 0xac, 0x3, 0xff, 0x23, 0x0, 0x52,
+    0x1, 0xff, 0xa4, 0x2, 0x82, 0x0, 0xff, 0xa0,
+    0x80, 0x6, 0xe0, 0x1f, 0xf1, 0xb8, 0x5, 0xe0,
+    0x1f, 0xfb, 0xc0, 0x27, 0x30, 0xf, 0xf9, 0xcc,
+    0x0, 0x50, 0x1, 0xff, 0x14, 0x0, 0x52, 0x1,
+    0xfd, 0xdf, 0xed, 0x0, 0x99, 0x0, 0x3f, 0xf8,
+    0x96, 0x1, 0xff, 0xc5, 0xa0, 0xf, 0xf4, 0xd5,
+    0x24, 0x2, 0x72, 0x0, 0xfe, 0x75, 0x53, 0x28,
+    0x5, 0xc0, 0x1f, 0xfc, 0x1b, 0x0, 0x8d, 0x80,
+    0x3f, 0xf0, 0xc0, 0x5, 0x2, 0x1, 0xff, 0x9c,
+    0x80, 0x3, 0x0, 0x1f, 0xfc, 0x1e, 0x0, 0x98,
+    0xc0, 0x3f, 0xf1, 0xa8, 0x5, 0xe0, 0x1f, 0xfc,
+    0x1b, 0x0, 0x8d, 0x80, 0x3f, 0xf0, 0xc8, 0x5,
+    0x22,
 
     /* U+006C "l" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x7, 0x88, 0x88, 0x8a,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x98,
-    0x88, 0x88, 0x70, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3a, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x48, 0x7, 0xff, 0x8a, 0x1d, 0xf9,
+    0x40, 0x3f, 0xf3, 0xc4, 0x77, 0x0, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xc6, 0x1, 0xff, 0xc2, 0x60,
+    0x9, 0x44, 0x3, 0xff, 0x82, 0x44, 0x0, 0xbe,
+    0x62, 0x39, 0xc0, 0x3e, 0x80, 0x8, 0x59, 0xdf,
+    0xa0, 0x3, 0xe5, 0x80, 0xf, 0xfe, 0x33, 0xe2,
+    0x88, 0x7, 0xc0,
 
     /* U+006D "m" */
-    0x1f, 0xff, 0x33, 0xcf, 0xd5, 0x0, 0x5d, 0xfd,
-    0x70, 0x1, 0xff, 0xf6, 0xff, 0xff, 0xf5, 0x5f,
-    0xff, 0xff, 0x80, 0x1f, 0xff, 0xcf, 0xff, 0xff,
-    0xec, 0xff, 0xff, 0xff, 0x21, 0xff, 0xfe, 0x20,
-    0x6f, 0xff, 0xd1, 0x7, 0xff, 0xf8, 0x1f, 0xff,
-    0x80, 0x0, 0xef, 0xf7, 0x0, 0xf, 0xff, 0xa1,
-    0xff, 0xf7, 0x0, 0xc, 0xff, 0x60, 0x0, 0xdf,
-    0xfa, 0x1f, 0xff, 0x70, 0x0, 0xcf, 0xf6, 0x0,
-    0xd, 0xff, 0xb1, 0xff, 0xf7, 0x0, 0xc, 0xff,
-    0x60, 0x0, 0xdf, 0xfb, 0x1f, 0xff, 0x70, 0x0,
-    0xcf, 0xf6, 0x0, 0xd, 0xff, 0xb1, 0xff, 0xf7,
-    0x0, 0xc, 0xff, 0x60, 0x0, 0xdf, 0xfb, 0x1f,
-    0xff, 0x70, 0x0, 0xcf, 0xf6, 0x0, 0xd, 0xff,
-    0xb1, 0xff, 0xf7, 0x0, 0xc, 0xff, 0x60, 0x0,
-    0xdf, 0xfb, 0x1f, 0xff, 0x70, 0x0, 0xcf, 0xf6,
-    0x0, 0xd, 0xff, 0xb1, 0xff, 0xf7, 0x0, 0xc,
-    0xff, 0x60, 0x0, 0xdf, 0xfb, 0x1f, 0xff, 0x70,
-    0x0, 0xcf, 0xf6, 0x0, 0xd, 0xff, 0xb1, 0xff,
-    0xf7, 0x0, 0xc, 0xff, 0x60, 0x0, 0xdf, 0xfb,
-    0x1f, 0xff, 0x70, 0x0, 0xcf, 0xf6, 0x0, 0xd,
-    0xff, 0xb1, 0xff, 0xf7, 0x0, 0xc, 0xff, 0x60,
-    0x0, 0xdf, 0xfb, 0x1f, 0xff, 0x70, 0x0, 0xcf,
-    0xf6, 0x0, 0xd, 0xff, 0xb1, 0xff, 0xf7, 0x0,
-    0xc, 0xff, 0x60, 0x0, 0xdf, 0xfb,
+    0x1f, 0xf8, 0xcd, 0x9f, 0xaa, 0x0, 0x5d, 0xfd,
+    0x70, 0xf, 0x2e, 0x18, 0x15, 0x2a, 0xa8, 0x80,
+    0xa2, 0x0, 0x1d, 0x40, 0x1d, 0x72, 0x1, 0xce,
+    0x40, 0x18, 0xb7, 0xe4, 0x0, 0x22, 0xef, 0x80,
+    0xa, 0x80, 0x33, 0x10, 0x30, 0x80, 0x28, 0x41,
+    0xc0, 0x22, 0x0, 0xde, 0x1, 0x10, 0x0, 0x40,
+    0x22, 0x0, 0xff, 0xe4, 0x88, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xe5, 0x0,
 
     /* U+006E "n" */
-    0xff, 0xfe, 0x0, 0x7c, 0xff, 0xd9, 0x20, 0x0,
-    0xff, 0xfe, 0x1c, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xff, 0xfe, 0xfe, 0x85, 0x59, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa,
+    0xff, 0xb8, 0x0, 0xf9, 0xfe, 0xd9, 0x20, 0xf,
+    0x87, 0x20, 0xc0, 0x4, 0xda, 0xe0, 0x1e, 0x83,
+    0x0, 0xfa, 0x14, 0x3, 0x98, 0x5e, 0xa8, 0xc0,
+    0x1a, 0xc0, 0x30, 0x97, 0xc2, 0xaa, 0x70, 0x2,
+    0x14, 0x0, 0xd2, 0x20, 0x18, 0xd8, 0x2, 0xc0,
+    0xc, 0x80, 0x1e, 0xc0, 0x8, 0x40, 0x21, 0x0,
+    0xf9, 0x80, 0x23, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfb, 0xc0,
 
     /* U+006F "o" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x2f, 0xff, 0xfe, 0x86, 0x7a, 0xff,
-    0xff, 0xc0, 0xa, 0xff, 0xfb, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x40, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x7, 0xff, 0xf8, 0x2f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xb3, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x3f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xd3, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfd, 0x3f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xd3, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x3f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc2, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb, 0xf,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x80,
-    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff, 0xf3,
-    0x2, 0xff, 0xff, 0xe9, 0x67, 0xaf, 0xff, 0xfb,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfd, 0xa4,
-    0x0, 0x0,
+    0x0, 0xc2, 0xf7, 0xdf, 0xed, 0xa4, 0x0, 0xf9,
+    0xba, 0x10, 0x40, 0x4, 0xb7, 0x84, 0x1, 0x9e,
+    0x40, 0x3f, 0x8f, 0x4, 0x0, 0x50, 0x1, 0xb,
+    0xcc, 0x28, 0x4, 0x3a, 0x0, 0x80, 0x9, 0x3a,
+    0x19, 0xeb, 0x0, 0x23, 0x40, 0x50, 0xa, 0x80,
+    0x38, 0xe0, 0x2, 0xc2, 0x0, 0x8c, 0x40, 0x3c,
+    0xa0, 0x11, 0x88, 0x4, 0xc0, 0x1f, 0x18, 0x4,
+    0xe0, 0x1f, 0xfc, 0x41, 0x0, 0xff, 0xfb, 0x88,
+    0x80, 0x26, 0x0, 0xf8, 0xc0, 0x27, 0x20, 0x8,
+    0xc4, 0x3, 0xca, 0x1, 0x18, 0x28, 0x5, 0x40,
+    0x1c, 0x70, 0x1, 0x58, 0x40, 0x4, 0x9d, 0x2c,
+    0xf5, 0x80, 0x12, 0x18, 0x14, 0x80, 0x42, 0xd3,
+    0xa, 0x1, 0xd, 0x0, 0x4d, 0x40, 0x1f, 0xc7,
+    0xe2, 0x1, 0x97, 0xa1, 0x4, 0x0, 0x4b, 0x78,
+    0x20, 0x0,
 
     /* U+0070 "p" */
-    0xff, 0xfe, 0x0, 0x6c, 0xff, 0xea, 0x30, 0x0,
-    0xff, 0xfe, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xff, 0xfe, 0xff, 0x96, 0x7a, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x2e, 0xff, 0xf5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xf9,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfb,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x2e, 0xff, 0xf5,
-    0xff, 0xfd, 0xfe, 0x96, 0x79, 0xff, 0xff, 0xe0,
-    0xff, 0xfd, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xff, 0xfd, 0xb, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xfe, 0x0, 0x6c, 0xff, 0xea, 0x30, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xb8, 0x0, 0xd9, 0xfe, 0xea, 0x30, 0xf,
+    0xd7, 0x26, 0x0, 0x15, 0xc7, 0x0, 0xf4, 0x20,
+    0x7, 0xd0, 0xa0, 0x1c, 0xe0, 0xd3, 0xa, 0x1,
+    0xac, 0x3, 0x9, 0x74, 0xb3, 0xd6, 0x88, 0x0,
+    0x54, 0x3, 0x48, 0x80, 0x62, 0x80, 0xb, 0x0,
+    0x32, 0x0, 0x79, 0x40, 0x22, 0x0, 0x84, 0x3,
+    0xe1, 0x0, 0xff, 0xe3, 0xb8, 0x7, 0xff, 0xcd,
+    0xc0, 0x21, 0x0, 0xf8, 0x40, 0x3f, 0x20, 0x7,
+    0x90, 0x2, 0x20, 0xd, 0x22, 0x1, 0x8a, 0x40,
+    0x2c, 0x0, 0x88, 0x9f, 0x2c, 0xf3, 0xa2, 0x0,
+    0x15, 0x0, 0xce, 0x2d, 0x30, 0xc0, 0x1a, 0xc0,
+    0x3a, 0x10, 0x3, 0xe8, 0x50, 0xc, 0x61, 0x72,
+    0x60, 0x1, 0x5c, 0x70, 0xf, 0xcd, 0x9f, 0xee,
+    0xa3, 0x0, 0xff, 0xff, 0x80, 0x7e,
 
     /* U+0071 "q" */
-    0x0, 0x0, 0x6b, 0xef, 0xea, 0x20, 0x4f, 0xff,
-    0x90, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x54, 0xff,
-    0xf9, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x6f,
-    0xff, 0x90, 0x5f, 0xff, 0xfd, 0x86, 0x7b, 0xfd,
-    0xff, 0xf9, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x90, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf9, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x92, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf9, 0x2f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x92, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf9, 0x2f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x92, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf9, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x91, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf9, 0xf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90,
-    0xcf, 0xff, 0x90, 0x0, 0x0, 0x6f, 0xff, 0xf9,
-    0x5, 0xff, 0xff, 0xd8, 0x66, 0xbf, 0xbf, 0xff,
-    0x90, 0xc, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff,
-    0xf9, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xf4, 0x4f,
-    0xff, 0x90, 0x0, 0x6, 0xce, 0xfe, 0xa2, 0x4,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf9,
+    0x0, 0xcd, 0x7d, 0xfd, 0x44, 0x9, 0xff, 0x48,
+    0x0, 0x72, 0x50, 0x40, 0x57, 0x54, 0x3, 0xed,
+    0x30, 0xf, 0xa8, 0x80, 0x39, 0x4c, 0x2, 0x27,
+    0x98, 0x40, 0xb0, 0xe, 0x90, 0x9, 0xb6, 0x19,
+    0xee, 0x48, 0x3, 0x8c, 0x2, 0x90, 0xe, 0x64,
+    0x0, 0xc2, 0x1, 0x18, 0x7, 0xda, 0x1, 0x8c,
+    0x2, 0x70, 0xf, 0x8c, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xc2, 0x30, 0x9, 0xc0, 0x3e, 0x30, 0xc,
+    0x20, 0x11, 0x80, 0x7d, 0xa0, 0x1c, 0x60, 0x14,
+    0x80, 0x73, 0x20, 0x7, 0x48, 0x4, 0xdb, 0xc,
+    0xcb, 0x94, 0x0, 0xe5, 0x30, 0x8, 0x9e, 0x64,
+    0x81, 0xc0, 0x1e, 0xd3, 0x0, 0xfa, 0xc4, 0x3,
+    0xc3, 0x92, 0x62, 0x2, 0xba, 0x80, 0x1f, 0xcd,
+    0x9d, 0xfd, 0x44, 0x1, 0xff, 0xc6, 0x10, 0xf,
+    0xff, 0xe0,
 
     /* U+0072 "r" */
-    0x4f, 0xff, 0x90, 0x18, 0xdf, 0xfd, 0x92, 0x0,
-    0x4, 0xff, 0xf9, 0x2e, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x4f, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x4, 0xff, 0xfd, 0xfd, 0x76, 0x7b, 0xff,
-    0xff, 0xb0, 0x4f, 0xff, 0xfa, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x14, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xc, 0xff, 0xf4, 0x4f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0x64, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf6, 0x4f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x64, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x4f, 0xfa, 0x40, 0x63, 0x7f, 0xdb, 0x24, 0x1,
+    0xf8, 0xbd, 0xc8, 0x0, 0x4d, 0xaa, 0x1, 0xf7,
+    0x88, 0x7, 0xd4, 0x60, 0x1c, 0x84, 0x48, 0x98,
+    0x40, 0xd, 0x0, 0x1c, 0x4b, 0xae, 0xcf, 0x72,
+    0x1, 0x20, 0x80, 0x75, 0x80, 0x73, 0x18, 0x4,
+    0xa0, 0x19, 0x4, 0x3, 0xca, 0x1, 0x10, 0x6,
+    0x10, 0xf, 0xb8, 0x3, 0xff, 0xaa, 0xff, 0xf3,
+    0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfc, 0x80,
 
     /* U+0073 "s" */
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xfc, 0x92, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0xaf, 0xff, 0xd5, 0x21, 0x13, 0x9f,
-    0xff, 0xf2, 0xf, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x70, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0x44, 0x42, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xd6, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0x84, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x5, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x1, 0x35, 0x7a, 0xdf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x3c,
-    0xcc, 0x70, 0x0, 0x0, 0x0, 0xe, 0xff, 0xe2,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x4, 0xff, 0xfc,
-    0xd, 0xff, 0xfd, 0x63, 0x33, 0x48, 0xff, 0xff,
-    0x70, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xff, 0xda,
-    0x50, 0x0,
+    0x0, 0x85, 0xef, 0xbf, 0xf6, 0x49, 0x0, 0x72,
+    0x7c, 0x20, 0x80, 0x63, 0x6d, 0x90, 0x8, 0xac,
+    0x40, 0x3f, 0xcd, 0x20, 0x8, 0x0, 0x8a, 0xb7,
+    0xb9, 0x8c, 0x1, 0x31, 0x2, 0x80, 0x7, 0x14,
+    0x84, 0x47, 0x2c, 0x1, 0x28, 0x6, 0x51, 0x0,
+    0xf4, 0x5d, 0xca, 0x1, 0x94, 0x3, 0xe1, 0x44,
+    0x88, 0xc, 0x0, 0x3a, 0xc8, 0x40, 0x1f, 0xd2,
+    0x1, 0x14, 0xde, 0xff, 0x5c, 0x20, 0x6, 0x56,
+    0x0, 0xf8, 0x51, 0xef, 0x4, 0x2, 0x9a, 0x40,
+    0xf, 0xe3, 0xc0, 0xc, 0xb7, 0xfd, 0x95, 0xa,
+    0x40, 0x11, 0x38, 0x7, 0x84, 0xd5, 0xeb, 0x60,
+    0x2, 0xc0, 0xf, 0xfc, 0xe0, 0x12, 0x9e, 0x64,
+    0xe0, 0x1f, 0x84, 0x2, 0x13, 0x3a, 0x44, 0x3,
+    0xc8, 0x20, 0x2, 0x28, 0x0, 0x38, 0xc6, 0x72,
+    0x45, 0x80, 0x56, 0x12, 0x1, 0x14, 0xe6, 0x56,
+    0xe0, 0x11, 0x38, 0x25, 0x8, 0x7, 0xf8, 0xfc,
+    0x2, 0x5f, 0x84, 0x10, 0xc, 0x4b, 0x58, 0x40,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x48, 0x88, 0x88, 0xff, 0xff, 0x88, 0x88, 0x88,
-    0x87, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf9, 0x88, 0x88, 0x86, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xff,
-    0xfc,
+    0x0, 0xf7, 0xfe, 0x0, 0xff, 0xff, 0x80, 0x74,
+    0x7f, 0xf0, 0x6, 0xff, 0xfc, 0x1, 0xff, 0xd8,
+    0xc7, 0x7e, 0x0, 0xce, 0xff, 0x42, 0x44, 0x70,
+    0x6, 0x88, 0xf9, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xfe, 0x30, 0x80, 0x7f, 0xf1,
+    0x4c, 0x2, 0x40, 0xf, 0xfe, 0xa, 0x0, 0x57,
+    0x31, 0x1c, 0xc0, 0x1e, 0xb0, 0xc, 0xce, 0xfd,
+    0x40, 0x1e, 0x2a, 0x0, 0xff, 0xe2, 0xae, 0xb0,
+    0x80, 0x7c,
 
     /* U+0075 "u" */
-    0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xa0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfa, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xa0, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfa, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xa0, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfa, 0xf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xa0, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfa, 0xf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xa0, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfa, 0xf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xa0, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xfa, 0xf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x90, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8, 0xc,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x60,
-    0x8f, 0xff, 0xd1, 0x0, 0x0, 0x5f, 0xff, 0xf1,
-    0x1, 0xff, 0xff, 0xe8, 0x66, 0xbf, 0xff, 0xf9,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x7b, 0xef, 0xfd, 0x94,
-    0x0, 0x0,
+    0xf, 0xfb, 0x40, 0x3e, 0x3f, 0xfa, 0x80, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x2b,
+    0x80, 0x46, 0x1, 0x88, 0x3, 0xe1, 0x0, 0x84,
+    0xc, 0x2, 0x40, 0xf, 0x78, 0x5, 0xc0, 0x80,
+    0x14, 0x88, 0x6, 0x55, 0x0, 0x4e, 0x12, 0x1,
+    0x17, 0xc3, 0x32, 0xe8, 0x2, 0x61, 0x1, 0xa0,
+    0x8, 0x5e, 0x64, 0x80, 0x11, 0x48, 0x4, 0xb4,
+    0x20, 0x1f, 0x93, 0x0, 0x39, 0x7a, 0x10, 0x40,
+    0x4, 0xd7, 0x61, 0x0, 0x0,
 
     /* U+0076 "v" */
-    0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xd0, 0xdf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf7, 0x8, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x20, 0x3f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0x0, 0xdf,
-    0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0xf7, 0x0,
-    0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x20, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x2f,
-    0xff, 0xd0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0x7, 0xff, 0xf7, 0x0, 0x0, 0x8, 0xff, 0xf6,
-    0x0, 0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x3f,
-    0xff, 0xb0, 0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x10, 0x6, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf6, 0x0, 0xcf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xb0, 0x1f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x5, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf4, 0x9f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x8d, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfd, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x3f, 0xfb, 0x40, 0x3f, 0x93, 0xfe, 0xd3, 0x20,
+    0x1, 0x18, 0x7, 0xed, 0x0, 0xa8, 0x14, 0x2,
+    0xb0, 0xf, 0xce, 0x1, 0x28, 0x58, 0x4, 0xa0,
+    0x1f, 0x18, 0x80, 0x8, 0x80, 0x64, 0x0, 0x22,
+    0x0, 0x7a, 0xc0, 0x2a, 0x0, 0x94, 0x2, 0x50,
+    0xf, 0x28, 0x4, 0xa0, 0x15, 0x80, 0x56, 0x1,
+    0xc4, 0x40, 0x1, 0x10, 0x2, 0x32, 0x0, 0x18,
+    0x80, 0x65, 0x0, 0xa8, 0x3, 0x94, 0x2, 0x70,
+    0xd, 0x60, 0x12, 0x80, 0x75, 0x80, 0x5a, 0x1,
+    0x9, 0x80, 0x8, 0x80, 0x1c, 0x64, 0x0, 0x41,
+    0x0, 0x38, 0x5, 0x40, 0x1f, 0x28, 0x4, 0xe0,
+    0xa, 0x0, 0x94, 0x3, 0xeb, 0x0, 0xb4, 0x4,
+    0xc0, 0x4, 0x40, 0xf, 0x8c, 0x80, 0x8, 0x8,
+    0x1, 0x50, 0x7, 0xf2, 0x80, 0x49, 0x80, 0x12,
+    0x80, 0x7f, 0x58, 0x5, 0x88, 0x0, 0x32, 0x0,
+    0xfe, 0x32, 0x0, 0x29, 0x0, 0x2c, 0x3, 0xfe,
+    0x50, 0x1, 0x0, 0x4a, 0x1, 0xff, 0x58, 0x7,
+    0x19, 0x0, 0x7f, 0xc6, 0x40, 0x1a, 0xc0, 0x3c,
 
     /* U+0077 "w" */
-    0x1f, 0xff, 0x10, 0x0, 0xf, 0xff, 0xa0, 0x0,
-    0x6, 0xff, 0xa0, 0xef, 0xf3, 0x0, 0x2, 0xff,
-    0xfd, 0x0, 0x0, 0x8f, 0xf8, 0xc, 0xff, 0x60,
-    0x0, 0x5f, 0xff, 0xf0, 0x0, 0xb, 0xff, 0x50,
-    0x9f, 0xf8, 0x0, 0x8, 0xfd, 0xff, 0x20, 0x0,
-    0xdf, 0xf3, 0x7, 0xff, 0xa0, 0x0, 0xbf, 0xaf,
-    0xf5, 0x0, 0xf, 0xff, 0x0, 0x4f, 0xfd, 0x0,
-    0xe, 0xf7, 0xef, 0x80, 0x2, 0xff, 0xd0, 0x2,
-    0xff, 0xf0, 0x1, 0xff, 0x5c, 0xfb, 0x0, 0x4f,
-    0xfb, 0x0, 0xf, 0xff, 0x10, 0x3f, 0xf3, 0x9f,
-    0xe0, 0x6, 0xff, 0x80, 0x0, 0xdf, 0xf3, 0x6,
-    0xff, 0x7, 0xff, 0x0, 0x9f, 0xf6, 0x0, 0xa,
-    0xff, 0x60, 0x9f, 0xe0, 0x4f, 0xf3, 0xb, 0xff,
-    0x30, 0x0, 0x8f, 0xf8, 0xc, 0xfb, 0x2, 0xff,
-    0x60, 0xef, 0xf0, 0x0, 0x5, 0xff, 0xa0, 0xff,
-    0x80, 0xf, 0xf9, 0xf, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x1f, 0xf6, 0x0, 0xdf, 0xc2, 0xff, 0xb0,
-    0x0, 0x0, 0xff, 0xf4, 0xff, 0x30, 0xa, 0xfe,
-    0x4f, 0xf8, 0x0, 0x0, 0xe, 0xff, 0x7f, 0xf0,
-    0x0, 0x7f, 0xf7, 0xff, 0x60, 0x0, 0x0, 0xbf,
-    0xfb, 0xfe, 0x0, 0x5, 0xff, 0xaf, 0xf3, 0x0,
-    0x0, 0x8, 0xff, 0xef, 0xb0, 0x0, 0x2f, 0xfd,
-    0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x60, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0xbf, 0xff,
-    0x90, 0x0,
+    0x1f, 0xf8, 0x40, 0x37, 0xfd, 0x40, 0x19, 0xbf,
+    0xd4, 0x22, 0x0, 0x10, 0x4, 0x40, 0x13, 0x80,
+    0x6e, 0x0, 0x10, 0x10, 0x1, 0x40, 0x27, 0x0,
+    0x88, 0x3, 0x18, 0x3, 0x41, 0x40, 0x1c, 0x1,
+    0x68, 0x10, 0x0, 0x80, 0x26, 0x0, 0x30, 0x70,
+    0x0, 0x80, 0x23, 0x7, 0x0, 0x38, 0x4, 0x40,
+    0x3, 0x3, 0x0, 0x38, 0x4, 0xa1, 0xa2, 0x1a,
+    0x0, 0x20, 0x1, 0x0, 0x18, 0x0, 0x40, 0x1,
+    0x10, 0x11, 0x0, 0xc0, 0xc, 0x0, 0x60, 0x1,
+    0x0, 0x42, 0x4, 0x0, 0x65, 0x5, 0x0, 0x10,
+    0x0, 0xc0, 0x22, 0x0, 0x10, 0x28, 0x0, 0xf8,
+    0x4, 0x1, 0xe0, 0xe, 0x0, 0x9c, 0x0, 0xa1,
+    0xe0, 0x20, 0x60, 0x3, 0x2, 0x0, 0x28, 0x4,
+    0x40, 0xe, 0x5, 0x5, 0x6, 0x0, 0x28, 0x28,
+    0x0, 0xc0, 0x2d, 0x0, 0x10, 0x18, 0x18, 0x10,
+    0x3, 0xc0, 0x40, 0x40, 0x33, 0x0, 0x18, 0x40,
+    0x1c, 0x0, 0x20, 0x52, 0x0, 0x28, 0x6, 0x30,
+    0x1, 0xa8, 0x1, 0x40, 0xe, 0x4, 0xc0, 0x3,
+    0x0, 0xe1, 0x0, 0x18, 0x0, 0xc0, 0x1a, 0x2,
+    0x60, 0xe, 0x0, 0xe5, 0x0, 0x60, 0x8, 0x4,
+    0x40, 0xd, 0x0, 0x28, 0x7, 0x18, 0x1, 0x41,
+    0x40, 0x27, 0x0, 0x38, 0x0, 0x80, 0x3b, 0x80,
+    0x2, 0x6, 0x1, 0x10, 0x0, 0x80, 0x44, 0x1,
+    0xca, 0x1, 0xb8, 0x3, 0x10, 0x4, 0xa0, 0x1e,
+    0x20, 0xc, 0xa0, 0x19, 0x80, 0x22, 0x0, 0x80,
 
     /* U+0078 "x" */
-    0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x50, 0x1, 0xef, 0xff, 0x60, 0x0, 0x0,
-    0xc, 0xff, 0xfa, 0x0, 0x0, 0x5f, 0xff, 0xe1,
-    0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x40, 0xa, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xe0, 0x4f,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf7, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfb, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x8f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x80, 0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfd, 0x0, 0x4, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x2f, 0xff, 0xf4, 0x0, 0x0, 0xaf, 0xff,
-    0xb0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0, 0x0,
-    0x1e, 0xff, 0xf5, 0x0, 0x7, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0x2f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0,
+    0xa, 0xff, 0xac, 0x3, 0xe2, 0xff, 0xca, 0x0,
+    0xb1, 0x0, 0x23, 0x0, 0x7b, 0x80, 0x25, 0x50,
+    0x0, 0x6c, 0x2, 0x81, 0x0, 0xcc, 0x60, 0x1,
+    0xb0, 0xc, 0xaa, 0x0, 0xd, 0x80, 0x43, 0x20,
+    0x15, 0x8, 0x7, 0x58, 0x80, 0x15, 0x0, 0x16,
+    0x1, 0x2a, 0x0, 0x78, 0x68, 0x2, 0xa0, 0x45,
+    0x0, 0xd, 0x80, 0x7e, 0x45, 0x0, 0xb, 0xc8,
+    0x5, 0x42, 0x1, 0xfd, 0x62, 0x0, 0x82, 0x0,
+    0x32, 0x0, 0x7f, 0x86, 0x80, 0x38, 0x64, 0x3,
+    0xff, 0x22, 0x0, 0x35, 0x80, 0x7f, 0xf0, 0x45,
+    0x0, 0x37, 0x80, 0x7f, 0xf0, 0x68, 0x3, 0x95,
+    0x40, 0x1f, 0xf3, 0x20, 0x1, 0x0, 0x2b, 0x10,
+    0xf, 0xe2, 0x90, 0xa, 0x5c, 0x0, 0x36, 0x1,
+    0xfd, 0x20, 0x13, 0x94, 0x8, 0x1, 0x54, 0x1,
+    0xf3, 0x20, 0x0, 0xa0, 0x1, 0x40, 0x15, 0x88,
+    0x7, 0x14, 0x80, 0x52, 0x1, 0x22, 0x80, 0x6,
+    0x80, 0x3b, 0x80, 0x26, 0x40, 0xd, 0x62, 0x0,
+    0x45, 0x0, 0x9c, 0xc0, 0x3, 0x0, 0x1c, 0x36,
+    0x1, 0x58, 0x81, 0x40, 0x5, 0x62, 0x1, 0xe5,
+    0x40, 0x0, 0xd0, 0x0,
 
     /* U+0079 "y" */
-    0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xc0, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf6, 0x5, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x10, 0xe, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x0, 0x9f,
-    0xff, 0x70, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x0,
-    0x2, 0xff, 0xfd, 0x0, 0x0, 0x1, 0xff, 0xfe,
-    0x0, 0x0, 0xc, 0xff, 0xf3, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x5f, 0xff, 0x90, 0x0,
-    0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf6, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xc0, 0xd, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x23, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf7, 0x8f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xcc, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfb, 0x80, 0x3f, 0x93, 0xfe, 0xc2, 0x30,
+    0x0, 0xa8, 0x7, 0xee, 0x0, 0xa8, 0x24, 0x2,
+    0xe0, 0xf, 0xca, 0x1, 0x38, 0x28, 0x80, 0x10,
+    0x40, 0x3c, 0xa0, 0x12, 0x88, 0x1, 0xc0, 0x26,
+    0x0, 0xf7, 0x0, 0x5c, 0x1, 0x58, 0x5, 0x40,
+    0x1c, 0x28, 0x0, 0x14, 0x0, 0x88, 0xc0, 0x4,
+    0x60, 0x19, 0x80, 0x26, 0x0, 0xe9, 0x0, 0xa8,
+    0x3, 0x58, 0x5, 0x40, 0x1c, 0xa2, 0x0, 0x60,
+    0x8, 0x8c, 0x0, 0x64, 0x1, 0xe7, 0x0, 0x98,
+    0x1, 0x40, 0x15, 0x0, 0x7d, 0x60, 0x15, 0x0,
+    0x14, 0x2, 0x70, 0xf, 0x88, 0xc0, 0x6, 0x46,
+    0x40, 0x5, 0x10, 0xf, 0xd2, 0x1, 0x2d, 0x80,
+    0x5c, 0x1, 0xfc, 0xa2, 0x0, 0xb4, 0x0, 0xa,
+    0x0, 0x7f, 0x98, 0x0, 0x66, 0x0, 0x30, 0x7,
+    0xfd, 0x40, 0x1e, 0xa0, 0xf, 0xf8, 0x8c, 0x3,
+    0x19, 0x0, 0x7f, 0xe9, 0x0, 0xd4, 0x1, 0xff,
+    0xc1, 0x40, 0xc, 0xe0, 0x1f, 0xfc, 0x14, 0x0,
+    0x94, 0x40, 0x3f, 0xf8, 0x32, 0x1, 0x70, 0x7,
+    0xff, 0x4, 0x8c, 0x0, 0x28, 0x1, 0xff, 0xc1,
+    0xa0, 0x9, 0x80, 0x3f, 0xf8, 0x4c, 0x1, 0x50,
+    0x7, 0xff, 0x5, 0x4, 0x0, 0x64, 0x1, 0xff,
+    0xc1, 0xe0, 0xa, 0x80, 0x3f, 0x80,
 
     /* U+007A "z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x46, 0x66, 0x66, 0x66, 0x66, 0xbf, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xc6, 0x66, 0x66, 0x66, 0x66, 0x63,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0xaf, 0xff, 0xfe, 0x11, 0x80, 0x7f, 0xf5, 0x3a,
+    0x67, 0xf9, 0x0, 0x30, 0xa3, 0x37, 0xe5, 0x40,
+    0xa, 0x8, 0x3, 0xf0, 0xe8, 0x4, 0xae, 0x1,
+    0xfd, 0xa2, 0x0, 0x3a, 0x0, 0xfe, 0xa3, 0x0,
+    0x16, 0x80, 0x7f, 0x3a, 0x80, 0x5e, 0x20, 0x1f,
+    0x92, 0x0, 0x2b, 0x20, 0xf, 0xc5, 0x60, 0x14,
+    0xa0, 0x7, 0xe1, 0xf0, 0x9, 0x98, 0x1, 0xfd,
+    0xa4, 0x0, 0x49, 0x0, 0xfe, 0x93, 0x0, 0x15,
+    0x0, 0x7f, 0x33, 0x0, 0x3, 0xe2, 0x1, 0xf9,
+    0x24, 0x2, 0xa2, 0x0, 0xfe, 0xa0, 0x8, 0xc9,
+    0x9b, 0xf8, 0xc4, 0x2, 0x39, 0x9f, 0xf5, 0x0,
+    0x7f, 0xf5, 0x0,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x57, 0x78,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0x3,
-    0x88, 0x88, 0x8a, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfa, 0x88, 0x20,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xff,
-    0xf4,
+    0x0, 0xff, 0x85, 0x5d, 0xd0, 0x40, 0x1f, 0xc5,
+    0x7d, 0x51, 0x7, 0x60, 0xf, 0xc5, 0xa8, 0x1,
+    0xff, 0xc2, 0xf0, 0xf, 0xfe, 0x19, 0x90, 0x4,
+    0xdb, 0xfe, 0x40, 0xf, 0x98, 0x2, 0x49, 0x20,
+    0xf, 0xfe, 0x11, 0x80, 0x7f, 0xe1, 0x0, 0x84,
+    0x3, 0xff, 0x30, 0x4, 0x40, 0x1f, 0xf8, 0xc0,
+    0x27, 0x0, 0xff, 0xc2, 0x1, 0x10, 0x7, 0xff,
+    0x4, 0x40, 0x2, 0x1, 0xff, 0xc1, 0x30, 0x8,
+    0x40, 0x3f, 0xf1, 0x80, 0x42, 0x1, 0xff, 0x20,
+    0x80, 0xc, 0x3, 0x8e, 0x23, 0xaa, 0xc0, 0x2f,
+    0x0, 0xe5, 0x77, 0xe5, 0x0, 0x2e, 0x98, 0x7,
+    0xff, 0x5, 0x78, 0x80, 0x3f, 0xf8, 0x4b, 0x76,
+    0x0, 0xf3, 0x7f, 0xf6, 0x20, 0x1, 0x20, 0x3,
+    0xfe, 0x3a, 0x0, 0x9c, 0x3, 0xff, 0x9, 0x0,
+    0x42, 0x1, 0xff, 0xc4, 0x10, 0xf, 0xfc, 0x60,
+    0x1, 0x0, 0xff, 0xe0, 0x88, 0x0, 0xc0, 0x3f,
+    0xf1, 0x0, 0x4c, 0x1, 0xff, 0x84, 0x2, 0x10,
+    0xf, 0xfc, 0xc0, 0x11, 0x0, 0x7f, 0xf1, 0x4,
+    0x3, 0xff, 0x8, 0x4, 0xe2, 0x1, 0xff, 0x28,
+    0x4, 0x3d, 0x51, 0x2, 0x0, 0xf8, 0x5c, 0x3,
+    0x2b, 0xb9, 0x80, 0x3f, 0x43, 0x0, 0x7f, 0xf1,
+    0x27, 0x18, 0x80, 0x30,
 
     /* U+007C "|" */
-    0x19, 0x99, 0x62, 0xff, 0xfc, 0x2f, 0xff, 0xc2,
-    0xff, 0xfc, 0x2f, 0xff, 0xc2, 0xff, 0xfc, 0x2f,
-    0xff, 0xc2, 0xff, 0xfc, 0x2f, 0xff, 0xc2, 0xff,
-    0xfc, 0x2f, 0xff, 0xc2, 0xff, 0xfc, 0x2f, 0xff,
-    0xc2, 0xff, 0xfc, 0x2f, 0xff, 0xc2, 0xff, 0xfc,
-    0x2f, 0xff, 0xc2, 0xff, 0xfc, 0x2f, 0xff, 0xc2,
-    0xff, 0xfc, 0x2f, 0xff, 0xc2, 0xff, 0xfc, 0x2f,
-    0xff, 0xc2, 0xff, 0xfc, 0x2f, 0xff, 0xc2, 0xff,
-    0xfc, 0x2f, 0xff, 0xc2, 0xff, 0xfc, 0x2f, 0xff,
-    0xc2, 0xff, 0xfc, 0x2f, 0xff, 0xc2, 0xff, 0xfc,
-    0x2f, 0xff, 0xc2, 0xff, 0xfc,
+    0x19, 0x99, 0x8d, 0x9a, 0xa0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xfc,
 
     /* U+007D "}" */
-    0x58, 0x76, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xc8, 0x88, 0x88, 0x80,
-    0x0, 0x0, 0x1, 0x9e, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x58,
-    0x8c, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xec, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x58, 0x76, 0x40, 0xf, 0xfd, 0xcf, 0x13, 0x7c,
+    0xe0, 0x1f, 0xfc, 0x31, 0x8b, 0x0, 0xff, 0xe2,
+    0x24, 0x0, 0x7e, 0xbf, 0xf5, 0x98, 0x4, 0xc0,
+    0x1f, 0xf2, 0x68, 0x4, 0x20, 0x1f, 0xf8, 0x44,
+    0x1, 0xff, 0xc4, 0x10, 0x1, 0x0, 0x7f, 0xe2,
+    0x0, 0x98, 0x3, 0xff, 0x30, 0x4, 0x40, 0x1f,
+    0xf8, 0x80, 0x2e, 0x0, 0xff, 0xdc, 0x1, 0x18,
+    0x7, 0xfe, 0x20, 0x9, 0xc0, 0x3f, 0xf0, 0x80,
+    0x7f, 0xf1, 0xc, 0x2, 0xa0, 0xf, 0xfd, 0x24,
+    0x0, 0x6c, 0x88, 0xf0, 0x7, 0xe, 0x30, 0x81,
+    0xbb, 0xf8, 0x3, 0xc3, 0xaa, 0x1, 0xff, 0xc2,
+    0x8b, 0x40, 0xf, 0xfe, 0xa, 0xb8, 0x0, 0x6f,
+    0xbf, 0xf8, 0x3, 0xbc, 0x2, 0xb4, 0x10, 0xf,
+    0xf0, 0x80, 0x4c, 0x1, 0xff, 0x88, 0x3, 0xff,
+    0x89, 0xc0, 0x13, 0x0, 0x7f, 0xe2, 0x0, 0xb4,
+    0x3, 0xff, 0x30, 0x4, 0x40, 0x1f, 0xf8, 0x80,
+    0x26, 0x0, 0xff, 0xc2, 0x1, 0x10, 0x7, 0xff,
+    0x4, 0x40, 0x2, 0x1, 0xff, 0x94, 0x40, 0x3f,
+    0xe5, 0x88, 0x65, 0x0, 0x48, 0x1, 0xfb, 0x9d,
+    0xc6, 0x1, 0xa0, 0x3, 0xff, 0x84, 0x36, 0x60,
+    0x1f, 0xf0, 0x9c, 0x7a, 0x0, 0x7f, 0x0,
 
     /* U+007E "~" */
-    0x0, 0x5c, 0xff, 0xd7, 0x0, 0x0, 0x0, 0x88,
-    0x83, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xff, 0xf6, 0x4f, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0xff, 0xf6, 0xaf, 0xff, 0x42, 0xbf, 0xff,
-    0x60, 0x1, 0xff, 0xf6, 0xcf, 0xfb, 0x0, 0xd,
-    0xff, 0xf6, 0x28, 0xff, 0xf3, 0xcf, 0xfa, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xd0, 0xcf, 0xfa,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x30, 0x79,
-    0x96, 0x0, 0x0, 0x2, 0xae, 0xfe, 0xa2, 0x0
+    0x0, 0x2e, 0x7f, 0xb5, 0xc0, 0x3d, 0x11, 0x18,
+    0x4d, 0x18, 0x0, 0xa2, 0xc0, 0x39, 0xde, 0x54,
+    0x60, 0xf, 0x24, 0x80, 0x7e, 0xe0, 0xa, 0xf5,
+    0x0, 0xc, 0xc0, 0x0, 0x80, 0x66, 0x0, 0x22,
+    0xa, 0xc8, 0x1, 0x2c, 0x52, 0x1, 0x28, 0x4,
+    0x20, 0x17, 0x88, 0x2, 0x75, 0xc0, 0x4, 0x60,
+    0x1f, 0x15, 0x0, 0x7d, 0xc1, 0x6c, 0xcc, 0x0,
+    0xc9, 0xaa, 0x20, 0x2b, 0xa6, 0x0,
 };
 
 
@@ -2616,99 +1558,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 346, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 346, .box_w = 7, .box_h = 26, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 91, .adv_w = 346, .box_w = 13, .box_h = 11, .ofs_x = 4, .ofs_y = 15},
-    {.bitmap_index = 163, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 423, .adv_w = 346, .box_w = 18, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 747, .adv_w = 346, .box_w = 22, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1033, .adv_w = 346, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1332, .adv_w = 346, .box_w = 5, .box_h = 11, .ofs_x = 8, .ofs_y = 15},
-    {.bitmap_index = 1360, .adv_w = 346, .box_w = 12, .box_h = 35, .ofs_x = 6, .ofs_y = -5},
-    {.bitmap_index = 1570, .adv_w = 346, .box_w = 12, .box_h = 35, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 1780, .adv_w = 346, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1970, .adv_w = 346, .box_w = 18, .box_h = 17, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 2123, .adv_w = 346, .box_w = 7, .box_h = 11, .ofs_x = 7, .ofs_y = -6},
-    {.bitmap_index = 2162, .adv_w = 346, .box_w = 12, .box_h = 4, .ofs_x = 5, .ofs_y = 10},
-    {.bitmap_index = 2186, .adv_w = 346, .box_w = 7, .box_h = 7, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 2211, .adv_w = 346, .box_w = 18, .box_h = 34, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 2517, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2738, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 2959, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3193, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3414, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3622, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3843, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4077, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4311, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4545, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4779, .adv_w = 346, .box_w = 7, .box_h = 20, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 4849, .adv_w = 346, .box_w = 8, .box_h = 26, .ofs_x = 7, .ofs_y = -6},
-    {.bitmap_index = 4953, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 5123, .adv_w = 346, .box_w = 16, .box_h = 12, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 5219, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 5389, .adv_w = 346, .box_w = 14, .box_h = 26, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 5571, .adv_w = 346, .box_w = 20, .box_h = 32, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 5891, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6151, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6372, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6593, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6814, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7022, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7243, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7464, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7672, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7880, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8114, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8348, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8556, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8790, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9011, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9232, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9466, .adv_w = 346, .box_w = 18, .box_h = 32, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 9754, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9975, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10209, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10456, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10677, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10937, .adv_w = 346, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11210, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11470, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11730, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11951, .adv_w = 346, .box_w = 10, .box_h = 34, .ofs_x = 7, .ofs_y = -4},
-    {.bitmap_index = 12121, .adv_w = 346, .box_w = 18, .box_h = 34, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 12427, .adv_w = 346, .box_w = 10, .box_h = 34, .ofs_x = 5, .ofs_y = -4},
-    {.bitmap_index = 12597, .adv_w = 346, .box_w = 17, .box_h = 14, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 12716, .adv_w = 346, .box_w = 18, .box_h = 4, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 12752, .adv_w = 346, .box_w = 9, .box_h = 5, .ofs_x = 5, .ofs_y = 23},
-    {.bitmap_index = 12775, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12945, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 13153, .adv_w = 346, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13333, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13554, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13724, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13971, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 14192, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14400, .adv_w = 346, .box_w = 19, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14666, .adv_w = 346, .box_w = 15, .box_h = 34, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 14921, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15155, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15402, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15592, .adv_w = 346, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15752, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15922, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 16130, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 16351, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16521, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16691, .adv_w = 346, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16916, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17086, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17276, .adv_w = 346, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17486, .adv_w = 346, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17686, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 17933, .adv_w = 346, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18093, .adv_w = 346, .box_w = 17, .box_h = 34, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 18382, .adv_w = 346, .box_w = 5, .box_h = 34, .ofs_x = 8, .ofs_y = -4},
-    {.bitmap_index = 18467, .adv_w = 346, .box_w = 17, .box_h = 34, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 18756, .adv_w = 346, .box_w = 18, .box_h = 8, .ofs_x = 2, .ofs_y = 9}
+    {.bitmap_index = 61, .adv_w = 346, .box_w = 13, .box_h = 11, .ofs_x = 4, .ofs_y = 15},
+    {.bitmap_index = 104, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 299, .adv_w = 346, .box_w = 18, .box_h = 36, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 497, .adv_w = 346, .box_w = 22, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 727, .adv_w = 346, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 950, .adv_w = 346, .box_w = 5, .box_h = 11, .ofs_x = 8, .ofs_y = 15},
+    {.bitmap_index = 968, .adv_w = 346, .box_w = 12, .box_h = 35, .ofs_x = 6, .ofs_y = -5},
+    {.bitmap_index = 1096, .adv_w = 346, .box_w = 12, .box_h = 35, .ofs_x = 4, .ofs_y = -5},
+    {.bitmap_index = 1227, .adv_w = 346, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1352, .adv_w = 346, .box_w = 18, .box_h = 17, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 1395, .adv_w = 346, .box_w = 7, .box_h = 11, .ofs_x = 7, .ofs_y = -6},
+    {.bitmap_index = 1432, .adv_w = 346, .box_w = 12, .box_h = 4, .ofs_x = 5, .ofs_y = 10},
+    {.bitmap_index = 1442, .adv_w = 346, .box_w = 7, .box_h = 7, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 1464, .adv_w = 346, .box_w = 18, .box_h = 34, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 1641, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1785, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 1854, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2006, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2149, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2254, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2371, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2540, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2669, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2862, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3033, .adv_w = 346, .box_w = 7, .box_h = 20, .ofs_x = 7, .ofs_y = 0},
+    {.bitmap_index = 3076, .adv_w = 346, .box_w = 8, .box_h = 26, .ofs_x = 7, .ofs_y = -6},
+    {.bitmap_index = 3143, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3258, .adv_w = 346, .box_w = 16, .box_h = 12, .ofs_x = 3, .ofs_y = 6},
+    {.bitmap_index = 3288, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 3404, .adv_w = 346, .box_w = 14, .box_h = 26, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 3514, .adv_w = 346, .box_w = 20, .box_h = 32, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 3731, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3916, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4056, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4180, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4273, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4324, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4367, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4500, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4536, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4583, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4659, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4798, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 4827, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4941, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5068, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5190, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5287, .adv_w = 346, .box_w = 18, .box_h = 32, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 5445, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5579, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5758, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5797, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5870, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6059, .adv_w = 346, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6320, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6514, .adv_w = 346, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6646, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6766, .adv_w = 346, .box_w = 10, .box_h = 34, .ofs_x = 7, .ofs_y = -4},
+    {.bitmap_index = 6799, .adv_w = 346, .box_w = 18, .box_h = 34, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 6988, .adv_w = 346, .box_w = 10, .box_h = 34, .ofs_x = 5, .ofs_y = -4},
+    {.bitmap_index = 7021, .adv_w = 346, .box_w = 17, .box_h = 14, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 7117, .adv_w = 346, .box_w = 18, .box_h = 4, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 7129, .adv_w = 346, .box_w = 9, .box_h = 5, .ofs_x = 5, .ofs_y = 23},
+    {.bitmap_index = 7150, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7276, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 7382, .adv_w = 346, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7500, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7612, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7735, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7804, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 7946, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8012, .adv_w = 346, .box_w = 19, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8086, .adv_w = 346, .box_w = 15, .box_h = 34, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8176, .adv_w = 346, .box_w = 18, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8289, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8348, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8414, .adv_w = 346, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8475, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8589, .adv_w = 346, .box_w = 16, .box_h = 26, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 8699, .adv_w = 346, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8813, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8879, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9015, .adv_w = 346, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9081, .adv_w = 346, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9150, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9294, .adv_w = 346, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9494, .adv_w = 346, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9650, .adv_w = 346, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 9824, .adv_w = 346, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9915, .adv_w = 346, .box_w = 17, .box_h = 34, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 10087, .adv_w = 346, .box_w = 5, .box_h = 34, .ofs_x = 8, .ofs_y = -4},
+    {.bitmap_index = 10100, .adv_w = 346, .box_w = 17, .box_h = 34, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 10267, .adv_w = 346, .box_w = 18, .box_h = 8, .ofs_x = 2, .ofs_y = 9}
 };
 
 /*---------------------
@@ -2750,7 +1692,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 42 px
  * Bpp: 4
- * Opts: --font JetBrainsMonoNL-ExtraBold.ttf --size 42 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_extra_bold_42 --no-compress -o out/lv_font_jetbrains_mono_extra_bold_42.c
+ * Opts: --font JetBrainsMonoNL-ExtraBold.ttf --size 42 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_jetbrains_mono_extra_bold_42 -o out/lv_font_jetbrains_mono_extra_bold_42.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -25,3738 +25,1869 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0xb, 0xff, 0xff, 0xfe, 0x0, 0xaf, 0xff, 0xff,
-    0xe0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0x9f, 0xff,
-    0xff, 0xd0, 0x9, 0xff, 0xff, 0xfc, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x8, 0xff, 0xff, 0xfb, 0x0,
-    0x8f, 0xff, 0xff, 0xb0, 0x7, 0xff, 0xff, 0xfa,
-    0x0, 0x7f, 0xff, 0xff, 0xa0, 0x6, 0xff, 0xff,
-    0xf9, 0x0, 0x6f, 0xff, 0xff, 0x90, 0x5, 0xff,
-    0xff, 0xf8, 0x0, 0x5f, 0xff, 0xff, 0x80, 0x4,
-    0xff, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xff, 0x70,
-    0x3, 0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff,
-    0x60, 0x2, 0xff, 0xff, 0xf5, 0x0, 0x2f, 0xff,
-    0xff, 0x50, 0x1, 0xff, 0xff, 0xf4, 0x0, 0x3,
-    0x33, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xef, 0xfb, 0x30, 0xc, 0xff, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xff, 0xf4, 0x1f, 0xff,
-    0xff, 0xff, 0x40, 0xcf, 0xff, 0xff, 0xe0, 0x1,
-    0xae, 0xff, 0xb3, 0x0,
+    0xb, 0xff, 0xee, 0x0, 0x8, 0x7, 0xff, 0x8,
+    0xc0, 0x6, 0x1, 0xff, 0xc2, 0x10, 0x0, 0x80,
+    0x7f, 0xf0, 0x9c, 0x3, 0xfe, 0xf0, 0xe, 0x10,
+    0xf, 0xf8, 0x40, 0x38, 0xc0, 0x3f, 0xe3, 0x0,
+    0xe1, 0x0, 0xff, 0x84, 0x3, 0xbc, 0x3, 0xfe,
+    0x70, 0xe, 0x10, 0xf, 0xf8, 0x40, 0x38, 0xc0,
+    0x3f, 0xe3, 0x0, 0xe1, 0x0, 0xe, 0x67, 0x20,
+    0x4, 0x67, 0xc0, 0x1f, 0xfc, 0x91, 0xae, 0xff,
+    0x59, 0x80, 0x35, 0x44, 0x0, 0x9a, 0x2, 0x60,
+    0x1c, 0x28, 0x1, 0xfc, 0x26, 0x1, 0xc2, 0x81,
+    0xaa, 0x20, 0x4, 0xd0,
 
     /* U+0022 "\"" */
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x6f, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0x80, 0x0, 0x5f, 0xff,
-    0xff, 0xf2, 0xef, 0xff, 0xff, 0x80, 0x0, 0x5f,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0x70, 0x0,
-    0x4f, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0x70,
-    0x0, 0x4f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0x60, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xff, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0xcf,
-    0xff, 0xff, 0x60, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0x50, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0xbf, 0xff, 0xff, 0x50, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0xaf, 0xff, 0xff, 0x40, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0xaf, 0xff, 0xff, 0x40, 0x0,
-    0xf, 0xff, 0xff, 0xd0, 0x8d, 0xdd, 0xdd, 0x30,
-    0x0, 0xd, 0xdd, 0xdd, 0xb0,
+    0xff, 0xf4, 0x80, 0x4d, 0xff, 0xe2, 0x10, 0xe,
+    0x10, 0x8, 0xc0, 0x3f, 0xf9, 0x86, 0x60, 0xe,
+    0xf0, 0x8, 0x40, 0x3f, 0xf9, 0x82, 0x20, 0xe,
+    0x10, 0x9, 0xc0, 0x3f, 0xfa, 0xe2, 0x1, 0xf3,
+    0x80, 0x71, 0x80, 0x7f, 0xf2, 0x4c, 0x3, 0x84,
+    0x4, 0x3, 0x84, 0x3, 0xff, 0x92, 0x20, 0x1c,
+    0x60, 0x45, 0xe7, 0x0, 0xc4, 0x5c, 0xc0,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf5, 0x0, 0x0,
-    0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x30, 0x0, 0x5, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x8f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd,
-    0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xa0, 0x0, 0x0, 0xef, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf7, 0x0,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x40, 0x0, 0x4, 0xff, 0xfe, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x4,
-    0x44, 0xdf, 0xff, 0x94, 0x44, 0x46, 0xff, 0xff,
-    0x54, 0x43, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x0,
-    0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x6, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfc, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0, 0xef,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf7,
-    0x0, 0x0, 0xf, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x50, 0x0, 0x3, 0xff, 0xff,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x2, 0x44, 0xcf, 0xff, 0x94, 0x44, 0x45, 0xff,
-    0xff, 0x54, 0x44, 0x10, 0x0, 0xe, 0xff, 0xf5,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x20, 0x0, 0x6, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0,
-    0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfd, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0,
-    0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf8, 0x0, 0x0, 0xf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfb, 0x7f, 0xe5, 0x0, 0xc5, 0xff, 0x80,
+    0x3f, 0x88, 0x2, 0x60, 0xc, 0xe0, 0x11, 0x0,
+    0x7e, 0x30, 0xc, 0x60, 0x1b, 0x40, 0x27, 0x0,
+    0xfc, 0xa0, 0x11, 0x0, 0x71, 0x80, 0x5a, 0x1,
+    0xfb, 0xc0, 0x27, 0x0, 0xe5, 0x0, 0x8c, 0x3,
+    0xf2, 0x80, 0x5a, 0x1, 0x84, 0x40, 0x12, 0x80,
+    0x7e, 0x20, 0x8, 0xc0, 0x32, 0x80, 0x42, 0x20,
+    0x8, 0x7f, 0xf0, 0x80, 0x57, 0xff, 0xac, 0x2,
+    0x1f, 0xf5, 0x80, 0x7f, 0xfe, 0x86, 0xee, 0x20,
+    0x9, 0xae, 0xf4, 0x80, 0x6a, 0xbb, 0x40, 0x1,
+    0x12, 0x30, 0xb, 0x51, 0x31, 0x0, 0x42, 0xa8,
+    0x83, 0x0, 0xc2, 0x20, 0x9, 0x40, 0x31, 0x0,
+    0x44, 0x1, 0xf8, 0x80, 0x30, 0x80, 0x6f, 0x0,
+    0x94, 0x3, 0xf2, 0x80, 0x46, 0x1, 0xc4, 0x1,
+    0x70, 0x7, 0xee, 0x0, 0x98, 0x3, 0x94, 0x2,
+    0x30, 0xf, 0xc6, 0x1, 0x68, 0x7, 0x8, 0x4,
+    0xc0, 0x1f, 0x94, 0x2, 0x20, 0xc, 0x60, 0x18,
+    0x80, 0x34, 0x7f, 0xc2, 0x1, 0x57, 0xfe, 0xc0,
+    0xd, 0xff, 0x20, 0x7, 0xff, 0xea, 0xae, 0xc6,
+    0x1, 0x35, 0xde, 0xa0, 0xd, 0x57, 0x72, 0x81,
+    0x22, 0x8, 0x2, 0xc4, 0x4c, 0xc0, 0x19, 0x51,
+    0x21, 0x0, 0xc2, 0x1, 0x38, 0x6, 0x50, 0x8,
+    0x80, 0x3f, 0x18, 0x6, 0x20, 0xd, 0xc0, 0x13,
+    0x80, 0x7e, 0x60, 0x8, 0x80, 0x38, 0xc0, 0x2d,
+    0x0, 0xfd, 0xa0, 0x13, 0x80, 0x72, 0x80, 0x44,
+    0x1, 0xf8, 0xc0, 0x22, 0x0, 0xe1, 0x0, 0x9c,
+    0x3, 0xf3, 0x0, 0x5a, 0x1, 0x8c, 0x3, 0x10,
+    0x7, 0x80,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x68, 0xff, 0xf9, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x3, 0xff, 0xff, 0xff, 0xc3, 0xef,
-    0xd3, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0x7f, 0xff,
-    0xff, 0xf1, 0xe, 0xfd, 0x0, 0xef, 0xff, 0xff,
-    0x90, 0x8, 0xff, 0xff, 0xfc, 0x0, 0xef, 0xd0,
-    0xa, 0xff, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xff,
-    0xb0, 0xe, 0xfd, 0x0, 0x1, 0x11, 0x11, 0x0,
-    0x8, 0xff, 0xff, 0xfe, 0x0, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf9,
-    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xd1, 0xaf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0xbf, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xd0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x99, 0x99,
-    0x99, 0x30, 0xe, 0xfd, 0x0, 0x1f, 0xff, 0xff,
-    0xf2, 0xf, 0xff, 0xff, 0xf8, 0x0, 0xef, 0xd0,
-    0x4, 0xff, 0xff, 0xff, 0x10, 0xcf, 0xff, 0xff,
-    0xf2, 0xe, 0xfd, 0x0, 0xcf, 0xff, 0xff, 0xe0,
-    0x8, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xd6, 0xdf,
-    0xff, 0xff, 0xfa, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xff, 0xff,
-    0xff, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0xff, 0xe4, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0x22, 0xc, 0x3, 0xff, 0x91, 0x57,
+    0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xb0, 0xb4,
+    0x8, 0x14, 0xb1, 0x0, 0x7f, 0xe3, 0xce, 0x97,
+    0x0, 0x9a, 0x77, 0x4a, 0x1, 0xfd, 0x18, 0x60,
+    0x1f, 0xc5, 0x54, 0x0, 0xfa, 0x5c, 0x3, 0xff,
+    0x82, 0xb6, 0x1, 0xca, 0xc0, 0x1f, 0xfc, 0x34,
+    0x70, 0xd, 0x0, 0x1f, 0xfc, 0x58, 0x10, 0x1,
+    0x90, 0x7, 0x1e, 0x8, 0x16, 0x18, 0x7, 0x90,
+    0x0, 0x80, 0x1e, 0xd3, 0x0, 0x8f, 0x4, 0x3,
+    0xb0, 0x1, 0xe0, 0x1c, 0x62, 0x1, 0xe4, 0x0,
+    0xe3, 0x0, 0x8, 0x7, 0x38, 0x7, 0xd5, 0xdd,
+    0xd4, 0x0, 0x10, 0xe, 0x50, 0xf, 0xc2, 0x3c,
+    0x1, 0x70, 0x7, 0xc, 0x80, 0x7f, 0xf0, 0xdc,
+    0x3, 0xcd, 0x82, 0x1, 0xff, 0xc1, 0x14, 0x0,
+    0xf1, 0x80, 0xa, 0x54, 0x40, 0x3f, 0xa0, 0x3,
+    0xfc, 0xd5, 0xd4, 0x60, 0x1f, 0x1c, 0x0, 0x7f,
+    0xe5, 0xc8, 0x0, 0xf9, 0xe0, 0x3, 0xff, 0x82,
+    0xf6, 0x1, 0xf3, 0xd9, 0x0, 0x7f, 0xe4, 0x80,
+    0xf, 0x93, 0x69, 0x0, 0x3f, 0xe7, 0x20, 0xf,
+    0xcb, 0x7e, 0x20, 0x1f, 0xeb, 0x0, 0xff, 0xe0,
+    0x97, 0x28, 0x7, 0x9c, 0x3, 0xff, 0x84, 0x34,
+    0x80, 0x1c, 0x22, 0x0, 0xff, 0xe1, 0xf8, 0x7,
+    0x8c, 0x26, 0x7c, 0x60, 0x1f, 0x28, 0x7, 0xe6,
+    0x6f, 0x58, 0x7, 0xca, 0x1, 0xe3, 0x3, 0x0,
+    0xe7, 0x20, 0xf, 0x40, 0x7, 0x8, 0x81, 0x0,
+    0x3d, 0xb0, 0x1, 0x36, 0x98, 0x7, 0x20, 0x2,
+    0x40, 0x3e, 0x71, 0x2, 0x92, 0x0, 0xf4, 0x0,
+    0x6, 0x0, 0x3f, 0xf8, 0xae, 0x40, 0x13, 0xa8,
+    0x7, 0xff, 0xd, 0x60, 0x3, 0xaa, 0x0, 0x3f,
+    0xf8, 0x31, 0x40, 0x1f, 0x3f, 0x39, 0x0, 0x7c,
+    0x2d, 0xce, 0x1, 0xfc, 0x31, 0xbd, 0x60, 0x1,
+    0xbd, 0xe9, 0x10, 0xf, 0xfe, 0x8, 0xa0, 0x81,
+    0xa1, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xf9, 0xa0,
 
     /* U+0025 "%" */
-    0x0, 0x1, 0x8c, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0x40, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xd0,
-    0x0, 0xaf, 0xff, 0xfb, 0x9d, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x2f, 0xff, 0xf3, 0x0, 0xe, 0xff,
-    0xf8, 0x0, 0xd, 0xff, 0xf7, 0x0, 0x0, 0xc,
-    0xff, 0xf7, 0x0, 0x0, 0xff, 0xff, 0x30, 0x0,
-    0x9f, 0xff, 0x90, 0x0, 0x8, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xf2, 0x0, 0x9, 0xff, 0xf9,
-    0x0, 0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0xff,
-    0xff, 0x20, 0x0, 0x9f, 0xff, 0x90, 0x0, 0xdf,
-    0xff, 0x50, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0,
-    0x9, 0xff, 0xf9, 0x0, 0xaf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x80, 0x0, 0xef, 0xff,
-    0x70, 0x5f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xb9, 0xef, 0xff, 0xf3, 0x1e, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfb,
-    0x6, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xdf, 0xfe, 0xb5, 0x2, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf5, 0x4, 0xae, 0xff,
-    0xd9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x9, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x30, 0xff, 0xff, 0xf9,
-    0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0x80, 0x4f, 0xff, 0xf2, 0x0, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x6,
-    0xff, 0xfd, 0x0, 0x0, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x2f, 0xff, 0xf2, 0x0, 0x6f, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0xd, 0xff,
-    0xf6, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xff, 0x30, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0,
-    0x6f, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xf2, 0x0,
-    0x4, 0xff, 0xfe, 0x10, 0x0, 0x4, 0xff, 0xff,
-    0x10, 0x3, 0xff, 0xff, 0x10, 0x1, 0xef, 0xff,
-    0x50, 0x0, 0x0, 0xf, 0xff, 0xfd, 0x78, 0xef,
-    0xff, 0xc0, 0x0, 0xaf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xfd,
-    0x92, 0x0, 0x0,
+    0x0, 0x86, 0x33, 0xfd, 0xd6, 0xa0, 0x1f, 0xe1,
+    0xef, 0xf9, 0x0, 0x9, 0xce, 0x60, 0x1, 0x4a,
+    0xb0, 0xf, 0xea, 0x10, 0x3, 0x20, 0x15, 0x80,
+    0x7e, 0x4a, 0x0, 0xf9, 0x90, 0x0, 0x52, 0x0,
+    0x80, 0xc, 0x8c, 0x40, 0x12, 0x90, 0x7, 0x14,
+    0x80, 0x5c, 0x1, 0x20, 0x4, 0xf7, 0x3a, 0x40,
+    0x12, 0x80, 0x77, 0x0, 0x50, 0x60, 0x10, 0x80,
+    0x56, 0x1, 0x20, 0x5, 0xc0, 0x1a, 0xc, 0x0,
+    0x6e, 0x1, 0xf8, 0x40, 0x3f, 0xe3, 0x70, 0xb,
+    0x40, 0x3f, 0xf9, 0x3c, 0x1, 0x50, 0x80, 0x7f,
+    0x8, 0x7, 0xfa, 0x88, 0x0, 0xaa, 0x0, 0xf0,
+    0x80, 0x56, 0x1, 0x38, 0x5, 0xc0, 0xaa, 0x0,
+    0xd, 0x80, 0x7c, 0x80, 0x13, 0xdc, 0xf0, 0x80,
+    0x48, 0x36, 0x1, 0x50, 0x80, 0x7d, 0x0, 0x19,
+    0x18, 0x40, 0x25, 0x3a, 0x10, 0x3, 0xa0, 0x7,
+    0xe2, 0xa0, 0xf, 0xc9, 0x4c, 0x80, 0x2, 0x80,
+    0xf, 0xf2, 0xf3, 0x90, 0x0, 0x52, 0xac, 0xa4,
+    0x2, 0xf0, 0xf, 0xfc, 0x31, 0xbf, 0xee, 0xb5,
+    0xe, 0x0, 0xa0, 0x80, 0x3f, 0xf9, 0x10, 0x60,
+    0x4, 0x70, 0xf, 0xfe, 0x41, 0xb8, 0x0, 0x68,
+    0x3, 0xff, 0x93, 0xa0, 0x15, 0x8a, 0x57, 0x7f,
+    0xb6, 0x48, 0x3, 0xff, 0x50, 0x80, 0x15, 0x53,
+    0x6a, 0x20, 0x2, 0x6d, 0x60, 0xf, 0xf2, 0xa8,
+    0x0, 0x35, 0xc, 0x1, 0xfa, 0x50, 0x3, 0xf0,
+    0xd8, 0x5, 0xa0, 0xe0, 0x19, 0x94, 0x3, 0x48,
+    0x7, 0xea, 0x10, 0x3, 0x9a, 0x0, 0x6d, 0x9a,
+    0xa0, 0x4, 0x42, 0x1, 0xe7, 0x40, 0x1, 0xc0,
+    0x10, 0x4, 0x44, 0x0, 0x28, 0x6, 0x30, 0xe,
+    0x28, 0x0, 0xb8, 0x3, 0xc2, 0x1, 0xf8, 0x40,
+    0x3b, 0xc0, 0x29, 0x20, 0xf, 0xfe, 0x44, 0x90,
+    0x1, 0x18, 0x3, 0xff, 0x88, 0x20, 0x12, 0x30,
+    0x0, 0x68, 0x3, 0x10, 0x4, 0x62, 0x0, 0x30,
+    0xc, 0x60, 0x1, 0xa0, 0xa, 0xc4, 0x3, 0x20,
+    0x6, 0xc7, 0x8d, 0x0, 0x8c, 0x40, 0x16, 0x20,
+    0x6, 0x50, 0xf, 0x38, 0x4, 0x50, 0xe2, 0x1,
+    0x40, 0x1, 0x54, 0x0, 0x29, 0x0, 0xfa, 0x18,
+    0x3, 0xf4, 0xa0, 0x15, 0x0, 0x5c, 0x1, 0xfd,
+    0x36, 0xa2, 0x0, 0x26, 0xd6, 0x0, 0x0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x1, 0x6b, 0xdf, 0xfd, 0xa4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf7, 0x13, 0xbf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x80, 0x0, 0x8, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x25, 0x55, 0x55, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x9, 0xaa, 0xaa, 0xa3,
-    0xd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc,
-    0x0, 0x9, 0xff, 0xff, 0xfa, 0x3, 0xff, 0xff,
-    0xff, 0x70, 0x1d, 0xff, 0xff, 0xf8, 0x6, 0xff,
-    0xff, 0xfd, 0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0,
-    0x3f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfe, 0x20,
-    0x7, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x8f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x8, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xd5, 0x23, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xdf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
-    0x3, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5,
-    0x9d, 0xef, 0xec, 0x93, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfd, 0x0,
+    0x0, 0xf8, 0x5a, 0xf7, 0xfd, 0xb4, 0x80, 0x1f,
+    0xfc, 0x56, 0xe9, 0x42, 0x0, 0x12, 0xde, 0x8,
+    0x7, 0xff, 0x9, 0xe4, 0x3, 0xf8, 0xfc, 0x80,
+    0x3f, 0xf1, 0xc0, 0x7, 0xfc, 0x3e, 0x1, 0xff,
+    0xa0, 0x3, 0xff, 0x82, 0x4e, 0x1, 0xff, 0x20,
+    0x7, 0x47, 0x62, 0x0, 0x75, 0x0, 0x7f, 0x84,
+    0x3, 0x95, 0xc4, 0xec, 0x80, 0x31, 0x8, 0x7,
+    0xff, 0xc, 0x80, 0x32, 0x80, 0x71, 0x0, 0x7f,
+    0x8, 0x7, 0x20, 0x6, 0xaa, 0xf1, 0x0, 0x7f,
+    0x94, 0x3, 0x1b, 0x0, 0x44, 0xab, 0xc2, 0x1,
+    0xfe, 0x80, 0xe, 0x93, 0x0, 0xff, 0xe3, 0x93,
+    0x80, 0x77, 0x8, 0x7, 0xff, 0x1f, 0x40, 0x38,
+    0xa8, 0x3, 0xff, 0x8a, 0xff, 0x40, 0x1e, 0x47,
+    0x0, 0xff, 0xe1, 0xcc, 0x0, 0x7f, 0x42, 0x0,
+    0x7f, 0xf0, 0x55, 0x80, 0x3f, 0xea, 0x10, 0xd,
+    0x35, 0x5c, 0x61, 0x0, 0x1f, 0x8, 0x6, 0x1d,
+    0x0, 0xa5, 0x95, 0x70, 0x19, 0x88, 0x3, 0xa3,
+    0xfc, 0x40, 0x18, 0xe0, 0x19, 0x80, 0x18, 0xa8,
+    0x14, 0x3, 0x91, 0xc0, 0x78, 0x3, 0x9e, 0x24,
+    0x3, 0xf, 0x80, 0x4, 0x3, 0xb0, 0x2, 0x38,
+    0x0, 0xe7, 0x0, 0xea, 0x20, 0x7, 0x80, 0x70,
+    0x80, 0x67, 0x50, 0xf, 0xe7, 0x40, 0xf, 0xfe,
+    0x1d, 0x90, 0x7, 0xc9, 0x0, 0x1b, 0xc0, 0x3f,
+    0xe1, 0xe0, 0xf, 0x15, 0x0, 0x7f, 0xdc, 0x1,
+    0xff, 0xc1, 0x30, 0xf, 0x10, 0x7, 0x28, 0x7,
+    0x1e, 0x80, 0x78, 0x68, 0x3, 0x90, 0x3, 0x8b,
+    0x54, 0x8e, 0x30, 0x40, 0x3e, 0x46, 0x0, 0xc2,
+    0x60, 0x1c, 0x55, 0xb8, 0xe0, 0x1f, 0xe9, 0x20,
+    0xd, 0xe0, 0x1f, 0xfc, 0x35, 0x0, 0xee, 0x0,
+    0xc7, 0x40, 0x1f, 0xfc, 0x1c, 0xa2, 0x0, 0xc7,
+    0x0, 0x19, 0x70, 0x80, 0x3f, 0x93, 0x4c, 0x38,
+    0x3, 0x9c, 0xc0, 0x31, 0xed, 0x31, 0x8, 0x9,
+    0xb6, 0x59, 0x0, 0xd, 0xc0, 0x3b, 0x80,
 
     /* U+0027 "'" */
-    0xaf, 0xff, 0xff, 0xda, 0xff, 0xff, 0xfd, 0x9f,
-    0xff, 0xff, 0xc9, 0xff, 0xff, 0xfc, 0x8f, 0xff,
-    0xff, 0xc8, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xfa, 0x6f, 0xff, 0xff, 0xa6,
-    0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0x95, 0xff,
-    0xff, 0xf9, 0x4d, 0xdd, 0xdd, 0x70,
+    0xaf, 0xfe, 0xd0, 0xf, 0x8c, 0x3, 0x84, 0x3,
+    0xe1, 0x0, 0xff, 0xcf, 0xe0, 0x1f, 0xf8, 0x44,
+    0x1, 0xff, 0xc1, 0x30, 0xe, 0x30, 0xf, 0x84,
+    0x8b, 0xb8,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5c, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x8d, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0x85, 0xad, 0x40, 0x3f, 0x8a, 0xba,
+    0x50, 0xc0, 0x3e, 0x1a, 0xd5, 0x0, 0xff, 0x27,
+    0xa8, 0x7, 0xfc, 0xd6, 0x20, 0x1f, 0xf2, 0xc8,
+    0x7, 0xfe, 0x3a, 0x0, 0xfc, 0x88, 0x0, 0xb8,
+    0x3, 0xe6, 0xeb, 0x20, 0x4, 0x10, 0x7, 0xaa,
+    0x44, 0x3, 0x30, 0x7, 0xad, 0x40, 0x39, 0x84,
+    0x3, 0x9d, 0x0, 0x3d, 0xa0, 0x1c, 0x30, 0x1,
+    0xf2, 0x0, 0x73, 0x0, 0x7c, 0x60, 0x1e, 0xb0,
+    0xf, 0x98, 0x3, 0xc6, 0x1, 0xf1, 0x80, 0x70,
+    0x80, 0x7e, 0x10, 0xe, 0x30, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xa4, 0x40, 0x38, 0xc0, 0x3f, 0x18,
+    0x7, 0x8, 0x7, 0xe6, 0x0, 0xf1, 0x80, 0x7c,
+    0x60, 0x1e, 0xb0, 0xf, 0xc6, 0x1, 0xcc, 0x1,
+    0xfa, 0xc0, 0x38, 0x60, 0x3, 0xe7, 0x0, 0xf3,
+    0xa0, 0x7, 0xcc, 0x1, 0xeb, 0x40, 0xf, 0x40,
+    0x80, 0x7a, 0xe4, 0x40, 0x30, 0xd0, 0x7, 0xcd,
+    0xd4, 0x40, 0x12, 0x40, 0x7, 0xe5, 0x40, 0xc,
+    0xee, 0x0, 0xff, 0xe1, 0x44, 0x80, 0x7f, 0xf0,
+    0x9b, 0x4c, 0x3, 0xff, 0x82, 0x59, 0x46, 0x1,
+    0xff, 0xc1, 0x5c, 0xc3, 0x90, 0x7, 0xfe, 0x38,
+    0xd6,
 
     /* U+0029 ")" */
-    0x2c, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x19,
-    0xef, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x2c, 0x72, 0x0, 0xff, 0xc7, 0x1b, 0x88, 0x1,
+    0xff, 0xc1, 0x3b, 0xc2, 0x0, 0xff, 0xe0, 0x9e,
+    0xb0, 0x7, 0xff, 0xa, 0x64, 0x1, 0xff, 0xc2,
+    0x69, 0x0, 0xc6, 0xa0, 0x1f, 0x99, 0x80, 0x10,
+    0xd7, 0xc0, 0x7, 0xd2, 0x40, 0x1c, 0xf8, 0x20,
+    0x1e, 0x90, 0xf, 0x1e, 0x8, 0x7, 0x21, 0x0,
+    0x78, 0xac, 0x3, 0xd0, 0x1, 0xf2, 0x98, 0x7,
+    0x20, 0x7, 0xe9, 0x0, 0xe1, 0x20, 0xf, 0x94,
+    0x3, 0xc8, 0x1, 0xf8, 0xc0, 0x3b, 0x80, 0x3f,
+    0x38, 0x7, 0x8, 0x7, 0xe1, 0x0, 0xe3, 0x0,
+    0xfc, 0x60, 0x1c, 0x20, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0x88, 0x80, 0x7e, 0x20, 0xe, 0x30, 0xf,
+    0xce, 0x1, 0xc2, 0x1, 0xf8, 0xc0, 0x3b, 0x80,
+    0x3e, 0x50, 0xf, 0x28, 0x7, 0xd2, 0x1, 0xe3,
+    0x0, 0xf2, 0x98, 0x7, 0x28, 0x7, 0x8a, 0xc0,
+    0x3d, 0x20, 0x1c, 0x78, 0x20, 0x1c, 0x66, 0x0,
+    0xcf, 0x82, 0x1, 0xef, 0x0, 0xc, 0xf4, 0x0,
+    0x7d, 0x6, 0x0, 0x36, 0x10, 0xf, 0x91, 0xc0,
+    0x3f, 0xf2, 0x58, 0x7, 0xfe, 0x6b, 0x0, 0xff,
+    0x86, 0xe4, 0x3, 0xfc, 0x33, 0xc8, 0x1, 0xf8,
+    0x56, 0xb9, 0x80, 0x3f, 0x8b, 0xa9, 0x40, 0x3f,
+    0xe0,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0x20, 0x7, 0xfe, 0x82,
-    0x0, 0xb, 0xff, 0xfe, 0x0, 0x1, 0x7d, 0xfa,
-    0x0, 0xdf, 0xff, 0xfc, 0x50, 0x8f, 0xff, 0xc0,
-    0x4b, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xff,
-    0xd8, 0xff, 0xf9, 0xbf, 0xff, 0xff, 0xff, 0x58,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x28, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x0,
-    0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x48, 0xdf, 0xff,
-    0xff, 0xe8, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xe0, 0xbf, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf6, 0x2, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0x0, 0x8, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x10,
-    0x0, 0xc, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x2,
-    0xcf, 0xff, 0x50, 0x0, 0x0, 0x2f, 0xff, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0,
-    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0x0,
+    0x0, 0xfe, 0xcf, 0xfc, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xe7, 0x8a, 0x0, 0x7f, 0xf1, 0x4c, 0x80,
+    0xd, 0x7d, 0x4, 0x1, 0x38, 0x4, 0x20, 0x10,
+    0xbe, 0xe4, 0x0, 0x28, 0x5, 0xf7, 0x14, 0xc,
+    0x2, 0x20, 0x4b, 0xe8, 0x20, 0x50, 0x22, 0x0,
+    0x63, 0xad, 0x0, 0xcb, 0x76, 0x40, 0xe, 0x5a,
+    0x0, 0xf8, 0x9c, 0x2, 0x64, 0x0, 0xfb, 0xa9,
+    0xc4, 0x3, 0xff, 0x8c, 0xd0, 0x51, 0xd6, 0xa0,
+    0x1f, 0xfc, 0x14, 0xaf, 0x93, 0x0, 0x92, 0xbe,
+    0xdc, 0x80, 0x38, 0x5e, 0xba, 0xd4, 0x3, 0xf9,
+    0x38, 0x80, 0x38, 0x44, 0xa2, 0x1, 0xff, 0x2c,
+    0x80, 0x7c, 0xd0, 0x1, 0xff, 0x15, 0x0, 0x67,
+    0x0, 0xce, 0x80, 0x1f, 0xee, 0x0, 0xc3, 0x8,
+    0x1, 0xa8, 0x40, 0x3f, 0x39, 0x80, 0x68, 0x9,
+    0x0, 0xc3, 0x60, 0x1f, 0x1c, 0x0, 0x64, 0x60,
+    0x27, 0x0, 0xca, 0xa0, 0xf, 0x78, 0x6, 0x1a,
+    0x0, 0xa0, 0xc0, 0x35, 0x80, 0x7b, 0x8c, 0x2,
+    0xb1, 0x0, 0xdc, 0x1, 0x16, 0x80, 0x78, 0xb1,
+    0xc1, 0x94, 0x3, 0x8a, 0x41, 0x74, 0xc0, 0x3f,
+    0x46, 0x48, 0x7, 0xcd, 0x74, 0x1, 0xc0,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x5, 0x99, 0x99, 0x96, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf9, 0x66, 0x79, 0x80, 0x3f, 0xf8, 0x5a,
+    0xcd, 0xd4, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf7,
+    0x5f, 0xff, 0x9c, 0x3, 0x8f, 0xff, 0xdc, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xe9, 0x5f, 0xff, 0x9c,
+    0x3, 0x8f, 0xff, 0xdc, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xf3, 0x80,
 
     /* U+002C "," */
-    0x0, 0x2, 0x22, 0x22, 0x21, 0x0, 0x9f, 0xff,
-    0xff, 0xf6, 0x0, 0xbf, 0xff, 0xff, 0xf2, 0x0,
-    0xef, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff,
-    0xa0, 0x3, 0xff, 0xff, 0xff, 0x60, 0x6, 0xff,
-    0xff, 0xff, 0x20, 0x9, 0xff, 0xff, 0xfe, 0x0,
-    0xb, 0xff, 0xff, 0xfa, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x3f,
-    0xff, 0xff, 0xd0, 0x0, 0x6f, 0xff, 0xff, 0x90,
-    0x0, 0x9f, 0xff, 0xff, 0x50, 0x0,
+    0x0, 0x88, 0xbc, 0x20, 0x9, 0xdd, 0xf3, 0x80,
+    0x8, 0x3, 0xc8, 0x0, 0x50, 0xe, 0x12, 0x1,
+    0x10, 0x7, 0x20, 0x0, 0x80, 0x3d, 0x80, 0x5,
+    0x0, 0xf2, 0x0, 0x3c, 0x3, 0x84, 0x80, 0x4,
+    0x1, 0xc8, 0x1, 0x28, 0x7, 0x60, 0x0, 0x44,
+    0x1, 0xc8, 0x0, 0x20, 0xe, 0x22, 0x0, 0x14,
+    0x3, 0x90, 0x2, 0xf0, 0xe, 0xc0, 0x8,
 
     /* U+002D "-" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x2f, 0xff, 0xfe, 0xa, 0x80, 0x7f, 0xff, 0xc0,
 
     /* U+002E "." */
-    0x0, 0x28, 0xa8, 0x30, 0x0, 0x6f, 0xff, 0xff,
-    0x80, 0x2f, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff,
-    0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0xd9, 0xff,
-    0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff, 0xff, 0x70,
-    0xbf, 0xff, 0xff, 0xd0, 0x0, 0x8d, 0xfe, 0x91,
-    0x0,
+    0x0, 0x14, 0x54, 0x18, 0x4, 0xda, 0xea, 0xf9,
+    0x0, 0x52, 0x1, 0xce, 0xaa, 0x0, 0xfb, 0xb8,
+    0x1, 0xf3, 0x0, 0x7e, 0x1d, 0x0, 0xfa, 0xd1,
+    0x0, 0x1c, 0x4e, 0x16, 0xe4, 0x2, 0xd8, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0x88, 0x88, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x1c, 0x47, 0x38, 0x7, 0xff,
+    0xf, 0xdd, 0xfb, 0x0, 0x3f, 0xf8, 0x44, 0x60,
+    0x1d, 0xa0, 0x1f, 0xfc, 0x25, 0x0, 0xf3, 0x0,
+    0x7f, 0xf0, 0xa8, 0x3, 0x94, 0x3, 0xff, 0x84,
+    0x64, 0x1, 0xdc, 0x1, 0xff, 0xc2, 0xb0, 0xe,
+    0x14, 0x0, 0xff, 0xe1, 0x30, 0x7, 0x38, 0x7,
+    0xff, 0x9, 0x4, 0x3, 0xa8, 0x3, 0xff, 0x85,
+    0xc0, 0x1c, 0x46, 0x1, 0xff, 0xc2, 0x50, 0xe,
+    0x50, 0xf, 0xfe, 0x12, 0x80, 0x7a, 0x80, 0x3f,
+    0xf8, 0x5c, 0x1, 0xc6, 0x40, 0x1f, 0xfc, 0x11,
+    0x40, 0xe, 0xb0, 0xf, 0xfe, 0x13, 0x80, 0x79,
+    0x80, 0x3f, 0xf8, 0x54, 0x1, 0xc8, 0x20, 0x1f,
+    0xfc, 0x12, 0x30, 0xe, 0xe0, 0xf, 0xfe, 0x12,
+    0x80, 0x79, 0x40, 0x3f, 0xf8, 0x54, 0x1, 0xca,
+    0x1, 0xff, 0xc2, 0x32, 0x0, 0xee, 0x0, 0xff,
+    0xe1, 0x50, 0x7, 0xa, 0x0, 0x7f, 0xf0, 0x9c,
+    0x3, 0x9c, 0x3, 0xff, 0x84, 0x82, 0x1, 0xd4,
+    0x1, 0xff, 0xc2, 0xe0, 0xe, 0x23, 0x0, 0xff,
+    0xe1, 0x28, 0x7, 0x28, 0x7, 0xff, 0x9, 0x40,
+    0x3d, 0x40, 0x1f, 0xfc, 0x2e, 0x0, 0xe3, 0x20,
+    0xf, 0xfe, 0x8, 0xa0, 0x7, 0x50, 0x7, 0xff,
+    0x9, 0xc0, 0x3c, 0xe0, 0x1f, 0xfc, 0x2a, 0x0,
+    0xe4, 0x10, 0xf, 0xfe, 0x9, 0x18, 0x7, 0x70,
+    0x7, 0xff, 0xa, 0x80, 0x3c, 0xa0, 0x1f, 0xfc,
+    0x25, 0x0, 0xe5, 0x0, 0xff, 0xe1, 0x19, 0x0,
+    0x77, 0x0, 0x7f, 0xf0, 0xa8, 0x3, 0x85, 0x0,
+    0x3f, 0xf8, 0x4e, 0x1, 0xce, 0x1, 0xff, 0xc2,
+    0x41, 0x0, 0xea, 0x0, 0xff, 0xe1, 0x70, 0x7,
+    0x11, 0x80, 0x7f, 0xf0, 0x94, 0x3, 0x94, 0x3,
+    0xff, 0x84, 0xa0, 0x1e, 0xa0, 0xf, 0xfe, 0x17,
+    0x0, 0x71, 0x90, 0x7, 0xff, 0x8,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xdb, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xb9, 0xbe, 0xff, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x55, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa7, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0x60, 0x4c, 0xfd, 0x60, 0x3f, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0x33,
-    0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xf7, 0x3f, 0xff, 0xff, 0xb7, 0xff, 0xff,
-    0xf6, 0x3f, 0xff, 0xff, 0x63, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x60, 0xcf, 0xff, 0xe1, 0x3f,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xf6, 0x0, 0x79,
-    0x81, 0x3, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xa5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x7, 0xff, 0xff, 0xff, 0x50, 0xdf,
-    0xff, 0xff, 0xff, 0xb9, 0xae, 0xff, 0xff, 0xff,
-    0xf0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xff, 0xdb, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0xf2, 0xd6, 0xff, 0xdb, 0x6c, 0x20, 0x1f,
+    0xcd, 0xd4, 0xa4, 0x1, 0x12, 0x4f, 0x40, 0x7,
+    0xd5, 0x22, 0x1, 0xfe, 0x7c, 0x10, 0xd, 0x4a,
+    0x1, 0xff, 0xc1, 0x3d, 0x0, 0x95, 0x40, 0x1f,
+    0xfc, 0x33, 0x80, 0x4, 0x0, 0x7c, 0x8c, 0x82,
+    0x1, 0xe7, 0x2, 0x20, 0x7, 0x37, 0x5c, 0xdf,
+    0x40, 0x7, 0x95, 0xc0, 0x38, 0xe4, 0x40, 0x33,
+    0xb0, 0x7, 0x69, 0x0, 0x75, 0x80, 0x7d, 0xa0,
+    0x1c, 0x40, 0x1e, 0x10, 0xf, 0x9c, 0x3, 0xff,
+    0x9c, 0x20, 0x1f, 0xfd, 0x14, 0xcf, 0xd6, 0x0,
+    0xff, 0xe1, 0x8d, 0x98, 0x14, 0x98, 0x7, 0xff,
+    0x9, 0x40, 0x39, 0x0, 0x3f, 0xf8, 0x4e, 0x1,
+    0xc2, 0x1, 0xff, 0xc2, 0x33, 0x0, 0x42, 0xe0,
+    0x1f, 0xfc, 0x3c, 0x86, 0x7f, 0x10, 0xf, 0xfe,
+    0x23, 0xcc, 0x8, 0x7, 0xff, 0xe8, 0x40, 0x3c,
+    0x20, 0x1f, 0x38, 0x7, 0x88, 0x3, 0xac, 0x3,
+    0xed, 0x0, 0xe2, 0x70, 0xe, 0x39, 0x10, 0xc,
+    0xec, 0x1, 0xda, 0x44, 0x0, 0xe6, 0xeb, 0x9a,
+    0xe8, 0x0, 0xf2, 0x84, 0x0, 0x7c, 0x8c, 0xa2,
+    0x1, 0xe7, 0x0, 0x2a, 0x80, 0x3f, 0xf8, 0x65,
+    0x0, 0x15, 0x20, 0x7, 0xff, 0x4, 0xb0, 0x3,
+    0xae, 0x44, 0x3, 0xfc, 0xfa, 0x20, 0x1e, 0x6e,
+    0xa5, 0x20, 0x8, 0x92, 0x3a, 0x0, 0x30,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf9, 0xe, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe5, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xb, 0xff,
-    0xc1, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x8, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xff, 0xff, 0xfd, 0xcc, 0xcc,
-    0xc6, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0xf2, 0xf7, 0xff, 0x98, 0x3, 0xfe, 0x9a,
+    0x10, 0xf, 0xfe, 0x21, 0xeb, 0x0, 0x7f, 0xf1,
+    0x5f, 0x8, 0x3, 0xff, 0x88, 0x39, 0x0, 0x1f,
+    0xfc, 0x6a, 0x30, 0xf, 0xfe, 0x71, 0x0, 0x7f,
+    0xf1, 0xdb, 0x44, 0x3, 0xff, 0x88, 0x35, 0x20,
+    0x1f, 0xfc, 0x53, 0xf5, 0x0, 0xff, 0xe2, 0xbe,
+    0x8, 0x7, 0xff, 0x10, 0xb2, 0x0, 0x3f, 0xf8,
+    0xd2, 0x60, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xc5, 0x19, 0x9f,
+    0x8, 0x7, 0x5e, 0x67, 0x31, 0x19, 0xfc, 0x1,
+    0xe2, 0x33, 0xee, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0x0,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xec, 0xef, 0xff, 0xff, 0xff, 0xd0, 0x3f,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x38, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf6, 0xaf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x8b, 0xee,
-    0xee, 0xe8, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcb, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+    0x0, 0xf2, 0x4e, 0xff, 0xdb, 0x4c, 0x1, 0xfe,
+    0x3d, 0xb6, 0x20, 0x8, 0x96, 0x79, 0x40, 0x3e,
+    0x7c, 0x20, 0xf, 0xe1, 0xaa, 0x0, 0x73, 0xc0,
+    0x7, 0xff, 0x5, 0x64, 0x2, 0x48, 0x0, 0xff,
+    0xe1, 0xb2, 0x80, 0x24, 0x3, 0xe1, 0x31, 0x0,
+    0xfa, 0x0, 0xc8, 0x3, 0x86, 0xfb, 0x3a, 0x40,
+    0x3c, 0x47, 0x60, 0x1e, 0xd4, 0x0, 0x9a, 0x0,
+    0x3c, 0xa4, 0x1, 0xc8, 0x60, 0x1c, 0xc0, 0x1e,
+    0xe1, 0x1f, 0x18, 0x7, 0x84, 0x40, 0x1e, 0xbe,
+    0xee, 0x80, 0xf, 0x84, 0x3, 0xbc, 0x3, 0xff,
+    0x82, 0x40, 0x1e, 0x30, 0xf, 0xfe, 0xd, 0x80,
+    0x79, 0x0, 0x3f, 0xf2, 0xb0, 0x7, 0x28, 0x7,
+    0xfe, 0x4a, 0x0, 0xf4, 0x0, 0x7f, 0xc9, 0x60,
+    0x1e, 0x72, 0x0, 0xff, 0x2d, 0x80, 0x78, 0xe0,
+    0x3, 0xfc, 0xb4, 0x1, 0xe2, 0xd0, 0xf, 0xf2,
+    0xd0, 0x7, 0x8f, 0x4, 0x3, 0xf9, 0xa8, 0x3,
+    0xc7, 0xa2, 0x1, 0xfc, 0xd2, 0x1, 0xe4, 0xc1,
+    0x0, 0xfe, 0x69, 0x0, 0xf2, 0x58, 0x7, 0xf9,
+    0xe4, 0x3, 0xcb, 0x60, 0x1f, 0xe7, 0x80, 0xf,
+    0x35, 0x0, 0x7f, 0x9e, 0x0, 0x3c, 0xf2, 0x1,
+    0xfe, 0x38, 0x0, 0xf9, 0x33, 0x3f, 0xd6, 0xe0,
+    0x1f, 0x8c, 0xff, 0xe5, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0x0,
 
     /* U+0033 "3" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x59, 0x99, 0x99,
-    0x99, 0x99, 0x9b, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xb7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x22, 0x22, 0x35, 0xaf, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0xae,
-    0xee, 0xee, 0x70, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xab, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0x63, 0xff,
-    0xff, 0xff, 0xfe, 0xb9, 0xbf, 0xff, 0xff, 0xff,
-    0xf1, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xdf,
-    0xfe, 0xda, 0x71, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xff, 0xe2, 0xe0, 0x7, 0xff, 0xfc,
+    0x3, 0xfe, 0xc6, 0x6f, 0xf2, 0x0, 0x7a, 0x80,
+    0xb, 0x33, 0xfd, 0x4a, 0x1, 0xd6, 0xc0, 0x1f,
+    0xf2, 0xe0, 0x80, 0x43, 0x88, 0x1, 0xff, 0x3d,
+    0x0, 0x62, 0xc3, 0x0, 0xff, 0xa6, 0x0, 0x31,
+    0xe1, 0x0, 0x7f, 0xd6, 0xc0, 0x19, 0x30, 0x40,
+    0x3f, 0xea, 0x40, 0xf, 0x38, 0x80, 0x7f, 0xcc,
+    0x1, 0xe4, 0x8e, 0x91, 0x0, 0xff, 0xe3, 0xb7,
+    0x90, 0x7, 0xff, 0x1c, 0x70, 0x40, 0x3f, 0xf8,
+    0xe3, 0x60, 0x1f, 0x76, 0xed, 0x94, 0xa0, 0x1e,
+    0x51, 0x0, 0xf1, 0x16, 0x35, 0xaa, 0x0, 0x79,
+    0xc0, 0x3f, 0xf8, 0x2a, 0x40, 0x1d, 0xe0, 0x1f,
+    0xfc, 0x27, 0x0, 0xe3, 0x0, 0xff, 0xe4, 0x8,
+    0x7, 0xff, 0x26, 0xbb, 0xb9, 0xc0, 0x3f, 0xf8,
+    0x22, 0x3f, 0x58, 0x7, 0xc8, 0x1, 0xc6, 0x60,
+    0xe, 0x38, 0x0, 0xc3, 0x42, 0x1, 0xdf, 0x60,
+    0x1e, 0x7e, 0xb9, 0xbe, 0x50, 0xf, 0x39, 0xa0,
+    0x7, 0x85, 0x19, 0x0, 0x3e, 0x61, 0x9, 0x10,
+    0xf, 0xfe, 0x18, 0xc0, 0x0, 0xb4, 0x40, 0x3f,
+    0xf8, 0x25, 0x82, 0x1, 0x1f, 0xa8, 0x7, 0xfc,
+    0xda, 0x40, 0x1c, 0x35, 0xd0, 0x84, 0x0, 0x12,
+    0x58, 0xe9, 0x0, 0xc0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf2, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0xa, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x5f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0xcf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0xdf, 0xff,
-    0xff, 0x99, 0x99, 0x99, 0x9c, 0xff, 0xff, 0xfd,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
+    0x0, 0xff, 0xaf, 0xff, 0xc6, 0x1, 0xff, 0x3a,
+    0x0, 0x74, 0x18, 0x7, 0xf8, 0xa0, 0x3, 0x8d,
+    0xc0, 0x3f, 0xef, 0x0, 0xf7, 0x0, 0x7f, 0xd2,
+    0x40, 0x1d, 0x24, 0x1, 0xfe, 0x46, 0x0, 0xe4,
+    0x60, 0xf, 0xf0, 0xd0, 0x7, 0xd, 0x0, 0x7f,
+    0xd6, 0x20, 0x1d, 0x42, 0x1, 0xfe, 0x65, 0x0,
+    0xe6, 0x40, 0xf, 0xf1, 0x48, 0x7, 0x14, 0x80,
+    0x7f, 0xdc, 0x1, 0xee, 0x0, 0xff, 0xa0, 0xc0,
+    0x39, 0xcc, 0x3, 0xfc, 0x6e, 0x1, 0xc7, 0x0,
+    0x1f, 0xf7, 0x0, 0x7b, 0x80, 0x27, 0xff, 0xed,
+    0xa, 0x20, 0xe, 0x92, 0x0, 0xff, 0x2a, 0x80,
+    0x39, 0x18, 0x3, 0xfe, 0x90, 0xe, 0x1a, 0x0,
+    0xff, 0xc2, 0x1, 0xd6, 0x20, 0x1f, 0xfc, 0x64,
+    0x0, 0xff, 0xe3, 0xc4, 0xcf, 0xac, 0x3, 0xff,
+    0x33, 0x7c, 0x60, 0x1f, 0xff, 0xf0, 0xf, 0xfb,
+    0x7f, 0xff, 0xf4, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfa, 0x60,
 
     /* U+0035 "5" */
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xcf, 0xff, 0xff,
-    0xdc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x60, 0xc,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xfa, 0x99, 0x88, 0x74,
-    0x10, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6e, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0xcf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xaa, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x1b, 0xff, 0xff, 0xff, 0x52, 0xff,
-    0xff, 0xff, 0xfe, 0xb9, 0xbf, 0xff, 0xff, 0xff,
-    0xf0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xde,
-    0xfe, 0xda, 0x71, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xff, 0xe2, 0xc0, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0x8a, 0x46, 0x7f, 0xf7, 0x0, 0x7e,
+    0xec, 0xcf, 0xf9, 0x80, 0x3f, 0xff, 0x73, 0x34,
+    0x41, 0xd0, 0x40, 0x3f, 0xf8, 0x2a, 0xcc, 0x77,
+    0x45, 0xf5, 0xa0, 0x7, 0xff, 0x1d, 0x2e, 0x40,
+    0x3f, 0xf9, 0xd, 0x40, 0x1f, 0xfc, 0x85, 0x60,
+    0xf, 0xfe, 0x44, 0x0, 0x33, 0xff, 0xfb, 0x64,
+    0x40, 0x38, 0x4c, 0x3, 0xfe, 0x26, 0xd0, 0xf,
+    0x20, 0x7, 0xff, 0x4, 0xcc, 0x1, 0xdc, 0x1,
+    0xff, 0xc2, 0x60, 0xe, 0x30, 0xf, 0xfe, 0x40,
+    0x80, 0x7f, 0xf2, 0x7, 0x3f, 0xfa, 0x0, 0x3e,
+    0x10, 0xf, 0x30, 0x7, 0x28, 0x7, 0xca, 0x1,
+    0xc5, 0xa0, 0x1c, 0x52, 0x20, 0x10, 0xd8, 0x80,
+    0x76, 0xa8, 0x7, 0x9b, 0xee, 0x6f, 0x90, 0x3,
+    0xca, 0x4a, 0x1, 0xe1, 0x46, 0x40, 0xf, 0x9c,
+    0x1, 0x62, 0x1, 0xff, 0xc3, 0x28, 0x0, 0xe,
+    0x10, 0x7, 0xff, 0x4, 0xb0, 0x3, 0x16, 0xb0,
+    0x7, 0xfc, 0xda, 0x20, 0x1e, 0x9e, 0x95, 0x21,
+    0x1, 0x25, 0x8e, 0x90, 0xc,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf6, 0x28, 0xab, 0xa7, 0x20,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfc, 0x8f,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x4, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x15, 0xdf,
-    0xff, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xe0, 0xd,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x41, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x20, 0xcf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf0, 0x8, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc7, 0x56, 0xbf, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xad, 0xff, 0xed,
-    0xb7, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x2f, 0xff, 0x84, 0x3, 0xff, 0x85,
+    0x0, 0x1e, 0x81, 0x0, 0xff, 0xe0, 0x9a, 0x80,
+    0x71, 0x38, 0x7, 0xff, 0xa, 0x0, 0x3d, 0xc0,
+    0x1f, 0xfc, 0x24, 0x40, 0x7, 0x29, 0x80, 0x7f,
+    0xf0, 0xa4, 0x3, 0x86, 0xc0, 0x3f, 0xf8, 0x4c,
+    0x40, 0x1d, 0x2, 0x1, 0xff, 0xc2, 0x80, 0xe,
+    0x36, 0x0, 0xff, 0xe1, 0x38, 0x80, 0x77, 0x80,
+    0x7f, 0xf0, 0x86, 0x0, 0x39, 0x8c, 0x3, 0xff,
+    0x85, 0x0, 0x1c, 0x30, 0x1, 0xff, 0xc2, 0x26,
+    0x0, 0xe8, 0x38, 0xab, 0xa7, 0x20, 0xf, 0xd6,
+    0x1, 0xc7, 0xda, 0xea, 0x8b, 0x1b, 0x20, 0x1e,
+    0x26, 0x0, 0xe1, 0x70, 0xf, 0x9b, 0x0, 0x3a,
+    0x80, 0x3c, 0x40, 0x1f, 0xc7, 0x20, 0x19, 0x80,
+    0x3f, 0xf8, 0xac, 0x60, 0x4, 0x10, 0xe, 0x18,
+    0xef, 0xea, 0x20, 0xf, 0x48, 0x3, 0x40, 0x3d,
+    0x8e, 0x20, 0x2b, 0x84, 0x1, 0xc8, 0x0, 0x40,
+    0xe, 0x82, 0x0, 0xe1, 0x90, 0xe, 0x12, 0x2,
+    0x0, 0xe5, 0x0, 0xf9, 0x0, 0x3c, 0x22, 0x0,
+    0xf1, 0x0, 0x7e, 0x20, 0xe, 0x70, 0xf, 0xfe,
+    0x21, 0x80, 0x78, 0x40, 0x3c, 0x60, 0x1f, 0x8,
+    0x80, 0x39, 0x80, 0xc0, 0x3a, 0x40, 0x3e, 0x60,
+    0xf, 0x10, 0x20, 0x7, 0x2b, 0x0, 0x72, 0x40,
+    0x7, 0x20, 0x2, 0x80, 0x3d, 0x38, 0xea, 0xd7,
+    0x60, 0xf, 0x70, 0x0, 0x98, 0x3, 0xc7, 0x15,
+    0x28, 0x1, 0xe3, 0x50, 0xa, 0x4c, 0x3, 0xff,
+    0x86, 0x3c, 0x1, 0xda, 0x60, 0x1f, 0xfc, 0x11,
+    0xd2, 0x0, 0xe1, 0xc8, 0x0, 0xff, 0x9b, 0xcc,
+    0x3, 0xf3, 0xfc, 0xa9, 0x0, 0x4, 0x92, 0x3a,
+    0x44, 0x3, 0x0,
 
     /* U+0037 "7" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xd9, 0x99, 0x99, 0x99, 0x9f, 0xff,
-    0xff, 0xfe, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf1,
-    0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x90, 0x9f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x20, 0x6a, 0xaa,
-    0xaa, 0x70, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xfe, 0x48, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0x8e, 0x4c, 0xdf, 0x80, 0x3c, 0x20, 0x1e,
+    0x69, 0x9f, 0xb4, 0x3, 0xcc, 0x1, 0xff, 0xc2,
+    0xf0, 0xf, 0x48, 0x7, 0xff, 0x4, 0x90, 0x3,
+    0x98, 0x40, 0x3f, 0xf8, 0x36, 0x1, 0xeb, 0xf,
+    0x55, 0xec, 0x0, 0xe1, 0x60, 0xe, 0x42, 0x6,
+    0xaa, 0xe7, 0x0, 0xe9, 0x0, 0xf7, 0x80, 0x7f,
+    0xf0, 0x98, 0x3, 0x89, 0x0, 0x3f, 0xf8, 0x2c,
+    0x20, 0x1d, 0x60, 0x1f, 0xfc, 0x2b, 0x0, 0xe1,
+    0x60, 0xf, 0xfe, 0xa, 0x90, 0x7, 0x48, 0x7,
+    0xff, 0xa, 0x40, 0x3c, 0xc0, 0x1f, 0xfc, 0x13,
+    0x30, 0x7, 0x30, 0x80, 0x7f, 0xf0, 0x64, 0x3,
+    0xd6, 0x1, 0xff, 0xc1, 0x25, 0x0, 0xe4, 0x20,
+    0xf, 0xfe, 0xd, 0x80, 0x7b, 0xc0, 0x3f, 0xf8,
+    0x22, 0xc0, 0x1c, 0x48, 0x1, 0xff, 0xc1, 0x60,
+    0xf, 0x58, 0x7, 0xff, 0xa, 0x40, 0x38, 0x58,
+    0x3, 0xff, 0x82, 0xa2, 0x1, 0xd2, 0x1, 0xff,
+    0xc2, 0x90, 0xf, 0x30, 0x7, 0xff, 0x5, 0xc,
+    0x3, 0x98, 0x40, 0x3f, 0xf8, 0x3e, 0x1, 0xeb,
+    0x0, 0xff, 0xe0, 0x92, 0x0, 0x72, 0x10, 0x7,
+    0xff, 0x6, 0xc0, 0x3d, 0xe0, 0x1f, 0xfc, 0x11,
+    0x60, 0xe, 0x24, 0x0, 0xff, 0x0,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x5, 0xac, 0xef, 0xed, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xb5, 0x35,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf5,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x70, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x50, 0x0, 0xcf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x92, 0x2, 0x7e, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x4,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x20, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xe, 0xff, 0xff, 0xfe,
-    0x61, 0x0, 0x4c, 0xff, 0xff, 0xff, 0x20, 0x7,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfa, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x32, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf5, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x40, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf2, 0xb, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xfe, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xa6, 0x45, 0x9f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xb7, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0xf9, 0x6b, 0x3b, 0xfb, 0x6d, 0x84, 0x3,
+    0xfe, 0x6e, 0xa5, 0x31, 0x1, 0x24, 0x9e, 0x80,
+    0xf, 0xeb, 0x91, 0x0, 0xff, 0x3f, 0x10, 0x7,
+    0xad, 0x0, 0x3f, 0xf8, 0x23, 0xe2, 0x1, 0x99,
+    0x0, 0x3f, 0xf8, 0x65, 0x60, 0x1a, 0xc0, 0x3c,
+    0x95, 0x94, 0xc0, 0x1e, 0x51, 0x0, 0x9, 0x0,
+    0x73, 0xda, 0x9a, 0xcd, 0x80, 0x79, 0x0, 0x4,
+    0x1, 0xe8, 0x0, 0xe4, 0x40, 0x7, 0x10, 0x7,
+    0xe3, 0x0, 0xf8, 0xc0, 0x3f, 0x10, 0x7, 0x10,
+    0x7, 0xc4, 0x1, 0xc4, 0x0, 0x13, 0x0, 0xc2,
+    0xc0, 0x1c, 0x4a, 0x1, 0xca, 0x1, 0x40, 0x7,
+    0x4c, 0x88, 0x9, 0xf0, 0x3, 0xa0, 0x3, 0x24,
+    0x0, 0x73, 0x6f, 0xec, 0x8, 0x6, 0x57, 0x0,
+    0xe7, 0xb3, 0x0, 0xff, 0x8a, 0x68, 0x3, 0xe5,
+    0xb1, 0x0, 0xff, 0x2a, 0x0, 0x7c, 0x9f, 0x2,
+    0x1, 0xfe, 0x7d, 0x60, 0xe, 0x3b, 0x10, 0xf,
+    0xfe, 0x14, 0xb0, 0x6, 0xd0, 0xe, 0x19, 0xef,
+    0xf5, 0x98, 0x7, 0x49, 0x0, 0x1c, 0x40, 0x31,
+    0x7b, 0x8, 0x1, 0x31, 0x0, 0x3a, 0x0, 0x14,
+    0x1, 0xd2, 0x20, 0x1e, 0xa0, 0xe, 0x50, 0x1,
+    0x0, 0x72, 0x0, 0x7c, 0x26, 0x1, 0xc6, 0x40,
+    0x1c, 0x20, 0x1f, 0xce, 0x1, 0xcc, 0x60, 0x1c,
+    0x20, 0x1f, 0xcc, 0x1, 0xc2, 0x20, 0xf, 0x38,
+    0x7, 0xc6, 0x40, 0x1c, 0xc0, 0x80, 0x1d, 0x8,
+    0x1, 0xc5, 0xa0, 0x1c, 0x24, 0x1c, 0x1, 0xeb,
+    0xa6, 0x45, 0x9d, 0x10, 0xe, 0x60, 0x2, 0x98,
+    0x7, 0x96, 0x6e, 0x98, 0x3, 0xc3, 0x20, 0x17,
+    0x8, 0x7, 0xff, 0x12, 0x84, 0x2, 0x2c, 0x10,
+    0xf, 0xfe, 0x15, 0xa0, 0x7, 0x17, 0xb0, 0x7,
+    0xfc, 0xba, 0x80, 0x1f, 0xc, 0xf4, 0xa9, 0x0,
+    0x42, 0x91, 0xb4, 0x40, 0x18,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xef, 0xfd, 0xb7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xc7, 0x67,
-    0xaf, 0xff, 0xff, 0xff, 0x40, 0x9, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xfb,
-    0x0, 0xef, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x21,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x40, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf3, 0xb, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x0, 0x5f, 0xff,
-    0xff, 0xfe, 0x61, 0x1, 0x5d, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
-    0x1d, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf0, 0xb5, 0x6f, 0x7f, 0xb6, 0xdc, 0x40,
+    0x3f, 0xe9, 0xe9, 0x52, 0x10, 0x1, 0x24, 0x74,
+    0x88, 0x7, 0xc5, 0xac, 0x1, 0xff, 0x37, 0x90,
+    0x7, 0xe, 0x10, 0x7, 0xff, 0x4, 0x70, 0x40,
+    0x35, 0x8, 0x7, 0xff, 0xc, 0x68, 0x2, 0x44,
+    0x0, 0x78, 0xe2, 0x61, 0x40, 0x3c, 0x88, 0x0,
+    0x68, 0x7, 0xab, 0x1d, 0x9e, 0xb0, 0x40, 0x3b,
+    0xc0, 0xe, 0x1, 0xce, 0xa0, 0x1c, 0x76, 0x1,
+    0xc8, 0x0, 0x10, 0xe, 0xa0, 0xf, 0x94, 0x3,
+    0xc4, 0x20, 0x1e, 0x20, 0xf, 0xc4, 0x1, 0xcc,
+    0x1, 0xf0, 0x80, 0x7e, 0x30, 0xf, 0x8, 0x7,
+    0x9c, 0x3, 0xe3, 0x10, 0xe, 0x70, 0x40, 0xe,
+    0x81, 0x0, 0xf7, 0x80, 0x78, 0xc3, 0x80, 0x38,
+    0x7d, 0x84, 0x5, 0x74, 0xc0, 0x38, 0xc0, 0xa,
+    0x40, 0x1c, 0x33, 0xdf, 0xd4, 0x40, 0x1e, 0x40,
+    0xb, 0xc0, 0x3f, 0xf8, 0xd4, 0x1, 0x15, 0x0,
+    0x7f, 0xf1, 0xc, 0x80, 0x32, 0xe9, 0x0, 0x7f,
+    0xf0, 0xa4, 0x3, 0xc5, 0xb2, 0x60, 0x18, 0x40,
+    0x3c, 0x6a, 0x1, 0xf9, 0xb3, 0xf7, 0x5c, 0x60,
+    0x1e, 0x80, 0xf, 0xfc, 0x44, 0x62, 0x0, 0xe3,
+    0x40, 0xf, 0xfe, 0x8, 0xc8, 0x7, 0xbc, 0x3,
+    0xff, 0x85, 0x22, 0x1, 0xca, 0x60, 0x1f, 0xfc,
+    0x12, 0x70, 0xf, 0x40, 0x7, 0xff, 0xa, 0x0,
+    0x3c, 0xc4, 0x1, 0xff, 0xc1, 0x35, 0x0, 0xf4,
+    0x0, 0x7f, 0xf0, 0xbc, 0x3, 0xd0, 0x20, 0x1f,
+    0xfc, 0x15, 0x30, 0xe, 0x17, 0x0, 0xff, 0xe1,
+    0x40, 0x7, 0xa0, 0x3, 0xff, 0x84, 0xe4, 0x1,
+    0xc4, 0xc0, 0x1f, 0xfc, 0x11, 0x90, 0xf, 0x48,
+    0x7, 0xf0,
 
     /* U+003A ":" */
-    0x0, 0x8e, 0xfe, 0xa1, 0x0, 0xcf, 0xff, 0xff,
-    0xe1, 0x5f, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,
-    0xff, 0xfc, 0x8f, 0xff, 0xff, 0xff, 0xb3, 0xff,
-    0xff, 0xff, 0xf6, 0x8, 0xff, 0xff, 0xfb, 0x0,
-    0x4, 0x9b, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xa9, 0x50, 0x0, 0x8f, 0xff, 0xff,
-    0xb0, 0x3f, 0xff, 0xff, 0xff, 0x78, 0xff, 0xff,
-    0xff, 0xfb, 0x8f, 0xff, 0xff, 0xff, 0xc5, 0xff,
-    0xff, 0xff, 0xf8, 0xc, 0xff, 0xff, 0xfe, 0x10,
-    0x8, 0xef, 0xea, 0x10,
+    0x0, 0x47, 0x7f, 0x50, 0x80, 0x31, 0xc4, 0x5,
+    0x7c, 0x54, 0xc0, 0x38, 0x67, 0x40, 0x3e, 0x40,
+    0xf, 0xcf, 0x60, 0x1f, 0x69, 0xb8, 0x7, 0x23,
+    0x4, 0x5b, 0x22, 0xd5, 0x80, 0x49, 0x37, 0x4a,
+    0x1, 0xff, 0xf7, 0x49, 0xa9, 0x50, 0xa, 0x2d,
+    0x95, 0xaa, 0xc0, 0xdc, 0x3, 0x91, 0xec, 0x3,
+    0xec, 0x0, 0xfc, 0xfa, 0x1, 0xf2, 0x29, 0x80,
+    0x70, 0xc8, 0x63, 0x88, 0xa, 0xf8, 0x80,
 
     /* U+003B ";" */
-    0x0, 0x19, 0xef, 0xfb, 0x20, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x5, 0xff, 0xff, 0xff, 0xf8, 0x8,
-    0xff, 0xff, 0xff, 0xfc, 0x8, 0xff, 0xff, 0xff,
-    0xfb, 0x4, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x9f,
-    0xff, 0xff, 0xc0, 0x0, 0x5, 0xab, 0xa6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x22,
-    0x22, 0x20, 0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xb0, 0x4, 0xff, 0xff, 0xff, 0x70, 0x7, 0xff,
-    0xff, 0xff, 0x30, 0x9, 0xff, 0xff, 0xfe, 0x0,
-    0xc, 0xff, 0xff, 0xfa, 0x0, 0xf, 0xff, 0xff,
-    0xf6, 0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x4f,
-    0xff, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xa0,
-    0x0, 0x9f, 0xff, 0xff, 0x60, 0x0, 0xcf, 0xff,
-    0xff, 0x20, 0x0,
+    0x0, 0xc, 0xf7, 0xfa, 0xc8, 0x2, 0xd6, 0x10,
+    0x2, 0x60, 0x82, 0x98, 0x7, 0xc, 0x86, 0x80,
+    0x7c, 0x80, 0x1f, 0xce, 0x18, 0x1, 0xf6, 0x2,
+    0x30, 0x7, 0x1b, 0x80, 0x26, 0x95, 0x16, 0x70,
+    0x3, 0x2d, 0x5d, 0x30, 0x7, 0xff, 0xfc, 0x3,
+    0xf8, 0x48, 0xbc, 0x1, 0x6e, 0xfc, 0x60, 0x3,
+    0x0, 0xf1, 0x80, 0x80, 0x79, 0x0, 0xa, 0x1,
+    0xec, 0x0, 0x18, 0x7, 0x90, 0x1, 0xc0, 0x1c,
+    0x26, 0x0, 0x50, 0xe, 0x40, 0x8, 0xc0, 0x3b,
+    0x0, 0x2, 0x1, 0xe4, 0x0, 0x28, 0x7, 0x9,
+    0x0, 0xc, 0x3, 0x90, 0x2, 0xe0, 0xe, 0xc0,
+    0x9, 0x40, 0x39, 0x0, 0x20,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8e, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x29, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x10, 0x0, 0x5, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x6d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfe,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfc,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd7, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x30,
+    0x0, 0xff, 0xed, 0xa6, 0x20, 0x7, 0xff, 0x11,
+    0x76, 0xcc, 0x3, 0xff, 0x86, 0xdd, 0x44, 0x1,
+    0xff, 0xc2, 0x18, 0xe9, 0x10, 0xf, 0xfe, 0x11,
+    0x4f, 0x38, 0x80, 0x7f, 0xf0, 0x8a, 0xb5, 0x80,
+    0x3f, 0x9c, 0x3, 0x92, 0xf5, 0x40, 0x3f, 0xb,
+    0xf1, 0x80, 0x4b, 0x96, 0x80, 0x1f, 0x8a, 0x7a,
+    0x4, 0x0, 0xdb, 0x46, 0x1, 0xf9, 0x2f, 0x58,
+    0x3, 0xc, 0x90, 0x7, 0xe5, 0xcb, 0x40, 0xf,
+    0xfe, 0x10, 0xbf, 0x51, 0x80, 0x7f, 0xf0, 0x96,
+    0xba, 0x4, 0x3, 0xff, 0x88, 0x98, 0x60, 0x1f,
+    0xfc, 0x61, 0x6c, 0xc2, 0x80, 0x7f, 0x84, 0x3,
+    0xf1, 0xd6, 0xb8, 0x7, 0xf6, 0x20, 0x7, 0xe2,
+    0x8f, 0x81, 0x0, 0xf1, 0xde, 0xa8, 0x7, 0xf3,
+    0xf5, 0x18, 0x7, 0x8a, 0xb9, 0xc0, 0x3f, 0x97,
+    0x30, 0x80, 0x1e, 0x18, 0xe8, 0x10, 0xf, 0xc7,
+    0x68, 0x1, 0xf0, 0xbf, 0x49, 0x0, 0x7f, 0xf1,
+    0xdb, 0x68, 0xc0, 0x3f, 0xf8, 0xeb, 0x98, 0x40,
+    0xf, 0xfe, 0x39, 0xde, 0xa8, 0x7, 0xff, 0x1c,
+    0xab, 0x9d, 0xc0,
 
     /* U+003D "=" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0,
+    0xaf, 0xff, 0xfe, 0x2e, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xf9, 0x15, 0xff, 0xff, 0xc5, 0xd0, 0xf,
+    0xff, 0xf8, 0x57, 0xff, 0xff, 0x17, 0x40, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfc, 0x80,
 
     /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x92, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7e, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9e, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3a, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc4, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x30, 0x0, 0x3, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe4, 0x8e, 0xb0, 0x7, 0xff, 0x1c,
+    0xa7, 0x9c, 0x3, 0xff, 0x8e, 0x31, 0xf0, 0x20,
+    0x1f, 0xfc, 0x77, 0xe9, 0x20, 0xf, 0xfe, 0x3b,
+    0x6d, 0x98, 0x7, 0xf0, 0x80, 0x7f, 0x26, 0x61,
+    0x0, 0x3f, 0x74, 0x8, 0x7, 0xe3, 0xbd, 0x60,
+    0xf, 0xb, 0xf5, 0x18, 0x7, 0xe2, 0x9e, 0x70,
+    0xf, 0x97, 0x2d, 0x0, 0x3f, 0xc, 0x7c, 0x8,
+    0x7, 0x92, 0xf5, 0x80, 0x3f, 0x9d, 0x40, 0x3f,
+    0x14, 0xf4, 0x8, 0x7, 0xff, 0x18, 0x5f, 0xad,
+    0x84, 0x3, 0xff, 0x8a, 0x26, 0xa2, 0x1, 0xff,
+    0xc3, 0x3a, 0xe8, 0x30, 0xf, 0xfe, 0x12, 0x66,
+    0x14, 0x3, 0xff, 0x86, 0xdb, 0x66, 0x1, 0xf8,
+    0xed, 0x0, 0x21, 0x8e, 0x92, 0x0, 0xfc, 0xb9,
+    0x84, 0x0, 0x1d, 0x73, 0x88, 0x7, 0xe6, 0xda,
+    0x30, 0xd, 0x8a, 0x1, 0xfc, 0xfd, 0x24, 0x1,
+    0xc2, 0x1, 0xf8, 0x63, 0xe0, 0x40, 0x3f, 0xf8,
+    0x45, 0x3c, 0xe0, 0x1f, 0xfc, 0x33, 0xad, 0x60,
+    0xf, 0xfe, 0x1a, 0x5e, 0x28, 0x7, 0xff, 0x8,
+    0x57, 0x6d, 0x0, 0x3f, 0xf8, 0x80,
 
     /* U+003F "?" */
-    0x9f, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xeb, 0x96, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xcc, 0xcc,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xdf, 0xfd, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xfd, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xff, 0xbb, 0x25, 0x0, 0x3f, 0xf8, 0x42,
+    0x6d, 0x7a, 0xa0, 0x1f, 0xfc, 0x42, 0xa9, 0x0,
+    0xff, 0xe2, 0xb4, 0x80, 0x7f, 0xf1, 0x59, 0x0,
+    0x3f, 0xf8, 0xb0, 0x13, 0xff, 0xf6, 0xb8, 0x7,
+    0x8c, 0x40, 0x3f, 0x14, 0x50, 0x7, 0x94, 0x3,
+    0xfc, 0xa2, 0x1, 0xc4, 0x1, 0xff, 0xd0, 0x51,
+    0x0, 0xe2, 0x0, 0xfc, 0x4f, 0x40, 0x1e, 0x50,
+    0xb, 0x3f, 0xf6, 0xc0, 0x7, 0x88, 0x40, 0x3f,
+    0xf8, 0x90, 0x1, 0xff, 0xc4, 0x55, 0x0, 0x67,
+    0x0, 0xff, 0x25, 0x0, 0x7f, 0xf0, 0xe2, 0xc0,
+    0x3f, 0xe1, 0x46, 0x9e, 0x70, 0xf, 0x84, 0x3,
+    0x25, 0xcb, 0x8, 0x7, 0xff, 0x3b, 0x4c, 0xf1,
+    0x0, 0x7f, 0xe7, 0xcc, 0xd0, 0x1, 0xff, 0xf6,
+    0x6d, 0xff, 0x6b, 0x80, 0x7f, 0xcb, 0x24, 0x0,
+    0x28, 0x60, 0xf, 0xf7, 0x80, 0x7b, 0x40, 0x3f,
+    0xfa, 0x1e, 0x1, 0xed, 0x0, 0xff, 0x2c, 0x90,
+    0x0, 0xa1, 0x80, 0x3f, 0x0,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xfe, 0xda,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x20, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfe, 0xa8, 0x89, 0xdf,
-    0xff, 0xff, 0xfb, 0x0, 0x5, 0xff, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff, 0x40,
-    0xd, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x8f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xf3, 0xbf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf5,
-    0xdf, 0xff, 0xf3, 0x0, 0x0, 0x6, 0xcf, 0xec,
-    0x50, 0xbf, 0xff, 0xf5, 0xef, 0xff, 0xf2, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf5,
-    0xff, 0xff, 0xf1, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xf5, 0xff, 0xff, 0xf1, 0x0,
-    0xe, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0xf1, 0x0, 0x3f, 0xff, 0xfe, 0x20,
-    0x7, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf1, 0x0,
-    0x6f, 0xff, 0xf8, 0x0, 0x0, 0xef, 0xff, 0xf5,
-    0xff, 0xff, 0xf1, 0x0, 0x8f, 0xff, 0xf5, 0x0,
-    0x0, 0xcf, 0xff, 0xf5, 0xff, 0xff, 0xf1, 0x0,
-    0x8f, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xf5,
-    0xff, 0xff, 0xf1, 0x0, 0x8f, 0xff, 0xf4, 0x0,
-    0x0, 0xbf, 0xff, 0xf5, 0xff, 0xff, 0xf1, 0x0,
-    0x8f, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xf5,
-    0xff, 0xff, 0xf1, 0x0, 0x8f, 0xff, 0xf4, 0x0,
-    0x0, 0xbf, 0xff, 0xf5, 0xff, 0xff, 0xf1, 0x0,
-    0x8f, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xf5,
-    0xff, 0xff, 0xf1, 0x0, 0x7f, 0xff, 0xf6, 0x0,
-    0x0, 0xcf, 0xff, 0xf4, 0xff, 0xff, 0xf1, 0x0,
-    0x5f, 0xff, 0xfb, 0x0, 0x2, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xf1, 0x0, 0x1f, 0xff, 0xff, 0x82,
-    0x3c, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xf1, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xff, 0xff, 0xf1, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xef, 0xff, 0xf2, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xdf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xfd, 0x93, 0x0, 0x0, 0xbf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xec, 0xbb, 0xbb,
-    0xb3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0,
+    0x0, 0xf9, 0x23, 0x3b, 0xfd, 0xdb, 0x4c, 0x1,
+    0xff, 0x97, 0x6d, 0xcc, 0x40, 0x2, 0x4b, 0x3f,
+    0x0, 0x1f, 0xd7, 0x44, 0x1, 0xff, 0x3e, 0x90,
+    0x7, 0xb1, 0x0, 0x3f, 0xf8, 0x45, 0x82, 0x1,
+    0xac, 0xc0, 0x38, 0x55, 0xdc, 0xc4, 0x1, 0xc3,
+    0x40, 0x12, 0xa0, 0x6, 0x1a, 0xea, 0x88, 0x4e,
+    0xe1, 0x80, 0x64, 0x40, 0x2, 0x0, 0x30, 0xfa,
+    0x80, 0x78, 0xf0, 0xc0, 0x37, 0x81, 0x90, 0x6,
+    0xd1, 0x0, 0xfe, 0xf0, 0xc, 0x81, 0x60, 0x18,
+    0xcc, 0x1, 0xfe, 0x32, 0x0, 0xc6, 0x60, 0xd,
+    0x40, 0x1f, 0xf9, 0x80, 0x33, 0x30, 0x3, 0x28,
+    0x7, 0x36, 0x7f, 0x62, 0x80, 0x7c, 0x60, 0x18,
+    0x40, 0x35, 0x49, 0x80, 0x9d, 0x38, 0x7, 0x84,
+    0x3, 0x18, 0x4, 0xca, 0x1, 0xe8, 0x70, 0xf,
+    0xfe, 0x14, 0x0, 0x72, 0x18, 0x18, 0x7, 0xff,
+    0x4, 0xc4, 0x2, 0x1d, 0xbc, 0x80, 0xf, 0xfe,
+    0x12, 0x80, 0x66, 0x20, 0x3, 0x88, 0x7, 0xff,
+    0x7, 0x80, 0x36, 0x80, 0x62, 0x0, 0xff, 0xe3,
+    0x8, 0x6, 0x70, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x5b, 0xc0, 0x31, 0x0, 0x67, 0x0, 0xc2, 0x1,
+    0xf8, 0x80, 0x36, 0x80, 0x44, 0x60, 0x19, 0x80,
+    0x3f, 0x20, 0x6, 0x48, 0x23, 0xe0, 0xc, 0x24,
+    0x1, 0xf8, 0x58, 0x3, 0x3e, 0xe1, 0x80, 0x68,
+    0x0, 0xff, 0x41, 0x0, 0x7f, 0x91, 0x80, 0x40,
+    0x31, 0x80, 0x43, 0x86, 0x1, 0xf9, 0x6c, 0x0,
+    0x60, 0x19, 0x80, 0x30, 0xe5, 0x20, 0x80, 0x9,
+    0xb2, 0x80, 0x26, 0x0, 0xc6, 0x1, 0xe5, 0xbe,
+    0xff, 0x6c, 0x98, 0x6, 0xc0, 0xd, 0x40, 0x1f,
+    0xfc, 0x65, 0x0, 0xc4, 0xc0, 0x1f, 0xfc, 0x52,
+    0x30, 0xd, 0x2a, 0x1, 0xff, 0xc5, 0xf0, 0xe,
+    0xaa, 0x18, 0x7, 0xff, 0xc, 0xd8, 0x3, 0x97,
+    0x3b, 0x2e, 0xf8, 0xc0, 0x3f, 0x4a, 0x0, 0x78,
+    0x4d, 0x13, 0x9c, 0x3, 0xfa, 0xd8, 0x3, 0xff,
+    0x97, 0x38, 0x60, 0x1f, 0xfc, 0xa3, 0xcd, 0x84,
+    0x20, 0xf, 0xfe, 0x8,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xe0, 0xaf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x80, 0x4f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x1f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x10, 0xe, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0xb, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfb, 0x0, 0x8, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf7, 0x0, 0x4, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf4, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf3, 0x22, 0x22, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x6, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf8, 0x0, 0x9, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0xd, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40,
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x80, 0x9f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0,
-    0xdf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf0,
+    0x0, 0xfa, 0x7f, 0xfe, 0xa0, 0xf, 0xfe, 0x1a,
+    0x80, 0x7c, 0x80, 0x1f, 0xfc, 0x33, 0x0, 0xf8,
+    0x48, 0x3, 0xff, 0x82, 0x80, 0x1f, 0xc8, 0x1,
+    0xff, 0xc1, 0xc0, 0xf, 0xec, 0x0, 0xff, 0xe0,
+    0xa0, 0x7, 0xf2, 0x0, 0x7f, 0xf0, 0x4c, 0x3,
+    0x20, 0x6, 0x12, 0x0, 0xff, 0x90, 0x3, 0xb8,
+    0x3, 0x90, 0x3, 0xfe, 0xc0, 0xe, 0x42, 0x0,
+    0xd8, 0x1, 0xff, 0x18, 0x6, 0x11, 0x38, 0x6,
+    0x40, 0xf, 0xf9, 0x0, 0x32, 0x86, 0x80, 0x61,
+    0x10, 0x7, 0xf1, 0x80, 0x71, 0x81, 0x80, 0x72,
+    0x0, 0x7f, 0x20, 0x7, 0x60, 0x28, 0x7, 0x60,
+    0x7, 0xf6, 0x0, 0x72, 0x80, 0x88, 0x3, 0x20,
+    0x7, 0xf2, 0x0, 0x61, 0x10, 0x1, 0x40, 0x31,
+    0x8, 0x7, 0xc6, 0x1, 0xca, 0x1, 0x18, 0x7,
+    0x20, 0x7, 0xc8, 0x1, 0xd8, 0x1, 0x60, 0x7,
+    0x60, 0x7, 0xda, 0x1, 0xc6, 0x1, 0x28, 0x7,
+    0x20, 0x7, 0xc8, 0x1, 0xce, 0x45, 0x18, 0x7,
+    0x10, 0x80, 0x71, 0x8, 0x7, 0x66, 0xee, 0x0,
+    0xf2, 0x0, 0x72, 0x0, 0x7f, 0xf1, 0x70, 0x3,
+    0xb0, 0x3, 0xff, 0x8a, 0x80, 0x1c, 0x80, 0x1f,
+    0xfc, 0x52, 0x10, 0x8, 0x84, 0x3, 0xff, 0x8c,
+    0x80, 0x12, 0x0, 0x71, 0x7f, 0xfc, 0xa0, 0x1d,
+    0xa0, 0x17, 0x80, 0x73, 0x80, 0x7d, 0xa0, 0x1c,
+    0x80, 0x12, 0x0, 0x76, 0x0, 0x7c, 0x80, 0x1c,
+    0x60, 0x1, 0x20, 0xe, 0x50, 0xf, 0x8c, 0x3,
+    0xc8, 0x8, 0x1, 0xe3, 0x0, 0xfc, 0x60, 0x1d,
+    0x81, 0x80, 0x1c, 0x60, 0x1f, 0xca, 0x1, 0xc8,
+    0x8, 0x1, 0xca, 0x1, 0xfd, 0xe0, 0x1c, 0x60,
 
     /* U+0042 "B" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdb, 0x72,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x3f,
-    0xff, 0xff, 0xe3, 0x33, 0x35, 0x9f, 0xff, 0xff,
-    0xff, 0x70, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xd0,
-    0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x90, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x40, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x2, 0x6e,
-    0xff, 0xff, 0xfb, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb6, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xd1, 0x11,
-    0x11, 0x5c, 0xff, 0xff, 0xff, 0x70, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf7, 0x3f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0xe3, 0x33,
-    0x33, 0x7e, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xec, 0x94, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf7, 0x6d, 0xb9, 0x0, 0x7f, 0xf1,
+    0x44, 0x92, 0x37, 0xc, 0x3, 0xff, 0x90, 0x78,
+    0xe0, 0x1f, 0xfc, 0x98, 0x60, 0xf, 0xfe, 0x4c,
+    0x88, 0x7, 0xc3, 0x99, 0xa9, 0x80, 0x3e, 0x60,
+    0xf, 0x8c, 0xf9, 0x67, 0x0, 0x3d, 0x80, 0x1f,
+    0xfc, 0x23, 0x50, 0xe, 0x60, 0xf, 0xfe, 0x19,
+    0x0, 0x70, 0x80, 0x7f, 0xf0, 0xc8, 0x3, 0x94,
+    0x3, 0xff, 0x84, 0x4a, 0x1, 0xda, 0x1, 0xff,
+    0x89, 0xb0, 0x3, 0x91, 0x0, 0x1f, 0x17, 0xfe,
+    0xd9, 0x10, 0xc, 0x74, 0x1, 0xff, 0xc6, 0x28,
+    0xc1, 0x0, 0xff, 0xe3, 0x30, 0x80, 0x7f, 0xf2,
+    0x12, 0x70, 0x40, 0x3f, 0xf9, 0x7, 0xa0, 0x1f,
+    0x8b, 0xbb, 0xa8, 0xc0, 0x38, 0xdc, 0x3, 0xf0,
+    0x8f, 0x2e, 0x20, 0x7, 0x48, 0x7, 0xff, 0xe,
+    0x40, 0x38, 0x50, 0x3, 0xff, 0x84, 0x42, 0x1,
+    0xc6, 0x1, 0xff, 0xc3, 0x20, 0xe, 0xf0, 0xf,
+    0xfe, 0x19, 0x0, 0x7f, 0xf2, 0xc, 0x40, 0x3b,
+    0x80, 0x3f, 0xf8, 0x5e, 0x1, 0xe4, 0x0, 0xf1,
+    0x9f, 0x9f, 0x8c, 0x3, 0x8c, 0x80, 0x3c, 0x39,
+    0x9d, 0x2, 0x1, 0xe8, 0x0, 0xff, 0xe4, 0x3a,
+    0x0, 0x7f, 0xf1, 0xda, 0x0, 0x3f, 0xf8, 0xc5,
+    0x72, 0x1, 0xff, 0xc3, 0x13, 0x6b, 0xd4, 0x0,
+    0xc0,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xfc, 0xaa, 0xdf, 0xff, 0xff,
-    0xff, 0x70, 0xf, 0xff, 0xff, 0xfe, 0x30, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xd0, 0x2f, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0x33, 0x33, 0x30, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0x33,
-    0x33, 0x30, 0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xc0, 0x9, 0xff, 0xff, 0xff, 0xfc,
-    0xaa, 0xdf, 0xff, 0xff, 0xff, 0x70, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xec, 0x83, 0x0, 0x0, 0x0,
+    0x0, 0xf1, 0xc6, 0x77, 0xfb, 0xb2, 0xc, 0x3,
+    0xfc, 0x79, 0x87, 0x31, 0x0, 0x9, 0xbe, 0x59,
+    0x0, 0x7c, 0xf8, 0x60, 0x1f, 0xe4, 0xd5, 0x0,
+    0xe6, 0x80, 0xf, 0xfe, 0x15, 0x20, 0x4, 0x52,
+    0x1, 0xff, 0xc4, 0xa0, 0xa, 0x0, 0x3e, 0x35,
+    0x51, 0x0, 0x78, 0x5c, 0x0, 0xa0, 0x1c, 0x39,
+    0x8a, 0xa6, 0xd0, 0x7, 0xa8, 0x8, 0x3, 0xd6,
+    0x60, 0x19, 0x60, 0x3, 0x88, 0x18, 0x3, 0xca,
+    0x1, 0xe5, 0x0, 0xf1, 0x0, 0x7f, 0xf0, 0x8b,
+    0x33, 0xc4, 0x20, 0x1f, 0xfc, 0x23, 0x3f, 0x0,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xb1, 0x0, 0xff, 0xe1, 0x19, 0xf8, 0x3, 0xff,
+    0x86, 0x59, 0x9e, 0x26, 0x0, 0xf2, 0x80, 0x79,
+    0x40, 0x3c, 0x44, 0x0, 0xf5, 0x98, 0x6, 0x58,
+    0x0, 0xe3, 0x0, 0x30, 0x7, 0xe, 0x62, 0xa9,
+    0xb4, 0x1, 0xeb, 0x0, 0x58, 0x7, 0xc6, 0xaa,
+    0x20, 0xf, 0xb, 0x80, 0xa, 0x40, 0x3f, 0xf8,
+    0x94, 0x1, 0x9a, 0x0, 0x3f, 0xf8, 0x54, 0x80,
+    0x1c, 0xf6, 0x40, 0x1f, 0xe3, 0xd5, 0x0, 0xf9,
+    0x36, 0xd8, 0xc4, 0x0, 0x26, 0xf9, 0x82, 0x0,
+    0xc0,
 
     /* U+0044 "D" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x61,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x5f,
-    0xff, 0xff, 0xfc, 0xcc, 0xce, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3c, 0xff, 0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xe0,
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf1, 0x5f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3, 0x5f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3,
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf3, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3, 0x5f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf1, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xe0,
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2c, 0xff,
-    0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff, 0xfc, 0xcc,
-    0xce, 0xff, 0xff, 0xff, 0xff, 0x30, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdb, 0x61, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xfb, 0x6d, 0x84, 0x3, 0xff, 0x8c,
+    0x49, 0x3d, 0x0, 0x1f, 0xfc, 0x97, 0xd2, 0x0,
+    0xff, 0xe4, 0x16, 0x8, 0x7, 0xff, 0x20, 0x68,
+    0x3, 0xf8, 0xcf, 0x8, 0x7, 0xc8, 0x80, 0xf,
+    0xd9, 0x9b, 0xb0, 0xc0, 0x3d, 0xc0, 0x1f, 0xfc,
+    0x13, 0xc2, 0x0, 0xe4, 0x0, 0xff, 0xe1, 0xc0,
+    0x7, 0x8, 0x80, 0x3f, 0xf8, 0x4e, 0x1, 0xe3,
+    0x0, 0xff, 0xe1, 0x18, 0x7, 0x84, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0x18, 0x7, 0x84, 0x3, 0xff, 0x84, 0xe0,
+    0x1e, 0x30, 0xf, 0xfe, 0x14, 0x0, 0x70, 0x88,
+    0x3, 0xff, 0x16, 0x10, 0x7, 0x20, 0x7, 0xec,
+    0xcd, 0xda, 0x60, 0x1e, 0x90, 0xf, 0xc6, 0x78,
+    0x40, 0x3e, 0x53, 0x0, 0xff, 0xe3, 0x95, 0x80,
+    0x7f, 0xf1, 0xcb, 0xc4, 0x3, 0xff, 0x8c, 0xfa,
+    0x40, 0x1f, 0xfc, 0x32, 0x49, 0xe8, 0x0, 0xe0,
 
     /* U+0045 "E" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xaf, 0xff, 0xff, 0xc9, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x92, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xaf, 0xff, 0xff, 0xa5, 0x55, 0x55,
-    0x55, 0x55, 0x53, 0x0, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xc9, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x92, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0xaf, 0xff, 0xfe, 0x32, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xe3, 0x66, 0xff, 0xe0, 0x80, 0x79, 0x26,
+    0x7f, 0xf1, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfa,
+    0x6f, 0xff, 0xfe, 0xc0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x5, 0x6a, 0xbf, 0xde, 0x1, 0xf8, 0x95,
+    0x7f, 0xc6, 0x1, 0xff, 0xff, 0x0, 0xff, 0xf4,
+    0xa4, 0xcf, 0xfe, 0x20, 0xf, 0x1b, 0x37, 0xff,
+    0x4, 0x3, 0xff, 0xfe, 0x1, 0xc0,
 
     /* U+0046 "F" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x1,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfe, 0x3d, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfb, 0x3b, 0xff, 0xff, 0xac, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xee, 0xdf, 0xff, 0xfa, 0x40,
+    0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0xac, 0xff, 0xff,
+    0xa4, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7c,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xeb, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfc, 0x9a, 0xdf, 0xff, 0xff,
-    0xff, 0x60, 0x2f, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xb0, 0x5f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x4d,
-    0xdd, 0xdd, 0xd0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x57, 0x77, 0x9f, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xd0,
-    0x2f, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x90, 0xc, 0xff, 0xff, 0xff, 0xfb,
-    0x99, 0xdf, 0xff, 0xff, 0xff, 0x30, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xde, 0xff,
-    0xeb, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0xf2, 0x4e, 0x77, 0xfb, 0xad, 0xc8, 0x3,
+    0xfc, 0xbd, 0x6c, 0x62, 0x0, 0x14, 0x8d, 0xb2,
+    0x0, 0xfa, 0x68, 0x40, 0x3f, 0xc9, 0xa8, 0x1,
+    0xd2, 0xc0, 0x1f, 0xfc, 0x2b, 0x30, 0x9, 0x18,
+    0x3, 0xff, 0x89, 0xc0, 0x14, 0x0, 0x7c, 0x6c,
+    0xa4, 0x1, 0xe2, 0x60, 0x23, 0x0, 0xe2, 0xdc,
+    0x9a, 0xda, 0x0, 0xf6, 0x83, 0x80, 0x7b, 0xc8,
+    0x3, 0x2b, 0x80, 0x72, 0x81, 0x0, 0x70, 0x90,
+    0x7, 0xb0, 0x8b, 0x8c, 0x3, 0xe3, 0x0, 0xf9,
+    0x37, 0x7c, 0x1, 0xff, 0xff, 0x0, 0x6f, 0xff,
+    0xf8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xcc, 0x88,
+    0xcc, 0x1, 0xff, 0xc5, 0x57, 0x7b, 0x40, 0x3f,
+    0xfd, 0xa6, 0x1, 0xf1, 0x0, 0x7c, 0x40, 0x1c,
+    0x24, 0x1, 0xed, 0x0, 0xe2, 0x7, 0x0, 0xf7,
+    0x90, 0x6, 0x74, 0x0, 0xe4, 0x2, 0x30, 0xe,
+    0x2d, 0xb9, 0x96, 0xc0, 0x7, 0xa8, 0x1, 0x0,
+    0x1f, 0x23, 0x30, 0x80, 0x3c, 0x86, 0x0, 0x46,
+    0x0, 0xff, 0xe1, 0x8d, 0x0, 0x69, 0x60, 0xf,
+    0xfe, 0x9, 0x60, 0x80, 0x74, 0xd0, 0x80, 0x7f,
+    0x9b, 0x8, 0x3, 0xe5, 0xea, 0x62, 0x10, 0x0,
+    0xa4, 0x74, 0x88, 0x6,
 
     /* U+0048 "H" */
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x63,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x63, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x63, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xdc, 0xcc,
-    0xcc, 0xcf, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x63,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x63, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x63, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x63, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x60,
+    0x3f, 0xff, 0x8, 0x7, 0xbb, 0xff, 0x98, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf0, 0x7b, 0xff, 0xc2, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xe5, 0x11, 0x9f, 0x80, 0x3f,
+    0xf8, 0x59, 0x9f, 0x8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xea,
+    0x80,
 
     /* U+0049 "I" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8,
-    0xcc, 0xcc, 0xce, 0xff, 0xff, 0xff, 0xcc, 0xcc,
-    0xca, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xcc, 0xcc,
-    0xce, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0xca, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0xaf, 0xff, 0xfe, 0x2e, 0x80, 0x7f, 0xff, 0xc0,
+    0x8c, 0xf8, 0x40, 0x3c, 0x67, 0xcf, 0x19, 0x9c,
+    0xc0, 0x1c, 0x79, 0x9d, 0x40, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xde, 0x8c, 0xce, 0x60, 0xe,
+    0x3c, 0xce, 0xa2, 0x33, 0xe1, 0x0, 0xf1, 0x9f,
+    0x38, 0x7, 0xff, 0xfc, 0x0,
 
     /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x1c,
-    0xcc, 0xcc, 0xc2, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfc, 0xe, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfa,
-    0xa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xf6, 0x5, 0xff, 0xff, 0xff, 0xfe,
-    0xa9, 0xbf, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xbd, 0xff,
-    0xed, 0xa6, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0xbf, 0xff, 0x68, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfe,
+    0xa3, 0x99, 0xe2, 0x0, 0xff, 0xe1, 0x9, 0x9f,
+    0x98, 0x3, 0xee, 0x0, 0xe1, 0x1, 0x0, 0xef,
+    0x0, 0xf0, 0xb8, 0x7, 0x30, 0x20, 0x7, 0x24,
+    0x0, 0x61, 0xd1, 0x0, 0xec, 0xf, 0x0, 0xf3,
+    0xf5, 0x4d, 0xf1, 0x80, 0x79, 0xc1, 0x4c, 0x3,
+    0xc2, 0xac, 0x80, 0x1f, 0x38, 0x80, 0x38, 0x40,
+    0x3f, 0xf8, 0x67, 0x0, 0x11, 0x68, 0x80, 0x7f,
+    0xf0, 0x4f, 0x40, 0x38, 0xfd, 0x40, 0x3f, 0xe7,
+    0xc1, 0x0, 0xf0, 0xd7, 0x42, 0x10, 0x0, 0x49,
+    0x67, 0xe0, 0x3, 0x0,
 
     /* U+004B "K" */
-    0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xfa, 0x4, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x30, 0x4f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xc0, 0x4, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf5, 0x0, 0x4f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfe,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x4f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf0, 0x0,
-    0x6f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x0, 0xd, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x99,
-    0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf0, 0x0, 0xd, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x4f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf8, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xe0, 0x0, 0x4f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x50, 0x4, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfb, 0x0, 0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf2, 0x4, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x80, 0x4f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfe, 0x0,
+    0x4f, 0xff, 0x0, 0x7c, 0x5f, 0xfe, 0xa0, 0xf,
+    0xfe, 0x1d, 0x0, 0x7a, 0x40, 0x3f, 0xf8, 0x6c,
+    0x1, 0xc6, 0x60, 0xf, 0xfe, 0x13, 0x8, 0x7,
+    0x48, 0x7, 0xff, 0xe, 0xc0, 0x38, 0x54, 0x3,
+    0xff, 0x84, 0x84, 0x1, 0xd2, 0x1, 0xff, 0xc3,
+    0xe0, 0xf, 0x30, 0x7, 0xff, 0x8, 0x54, 0x3,
+    0x98, 0x40, 0x3f, 0xf8, 0x52, 0x1, 0xeb, 0x0,
+    0xff, 0xe1, 0xb0, 0x7, 0x21, 0x0, 0x7f, 0xf0,
+    0x98, 0x40, 0x3b, 0xc0, 0x3f, 0xf8, 0x76, 0x1,
+    0xc4, 0x80, 0x1f, 0xfb, 0xfe, 0x20, 0xe, 0xb0,
+    0xf, 0xfe, 0x48, 0xb0, 0x7, 0xff, 0x25, 0xc0,
+    0x3f, 0xf9, 0x4e, 0x1, 0xff, 0xca, 0x14, 0x0,
+    0xff, 0xe0, 0xb3, 0x40, 0x1e, 0xf0, 0xf, 0xfe,
+    0xc, 0xcc, 0xa0, 0x1c, 0x82, 0x1, 0xff, 0xc3,
+    0x90, 0xf, 0x48, 0x7, 0xff, 0xc, 0xc8, 0x3,
+    0x98, 0x3, 0xff, 0x89, 0x40, 0x1c, 0x2a, 0x1,
+    0xff, 0xc3, 0x60, 0xf, 0x70, 0x7, 0xff, 0xc,
+    0x54, 0x3, 0x90, 0x80, 0x3f, 0xf8, 0x7c, 0x1,
+    0xea, 0x0, 0xff, 0xe1, 0xa0, 0x80, 0x73, 0x0,
+    0x7f, 0xf1, 0x18, 0x3, 0x85, 0x40, 0x3f, 0xf8,
+    0x72, 0x1, 0xee, 0x0, 0xff, 0xe1, 0x8a, 0x0,
+    0x72, 0x10, 0x7, 0xff, 0xf, 0x80, 0x3d, 0x40,
+    0x1f, 0xfc, 0x35, 0x10, 0xe, 0x60,
 
     /* U+004C "L" */
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc6, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x2f, 0xff, 0x10, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfe,
+    0x5e, 0xcc, 0xff, 0x98, 0x3, 0xe3, 0x3f, 0xfd,
+    0xc0, 0x1f, 0xff, 0xf0, 0xe,
 
     /* U+004D "M" */
-    0x3f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf7, 0x3f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x2f, 0xff, 0xef, 0xff, 0xf7, 0x3f, 0xff,
-    0xfd, 0xff, 0xf8, 0x0, 0x6, 0xff, 0xfb, 0xff,
-    0xff, 0x73, 0xff, 0xff, 0xbf, 0xff, 0xb0, 0x0,
-    0x9f, 0xff, 0x9f, 0xff, 0xf7, 0x3f, 0xff, 0xfb,
-    0xef, 0xff, 0x0, 0xd, 0xff, 0xe8, 0xff, 0xff,
-    0x73, 0xff, 0xff, 0xca, 0xff, 0xf3, 0x1, 0xff,
-    0xfa, 0xaf, 0xff, 0xf7, 0x3f, 0xff, 0xfe, 0x5f,
-    0xff, 0x70, 0x5f, 0xff, 0x6c, 0xff, 0xff, 0x73,
-    0xff, 0xff, 0xf2, 0xff, 0xfa, 0x8, 0xff, 0xf2,
-    0xdf, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x1d, 0xff,
-    0xe0, 0xcf, 0xfe, 0xf, 0xff, 0xff, 0x73, 0xff,
-    0xff, 0xf3, 0x9f, 0xff, 0x3f, 0xff, 0xa0, 0xff,
-    0xff, 0xf7, 0x3f, 0xff, 0xff, 0x45, 0xff, 0xfa,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0x73, 0xff, 0xff,
-    0xf5, 0x1f, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff,
-    0xf7, 0x3f, 0xff, 0xff, 0x60, 0xdf, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf6,
-    0x9, 0xff, 0xff, 0xf9, 0x3, 0xff, 0xff, 0xf7,
-    0x3f, 0xff, 0xff, 0x70, 0x5f, 0xff, 0xff, 0x50,
-    0x4f, 0xff, 0xff, 0x73, 0xff, 0xff, 0xf7, 0x1,
-    0xdd, 0xdd, 0xd1, 0x4, 0xff, 0xff, 0xf7, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x73, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x73, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x73, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x73,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x73, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf7, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x73, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf7, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x70,
+    0x3f, 0xff, 0xa4, 0x3, 0x9f, 0xff, 0xe7, 0x0,
+    0xfc, 0xa0, 0x1d, 0xa0, 0x1f, 0xfc, 0x43, 0x0,
+    0xe4, 0x0, 0xff, 0xe2, 0xa0, 0x4, 0x42, 0x0,
+    0x10, 0xf, 0xf1, 0x0, 0x58, 0x1, 0x20, 0x4,
+    0xa0, 0x1f, 0xe6, 0x0, 0x8c, 0x2, 0xf0, 0x8,
+    0x80, 0x3f, 0xe1, 0x0, 0x20, 0x4, 0x80, 0x1,
+    0x10, 0x7, 0xf9, 0xd0, 0x2, 0x30, 0x12, 0x0,
+    0x21, 0x0, 0x7f, 0x8b, 0xc0, 0x24, 0x4, 0x0,
+    0xb1, 0x80, 0x3f, 0xc2, 0xe0, 0x16, 0x86, 0x80,
+    0x48, 0x20, 0x1f, 0xf1, 0x90, 0x1, 0x1, 0x0,
+    0x2, 0x44, 0x0, 0xff, 0x89, 0x0, 0x2, 0x66,
+    0x0, 0x20, 0x7, 0xff, 0x5, 0xf0, 0x2, 0x90,
+    0xb, 0x4, 0x3, 0xff, 0xa, 0x0, 0x4a, 0x1,
+    0x21, 0x80, 0x7f, 0xe3, 0x12, 0x0, 0xe1, 0x21,
+    0x0, 0xff, 0xe1, 0x20, 0x7, 0x38, 0x7, 0xff,
+    0x8, 0x43, 0x0, 0x3b, 0x1, 0xc0, 0x3f, 0xf8,
+    0x48, 0x45, 0xc8, 0x1, 0xff, 0xc2, 0xf0, 0x1d,
+    0xde, 0x10, 0xf, 0xfe, 0x60, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0xb0,
 
     /* U+004E "N" */
-    0x7f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xdf, 0xff, 0xfb, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xb7, 0xff, 0xff, 0xef, 0xff, 0xf5, 0x0,
-    0x0, 0xdf, 0xff, 0xfb, 0x7f, 0xff, 0xfa, 0xff,
-    0xff, 0xa0, 0x0, 0xd, 0xff, 0xff, 0xb7, 0xff,
-    0xff, 0xab, 0xff, 0xff, 0x0, 0x0, 0xdf, 0xff,
-    0xfb, 0x7f, 0xff, 0xfb, 0x6f, 0xff, 0xf5, 0x0,
-    0xd, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xa0, 0x0, 0xdf, 0xff, 0xfb, 0x7f, 0xff,
-    0xfd, 0xb, 0xff, 0xff, 0x0, 0xd, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xf5, 0x0,
-    0xdf, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xa0, 0xd, 0xff, 0xff, 0xb7, 0xff, 0xff,
-    0xf0, 0xc, 0xff, 0xff, 0x0, 0xcf, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0x0, 0x6f, 0xff, 0xf5, 0xb,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xa0, 0xaf, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0x10, 0xc, 0xff, 0xff, 0x9, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xf1, 0x0, 0x7f, 0xff, 0xf5, 0x8f,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0x10, 0x1, 0xff,
-    0xff, 0xa7, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xf1,
-    0x0, 0xc, 0xff, 0xff, 0x6f, 0xff, 0xfb, 0x7f,
-    0xff, 0xff, 0x10, 0x0, 0x7f, 0xff, 0xf9, 0xff,
-    0xff, 0xb7, 0xff, 0xff, 0xf1, 0x0, 0x2, 0xff,
-    0xff, 0xef, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x10,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xfb, 0x7f, 0xff, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xb0,
+    0x7f, 0xff, 0x84, 0x3, 0xdb, 0xff, 0xac, 0x3,
+    0xf2, 0x0, 0x7f, 0xf2, 0x38, 0x3, 0xff, 0x90,
+    0x80, 0x1f, 0xfc, 0x95, 0x0, 0xff, 0xe4, 0x70,
+    0x7, 0xff, 0x21, 0x0, 0x3f, 0xf8, 0x82, 0x1,
+    0x94, 0x3, 0xff, 0x86, 0x80, 0x1b, 0xc0, 0x3f,
+    0xf8, 0x88, 0x1, 0x28, 0x7, 0xff, 0xc, 0x74,
+    0x3, 0x28, 0x7, 0xff, 0x9, 0xdc, 0x1, 0xbc,
+    0x3, 0xff, 0x84, 0x22, 0x40, 0x9, 0x40, 0x3f,
+    0xf8, 0x46, 0x1a, 0x1, 0x94, 0x3, 0xff, 0x82,
+    0x20, 0xe0, 0x1b, 0xc0, 0x3f, 0xf8, 0x62, 0x60,
+    0x12, 0x80, 0x4, 0x3, 0xff, 0x83, 0x40, 0x19,
+    0x41, 0xc0, 0x3f, 0xf8, 0x2e, 0x1, 0xbc, 0x4,
+    0x3, 0xfe, 0x10, 0x13, 0x0, 0x94, 0xc, 0x3,
+    0xff, 0x85, 0x60, 0x19, 0x44, 0x3, 0xff, 0x84,
+    0xc0, 0x1b, 0xfc, 0x1, 0xff, 0xc2, 0x13, 0x0,
+    0x94, 0x40, 0x3f, 0xf8, 0x76, 0x1, 0xbc, 0x3,
+    0xff, 0x86, 0xa0, 0x19, 0xc0, 0x3f, 0xf8, 0x64,
+    0x60, 0x10, 0x80, 0x7f, 0xf1, 0x2c, 0x3, 0xff,
+    0x90, 0xa0, 0x1f, 0xfc, 0x82, 0x20, 0x7, 0xff,
+    0x22, 0x80, 0x3f, 0xf9, 0xa, 0x1, 0xff, 0xc8,
+    0x22, 0x0, 0x7c,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x59, 0xde, 0xfe, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xb9, 0xbe, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x44, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf8, 0x6f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x97, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x6f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x94, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0xa, 0xff, 0xff, 0xff, 0x40, 0xbf,
-    0xff, 0xff, 0xff, 0xb9, 0xae, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xde,
-    0xfe, 0xda, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0xf2, 0xce, 0xf7, 0xf6, 0xd3, 0x8, 0x7,
+    0xf3, 0x75, 0x31, 0x8, 0x9, 0x2c, 0xf4, 0x0,
+    0x7d, 0x52, 0x20, 0x1f, 0xe7, 0xc1, 0x0, 0xd2,
+    0xa0, 0x1f, 0xfc, 0x13, 0xa0, 0x8, 0xd8, 0x3,
+    0xff, 0x86, 0x8e, 0x0, 0x80, 0xf, 0x91, 0x90,
+    0x40, 0x3d, 0x20, 0x28, 0x1, 0xc7, 0xd7, 0x37,
+    0xca, 0x1, 0xc2, 0x8a, 0x1, 0xee, 0x10, 0xd,
+    0x42, 0x1, 0xd8, 0x40, 0x1c, 0x24, 0x1, 0xe5,
+    0x0, 0xe1, 0x10, 0x7, 0x18, 0x7, 0xc2, 0x1,
+    0xc6, 0x1, 0xff, 0xc8, 0x10, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xc2,
+    0x20, 0xe, 0x30, 0xf, 0x84, 0x3, 0x8c, 0x80,
+    0x38, 0x48, 0x3, 0xca, 0x1, 0xc2, 0xa0, 0x1e,
+    0xe1, 0x0, 0xd4, 0x20, 0x1d, 0x82, 0x80, 0x1c,
+    0x7d, 0x73, 0x5c, 0xa0, 0x1c, 0x28, 0x10, 0x1,
+    0xf2, 0x32, 0x88, 0x7, 0xa0, 0x0, 0x6e, 0x1,
+    0xff, 0xc3, 0x46, 0x0, 0xa1, 0x80, 0x3f, 0xf8,
+    0x27, 0x40, 0x1d, 0x34, 0x20, 0x1f, 0xe7, 0xc1,
+    0x0, 0xf2, 0xf5, 0x31, 0x8, 0x9, 0x2c, 0xfc,
+    0x0, 0x60,
 
     /* U+0050 "P" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x3f,
-    0xff, 0xff, 0xf9, 0x99, 0x99, 0xbf, 0xff, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfb,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x28, 0xff, 0xff,
-    0xff, 0xf4, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf9, 0x99, 0x98, 0x86,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfb, 0xb2, 0x54, 0x3, 0xff, 0x8c,
+    0x26, 0xd5, 0xcc, 0x1, 0xff, 0xc8, 0x19, 0xb0,
+    0xf, 0xfe, 0x4a, 0x58, 0x7, 0xff, 0x25, 0x1c,
+    0x3, 0xf3, 0x37, 0x20, 0x7, 0xd0, 0x20, 0x1f,
+    0x44, 0xce, 0xbd, 0x30, 0xf, 0x38, 0x7, 0xff,
+    0x4, 0xb4, 0x40, 0x3b, 0x40, 0x3f, 0xf8, 0x42,
+    0xc0, 0x1c, 0xc0, 0x1f, 0xfc, 0x3e, 0x0, 0xe3,
+    0x0, 0xff, 0xec, 0xe8, 0x7, 0x10, 0x7, 0xff,
+    0x9, 0x50, 0x3, 0x94, 0x3, 0xff, 0x14, 0x50,
+    0x7, 0xb4, 0x3, 0xee, 0xff, 0xda, 0xe0, 0x1e,
+    0x34, 0x0, 0xff, 0xe4, 0x78, 0x7, 0xff, 0x22,
+    0x8c, 0x3, 0xff, 0x8c, 0x36, 0xa0, 0x1f, 0xfc,
+    0x51, 0x8e, 0x40, 0xf, 0xf3, 0x36, 0x77, 0x4e,
+    0xf3, 0x80, 0x7f, 0xe8, 0x99, 0xa2, 0xc, 0x40,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x0,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfb, 0x9b, 0xef, 0xff, 0xff,
-    0xff, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x1a, 0xff, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xa0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xb0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xa0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x80,
-    0x2f, 0xff, 0xff, 0xfc, 0x10, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0x50, 0xd, 0xff, 0xff, 0xff, 0xfc,
-    0xaa, 0xef, 0xff, 0xff, 0xff, 0x10, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xdf, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf1,
+    0x0, 0xf2, 0xd6, 0xff, 0xdb, 0x4c, 0x20, 0x1f,
+    0xe4, 0xea, 0x52, 0x0, 0x89, 0x67, 0x9c, 0x3,
+    0xf4, 0xd8, 0x80, 0x7f, 0xa3, 0x4, 0x3, 0xa1,
+    0x80, 0x3f, 0xf8, 0x27, 0x40, 0x19, 0x1c, 0x3,
+    0xff, 0x86, 0x90, 0x1, 0x40, 0x7, 0xc8, 0xc8,
+    0x20, 0x1e, 0x70, 0x1, 0x18, 0x7, 0x16, 0xdc,
+    0xdf, 0xa8, 0x7, 0x94, 0x1c, 0x3, 0xde, 0x40,
+    0x10, 0xd8, 0x80, 0x76, 0x81, 0x0, 0x70, 0x90,
+    0x7, 0xa, 0x80, 0x71, 0x0, 0x7c, 0x60, 0x1f,
+    0x8, 0x7, 0xff, 0x3c, 0x40, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x10, 0x40, 0x3e, 0x30, 0xf, 0x84, 0x3, 0xe2,
+    0x0, 0xe1, 0x20, 0xf, 0x28, 0x7, 0x10, 0x38,
+    0x7, 0xb8, 0x40, 0x35, 0x8, 0x7, 0x68, 0x11,
+    0x0, 0x38, 0xfb, 0x2a, 0x9c, 0xa0, 0x1e, 0x40,
+    0x4, 0x0, 0x7c, 0x6a, 0xa1, 0x0, 0xf3, 0x8,
+    0x1, 0x58, 0x3, 0xff, 0x86, 0x52, 0x1, 0xa5,
+    0x40, 0x3f, 0xf8, 0x25, 0xe0, 0x1e, 0xaa, 0x8,
+    0x7, 0xf9, 0xb4, 0x80, 0x3e, 0x5e, 0x95, 0x20,
+    0xf, 0xfe, 0x3b, 0x56, 0xfd, 0x80, 0x73, 0x10,
+    0x7, 0xff, 0x9, 0x10, 0x1, 0xd2, 0x1, 0xff,
+    0xc3, 0x80, 0xe, 0x44, 0x0, 0x7f, 0xf0, 0x8d,
+    0x40, 0x3a, 0x40, 0x3f, 0xf8, 0x70, 0x1, 0xc4,
+    0xc0, 0x1f, 0xfc, 0x22, 0x70, 0xe, 0x80, 0xf,
+    0xfe, 0x1c, 0x80, 0x70, 0xc0, 0x7, 0xff, 0x8,
+    0x60, 0x3, 0x9c, 0x40,
 
     /* U+0052 "R" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x72,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x3f,
-    0xff, 0xff, 0xf9, 0x99, 0x9a, 0xef, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf3, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xff, 0xf9, 0x99, 0x9b, 0xef, 0xff, 0xff,
-    0xff, 0x60, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0xdf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0xa,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xd0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfb,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x20, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x90, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf8,
+    0x3f, 0xff, 0xfb, 0xad, 0xc8, 0x3, 0xff, 0x8c,
+    0x29, 0x1b, 0x64, 0x1, 0xff, 0xc8, 0x4d, 0x60,
+    0xf, 0xfe, 0x4c, 0xa8, 0x7, 0xff, 0x26, 0x84,
+    0x3, 0xf3, 0x36, 0x51, 0x0, 0xfa, 0x0, 0x3f,
+    0x4c, 0xea, 0xe9, 0x0, 0xf3, 0x80, 0x7f, 0xf0,
+    0x9a, 0x0, 0x38, 0x48, 0x3, 0xff, 0x84, 0xc0,
+    0x1e, 0x60, 0xf, 0xfe, 0x10, 0x80, 0x7f, 0xf2,
+    0x44, 0x3, 0xce, 0x1, 0xff, 0xc2, 0x60, 0xf,
+    0x10, 0x7, 0xff, 0x5, 0xa0, 0x3, 0x8c, 0x40,
+    0x3e, 0x99, 0xd7, 0xd2, 0x1, 0xea, 0x0, 0xfc,
+    0xcd, 0x90, 0x40, 0x3c, 0x4c, 0x1, 0xff, 0xc8,
+    0xe0, 0xf, 0xfe, 0x45, 0x98, 0x7, 0xff, 0x19,
+    0x75, 0x0, 0x3f, 0xf8, 0xf0, 0x40, 0x1f, 0xf7,
+    0xfc, 0x40, 0x1d, 0x60, 0x1f, 0xfc, 0x3a, 0x0,
+    0xe6, 0x10, 0xf, 0xfe, 0x13, 0x0, 0x7a, 0x40,
+    0x3f, 0xf8, 0x42, 0xa0, 0x1c, 0xc0, 0x1f, 0xfc,
+    0x39, 0x0, 0xe1, 0x60, 0xf, 0xfe, 0x11, 0x98,
+    0x3, 0xac, 0x3, 0xff, 0x87, 0x40, 0x1c, 0x48,
+    0x1, 0xff, 0xc2, 0x61, 0x0, 0xef, 0x0, 0xff,
+    0xe1, 0xb8, 0x7, 0x21, 0x0, 0x7f, 0xf0, 0xac,
+    0x3, 0xd6, 0x1, 0xff, 0xc2, 0x24, 0x0, 0xe6,
+    0x10, 0xf, 0xfe, 0x17, 0x0, 0x7a, 0x40,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x17, 0xbd, 0xef, 0xed, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xf, 0xff, 0xff, 0xff, 0xd9, 0x8a,
-    0xef, 0xff, 0xff, 0xfe, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf3,
-    0x0, 0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x60, 0x7, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x8, 0xcc, 0xcc, 0xc5, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xb6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0x72, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xef, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x10, 0x33, 0x33, 0x33, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x30, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf1, 0xa, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xfe, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xeb, 0x9a, 0xdf, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xc8, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0xf0, 0xbd, 0xef, 0x7f, 0x6d, 0x30, 0x7,
+    0xfc, 0x33, 0xd0, 0x84, 0x20, 0x24, 0xb3, 0xf0,
+    0x1, 0xf8, 0xbd, 0x80, 0x3f, 0xe7, 0xc1, 0x0,
+    0xe1, 0xf1, 0x0, 0xff, 0xe0, 0x9e, 0x80, 0x74,
+    0x90, 0x7, 0xff, 0xc, 0xdc, 0x3, 0x38, 0x7,
+    0x89, 0x9d, 0x44, 0x3, 0xd2, 0x1, 0x20, 0x7,
+    0x9f, 0x66, 0x2b, 0x98, 0x3, 0x84, 0xc0, 0x4,
+    0x1, 0xc5, 0x0, 0x1d, 0x24, 0x1, 0xca, 0x0,
+    0x10, 0xe, 0x70, 0xf, 0x94, 0xcf, 0xc0, 0x1f,
+    0x98, 0x3, 0xe8, 0xcc, 0xe5, 0x0, 0x18, 0x7,
+    0x1a, 0x80, 0x7f, 0xf0, 0xd0, 0x3, 0xd5, 0x6c,
+    0x40, 0x1f, 0xfc, 0x16, 0x0, 0xf2, 0x4e, 0xf5,
+    0xb9, 0x0, 0x7f, 0x40, 0x80, 0x7e, 0x14, 0x8d,
+    0xc4, 0x0, 0xf8, 0x74, 0x40, 0x3f, 0xe3, 0xb9,
+    0x0, 0xf8, 0xf0, 0x80, 0x3f, 0xf3, 0x58, 0x7,
+    0xc5, 0xb2, 0x40, 0x1f, 0xf2, 0x40, 0x7, 0xe6,
+    0xdc, 0x84, 0x10, 0xf, 0xce, 0x40, 0x1f, 0xc6,
+    0xf7, 0xdb, 0x2, 0x1, 0xeb, 0x0, 0xff, 0xe0,
+    0x93, 0xf9, 0x0, 0x72, 0x0, 0x7f, 0xf0, 0xc6,
+    0x40, 0x38, 0x84, 0xc, 0xfc, 0x1, 0xf9, 0x0,
+    0x3c, 0x61, 0x99, 0xe3, 0x0, 0xff, 0xe1, 0x8,
+    0x8, 0x7, 0x50, 0x7, 0xca, 0x1, 0xe2, 0x4,
+    0x0, 0xe6, 0x80, 0xe, 0x5b, 0x0, 0xe1, 0x10,
+    0x70, 0x7, 0x9f, 0xae, 0x6b, 0x68, 0x40, 0x39,
+    0xc0, 0x8, 0x60, 0x1e, 0x14, 0x65, 0x20, 0xf,
+    0xac, 0x2, 0xe1, 0x0, 0xff, 0xe2, 0x49, 0x0,
+    0x45, 0x82, 0x1, 0xff, 0xc2, 0x86, 0x0, 0xe2,
+    0xf6, 0x0, 0xff, 0x8f, 0x1c, 0x3, 0xe1, 0x9e,
+    0x95, 0x20, 0x8, 0x4d, 0xf3, 0x6, 0x1, 0x80,
 
     /* U+0054 "T" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x83, 0xcc, 0xcc, 0xcc, 0xce, 0xff, 0xff,
-    0xff, 0xcc, 0xcc, 0xcc, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xfe, 0x4c, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xf8, 0xac, 0x67, 0xf0, 0x80, 0x78, 0xcf,
+    0xee, 0x3c, 0xcf, 0x98, 0x3, 0x8f, 0x33, 0xe6,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xcf,
 
     /* U+0055 "U" */
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x95, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0xb, 0xff, 0xff, 0xff, 0x40, 0xcf,
-    0xff, 0xff, 0xff, 0xb9, 0xae, 0xff, 0xff, 0xff,
-    0xe0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xde,
-    0xff, 0xda, 0x61, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0xd0, 0xf, 0xab, 0xff, 0xac, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0x51, 0x10, 0x7, 0x10, 0x7, 0xc2, 0x1,
+    0xc6, 0x60, 0xf, 0x20, 0x7, 0xa, 0x0, 0x70,
+    0xa0, 0x7, 0xa4, 0x40, 0x35, 0x0, 0x7b, 0x4,
+    0xc0, 0x38, 0xba, 0xe6, 0xb9, 0x0, 0x38, 0x50,
+    0x20, 0x3, 0xe4, 0x65, 0x10, 0xf, 0x48, 0x1,
+    0x14, 0x3, 0xff, 0x86, 0x6e, 0x1, 0x52, 0x80,
+    0x7f, 0xf0, 0x4f, 0x40, 0x3a, 0xa4, 0x40, 0x3f,
+    0xcf, 0x82, 0x1, 0xe6, 0xea, 0x52, 0x10, 0x1,
+    0x2c, 0xf4, 0x0, 0x60,
 
     /* U+0056 "V" */
-    0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf0, 0x9f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
-    0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x40,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x10, 0x9, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf9, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0x4, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0xa, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x50, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x80, 0x1f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x4f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf3, 0xaf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf6, 0xdf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xfe, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xfe, 0xa0, 0xf, 0xe4, 0xff, 0xf0, 0x20,
+    0x7, 0x20, 0x7, 0xf6, 0x0, 0x71, 0x86, 0x0,
+    0x70, 0x88, 0x3, 0xf1, 0x80, 0x72, 0x2, 0x0,
+    0x79, 0x0, 0x3f, 0x28, 0x7, 0x60, 0x9, 0x0,
+    0x76, 0x80, 0x7c, 0x42, 0x1, 0xca, 0x0, 0x40,
+    0xe, 0x40, 0xf, 0x9c, 0x3, 0x88, 0x40, 0x18,
+    0x1, 0xc6, 0x1, 0xf6, 0x0, 0x72, 0x0, 0x48,
+    0x1, 0xe2, 0x0, 0xf2, 0x80, 0x76, 0x0, 0x42,
+    0x40, 0x1c, 0x80, 0x1e, 0x30, 0xe, 0x40, 0xc,
+    0x80, 0x1d, 0xe0, 0x1c, 0x60, 0x1c, 0x42, 0x1,
+    0xbc, 0x3, 0x90, 0x3, 0x94, 0x3, 0x90, 0x3,
+    0x90, 0x3, 0x88, 0x3, 0xbc, 0x3, 0xb0, 0x3,
+    0x88, 0x40, 0x39, 0x0, 0x32, 0x0, 0x72, 0x0,
+    0x79, 0x0, 0x38, 0xc0, 0x31, 0x0, 0x61, 0x10,
+    0x7, 0xb0, 0x3, 0xb0, 0x2, 0x40, 0xe, 0x40,
+    0xf, 0x90, 0x3, 0x94, 0x2, 0x30, 0xe, 0xc0,
+    0xf, 0x88, 0x40, 0x30, 0x90, 0x3, 0x40, 0x39,
+    0x0, 0x3f, 0x20, 0x7, 0x38, 0x1, 0x0, 0x30,
+    0x90, 0x7, 0xec, 0x0, 0xed, 0x1, 0x10, 0x6,
+    0x40, 0xf, 0xe4, 0x0, 0xe4, 0x5, 0x0, 0xec,
+    0x0, 0xfe, 0x21, 0x0, 0xc6, 0x6, 0x1, 0xc8,
+    0x1, 0xfe, 0x40, 0xe, 0x3d, 0x0, 0xc2, 0x40,
+    0x1f, 0xec, 0x0, 0xe5, 0x70, 0xc, 0xa0, 0x1f,
+    0xf2, 0x0, 0x77, 0x90, 0x6, 0xc0, 0xf, 0xf8,
+    0x84, 0x3, 0x38, 0x7, 0x20, 0x7, 0xfe, 0x50,
+    0xc, 0x20, 0x1c, 0x60, 0x1f, 0xfb, 0x0, 0x3f,
+    0x90, 0x3, 0xff, 0x82, 0x80, 0x1f, 0xd8, 0x1,
+    0xff, 0xc1, 0x30, 0xf, 0xe4, 0x0, 0xff, 0xe1,
+    0x20, 0x7, 0xe3, 0x0, 0xff, 0xe1, 0x60, 0x7,
+    0xc8, 0x1, 0xf8,
 
     /* U+0057 "W" */
-    0x8f, 0xff, 0xf7, 0x0, 0x0, 0xdf, 0xff, 0xf1,
-    0x0, 0x4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x80,
-    0x0, 0xe, 0xff, 0xff, 0x30, 0x0, 0x5f, 0xff,
-    0xfa, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0xff, 0xff,
-    0xf5, 0x0, 0x7, 0xff, 0xff, 0x84, 0xff, 0xff,
-    0xa0, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x0, 0x8f,
-    0xff, 0xf6, 0x2f, 0xff, 0xfc, 0x0, 0x4, 0xff,
-    0xef, 0xf8, 0x0, 0x9, 0xff, 0xff, 0x51, 0xff,
-    0xff, 0xd0, 0x0, 0x6f, 0xfc, 0xff, 0xa0, 0x0,
-    0xaf, 0xff, 0xf3, 0xf, 0xff, 0xfe, 0x0, 0x8,
-    0xff, 0xaf, 0xfc, 0x0, 0xb, 0xff, 0xff, 0x20,
-    0xef, 0xff, 0xf0, 0x0, 0xaf, 0xf7, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xf0, 0xc, 0xff, 0xff, 0x0,
-    0xc, 0xff, 0x5f, 0xff, 0x0, 0xd, 0xff, 0xff,
-    0x0, 0xbf, 0xff, 0xf2, 0x0, 0xdf, 0xf3, 0xff,
-    0xf1, 0x0, 0xef, 0xff, 0xd0, 0x9, 0xff, 0xff,
-    0x30, 0xf, 0xff, 0x2e, 0xff, 0x30, 0xf, 0xff,
-    0xfb, 0x0, 0x8f, 0xff, 0xf4, 0x1, 0xff, 0xf0,
-    0xcf, 0xf5, 0x0, 0xff, 0xff, 0xa0, 0x6, 0xff,
-    0xff, 0x50, 0x3f, 0xfe, 0xa, 0xff, 0x70, 0x2f,
-    0xff, 0xf8, 0x0, 0x5f, 0xff, 0xf6, 0x5, 0xff,
-    0xc0, 0x9f, 0xf9, 0x3, 0xff, 0xff, 0x70, 0x3,
-    0xff, 0xff, 0x80, 0x7f, 0xfb, 0x7, 0xff, 0xa0,
-    0x4f, 0xff, 0xf5, 0x0, 0x2f, 0xff, 0xf9, 0x9,
-    0xff, 0x90, 0x6f, 0xfc, 0x5, 0xff, 0xff, 0x30,
-    0x0, 0xff, 0xff, 0xa0, 0xbf, 0xf7, 0x4, 0xff,
-    0xe0, 0x6f, 0xff, 0xf2, 0x0, 0xf, 0xff, 0xfb,
-    0xd, 0xff, 0x50, 0x3f, 0xff, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0xdf, 0xff, 0xc0, 0xef, 0xf3, 0x1,
-    0xff, 0xf2, 0x8f, 0xff, 0xf0, 0x0, 0xc, 0xff,
-    0xfe, 0xf, 0xff, 0x20, 0xf, 0xff, 0x49, 0xff,
-    0xfd, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0xff, 0xf0,
-    0x0, 0xef, 0xf5, 0xaf, 0xff, 0xc0, 0x0, 0x9,
-    0xff, 0xff, 0x4f, 0xfe, 0x0, 0xc, 0xff, 0x7b,
-    0xff, 0xfa, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0xff,
-    0xc0, 0x0, 0xbf, 0xf9, 0xcf, 0xff, 0x80, 0x0,
-    0x6, 0xff, 0xff, 0x9f, 0xfb, 0x0, 0x9, 0xff,
-    0xbd, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0xfb,
-    0xff, 0x90, 0x0, 0x7f, 0xfc, 0xef, 0xff, 0x50,
-    0x0, 0x3, 0xff, 0xff, 0xdf, 0xf7, 0x0, 0x6,
-    0xff, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfc, 0x0, 0x0,
+    0x8f, 0xfc, 0xe0, 0x1b, 0x7f, 0xf0, 0x80, 0x49,
+    0xff, 0xaf, 0xc0, 0x37, 0x80, 0x63, 0x0, 0xc4,
+    0x1, 0x8, 0x6, 0x12, 0x0, 0xc2, 0x1, 0x84,
+    0x3, 0x30, 0x4, 0x40, 0x18, 0x84, 0x3, 0x18,
+    0x4, 0x40, 0x1c, 0x60, 0x17, 0x80, 0x6e, 0x60,
+    0xc, 0xc0, 0x13, 0x0, 0x4, 0x1, 0xc0, 0x10,
+    0x80, 0x63, 0x30, 0x6, 0x10, 0x8, 0x80, 0x4,
+    0x0, 0x20, 0x8, 0xc0, 0x33, 0x8, 0x6, 0x30,
+    0xb, 0x80, 0xc, 0x0, 0x60, 0x8, 0x40, 0x30,
+    0x80, 0x80, 0x42, 0x1, 0x10, 0x3, 0x40, 0x4,
+    0x1, 0x38, 0x6, 0x20, 0x20, 0xf, 0x98, 0x0,
+    0x40, 0x1, 0x0, 0x84, 0x3, 0xce, 0x1, 0x88,
+    0x0, 0x20, 0x6, 0x0, 0x84, 0x0, 0x60, 0x11,
+    0x0, 0x8, 0x3, 0x8, 0x0, 0x80, 0x2, 0x20,
+    0x1, 0x0, 0x4, 0x2, 0x60, 0x0, 0x80, 0x67,
+    0x1, 0x0, 0x88, 0x80, 0x6, 0x0, 0xf0, 0x80,
+    0x38, 0x3, 0x8, 0x10, 0x0, 0x41, 0x80, 0x4,
+    0x4, 0x1, 0x88, 0x0, 0x60, 0x18, 0xc1, 0x80,
+    0x4, 0x6, 0x0, 0xe0, 0x10, 0xd, 0xe0, 0x6,
+    0x0, 0xdc, 0x4, 0x0, 0x70, 0xe0, 0x1, 0x83,
+    0x80, 0x62, 0x0, 0x8, 0x6, 0x10, 0xe0, 0x1,
+    0x0, 0x80, 0x18, 0x4, 0x3, 0x30, 0x0, 0x80,
+    0x31, 0x81, 0x0, 0x38, 0x8, 0x0, 0x40, 0x60,
+    0x18, 0x40, 0x3e, 0x10, 0x60, 0x1, 0x3, 0x80,
+    0x4, 0x4, 0x3, 0x10, 0x4, 0x40, 0x13, 0x81,
+    0x80, 0x18, 0x8, 0x2, 0x2f, 0x0, 0xfc, 0x20,
+    0x11, 0x0, 0x80, 0x4, 0x4, 0x2, 0x61, 0x0,
+    0x88, 0x3, 0x38, 0x4, 0x24, 0x1, 0x10, 0x0,
+    0x40, 0x2, 0x60, 0x10, 0x80, 0x62, 0x0, 0xcc,
+    0x0, 0x10, 0x8, 0x80, 0x4, 0x20, 0x13, 0x0,
+    0x61, 0x0, 0xc4, 0x0, 0x20, 0x9, 0xc0, 0x1c,
+    0xe0, 0x11, 0x0, 0x6e, 0x0, 0xde, 0x0, 0x70,
+    0x8, 0x80, 0x4, 0x20, 0x17, 0x80, 0x63, 0x0,
+    0xc4, 0x0, 0x20, 0xb, 0x80, 0xe, 0x60, 0x11,
+    0x0, 0x66, 0x0, 0xcc, 0x0, 0xe0, 0x8, 0x40,
+    0x4, 0x20, 0x10, 0x80, 0x61, 0x0, 0xc4, 0x0,
+    0x20, 0x8, 0x80, 0x2, 0x1, 0x98, 0x3, 0x10,
+    0x7, 0xc2, 0x1, 0x38, 0x7, 0xc6, 0x1, 0xff,
+    0x98, 0x2, 0x20, 0xf, 0x84, 0x3, 0x88, 0x3,
+    0xc4, 0x1, 0x8, 0x7, 0x88, 0x3, 0xc2, 0x1,
+    0xc2, 0x1, 0xc2, 0x1, 0xc2, 0x1, 0x0,
 
     /* U+0058 "X" */
-    0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x2f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfe, 0x0, 0x9, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf5, 0x1, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xd0, 0x8f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x4e, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xfa, 0xa, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xb0, 0x0, 0xbf, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf4, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x5, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf1, 0x0, 0x6f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x90, 0xe,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x10,
+    0x5, 0xff, 0xf4, 0x0, 0x7c, 0x7f, 0xfe, 0x80,
+    0x2, 0x90, 0x7, 0x38, 0x80, 0x7a, 0x40, 0x3d,
+    0x20, 0x14, 0x0, 0x79, 0x80, 0x38, 0x94, 0x3,
+    0x9c, 0x40, 0x25, 0x30, 0xe, 0x90, 0xe, 0x80,
+    0xf, 0x48, 0x7, 0x40, 0x7, 0xb, 0x0, 0x44,
+    0xa0, 0x1c, 0xe2, 0x1, 0xc8, 0x60, 0x1d, 0x0,
+    0x15, 0x80, 0x70, 0xc0, 0x7, 0xd0, 0x1, 0xc2,
+    0xa0, 0x2c, 0x1, 0xd2, 0x1, 0xf9, 0xc, 0x3,
+    0xa0, 0x24, 0x3, 0x85, 0xc0, 0x3f, 0xa0, 0x3,
+    0x89, 0x18, 0x3, 0xa4, 0x3, 0xfc, 0x88, 0x0,
+    0xea, 0x10, 0xc, 0x2e, 0x1, 0xff, 0x40, 0x7,
+    0x8, 0x7, 0x40, 0x7, 0xfe, 0x34, 0x0, 0xfe,
+    0x16, 0x0, 0xff, 0xe0, 0xc0, 0x7, 0xf4, 0x0,
+    0x7f, 0xf0, 0x8d, 0x40, 0x3e, 0x26, 0x0, 0xff,
+    0xe1, 0xc0, 0x7, 0xd0, 0x1, 0xff, 0xc4, 0x10,
+    0xf, 0x8c, 0x3, 0xff, 0x89, 0x0, 0x1f, 0x40,
+    0x7, 0xff, 0xc, 0xd0, 0x3, 0xe1, 0x60, 0xf,
+    0xfe, 0x14, 0x0, 0x7f, 0x40, 0x7, 0xff, 0x4,
+    0xd0, 0x3, 0xf8, 0x5c, 0x3, 0xff, 0x78, 0x7,
+    0x10, 0x7, 0x48, 0x7, 0xfc, 0x86, 0x1, 0xdc,
+    0x1, 0xc2, 0xe0, 0x1f, 0xe8, 0x0, 0xe5, 0x35,
+    0x0, 0xe9, 0x0, 0xfe, 0x43, 0x0, 0xe9, 0x9,
+    0x0, 0xe1, 0x80, 0xf, 0xd0, 0x1, 0xc8, 0x60,
+    0x68, 0x1, 0xce, 0x20, 0x1e, 0x53, 0x0, 0xef,
+    0x0, 0xa0, 0x3, 0xd2, 0x1, 0xe8, 0x0, 0xe3,
+    0x40, 0x8, 0xd0, 0x3, 0x9c, 0x40, 0x32, 0x90,
+    0x7, 0x40, 0x7, 0x78, 0x7, 0xa4, 0x3, 0x40,
+    0x7, 0x12, 0x0, 0x72, 0x18, 0x7, 0x38, 0x80,
+    0x18, 0x80, 0x3a, 0x0, 0x3e, 0x80, 0xf, 0x40,
+    0x2, 0x0, 0x38, 0x94, 0x3, 0xe4, 0x30, 0xe,
+    0x61,
 
     /* U+0059 "Y" */
-    0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x50, 0xbf, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xe0, 0x4, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf7, 0x0, 0xd, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x6f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xb0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0xc,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf7, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x30, 0x7, 0xf1, 0x7f, 0xf9, 0x49,
+    0x0, 0x3a, 0xc0, 0x3f, 0xac, 0x3, 0x85, 0x43,
+    0xc0, 0x38, 0x90, 0x3, 0xf3, 0x0, 0x74, 0x80,
+    0x10, 0x80, 0x3b, 0x80, 0x3e, 0x60, 0xf, 0x30,
+    0x5, 0x60, 0x1c, 0xa2, 0x1, 0xea, 0x0, 0xe6,
+    0x10, 0x9, 0x84, 0x3, 0x98, 0x3, 0x88, 0xc0,
+    0x3a, 0xc0, 0x39, 0x80, 0x3a, 0x40, 0x3a, 0xc0,
+    0x39, 0x8, 0x3, 0xa4, 0x3, 0x85, 0x40, 0x33,
+    0x0, 0x74, 0x0, 0x78, 0x58, 0x3, 0xb8, 0x2,
+    0x60, 0xe, 0x33, 0x0, 0x7d, 0x60, 0x1c, 0x84,
+    0x0, 0xa0, 0xe, 0x90, 0xf, 0xc4, 0x80, 0x1c,
+    0xa0, 0x26, 0x1, 0x85, 0x40, 0x3f, 0xbc, 0x3,
+    0xa8, 0x1c, 0x3, 0xa4, 0x3, 0xfc, 0x84, 0x1,
+    0x88, 0x9a, 0x1, 0xcc, 0x1, 0xff, 0x58, 0x7,
+    0x2a, 0x0, 0x66, 0x10, 0xf, 0xf9, 0x84, 0x3,
+    0x50, 0x7, 0x58, 0x7, 0xff, 0x5, 0x80, 0x31,
+    0x0, 0x64, 0x20, 0xf, 0xfe, 0xc, 0x80, 0x7f,
+    0x78, 0x7, 0xff, 0x8, 0x54, 0x3, 0xe2, 0x40,
+    0xf, 0xfe, 0x1c, 0x80, 0x7d, 0x60, 0x1f, 0xfc,
+    0x43, 0x40, 0xe, 0x16, 0x0, 0xff, 0xe2, 0x98,
+    0x7, 0x10, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xeb, 0x0,
 
     /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0xce,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x8f, 0xff, 0xfe, 0x2c, 0x80, 0x7f, 0xff, 0xc0,
+    0x3d, 0xc6, 0x7f, 0xe1, 0x0, 0xfc, 0xd9, 0x9f,
+    0xda, 0x1, 0xf5, 0x0, 0x7f, 0xd0, 0x20, 0x1c,
+    0xc6, 0x1, 0xfe, 0x26, 0x0, 0xf4, 0x0, 0x7f,
+    0xd2, 0x1, 0xe8, 0x10, 0xf, 0xf2, 0xa0, 0x7,
+    0x13, 0x80, 0x7f, 0xd0, 0x1, 0xe9, 0x0, 0xff,
+    0x9c, 0x80, 0x39, 0x10, 0x1, 0xfe, 0x18, 0x0,
+    0xf4, 0x80, 0x7f, 0xd6, 0x1, 0xe7, 0x20, 0xf,
+    0xf1, 0xa8, 0x7, 0xc, 0x0, 0x7f, 0xde, 0x1,
+    0xeb, 0x0, 0xff, 0x98, 0xc0, 0x38, 0xd4, 0x3,
+    0xfe, 0x80, 0xf, 0x78, 0x7, 0xfd, 0x2, 0x1,
+    0xcc, 0x60, 0x1f, 0xe2, 0x70, 0xf, 0x40, 0x7,
+    0xfd, 0x20, 0x1e, 0x81, 0x0, 0xff, 0x22, 0x0,
+    0x38, 0x9c, 0x3, 0xfe, 0x90, 0xf, 0x48, 0x7,
+    0xfc, 0xc4, 0x1, 0xc8, 0x80, 0xf, 0xfa, 0xc0,
+    0x3c, 0xd9, 0x9f, 0xf0, 0x7, 0xe2, 0x33, 0xff,
+    0x80, 0x3f, 0xff, 0xe0, 0x1e,
 
     /* U+005B "[" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x70, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x70, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x70, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x70, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xfc, 0x1, 0xff, 0xfb, 0x8f, 0xff,
+    0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xb6,
+    0x3f, 0xfc, 0x1, 0xff, 0xf5,
 
     /* U+005C "\\" */
-    0x68, 0x88, 0x88, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xe0,
+    0x68, 0x8e, 0x50, 0xf, 0xfe, 0x1f, 0xbb, 0xf5,
+    0x80, 0x7f, 0xf0, 0xe8, 0x3, 0x85, 0x0, 0x3f,
+    0xf8, 0x46, 0x40, 0x1d, 0xc0, 0x1f, 0xfc, 0x35,
+    0x0, 0xe5, 0x0, 0xff, 0xe1, 0xd0, 0x7, 0x94,
+    0x3, 0xff, 0x84, 0x46, 0x1, 0xdc, 0x1, 0xff,
+    0xc3, 0xa0, 0xe, 0x41, 0x0, 0xff, 0xe1, 0x38,
+    0x7, 0x9c, 0x3, 0xff, 0x84, 0x28, 0x1, 0xd4,
+    0x1, 0xff, 0xc3, 0xe0, 0xe, 0x32, 0x0, 0xff,
+    0xe1, 0x28, 0x7, 0xa8, 0x3, 0xff, 0x86, 0xa0,
+    0x1c, 0xa0, 0x1f, 0xfc, 0x3e, 0x0, 0xe2, 0x30,
+    0xf, 0xfe, 0x12, 0x8, 0x7, 0x50, 0x7, 0xff,
+    0xd, 0xc0, 0x39, 0xc0, 0x3f, 0xf8, 0x74, 0x1,
+    0xc2, 0x80, 0x1f, 0xfc, 0x23, 0x20, 0xe, 0xe0,
+    0xf, 0xfe, 0x1a, 0x80, 0x72, 0x80, 0x7f, 0xf0,
+    0xe8, 0x3, 0xca, 0x1, 0xff, 0xc2, 0x23, 0x0,
+    0xee, 0x0, 0xff, 0xe1, 0xd0, 0x7, 0x20, 0x80,
+    0x7f, 0xf0, 0x9c, 0x3, 0xcc, 0x1, 0xff, 0xc2,
+    0x14, 0x0, 0xeb, 0x0, 0xff, 0xe1, 0xf0, 0x7,
+    0x19, 0x0, 0x7f, 0xf0, 0x94, 0x3, 0xd4, 0x1,
+    0xff, 0xc3, 0x50, 0xe, 0x50, 0xf, 0xfe, 0x1f,
+    0x0, 0x71, 0x18, 0x7, 0xff, 0x9, 0x4, 0x3,
+    0xa8, 0x3, 0xff, 0x86, 0xe0, 0x1c, 0xe0, 0x1f,
+    0xfc, 0x3a, 0x0, 0xe1, 0x40, 0xf, 0xfe, 0x11,
+    0x90, 0x7, 0x70, 0x7, 0xff, 0xe, 0x80, 0x39,
+    0x40, 0x3f, 0xf8, 0x6a, 0x1, 0xe6, 0x0, 0xff,
+    0xe1, 0x11, 0x80, 0x76, 0x80, 0x7f, 0xf0, 0xe8,
+    0x3, 0x90, 0x40, 0x3f, 0xf8, 0x4e, 0x1, 0xe6,
+    0x0, 0xff, 0xe1, 0xa, 0x0, 0x75, 0x80, 0x7f,
+    0xf0, 0xf8, 0x3, 0x8c, 0x80, 0x3f, 0xf8, 0x4a,
+    0x1, 0xea, 0x0, 0xff, 0xe1, 0xa8, 0x7, 0x30,
+    0x0,
 
     /* U+005D "]" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0xcf, 0xff, 0xfc, 0x20, 0x1f, 0xff, 0xac, 0xff,
+    0xec, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xfb, 0x3f, 0xfb, 0x0, 0x3f, 0xff,
+    0xe0, 0x0,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x4, 0x88, 0x88, 0x86, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfd, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0, 0xbf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfa, 0x5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0xaf,
-    0xff, 0xfe, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0x0, 0x4, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x20, 0x0, 0xe, 0xff, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x30, 0x6, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfa, 0x0, 0xdf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x70,
+    0x0, 0xf9, 0x22, 0x39, 0x80, 0x3f, 0xf8, 0x52,
+    0xef, 0xd2, 0x40, 0x1f, 0xf9, 0x8, 0x3, 0xd4,
+    0x1, 0xff, 0xbc, 0x3, 0xe6, 0x0, 0xff, 0x89,
+    0x0, 0x3e, 0x16, 0x0, 0xff, 0x58, 0x6, 0x20,
+    0xd, 0x60, 0x1f, 0xe6, 0x0, 0xd0, 0x1, 0x88,
+    0xc0, 0x3f, 0x30, 0x7, 0x2a, 0x0, 0x69, 0x0,
+    0xfd, 0x60, 0x19, 0x43, 0x80, 0x32, 0x88, 0x7,
+    0x90, 0x80, 0x37, 0x2, 0x80, 0x74, 0x80, 0x7b,
+    0xc0, 0x30, 0xa0, 0x1, 0x40, 0x33, 0x0, 0x71,
+    0x20, 0x6, 0x60, 0xb, 0x80, 0x30, 0xa8, 0x6,
+    0xa0, 0xe, 0xa0, 0x9, 0x4, 0x3, 0x48, 0x6,
+    0x70, 0xc, 0x64, 0x1, 0x98, 0x3, 0x19, 0x80,
+    0xc, 0x1, 0xd4, 0x1, 0xd6, 0x1, 0xd2, 0x0,
+    0xb0, 0xe, 0x60, 0xe, 0x32, 0x0, 0xca, 0x28,
+    0x40, 0x19, 0x40, 0x3e, 0xa0, 0xe, 0x60,
 
     /* U+005F "_" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x7f, 0xff, 0xfe, 0x3d, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfa, 0x40,
 
     /* U+0060 "`" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xf6,
+    0x0, 0xff, 0xc5, 0xff, 0xec, 0x0, 0xc5, 0x40,
+    0x1c, 0x6e, 0x1, 0x96, 0x0, 0x3a, 0xc, 0x3,
+    0x3a, 0x80, 0x76, 0x88, 0x6, 0xa3, 0x0, 0xc3,
+    0x40, 0x1d, 0xa2, 0x1, 0x91, 0x80,
 
     /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x6a, 0xde, 0xff, 0xeb, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xff,
-    0xf7, 0x21, 0x26, 0xef, 0xff, 0xff, 0xf0, 0xc,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x40, 0x45, 0x55, 0x55, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x60, 0x0,
-    0x1, 0x6a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xa, 0xff,
-    0xff, 0xff, 0xfe, 0xdd, 0xdd, 0xff, 0xff, 0xff,
-    0x63, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x8f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x6c, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6,
-    0xdf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x6c, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf6, 0xaf, 0xff, 0xff,
-    0xfc, 0x53, 0x36, 0xdf, 0xff, 0xff, 0xff, 0x66,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0x60, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7a, 0xff, 0xff, 0xf6, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0x80, 0xaf, 0xff,
-    0xff, 0x60, 0x0, 0x7, 0xbe, 0xff, 0xd9, 0x20,
-    0xa, 0xff, 0xff, 0xf6,
+    0x0, 0xf3, 0x56, 0xf7, 0xfb, 0xae, 0x8, 0x3,
+    0xf9, 0xfe, 0x54, 0x84, 0x0, 0x28, 0xfb, 0x64,
+    0x1, 0xeb, 0x80, 0xf, 0xf9, 0x34, 0xc0, 0x34,
+    0xa0, 0x7, 0xff, 0xb, 0x4, 0x0, 0x6c, 0x1,
+    0xff, 0xc4, 0xb0, 0x5, 0x0, 0x7a, 0x37, 0xb6,
+    0x44, 0x3, 0x94, 0x0, 0xa0, 0x1d, 0x4e, 0x42,
+    0x4d, 0xa0, 0x1e, 0x40, 0x8a, 0xae, 0x50, 0xe,
+    0x31, 0x0, 0xe1, 0x4, 0x55, 0xe0, 0xf, 0xfe,
+    0x9, 0x80, 0x61, 0x6a, 0xde, 0xff, 0xe1, 0x0,
+    0xfe, 0x8e, 0x95, 0x21, 0x0, 0xff, 0xe1, 0x63,
+    0x80, 0x7f, 0xf1, 0xa8, 0xc0, 0x3c, 0x24, 0x58,
+    0x3, 0xe3, 0x50, 0xe, 0x8f, 0xed, 0xdc, 0x20,
+    0x1e, 0xb0, 0xe, 0x67, 0x0, 0xff, 0xe0, 0xa0,
+    0x7, 0x68, 0x7, 0xff, 0x8, 0x40, 0x38, 0x40,
+    0x3c, 0x22, 0x0, 0xf0, 0x80, 0x74, 0x80, 0x7a,
+    0x80, 0x3e, 0x60, 0xe, 0x3c, 0x53, 0x33, 0x6a,
+    0x0, 0x7d, 0x80, 0x1e, 0x3a, 0xcc, 0x49, 0x0,
+    0x7e, 0x61, 0x0, 0xff, 0xc8, 0x1, 0xf5, 0x0,
+    0x7f, 0xd0, 0x20, 0x1f, 0x25, 0x88, 0x7, 0xe7,
+    0x70, 0x7, 0xf2, 0x74, 0x20, 0x80, 0x9, 0xb6,
+    0x0, 0x3f, 0x0,
 
     /* U+0062 "b" */
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x7, 0xcf,
-    0xfd, 0x93, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x3e, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x3f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x3f, 0xff,
-    0xff, 0xff, 0xfb, 0x9a, 0xef, 0xff, 0xff, 0xff,
-    0x33, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x93, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb3,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x3f,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xa3, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xa, 0xff, 0xff, 0xff, 0x63, 0xff,
-    0xff, 0xff, 0xff, 0xb9, 0xae, 0xff, 0xff, 0xff,
-    0xf3, 0x3f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x3, 0xff, 0xff, 0xfd, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x3f, 0xff,
-    0xff, 0xd1, 0xef, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3, 0xff, 0xff, 0xfd, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0,
-    0x7c, 0xff, 0xda, 0x30, 0x0, 0x0,
+    0x3f, 0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xf6, 0x20, 0x7, 0xcf, 0xf6, 0xc9, 0x80, 0x7f,
+    0xe3, 0xe8, 0x30, 0x1, 0x36, 0x48, 0x7, 0xf8,
+    0x74, 0x40, 0x3e, 0x69, 0x0, 0xfe, 0xb1, 0x0,
+    0xfe, 0x65, 0x0, 0xfc, 0xa0, 0x1f, 0xf4, 0x0,
+    0x7f, 0x91, 0x94, 0x40, 0x3c, 0x46, 0x1, 0xfb,
+    0x2e, 0x6b, 0x94, 0x3, 0xca, 0x1, 0xf3, 0x98,
+    0x6, 0xb1, 0x0, 0xef, 0x0, 0xfa, 0xc0, 0x38,
+    0x54, 0x3, 0x8c, 0x3, 0xe2, 0x0, 0xf0, 0x80,
+    0x7f, 0xf3, 0x84, 0x3, 0xff, 0xfe, 0x1, 0xf8,
+    0x40, 0x3e, 0x20, 0xf, 0x8, 0x7, 0xff, 0x6,
+    0xc0, 0x38, 0x50, 0x3, 0x8c, 0x3, 0xe7, 0x30,
+    0xd, 0x60, 0x1e, 0xf0, 0xf, 0xd9, 0x73, 0x5c,
+    0xa0, 0x1e, 0x50, 0xf, 0x8, 0x1, 0x19, 0x44,
+    0x3, 0xc4, 0x60, 0x1e, 0x36, 0x0, 0xff, 0xa0,
+    0x3, 0xf4, 0x8, 0x7, 0xf3, 0x28, 0x7, 0xe1,
+    0xc1, 0x0, 0xf9, 0xa4, 0x3, 0xfc, 0x5d, 0x6,
+    0x0, 0x25, 0xc9, 0x0, 0x80,
 
     /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x8,
-    0xff, 0xff, 0xff, 0xfc, 0xaa, 0xcf, 0xff, 0xff,
-    0xff, 0x80, 0xd, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x4, 0xef, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xa,
-    0xbb, 0xbb, 0xb1, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0xa, 0xaa, 0xaa, 0xa1,
-    0x1f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf0, 0xd, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xd0, 0x8, 0xff,
-    0xff, 0xff, 0xfc, 0xaa, 0xcf, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xce, 0xff, 0xec, 0x84, 0x0, 0x0, 0x0,
+    0x0, 0xf1, 0xc6, 0x77, 0xfb, 0xb2, 0xc, 0x3,
+    0xfc, 0x79, 0x87, 0x31, 0x0, 0x9, 0xbe, 0x60,
+    0xc0, 0x3e, 0x6c, 0x30, 0xf, 0xf1, 0xe3, 0x0,
+    0x72, 0xc8, 0x7, 0xff, 0xa, 0x54, 0x2, 0x1a,
+    0x0, 0xff, 0xe2, 0x50, 0x80, 0x24, 0x3, 0xe3,
+    0x55, 0x18, 0x7, 0xd2, 0x0, 0x50, 0xf, 0x5e,
+    0x55, 0x32, 0xc4, 0x3, 0x94, 0x4, 0x80, 0x3a,
+    0x10, 0x3, 0x25, 0x80, 0x71, 0x1, 0x0, 0x79,
+    0x0, 0x3c, 0xaa, 0x44, 0xe1, 0x0, 0xf8, 0x80,
+    0x3e, 0xab, 0xbe, 0x10, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x78, 0x80, 0x3e, 0xaa, 0xf0, 0x90, 0x7,
+    0x90, 0x3, 0xca, 0xbf, 0x8, 0x88, 0x3, 0xa1,
+    0x0, 0x31, 0xd8, 0x7, 0x10, 0x1, 0x40, 0x3d,
+    0x79, 0x54, 0xcc, 0x8, 0x7, 0x28, 0x2, 0x44,
+    0x3, 0xc6, 0xaa, 0x30, 0xf, 0xa4, 0x0, 0x36,
+    0x1, 0xff, 0xc4, 0x91, 0x0, 0x96, 0x40, 0x3f,
+    0xf8, 0x50, 0xc0, 0x1c, 0xd8, 0x60, 0x1f, 0xe2,
+    0xc7, 0x0, 0xf8, 0xf3, 0xe, 0x62, 0x0, 0x13,
+    0x7b, 0xd3, 0x0, 0xc0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x60, 0x0, 0x2, 0x8d, 0xff, 0xd8, 0x10,
-    0xd, 0xff, 0xff, 0xf6, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0xcf, 0xff, 0xff, 0x60, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff,
-    0xf6, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x60, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xff,
-    0xff, 0xff, 0xfb, 0x9b, 0xff, 0xff, 0xff, 0xff,
-    0x63, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xf6, 0x6f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6,
-    0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x67, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf6, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x67,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x67, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x7f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x66, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x1d, 0xff, 0xff, 0xff, 0x60, 0xff,
-    0xff, 0xff, 0xff, 0xb9, 0xbf, 0xff, 0xff, 0xff,
-    0xf6, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xca, 0xff, 0xff, 0xf6, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff,
-    0x60, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf4, 0xa,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x28, 0xdf, 0xfd,
-    0x81, 0x0, 0xaf, 0xff, 0xff, 0x60,
+    0x0, 0xff, 0xe1, 0x77, 0xff, 0x30, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xc0, 0x60, 0x1f, 0xe2, 0x8d,
+    0xff, 0x6c, 0x8, 0x7, 0xfe, 0x6d, 0x72, 0x0,
+    0x13, 0xf2, 0x80, 0x80, 0x7e, 0x69, 0x0, 0xfd,
+    0x46, 0x1, 0xf8, 0xa4, 0x3, 0xfd, 0xce, 0x1,
+    0xf5, 0x80, 0x7f, 0xc4, 0x80, 0x1f, 0x30, 0x7,
+    0xc8, 0xc8, 0x1, 0xfc, 0x60, 0x1e, 0x3e, 0xb9,
+    0xbe, 0x20, 0xf, 0x94, 0x3, 0xdc, 0x20, 0x10,
+    0xc8, 0x7, 0xc2, 0x1, 0xc2, 0x40, 0x1c, 0x80,
+    0x1f, 0xfc, 0x13, 0x0, 0xf8, 0x40, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfd, 0xe3, 0x0, 0xf8, 0x40, 0x3c,
+    0x20, 0x1c, 0x26, 0x1, 0xc8, 0x1, 0xf2, 0x80,
+    0x7b, 0xc4, 0x2, 0x19, 0x0, 0xf8, 0xc0, 0x3c,
+    0x7d, 0x73, 0x7c, 0x40, 0x1f, 0x98, 0x3, 0xe4,
+    0x64, 0x0, 0x8, 0x7, 0xd6, 0x1, 0xff, 0x1a,
+    0x0, 0x7c, 0x52, 0x1, 0xfe, 0xf0, 0xf, 0xe6,
+    0x90, 0xf, 0xd6, 0x60, 0x1f, 0xe6, 0xd7, 0x20,
+    0x1, 0x3f, 0x20, 0x7, 0xe0,
 
     /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xdb, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfd, 0xcd,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0xcf, 0xff, 0xff,
-    0xc2, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xf1, 0x1f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x65, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xa7, 0xff,
-    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xde, 0xff, 0xff,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf3, 0xc, 0xff, 0xff,
-    0xff, 0x94, 0x23, 0x7e, 0xff, 0xff, 0xfd, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd,
-    0xa5, 0x0, 0x0, 0x0,
+    0x0, 0xf2, 0xd6, 0xff, 0xdb, 0x6e, 0x20, 0x1f,
+    0xcd, 0xd4, 0xa4, 0x1, 0x12, 0x47, 0x48, 0x7,
+    0xd5, 0x22, 0x1, 0xfe, 0x6d, 0x10, 0xd, 0x2a,
+    0x1, 0xff, 0xc1, 0x2c, 0x0, 0x91, 0x80, 0x3c,
+    0x46, 0x40, 0x1e, 0x29, 0x0, 0x40, 0x7, 0x1e,
+    0xeb, 0x37, 0x94, 0x3, 0x98, 0x44, 0x60, 0x1d,
+    0xa4, 0x1, 0xd, 0x10, 0x7, 0x3a, 0x0, 0x72,
+    0x88, 0x7, 0x94, 0x3, 0xbc, 0x80, 0x38, 0x80,
+    0x3e, 0xd0, 0xe, 0x30, 0xf, 0x36, 0xef, 0xd6,
+    0x1, 0xc2, 0x1, 0xe1, 0x22, 0xf8, 0x40, 0x3f,
+    0xfd, 0x4f, 0xff, 0xff, 0xc1, 0xb0, 0xf, 0xfe,
+    0x79, 0x0, 0x7f, 0xf0, 0x88, 0x3, 0x9c, 0x3,
+    0xff, 0x84, 0x80, 0x1c, 0x4a, 0x1, 0xc3, 0xff,
+    0xe3, 0x13, 0x0, 0xea, 0x94, 0x23, 0x7f, 0x0,
+    0xe2, 0x30, 0x80, 0xf, 0x35, 0xee, 0x40, 0x80,
+    0x74, 0x0, 0x11, 0x80, 0x3f, 0xf8, 0x6a, 0xa0,
+    0xa, 0x54, 0x3, 0xff, 0x82, 0xb4, 0x1, 0xd5,
+    0x22, 0x1, 0xfc, 0x33, 0x40, 0x1f, 0x37, 0x52,
+    0x90, 0x4, 0x4b, 0x5c, 0xc0, 0x18,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xae, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xb9, 0x99,
-    0x99, 0x96, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1c, 0xcc, 0xcc, 0xcf, 0xff, 0xff, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xc8, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x9a, 0xbb, 0xff, 0xeb, 0x0, 0xfe,
+    0x3e, 0x95, 0x10, 0xf, 0xfe, 0x22, 0x60, 0x80,
+    0x7f, 0xf1, 0x86, 0x80, 0x3f, 0xf9, 0xc, 0x20,
+    0x1f, 0xfc, 0x8b, 0x0, 0xf2, 0x33, 0x7b, 0x40,
+    0x3e, 0x30, 0xe, 0x6b, 0x99, 0xf3, 0x0, 0x7f,
+    0xf0, 0x74, 0x3, 0xff, 0xfc, 0x5f, 0xfe, 0x0,
+    0xf5, 0xff, 0xfd, 0x60, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0x9, 0x9f, 0xc0, 0x1e, 0x23, 0x3f, 0xc3,
+    0x99, 0xe0, 0xf, 0x4e, 0x67, 0xd0, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfe, 0x20,
 
     /* U+0067 "g" */
-    0x0, 0x0, 0x18, 0xce, 0xfe, 0xa3, 0x0, 0xaf,
-    0xff, 0xff, 0x60, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xf7, 0xa, 0xff, 0xff, 0xf6, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xaf, 0xff, 0xff, 0x60,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xf6, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0xef, 0xff, 0xff,
-    0xff, 0xa9, 0xbf, 0xff, 0xff, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0x65, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf6, 0x6f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x67, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x67, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x67, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x6f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x65, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0x60, 0xef, 0xff, 0xff, 0xff, 0xb9,
-    0xbf, 0xff, 0xff, 0xff, 0xf6, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff,
-    0xff, 0xf6, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xf6, 0xb, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x18, 0xce, 0xfe, 0xa3, 0x0, 0xbf, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x22, 0x22, 0x22, 0x24, 0x9f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xfe, 0xb7, 0x20, 0x0, 0x0,
+    0x0, 0xc3, 0x19, 0xdf, 0xd4, 0x60, 0xa, 0xff,
+    0xe6, 0x0, 0x97, 0xdc, 0xc4, 0x5, 0x71, 0xc0,
+    0x3f, 0xcb, 0x42, 0x1, 0xf4, 0x38, 0x7, 0xe1,
+    0xb0, 0xf, 0xf4, 0x30, 0x7, 0xd2, 0x20, 0x1f,
+    0xf1, 0x80, 0x7c, 0xc0, 0x1f, 0x2b, 0x20, 0x7,
+    0xf1, 0x8, 0x7, 0x17, 0x54, 0xde, 0x88, 0x7,
+    0xce, 0x1, 0xee, 0x10, 0x8, 0xac, 0x3, 0xe3,
+    0x0, 0xf1, 0x80, 0x72, 0x80, 0x7c, 0x20, 0x1c,
+    0x40, 0x1f, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0x86, 0x20, 0x1c, 0x40, 0x1f, 0x8, 0x7, 0x8c,
+    0x3, 0xc8, 0x1, 0xca, 0x1, 0xf3, 0x80, 0x7a,
+    0x44, 0x2, 0x2b, 0x0, 0xf8, 0x84, 0x3, 0x8b,
+    0xae, 0x6f, 0x44, 0x3, 0xf3, 0x0, 0x7c, 0x8c,
+    0x80, 0x1f, 0xe9, 0x0, 0xff, 0x84, 0xc0, 0x3e,
+    0x1a, 0x0, 0xff, 0x43, 0x80, 0x7e, 0x5a, 0x0,
+    0xfd, 0x2c, 0x1, 0xfe, 0x5e, 0x73, 0x10, 0x15,
+    0xc6, 0x0, 0xff, 0xc3, 0x19, 0xdf, 0xd4, 0x60,
+    0x7, 0x0, 0xff, 0xe4, 0x10, 0x7, 0x18, 0x7,
+    0xff, 0x5, 0x84, 0x3, 0x98, 0x3, 0x11, 0x7c,
+    0x93, 0x20, 0xe, 0x13, 0x0, 0xd9, 0xbb, 0xeb,
+    0x60, 0xf, 0x30, 0x7, 0xff, 0x1c, 0xa0, 0x3,
+    0xff, 0x8c, 0x3e, 0x1, 0xff, 0xc6, 0x5f, 0x20,
+    0xf, 0xfe, 0x10, 0xa4, 0x6d, 0x8, 0x4,
 
     /* U+0068 "h" */
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x10, 0x18, 0xdf,
-    0xfd, 0x92, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x4e, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x3f, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f, 0xff,
-    0xff, 0xff, 0xfb, 0x9a, 0xff, 0xff, 0xff, 0xff,
-    0x13, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf7,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x80,
+    0x3f, 0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfa, 0x31, 0xbf, 0xed, 0x92, 0x0, 0xff, 0x85,
+    0x3d, 0xc8, 0x0, 0x4d, 0xae, 0x1, 0xfe, 0x2b,
+    0x10, 0xf, 0xa2, 0x0, 0x1f, 0x86, 0x40, 0x3f,
+    0xce, 0x60, 0x1f, 0xa, 0x0, 0x7f, 0xd0, 0x1,
+    0xfe, 0x46, 0x50, 0xf, 0x90, 0x40, 0x3f, 0x65,
+    0xcd, 0x71, 0x80, 0x79, 0x40, 0x3e, 0x83, 0x0,
+    0x87, 0xc0, 0x3c, 0x40, 0x1f, 0x20, 0x7, 0x18,
+    0x80, 0x70, 0x80, 0x7c, 0x40, 0x1e, 0x20, 0xe,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xf9,
 
     /* U+0069 "i" */
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xdf, 0xd7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8a,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x2, 0xcc, 0xcc,
-    0xcc, 0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xc, 0xcc, 0xcc, 0xcc,
-    0xdf, 0xff, 0xff, 0xfc, 0xcc, 0xcc, 0xc6, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0xfe, 0x8d, 0xfd, 0x70, 0xf, 0xfe, 0x26,
+    0x39, 0x1, 0x45, 0x0, 0x7f, 0xf0, 0x8c, 0xc0,
+    0x1c, 0xa2, 0x1, 0xff, 0xc1, 0x60, 0xf, 0x88,
+    0x3, 0xff, 0x82, 0xe0, 0x1f, 0x18, 0x7, 0xff,
+    0x4, 0x9c, 0x3, 0xa4, 0x3, 0xff, 0x87, 0x18,
+    0xea, 0xfa, 0xc0, 0x1f, 0xfc, 0x43, 0x8a, 0x82,
+    0x0, 0xff, 0xf4, 0x9f, 0xff, 0xfe, 0xe0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0x24, 0x4c, 0xfc, 0x40,
+    0x1f, 0xfc, 0x22, 0xcc, 0xf5, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0x9e, 0x67, 0xd6, 0x1, 0xc3, 0x99, 0xe6,
+    0x13, 0x3f, 0x88, 0x3, 0xc6, 0x7e, 0xe0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0x4,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xa8,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9e,
-    0xfd, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0x50, 0xa, 0xcc,
-    0xcc, 0xcc, 0xdf, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xec, 0x83, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc9, 0x15, 0x4, 0x1, 0xff, 0xc1,
+    0x9b, 0x75, 0x7d, 0x50, 0xf, 0xf8, 0xd8, 0x3,
+    0xac, 0x3, 0xfe, 0x50, 0xf, 0x9, 0x0, 0x7f,
+    0x88, 0x3, 0xe2, 0x0, 0xff, 0x21, 0x0, 0x73,
+    0x0, 0x7f, 0xec, 0x61, 0x2, 0x89, 0x0, 0xff,
+    0xc3, 0x3d, 0xfa, 0xe0, 0x1f, 0xfd, 0xc1, 0xff,
+    0xff, 0xe2, 0x58, 0x7, 0xff, 0xfc, 0x0, 0x26,
+    0x7f, 0xe1, 0x0, 0xfd, 0x99, 0xfe, 0x70, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xe5, 0x28, 0x7,
+    0x8, 0x7, 0xfc, 0x66, 0x0, 0xe2, 0x0, 0xff,
+    0x1f, 0x0, 0x7b, 0x40, 0x15, 0x99, 0xed, 0xc2,
+    0x0, 0xf2, 0x0, 0x1c, 0xcf, 0xc4, 0x1, 0xf3,
+    0x88, 0x7, 0xff, 0x10, 0xa4, 0x3, 0xff, 0x88,
+    0x3e, 0x20, 0x1f, 0xfc, 0x34, 0xf2, 0x0, 0xff,
+    0xc2, 0x6f, 0x96, 0x20, 0x18,
 
     /* U+006B "k" */
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf7, 0x0,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x60, 0x0, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xd0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xe, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x66, 0x9f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf4, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x40, 0x0, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf6, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x10,
+    0xf, 0xff, 0x20, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xc6, 0xef, 0xfe, 0xe0, 0xf,
+    0xfe, 0x1b, 0x88, 0x7, 0x48, 0x7, 0xff, 0xe,
+    0x40, 0x38, 0x5c, 0x3, 0xff, 0x84, 0xe2, 0x1,
+    0xd0, 0x1, 0xff, 0xc3, 0x90, 0xe, 0x26, 0x0,
+    0xff, 0xe1, 0x38, 0x80, 0x74, 0x0, 0x7f, 0xf0,
+    0xe4, 0x3, 0x8d, 0x40, 0x3f, 0xf8, 0x4e, 0x20,
+    0x1d, 0x0, 0x1f, 0xfc, 0x39, 0x0, 0xe3, 0x40,
+    0xf, 0xfb, 0x19, 0x92, 0x20, 0x1d, 0xe0, 0x1f,
+    0xf9, 0xe6, 0x4c, 0x1, 0xc8, 0x60, 0x1f, 0xfc,
+    0x98, 0x0, 0xff, 0xe5, 0x18, 0x7, 0xff, 0x2a,
+    0x0, 0x3f, 0xf9, 0x4e, 0x20, 0x1f, 0xfa, 0xff,
+    0xd6, 0x1, 0xeb, 0x0, 0xff, 0xe1, 0xa1, 0x80,
+    0x72, 0x98, 0x7, 0xff, 0xf, 0xc0, 0x3d, 0x0,
+    0x1f, 0xfc, 0x33, 0x50, 0xe, 0x44, 0x0, 0x7f,
+    0xf0, 0xe0, 0x3, 0xd2, 0x1, 0xff, 0xc3, 0x26,
+    0x0, 0xe2, 0x60, 0xf, 0xfe, 0x1c, 0x0, 0x7a,
+    0x0, 0x3f, 0xf8, 0x62, 0xe0, 0x1c, 0x30, 0x1,
+    0xff, 0xc3, 0x81, 0x0, 0xe7, 0x10,
 
     /* U+006C "l" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xcc, 0xcc, 0xcc, 0xef, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xec,
-    0xcc, 0xcc, 0xc9, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xef, 0xff, 0xff, 0xff, 0xb0,
+    0xff, 0xff, 0xe0, 0xd8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0x9c, 0x67, 0xf0, 0x80, 0x7f, 0xf0, 0xf3,
+    0x3e, 0x70, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xf0, 0xc4, 0x3, 0x94, 0x3,
+    0xff, 0x89, 0xc0, 0x1c, 0x30, 0x1, 0xff, 0xc3,
+    0x50, 0xf, 0x3f, 0x66, 0x7a, 0x40, 0x3e, 0x32,
+    0x0, 0xf0, 0x99, 0xf8, 0x80, 0x3f, 0x48, 0x7,
+    0xff, 0x29, 0x20, 0x3, 0xff, 0x94, 0xf4, 0x1,
+    0xff, 0xca, 0x5e, 0x83, 0x10, 0xf, 0xc0,
 
     /* U+006D "m" */
-    0x6f, 0xff, 0xfc, 0x4, 0xcf, 0xe8, 0x0, 0x5,
-    0xcf, 0xe9, 0x10, 0x6, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xfa, 0x4, 0xff, 0xff, 0xfe, 0x10, 0x6f,
-    0xff, 0xfc, 0xcf, 0xff, 0xff, 0xf4, 0xef, 0xff,
-    0xff, 0xfb, 0x6, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xf3, 0x6f, 0xff,
-    0xff, 0xfb, 0xef, 0xff, 0xff, 0xfb, 0xef, 0xff,
-    0xff, 0x76, 0xff, 0xff, 0xf4, 0x2, 0xff, 0xff,
-    0xf5, 0x1, 0xff, 0xff, 0xf9, 0x6f, 0xff, 0xff,
-    0x0, 0xe, 0xff, 0xff, 0x10, 0xd, 0xff, 0xff,
-    0x96, 0xff, 0xff, 0xf0, 0x0, 0xef, 0xff, 0xf1,
-    0x0, 0xdf, 0xff, 0xf9, 0x6f, 0xff, 0xff, 0x0,
-    0xe, 0xff, 0xff, 0x10, 0xd, 0xff, 0xff, 0x96,
-    0xff, 0xff, 0xf0, 0x0, 0xef, 0xff, 0xf1, 0x0,
-    0xdf, 0xff, 0xf9, 0x6f, 0xff, 0xff, 0x0, 0xe,
-    0xff, 0xff, 0x10, 0xd, 0xff, 0xff, 0x96, 0xff,
-    0xff, 0xf0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0xdf,
-    0xff, 0xf9, 0x6f, 0xff, 0xff, 0x0, 0xe, 0xff,
-    0xff, 0x10, 0xd, 0xff, 0xff, 0x96, 0xff, 0xff,
-    0xf0, 0x0, 0xef, 0xff, 0xf1, 0x0, 0xdf, 0xff,
-    0xf9, 0x6f, 0xff, 0xff, 0x0, 0xe, 0xff, 0xff,
-    0x10, 0xd, 0xff, 0xff, 0x96, 0xff, 0xff, 0xf0,
-    0x0, 0xef, 0xff, 0xf1, 0x0, 0xdf, 0xff, 0xf9,
-    0x6f, 0xff, 0xff, 0x0, 0xe, 0xff, 0xff, 0x10,
-    0xd, 0xff, 0xff, 0x96, 0xff, 0xff, 0xf0, 0x0,
-    0xef, 0xff, 0xf1, 0x0, 0xdf, 0xff, 0xf9, 0x6f,
-    0xff, 0xff, 0x0, 0xe, 0xff, 0xff, 0x10, 0xd,
-    0xff, 0xff, 0x96, 0xff, 0xff, 0xf0, 0x0, 0xef,
-    0xff, 0xf1, 0x0, 0xdf, 0xff, 0xf9, 0x6f, 0xff,
-    0xff, 0x0, 0xe, 0xff, 0xff, 0x10, 0xd, 0xff,
-    0xff, 0x96, 0xff, 0xff, 0xf0, 0x0, 0xef, 0xff,
-    0xf1, 0x0, 0xdf, 0xff, 0xf9, 0x6f, 0xff, 0xff,
-    0x0, 0xe, 0xff, 0xff, 0x10, 0xd, 0xff, 0xff,
-    0x96, 0xff, 0xff, 0xf0, 0x0, 0xef, 0xff, 0xf1,
-    0x0, 0xdf, 0xff, 0xf9,
+    0x6f, 0xfd, 0x80, 0x99, 0xfd, 0x0, 0x12, 0xe7,
+    0xf4, 0x88, 0x7, 0xe3, 0xb3, 0x1, 0x7a, 0x4,
+    0xa3, 0x1, 0x6f, 0x10, 0xf, 0xbc, 0x3, 0x95,
+    0x28, 0x3, 0x86, 0x80, 0x3c, 0x26, 0x1, 0xe8,
+    0x10, 0xf, 0x21, 0x80, 0x71, 0x2, 0x8, 0x6,
+    0x30, 0x41, 0x0, 0xe4, 0x0, 0xf5, 0xdb, 0x0,
+    0x3a, 0xaf, 0xc0, 0x3b, 0x80, 0x3c, 0x80, 0x42,
+    0x1, 0x90, 0x4, 0x80, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xc9,
 
     /* U+006E "n" */
-    0x3f, 0xff, 0xff, 0xd0, 0x1, 0x8d, 0xff, 0xd9,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xfd, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x3f, 0xff, 0xff,
-    0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xb9, 0xaf, 0xff, 0xff, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0x43, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x73, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf8,
+    0x3f, 0xfe, 0xd0, 0x0, 0xc6, 0xff, 0xb6, 0x48,
+    0x3, 0xff, 0x27, 0x39, 0x0, 0x9, 0xb5, 0xc0,
+    0x3f, 0xc7, 0x60, 0x1f, 0xa2, 0x0, 0x1f, 0xd0,
+    0x1, 0xfe, 0x73, 0x0, 0xf8, 0x90, 0x3, 0xfe,
+    0x80, 0xf, 0xf2, 0x32, 0x80, 0x7c, 0x82, 0x1,
+    0xfb, 0x2e, 0x6b, 0x8c, 0x3, 0xca, 0x1, 0xf4,
+    0x18, 0x4, 0x3e, 0x1, 0xe2, 0x0, 0xf9, 0x0,
+    0x38, 0xc4, 0x3, 0x84, 0x3, 0xe2, 0x0, 0xf1,
+    0x0, 0x77, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xc8,
 
     /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xdb, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xb9, 0xbe, 0xff, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0x45, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xa7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0x5f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xf5, 0xc, 0xff, 0xff,
-    0xff, 0xfb, 0x9b, 0xef, 0xff, 0xff, 0xfe, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd,
-    0xb6, 0x10, 0x0, 0x0,
+    0x0, 0xf2, 0xd6, 0xff, 0xdb, 0x6c, 0x20, 0x1f,
+    0xcd, 0xd4, 0xa4, 0x1, 0x12, 0x4f, 0x40, 0x7,
+    0xd5, 0x22, 0x1, 0xfe, 0x7c, 0x10, 0xd, 0x2a,
+    0x1, 0xff, 0xc1, 0x3d, 0x0, 0x91, 0x80, 0x3f,
+    0xf8, 0x66, 0xe0, 0x8, 0x0, 0xf9, 0x19, 0x4,
+    0x3, 0xd2, 0x2, 0x60, 0x1c, 0x5b, 0x73, 0x7e,
+    0x80, 0x1c, 0x28, 0x80, 0xf, 0x71, 0x0, 0x43,
+    0x40, 0x1e, 0xc2, 0x0, 0xe1, 0x30, 0xe, 0x14,
+    0x0, 0xe2, 0x0, 0xf1, 0x80, 0x7c, 0x20, 0x1f,
+    0xfc, 0xe1, 0x0, 0xff, 0xff, 0x80, 0x7e, 0x10,
+    0xf, 0x18, 0x7, 0xc2, 0x1, 0xe2, 0x0, 0xe1,
+    0x30, 0xe, 0x14, 0x0, 0xe2, 0x40, 0xf, 0x71,
+    0x0, 0x43, 0x40, 0x1e, 0xd1, 0x30, 0xe, 0x2d,
+    0xb9, 0xbf, 0x40, 0xe, 0x15, 0x8, 0x0, 0xf9,
+    0x19, 0x4, 0x3, 0xd2, 0x0, 0x46, 0x0, 0xff,
+    0xe1, 0x9b, 0x80, 0x52, 0xa0, 0x1f, 0xfc, 0x13,
+    0xd0, 0xe, 0xa9, 0x10, 0xf, 0xf3, 0xe0, 0x80,
+    0x79, 0xba, 0x94, 0x80, 0x22, 0x49, 0xe8, 0x0,
+    0xc0,
 
     /* U+0070 "p" */
-    0x3f, 0xff, 0xff, 0xd0, 0x0, 0x7c, 0xff, 0xd9,
-    0x30, 0x0, 0x3, 0xff, 0xff, 0xfd, 0x1, 0xdf,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x3f, 0xff, 0xff,
-    0xd1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3,
-    0xff, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x3f, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xb9, 0xae, 0xff, 0xff, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x63, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xa3, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfa, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa3, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff,
-    0xff, 0xfb, 0x9a, 0xef, 0xff, 0xff, 0xff, 0x13,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x3, 0xff, 0xff, 0xff,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x1d, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x7, 0xcf,
-    0xfe, 0xa3, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0xd0, 0x9, 0xf3, 0xfd, 0xb2, 0x60,
+    0x1f, 0xf8, 0x76, 0xc, 0x0, 0x4d, 0x8e, 0x1,
+    0xfe, 0x1c, 0x20, 0xf, 0xa2, 0x0, 0x1f, 0xd0,
+    0x40, 0x1f, 0xce, 0x60, 0x1f, 0x1b, 0x0, 0x7f,
+    0xde, 0x1, 0xf0, 0x80, 0x11, 0x94, 0x40, 0x3c,
+    0x62, 0x1, 0xfb, 0x2e, 0x6b, 0x94, 0x3, 0xce,
+    0x1, 0xf3, 0x98, 0x6, 0xb1, 0x0, 0xee, 0x0,
+    0xfa, 0xc0, 0x38, 0x54, 0x3, 0x88, 0x3, 0xe2,
+    0x0, 0xf0, 0x80, 0x7f, 0xf3, 0x84, 0x3, 0xff,
+    0xfe, 0x1, 0xf8, 0x40, 0x3e, 0x20, 0xf, 0x8,
+    0x7, 0xff, 0x6, 0xc0, 0x38, 0x50, 0x3, 0x88,
+    0x3, 0xe7, 0x30, 0xd, 0x60, 0x1e, 0xe0, 0xf,
+    0xd9, 0x73, 0x5c, 0xa0, 0x1e, 0x70, 0xf, 0xe4,
+    0x65, 0x10, 0xf, 0x18, 0x80, 0x7c, 0xe0, 0x1f,
+    0xf7, 0x80, 0x7e, 0x92, 0x0, 0xfe, 0x73, 0x0,
+    0xfc, 0x38, 0x40, 0x1f, 0x44, 0x0, 0x3f, 0xc3,
+    0xb0, 0x60, 0x1, 0x5c, 0x70, 0xf, 0xfe, 0xb,
+    0xe7, 0xfb, 0xa8, 0xc0, 0x3f, 0xe1, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xfd, 0x0,
 
     /* U+0071 "q" */
-    0x0, 0x0, 0x28, 0xdf, 0xfd, 0x81, 0x0, 0xaf,
-    0xff, 0xff, 0x60, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xf5, 0xa, 0xff, 0xff, 0xf6, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0x60,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff,
-    0xff, 0xf6, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff,
-    0xff, 0xb9, 0xbf, 0xff, 0xff, 0xff, 0xf6, 0x3f,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0x66, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf6, 0x7f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x67, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf6, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x67, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x67, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x67, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6,
-    0x6f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xf6, 0xf, 0xff, 0xff,
-    0xff, 0xfb, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xf6, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xbf, 0xff, 0xff, 0x60, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf6, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x30, 0xcf, 0xff,
-    0xff, 0x60, 0x0, 0x2, 0x8d, 0xff, 0xd8, 0x10,
-    0xd, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf6,
+    0x0, 0xc5, 0x1b, 0xfe, 0xd8, 0x10, 0x5, 0x7f,
+    0xf3, 0x0, 0x4d, 0xae, 0x40, 0x2, 0x7e, 0x50,
+    0xf, 0xf3, 0x48, 0x7, 0xea, 0x30, 0xf, 0xc5,
+    0x20, 0x1f, 0xee, 0x0, 0xfd, 0x60, 0x1f, 0xf1,
+    0x20, 0x7, 0xcc, 0x1, 0xf2, 0x32, 0x0, 0x4,
+    0x3, 0xc6, 0x1, 0xe3, 0xeb, 0x9b, 0xe2, 0x0,
+    0xf9, 0x40, 0x3d, 0xc2, 0x1, 0xc, 0x80, 0x7c,
+    0x20, 0x1c, 0x24, 0x1, 0xc8, 0x1, 0xff, 0xc1,
+    0x30, 0xf, 0x84, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xde, 0x30, 0xf, 0x84, 0x3, 0xc2, 0x1, 0xc2,
+    0x60, 0x1c, 0x80, 0x1f, 0x28, 0x7, 0xbc, 0x40,
+    0x21, 0x90, 0xf, 0x8c, 0x3, 0xc7, 0xd7, 0x37,
+    0xc4, 0x1, 0xf9, 0x80, 0x3e, 0x46, 0x40, 0x0,
+    0x80, 0x7d, 0x60, 0x1f, 0xf1, 0xa8, 0x7, 0xc5,
+    0x20, 0x1f, 0xef, 0x0, 0xfe, 0x69, 0x0, 0xfd,
+    0x86, 0xe0, 0x1f, 0xcd, 0xae, 0x40, 0x2, 0x7e,
+    0x30, 0x10, 0xf, 0xf1, 0x46, 0xff, 0xb6, 0x4,
+    0x3, 0xff, 0xc0, 0x60, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0xc0,
 
     /* U+0072 "r" */
-    0x6f, 0xff, 0xff, 0xb0, 0x1, 0x8d, 0xff, 0xda,
-    0x40, 0x0, 0x6, 0xff, 0xff, 0xfb, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x6f, 0xff, 0xff,
-    0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x6,
-    0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x6f, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xb9, 0xae, 0xff, 0xff, 0xff, 0xf2, 0x6f,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x66, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf8, 0x6f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x96, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf9, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x96, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x4, 0x55, 0x55, 0x53, 0x6f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfe, 0xb0, 0x0, 0xc6, 0xff, 0xb6, 0x90,
+    0x3, 0xff, 0x2f, 0x39, 0x0, 0x9, 0x6e, 0x80,
+    0x3f, 0xc9, 0x40, 0x1f, 0x96, 0x80, 0x3f, 0xa4,
+    0x3, 0xfc, 0xaa, 0x0, 0xf9, 0x48, 0x3, 0xfe,
+    0x90, 0xf, 0x84, 0x0, 0x8c, 0xa2, 0x1, 0xe3,
+    0x20, 0xf, 0x87, 0x2e, 0x6b, 0x8c, 0x3, 0xc8,
+    0x1, 0xf4, 0x98, 0x6, 0xe0, 0xf, 0x70, 0x7,
+    0xcc, 0x1, 0xc4, 0x40, 0xe, 0x10, 0xf, 0x84,
+    0x3, 0xcc, 0x1, 0xff, 0x84, 0x3, 0xff, 0xa1,
+    0xf5, 0x5e, 0x0, 0xff, 0xe1, 0x22, 0xaf, 0x18,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xf0,
 
     /* U+0073 "s" */
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xff, 0xed, 0xa6,
-    0x10, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xec, 0xcd, 0xef, 0xff, 0xff, 0xff, 0x20, 0x7f,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x8e, 0xee, 0xee, 0x80, 0x9f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfb, 0x74, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0xa7, 0x20, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x2, 0x46, 0x79,
-    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf0,
-    0x33, 0x33, 0x33, 0x10, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x3, 0xcf, 0xff, 0xff,
-    0xe0, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xef, 0xff, 0xfe, 0xb8, 0x30, 0x0, 0x0,
+    0x0, 0xc7, 0x19, 0xdf, 0xfb, 0xb6, 0x98, 0x40,
+    0x3e, 0x2c, 0xc3, 0x98, 0x80, 0x61, 0x25, 0x9e,
+    0x70, 0xe, 0x2c, 0x30, 0xf, 0xfe, 0xc, 0x58,
+    0x6, 0xe1, 0x0, 0xff, 0xe1, 0xa5, 0x0, 0xc,
+    0xc0, 0x1e, 0x13, 0x31, 0x8, 0x7, 0x94, 0x81,
+    0x0, 0x38, 0x73, 0xb3, 0x1b, 0xd4, 0x1, 0xe5,
+    0xe, 0x0, 0xe9, 0x30, 0xe, 0x57, 0x11, 0xef,
+    0x0, 0xfb, 0x80, 0x3e, 0x8e, 0xee, 0x80, 0xe0,
+    0xe, 0x6b, 0x74, 0x20, 0xf, 0xf9, 0x0, 0x3c,
+    0x91, 0x7b, 0xfd, 0x94, 0xe4, 0x1, 0xc6, 0x60,
+    0xf, 0xf0, 0x9a, 0xc6, 0xd9, 0x0, 0x6e, 0x0,
+    0xff, 0xe1, 0xa6, 0x18, 0x4, 0x58, 0x20, 0x1f,
+    0xfc, 0x21, 0xd0, 0xc, 0x7d, 0x6, 0x1, 0xff,
+    0xc1, 0x17, 0x0, 0xe7, 0xcf, 0xdb, 0x98, 0x63,
+    0x0, 0xfa, 0xc0, 0x3f, 0x12, 0x33, 0xce, 0x7b,
+    0x80, 0x71, 0x81, 0x9f, 0x84, 0x3, 0xe8, 0x0,
+    0xf0, 0xf6, 0x67, 0x30, 0x7, 0xc2, 0x1, 0xe1,
+    0x70, 0xe, 0x85, 0x0, 0xe3, 0xd0, 0xe, 0x10,
+    0xf0, 0xf, 0x57, 0xf7, 0x5f, 0x86, 0x1, 0xce,
+    0xa, 0x80, 0x1f, 0x8, 0xc0, 0x1f, 0xac, 0x1,
+    0x68, 0x1, 0xff, 0xc4, 0xa2, 0x0, 0xae, 0x4,
+    0x3, 0xff, 0x16, 0x28, 0x7, 0x3f, 0x52, 0x90,
+    0x80, 0x61, 0x47, 0xcd, 0x30, 0x8,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xac, 0xcc, 0xcc, 0xef, 0xff, 0xff, 0xec,
-    0xcc, 0xcc, 0xcc, 0xc8, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xcc,
-    0xcc, 0xcc, 0xc5, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xff, 0xff,
-    0xff, 0xf7,
+    0x0, 0xf5, 0x7f, 0xf5, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfc, 0x1b, 0xff, 0xca, 0x1, 0xcb, 0xff,
+    0xfa, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0x17,
+    0x33, 0xe1, 0x0, 0xe1, 0x33, 0xfe, 0xac, 0xce,
+    0x40, 0xe, 0x4c, 0xcf, 0xd0, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xfc, 0x4, 0x3,
+    0xff, 0x86, 0x40, 0x1c, 0x84, 0x1, 0xff, 0xc2,
+    0xd0, 0xf, 0x6e, 0x67, 0xca, 0x1, 0xe4, 0x0,
+    0xf8, 0xcf, 0xe2, 0x0, 0xf0, 0xa8, 0x7, 0xff,
+    0x26, 0xc4, 0x3, 0xff, 0x90, 0x3e, 0x60, 0x1f,
+    0xfc, 0x81, 0xca, 0x51, 0x0, 0xfe,
 
     /* U+0075 "u" */
-    0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf8, 0x5f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x85,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf8, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x5f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x85, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf8, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x85, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf8, 0x5f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x85, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x50, 0xef, 0xff, 0xff, 0xe2, 0x0,
-    0x1, 0xdf, 0xff, 0xff, 0xf1, 0x9, 0xff, 0xff,
-    0xff, 0xfb, 0x9a, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9d, 0xef, 0xfd,
-    0xa6, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0x0, 0x7d, 0x9f, 0xfd, 0x0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xc8, 0x20, 0x1f, 0xfc, 0x87, 0x0,
+    0xf0, 0x80, 0x78, 0xc0, 0x3b, 0x84, 0x3, 0xc8,
+    0x1, 0xc6, 0x1, 0xe3, 0x21, 0x0, 0xeb, 0x20,
+    0x8, 0x78, 0x3, 0xc8, 0xe, 0x1, 0xc3, 0xb7,
+    0x35, 0xc4, 0x1, 0xc6, 0x21, 0x60, 0x1f, 0x23,
+    0x28, 0x7, 0xd0, 0x0, 0x28, 0x0, 0xff, 0xe1,
+    0xaa, 0x0, 0x4e, 0xc0, 0x1f, 0xfc, 0x14, 0xa0,
+    0xe, 0x9a, 0x10, 0xf, 0xf4, 0x58, 0x7, 0xcb,
+    0xd4, 0xc4, 0x20, 0x2, 0x59, 0xf7, 0x0, 0xc0,
 
     /* U+0076 "v" */
-    0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xb0,
-    0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x60, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x10,
-    0x8, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf5, 0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfa, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfe, 0x0, 0xc, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xd0, 0x9f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xfe, 0xa0, 0xf, 0xe8, 0xff, 0xf0, 0x28,
+    0x7, 0x28, 0x7, 0xf2, 0x80, 0x72, 0x5, 0x80,
+    0x79, 0x0, 0x3e, 0x22, 0x0, 0x76, 0x81, 0x90,
+    0x7, 0x60, 0x7, 0xc8, 0x1, 0xe7, 0x0, 0x28,
+    0x7, 0x28, 0x7, 0xda, 0x1, 0xc6, 0x20, 0xb,
+    0x0, 0xe2, 0x20, 0x7, 0x90, 0x3, 0xac, 0x2,
+    0x31, 0x0, 0xe5, 0x0, 0xe4, 0x0, 0xf2, 0x80,
+    0x67, 0x0, 0xeb, 0x0, 0xed, 0x0, 0xe3, 0x20,
+    0xd, 0xa0, 0x1c, 0x62, 0x1, 0x9c, 0x3, 0xac,
+    0x3, 0x90, 0x40, 0x39, 0x0, 0x22, 0x10, 0xe,
+    0x50, 0xf, 0x20, 0x7, 0x78, 0x4, 0xa0, 0x1c,
+    0x44, 0x0, 0xf7, 0x0, 0x72, 0x0, 0x56, 0x1,
+    0xca, 0x1, 0xf2, 0x0, 0x70, 0xa0, 0x0, 0xc0,
+    0x3a, 0xc0, 0x3f, 0x28, 0x7, 0x60, 0x28, 0x7,
+    0x9, 0x80, 0x7e, 0xf0, 0xe, 0x50, 0xc0, 0xe,
+    0x70, 0xf, 0xe5, 0x0, 0xe2, 0x14, 0x0, 0xed,
+    0x0, 0xff, 0x20, 0x7, 0x21, 0x0, 0x72, 0x0,
+    0x7f, 0xb4, 0x3, 0xb8, 0x3, 0x94, 0x3, 0xfe,
+    0x70, 0xe, 0x40, 0xe, 0xf0, 0xf, 0xf8, 0x4c,
+    0x3, 0xfc, 0xa0, 0x1f, 0xfa, 0x80, 0x3f, 0x90,
+    0x3, 0xff, 0x82, 0xe0, 0x1f, 0xda, 0x1, 0xff,
+    0xc1, 0x13, 0x0, 0xfc, 0xe0, 0x1f, 0xfc, 0x2b,
+    0x0, 0xf8, 0xc4, 0x3, 0xe0,
 
     /* U+0077 "w" */
-    0xbf, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff, 0xf1,
-    0x0, 0x0, 0xcf, 0xff, 0xe9, 0xff, 0xff, 0x40,
-    0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff,
-    0xfc, 0x6f, 0xff, 0xf6, 0x0, 0x2, 0xff, 0xff,
-    0xf7, 0x0, 0x1, 0xff, 0xff, 0x94, 0xff, 0xff,
-    0x80, 0x0, 0x5f, 0xff, 0xff, 0x90, 0x0, 0x3f,
-    0xff, 0xf7, 0x2f, 0xff, 0xfa, 0x0, 0x8, 0xff,
-    0xff, 0xfc, 0x0, 0x6, 0xff, 0xff, 0x50, 0xff,
-    0xff, 0xd0, 0x0, 0xbf, 0xfd, 0xff, 0xf0, 0x0,
-    0x8f, 0xff, 0xf2, 0xd, 0xff, 0xff, 0x0, 0xe,
-    0xff, 0xaf, 0xff, 0x10, 0xa, 0xff, 0xff, 0x0,
-    0xbf, 0xff, 0xf1, 0x0, 0xff, 0xf7, 0xff, 0xf4,
-    0x0, 0xdf, 0xff, 0xe0, 0x8, 0xff, 0xff, 0x30,
-    0x3f, 0xff, 0x3f, 0xff, 0x70, 0xf, 0xff, 0xfb,
-    0x0, 0x6f, 0xff, 0xf5, 0x6, 0xff, 0xf1, 0xdf,
-    0xf9, 0x1, 0xff, 0xff, 0x90, 0x4, 0xff, 0xff,
-    0x80, 0x9f, 0xff, 0xb, 0xff, 0xc0, 0x4f, 0xff,
-    0xf7, 0x0, 0x1f, 0xff, 0xfa, 0xc, 0xff, 0xd0,
-    0x9f, 0xff, 0x6, 0xff, 0xff, 0x40, 0x0, 0xff,
-    0xff, 0xc0, 0xef, 0xfa, 0x7, 0xff, 0xf1, 0x8f,
-    0xff, 0xf2, 0x0, 0xd, 0xff, 0xfe, 0x1f, 0xff,
-    0x80, 0x5f, 0xff, 0x4a, 0xff, 0xff, 0x0, 0x0,
-    0xaf, 0xff, 0xf3, 0xff, 0xf6, 0x2, 0xff, 0xf6,
-    0xcf, 0xff, 0xd0, 0x0, 0x8, 0xff, 0xff, 0x6f,
-    0xff, 0x30, 0xf, 0xff, 0x8d, 0xff, 0xfb, 0x0,
-    0x0, 0x6f, 0xff, 0xf9, 0xff, 0xf1, 0x0, 0xef,
-    0xfa, 0xff, 0xff, 0x90, 0x0, 0x3, 0xff, 0xff,
-    0xcf, 0xff, 0x0, 0xc, 0xff, 0xbf, 0xff, 0xf6,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0xff, 0xd0, 0x0,
-    0x9f, 0xfe, 0xff, 0xff, 0x40, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf6, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0xf, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x80, 0x0,
+    0xbf, 0xfc, 0x20, 0x1b, 0x7f, 0xf0, 0x80, 0x6c,
+    0xff, 0xb8, 0x80, 0x32, 0x80, 0x62, 0x0, 0xca,
+    0x1, 0x8c, 0x2, 0x2f, 0x0, 0xc4, 0x1, 0x10,
+    0x7, 0x18, 0x4, 0x20, 0x19, 0x48, 0x3, 0x70,
+    0x4, 0xe0, 0x1d, 0xc0, 0x11, 0x0, 0x6e, 0x60,
+    0xc, 0x40, 0x16, 0x80, 0x72, 0x80, 0x4a, 0x1,
+    0x88, 0x80, 0x19, 0xc0, 0x23, 0x0, 0x10, 0x0,
+    0xc0, 0x2e, 0x0, 0xce, 0x4, 0x1, 0x10, 0x4,
+    0xa0, 0x7, 0x0, 0x84, 0x0, 0x40, 0x18, 0x81,
+    0x80, 0x30, 0x80, 0x4, 0x1, 0xa0, 0x12, 0x80,
+    0x1c, 0x2, 0x10, 0x1, 0x80, 0x62, 0x3, 0x0,
+    0x90, 0x2, 0x30, 0x1, 0x0, 0x4a, 0x0, 0xe0,
+    0xc, 0xc0, 0xa0, 0x11, 0x10, 0x1, 0xc0, 0x20,
+    0x18, 0x80, 0x4, 0x1, 0xb4, 0x3c, 0x2, 0x16,
+    0x0, 0x28, 0x28, 0x6, 0xe0, 0x2, 0x80, 0x62,
+    0x5, 0x0, 0x10, 0x10, 0x0, 0xc0, 0x80, 0x31,
+    0x80, 0x4, 0x3, 0x30, 0x10, 0x1, 0xc3, 0x80,
+    0x21, 0xe0, 0xc, 0xc0, 0x11, 0x0, 0x44, 0x22,
+    0x0, 0x10, 0x10, 0x4, 0xa4, 0x1, 0x88, 0x2,
+    0x70, 0x8, 0x48, 0x2, 0xe0, 0x70, 0x8, 0x98,
+    0x2, 0x20, 0xc, 0x40, 0x19, 0x40, 0x25, 0x2,
+    0x0, 0xb8, 0x40, 0x26, 0x0, 0xdc, 0x1, 0xbc,
+    0x2, 0x20, 0x0, 0x80, 0x8, 0x80, 0x11, 0x0,
+    0x65, 0x0, 0xca, 0x1, 0x8, 0x0, 0x80, 0x2,
+    0x1, 0xbc, 0x3, 0x10, 0x6, 0x20, 0x1, 0x0,
+    0x4a, 0x0, 0x50, 0xc, 0x40, 0x18, 0x40, 0x30,
+    0x80, 0x1c, 0x2, 0xe0, 0x0, 0x80, 0x66, 0x0,
+    0xe3, 0x0, 0xf1, 0x0, 0x44, 0x1, 0xf1, 0x0,
+    0x73, 0x0, 0x7b, 0x80, 0x26, 0x0, 0xf1, 0x0,
+    0x78, 0x80, 0x3c, 0xa0, 0x11, 0x80, 0x79, 0xc0,
+    0x3d, 0xa0, 0x1e, 0x20, 0xc, 0x20, 0x1c, 0x40,
+    0x10,
 
     /* U+0078 "x" */
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x30, 0x6, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfb, 0x0, 0x8, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x50, 0x2f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xd0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xe0, 0xbf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xfc, 0x0, 0x9, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf3, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0,
-    0xe, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x20, 0x9f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0,
+    0x1f, 0xff, 0x70, 0x7, 0xd9, 0xff, 0xe3, 0x1,
+    0x90, 0xe, 0x18, 0x0, 0xe5, 0x30, 0xe, 0x63,
+    0x0, 0x32, 0x0, 0x73, 0x90, 0x6, 0xb0, 0xe,
+    0x18, 0x0, 0xd2, 0x1, 0xe9, 0x0, 0xa0, 0x40,
+    0x3a, 0xc4, 0x3, 0x14, 0x0, 0x72, 0x28, 0x13,
+    0x80, 0x72, 0xa8, 0x3, 0xce, 0x60, 0x1d, 0x1,
+    0x0, 0x1e, 0xb0, 0xf, 0xde, 0x1, 0xc4, 0xca,
+    0x1, 0xd2, 0x20, 0x1f, 0x8d, 0xc0, 0x3a, 0x40,
+    0x38, 0xd8, 0x3, 0xfd, 0x4, 0x1, 0xfe, 0xe0,
+    0xf, 0xfd, 0x20, 0x1f, 0xd0, 0x40, 0x1f, 0xf9,
+    0x18, 0x3, 0xe2, 0x70, 0xf, 0xfe, 0x14, 0x0,
+    0x7d, 0x0, 0x1f, 0xfc, 0x39, 0x0, 0xfa, 0x40,
+    0x3f, 0xf8, 0x44, 0xe0, 0x1f, 0x1b, 0x0, 0x7f,
+    0xf0, 0x78, 0x3, 0xfa, 0x44, 0x3, 0xfe, 0x73,
+    0x0, 0xff, 0x58, 0x7, 0xf8, 0xa0, 0x3, 0x9c,
+    0x3, 0x95, 0x40, 0x1f, 0xd2, 0x1, 0xc3, 0x8,
+    0x1, 0xd6, 0x1, 0xf9, 0x90, 0x3, 0xa0, 0x24,
+    0x3, 0x86, 0x40, 0x3c, 0x30, 0x1, 0xc6, 0xc0,
+    0x4c, 0x1, 0xcc, 0x60, 0x1d, 0x62, 0x1, 0xde,
+    0x1, 0x40, 0x80, 0x77, 0x0, 0x64, 0x50, 0xe,
+    0x63, 0x0, 0x86, 0x0, 0x38, 0xa0, 0x2, 0xa0,
+    0xe, 0x18, 0x0, 0xe6, 0x30, 0xe, 0x72, 0x9,
+    0x10, 0xe, 0x81, 0x0, 0xf7, 0x80, 0x7b, 0x80,
 
     /* U+0079 "y" */
-    0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xa0,
-    0x1f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x50, 0xa, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0xef, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf9, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xfe, 0x0, 0x8, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0xe, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf3, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf7, 0xef, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xfe, 0xb0, 0xf, 0xe9, 0xff, 0xf0, 0x50,
+    0x7, 0x20, 0x80, 0x7e, 0x70, 0xe, 0x50, 0x70,
+    0xf, 0x30, 0x7, 0xc6, 0x20, 0x1d, 0xe0, 0x2a,
+    0x1, 0xd6, 0x1, 0xf5, 0x0, 0x79, 0x40, 0x1c,
+    0x1, 0xc6, 0x40, 0x1e, 0x70, 0xe, 0x50, 0x9,
+    0x4, 0x3, 0xa8, 0x3, 0x8c, 0x40, 0x3b, 0x80,
+    0x33, 0x0, 0x72, 0x80, 0x75, 0x80, 0x70, 0xa0,
+    0x6, 0xa0, 0xe, 0x23, 0x0, 0xcc, 0x1, 0xce,
+    0x1, 0xc4, 0x60, 0x1d, 0x40, 0x11, 0x88, 0x7,
+    0x68, 0x7, 0xa8, 0x3, 0x9c, 0x2, 0xb0, 0xe,
+    0x14, 0x0, 0xf3, 0x0, 0x70, 0xa0, 0x1, 0x80,
+    0x39, 0x80, 0x3f, 0x28, 0x7, 0x68, 0x18, 0x80,
+    0x75, 0x80, 0x7e, 0x90, 0xe, 0x70, 0x40, 0xe,
+    0x23, 0x0, 0xfc, 0x64, 0x1, 0x84, 0xf0, 0x3,
+    0x94, 0x3, 0xfd, 0x40, 0x1c, 0x8a, 0x1, 0xd4,
+    0x1, 0xfe, 0x60, 0xe, 0xb1, 0x0, 0xc4, 0x40,
+    0xf, 0xf0, 0xa0, 0x6, 0x30, 0xe, 0xa0, 0xf,
+    0xfd, 0xc0, 0x1f, 0xe5, 0x0, 0xff, 0xca, 0x1,
+    0xfc, 0x64, 0x1, 0xff, 0xc1, 0x60, 0xf, 0xd6,
+    0x1, 0xff, 0xc2, 0xa0, 0xf, 0xcc, 0x1, 0xff,
+    0xc2, 0x32, 0x0, 0xf1, 0x88, 0x7, 0xff, 0xe,
+    0x80, 0x3d, 0x40, 0x1f, 0xfc, 0xb7, 0x0, 0xff,
+    0xe2, 0x50, 0x7, 0x20, 0x80, 0x7f, 0xf0, 0xcc,
+    0x80, 0x3b, 0x40, 0x3f, 0xf8, 0x96, 0x1, 0xe7,
+    0x0, 0xff, 0xe2, 0x30, 0x7, 0x20, 0x80, 0x7f,
+    0xf0, 0xcc, 0x40, 0x3b, 0x80, 0x3f, 0xf8, 0x94,
+    0x1, 0xe5, 0x0, 0xff, 0xe2, 0x38, 0x7, 0x28,
+    0x7, 0xff, 0x11, 0x4, 0x3, 0xbc, 0x3, 0xfe,
 
     /* U+007A "z" */
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x59, 0x99, 0x99,
-    0x99, 0x99, 0x9e, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xd9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x21,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4,
+    0xa, 0xff, 0xff, 0xe2, 0xe0, 0x7, 0xff, 0xfc,
+    0x3, 0xfe, 0xf6, 0x6f, 0xf0, 0x80, 0x79, 0xc0,
+    0xb, 0x33, 0xfd, 0xc2, 0x1, 0xc3, 0x40, 0x1f,
+    0xf2, 0xc0, 0x7, 0xe, 0x8, 0x7, 0xf9, 0x28,
+    0x3, 0xda, 0x40, 0x1f, 0xe2, 0xb0, 0xf, 0x51,
+    0x80, 0x7f, 0x87, 0x0, 0x3d, 0x2a, 0x1, 0xfe,
+    0x1c, 0x10, 0xe, 0x76, 0x0, 0xff, 0xb4, 0x80,
+    0x39, 0x60, 0x3, 0xfe, 0xa3, 0x0, 0xe4, 0xa0,
+    0xf, 0xfa, 0x54, 0x3, 0x8e, 0xc0, 0x3f, 0xe7,
+    0x60, 0xe, 0x1d, 0x0, 0xff, 0x96, 0x0, 0x38,
+    0x70, 0x40, 0x3f, 0xc9, 0x40, 0x1e, 0xd2, 0x0,
+    0xff, 0xac, 0x3, 0xc5, 0x53, 0x3f, 0xe2, 0x10,
+    0xf, 0x89, 0x9b, 0xff, 0x0, 0x7f, 0xff, 0xc0,
+    0x3f, 0x80,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x80, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf, 0xff, 0xfa,
+    0x0, 0xff, 0xc9, 0x5b, 0xff, 0xa8, 0x3, 0xfc,
+    0x59, 0x6a, 0x40, 0x1f, 0xfc, 0x21, 0xc3, 0x0,
+    0xff, 0xe2, 0xd0, 0x80, 0x7f, 0xf1, 0x49, 0x0,
+    0x3f, 0xf8, 0xc8, 0x1, 0xff, 0xc7, 0xe0, 0xf,
+    0x2e, 0xff, 0xa8, 0x3, 0xff, 0x84, 0x34, 0x40,
+    0x1f, 0xf7, 0x0, 0x71, 0x80, 0x7f, 0xf0, 0x4c,
+    0x3, 0x8c, 0x3, 0xff, 0x82, 0xc0, 0x1c, 0x20,
+    0x1f, 0xfc, 0x12, 0x0, 0xf0, 0x80, 0x7f, 0xe1,
+    0x0, 0xf1, 0x0, 0x7f, 0xf0, 0x44, 0x3, 0x9c,
+    0x3, 0xff, 0x8e, 0x40, 0x1f, 0xf8, 0x44, 0x1,
+    0xff, 0xc5, 0x2d, 0x0, 0xf1, 0x0, 0x64, 0xff,
+    0xf6, 0x98, 0x7, 0x12, 0x0, 0x7f, 0xf1, 0x4b,
+    0x0, 0x3f, 0xf8, 0x87, 0x3a, 0x20, 0x1f, 0xfc,
+    0x41, 0xe0, 0xf, 0xfe, 0x31, 0x3f, 0x10, 0x7,
+    0xff, 0x18, 0x7c, 0x3, 0x93, 0xff, 0xda, 0x60,
+    0x1c, 0x48, 0x1, 0xff, 0x16, 0x80, 0x78, 0x80,
+    0x3f, 0xf0, 0x88, 0x3, 0xff, 0x9a, 0x40, 0x1f,
+    0xfc, 0x11, 0x0, 0xe7, 0x0, 0xff, 0xc4, 0x1,
+    0xe2, 0x0, 0xff, 0xc2, 0x1, 0xe1, 0x0, 0xff,
+    0xcc, 0x1, 0xc2, 0x1, 0xff, 0xc1, 0x20, 0xe,
+    0x30, 0xf, 0xfe, 0xf, 0x80, 0x71, 0x80, 0x7f,
+    0xf1, 0xc6, 0x88, 0x3, 0xfe, 0xe0, 0xf, 0x2e,
+    0xff, 0xa8, 0x3, 0xf2, 0x0, 0x7f, 0xf1, 0xc9,
+    0x0, 0x3f, 0xf8, 0xf4, 0x20, 0x1f, 0xfc, 0x61,
+    0xf3, 0x0, 0xff, 0xe3, 0xe, 0x5a, 0x90, 0x7,
+    0x0,
 
     /* U+007C "|" */
-    0x24, 0x44, 0x44, 0x38, 0xff, 0xff, 0xfc, 0x8f,
-    0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff,
-    0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff,
-    0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc8,
-    0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc8, 0xff,
-    0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc8, 0xff, 0xff,
-    0xfc, 0x8f, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc,
-    0x8f, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f,
-    0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff,
-    0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff,
-    0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc8,
-    0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc8, 0xff,
-    0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc8, 0xff, 0xff,
-    0xfc, 0x8f, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc,
-    0x8f, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f,
-    0xff, 0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff,
-    0xff, 0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff,
-    0xc8, 0xff, 0xff, 0xfc, 0x8f, 0xff, 0xff, 0xc0,
+    0x24, 0x4e, 0x3a, 0xbb, 0xef, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfe, 0x40,
 
     /* U+007D "}" */
-    0x7f, 0xff, 0xfd, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfd, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfd, 0xb6, 0xa0, 0x1f, 0xfc, 0x52, 0x4a,
+    0xe3, 0x0, 0xff, 0xe3, 0xe, 0x18, 0x7, 0xff,
+    0x1f, 0x40, 0x3f, 0xf8, 0xe2, 0xc0, 0x1f, 0xfc,
+    0x7c, 0x0, 0xfc, 0xff, 0xee, 0x70, 0xf, 0x8,
+    0x7, 0xfc, 0x30, 0x60, 0x1f, 0xfc, 0x75, 0x0,
+    0xe2, 0x0, 0xff, 0xe0, 0x90, 0x7, 0x8, 0x7,
+    0xff, 0x5, 0xc0, 0x3b, 0x80, 0x3f, 0xf8, 0x24,
+    0x1, 0xc6, 0x1, 0xff, 0xc1, 0x10, 0xe, 0x60,
+    0xf, 0xfc, 0x20, 0x1e, 0x20, 0xf, 0xfc, 0x40,
+    0x1f, 0xfc, 0xe5, 0x0, 0xff, 0xc4, 0x1, 0xea,
+    0x40, 0xf, 0xf8, 0x54, 0x3, 0x86, 0xff, 0xfc,
+    0xe0, 0x1d, 0x48, 0x1, 0xff, 0xc7, 0xba, 0x40,
+    0xf, 0xfe, 0x31, 0xb8, 0x7, 0xff, 0x10, 0x72,
+    0x4c, 0x3, 0xff, 0x89, 0x66, 0x1, 0xff, 0xc5,
+    0x15, 0x0, 0xe2, 0xbf, 0xff, 0x38, 0x6, 0x20,
+    0xf, 0x4a, 0x0, 0x7f, 0xf1, 0x94, 0x3, 0xff,
+    0x10, 0x7, 0xff, 0x1c, 0x40, 0x3c, 0x40, 0x1f,
+    0xfc, 0x11, 0x0, 0xe6, 0x0, 0xff, 0xe0, 0x90,
+    0x7, 0x18, 0x7, 0xff, 0x5, 0xc0, 0x3b, 0x80,
+    0x3f, 0xf8, 0x24, 0x1, 0xc4, 0x1, 0xff, 0xc1,
+    0x20, 0xe, 0x10, 0xf, 0xf8, 0x61, 0x0, 0x3f,
+    0xf8, 0x4f, 0xfe, 0xe7, 0x0, 0xf1, 0x0, 0x7f,
+    0xf1, 0xf0, 0x3, 0xff, 0x8c, 0x4a, 0x1, 0xff,
+    0xc6, 0xe0, 0xf, 0xfe, 0x29, 0x61, 0x80, 0x7f,
+    0xf0, 0x89, 0x2b, 0x4c, 0x3, 0xfc,
 
     /* U+007E "~" */
-    0x0, 0x1, 0x7c, 0xee, 0xc8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x5a, 0xaa, 0xa5, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x8,
-    0xff, 0xff, 0x80, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x8f, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x8, 0xff,
-    0xff, 0x84, 0xff, 0xff, 0xe2, 0x1a, 0xff, 0xff,
-    0xfb, 0x10, 0xcf, 0xff, 0xf7, 0x4f, 0xff, 0xfb,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x55, 0xff, 0xff, 0xb0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x5f, 0xff, 0xfb, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3,
-    0xbb, 0xbb, 0x80, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x29, 0xdf, 0xfd, 0xa3, 0x0, 0x0
+    0x0, 0x85, 0xf3, 0xb9, 0x90, 0x40, 0x1f, 0xfc,
+    0x24, 0xf8, 0x31, 0x11, 0xbe, 0xb0, 0x7, 0x2d,
+    0x56, 0x50, 0x3b, 0x10, 0xf, 0xa5, 0x80, 0x36,
+    0xaa, 0xed, 0xf, 0x0, 0xff, 0x49, 0x0, 0x7f,
+    0x9, 0x80, 0x7f, 0xde, 0x1, 0xfc, 0xa0, 0x18,
+    0x77, 0x94, 0x3, 0x15, 0x88, 0x20, 0x6, 0xf0,
+    0xe, 0x52, 0x1a, 0x40, 0xc, 0x9d, 0xe6, 0x1,
+    0x88, 0x40, 0x3f, 0x50, 0x80, 0x7f, 0xc8, 0x1,
+    0xfc, 0x34, 0x1, 0xfe, 0x81, 0x64, 0x4c, 0x60,
+    0x19, 0x28, 0x3, 0xf3, 0xb8, 0xe, 0xef, 0x40,
+    0x7, 0x2e, 0xb1, 0x0, 0x9, 0x72, 0x0, 0x0,
 };
 
 
@@ -3768,99 +1899,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 403, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 403, .box_w = 9, .box_h = 31, .ofs_x = 8, .ofs_y = 0},
-    {.bitmap_index = 140, .adv_w = 403, .box_w = 18, .box_h = 13, .ofs_x = 4, .ofs_y = 18},
-    {.bitmap_index = 257, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 614, .adv_w = 403, .box_w = 23, .box_h = 44, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 1120, .adv_w = 403, .box_w = 27, .box_h = 31, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1539, .adv_w = 403, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1958, .adv_w = 403, .box_w = 7, .box_h = 13, .ofs_x = 9, .ofs_y = 18},
-    {.bitmap_index = 2004, .adv_w = 403, .box_w = 15, .box_h = 42, .ofs_x = 6, .ofs_y = -6},
-    {.bitmap_index = 2319, .adv_w = 403, .box_w = 15, .box_h = 42, .ofs_x = 4, .ofs_y = -6},
-    {.bitmap_index = 2634, .adv_w = 403, .box_w = 23, .box_h = 23, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 2899, .adv_w = 403, .box_w = 21, .box_h = 21, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 3120, .adv_w = 403, .box_w = 10, .box_h = 14, .ofs_x = 7, .ofs_y = -7},
-    {.bitmap_index = 3190, .adv_w = 403, .box_w = 15, .box_h = 6, .ofs_x = 5, .ofs_y = 11},
-    {.bitmap_index = 3235, .adv_w = 403, .box_w = 9, .box_h = 9, .ofs_x = 8, .ofs_y = 0},
-    {.bitmap_index = 3276, .adv_w = 403, .box_w = 22, .box_h = 41, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 3727, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4053, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4379, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4705, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5031, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5341, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5667, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6024, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6365, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6722, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7079, .adv_w = 403, .box_w = 9, .box_h = 24, .ofs_x = 8, .ofs_y = 0},
-    {.bitmap_index = 7187, .adv_w = 403, .box_w = 10, .box_h = 31, .ofs_x = 7, .ofs_y = -7},
-    {.bitmap_index = 7342, .adv_w = 403, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 7605, .adv_w = 403, .box_w = 19, .box_h = 17, .ofs_x = 3, .ofs_y = 6},
-    {.bitmap_index = 7767, .adv_w = 403, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 8030, .adv_w = 403, .box_w = 18, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 8309, .adv_w = 403, .box_w = 24, .box_h = 39, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 8777, .adv_w = 403, .box_w = 24, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9149, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9490, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9831, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10172, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10482, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10808, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11149, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11475, .adv_w = 403, .box_w = 19, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11770, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12111, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12468, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 12778, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13135, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13461, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13787, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14128, .adv_w = 403, .box_w = 22, .box_h = 39, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 14557, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14898, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15255, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15612, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15938, .adv_w = 403, .box_w = 24, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16310, .adv_w = 403, .box_w = 25, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16698, .adv_w = 403, .box_w = 25, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17086, .adv_w = 403, .box_w = 25, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17474, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17784, .adv_w = 403, .box_w = 13, .box_h = 40, .ofs_x = 7, .ofs_y = -5},
-    {.bitmap_index = 18044, .adv_w = 403, .box_w = 22, .box_h = 41, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 18495, .adv_w = 403, .box_w = 14, .box_h = 40, .ofs_x = 5, .ofs_y = -5},
-    {.bitmap_index = 18775, .adv_w = 403, .box_w = 21, .box_h = 17, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 18954, .adv_w = 403, .box_w = 21, .box_h = 6, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 19017, .adv_w = 403, .box_w = 12, .box_h = 7, .ofs_x = 5, .ofs_y = 28},
-    {.bitmap_index = 19059, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19311, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19637, .adv_w = 403, .box_w = 22, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19901, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20227, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20479, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20820, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 21156, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21482, .adv_w = 403, .box_w = 22, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 21856, .adv_w = 403, .box_w = 19, .box_h = 42, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 22255, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22612, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22969, .adv_w = 403, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23245, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23497, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23749, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 24085, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 24421, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 24673, .adv_w = 403, .box_w = 22, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24937, .adv_w = 403, .box_w = 22, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25267, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25519, .adv_w = 403, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25807, .adv_w = 403, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26107, .adv_w = 403, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26395, .adv_w = 403, .box_w = 24, .box_h = 32, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 26779, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27031, .adv_w = 403, .box_w = 20, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 27431, .adv_w = 403, .box_w = 7, .box_h = 41, .ofs_x = 9, .ofs_y = -5},
-    {.bitmap_index = 27575, .adv_w = 403, .box_w = 20, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 27975, .adv_w = 403, .box_w = 23, .box_h = 11, .ofs_x = 1, .ofs_y = 10}
+    {.bitmap_index = 84, .adv_w = 403, .box_w = 18, .box_h = 13, .ofs_x = 4, .ofs_y = 18},
+    {.bitmap_index = 139, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 357, .adv_w = 403, .box_w = 23, .box_h = 44, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 621, .adv_w = 403, .box_w = 27, .box_h = 31, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 924, .adv_w = 403, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1187, .adv_w = 403, .box_w = 7, .box_h = 13, .ofs_x = 9, .ofs_y = 18},
+    {.bitmap_index = 1213, .adv_w = 403, .box_w = 15, .box_h = 42, .ofs_x = 6, .ofs_y = -6},
+    {.bitmap_index = 1374, .adv_w = 403, .box_w = 15, .box_h = 42, .ofs_x = 4, .ofs_y = -6},
+    {.bitmap_index = 1543, .adv_w = 403, .box_w = 23, .box_h = 23, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 1702, .adv_w = 403, .box_w = 21, .box_h = 21, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 1745, .adv_w = 403, .box_w = 10, .box_h = 14, .ofs_x = 7, .ofs_y = -7},
+    {.bitmap_index = 1800, .adv_w = 403, .box_w = 15, .box_h = 6, .ofs_x = 5, .ofs_y = 11},
+    {.bitmap_index = 1808, .adv_w = 403, .box_w = 9, .box_h = 9, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 1840, .adv_w = 403, .box_w = 22, .box_h = 41, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 2086, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2269, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2358, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2536, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2708, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2838, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2987, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3214, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3388, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3633, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3859, .adv_w = 403, .box_w = 9, .box_h = 24, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 3922, .adv_w = 403, .box_w = 10, .box_h = 31, .ofs_x = 7, .ofs_y = -7},
+    {.bitmap_index = 4015, .adv_w = 403, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 4162, .adv_w = 403, .box_w = 19, .box_h = 17, .ofs_x = 3, .ofs_y = 6},
+    {.bitmap_index = 4191, .adv_w = 403, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 4341, .adv_w = 403, .box_w = 18, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 4474, .adv_w = 403, .box_w = 24, .box_h = 39, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 4750, .adv_w = 403, .box_w = 24, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4974, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5151, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5312, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5440, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5502, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5546, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5710, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5759, .adv_w = 403, .box_w = 19, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5812, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5912, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6094, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 6131, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6285, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6448, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6602, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6724, .adv_w = 403, .box_w = 22, .box_h = 39, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 6928, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7103, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7335, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7384, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7476, .adv_w = 403, .box_w = 24, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7711, .adv_w = 403, .box_w = 25, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8038, .adv_w = 403, .box_w = 25, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8279, .adv_w = 403, .box_w = 25, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8454, .adv_w = 403, .box_w = 20, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8587, .adv_w = 403, .box_w = 13, .box_h = 40, .ofs_x = 7, .ofs_y = -5},
+    {.bitmap_index = 8616, .adv_w = 403, .box_w = 22, .box_h = 41, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 8857, .adv_w = 403, .box_w = 14, .box_h = 40, .ofs_x = 5, .ofs_y = -5},
+    {.bitmap_index = 8891, .adv_w = 403, .box_w = 21, .box_h = 17, .ofs_x = 2, .ofs_y = 15},
+    {.bitmap_index = 9010, .adv_w = 403, .box_w = 21, .box_h = 6, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 9021, .adv_w = 403, .box_w = 12, .box_h = 7, .ofs_x = 5, .ofs_y = 28},
+    {.bitmap_index = 9051, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9214, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9355, .adv_w = 403, .box_w = 22, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9503, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9644, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9794, .adv_w = 403, .box_w = 22, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9877, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 10060, .adv_w = 403, .box_w = 21, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10145, .adv_w = 403, .box_w = 22, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10246, .adv_w = 403, .box_w = 19, .box_h = 42, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 10371, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10521, .adv_w = 403, .box_w = 23, .box_h = 31, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10600, .adv_w = 403, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10678, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10757, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10902, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 11051, .adv_w = 403, .box_w = 21, .box_h = 32, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 11197, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 11288, .adv_w = 403, .box_w = 22, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11470, .adv_w = 403, .box_w = 22, .box_h = 30, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11556, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11644, .adv_w = 403, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11825, .adv_w = 403, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12074, .adv_w = 403, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12258, .adv_w = 403, .box_w = 24, .box_h = 32, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 12482, .adv_w = 403, .box_w = 21, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12588, .adv_w = 403, .box_w = 20, .box_h = 40, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 12789, .adv_w = 403, .box_w = 7, .box_h = 41, .ofs_x = 9, .ofs_y = -5},
+    {.bitmap_index = 12807, .adv_w = 403, .box_w = 20, .box_h = 40, .ofs_x = 3, .ofs_y = -5},
+    {.bitmap_index = 13005, .adv_w = 403, .box_w = 23, .box_h = 11, .ofs_x = 1, .ofs_y = 10}
 };
 
 /*---------------------
@@ -3902,7 +2033,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 30 px
  * Bpp: 4
- * Opts: --font PF Din Mono.ttf --size 30 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_pf_din_mono_30 --no-compress -o out/lv_font_pf_din_mono_30.c
+ * Opts: --font PF Din Mono.ttf --size 30 --bpp 4 --format lvgl -r 0x20-0x7E --lv-font-name lv_font_pf_din_mono_30 -o out/lv_font_pf_din_mono_30.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -25,1644 +25,1115 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0x7f, 0xf8, 0x7f, 0xf7, 0x6f, 0xf7, 0x6f, 0xf6,
-    0x5f, 0xf6, 0x5f, 0xf5, 0x4f, 0xf5, 0x4f, 0xf4,
-    0x3f, 0xf4, 0x3f, 0xf3, 0x2f, 0xf3, 0x2f, 0xf2,
-    0x1f, 0xf2, 0x1f, 0xf1, 0xf, 0xf1, 0x8, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x7f, 0xf6,
-    0x7f, 0xf6,
+    0x7f, 0xf4, 0x0, 0x5e, 0x20, 0x1e, 0x13, 0x0,
+    0xf1, 0x88, 0x7, 0x85, 0xc0, 0x3c, 0xe2, 0x1,
+    0xe1, 0x30, 0xf, 0x18, 0x80, 0x67, 0x70, 0x84,
+    0x40, 0x3, 0x9f, 0xfc, 0xa0, 0x11, 0x80, 0x60,
 
     /* U+0022 "\"" */
-    0xef, 0xe5, 0xff, 0x6d, 0xfd, 0x4f, 0xf5, 0xcf,
-    0xc3, 0xff, 0x4b, 0xfb, 0x2f, 0xf3, 0xaf, 0xa2,
-    0xff, 0x29, 0xf9, 0x1f, 0xf1, 0x49, 0x50, 0x99,
-    0x0,
+    0xef, 0xe5, 0xff, 0x31, 0x81, 0x88, 0x0, 0xc4,
+    0x5, 0xc0, 0x2, 0xe0, 0xe2, 0x0, 0x71, 0x1,
+    0x0, 0x84, 0xc0, 0xcc, 0x0, 0x3d, 0x6c, 0x16,
+    0x60, 0x80,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x3, 0xfa, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x7, 0xf5, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0xaf, 0x30, 0x6, 0xf6, 0x0, 0x0, 0x0, 0xc,
-    0xf0, 0x0, 0x8f, 0x40, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x9b, 0xbf, 0xeb,
-    0xbb, 0xff, 0xbb, 0xb2, 0x0, 0x2, 0xfa, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x3f,
-    0xa0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x4, 0xf8,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x6f, 0x60,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x7b, 0xbf, 0xfb, 0xbb, 0xef, 0xbb, 0xb3,
-    0x0, 0x1, 0xfc, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x8, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xc0, 0xb, 0x7c, 0x3, 0xe3, 0x6,
+    0x0, 0x88, 0x80, 0x1f, 0x30, 0x68, 0x0, 0x41,
+    0x80, 0x3e, 0x20, 0x20, 0x2, 0x81, 0x0, 0x7d,
+    0xa0, 0xc0, 0x2, 0xf, 0x0, 0xf9, 0x80, 0xc0,
+    0x1c, 0x4, 0x1, 0xb7, 0xfc, 0x61, 0xff, 0x38,
+    0x5f, 0xf8, 0xc1, 0x12, 0x1, 0x44, 0x80, 0x8,
+    0x90, 0x84, 0xdc, 0x82, 0x5d, 0xc0, 0x37, 0x71,
+    0x0, 0x4c, 0x4, 0x0, 0x10, 0x20, 0xf, 0x88,
+    0x38, 0x0, 0x40, 0xc0, 0x1f, 0x70, 0x10, 0x1,
+    0xc0, 0x80, 0x3e, 0x20, 0x60, 0x1, 0x7, 0x0,
+    0x6b, 0xff, 0x28, 0x6f, 0xfa, 0x42, 0x7f, 0xca,
+    0x18, 0x88, 0x0, 0x22, 0x42, 0x8, 0x93, 0x3,
+    0xdd, 0x1, 0xdd, 0xc6, 0x17, 0x71, 0x80, 0x44,
+    0xc, 0x1, 0x11, 0x0, 0x3e, 0x60, 0xd0, 0x0,
+    0x83, 0x0, 0x7c, 0x40, 0x40, 0x5, 0x2, 0x0,
+    0xfb, 0x81, 0x80, 0x4, 0x1e, 0x1, 0xf1, 0x1,
+    0x0, 0x38, 0x8, 0x3, 0x80,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x4, 0x60, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8d, 0x1f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd1, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xfd, 0x1f, 0xfe, 0x81, 0x0, 0x0, 0x9f,
-    0xff, 0xd1, 0xff, 0xff, 0xf3, 0x0, 0x5f, 0xfc,
-    0xbd, 0x1f, 0x9b, 0xfe, 0x10, 0xc, 0xfc, 0x8,
-    0xd1, 0xf5, 0x3, 0x40, 0x0, 0xff, 0x60, 0x8d,
-    0x1f, 0x50, 0x0, 0x0, 0xf, 0xf5, 0x8, 0xd1,
-    0xf5, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x8d, 0x1f,
-    0x50, 0x0, 0x0, 0x9, 0xff, 0x99, 0xd1, 0xf5,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xfd, 0x1f, 0x50,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xd1, 0xfe, 0x71,
-    0x0, 0x0, 0x0, 0x1, 0xbd, 0x1f, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x8, 0xd1, 0xfc, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x8d, 0x1f, 0x53, 0xef, 0xe0,
-    0x0, 0x0, 0x8, 0xd1, 0xf5, 0x7, 0xff, 0x20,
-    0x0, 0x0, 0x8d, 0x1f, 0x50, 0x4f, 0xf4, 0x0,
-    0x0, 0x8, 0xd1, 0xf5, 0x5, 0xff, 0x30, 0xa5,
-    0x0, 0x8d, 0x1f, 0x50, 0xbf, 0xf0, 0x7f, 0xfb,
-    0x38, 0xd1, 0xf6, 0x9f, 0xf8, 0x1, 0xcf, 0xff,
-    0xfd, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x6d, 0xff,
-    0xd1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xbd,
-    0x1f, 0x81, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd1,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x1f,
-    0x50, 0x0, 0x0,
+    0x0, 0xe4, 0x60, 0x82, 0x0, 0xff, 0x65, 0x8b,
+    0xb8, 0x3, 0xfc, 0x20, 0x1f, 0xf9, 0xb5, 0x80,
+    0x2a, 0xe8, 0x10, 0xd, 0x32, 0x20, 0xe, 0x17,
+    0xe3, 0x0, 0x2b, 0x1, 0xa0, 0x4, 0xc8, 0x2,
+    0x40, 0x9, 0x3, 0xc3, 0x0, 0xb2, 0xf2, 0x84,
+    0x0, 0x61, 0x40, 0x1f, 0x1a, 0x0, 0x71, 0x80,
+    0x7f, 0xe1, 0xf, 0x0, 0xff, 0xce, 0xb, 0x22,
+    0x1, 0xfe, 0x82, 0x6, 0x60, 0x7, 0xf8, 0x75,
+    0x80, 0x3a, 0xdc, 0x40, 0x3d, 0x3c, 0x80, 0x10,
+    0xc7, 0xa0, 0x7, 0x84, 0xc0, 0x23, 0x1, 0xb5,
+    0x0, 0xff, 0x4e, 0x8, 0x58, 0x7, 0xfc, 0x72,
+    0x2, 0x40, 0x1f, 0xf1, 0x80, 0x18, 0x3, 0xfe,
+    0x10, 0x3, 0x85, 0x28, 0x7, 0xee, 0x0, 0x1b,
+    0xad, 0x59, 0x80, 0x63, 0x94, 0x7, 0x6, 0x30,
+    0x4c, 0x70, 0xa, 0x58, 0xe, 0x0, 0x72, 0x48,
+    0x3, 0xe7, 0xc0, 0xc, 0xdb, 0x88, 0x1, 0x3f,
+    0x40, 0x7, 0xc6, 0x60, 0xb, 0x44, 0x3, 0xff,
+    0x8e,
 
     /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0x6, 0xdf, 0xd5, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x9, 0xff, 0xcf, 0xf7, 0x0, 0x0, 0x4f,
-    0x80, 0x1, 0xfe, 0x10, 0x2f, 0xf0, 0x0, 0xe,
-    0xe0, 0x0, 0x3f, 0xb0, 0x0, 0xcf, 0x10, 0x8,
-    0xf4, 0x0, 0x3, 0xfa, 0x0, 0xc, 0xf2, 0x2,
-    0xfb, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0xcf, 0x10,
-    0xcf, 0x10, 0x0, 0x1, 0xfe, 0x10, 0x2f, 0xf0,
-    0x6f, 0x70, 0x0, 0x0, 0x9, 0xff, 0xdf, 0xf8,
-    0x1e, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xd6,
-    0xa, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xb0, 0x3b, 0xfe, 0x91, 0x0, 0x0,
-    0x0, 0xb, 0xf2, 0x4f, 0xfd, 0xef, 0xd0, 0x0,
-    0x0, 0x5, 0xf7, 0xb, 0xf6, 0x0, 0xcf, 0x50,
-    0x0, 0x1, 0xed, 0x0, 0xdf, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x9f, 0x30, 0xe, 0xf0, 0x0, 0x6f,
-    0x70, 0x0, 0x3f, 0x90, 0x0, 0xdf, 0x0, 0x6,
-    0xf7, 0x0, 0xd, 0xe1, 0x0, 0xb, 0xf6, 0x0,
-    0xbf, 0x50, 0x7, 0xf5, 0x0, 0x0, 0x4f, 0xfd,
-    0xef, 0xd0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x3c,
-    0xfe, 0x91, 0x0, 0x48, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0x8f, 0xe0, 0x4, 0xdb, 0xfa,
+    0xa0, 0x1e, 0xb0, 0xf0, 0x4, 0xc8, 0x8c, 0xa9,
+    0xc0, 0x32, 0x2b, 0x98, 0xb, 0xf, 0x66, 0x84,
+    0x0, 0x6a, 0x18, 0x0, 0x10, 0x28, 0x81, 0x18,
+    0x8, 0x2, 0x6, 0x80, 0x38, 0x40, 0x38, 0xc0,
+    0x9d, 0x10, 0x1, 0xc2, 0x1, 0xc6, 0x1c, 0x14,
+    0x1, 0x88, 0x14, 0x40, 0x8c, 0x5, 0x8e, 0x4,
+    0x3, 0xb, 0xf, 0x6e, 0x81, 0xc6, 0xd, 0xc0,
+    0x3d, 0x30, 0x45, 0x4c, 0x58, 0xf8, 0x7, 0xe7,
+    0xdf, 0xd6, 0x45, 0x63, 0x0, 0xff, 0xe0, 0xc8,
+    0xc8, 0x7, 0xff, 0x6, 0xa, 0xc0, 0x3f, 0xf8,
+    0x24, 0xe8, 0xa7, 0x7f, 0xd2, 0x20, 0x1f, 0x48,
+    0x4a, 0x62, 0x10, 0x36, 0x0, 0x79, 0x52, 0xb,
+    0xc2, 0x77, 0x8c, 0x94, 0x3, 0xd, 0x93, 0x83,
+    0x3, 0x0, 0x28, 0x8, 0x3, 0x40, 0xf0, 0x0,
+    0xc0, 0x3f, 0xc6, 0xcc, 0x30, 0x1, 0x80, 0x7f,
+    0xb8, 0x60, 0x2, 0x60, 0x60, 0x6, 0x81, 0x0,
+    0x1c, 0xac, 0x40, 0x2f, 0x9, 0xde, 0x42, 0x50,
+    0x18, 0x45, 0x0, 0xc9, 0x86, 0x40, 0xd8, 0x0,
+    0x57, 0x90, 0xf, 0x1e, 0x7f, 0x48, 0x80, 0x0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x3a, 0xef, 0xec, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x74, 0x49, 0xfd, 0x10,
-    0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x3, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x9c, 0xff, 0x20, 0x0, 0x85, 0x10, 0x6, 0xff,
-    0x60, 0x1e, 0xfd, 0x0, 0x3f, 0xf2, 0x0, 0xef,
-    0xa0, 0x0, 0x4f, 0xf9, 0x9, 0xfd, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x7f, 0xf7, 0xff, 0x70, 0x5,
-    0xff, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf1, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x1, 0xef, 0xf6, 0x0,
-    0x2, 0xff, 0x90, 0x0, 0x0, 0x8f, 0xff, 0xa0,
-    0x0, 0xb, 0xff, 0xc6, 0x57, 0xef, 0xfd, 0xff,
-    0x50, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xf7, 0xb,
-    0xff, 0x20, 0x0, 0x7, 0xcf, 0xfd, 0x92, 0x0,
-    0x1e, 0xfc, 0x0,
+    0x0, 0xc7, 0x5d, 0xfd, 0x8c, 0x1, 0xfc, 0xb8,
+    0xa2, 0x2, 0x73, 0xa4, 0x1, 0xe1, 0xa0, 0x18,
+    0xbb, 0x30, 0x0, 0xc0, 0x3c, 0xe0, 0xd, 0x74,
+    0x44, 0xe7, 0x88, 0x7, 0xbc, 0x8, 0xc0, 0x31,
+    0x90, 0x7, 0xdc, 0x6, 0x1, 0xff, 0xc2, 0x40,
+    0x16, 0x0, 0xff, 0xe0, 0x9a, 0x84, 0x90, 0x7,
+    0xff, 0x6, 0xc4, 0x38, 0x3, 0xff, 0x82, 0x32,
+    0x7, 0x20, 0x1f, 0xfa, 0x20, 0x0, 0x65, 0x0,
+    0xff, 0x53, 0x83, 0x18, 0x51, 0x0, 0x50, 0xa2,
+    0x0, 0x65, 0x9, 0x96, 0x88, 0x78, 0x0, 0xde,
+    0x8c, 0x1, 0x0, 0xac, 0x3, 0x40, 0x52, 0x14,
+    0x4, 0x40, 0x31, 0x9, 0x0, 0x92, 0x1, 0x9d,
+    0x82, 0x80, 0xc, 0x0, 0x30, 0xc, 0xe8, 0x10,
+    0x0, 0x60, 0xe, 0x20, 0xe, 0xa1, 0x0, 0x48,
+    0x80, 0x1c, 0x1, 0x60, 0x1d, 0x22, 0x0, 0xc0,
+    0x8, 0x90, 0x1b, 0x19, 0x5f, 0x9c, 0x8, 0x15,
+    0x40, 0x15, 0x10, 0x1c, 0xd4, 0x8, 0x46, 0xa0,
+    0x51, 0x0, 0x7, 0x60, 0xc0, 0x4, 0xda, 0xe1,
+    0x42, 0x1c, 0x0,
 
     /* U+0027 "'" */
-    0xf, 0xfe, 0xf, 0xfd, 0xe, 0xfc, 0xd, 0xfb,
-    0xc, 0xfa, 0xc, 0xf9, 0x6, 0x95,
+    0xf, 0xf7, 0x0, 0x46, 0x2, 0x2, 0x6, 0xe,
+    0x2, 0x2, 0x1, 0x18, 0x53, 0x60,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x6, 0x80, 0x0, 0x0, 0x4f, 0xe1,
-    0x0, 0x1, 0xef, 0x50, 0x0, 0xb, 0xfa, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x4, 0xff, 0x40, 0x0, 0xa, 0xfe, 0x0, 0x0,
-    0xf, 0xfa, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x6f, 0xf4, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x9f, 0xf1, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0,
-    0x2f, 0xf8, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0,
-    0x8, 0xff, 0x10, 0x0, 0x1, 0xff, 0x70, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0xe, 0xf5, 0x0,
-    0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0x80,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x2, 0x30,
+    0x0, 0xe6, 0x80, 0xe, 0x49, 0x61, 0x0, 0x86,
+    0x82, 0xc4, 0x2, 0xa1, 0x55, 0x0, 0x48, 0x80,
+    0x90, 0xd, 0x20, 0x86, 0x1, 0x21, 0x7, 0x80,
+    0x6e, 0x1, 0x40, 0xc, 0xa0, 0x80, 0x18, 0xc0,
+    0x18, 0x1, 0x94, 0x0, 0x40, 0x1b, 0x80, 0xc,
+    0x1, 0x84, 0x0, 0x60, 0x18, 0x40, 0x6, 0x1,
+    0xbc, 0x0, 0x20, 0x18, 0x80, 0xc, 0x1, 0x9c,
+    0x1, 0xa0, 0x18, 0x88, 0x8, 0x1, 0xca, 0x6,
+    0x20, 0x1a, 0x40, 0xc, 0x1, 0x85, 0xc2, 0x40,
+    0x3a, 0x4, 0x4a, 0x1, 0xd0, 0x10, 0x1, 0xcc,
+    0xa5, 0x0, 0x1d, 0x44, 0xe2, 0x1, 0xdf, 0x82,
 
     /* U+0029 ")" */
-    0x19, 0x30, 0x0, 0x0, 0x2f, 0xe1, 0x0, 0x0,
-    0x8, 0xfc, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x6f, 0xf1, 0x0, 0x0, 0xe, 0xf9, 0x0,
-    0x0, 0x8, 0xff, 0x10, 0x0, 0x2, 0xff, 0x70,
-    0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0xaf, 0xf0,
-    0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x6f, 0xf5,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf5,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0xff, 0xa0,
-    0x0, 0x4, 0xff, 0x40, 0x0, 0xa, 0xfd, 0x0,
-    0x0, 0x2f, 0xf5, 0x0, 0x0, 0x9f, 0xb0, 0x0,
-    0x2, 0xff, 0x20, 0x0, 0xc, 0xf6, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x19, 0x30, 0xe, 0x36, 0xd1, 0x0, 0xc4, 0xe3,
+    0xa0, 0x1d, 0x4, 0x6e, 0x1, 0xd6, 0x10, 0x20,
+    0x19, 0x84, 0x20, 0x3, 0x98, 0x18, 0x40, 0x35,
+    0x0, 0x18, 0x3, 0x10, 0x85, 0x80, 0x72, 0x1,
+    0x80, 0x71, 0x0, 0xc, 0x3, 0x70, 0x1, 0x80,
+    0x31, 0x80, 0xc, 0x3, 0xe3, 0x0, 0xc6, 0x0,
+    0x10, 0xd, 0xe0, 0x6, 0x0, 0xca, 0x2, 0x40,
+    0x18, 0xc1, 0x0, 0x32, 0x0, 0x38, 0x3, 0x70,
+    0x12, 0x0, 0x44, 0xa1, 0x0, 0x1a, 0xc1, 0x14,
+    0x2, 0x26, 0x9, 0x0, 0xdc, 0x12, 0x40, 0x12,
+    0x1a, 0xb0, 0x6, 0x4a, 0xa0, 0x7, 0x0,
 
     /* U+002A "*" */
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x9, 0x40, 0x8f, 0x1, 0x75, 0x3f,
-    0xfd, 0xcf, 0xaf, 0xfa, 0x5, 0xae, 0xff, 0xfc,
-    0x83, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0, 0x4f,
-    0xd6, 0xfb, 0x0, 0x1, 0xef, 0x40, 0xcf, 0x80,
-    0x0, 0x6a, 0x0, 0x3b, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xd7, 0xe6, 0x1, 0xf0, 0x80, 0x80, 0x69,
+    0x40, 0x20, 0x21, 0x75, 0x36, 0xbd, 0x40, 0xae,
+    0x8f, 0x3a, 0x53, 0x30, 0x29, 0xbc, 0x82, 0xd4,
+    0x0, 0xb, 0x20, 0xc0, 0x9, 0x25, 0x25, 0x60,
+    0x10, 0xd0, 0x4b, 0x1a, 0x40, 0x0, 0x61, 0x50,
+    0x3d, 0x24, 0x2, 0x6a, 0x0, 0x1d, 0x88, 0x0,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x45, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x0, 0x5e, 0xee, 0xee, 0xff, 0xfe, 0xee,
-    0xec, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x30,
-    0x0, 0x0,
+    0x0, 0xf2, 0x28, 0x80, 0x7f, 0xdf, 0x44, 0x1,
+    0xff, 0xf1, 0x5e, 0xee, 0x40, 0xce, 0xed, 0x86,
+    0x23, 0xc0, 0x10, 0x8f, 0x37, 0xff, 0x20, 0x67,
+    0xfe, 0xd0, 0xf, 0xff, 0xd0,
 
     /* U+002C "," */
-    0xa, 0xcc, 0x80, 0xef, 0xfb, 0xe, 0xff, 0xb0,
-    0xef, 0xfb, 0x0, 0xff, 0x70, 0x5f, 0xe0, 0xa,
-    0xf7, 0x0, 0xff, 0x0, 0x18, 0x50, 0x0,
+    0xa, 0xcc, 0x40, 0x21, 0x9c, 0x1, 0xff, 0x70,
+    0x3, 0x1, 0x40, 0x5c, 0x3c, 0x24, 0x0, 0xa0,
+    0xe0, 0x2f, 0x40, 0x0,
 
     /* U+002D "-" */
-    0x3, 0x33, 0x33, 0x33, 0x32, 0x1f, 0xff, 0xff,
-    0xff, 0xf9, 0x1f, 0xff, 0xff, 0xff, 0xf9,
+    0x3, 0x3f, 0xc4, 0x39, 0x9f, 0xac, 0x3, 0xfc,
 
     /* U+002E "." */
-    0xbc, 0xc8, 0xef, 0xfa, 0xef, 0xfa, 0xef, 0xfa,
+    0xbc, 0xc4, 0x29, 0x98, 0x80, 0x3f, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0xb,
-    0xf3, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x7f, 0x40, 0x3e, 0x60, 0xa0, 0xf,
+    0xac, 0x14, 0x3, 0xc2, 0x64, 0x40, 0xf, 0x38,
+    0x28, 0x7, 0xd4, 0x14, 0x1, 0xe1, 0x32, 0x20,
+    0x7, 0x9c, 0x14, 0x3, 0xed, 0xb, 0x0, 0xf0,
+    0xa1, 0x18, 0x7, 0x9c, 0x14, 0x3, 0xed, 0xb,
+    0x0, 0xf0, 0xa0, 0x98, 0x7, 0x9c, 0x1c, 0x3,
+    0xed, 0xa, 0x0, 0xf9, 0x4, 0xc0, 0x3c, 0xa0,
+    0xe0, 0x1f, 0x78, 0x68, 0x7, 0xca, 0x28, 0x1,
+    0xe5, 0x7, 0x0, 0xfb, 0xc3, 0x40, 0x3e, 0x51,
+    0x40, 0xf, 0x28, 0x38, 0x7, 0xc0,
 
     /* U+0030 "0" */
-    0x0, 0x5, 0xbe, 0xfd, 0x91, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x9, 0xff, 0xb6,
-    0x57, 0xef, 0xf2, 0x2, 0xff, 0x90, 0x0, 0x2,
-    0xff, 0xa0, 0x6f, 0xf0, 0x0, 0x0, 0x2f, 0xfe,
-    0x8, 0xfd, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x9f,
-    0xc0, 0x0, 0x5, 0xff, 0xff, 0x19, 0xfc, 0x0,
-    0x0, 0xef, 0xaf, 0xf1, 0x9f, 0xc0, 0x0, 0x8f,
-    0xb4, 0xff, 0x19, 0xfc, 0x0, 0x2f, 0xf2, 0x4f,
-    0xf1, 0x9f, 0xc0, 0xc, 0xf8, 0x4, 0xff, 0x19,
-    0xfc, 0x6, 0xfe, 0x0, 0x4f, 0xf1, 0x9f, 0xc1,
-    0xef, 0x40, 0x4, 0xff, 0x19, 0xfc, 0x9f, 0xb0,
-    0x0, 0x4f, 0xf1, 0x9f, 0xff, 0xf2, 0x0, 0x4,
-    0xff, 0x18, 0xff, 0xf7, 0x0, 0x0, 0x5f, 0xf0,
-    0x6f, 0xfd, 0x0, 0x0, 0x8, 0xfe, 0x2, 0xff,
-    0x90, 0x0, 0x2, 0xff, 0xa0, 0x9, 0xff, 0xb5,
-    0x58, 0xff, 0xf2, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x5, 0xbe, 0xfd, 0x91, 0x0,
-    0x0,
+    0x0, 0x96, 0xfb, 0xf6, 0x44, 0x3, 0xae, 0x90,
+    0x40, 0x9b, 0x90, 0x2, 0x94, 0x4, 0x9a, 0x81,
+    0xb, 0x20, 0x26, 0x6, 0xb6, 0x57, 0xc0, 0x4,
+    0x2, 0x0, 0x24, 0x3, 0xe4, 0xe, 0x2, 0x0,
+    0xe9, 0x0, 0x8, 0x8, 0x8, 0x6, 0x54, 0x0,
+    0x84, 0x3, 0xeb, 0x5, 0x0, 0xfe, 0x81, 0x4e,
+    0x0, 0xfc, 0x4e, 0x12, 0x1, 0xfd, 0xc0, 0xe4,
+    0x1, 0xf9, 0x8c, 0x60, 0x3, 0xf0, 0xc0, 0x50,
+    0x7, 0xf4, 0xa, 0x20, 0x3, 0xf1, 0xb0, 0x48,
+    0x7, 0xc2, 0x1, 0x41, 0x0, 0x42, 0x0, 0x1e,
+    0x0, 0x13, 0x80, 0x6d, 0x1, 0x4, 0x0, 0x20,
+    0x6, 0x27, 0x4, 0x2, 0x60, 0x6b, 0x55, 0x46,
+    0x80, 0x20, 0x1, 0x28, 0x9, 0x54, 0x70, 0x5,
+    0x90, 0x5, 0x74, 0x82, 0x4, 0xdc, 0x80, 0x0,
 
     /* U+0031 "1" */
-    0x0, 0x3, 0xbf, 0xf8, 0x0, 0x0, 0x2, 0xaf,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xef, 0xf8,
-    0x0, 0x0, 0xcf, 0xf8, 0x1f, 0xf8, 0x0, 0x0,
-    0xb8, 0x10, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x46, 0x66, 0x6f, 0xfb,
-    0x66, 0x65, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x8e, 0xff, 0xd0, 0x1, 0xc5, 0x58, 0x80,
+    0x1f, 0x3e, 0xa8, 0x8, 0x7, 0xd6, 0x0, 0x7f,
+    0x0, 0xf9, 0xdd, 0xd0, 0x20, 0x1f, 0x5c, 0x8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0x23,
+    0x36, 0x0, 0x1b, 0x34, 0xb1, 0x33, 0x80, 0x9,
+    0x33, 0x50, 0x7, 0xfe,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x6c, 0xff, 0xd9, 0x20, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0xcf, 0xfa,
-    0x54, 0x8f, 0xff, 0x20, 0x5f, 0xf7, 0x0, 0x0,
-    0x6f, 0xf9, 0xb, 0xfe, 0x0, 0x0, 0x0, 0xef,
-    0xc0, 0x36, 0x50, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x96,
-    0x66, 0x66, 0x66, 0x40, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0,
+    0x0, 0xcd, 0x9f, 0xed, 0x92, 0x0, 0xc3, 0x92,
+    0x60, 0x2, 0x6d, 0x50, 0xb, 0x4c, 0x16, 0xad,
+    0xc0, 0x14, 0x40, 0xa6, 0x11, 0x4a, 0x91, 0x20,
+    0xb, 0xe, 0x1, 0x70, 0xc, 0xc2, 0xa, 0x11,
+    0x36, 0x1, 0xe3, 0x1, 0x3, 0x65, 0x0, 0xf1,
+    0x3, 0x0, 0x7f, 0x30, 0x3, 0x40, 0x3f, 0x14,
+    0x0, 0xb0, 0x7, 0xef, 0x10, 0xd0, 0xf, 0xd4,
+    0x41, 0x26, 0x1, 0xf3, 0x28, 0x2b, 0x0, 0x7c,
+    0x72, 0x5, 0x40, 0x1f, 0xe, 0x80, 0xf8, 0x7,
+    0xed, 0x10, 0xa2, 0x0, 0xfa, 0x4c, 0x21, 0x0,
+    0x3e, 0x66, 0x2, 0xb8, 0x7, 0xc7, 0x20, 0x54,
+    0x1, 0xfb, 0x40, 0x8, 0xcd, 0xf2, 0x0, 0x80,
+    0x1a, 0x67, 0xee, 0x0, 0xff, 0xe0, 0x80,
 
     /* U+0033 "3" */
-    0x0, 0x2, 0x9e, 0xfe, 0xb6, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x4, 0xff, 0xe7,
-    0x57, 0xef, 0xf8, 0x0, 0xcf, 0xd1, 0x0, 0x0,
-    0xdf, 0xf0, 0xc, 0xf4, 0x0, 0x0, 0x5, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0, 0x2, 0x35,
-    0xdf, 0xf5, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x2a, 0xc3, 0x0, 0x0, 0x2, 0xff, 0x71, 0xff,
-    0xb0, 0x0, 0x0, 0xbf, 0xf2, 0x9, 0xff, 0xd6,
-    0x46, 0xcf, 0xf8, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x5, 0xbe, 0xfe, 0xa4, 0x0,
-    0x0,
+    0x0, 0x8a, 0x7b, 0xfa, 0xd8, 0x3, 0x9b, 0x58,
+    0x40, 0x52, 0x6c, 0x2, 0x49, 0x1, 0x8a, 0x81,
+    0x4, 0x80, 0x4, 0x1, 0x7b, 0xab, 0xf1, 0x3,
+    0x80, 0x69, 0x10, 0xd, 0x0, 0x4, 0xc, 0xf4,
+    0x0, 0xe7, 0x0, 0x8, 0x7, 0xf3, 0x0, 0x18,
+    0x3, 0xfb, 0xc0, 0x4c, 0x3, 0x88, 0xd7, 0x50,
+    0x2c, 0x3, 0xdb, 0x94, 0x43, 0x4a, 0x1, 0xfe,
+    0x1c, 0x0, 0xfb, 0xfd, 0xae, 0xd, 0x40, 0x1f,
+    0x8a, 0x24, 0x14, 0xc0, 0x3f, 0x98, 0x42, 0xc0,
+    0x3f, 0xc4, 0x6, 0x1, 0xfe, 0x20, 0x12, 0xac,
+    0x30, 0xe, 0x21, 0xd, 0x35, 0x38, 0x0, 0xe9,
+    0x0, 0x28, 0xb0, 0x26, 0xb2, 0x36, 0x20, 0x39,
+    0x4, 0x98, 0x14, 0xdc, 0x98, 0x34, 0x0, 0x59,
+    0x48, 0x20, 0x2b, 0x72, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfe, 0x0, 0x4, 0x99, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x7, 0xff, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x7, 0xff, 0x0, 0x1, 0xff, 0x90, 0x0,
-    0x7, 0xff, 0x0, 0x9, 0xff, 0x20, 0x0, 0x7,
-    0xff, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x7, 0xff,
-    0x0, 0x7f, 0xf7, 0x55, 0x55, 0x5a, 0xff, 0x53,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0,
+    0x0, 0xfa, 0x7f, 0xc4, 0x1, 0xfc, 0x2c, 0xa,
+    0x40, 0x1f, 0xd2, 0x0, 0x90, 0xf, 0xf3, 0x1,
+    0x98, 0x3, 0xf9, 0x84, 0x20, 0x3, 0xfd, 0x60,
+    0x48, 0x1, 0xfc, 0xa4, 0x10, 0x1, 0xfe, 0x90,
+    0x15, 0x0, 0xfe, 0x43, 0x8, 0x0, 0xff, 0x78,
+    0xb, 0x0, 0x12, 0x64, 0x1, 0x8d, 0x1, 0x80,
+    0x23, 0x66, 0x0, 0x69, 0x0, 0x48, 0x7, 0xf0,
+    0xa8, 0x30, 0x80, 0x7f, 0x40, 0x2, 0xc0, 0x3f,
+    0x85, 0x81, 0x48, 0x3, 0xf9, 0x80, 0x1a, 0xab,
+    0xda, 0x0, 0x53, 0xf0, 0x4, 0x55, 0x72, 0x80,
+    0x2a, 0x0, 0x3f, 0xf8, 0x51, 0xff, 0xfa, 0x0,
+    0x1f, 0x60, 0x1f, 0xfd, 0x0,
 
     /* U+0035 "5" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f, 0xf6, 0x55,
-    0x55, 0x55, 0x53, 0x3, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf1, 0x1, 0x43, 0x0, 0x0, 0x3, 0xff, 0x5c,
-    0xff, 0xff, 0x90, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x3, 0xff, 0xf9, 0x10, 0x3d, 0xff,
-    0x60, 0x3f, 0xf8, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
-    0x7b, 0xa0, 0x0, 0x0, 0xc, 0xfc, 0x9, 0xff,
-    0x20, 0x0, 0x5, 0xff, 0x70, 0x2f, 0xfe, 0x73,
-    0x38, 0xff, 0xd0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x81, 0x0,
-    0x0,
+    0x3f, 0xff, 0xf5, 0x80, 0x7f, 0xf1, 0x66, 0xab,
+    0xe8, 0x0, 0xce, 0xab, 0xf1, 0x80, 0x7f, 0xf5,
+    0x5, 0xc, 0x3, 0xf2, 0x67, 0x5e, 0x7c, 0x80,
+    0x7a, 0x8c, 0x3, 0x35, 0x80, 0x79, 0xbb, 0xf0,
+    0x81, 0x18, 0x3, 0x3c, 0x88, 0x1e, 0x0, 0x28,
+    0xf, 0xfd, 0x0, 0x18, 0x54, 0xc, 0x3, 0xfd,
+    0x80, 0x1, 0x0, 0xfe, 0x30, 0xf, 0xfc, 0x60,
+    0x1f, 0xfb, 0x80, 0x2, 0xf7, 0x40, 0x1e, 0x40,
+    0x30, 0xe4, 0x52, 0x0, 0xca, 0x61, 0x61, 0x60,
+    0xc, 0x73, 0x34, 0x50, 0x13, 0x81, 0x48, 0xc,
+    0x66, 0x1c, 0x7, 0xc0, 0x26, 0xc5, 0x20, 0x1,
+    0x3f, 0x90, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x11,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xef, 0xfd, 0x60,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x90, 0x1,
-    0xff, 0xf7, 0x10, 0x4d, 0xff, 0x50, 0x6f, 0xf6,
-    0x0, 0x0, 0x2f, 0xfd, 0x9, 0xfe, 0x0, 0x0,
-    0x0, 0xaf, 0xf1, 0xbf, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0x2a, 0xfd, 0x0, 0x0, 0x0, 0x8f, 0xf1,
-    0x8f, 0xf1, 0x0, 0x0, 0xb, 0xff, 0x4, 0xff,
-    0x80, 0x0, 0x4, 0xff, 0xa0, 0xc, 0xff, 0xa4,
-    0x38, 0xff, 0xf2, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
-    0x0,
+    0x0, 0xf3, 0xff, 0x8c, 0x3, 0xfa, 0x41, 0x4c,
+    0x3, 0xf4, 0x8, 0x40, 0x7, 0xe1, 0x70, 0x52,
+    0x0, 0xfd, 0x20, 0x8, 0x0, 0xfc, 0x2e, 0xa,
+    0x40, 0x1f, 0xa0, 0x1, 0x0, 0x1f, 0x89, 0x81,
+    0x48, 0x3, 0xf4, 0x0, 0x20, 0x44, 0x1, 0xe2,
+    0x50, 0x6, 0x77, 0x35, 0x80, 0x34, 0x0, 0x42,
+    0x0, 0x29, 0x90, 0x0, 0x54, 0x1, 0x1d, 0xf6,
+    0x40, 0xca, 0xe, 0x0, 0x97, 0x10, 0x4f, 0x0,
+    0x40, 0x78, 0xb, 0x0, 0x62, 0x50, 0x21, 0x20,
+    0x20, 0xf, 0x68, 0x0, 0xc4, 0x4, 0x3, 0xde,
+    0x0, 0x32, 0x2, 0x10, 0xe, 0x30, 0x0, 0xe0,
+    0x2, 0x40, 0x32, 0x20, 0x14, 0x10, 0xc1, 0xe9,
+    0xe, 0x2c, 0x1, 0x0, 0xd, 0x20, 0x5b, 0xc7,
+    0x1, 0xb2, 0x0, 0xe, 0xc1, 0x80, 0x9, 0xfd,
+    0x0, 0x0,
 
     /* U+0037 "7" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x9f, 0xe7, 0x77,
-    0x77, 0x7d, 0xff, 0x9, 0xfd, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x9f, 0xd0, 0x0, 0x0, 0x7f, 0xf4,
-    0x5, 0x97, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0,
+    0x9f, 0xff, 0xf8, 0x40, 0x3f, 0xf8, 0x63, 0x11,
+    0xe2, 0x0, 0x8, 0x0, 0xdd, 0xf9, 0x88, 0x10,
+    0x3, 0xf9, 0x80, 0x1e, 0x18, 0xd4, 0x1, 0xd4,
+    0x2, 0x80, 0xb2, 0xe0, 0x18, 0xc8, 0x18, 0x3,
+    0xfa, 0x80, 0x14, 0x1, 0xfc, 0xc0, 0x84, 0x1,
+    0xf9, 0x80, 0x1c, 0x1, 0xfd, 0x40, 0x2a, 0x1,
+    0xf8, 0xcc, 0xe, 0x1, 0xfd, 0x40, 0xb, 0x0,
+    0xfe, 0x70, 0x32, 0x0, 0xfc, 0xa2, 0x14, 0x1,
+    0xfd, 0x20, 0x6, 0x0, 0xfc, 0x46, 0xc, 0x1,
+    0xfd, 0x40, 0xa, 0x0, 0xfe, 0x60, 0x23, 0x0,
+    0xfc, 0xa2, 0x16, 0x1, 0xfd, 0xc0, 0x7, 0x0,
+    0xf8,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x5b, 0xef, 0xd9, 0x20, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x9f,
-    0xfb, 0x53, 0x7f, 0xff, 0x30, 0x2, 0xff, 0x80,
-    0x0, 0x2, 0xef, 0xb0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x8f, 0xf0, 0x9, 0xfd, 0x0, 0x0, 0x0,
-    0x5f, 0xf1, 0x8, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x5, 0xff, 0x50, 0x0, 0x0, 0xdf, 0xc0,
-    0x0, 0xdf, 0xf8, 0x20, 0x4c, 0xff, 0x40, 0x0,
-    0x2c, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xcf, 0xf7,
-    0x21, 0x5d, 0xff, 0x50, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0xcf, 0xe0, 0xe, 0xf9, 0x0, 0x0, 0x0,
-    0x3f, 0xf5, 0xf, 0xf6, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0xe, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x9,
-    0xff, 0x40, 0x0, 0x0, 0xdf, 0xf1, 0x2, 0xef,
-    0xf8, 0x32, 0x5d, 0xff, 0x60, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x1, 0x8c, 0xff,
-    0xd9, 0x20, 0x0,
+    0x0, 0xcb, 0x7d, 0xfb, 0x24, 0x1, 0xeb, 0xa4,
+    0x10, 0x26, 0xd5, 0x0, 0xd2, 0x80, 0x95, 0x90,
+    0x0, 0xa3, 0x0, 0x13, 0x3, 0xda, 0x9b, 0xe8,
+    0x84, 0x0, 0x14, 0x1, 0x0, 0x18, 0x98, 0x10,
+    0x1, 0xc0, 0x40, 0x1e, 0xd0, 0x0, 0x80, 0x81,
+    0x80, 0x78, 0x80, 0x2, 0x1a, 0x2, 0xa0, 0x1d,
+    0x40, 0x60, 0x5, 0x20, 0xa8, 0x20, 0x4c, 0x20,
+    0x80, 0xb, 0xcc, 0x1f, 0x7e, 0xcc, 0x25, 0x0,
+    0x23, 0x70, 0xf, 0x8c, 0x3, 0x6a, 0x4, 0x6f,
+    0x51, 0x5, 0x28, 0x1, 0xcc, 0x31, 0xc8, 0x57,
+    0x4c, 0x2c, 0x1, 0x20, 0xc6, 0x1, 0xde, 0x2,
+    0xa0, 0x21, 0xe0, 0x1e, 0x30, 0x1, 0x8, 0x7,
+    0xff, 0x4, 0x44, 0x1a, 0x1, 0xe4, 0x0, 0x10,
+    0x38, 0x22, 0x0, 0x3a, 0x40, 0x8, 0x16, 0x21,
+    0x70, 0x64, 0xba, 0x41, 0x22, 0x5, 0xa2, 0xf,
+    0x9b, 0x44, 0x10, 0xc0, 0x11, 0xfb, 0x98, 0x0,
+    0x9b, 0x5c, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x5, 0xbf, 0xfd, 0x81, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xa, 0xff, 0xa4,
-    0x37, 0xef, 0xf2, 0x2, 0xff, 0x90, 0x0, 0x2,
-    0xff, 0xb0, 0x7f, 0xf1, 0x0, 0x0, 0x9, 0xff,
-    0xa, 0xfd, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0xbf,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0x2a, 0xff, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x6f, 0xf6, 0x0, 0x0,
-    0x1e, 0xfd, 0x0, 0xef, 0xf7, 0x10, 0x3d, 0xff,
-    0x70, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x2, 0x9e, 0xfe, 0xcf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0x96, 0xff, 0xdb, 0x2, 0x1, 0xd7, 0x48,
+    0x0, 0x27, 0xe4, 0x0, 0xa9, 0x1, 0x6f, 0x20,
+    0x42, 0xc8, 0x9, 0x41, 0xa9, 0xd, 0xf0, 0x1,
+    0x20, 0xa0, 0x8, 0x0, 0xc4, 0xc0, 0x81, 0xa0,
+    0x42, 0x1, 0xde, 0x0, 0x21, 0x1, 0x0, 0xf1,
+    0x80, 0x42, 0x6, 0x1, 0xe2, 0x0, 0x1e, 0x0,
+    0x18, 0x3, 0xc, 0x81, 0xb, 0x8, 0x4b, 0x88,
+    0x1e, 0x8, 0x50, 0x3, 0x40, 0x11, 0xdf, 0x84,
+    0x0, 0x60, 0x1, 0xeb, 0x8, 0x9, 0x80, 0x20,
+    0x40, 0x22, 0x9e, 0xfe, 0x0, 0xb, 0x80, 0x7e,
+    0x43, 0x9, 0x0, 0xfe, 0x80, 0x17, 0x0, 0xfc,
+    0xa6, 0x10, 0x1, 0xfd, 0x0, 0x2c, 0x1, 0xf9,
+    0x48, 0x20, 0x3, 0xfa, 0x0, 0x98, 0x3, 0xf2,
+    0x90, 0x40, 0x7, 0xf4, 0x1, 0x28, 0x7, 0x80,
 
     /* U+003A ":" */
-    0x5f, 0xfc, 0x5f, 0xfc, 0x5f, 0xfc, 0x15, 0x54,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0x54, 0x5f, 0xfc, 0x5f, 0xfc, 0x5f, 0xfc,
+    0x5f, 0xf6, 0x0, 0x7e, 0x4a, 0xa4, 0xa, 0xa9,
+    0x0, 0x3f, 0xf0, 0xaa, 0x91, 0x15, 0x48, 0x0,
+    0xfc,
 
     /* U+003B ";" */
-    0x4f, 0xfd, 0x4f, 0xfd, 0x4f, 0xfd, 0x15, 0x54,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0x54, 0x4f, 0xfd, 0x4f, 0xfd, 0x4f, 0xfd,
-    0x8, 0xf9, 0xd, 0xf1, 0x1f, 0xa0, 0x28, 0x20,
+    0x4f, 0xf6, 0x80, 0x7e, 0x5a, 0xa4, 0x8a, 0xa9,
+    0x0, 0x3f, 0xf0, 0xaa, 0x91, 0x6a, 0x92, 0x1,
+    0xf9, 0x1c, 0x10, 0x14, 0x20, 0x49, 0x44, 0xde,
+    0x0,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xf5, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xfb, 0x20, 0x0, 0x0, 0x6e, 0xff,
-    0xb3, 0x0, 0x0, 0x6, 0xef, 0xfb, 0x30, 0x0,
-    0x0, 0x6e, 0xff, 0xb3, 0x0, 0x0, 0x0, 0xcf,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xbf, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3b, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0x98, 0xc0, 0x3f, 0x9b, 0x65, 0x80,
+    0x3e, 0x6e, 0x92, 0x47, 0x0, 0xe6, 0xe9, 0x14,
+    0xcb, 0x20, 0x9, 0xba, 0x45, 0x32, 0xcc, 0x2,
+    0x6e, 0x91, 0x4c, 0xb3, 0x0, 0xd9, 0x22, 0x99,
+    0x66, 0x1, 0xe2, 0x1, 0xe3, 0x0, 0xfd, 0xa8,
+    0x35, 0xac, 0x1, 0xf1, 0xde, 0x21, 0x4e, 0xb0,
+    0x7, 0xc7, 0x78, 0x85, 0x3c, 0xc0, 0x1f, 0x1d,
+    0xe2, 0xc, 0xf3, 0x0, 0x7c, 0x77, 0x88, 0x32,
+    0xa0, 0x1f, 0x8e, 0xf1, 0x0, 0x3f, 0xe3, 0xb5,
 
     /* U+003D "=" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x6f, 0xff, 0xfd, 0xa0, 0x1f, 0xfc, 0x26, 0xff,
+    0xff, 0xda, 0x1, 0xff, 0xde, 0x6f, 0xff, 0xfd,
+    0xa0, 0x1f, 0xfc, 0x20,
 
     /* U+003E ">" */
-    0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaf, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xfc, 0x40, 0x0, 0x0, 0x5d, 0xff, 0xc4,
-    0x0, 0x0, 0x6, 0xdf, 0xfc, 0x40, 0x0, 0x0,
-    0x6d, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x4, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x36, 0x0, 0xff, 0x9e, 0x79, 0x80, 0x3f, 0x95,
+    0x6, 0x79, 0xc0, 0x3e, 0x1b, 0xc4, 0x18, 0xe7,
+    0x0, 0xf8, 0xef, 0x14, 0x63, 0x9c, 0x3, 0xe3,
+    0xad, 0x51, 0x8e, 0x70, 0xf, 0x8a, 0xb5, 0x46,
+    0x34, 0x3, 0xf1, 0x78, 0x81, 0x0, 0x7c, 0xbb,
+    0x42, 0x76, 0x1, 0xcb, 0xb4, 0x47, 0x78, 0x80,
+    0x13, 0x6d, 0x11, 0xde, 0x20, 0x4, 0xdb, 0x24,
+    0x77, 0x88, 0x1, 0x92, 0x49, 0x33, 0x8, 0x1,
+    0xf2, 0x65, 0x98, 0x7, 0xe4, 0xb3, 0x0, 0xff,
+    0x0,
 
     /* U+003F "?" */
-    0x0, 0x3, 0xae, 0xfe, 0xb5, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x8, 0xff, 0xe9,
-    0x7a, 0xff, 0xf9, 0x2, 0xff, 0xd1, 0x0, 0x3,
-    0xef, 0xf1, 0x9f, 0xf3, 0x0, 0x0, 0x8, 0xff,
-    0x5b, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
-    0x10, 0x0, 0x0, 0x6, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x2f, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x67, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0,
-    0x0,
+    0x0, 0x8e, 0xbb, 0xfa, 0xd4, 0x3, 0xa3, 0x14,
+    0x40, 0x52, 0xa8, 0x1, 0x43, 0x80, 0xb4, 0x28,
+    0x1, 0x64, 0x9, 0xc0, 0xbe, 0x5e, 0xb0, 0x41,
+    0x86, 0xc0, 0x1c, 0x20, 0x11, 0xb0, 0x1, 0x8,
+    0xc, 0xc0, 0x1d, 0xa0, 0x3, 0xbf, 0xd0, 0xf,
+    0x18, 0x0, 0xc0, 0x2, 0x1, 0xeb, 0x0, 0x28,
+    0x7, 0xe9, 0x20, 0x70, 0xf, 0xce, 0xc0, 0x70,
+    0x1, 0xf3, 0x40, 0x1e, 0x80, 0x7c, 0x52, 0x5,
+    0xa2, 0x1, 0xf5, 0x80, 0x24, 0x40, 0x3f, 0x28,
+    0xa, 0x0, 0x7f, 0xc6, 0x1, 0xfe, 0xa8, 0xb0,
+    0xf, 0xf3, 0x3b, 0x0, 0x7f, 0xf2, 0xf7, 0xf0,
+    0x3, 0xfc, 0x60, 0x20, 0x1f, 0xfc, 0x60,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x6b, 0xef, 0xea, 0x30, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xed, 0xff, 0xf7, 0x0,
-    0x0, 0x3, 0xff, 0x92, 0x0, 0x5, 0xef, 0x50,
-    0x0, 0x1e, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x7, 0xf9, 0x0, 0xaf, 0xe8, 0xbf, 0x11, 0xfc,
-    0xd, 0xf4, 0xb, 0xfe, 0xef, 0xff, 0x0, 0xfe,
-    0xf, 0xf0, 0x5f, 0xa0, 0xa, 0xfe, 0x0, 0xfe,
-    0x3f, 0xc0, 0xcf, 0x10, 0x3, 0xfc, 0x0, 0xfe,
-    0x6f, 0xa0, 0xfd, 0x0, 0x2, 0xfb, 0x0, 0xfe,
-    0x7f, 0x81, 0xfb, 0x0, 0x3, 0xf9, 0x1, 0xfc,
-    0x8f, 0x82, 0xfa, 0x0, 0x5, 0xf8, 0x3, 0xf9,
-    0x9f, 0x71, 0xfc, 0x0, 0xa, 0xf7, 0x7, 0xf5,
-    0x8f, 0x70, 0xef, 0x30, 0x4f, 0xf9, 0xd, 0xf0,
-    0x7f, 0x90, 0x9f, 0xfe, 0xfa, 0xff, 0xff, 0x60,
-    0x4f, 0xc0, 0x9, 0xfe, 0x90, 0x7f, 0xe6, 0x0,
-    0xf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xc4, 0x0, 0x2, 0x6c, 0x20, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x6b, 0xef, 0xfd, 0x94, 0x0, 0x0,
+    0x0, 0xf3, 0x5f, 0x7f, 0x51, 0x80, 0x7c, 0x5b,
+    0x28, 0x4, 0x2b, 0x8e, 0x1, 0xc7, 0xa4, 0xdb,
+    0xdb, 0xf4, 0x30, 0xa0, 0x10, 0xe8, 0x4c, 0x88,
+    0x2, 0x5d, 0xb, 0x0, 0xa0, 0x59, 0x80, 0x1e,
+    0x35, 0x14, 0x2, 0x60, 0x80, 0xf, 0xde, 0x1a,
+    0xa, 0xc, 0x21, 0x5f, 0xd1, 0x7e, 0x28, 0xa,
+    0x14, 0x1a, 0x16, 0xa2, 0xe, 0x80, 0x22, 0x2,
+    0x2, 0x4, 0x54, 0x5e, 0xe2, 0x80, 0x80, 0x63,
+    0x3, 0x9, 0xb, 0x0, 0x48, 0x10, 0x6, 0x50,
+    0x60, 0x32, 0x10, 0x0, 0x83, 0x80, 0x61, 0x2,
+    0x10, 0x60, 0x8, 0x40, 0x80, 0x40, 0xbc, 0x0,
+    0x60, 0x20, 0x13, 0x0, 0x81, 0x2, 0x88, 0x79,
+    0x83, 0x0, 0x5e, 0x1e, 0x8, 0x18, 0x20, 0x1,
+    0x11, 0x98, 0x11, 0x43, 0x82, 0x81, 0x7c, 0x38,
+    0x1c, 0x33, 0xad, 0x41, 0xbc, 0xa4, 0xc, 0x14,
+    0x25, 0x80, 0xd, 0x50, 0x3, 0x2c, 0x8, 0x6,
+    0x41, 0x3f, 0xd2, 0xf, 0xfc, 0xc0, 0x12, 0x87,
+    0x0, 0x7f, 0xf0, 0x6c, 0x4f, 0x10, 0x2, 0x26,
+    0xc2, 0x0, 0xc3, 0x82, 0x77, 0xff, 0x6c, 0x9a,
+    0x0, 0x71, 0x74, 0xa0, 0x80, 0x9, 0xad, 0x80,
+    0x20,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x8f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa3, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0xe,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x10,
-    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0xc0,
-    0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x30, 0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0xdf,
-    0xe0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xf9, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x7,
-    0xff, 0x73, 0x33, 0x33, 0xff, 0xe0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x6, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xd0, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x20,
+    0x0, 0xf2, 0xff, 0xb4, 0x3, 0xff, 0x83, 0xe0,
+    0x2, 0x20, 0x7, 0xfe, 0x50, 0x9, 0x40, 0x3f,
+    0xe4, 0x0, 0x8, 0x58, 0x7, 0xfd, 0xa0, 0x2c,
+    0x6, 0x20, 0x1f, 0xe7, 0x4, 0xb0, 0x3, 0x80,
+    0x7f, 0x20, 0x87, 0x98, 0x86, 0x80, 0x7f, 0x68,
+    0x1, 0x1, 0x1, 0x4, 0x3, 0xf3, 0x81, 0x88,
+    0x78, 0x1, 0x0, 0x3e, 0x31, 0xb, 0x0, 0x20,
+    0x3, 0xc0, 0x3e, 0xb0, 0x2, 0x0, 0x4, 0xc1,
+    0x40, 0x3e, 0x50, 0x13, 0x0, 0xac, 0x0, 0x80,
+    0x1c, 0x44, 0x7, 0x0, 0xc8, 0x0, 0xd0, 0xe,
+    0x50, 0x7, 0x19, 0xe0, 0x9, 0xc0, 0x3a, 0xc0,
+    0x11, 0x99, 0xc0, 0x1, 0x30, 0x8, 0x8c, 0x3,
+    0xfe, 0xa0, 0x9, 0x40, 0x15, 0xff, 0xf0, 0x1,
+    0xc0, 0x2b, 0x0, 0x28, 0x7, 0xca, 0x2, 0x60,
+    0x26, 0xa, 0x1, 0xfb, 0xc0, 0x16, 0xe, 0x0,
+    0xf0, 0xf, 0xca, 0x0, 0x50, 0xd0, 0x2, 0x80,
+    0x7f, 0x28, 0x11, 0x0,
 
     /* U+0042 "B" */
-    0xbf, 0xff, 0xff, 0xff, 0xfd, 0xa4, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xbf,
-    0xf5, 0x55, 0x55, 0x6a, 0xff, 0xf6, 0xb, 0xff,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0xbf, 0xf0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x1b, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf1, 0xbf, 0xf0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xb, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0xbf, 0xf0, 0x0, 0x0,
-    0x16, 0xef, 0xe1, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa2, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x40, 0xb, 0xff, 0x44, 0x44, 0x44, 0x7e,
-    0xff, 0x50, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x1d,
-    0xfe, 0xb, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf5, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x8b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x7b,
-    0xff, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf2, 0xbf,
-    0xf6, 0x66, 0x66, 0x79, 0xff, 0xf9, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0xbf, 0xff, 0xdb, 0x48, 0x1, 0xff, 0x89, 0x6e,
+    0x40, 0x3a, 0xab, 0xa5, 0x40, 0xc, 0xc0, 0xc,
+    0xab, 0xcd, 0x56, 0x0, 0xb0, 0xf, 0xf9, 0x10,
+    0x4, 0x20, 0x1f, 0xf1, 0x80, 0x7f, 0xf0, 0x84,
+    0x0, 0x20, 0x1f, 0xe1, 0x60, 0x50, 0xf, 0xe1,
+    0x6f, 0x1, 0xb0, 0xd, 0xff, 0xdd, 0x22, 0xb8,
+    0x20, 0x1f, 0xf9, 0x98, 0x1, 0xd7, 0x7e, 0x81,
+    0x3b, 0x50, 0xc, 0x89, 0xe7, 0xf2, 0xb, 0x0,
+    0xff, 0x86, 0x0, 0x54, 0x3, 0xfe, 0x40, 0x6,
+    0x80, 0x7f, 0xf0, 0x84, 0x3, 0xfe, 0x70, 0x7,
+    0x0, 0x7f, 0x8a, 0x0, 0xa, 0x1, 0x33, 0x73,
+    0xce, 0x88, 0x31, 0x0, 0x53, 0x3d, 0xc, 0x0,
+    0x49, 0x0, 0xff, 0x8e, 0xac, 0x0,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x5a, 0xef, 0xfd, 0x82, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xcf, 0xff, 0xb9, 0xad, 0xff, 0xf6, 0x0, 0x7f,
-    0xfd, 0x20, 0x0, 0x6, 0xff, 0xf1, 0xe, 0xff,
-    0x10, 0x0, 0x0, 0x7, 0xfd, 0x33, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x4, 0x0, 0x6f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5, 0x10,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x3, 0xff, 0x70,
-    0x7f, 0xfd, 0x20, 0x0, 0x4, 0xef, 0xf6, 0x0,
-    0xcf, 0xff, 0xb8, 0x9c, 0xff, 0xfb, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x5a, 0xef, 0xfd, 0x93, 0x0, 0x0,
+    0x0, 0xcb, 0x5d, 0xfe, 0xd8, 0x20, 0xe, 0x1c,
+    0xa5, 0x10, 0x1, 0x3e, 0xb0, 0x6, 0xd3, 0x0,
+    0x23, 0x29, 0x0, 0x25, 0x80, 0xe, 0x60, 0x5b,
+    0x73, 0x5b, 0x20, 0x9, 0x10, 0x90, 0x6, 0x10,
+    0x6, 0x68, 0x2, 0x21, 0x88, 0x38, 0x80, 0x79,
+    0xef, 0x4d, 0x40, 0x16, 0x1, 0xf9, 0x0, 0x2,
+    0x0, 0x10, 0xf, 0xfb, 0xc0, 0x6, 0x1, 0xff,
+    0xfb, 0xf0, 0x1, 0x80, 0x7f, 0xc2, 0x0, 0x60,
+    0xf, 0xf9, 0x40, 0x18, 0x1, 0xf9, 0x44, 0xc,
+    0x41, 0xc8, 0x3, 0xc7, 0x5c, 0xe1, 0x20, 0xf,
+    0x20, 0xc, 0x9a, 0x0, 0x10, 0x73, 0x2, 0xdb,
+    0x89, 0xcb, 0x10, 0x46, 0x0, 0x6a, 0x0, 0x11,
+    0xd8, 0xc0, 0xb, 0x60, 0x10, 0xdd, 0x28, 0x80,
+    0x9, 0xb2, 0x80, 0x0,
 
     /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xff, 0xdb, 0x50, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0xdf,
-    0xe7, 0x77, 0x77, 0xae, 0xff, 0xf3, 0xd, 0xfd,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xd0, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x5d, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf9, 0xdf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xbd, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfd, 0xdf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xed, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0xdf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xed, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfe, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xed, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfc, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xbd, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x4d,
-    0xfd, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0xdf,
-    0xe6, 0x66, 0x67, 0x9e, 0xff, 0xf2, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xda, 0x50, 0x0, 0x0,
+    0xdf, 0xff, 0xb6, 0xd4, 0x3, 0xff, 0x12, 0x57,
+    0x18, 0x6, 0x18, 0x8e, 0x51, 0x1, 0xc3, 0x0,
+    0x8d, 0xdf, 0xab, 0x98, 0x1, 0xc0, 0x1f, 0xf4,
+    0xa0, 0x12, 0x80, 0x7f, 0xd0, 0x0, 0xc0, 0xf,
+    0xf8, 0xc4, 0x8, 0x3, 0xff, 0x10, 0x30, 0x7,
+    0xfe, 0x70, 0x30, 0xf, 0xff, 0xe3, 0x81, 0x0,
+    0x7f, 0xe2, 0x7, 0x0, 0xff, 0x88, 0x40, 0xc0,
+    0x3f, 0xe8, 0x0, 0x60, 0x7, 0xfa, 0x14, 0x9,
+    0x0, 0x6, 0xcd, 0x9e, 0x79, 0xc0, 0x1e, 0x1,
+    0xc, 0xce, 0x86, 0x10, 0x2c, 0x20, 0xf, 0xe2,
+    0x5a, 0xd3, 0x0, 0x0,
 
     /* U+0045 "E" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xf,
-    0xfc, 0x77, 0x77, 0x77, 0x77, 0x75, 0x0, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xff, 0xb4, 0x44, 0x44, 0x44,
-    0x43, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x20, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0xf, 0xff, 0xfd, 0x60, 0x1f, 0xfc, 0x73, 0x88,
+    0xfe, 0xe0, 0xc, 0xae, 0xff, 0xca, 0x1, 0xff,
+    0xff, 0x0, 0xcd, 0xff, 0xfa, 0x80, 0x3f, 0xf9,
+    0x9, 0x77, 0xfa, 0x40, 0x38, 0x91, 0x3f, 0x18,
+    0x7, 0xff, 0xfc, 0x3, 0x95, 0x9b, 0xfc, 0x40,
+    0x11, 0xcc, 0xff, 0x9c, 0x3, 0xff, 0x86,
 
     /* U+0046 "F" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xf8,
-    0x77, 0x77, 0x77, 0x77, 0x73, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf7, 0x55, 0x55, 0x55, 0x55, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfc, 0xe0, 0x1f, 0xfc, 0x57, 0x88,
+    0xfe, 0x40, 0xa, 0xdd, 0xff, 0x8c, 0x3, 0xff,
+    0xfa, 0x8a, 0xbf, 0x80, 0x3a, 0x2a, 0xbf, 0x8,
+    0x7, 0xff, 0x1b, 0x3f, 0xff, 0x8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xb4,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x8f, 0xff, 0xb8, 0x8a, 0xff, 0xff, 0x30,
-    0x3, 0xff, 0xe3, 0x0, 0x0, 0x1a, 0xff, 0xd0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xa1,
-    0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf6, 0x0, 0x0, 0x26, 0x66, 0x66, 0x64,
-    0x3f, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xf2,
-    0x4, 0xff, 0xe3, 0x0, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x9f, 0xff, 0xb8, 0x79, 0xef, 0xfe, 0x10,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+    0x0, 0xc5, 0x3b, 0xfe, 0xeb, 0x50, 0xf, 0xa3,
+    0x58, 0x80, 0x2, 0x95, 0xa6, 0x1, 0xa1, 0xc0,
+    0x8, 0xee, 0x50, 0x1, 0x61, 0x80, 0xd, 0xc0,
+    0x72, 0xe2, 0x15, 0xca, 0x0, 0xe0, 0x4, 0x0,
+    0x28, 0xc0, 0x30, 0xd2, 0x83, 0x88, 0x20, 0x1a,
+    0x0, 0x7d, 0x7b, 0x42, 0x40, 0x4, 0x0, 0xfc,
+    0x24, 0x1, 0xde, 0x1, 0xff, 0x84, 0x0, 0x20,
+    0x1f, 0xfc, 0x82, 0x66, 0xf2, 0x0, 0x7e, 0x49,
+    0x9f, 0x70, 0x7, 0xff, 0x31, 0xbf, 0xf0, 0x4,
+    0x20, 0x1, 0x0, 0xff, 0xc6, 0x0, 0xf0, 0xf,
+    0xc2, 0x0, 0x31, 0x0, 0x20, 0x7, 0xe5, 0x0,
+    0x78, 0x20, 0x1a, 0x0, 0x7d, 0x0, 0x4, 0xf,
+    0x0, 0x51, 0x80, 0x74, 0x98, 0x29, 0x2, 0x30,
+    0xe, 0x5c, 0x3c, 0xf3, 0x0, 0xd8, 0x5, 0x2c,
+    0x0, 0x47, 0x86, 0x10, 0x2c, 0x10, 0xd, 0x38,
+    0xc4, 0x0, 0x14, 0x9d, 0x20, 0x0,
 
     /* U+0048 "H" */
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xfb, 0x44, 0x44, 0x44, 0x44, 0x6f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0xf, 0xf5, 0x0, 0x7e, 0x2f, 0xf4, 0x0, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfd, 0x8b, 0xff, 0xfb, 0x40,
+    0x3f, 0xf9, 0x49, 0x77, 0xfa, 0x40, 0x3c, 0x28,
+    0x9f, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x60,
 
     /* U+0049 "I" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x5, 0x55, 0x7f, 0xfa,
-    0x55, 0x53, 0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x5, 0x55, 0x7f, 0xfa,
-    0x55, 0x54, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x1f, 0xff, 0xf5, 0x80, 0x7f, 0xe1, 0xaa, 0xa0,
+    0x0, 0xb5, 0x54, 0x2, 0xae, 0x0, 0x6a, 0xac,
+    0x60, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x1d, 0x57, 0x0, 0x35, 0x56, 0x41, 0xaa,
+    0xa0, 0x0, 0xb5, 0x57, 0x80, 0x7f, 0xe0,
 
     /* U+004A "J" */
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x1, 0x55, 0x55,
-    0x55, 0x5a, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x3d,
-    0x40, 0x0, 0x8, 0xff, 0xa0, 0x1e, 0xff, 0xc8,
-    0x9d, 0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x3a, 0xef, 0xfd, 0x81, 0x0,
-    0x0,
+    0x3, 0xff, 0xff, 0x18, 0x7, 0xff, 0x8, 0xaa,
+    0xbe, 0x50, 0xc, 0x2a, 0xbf, 0x68, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xf4, 0x20, 0x1f, 0xde, 0x0,
+    0x30, 0xf, 0xe5, 0x0, 0x8, 0x1e, 0xa0, 0x6,
+    0x82, 0x5, 0x1, 0xd2, 0xbc, 0x89, 0xd7, 0x0,
+    0x40, 0xb, 0x80, 0xd, 0xd8, 0x80, 0x14, 0x40,
+    0x9, 0xc5, 0x10, 0x1, 0x3f, 0x28, 0x0,
 
     /* U+004B "K" */
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0,
-    0xcf, 0xe0, 0x0, 0x0, 0x5, 0xff, 0x90, 0x0,
-    0xcf, 0xe0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0,
-    0xcf, 0xe0, 0x0, 0x0, 0xdf, 0xe2, 0x0, 0x0,
-    0xcf, 0xe0, 0x0, 0xa, 0xff, 0x40, 0x0, 0x0,
-    0xcf, 0xe0, 0x0, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0xcf, 0xe0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0xe0, 0x1d, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xcf, 0xe0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xcf, 0xe7, 0xff, 0x9f, 0xfb, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfb, 0x8, 0xff, 0x40, 0x0, 0x0,
-    0xcf, 0xff, 0xe1, 0x1, 0xff, 0xd0, 0x0, 0x0,
-    0xcf, 0xff, 0x30, 0x0, 0x7f, 0xf5, 0x0, 0x0,
-    0xcf, 0xf6, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0,
-    0xcf, 0xd0, 0x0, 0x0, 0x6, 0xff, 0x70, 0x0,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0xdf, 0xe1, 0x0,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
+    0xcf, 0xe0, 0xf, 0xd9, 0xfe, 0x20, 0xf, 0xfa,
+    0xc, 0x28, 0x80, 0x3f, 0xca, 0xe0, 0xca, 0x1,
+    0xfe, 0x2a, 0x3, 0x90, 0xf, 0xfb, 0xc0, 0x78,
+    0x3, 0xfe, 0xa2, 0xa, 0x20, 0xf, 0xf3, 0x28,
+    0x3a, 0x0, 0x7f, 0x8e, 0x40, 0xe0, 0x3, 0xfc,
+    0x3c, 0x0, 0x60, 0xf, 0xfa, 0x88, 0x0, 0xa6,
+    0x1, 0xfc, 0xe8, 0xc, 0x0, 0x80, 0xf, 0xc3,
+    0x0, 0x92, 0xe0, 0x88, 0x0, 0xfe, 0x1a, 0x9,
+    0x0, 0x48, 0x7, 0xf6, 0x88, 0xc, 0x1, 0x28,
+    0x7, 0xd2, 0x60, 0x13, 0x88, 0x58, 0x7, 0x89,
+    0x80, 0x3a, 0x0, 0x5c, 0x3, 0xff, 0x31, 0x4,
+    0x88, 0x7, 0xfe, 0x80, 0x19, 0x0, 0xff, 0xca,
+    0x40, 0xe2, 0x1, 0xff, 0xa4, 0x1, 0x0, 0x1f,
+    0xf9, 0xc, 0x18, 0x80,
 
     /* U+004C "L" */
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc6, 0x66,
-    0x66, 0x66, 0x66, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0,
+    0xff, 0x50, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xfc, 0xcd, 0xff, 0x0,
+    0xe, 0x67, 0xfa, 0x0, 0x3f, 0xf8, 0x20,
 
     /* U+004D "M" */
-    0xef, 0xf1, 0x0, 0x0, 0x0, 0x8, 0xff, 0x6e,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xef, 0xf6, 0xef,
-    0xfe, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x6e, 0xff,
-    0xf4, 0x0, 0x0, 0xa, 0xff, 0xf6, 0xef, 0xff,
-    0xa0, 0x0, 0x1, 0xff, 0xff, 0x6e, 0xff, 0xff,
-    0x10, 0x0, 0x7f, 0xff, 0xf6, 0xef, 0xcd, 0xf7,
-    0x0, 0xd, 0xfa, 0xff, 0x6e, 0xfc, 0x7f, 0xd0,
-    0x3, 0xff, 0x4f, 0xf6, 0xef, 0xc1, 0xff, 0x30,
-    0x9f, 0xa3, 0xff, 0x6e, 0xfc, 0xb, 0xfa, 0xf,
-    0xf4, 0x3f, 0xf6, 0xef, 0xc0, 0x5f, 0xf6, 0xfd,
-    0x3, 0xff, 0x6e, 0xfc, 0x0, 0xef, 0xff, 0x70,
-    0x3f, 0xf6, 0xef, 0xc0, 0x8, 0xff, 0xf1, 0x3,
-    0xff, 0x6e, 0xfc, 0x0, 0x2f, 0xfb, 0x0, 0x3f,
-    0xf6, 0xef, 0xc0, 0x0, 0x23, 0x10, 0x3, 0xff,
-    0x6e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x6e,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x6e, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x60,
+    0xef, 0xf0, 0x80, 0x7d, 0x1f, 0xe6, 0x0, 0x98,
+    0x3, 0xe6, 0x0, 0xf4, 0x80, 0x79, 0x4, 0x3,
+    0xc2, 0x80, 0x1d, 0xc0, 0x1f, 0xb8, 0x3, 0xa,
+    0x80, 0x7e, 0x51, 0x0, 0x98, 0x3, 0xe3, 0x20,
+    0x60, 0xa, 0x81, 0x40, 0x3d, 0x41, 0x40, 0x3,
+    0x20, 0xe0, 0xf, 0x30, 0x11, 0x85, 0x2, 0xb8,
+    0x7, 0x85, 0x2, 0x41, 0x83, 0x80, 0x3f, 0x70,
+    0x2b, 0x1, 0x20, 0x7, 0xe5, 0x10, 0x90, 0xa0,
+    0xf, 0xf3, 0x0, 0x4c, 0x1, 0xfe, 0xa0, 0x2,
+    0x8, 0x7, 0xf8, 0xb7, 0x28, 0x3, 0xff, 0x11,
+    0x88, 0x7, 0xff, 0xfc, 0x3, 0xc0,
 
     /* U+004E "N" */
-    0x6f, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x6f,
-    0xff, 0x10, 0x0, 0x0, 0xb, 0xfe, 0x6f, 0xff,
-    0x90, 0x0, 0x0, 0xb, 0xfe, 0x6f, 0xff, 0xf1,
-    0x0, 0x0, 0xb, 0xfe, 0x6f, 0xff, 0xf9, 0x0,
-    0x0, 0xb, 0xfe, 0x6f, 0xfe, 0xff, 0x10, 0x0,
-    0xb, 0xfe, 0x6f, 0xf6, 0xff, 0x90, 0x0, 0xb,
-    0xfe, 0x6f, 0xf4, 0xaf, 0xf1, 0x0, 0xb, 0xfe,
-    0x6f, 0xf4, 0x2f, 0xf9, 0x0, 0xb, 0xfe, 0x6f,
-    0xf4, 0x9, 0xff, 0x20, 0xb, 0xfe, 0x6f, 0xf4,
-    0x2, 0xff, 0x90, 0xb, 0xfe, 0x6f, 0xf4, 0x0,
-    0x9f, 0xf2, 0xb, 0xfe, 0x6f, 0xf4, 0x0, 0x1f,
-    0xf9, 0xb, 0xfe, 0x6f, 0xf4, 0x0, 0x9, 0xff,
-    0x2b, 0xfe, 0x6f, 0xf4, 0x0, 0x1, 0xff, 0xab,
-    0xfe, 0x6f, 0xf4, 0x0, 0x0, 0x9f, 0xfd, 0xfe,
-    0x6f, 0xf4, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x6f,
-    0xf4, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x6f, 0xf4,
-    0x0, 0x0, 0x1, 0xff, 0xfe, 0x6f, 0xf4, 0x0,
-    0x0, 0x0, 0x8f, 0xfe, 0x6f, 0xf4, 0x0, 0x0,
-    0x0, 0x1f, 0xfe,
+    0x6f, 0xf4, 0x80, 0x7d, 0x7f, 0xc0, 0x13, 0x8,
+    0x7, 0xff, 0x6, 0x0, 0x3f, 0xf8, 0x2c, 0x20,
+    0x1f, 0xfc, 0x18, 0x0, 0xff, 0x84, 0x18, 0x40,
+    0x3f, 0xd0, 0x0, 0x80, 0xf, 0xf1, 0x28, 0x30,
+    0x80, 0x7f, 0xa0, 0x1, 0x0, 0x1f, 0xe2, 0x60,
+    0x62, 0x0, 0xff, 0x58, 0x2, 0xc0, 0x3f, 0xc4,
+    0xc0, 0xc4, 0x1, 0xfe, 0x80, 0x5, 0x80, 0x7f,
+    0x85, 0x81, 0x88, 0x3, 0xfd, 0x0, 0x8, 0x0,
+    0xff, 0xb, 0x2, 0xb0, 0x7, 0xfa, 0x0, 0x4,
+    0x1, 0xfe, 0x17, 0x0, 0xff, 0xe0, 0xc8, 0x7,
+    0xff, 0x4, 0x5c, 0x3, 0xff, 0x83, 0x20, 0x10,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x7f, 0xff, 0xb8, 0x8a, 0xff, 0xfd, 0x0,
-    0x2, 0xff, 0xe3, 0x0, 0x0, 0x1b, 0xff, 0x90,
-    0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xf1,
-    0xe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6,
-    0xa, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0x3, 0xff, 0xe3, 0x0, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x8f, 0xff, 0xb8, 0x79, 0xef, 0xfe, 0x10,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
+    0x0, 0xc5, 0x3b, 0xfe, 0xea, 0x50, 0xf, 0x9f,
+    0x58, 0x80, 0x2, 0xb5, 0x82, 0x1, 0x9e, 0x0,
+    0x8, 0xee, 0x50, 0x1, 0xe0, 0x4, 0x50, 0x3,
+    0x97, 0x10, 0xae, 0x40, 0x29, 0x0, 0x58, 0x2,
+    0x8c, 0x3, 0xd, 0x90, 0x30, 0x83, 0x81, 0xa0,
+    0x7, 0xd6, 0x0, 0x71, 0x10, 0x20, 0x7, 0xe7,
+    0x0, 0x79, 0x80, 0x38, 0x3, 0xf0, 0x80, 0xc,
+    0x40, 0x3f, 0xff, 0xe0, 0x18, 0x40, 0x2, 0x1,
+    0xff, 0x8c, 0x1, 0xe0, 0x1f, 0x84, 0x0, 0x62,
+    0x20, 0x50, 0xf, 0xc8, 0x0, 0xf0, 0x40, 0x24,
+    0x0, 0xfa, 0x40, 0xe, 0x12, 0x0, 0xa3, 0x0,
+    0xe9, 0x30, 0x51, 0x3, 0x70, 0x1c, 0xb8, 0x79,
+    0xe6, 0x1, 0xb0, 0xa, 0x1c, 0x0, 0x8f, 0xc,
+    0x20, 0x7e, 0x20, 0x1a, 0x35, 0x88, 0x0, 0x29,
+    0x58, 0x20, 0x0,
 
     /* U+0050 "P" */
-    0x2f, 0xff, 0xff, 0xff, 0xfd, 0x92, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x2f,
-    0xfb, 0x77, 0x77, 0x8b, 0xff, 0xf8, 0x2, 0xff,
-    0x80, 0x0, 0x0, 0x3, 0xef, 0xf2, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x62, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x2f, 0xf9, 0x2f, 0xf8, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xa2, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xf8, 0x2f, 0xf8, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x42, 0xff, 0x80, 0x0, 0x0,
-    0x3b, 0xff, 0xc0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x2f, 0xfb, 0x77, 0x77, 0x65, 0x10,
-    0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xdb, 0x24, 0x1, 0xff, 0x89, 0xb6,
+    0x0, 0x39, 0x22, 0x33, 0xa0, 0x1, 0xe0, 0x3,
+    0x1b, 0xbe, 0x8b, 0xc1, 0x7, 0x20, 0xf, 0xf1,
+    0xc0, 0x1, 0x0, 0x3f, 0xe4, 0x0, 0x78, 0x7,
+    0xff, 0x8, 0xc0, 0x3f, 0xe7, 0x0, 0x10, 0x7,
+    0xfd, 0x20, 0xc, 0x0, 0xfe, 0x3b, 0x30, 0x34,
+    0x0, 0x9f, 0xff, 0xb1, 0x0, 0x78, 0x3, 0xff,
+    0x26, 0x10, 0x6, 0x48, 0x8d, 0x35, 0xd6, 0x40,
+    0x1c, 0x6e, 0xf9, 0x94, 0x40, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfd, 0x60,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x7f, 0xff, 0xb8, 0x8a, 0xff, 0xfd, 0x0,
-    0x2, 0xff, 0xe3, 0x0, 0x0, 0x1b, 0xff, 0x90,
-    0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xf1,
-    0xe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x1f, 0xf8, 0x0, 0x0, 0x2, 0x0, 0x1f, 0xf9,
-    0xe, 0xfd, 0x0, 0x0, 0x4f, 0xa0, 0x5f, 0xf6,
-    0xa, 0xff, 0x40, 0x0, 0x8f, 0xf9, 0xcf, 0xf1,
-    0x3, 0xff, 0xe3, 0x0, 0xa, 0xff, 0xff, 0xa0,
-    0x0, 0x8f, 0xff, 0xb8, 0x79, 0xff, 0xfe, 0x10,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x29, 0xdf, 0xfd, 0xa5, 0xdf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc5, 0x3b, 0xfe, 0xea, 0x50, 0xf, 0x9f,
+    0x58, 0x80, 0x2, 0xb5, 0x82, 0x1, 0x9e, 0x0,
+    0x8, 0xee, 0x50, 0x1, 0xe0, 0x4, 0x50, 0x3,
+    0x97, 0x10, 0xae, 0x40, 0x29, 0x0, 0x58, 0x2,
+    0x8c, 0x3, 0xd, 0x90, 0x30, 0x83, 0x81, 0xa0,
+    0x7, 0xd6, 0x0, 0x71, 0x10, 0x20, 0x7, 0xe7,
+    0x0, 0x79, 0x80, 0x38, 0x3, 0xf0, 0x80, 0xc,
+    0x40, 0x3f, 0xff, 0xe0, 0x18, 0x40, 0x2, 0x1,
+    0xff, 0x8c, 0x1, 0xe0, 0x1c, 0x40, 0x1, 0x0,
+    0x18, 0x88, 0x14, 0x3, 0x26, 0xd0, 0x20, 0x3,
+    0xc1, 0x0, 0x90, 0x2, 0xc0, 0x59, 0x90, 0x1,
+    0xc2, 0x40, 0x14, 0x60, 0x8, 0x50, 0x63, 0x5,
+    0x10, 0x37, 0x1, 0xcb, 0x87, 0x30, 0x8, 0x6c,
+    0x2, 0x87, 0x0, 0x23, 0xc3, 0x0, 0x42, 0x80,
+    0x1a, 0x35, 0x88, 0x0, 0x4b, 0x44, 0x14, 0x20,
+    0x18, 0xa7, 0x7f, 0xdb, 0x4b, 0x85, 0x62, 0x1,
+    0xff, 0x87, 0x50, 0x0,
 
     /* U+0052 "R" */
-    0x4f, 0xff, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x4f,
-    0xf9, 0x55, 0x55, 0x58, 0xef, 0xf9, 0x4, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0xcf, 0xf2, 0x4f, 0xf6,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x84, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xf, 0xfa, 0x4f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xa4, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x2f, 0xf8, 0x4f, 0xf6, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x34, 0xff, 0x60, 0x0, 0x0,
-    0x3a, 0xff, 0xb0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x4, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x80, 0x0, 0x4f, 0xf9, 0x55, 0x58, 0xff, 0x60,
-    0x0, 0x4, 0xff, 0x60, 0x0, 0xe, 0xfe, 0x0,
-    0x0, 0x4f, 0xf6, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x4, 0xff, 0x60, 0x0, 0x0, 0xef, 0xe0, 0x0,
-    0x4f, 0xf6, 0x0, 0x0, 0x6, 0xff, 0x60, 0x4,
-    0xff, 0x60, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x4f,
-    0xf6, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x4, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x4f, 0xf6,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x60,
+    0x4f, 0xff, 0xdd, 0x6a, 0x1, 0xff, 0x85, 0x2a,
+    0xc0, 0x39, 0xaa, 0xb9, 0xc4, 0x12, 0x40, 0x37,
+    0xaa, 0xf4, 0x79, 0x83, 0x10, 0x7, 0xf8, 0x7c,
+    0x1, 0x40, 0x1f, 0xf1, 0x80, 0x8, 0x3, 0xff,
+    0x9c, 0x40, 0x2, 0x0, 0xff, 0xa0, 0x1, 0x60,
+    0x1f, 0xc7, 0x4a, 0x8, 0x60, 0x14, 0xff, 0xf6,
+    0x28, 0x15, 0x0, 0x7f, 0xc2, 0xfa, 0x20, 0x19,
+    0xaa, 0xa7, 0x0, 0x44, 0x0, 0x3d, 0xea, 0xb4,
+    0x8, 0x40, 0x7, 0xfe, 0x80, 0x16, 0x0, 0xff,
+    0x98, 0x42, 0x0, 0x3f, 0xf4, 0x0, 0xb0, 0x7,
+    0xfc, 0xc2, 0x10, 0x1, 0xff, 0xa4, 0x5, 0x80,
+    0x3f, 0xe7, 0x10, 0x80, 0xf, 0xfd, 0x20, 0x2c,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x17, 0xce, 0xfe, 0xda, 0x50, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x4f, 0xff, 0xc9, 0x78, 0xbf, 0xff, 0xa0,
-    0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0x6d, 0x10,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xe9, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xc7, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x26, 0xcf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x1, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7,
-    0xc, 0xfd, 0x40, 0x0, 0x0, 0x2, 0xdf, 0xf2,
-    0x1b, 0xff, 0xfe, 0x97, 0x67, 0xbf, 0xff, 0x80,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x49, 0xde, 0xfe, 0xc8, 0x20, 0x0,
+    0x0, 0xc2, 0xf9, 0xdf, 0xdb, 0x4a, 0x1, 0xe4,
+    0xf8, 0x31, 0x1, 0x25, 0xae, 0x40, 0x9, 0x2c,
+    0x40, 0xda, 0x1d, 0x0, 0x3, 0xc0, 0x14, 0x0,
+    0x2f, 0x25, 0xe2, 0xfe, 0x4a, 0xc0, 0x2, 0x60,
+    0xe8, 0x1, 0xe6, 0xd1, 0x0, 0x18, 0x3, 0x80,
+    0x3f, 0xf1, 0x80, 0x3c, 0x3, 0xff, 0x8, 0x81,
+    0x9c, 0x3, 0xff, 0x50, 0x2, 0x3a, 0x50, 0x3,
+    0xf9, 0x2c, 0x40, 0x5a, 0xff, 0x1c, 0x40, 0x3c,
+    0x9d, 0x4a, 0x20, 0x3, 0x8e, 0x60, 0xf, 0x96,
+    0xbb, 0x64, 0xc0, 0x13, 0x0, 0x1f, 0xc4, 0xd9,
+    0x40, 0x7, 0x20, 0xf, 0xf9, 0x64, 0x0, 0xa0,
+    0x1f, 0xf9, 0x80, 0x1a, 0x1, 0xff, 0xc5, 0x19,
+    0x0, 0xfe, 0x40, 0x6, 0x86, 0xb6, 0xa0, 0x7,
+    0x8a, 0x40, 0xa, 0x2e, 0x5, 0x7d, 0x2e, 0xcf,
+    0x7a, 0x40, 0xe4, 0x37, 0x22, 0x2, 0xd1, 0x30,
+    0x80, 0x7, 0x80, 0x9, 0xba, 0xd8, 0x84, 0x4,
+    0xdf, 0x60, 0x0,
 
     /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x45,
-    0x55, 0x55, 0xff, 0xb5, 0x55, 0x55, 0x20, 0x0,
-    0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xe1, 0x48, 0x7, 0xff, 0xe, 0xea,
+    0xb8, 0x0, 0x95, 0x5d, 0x68, 0xab, 0xc0, 0x1,
+    0x55, 0xe2, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x20,
 
     /* U+0055 "U" */
-    0xdf, 0xc0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x6d,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0xdf,
-    0xc0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x6d, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6, 0xdf, 0xc0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x6d, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf6, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x6d, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf6, 0xdf, 0xc0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x6d, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf6, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x6d, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf6, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x6d, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf5, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x49, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xf2,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x0,
-    0xef, 0xf5, 0x0, 0x0, 0x1b, 0xff, 0x70, 0x6,
-    0xff, 0xfc, 0x98, 0xae, 0xff, 0xd0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x2,
-    0x9d, 0xff, 0xeb, 0x60, 0x0, 0x0,
+    0xdf, 0xc0, 0xf, 0xc9, 0xfe, 0x60, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xc0, 0x62,
+    0x4, 0x1, 0xf8, 0x40, 0x2, 0xa0, 0x24, 0x1,
+    0xf6, 0x0, 0x1b, 0x0, 0x14, 0x1, 0xe1, 0x70,
+    0x12, 0x51, 0x7, 0x50, 0xc, 0x34, 0x21, 0x20,
+    0x8, 0x0, 0x56, 0x4c, 0x57, 0xa0, 0x13, 0x80,
+    0x1a, 0x0, 0x6, 0xce, 0xa2, 0x7, 0x80, 0x19,
+    0xf5, 0x88, 0x0, 0x29, 0x38, 0x20, 0x0,
 
     /* U+0056 "V" */
-    0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xb0, 0xe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf6, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x10, 0x4, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xdf, 0xc0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0,
-    0x6, 0xff, 0x20, 0x0, 0x5, 0xff, 0x40, 0x0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x1f, 0xf9, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0xd0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff,
-    0x20, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf7, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xb0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf5, 0xb, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xa0, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0x4f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfc, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0x0,
-    0x0, 0x0, 0x0,
+    0x8f, 0xf1, 0x80, 0x7f, 0x5f, 0xf8, 0x2c, 0x1,
+    0x60, 0x1f, 0xc8, 0x8, 0x6, 0x20, 0x80, 0x1f,
+    0x90, 0x1, 0xa0, 0x7, 0x3, 0x10, 0xf, 0xb4,
+    0x0, 0xe0, 0xd, 0x0, 0x38, 0x7, 0xc8, 0x6,
+    0x20, 0x4, 0x0, 0x60, 0x7, 0x88, 0x81, 0x60,
+    0x19, 0x41, 0x40, 0x3c, 0x80, 0x5, 0x0, 0xde,
+    0x0, 0x40, 0xe, 0xd0, 0x22, 0x0, 0x64, 0x0,
+    0x68, 0x7, 0x20, 0x28, 0x7, 0xa, 0x2, 0x0,
+    0x64, 0x0, 0x58, 0x7, 0xb4, 0x8, 0x80, 0x16,
+    0x80, 0x98, 0x7, 0x9c, 0x0, 0xa0, 0x12, 0x3,
+    0x80, 0x7c, 0x24, 0x18, 0x0, 0x22, 0x6, 0x80,
+    0x7e, 0x50, 0x40, 0x2, 0x0, 0x10, 0x3, 0xf5,
+    0x80, 0x14, 0x34, 0x10, 0x3, 0xf8, 0xc4, 0x3c,
+    0x10, 0x34, 0x3, 0xfc, 0xe0, 0x88, 0x0, 0x38,
+    0x7, 0xfb, 0x40, 0x60, 0xc, 0x40, 0x3f, 0xc8,
+    0x0, 0x30, 0xb0, 0xf, 0xfc, 0xa0, 0x12, 0x80,
+    0x7f, 0xef, 0x0, 0x11, 0x0, 0x3c,
 
     /* U+0057 "W" */
-    0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe,
-    0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x3f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5,
-    0xc, 0xfc, 0x0, 0x1f, 0xf8, 0x0, 0x3f, 0xf3,
-    0xb, 0xfd, 0x0, 0x5f, 0xfd, 0x0, 0x5f, 0xf1,
-    0x9, 0xfe, 0x0, 0x9f, 0xff, 0x10, 0x6f, 0xf0,
-    0x8, 0xff, 0x0, 0xef, 0xff, 0x50, 0x8f, 0xd0,
-    0x6, 0xff, 0x12, 0xff, 0xbf, 0x90, 0xaf, 0xc0,
-    0x4, 0xff, 0x26, 0xfc, 0x6f, 0xe0, 0xbf, 0xa0,
-    0x3, 0xff, 0x4a, 0xf7, 0x2f, 0xf2, 0xdf, 0x80,
-    0x1, 0xff, 0x5e, 0xf3, 0xd, 0xf6, 0xff, 0x60,
-    0x0, 0xff, 0xaf, 0xe0, 0x9, 0xfb, 0xff, 0x40,
-    0x0, 0xef, 0xff, 0xa0, 0x5, 0xff, 0xff, 0x20,
-    0x0, 0xcf, 0xff, 0x60, 0x1, 0xff, 0xff, 0x10,
-    0x0, 0xbf, 0xff, 0x10, 0x0, 0xcf, 0xff, 0x0,
-    0x0, 0x9f, 0xfd, 0x0, 0x0, 0x8f, 0xfd, 0x0,
-    0x0, 0x8f, 0xf9, 0x0, 0x0, 0x4f, 0xfb, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x0, 0xf, 0xf9, 0x0,
+    0x6f, 0xf1, 0x80, 0x7f, 0x4f, 0xf1, 0x0, 0x18,
+    0x3, 0xf8, 0x80, 0x9c, 0x0, 0x60, 0x1f, 0xce,
+    0xc, 0x40, 0x1, 0x0, 0xfe, 0x20, 0x21, 0x0,
+    0x70, 0x7, 0xf0, 0x87, 0x80, 0x81, 0x80, 0x7e,
+    0x10, 0x1, 0x1, 0x3, 0x0, 0x7, 0xfd, 0x0,
+    0x2, 0x0, 0x30, 0x38, 0x8, 0x1, 0x0, 0xa,
+    0x0, 0x60, 0x1, 0x1, 0x1, 0x80, 0x30, 0x0,
+    0x42, 0x6, 0x0, 0x10, 0x10, 0x10, 0x3, 0x80,
+    0x48, 0x1c, 0x4, 0x0, 0xe0, 0x0, 0x90, 0x82,
+    0x6, 0x1, 0x0, 0x80, 0x8, 0x0, 0x68, 0x7,
+    0xa0, 0xe0, 0x20, 0xc0, 0x7, 0x0, 0x36, 0x5,
+    0xa0, 0x9, 0x30, 0x10, 0x0, 0x80, 0x2, 0x80,
+    0x84, 0x40, 0x42, 0xe, 0x0, 0x8, 0x3, 0xc4,
+    0x46, 0x8, 0x1a, 0x0, 0x20, 0x8, 0x41, 0x41,
+    0x0, 0x18, 0x8, 0x0, 0x60, 0x8, 0x80, 0x2c,
+    0x0, 0x20, 0x6, 0x30, 0x9, 0xc0, 0x27, 0x0,
+    0x9, 0x80, 0x42, 0x1, 0x10, 0x0, 0x84, 0x2,
+    0x40, 0x1, 0x0, 0x61, 0x0, 0x20, 0x6, 0xc0,
+    0x3, 0x0, 0x6e, 0x0, 0x68, 0x6, 0x40, 0x1,
+    0x0, 0x0,
 
     /* U+0058 "X" */
-    0xe, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0xfc,
-    0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x0, 0x2, 0xff, 0xa0, 0x0, 0x3, 0xff,
-    0xa0, 0x0, 0x0, 0x9, 0xff, 0x30, 0x0, 0xcf,
-    0xf1, 0x0, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x5f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0xe,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe8,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x92, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0x9, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x5f, 0xf7, 0x0, 0x1e, 0xfd, 0x0, 0x0,
-    0x0, 0xe, 0xfd, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0xdf, 0xe1,
-    0x0, 0x2, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xff,
-    0x90, 0x0, 0xbf, 0xf2, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x30, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfc, 0x0,
+    0xe, 0xfe, 0x10, 0xf, 0xa3, 0xfc, 0xc0, 0xb,
+    0x1, 0x90, 0xf, 0x13, 0x81, 0xb0, 0x1, 0x4c,
+    0x1c, 0x80, 0x3a, 0x0, 0x1e, 0x1, 0xb8, 0x1,
+    0x0, 0x18, 0xd4, 0x14, 0xc0, 0x31, 0x30, 0x29,
+    0x80, 0x5e, 0x0, 0xb0, 0xf, 0x40, 0x87, 0x80,
+    0x14, 0xc2, 0x4, 0x3, 0xc3, 0x0, 0x6a, 0x16,
+    0x4, 0xe0, 0x1f, 0x98, 0xc2, 0xe0, 0x42, 0x40,
+    0x3f, 0xde, 0x2, 0xe0, 0x88, 0x0, 0xff, 0x1a,
+    0x80, 0x52, 0x1, 0xff, 0xb0, 0x0, 0x44, 0x0,
+    0xff, 0xd0, 0x0, 0x27, 0x0, 0xff, 0xa4, 0x40,
+    0x82, 0x4, 0x3, 0xf8, 0x98, 0x1b, 0xc0, 0x16,
+    0x1, 0xfd, 0xc0, 0x8, 0x26, 0x5, 0x30, 0xf,
+    0x94, 0xc2, 0x4, 0x20, 0x43, 0x80, 0x3e, 0xb0,
+    0x27, 0x0, 0xc, 0x1, 0x30, 0x7, 0x40, 0x84,
+    0x80, 0x66, 0x20, 0x81, 0x0, 0x89, 0xc1, 0x10,
+    0x1, 0xd2, 0x3, 0x0, 0x14, 0x80, 0x24, 0x3,
+    0xc8, 0x80, 0x63, 0x5, 0x40, 0x62, 0x0, 0xfa,
+    0x40, 0x1e, 0x0,
 
     /* U+0059 "Y" */
-    0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0xbf, 0xf1,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x8f, 0xf4, 0x0, 0x0, 0xb, 0xff, 0x10,
-    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x9, 0xff, 0x40, 0x0, 0xaf, 0xf1, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x9f, 0xf3, 0xa, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x1f, 0xfa, 0x1f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0,
+    0x1f, 0xf6, 0x0, 0x7e, 0x3f, 0xf4, 0xb, 0x81,
+    0xa0, 0x7, 0xd0, 0x0, 0x90, 0x90, 0x4, 0x0,
+    0x78, 0xd0, 0x1c, 0x40, 0x5c, 0xd, 0x0, 0x3a,
+    0x0, 0x12, 0x1, 0x48, 0x2, 0x0, 0x31, 0xa0,
+    0x38, 0x80, 0x42, 0xc0, 0x68, 0x1, 0x48, 0x2,
+    0x40, 0x3a, 0x0, 0x1e, 0x0, 0x25, 0x6, 0x10,
+    0xe, 0x16, 0x4, 0x30, 0x80, 0x4, 0x0, 0x7d,
+    0x0, 0x9, 0x15, 0x6, 0x10, 0xf, 0x85, 0x81,
+    0x6c, 0x1, 0x0, 0x1f, 0xd0, 0x0, 0x50, 0x61,
+    0x0, 0xfe, 0x16, 0x0, 0xa0, 0x3, 0xfe, 0xb0,
+    0x2, 0x88, 0x7, 0xfc, 0x40, 0x2, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xf7, 0xc0,
 
     /* U+005A "Z" */
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x4,
-    0x55, 0x55, 0x55, 0x55, 0x9f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfd, 0x66, 0x66, 0x66, 0x66, 0x66, 0x16, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+    0xd, 0xff, 0xff, 0xb4, 0x3, 0xff, 0x8b, 0x35,
+    0x5f, 0x98, 0x0, 0x80, 0x4, 0x55, 0xfc, 0xe0,
+    0x30, 0x1, 0xfe, 0x81, 0xb, 0x10, 0xf, 0xe3,
+    0x70, 0x45, 0x0, 0xff, 0x78, 0x2, 0x40, 0x3f,
+    0xcc, 0x61, 0x4, 0x1, 0xfc, 0x32, 0x4, 0xe0,
+    0x1f, 0xeb, 0x0, 0x70, 0x7, 0xf9, 0x14, 0x18,
+    0xc0, 0x3f, 0xd2, 0x3, 0x0, 0x1f, 0xe8, 0x20,
+    0xb1, 0x0, 0xfe, 0x27, 0x4, 0x50, 0xf, 0xf7,
+    0x0, 0x24, 0x3, 0xfc, 0xc6, 0x10, 0x40, 0x1f,
+    0xc3, 0x20, 0x4e, 0x1, 0xfe, 0xb0, 0x7, 0x0,
+    0x7f, 0x91, 0x40, 0x95, 0x9b, 0xf8, 0x48, 0x0,
+    0x53, 0x3f, 0xe3, 0x0, 0xff, 0xe1, 0x80,
 
     /* U+005B "[" */
-    0x6f, 0xff, 0xfa, 0x6f, 0xfa, 0xa7, 0x6f, 0xd0,
-    0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f,
-    0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0,
-    0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0,
-    0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f,
-    0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0,
-    0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0,
-    0x0, 0x6f, 0xd0, 0x0, 0x6f, 0xd0, 0x0, 0x6f,
-    0xd0, 0x0, 0x6f, 0xfa, 0xa7, 0x6f, 0xff, 0xfa,
+    0x6f, 0xfd, 0x40, 0x12, 0xab, 0x40, 0x5, 0x54,
+    0x70, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x74, 0xaa,
+    0x8e, 0x1, 0x2a, 0xb4,
 
     /* U+005C "\\" */
-    0x5f, 0x90, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x6f, 0x80,
-    0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0xc,
-    0xf2, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xfd,
+    0x5f, 0x90, 0xf, 0x94, 0x1c, 0x3, 0xf2, 0x8a,
+    0x0, 0x7d, 0xe1, 0xa0, 0x1f, 0x28, 0x38, 0x7,
+    0xe5, 0x14, 0x0, 0xfb, 0xc3, 0x40, 0x3e, 0x50,
+    0x70, 0xf, 0xc8, 0x26, 0x1, 0xf6, 0x85, 0x0,
+    0x7c, 0xe0, 0xe0, 0x1f, 0xa, 0x9, 0x80, 0x7d,
+    0xa1, 0x60, 0x1f, 0x38, 0x28, 0x7, 0xc2, 0x84,
+    0x60, 0x1f, 0x68, 0x58, 0x7, 0xce, 0xa, 0x1,
+    0xf0, 0x99, 0x10, 0x3, 0xea, 0xa, 0x0, 0xf9,
+    0xc1, 0x40, 0x3e, 0x13, 0x22, 0x0, 0x7d, 0x60,
+    0xa0, 0x1f, 0x30, 0x50,
 
     /* U+005D "]" */
-    0xef, 0xff, 0xf2, 0x9a, 0xbf, 0xf2, 0x0, 0x1f,
-    0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0,
-    0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2,
-    0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f,
-    0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0,
-    0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2,
-    0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f,
-    0xf2, 0x0, 0x1f, 0xf2, 0x0, 0x1f, 0xf2, 0x0,
-    0x1f, 0xf2, 0x9a, 0xbf, 0xf2, 0xef, 0xff, 0xf2,
+    0xef, 0xfc, 0x4e, 0xa8, 0x1, 0x4d, 0x50, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xde, 0x9a, 0xa0, 0x4,
+    0xea, 0x80, 0x10,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0xef, 0x20, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0,
+    0x0, 0xf7, 0x7b, 0x0, 0x7f, 0xd0, 0x21, 0x0,
+    0x1f, 0xe1, 0x70, 0x51, 0x80, 0xf, 0xe8, 0x8,
+    0xb0, 0x71, 0x0, 0xf8, 0x98, 0x5c, 0x60, 0x20,
+    0x3, 0xe9, 0x8, 0x0, 0x38, 0xb1, 0x0, 0x72,
+    0x20, 0x98, 0x2, 0x80, 0x90, 0xe, 0x80, 0x90,
+    0xc, 0xc4, 0x88, 0x0, 0x94, 0xcc, 0x80, 0x1d,
+    0x21, 0x0, 0x15, 0x87, 0x80, 0x79, 0x10, 0x6a,
+    0xe, 0x2a, 0x60, 0x1f, 0x40, 0x58, 0x0,
 
     /* U+005F "_" */
-    0x3c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc9,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x3c, 0xcf, 0xfe, 0x14, 0xb9, 0x9f, 0xff, 0x9,
+    0x40,
 
     /* U+0060 "`" */
-    0x0, 0x12, 0x0, 0xb, 0xfb, 0x0, 0x6, 0xff,
-    0x20, 0x0, 0xcf, 0x80, 0x0, 0x3f, 0xe0, 0x0,
-    0xa, 0xf5, 0x0, 0x1, 0x40,
+    0x0, 0x9, 0x0, 0x57, 0xd2, 0x1, 0x68, 0x21,
+    0x0, 0x18, 0xc2, 0x80, 0x2f, 0x6, 0x0, 0x8d,
+    0x45, 0x40, 0x2b, 0xb2, 0x80,
 
     /* U+0061 "a" */
-    0x0, 0x5, 0xbe, 0xff, 0xda, 0x30, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xbf, 0xb6,
-    0x56, 0x8e, 0xff, 0x30, 0x0, 0x30, 0x0, 0x0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x2a, 0xef, 0xff, 0xff, 0xff, 0xb0, 0x2e, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xc, 0xfe, 0x51, 0x0,
-    0x0, 0xcf, 0xb1, 0xff, 0x50, 0x0, 0x0, 0xc,
-    0xfb, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0xef, 0xb1,
-    0xff, 0x60, 0x0, 0x0, 0x3f, 0xfb, 0xb, 0xff,
-    0x72, 0x12, 0x7e, 0xff, 0xb0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x18, 0xdf, 0xfe, 0xa3,
-    0xcf, 0xb0,
+    0x0, 0x96, 0xfb, 0xfd, 0xb4, 0x60, 0x1a, 0xe9,
+    0x4, 0x0, 0x4b, 0x8e, 0x1, 0xc9, 0x35, 0x2e,
+    0x21, 0x6, 0x0, 0xbc, 0xb6, 0x56, 0x8c, 0x0,
+    0x58, 0x4, 0x60, 0x1c, 0x46, 0x4, 0x1, 0xff,
+    0x84, 0x0, 0x55, 0xdf, 0xfc, 0x60, 0x11, 0x62,
+    0x88, 0x7, 0xf7, 0x8, 0xab, 0xbf, 0xf1, 0x80,
+    0x4, 0xc2, 0xd4, 0x40, 0x3e, 0x30, 0x3, 0x0,
+    0x78, 0x80, 0x6, 0x0, 0x50, 0xe, 0x31, 0x0,
+    0xa, 0x4, 0xb9, 0x9, 0x3e, 0x80, 0x69, 0x10,
+    0x8d, 0xed, 0x81, 0x0, 0xc5, 0xee, 0x40, 0x1,
+    0x5c, 0x30, 0x0,
 
     /* U+0062 "b" */
-    0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x6,
-    0xcf, 0xfb, 0x50, 0x0, 0xbf, 0xdb, 0xff, 0xff,
-    0xff, 0x70, 0xb, 0xff, 0xfd, 0x87, 0xbf, 0xff,
-    0x30, 0xbf, 0xfc, 0x0, 0x0, 0x5f, 0xf9, 0xb,
-    0xff, 0x30, 0x0, 0x0, 0xdf, 0xe0, 0xbf, 0xf0,
-    0x0, 0x0, 0x8, 0xff, 0xb, 0xfd, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0xbf, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0x2b, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xf2,
-    0xbf, 0xe0, 0x0, 0x0, 0x8, 0xff, 0xb, 0xff,
-    0x30, 0x0, 0x0, 0xcf, 0xd0, 0xbf, 0xfb, 0x0,
-    0x0, 0x3f, 0xf9, 0xb, 0xff, 0xfb, 0x54, 0x7f,
-    0xff, 0x20, 0xbf, 0xdd, 0xff, 0xff, 0xff, 0x70,
-    0xb, 0xfc, 0x8, 0xdf, 0xfc, 0x50, 0x0,
+    0xbf, 0xc0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x15,
+    0xb3, 0xfd, 0x6a, 0x1, 0xc3, 0x72, 0x60, 0x4,
+    0xa7, 0x0, 0xc4, 0x84, 0xf0, 0x80, 0x8, 0x30,
+    0xc, 0x7b, 0xf, 0x74, 0x0, 0xa0, 0xd, 0xe0,
+    0x19, 0x48, 0x1c, 0x3, 0x18, 0x7, 0x28, 0x8,
+    0x4, 0x40, 0x1e, 0xe0, 0x1, 0x0, 0x4, 0x3,
+    0xff, 0x9a, 0x40, 0x1e, 0xe0, 0x1, 0x0, 0x4,
+    0xc0, 0x39, 0x0, 0x80, 0x34, 0x0, 0x63, 0x30,
+    0x20, 0x6, 0x4b, 0x54, 0x7c, 0x0, 0x58, 0x4,
+    0x44, 0x4a, 0xb8, 0x0, 0x41, 0x0, 0x43, 0xae,
+    0x40, 0x3, 0xa7, 0x0, 0x0,
 
     /* U+0063 "c" */
-    0x0, 0x0, 0x4b, 0xef, 0xea, 0x40, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xbf, 0xfc,
-    0x76, 0x8d, 0xfe, 0x10, 0x5f, 0xf9, 0x0, 0x0,
-    0x8, 0x20, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf9, 0x0, 0x0, 0x6, 0x50, 0x0, 0xcf,
-    0xfd, 0x75, 0x7c, 0xff, 0x40, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x5b, 0xef, 0xeb,
-    0x50, 0x0,
+    0x0, 0xc9, 0x7d, 0xfd, 0x48, 0x1, 0xd7, 0x64,
+    0x10, 0x15, 0xba, 0x0, 0xad, 0x0, 0xe2, 0x5c,
+    0x81, 0x4, 0x15, 0x1, 0xb1, 0xda, 0x35, 0xf0,
+    0x42, 0x40, 0xa4, 0x3, 0xa0, 0x80, 0x6, 0xa,
+    0x1, 0xfc, 0x20, 0xd, 0x0, 0xfe, 0x30, 0x0,
+    0x80, 0x7f, 0xe1, 0x0, 0xfe, 0x20, 0x6, 0x80,
+    0x7f, 0x8c, 0x14, 0x3, 0xfd, 0x40, 0x52, 0x1,
+    0xcc, 0xa0, 0x6, 0x30, 0x6d, 0x75, 0x7c, 0x9a,
+    0x40, 0x6, 0x98, 0x14, 0x54, 0x18, 0x1a, 0x80,
+    0x7, 0x29, 0x4, 0x5, 0x2b, 0x4,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x7c,
-    0xff, 0xd7, 0x4f, 0xf3, 0x1, 0xcf, 0xff, 0xff,
-    0xfd, 0xff, 0x30, 0x9f, 0xfe, 0x97, 0xaf, 0xff,
-    0xf3, 0x1f, 0xfd, 0x10, 0x0, 0x4f, 0xff, 0x36,
-    0xff, 0x50, 0x0, 0x0, 0xcf, 0xf3, 0x9f, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0x3a, 0xfe, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0xbf, 0xd0, 0x0, 0x0, 0x4,
-    0xff, 0x3b, 0xfe, 0x0, 0x0, 0x0, 0x4f, 0xf3,
-    0x9f, 0xf0, 0x0, 0x0, 0x6, 0xff, 0x37, 0xff,
-    0x30, 0x0, 0x0, 0xbf, 0xf3, 0x3f, 0xfa, 0x0,
-    0x0, 0x3f, 0xff, 0x30, 0xdf, 0xfa, 0x54, 0x7f,
-    0xff, 0xf3, 0x3, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0x30, 0x2, 0xae, 0xfe, 0xa4, 0x4f, 0xf3,
+    0x0, 0xfe, 0x4f, 0xf1, 0x80, 0x7f, 0xff, 0xc0,
+    0x3c, 0xf9, 0xfe, 0xd7, 0x0, 0xe1, 0xc8, 0x30,
+    0x1, 0x44, 0x80, 0x68, 0x30, 0x16, 0x85, 0x2,
+    0x0, 0x85, 0x80, 0xbe, 0x5e, 0xac, 0x3, 0x38,
+    0x2, 0x4, 0x2, 0x43, 0x0, 0xbc, 0x0, 0xa0,
+    0x1d, 0x60, 0x11, 0x80, 0x80, 0x78, 0x80, 0x21,
+    0x3, 0x0, 0xf0, 0x80, 0x71, 0x80, 0x7f, 0x88,
+    0x4, 0x3, 0xc4, 0x1, 0x70, 0x0, 0xc0, 0x3b,
+    0x40, 0x24, 0x0, 0x48, 0x6, 0x34, 0x0, 0x8c,
+    0x81, 0x69, 0x51, 0xf0, 0x3, 0xb8, 0x0, 0xb5,
+    0x70, 0x6, 0x1, 0x8f, 0x54, 0x40, 0x56, 0xe0,
+    0x2,
 
     /* U+0065 "e" */
-    0x0, 0x3, 0xae, 0xfe, 0xa3, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x5, 0xff, 0xe8,
-    0x68, 0xff, 0xf6, 0x0, 0xef, 0xc0, 0x0, 0x1,
-    0xef, 0xe0, 0x4f, 0xf3, 0x0, 0x0, 0x7, 0xff,
-    0x38, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xaf, 0xe1, 0x11, 0x11,
-    0x11, 0x11, 0x8, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xd1, 0x0, 0x0, 0x44, 0x0, 0x8, 0xff,
-    0xe7, 0x45, 0xaf, 0xf3, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x5, 0xbe, 0xfe, 0xc7,
-    0x0, 0x0,
+    0x0, 0x8e, 0xbb, 0xfa, 0x8c, 0x3, 0x9f, 0x14,
+    0x40, 0x57, 0x20, 0x2, 0x58, 0x1, 0x79, 0x70,
+    0x3, 0xb0, 0x2, 0xc0, 0xfa, 0x1a, 0x38, 0x42,
+    0x1, 0x4, 0x3c, 0x3, 0xc, 0x80, 0x9e, 0x0,
+    0xc, 0x3, 0x90, 0x0, 0xa2, 0x0, 0xff, 0xf6,
+    0x0, 0x4, 0xc0, 0x3f, 0xf8, 0x43, 0xdd, 0xfc,
+    0xe4, 0x2, 0x3f, 0xe0, 0xd0, 0x2, 0x80, 0x7f,
+    0x20, 0x2, 0x4, 0x3, 0x22, 0x0, 0x2, 0xe0,
+    0x5e, 0xe8, 0xb5, 0x76, 0x30, 0x4, 0x28, 0xc,
+    0x5d, 0x28, 0x8, 0x6, 0xaa, 0x20, 0x80, 0x9c,
+    0x71, 0x80,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x1, 0x9d, 0xff, 0xda, 0x40,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xcf, 0xf9, 0x55, 0x7d, 0x20, 0x0,
-    0x0, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x30, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x71, 0x22, 0x22, 0x5f, 0xf5,
-    0x22, 0x22, 0x21, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x67, 0x7f, 0xdb, 0x48, 0x1, 0xe2,
+    0xf6, 0x20, 0x1, 0x2f, 0x0, 0x7b, 0x84, 0x1a,
+    0xa9, 0x5, 0x0, 0x1c, 0x26, 0xd, 0x2a, 0xa7,
+    0xd2, 0x0, 0xe2, 0x0, 0x68, 0x7, 0xfc, 0xe0,
+    0x7, 0x0, 0xff, 0xe4, 0xcf, 0xfe, 0xb0, 0x6,
+    0x7f, 0xf3, 0x80, 0x7f, 0xf0, 0xe3, 0x77, 0x50,
+    0x2, 0xb7, 0x79, 0x84, 0x8b, 0x8, 0x1, 0x88,
+    0xb8, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xfe, 0x18,
 
     /* U+0067 "g" */
-    0x0, 0x2, 0xae, 0xfd, 0x81, 0x9f, 0xe0, 0x5,
-    0xff, 0xff, 0xff, 0xeb, 0xfe, 0x1, 0xef, 0xfb,
-    0x77, 0xcf, 0xff, 0xe0, 0x6f, 0xf7, 0x0, 0x0,
-    0x9f, 0xfe, 0xa, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xe0, 0xef, 0xb0, 0x0, 0x0, 0xc, 0xfe, 0xf,
-    0xf9, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0xff, 0x80,
-    0x0, 0x0, 0x9, 0xfe, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0xaf, 0xe0, 0xef, 0xa0, 0x0, 0x0, 0xc,
-    0xfe, 0xc, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x8f, 0xf6, 0x0, 0x0, 0xaf, 0xfe, 0x2, 0xff,
-    0xfb, 0x88, 0xdf, 0xff, 0xe0, 0x6, 0xff, 0xff,
-    0xff, 0xdb, 0xfe, 0x0, 0x4, 0xbe, 0xfd, 0x80,
-    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x1,
-    0x60, 0x0, 0x0, 0x9f, 0xf5, 0x0, 0xcf, 0xd8,
-    0x68, 0xdf, 0xfc, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0x7, 0xce, 0xfe, 0xb5, 0x0,
-    0x0,
+    0x0, 0x8a, 0xbb, 0xf6, 0x6, 0x7f, 0x80, 0xb,
+    0xaa, 0x20, 0x4f, 0xe4, 0x1, 0xd, 0x80, 0x12,
+    0x20, 0x62, 0x80, 0x13, 0x88, 0x45, 0xbb, 0xb1,
+    0x80, 0x36, 0x0, 0x1c, 0x3, 0x48, 0x6, 0x40,
+    0x40, 0xf, 0x18, 0x4, 0x20, 0x40, 0x1e, 0x60,
+    0xe, 0x10, 0xf, 0x18, 0x7, 0xfe, 0x30, 0x8,
+    0x40, 0x80, 0x3c, 0xc0, 0x11, 0x2, 0x0, 0x70,
+    0x98, 0x4, 0x80, 0x2c, 0x1, 0xac, 0x3, 0x50,
+    0x2, 0x6e, 0x21, 0xaa, 0x1, 0x8a, 0x40, 0x8,
+    0xee, 0x22, 0x20, 0x6, 0x6b, 0x41, 0x2, 0x7d,
+    0x20, 0xe, 0x4b, 0xef, 0xd8, 0x3, 0x3, 0x0,
+    0xff, 0x20, 0x38, 0x0, 0x58, 0x3, 0xa4, 0x43,
+    0xc0, 0x1b, 0x3b, 0xd, 0x1a, 0xc0, 0x6a, 0x2,
+    0x40, 0x4f, 0x2e, 0x40, 0x7a, 0x0, 0x1e, 0x83,
+    0x10, 0x14, 0xac, 0x10,
 
     /* U+0068 "h" */
-    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x5,
-    0xcf, 0xfc, 0x70, 0x0, 0xaf, 0xc9, 0xff, 0xff,
-    0xff, 0xc0, 0xa, 0xff, 0xfe, 0x87, 0x8e, 0xff,
-    0x80, 0xaf, 0xfc, 0x0, 0x0, 0x1f, 0xfe, 0xa,
-    0xff, 0x20, 0x0, 0x0, 0x9f, 0xf1, 0xaf, 0xd0,
-    0x0, 0x0, 0x6, 0xff, 0x1a, 0xfc, 0x0, 0x0,
-    0x0, 0x5f, 0xf2, 0xaf, 0xc0, 0x0, 0x0, 0x5,
-    0xff, 0x2a, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0xaf, 0xc0, 0x0, 0x0, 0x5, 0xff, 0x2a, 0xfc,
-    0x0, 0x0, 0x0, 0x5f, 0xf2, 0xaf, 0xc0, 0x0,
-    0x0, 0x5, 0xff, 0x2a, 0xfc, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0xaf, 0xc0, 0x0, 0x0, 0x5, 0xff,
-    0x2a, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0xf2,
+    0xaf, 0xc0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x15,
+    0x73, 0xfd, 0x8e, 0x1, 0xe9, 0xa3, 0x0, 0x1c,
+    0x60, 0x6, 0x36, 0x17, 0x87, 0x10, 0x38, 0x0,
+    0xc7, 0xd0, 0xf1, 0xe0, 0x6, 0x0, 0xdc, 0x1,
+    0x85, 0x80, 0x44, 0x0, 0x22, 0x0, 0x77, 0x80,
+    0x70, 0x80, 0x78, 0xc0, 0x6, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xe8, 0x80,
 
     /* U+0069 "i" */
-    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x12, 0x22, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x12, 0x22, 0x6f, 0xf4,
-    0x22, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0xdb, 0xfe, 0x20, 0xf, 0xfe, 0xa6, 0xff,
+    0x88, 0x3, 0xff, 0xa1, 0x1f, 0xfe, 0x20, 0xf,
+    0xfe, 0x24, 0xee, 0xd2, 0x1, 0xf0, 0x91, 0x46,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xe8, 0x9, 0x14,
+    0x60, 0x6, 0x22, 0x81, 0xb7, 0x69, 0x0, 0x5e,
+    0xec, 0x20, 0x1f, 0xf8,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x2f, 0xfd, 0x0, 0x0, 0x2f, 0xfd,
-    0x0, 0x0, 0x2f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xfd,
-    0x12, 0x22, 0x2a, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0xa, 0xfd, 0x0, 0x0, 0xc, 0xfb,
-    0x2, 0x44, 0x9f, 0xf7, 0x8, 0xff, 0xff, 0xe1,
-    0x8, 0xff, 0xea, 0x20,
+    0x0, 0xc5, 0xfe, 0xd0, 0xf, 0xfe, 0x41, 0x7f,
+    0xb4, 0x3, 0xff, 0x88, 0xff, 0xfe, 0xd0, 0xf,
+    0xcd, 0xbb, 0x94, 0x0, 0x24, 0x58, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xd9, 0x60, 0x60, 0x24, 0x44,
+    0x98, 0x60, 0x55, 0xd9, 0x80, 0x58, 0x3, 0xa,
+    0xe0, 0x80,
 
     /* U+006B "k" */
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf3, 0x0, 0x0, 0xb, 0xff, 0x30,
-    0x3f, 0xf3, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x3f,
-    0xf3, 0x0, 0x7, 0xff, 0x60, 0x0, 0x3f, 0xf3,
-    0x0, 0x5f, 0xf7, 0x0, 0x0, 0x3f, 0xf3, 0x4,
-    0xff, 0x90, 0x0, 0x0, 0x3f, 0xf3, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xf5, 0xef, 0xff, 0x20,
-    0x0, 0x0, 0x3f, 0xff, 0xfd, 0xff, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xe1, 0x6f, 0xf6, 0x0, 0x0,
-    0x3f, 0xfe, 0x20, 0xb, 0xff, 0x20, 0x0, 0x3f,
-    0xf5, 0x0, 0x2, 0xff, 0xb0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf6, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0xc, 0xff, 0x10, 0x3f, 0xf3, 0x0, 0x0,
-    0x2, 0xff, 0xb0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
-    0x7f, 0xf5,
+    0x3f, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfa,
+    0x17, 0xfe, 0x30, 0xf, 0xe9, 0x40, 0xb3, 0x0,
+    0xfc, 0xec, 0x12, 0x80, 0x1f, 0x96, 0x2, 0x18,
+    0x3, 0xf2, 0x50, 0x33, 0x80, 0x7e, 0x3b, 0x3,
+    0x90, 0xf, 0xcd, 0xa0, 0x3, 0x20, 0xf, 0xd4,
+    0x24, 0x0, 0xe0, 0xf, 0xe1, 0xc9, 0x3, 0x60,
+    0xf, 0x87, 0x5, 0x90, 0x24, 0x80, 0x3d, 0x64,
+    0x0, 0x90, 0x4, 0x80, 0x79, 0x80, 0x22, 0x80,
+    0x46, 0x0, 0xff, 0x39, 0x84, 0x88, 0x7, 0xfb,
+    0x80, 0x14, 0x1, 0xfe, 0x28, 0x4, 0x50,
 
     /* U+006C "l" */
-    0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x12, 0x22, 0x6f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x12, 0x22, 0x6f, 0xf4, 0x22, 0x20,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf1,
+    0x8f, 0xff, 0x10, 0x7, 0xff, 0x12, 0x77, 0x69,
+    0x0, 0xf8, 0x48, 0xa3, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xfb, 0x22, 0x45, 0x18,
+    0x1, 0x88, 0xa0, 0x6d, 0xda, 0x40, 0x17, 0xbb,
+    0x8, 0x7, 0xfe,
 
     /* U+006D "m" */
-    0xbf, 0x96, 0xef, 0xa0, 0x3b, 0xfe, 0x90, 0xb,
-    0xfe, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xa0, 0xbf,
-    0xf9, 0x39, 0xff, 0xf8, 0x3c, 0xff, 0xb, 0xfe,
-    0x0, 0xf, 0xfc, 0x0, 0x4f, 0xf2, 0xbf, 0xb0,
-    0x0, 0xdf, 0x90, 0x2, 0xff, 0x3b, 0xfa, 0x0,
-    0xd, 0xf8, 0x0, 0x2f, 0xf3, 0xbf, 0xa0, 0x0,
-    0xdf, 0x70, 0x2, 0xff, 0x3b, 0xfa, 0x0, 0xd,
-    0xf7, 0x0, 0x2f, 0xf3, 0xbf, 0xa0, 0x0, 0xdf,
-    0x70, 0x2, 0xff, 0x3b, 0xfa, 0x0, 0xd, 0xf7,
-    0x0, 0x2f, 0xf3, 0xbf, 0xa0, 0x0, 0xdf, 0x70,
-    0x2, 0xff, 0x3b, 0xfa, 0x0, 0xd, 0xf7, 0x0,
-    0x2f, 0xf3, 0xbf, 0xa0, 0x0, 0xdf, 0x70, 0x2,
-    0xff, 0x3b, 0xfa, 0x0, 0xd, 0xf7, 0x0, 0x2f,
-    0xf3, 0xbf, 0xa0, 0x0, 0xdf, 0x70, 0x2, 0xff,
-    0x30,
+    0xbf, 0x96, 0xef, 0xa0, 0x3b, 0xfe, 0x90, 0xc,
+    0xf2, 0x20, 0xb5, 0x88, 0x2, 0xd4, 0x1, 0xb,
+    0x63, 0x2, 0x83, 0xe1, 0x82, 0x80, 0x43, 0x27,
+    0x20, 0x3, 0x83, 0x80, 0x1, 0x0, 0x14, 0x2,
+    0x20, 0x50, 0x3, 0x0, 0x4, 0x0, 0x20, 0x1c,
+    0x20, 0x1f, 0xfc, 0x2f, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf9, 0xc0,
 
     /* U+006E "n" */
-    0xaf, 0xc0, 0x5b, 0xef, 0xd8, 0x0, 0xa, 0xfd,
-    0xaf, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff, 0xd7,
-    0x57, 0xdf, 0xf8, 0xa, 0xff, 0xa0, 0x0, 0x0,
-    0xef, 0xe0, 0xaf, 0xf1, 0x0, 0x0, 0x8, 0xff,
-    0x1a, 0xfd, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0xaf,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0x2a, 0xfc, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0xaf, 0xc0, 0x0, 0x0,
-    0x5, 0xff, 0x2a, 0xfc, 0x0, 0x0, 0x0, 0x5f,
-    0xf2, 0xaf, 0xc0, 0x0, 0x0, 0x5, 0xff, 0x2a,
-    0xfc, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0xaf, 0xc0,
-    0x0, 0x0, 0x5, 0xff, 0x2a, 0xfc, 0x0, 0x0,
-    0x0, 0x5f, 0xf2, 0xaf, 0xc0, 0x0, 0x0, 0x5,
-    0xff, 0x20,
+    0xaf, 0xc0, 0x5b, 0xef, 0xd8, 0x0, 0xe1, 0xaa,
+    0x20, 0x81, 0x3e, 0x0, 0x62, 0x52, 0x8a, 0x82,
+    0x3, 0x80, 0xc, 0xba, 0xea, 0xfa, 0x20, 0xc0,
+    0x1a, 0xc0, 0x39, 0x80, 0x44, 0x0, 0x21, 0x0,
+    0xee, 0x0, 0xe1, 0x0, 0xf1, 0x80, 0xc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xd1,
 
     /* U+006F "o" */
-    0x0, 0x5, 0xbe, 0xfe, 0xa4, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xa, 0xff, 0xa5,
-    0x46, 0xdf, 0xf5, 0x3, 0xff, 0x80, 0x0, 0x1,
-    0xef, 0xd0, 0x9f, 0xf0, 0x0, 0x0, 0x7, 0xff,
-    0x2c, 0xfb, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0xdf,
-    0x90, 0x0, 0x0, 0x2, 0xff, 0x6e, 0xf9, 0x0,
-    0x0, 0x0, 0x1f, 0xf6, 0xdf, 0x90, 0x0, 0x0,
-    0x2, 0xff, 0x5c, 0xfa, 0x0, 0x0, 0x0, 0x3f,
-    0xf4, 0xaf, 0xe0, 0x0, 0x0, 0x7, 0xff, 0x16,
-    0xff, 0x60, 0x0, 0x2, 0xef, 0xd0, 0xe, 0xff,
-    0x94, 0x47, 0xef, 0xf4, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x18, 0xdf, 0xfd, 0x93,
-    0x0, 0x0,
+    0x0, 0x96, 0xfb, 0xfa, 0x90, 0x3, 0xae, 0x90,
+    0x40, 0x56, 0xe0, 0x2, 0xa4, 0x5, 0xab, 0x92,
+    0x7, 0x50, 0x35, 0x7, 0xa5, 0x46, 0xc1, 0x8,
+    0xa, 0x0, 0x40, 0x6, 0x19, 0x2, 0x22, 0x82,
+    0x0, 0x79, 0x0, 0xe, 0x20, 0x40, 0x1e, 0x10,
+    0x1, 0x98, 0x3, 0xf1, 0x80, 0x46, 0x1, 0xf8,
+    0xc0, 0x6, 0x20, 0x60, 0x1e, 0x10, 0x0, 0xb0,
+    0x20, 0x7, 0x90, 0x0, 0xb8, 0x2, 0xc0, 0x18,
+    0xa4, 0x8, 0x58, 0x42, 0x64, 0x88, 0x7c, 0x10,
+    0x90, 0x6, 0x88, 0x35, 0xda, 0x4, 0x21, 0x0,
+    0x7, 0xee, 0x40, 0x2, 0x6c, 0x70, 0x0,
 
     /* U+0070 "p" */
-    0xbf, 0xb0, 0x7d, 0xff, 0xc5, 0x0, 0xb, 0xfd,
-    0xdf, 0xff, 0xff, 0xf8, 0x0, 0xbf, 0xff, 0xb5,
-    0x47, 0xff, 0xf3, 0xb, 0xff, 0xb0, 0x0, 0x3,
-    0xff, 0xa0, 0xbf, 0xf2, 0x0, 0x0, 0xb, 0xfe,
-    0xb, 0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0xbf,
-    0xc0, 0x0, 0x0, 0x6, 0xff, 0x2b, 0xfb, 0x0,
-    0x0, 0x0, 0x6f, 0xf2, 0xbf, 0xc0, 0x0, 0x0,
-    0x7, 0xff, 0x2b, 0xfe, 0x0, 0x0, 0x0, 0x9f,
-    0xf0, 0xbf, 0xf3, 0x0, 0x0, 0xd, 0xfd, 0xb,
-    0xff, 0xb0, 0x0, 0x6, 0xff, 0x80, 0xbf, 0xff,
-    0xd8, 0x7b, 0xff, 0xf2, 0xb, 0xfe, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0xbf, 0xb2, 0xae, 0xfe, 0xa3,
-    0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xbf, 0xb0, 0x7d, 0xff, 0x62, 0x80, 0x73, 0x6c,
+    0x10, 0x0, 0xea, 0x0, 0x31, 0x11, 0x2a, 0xe0,
+    0x0, 0xe6, 0x1, 0x92, 0xd5, 0x1f, 0x0, 0x12,
+    0x1, 0xa4, 0x3, 0x1a, 0x2, 0x0, 0x42, 0x40,
+    0x1c, 0x60, 0x22, 0x0, 0x10, 0x7, 0xb8, 0x0,
+    0x60, 0x7, 0x0, 0xff, 0xce, 0x1, 0xe1, 0x0,
+    0xe2, 0x0, 0xf7, 0x0, 0x8, 0x0, 0x26, 0x1,
+    0xc8, 0x4, 0x1, 0xa0, 0x3, 0x31, 0x2, 0x80,
+    0x64, 0xd8, 0x7b, 0x90, 0x5, 0x0, 0x42, 0x4,
+    0xf0, 0x80, 0xa, 0x20, 0x9, 0x75, 0x44, 0x5,
+    0x71, 0x40, 0x38, 0xab, 0xbf, 0xa8, 0xc0, 0x3f,
+    0xff, 0x0,
 
     /* U+0071 "q" */
-    0x0, 0x8, 0xdf, 0xfb, 0x36, 0xff, 0x10, 0x1d,
-    0xff, 0xff, 0xff, 0xaf, 0xf1, 0xb, 0xff, 0xa5,
-    0x48, 0xff, 0xff, 0x12, 0xff, 0x90, 0x0, 0x5,
-    0xff, 0xf1, 0x7f, 0xf2, 0x0, 0x0, 0xd, 0xff,
-    0x1a, 0xfe, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0xcf,
-    0xc0, 0x0, 0x0, 0x7, 0xff, 0x1c, 0xfb, 0x0,
-    0x0, 0x0, 0x6f, 0xf1, 0xcf, 0xc0, 0x0, 0x0,
-    0x7, 0xff, 0x1a, 0xfe, 0x0, 0x0, 0x0, 0x9f,
-    0xf1, 0x8f, 0xf3, 0x0, 0x0, 0xd, 0xff, 0x13,
-    0xff, 0xb0, 0x0, 0x7, 0xff, 0xf1, 0xd, 0xff,
-    0xd8, 0x7b, 0xff, 0xff, 0x10, 0x3f, 0xff, 0xff,
-    0xfe, 0xaf, 0xf1, 0x0, 0x2a, 0xef, 0xd9, 0x16,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x10,
+    0x0, 0xa3, 0x7f, 0xd6, 0x6d, 0xfe, 0x10, 0x1d,
+    0x72, 0x0, 0x26, 0x60, 0x3, 0x51, 0x2, 0xd5,
+    0xb8, 0x28, 0x4, 0x48, 0xd, 0x4a, 0x91, 0x40,
+    0x19, 0x40, 0x16, 0x1, 0x94, 0x80, 0x2d, 0x1,
+    0x20, 0xe, 0x40, 0x9, 0x80, 0x80, 0x3d, 0xc0,
+    0x1c, 0xe0, 0x1e, 0x10, 0xe, 0x70, 0xf, 0x8,
+    0x4, 0xc0, 0x40, 0x1e, 0xe0, 0x8, 0x80, 0x4c,
+    0x3, 0x90, 0x2, 0xb0, 0x4, 0x0, 0x67, 0x20,
+    0x8, 0xc8, 0x13, 0x61, 0xee, 0x0, 0x3b, 0x80,
+    0x4, 0xf0, 0x82, 0xa0, 0x18, 0xf5, 0x44, 0x9,
+    0xbf, 0x0, 0x38, 0xab, 0xbf, 0x64, 0x40, 0x3f,
+    0xff, 0x20,
 
     /* U+0072 "r" */
-    0xef, 0x90, 0x8d, 0xfe, 0xc6, 0xe, 0xfa, 0xdf,
-    0xff, 0xff, 0xd0, 0xef, 0xff, 0x95, 0x47, 0xd5,
-    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0xe,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0,
+    0xef, 0x90, 0x8d, 0xfe, 0xc6, 0x0, 0x8f, 0x5c,
+    0x80, 0x4e, 0xc0, 0x25, 0x26, 0xab, 0x82, 0x80,
+    0xd, 0x52, 0xa8, 0xfa, 0xa0, 0x11, 0xa8, 0x7,
+    0xf3, 0x0, 0x7f, 0x8c, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xc9,
 
     /* U+0073 "s" */
-    0x0, 0x5, 0xbe, 0xfe, 0xc8, 0x20, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xff, 0xb6,
-    0x46, 0x9f, 0xf4, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x15, 0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xda, 0x72, 0x0, 0x0, 0x2, 0xaf,
-    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x2, 0x48,
-    0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0xa6, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x7f, 0xfd,
-    0x84, 0x35, 0xaf, 0xfb, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x39, 0xde, 0xfe, 0xc6,
-    0x0, 0x0,
+    0x0, 0x96, 0xfb, 0xfb, 0x20, 0x80, 0x35, 0xd2,
+    0x8, 0x9, 0xbe, 0xc0, 0x1, 0xd0, 0x12, 0x6e,
+    0x58, 0x1, 0x80, 0xb, 0x4, 0xb6, 0x46, 0x9e,
+    0xa4, 0x0, 0x8, 0x10, 0x7, 0xa, 0x80, 0x4e,
+    0xc, 0xc0, 0xf, 0xe8, 0x0, 0x4f, 0xed, 0x39,
+    0x0, 0x62, 0xd5, 0x0, 0x12, 0xc6, 0xd8, 0x80,
+    0x45, 0x5f, 0xb6, 0xe4, 0x9, 0xa0, 0x1e, 0x24,
+    0x8d, 0x60, 0x32, 0x0, 0xfe, 0xd0, 0x3, 0x5,
+    0x30, 0x7, 0xb0, 0x0, 0xce, 0xb3, 0xb0, 0x86,
+    0xb4, 0xe0, 0x84, 0xc8, 0x4, 0xf7, 0x94, 0xa0,
+    0x54, 0x3, 0x78, 0xc4, 0x20, 0x27, 0x3a, 0x20,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0x78, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x1, 0x11, 0xff, 0x81, 0x11, 0x11, 0x10,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x8f, 0xfb, 0x54, 0x6b, 0xf3, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x8d, 0xff, 0xda, 0x40,
+    0x0, 0xcf, 0x8, 0x1, 0xff, 0x4b, 0xe0, 0x7,
+    0xff, 0x97, 0xff, 0x8, 0x3f, 0xff, 0x90, 0x3,
+    0xff, 0x85, 0xfd, 0xd0, 0x1, 0xfb, 0xbc, 0x80,
+    0x23, 0x0, 0x42, 0x3e, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf1, 0x4, 0x3, 0xfe, 0x20, 0x40, 0xe,
+    0x30, 0xe, 0x50, 0x2b, 0x54, 0x6b, 0xc3, 0x0,
+    0xd0, 0x40, 0x95, 0x72, 0x81, 0x60, 0x1d, 0xae,
+    0x40, 0x2, 0x5b, 0x80,
 
     /* U+0075 "u" */
-    0xaf, 0xc0, 0x0, 0x0, 0x5, 0xff, 0x2a, 0xfc,
-    0x0, 0x0, 0x0, 0x5f, 0xf2, 0xaf, 0xc0, 0x0,
-    0x0, 0x5, 0xff, 0x2a, 0xfc, 0x0, 0x0, 0x0,
-    0x5f, 0xf2, 0xaf, 0xc0, 0x0, 0x0, 0x5, 0xff,
-    0x2a, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0xaf,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0x2a, 0xfc, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0xaf, 0xc0, 0x0, 0x0,
-    0x5, 0xff, 0x2a, 0xfd, 0x0, 0x0, 0x0, 0x6f,
-    0xf2, 0x9f, 0xe0, 0x0, 0x0, 0x9, 0xff, 0x27,
-    0xff, 0x40, 0x0, 0x2, 0xff, 0xf2, 0x2f, 0xfe,
-    0x63, 0x26, 0xef, 0xff, 0x20, 0x7f, 0xff, 0xff,
-    0xff, 0xbf, 0xf2, 0x0, 0x4b, 0xef, 0xea, 0x35,
-    0xff, 0x20,
+    0xaf, 0xc0, 0xf, 0x2f, 0xf8, 0x80, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfd, 0x31, 0x0, 0xf1, 0x80, 0x46,
+    0x6, 0x1, 0xef, 0x0, 0xb8, 0x5, 0x0, 0x31,
+    0x30, 0x4, 0xa0, 0xa, 0x63, 0x26, 0xc0, 0xc,
+    0x50, 0x3, 0x39, 0xb2, 0x28, 0x1, 0x9e, 0xd0,
+    0x40, 0x57, 0x38, 0x2,
 
     /* U+0076 "v" */
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0xc,
-    0xfd, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x6, 0xff,
-    0x20, 0x0, 0x0, 0xbf, 0xe0, 0x1, 0xff, 0x80,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0xbf, 0xd0, 0x0,
-    0x6, 0xff, 0x20, 0x0, 0x5f, 0xf3, 0x0, 0xb,
-    0xfc, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x1f, 0xf6,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x6f, 0xf1, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0xbf, 0xb0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x7f, 0xe5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0,
+    0x2f, 0xf4, 0x0, 0x78, 0x7f, 0xd4, 0x46, 0xa,
+    0x1, 0xe7, 0x0, 0x70, 0x50, 0x11, 0x0, 0x3b,
+    0x40, 0x50, 0x1c, 0x1, 0x40, 0x18, 0x50, 0x18,
+    0x0, 0x28, 0xa, 0x1, 0x9c, 0x1, 0x40, 0x17,
+    0x1, 0x18, 0x5, 0xa0, 0x64, 0x1, 0x28, 0x85,
+    0x80, 0x5, 0x2, 0x80, 0x39, 0xc1, 0x40, 0xe,
+    0x0, 0x70, 0xe, 0xa0, 0x23, 0xd, 0x4, 0x10,
+    0xe, 0x32, 0xa, 0x4, 0xe, 0x0, 0xfa, 0x81,
+    0xd4, 0x0, 0xa0, 0x1f, 0x30, 0xd, 0x83, 0x0,
+    0x7e, 0x13, 0x1, 0xa, 0x0, 0xfe, 0xa0, 0x1,
+    0x18, 0x7, 0xf3, 0x0, 0x14, 0x3, 0x80,
 
     /* U+0077 "w" */
-    0x6f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xd0, 0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfa, 0x0, 0xdf, 0x90, 0x0, 0x46, 0x30, 0x0,
-    0xdf, 0x70, 0xa, 0xfb, 0x0, 0xf, 0xfc, 0x0,
-    0xf, 0xf4, 0x0, 0x7f, 0xe0, 0x5, 0xff, 0xf2,
-    0x2, 0xff, 0x10, 0x5, 0xff, 0x10, 0xaf, 0xff,
-    0x70, 0x4f, 0xe0, 0x0, 0x2f, 0xf3, 0xf, 0xfa,
-    0xfc, 0x6, 0xfc, 0x0, 0x0, 0xef, 0x64, 0xfd,
-    0x3f, 0xf1, 0x9f, 0x90, 0x0, 0xc, 0xf9, 0x9f,
-    0x80, 0xef, 0x6b, 0xf6, 0x0, 0x0, 0x9f, 0xce,
-    0xf3, 0x9, 0xfc, 0xdf, 0x30, 0x0, 0x6, 0xff,
-    0xfe, 0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xff, 0x90, 0x0, 0xef, 0xfd, 0x0, 0x0, 0x0,
-    0xff, 0xf4, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0,
-    0xd, 0xfe, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0x0,
+    0x6f, 0xf0, 0x80, 0x7f, 0x37, 0xf8, 0x14, 0x0,
+    0x40, 0x1f, 0xdc, 0x4, 0x6, 0x0, 0x50, 0xf,
+    0xe2, 0x7, 0x0, 0x10, 0x78, 0x4, 0x8c, 0x60,
+    0x13, 0x86, 0x80, 0x1c, 0x8, 0x2, 0xb9, 0xf0,
+    0x8, 0x80, 0xc0, 0x1a, 0xa, 0x0, 0x50, 0x1,
+    0x90, 0x10, 0x1, 0x40, 0x4, 0x2, 0x20, 0xf0,
+    0x9, 0x41, 0x80, 0x44, 0x0, 0x70, 0x1, 0x2,
+    0x82, 0x85, 0x81, 0x1, 0x0, 0x44, 0x20, 0xa8,
+    0x5, 0x20, 0x63, 0xe0, 0xa0, 0x18, 0x83, 0xf4,
+    0x14, 0xc4, 0x1c, 0x83, 0xc0, 0x32, 0x82, 0xb8,
+    0x58, 0x38, 0x53, 0x2, 0x80, 0x6f, 0x3, 0x11,
+    0x18, 0x68, 0x19, 0x1, 0x80, 0x65, 0x0, 0x9c,
+    0x0, 0x82, 0x0, 0x20, 0xe, 0x30, 0xb, 0x40,
+    0x27, 0x0, 0x38, 0x7, 0x88, 0x5, 0x0, 0x2d,
+    0x0, 0x68, 0x4,
 
     /* U+0078 "x" */
-    0xa, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xf3, 0x1,
-    0xef, 0xd0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x5f,
-    0xf7, 0x0, 0xe, 0xfd, 0x0, 0x0, 0xa, 0xff,
-    0x10, 0x8f, 0xf3, 0x0, 0x0, 0x1, 0xef, 0xa2,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x5f, 0xfd, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfb, 0xff, 0x20, 0x0, 0x0, 0x4,
-    0xff, 0x71, 0xef, 0xb0, 0x0, 0x0, 0xd, 0xfd,
-    0x0, 0x6f, 0xf6, 0x0, 0x0, 0x9f, 0xf4, 0x0,
-    0xc, 0xff, 0x10, 0x3, 0xff, 0xa0, 0x0, 0x2,
-    0xff, 0xb0, 0xd, 0xff, 0x10, 0x0, 0x0, 0x8f,
-    0xf6,
+    0xa, 0xff, 0x20, 0x7, 0x67, 0xf8, 0xc2, 0xc4,
+    0x24, 0x3, 0x29, 0x83, 0x98, 0xd, 0x81, 0x38,
+    0x5, 0x60, 0x50, 0x1, 0x2a, 0x82, 0x4, 0x20,
+    0x43, 0x80, 0x3a, 0xc4, 0x2c, 0x9c, 0x1c, 0xc0,
+    0x38, 0x6c, 0x17, 0xc0, 0xa0, 0x3, 0xe5, 0x40,
+    0x20, 0xe0, 0xf, 0xee, 0x0, 0x11, 0x80, 0x7f,
+    0x58, 0x0, 0x98, 0x3, 0xf4, 0x88, 0x20, 0x49,
+    0x0, 0x79, 0x18, 0x22, 0x84, 0x24, 0x3, 0xd2,
+    0x4, 0xe3, 0x0, 0x8c, 0x1, 0xa4, 0x82, 0x40,
+    0xc, 0x61, 0x22, 0x0, 0x36, 0x5, 0x40, 0xb,
+    0x80, 0x14, 0x0, 0xe0, 0x5, 0x80, 0x62, 0x70,
+    0x46,
 
     /* U+0079 "y" */
-    0x2f, 0xf9, 0x0, 0x0, 0x0, 0xe, 0xfa, 0xc,
-    0xfe, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x6, 0xff,
-    0x40, 0x0, 0x0, 0x9f, 0xe0, 0x0, 0xff, 0x90,
-    0x0, 0x0, 0xef, 0x90, 0x0, 0xaf, 0xf0, 0x0,
-    0x4, 0xff, 0x30, 0x0, 0x4f, 0xf5, 0x0, 0x9,
-    0xfe, 0x0, 0x0, 0xe, 0xfa, 0x0, 0xe, 0xf8,
-    0x0, 0x0, 0x8, 0xff, 0x0, 0x4f, 0xf2, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0xcf, 0xb0, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1f,
-    0xfd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x1, 0x24,
-    0xcf, 0xf2, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x7, 0xfe, 0xb4, 0x0,
-    0x0, 0x0, 0x0,
+    0x2f, 0xf4, 0x80, 0x7d, 0xdf, 0x44, 0x60, 0xe0,
+    0x1e, 0x41, 0xe, 0xa, 0x1, 0x40, 0xe, 0xd0,
+    0x14, 0x6, 0x0, 0x68, 0x7, 0x38, 0x38, 0x4,
+    0xa0, 0xc0, 0x19, 0x4, 0x28, 0x2, 0xe0, 0x2,
+    0x80, 0x5a, 0x2, 0x60, 0x12, 0x8, 0x78, 0x4,
+    0xe0, 0xc0, 0x1c, 0xc0, 0xa0, 0x4, 0x10, 0xa0,
+    0xe, 0xa0, 0x2, 0x86, 0x81, 0x10, 0x3, 0x88,
+    0xc3, 0x81, 0xc2, 0x80, 0x3e, 0xb0, 0x44, 0x8,
+    0x28, 0x7, 0xcc, 0x0, 0x90, 0x32, 0x0, 0xf8,
+    0x50, 0x8, 0x28, 0x3, 0xfb, 0x80, 0x27, 0x0,
+    0xfe, 0x50, 0x2, 0x8, 0x7, 0xf0, 0x80, 0x34,
+    0x3, 0xfc, 0xc0, 0x7, 0x0, 0xff, 0x50, 0x28,
+    0x80, 0x78, 0x49, 0x30, 0x82, 0x0, 0x3e, 0x6d,
+    0xb3, 0x9, 0x20, 0xf, 0xe1, 0x4b, 0x60, 0xf,
+    0x80,
 
     /* U+007A "z" */
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x1, 0x22, 0x22,
-    0x22, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x54, 0x44, 0x44, 0x44, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0,
+    0xa, 0xff, 0xfe, 0xb0, 0xf, 0xfe, 0x1d, 0xee,
+    0xf9, 0xc0, 0x18, 0x0, 0x12, 0x2e, 0x7, 0x5,
+    0x70, 0xf, 0xde, 0x5, 0x40, 0x1f, 0xa8, 0x83,
+    0x80, 0x3f, 0x32, 0x84, 0x98, 0x7, 0xc7, 0x20,
+    0xac, 0x1, 0xfb, 0x80, 0xa8, 0x3, 0xf5, 0x10,
+    0x78, 0x7, 0xe6, 0x50, 0xa2, 0x0, 0xf8, 0xe4,
+    0x19, 0x40, 0x3f, 0x70, 0xe, 0x22, 0x7c, 0x8,
+    0x40, 0x35, 0x77, 0xf0, 0x7, 0xff, 0x8,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x9f, 0xfd, 0x0, 0x8, 0xff, 0xa8,
-    0x0, 0xe, 0xf8, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0x1f, 0xf2, 0x0, 0x0, 0x6f, 0xf0, 0x0,
-    0x2, 0xef, 0x80, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x4f, 0xfa, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0,
-    0x0, 0x6f, 0xf0, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0xf, 0xf3, 0x0, 0x0, 0xf, 0xf3, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0xe, 0xf7, 0x0,
-    0x0, 0x8, 0xff, 0x97, 0x0, 0x0, 0x9f, 0xfd,
+    0x0, 0xd3, 0xfe, 0xd0, 0xa, 0x18, 0x15, 0x40,
+    0x13, 0x3, 0xd4, 0x0, 0x42, 0x18, 0x1, 0xf3,
+    0x80, 0x7f, 0xf4, 0x4, 0x0, 0x20, 0x19, 0xc0,
+    0x4, 0x1, 0x14, 0x3, 0x80, 0x49, 0xa2, 0xd0,
+    0x1, 0xe3, 0x0, 0xc9, 0xc2, 0xb0, 0x1, 0x86,
+    0x1, 0xc0, 0x39, 0xc0, 0x4, 0x1, 0x84, 0x0,
+    0x20, 0x1f, 0xfd, 0x37, 0x0, 0xe1, 0x3, 0x0,
+    0xe6, 0x8, 0x97, 0x0, 0xa1, 0x81, 0xa8,
 
     /* U+007C "|" */
-    0xbf, 0x3b, 0xf3, 0xbf, 0x3b, 0xf3, 0xbf, 0x3b,
-    0xf3, 0xbf, 0x3b, 0xf3, 0xbf, 0x3b, 0xf3, 0xbf,
-    0x3b, 0xf3, 0xbf, 0x3b, 0xf3, 0xbf, 0x3b, 0xf3,
-    0xbf, 0x3b, 0xf3, 0xbf, 0x3b, 0xf3, 0xbf, 0x3b,
-    0xf3, 0xbf, 0x3b, 0xf3, 0xbf, 0x3b, 0xf3, 0x58,
-    0x10,
+    0xbf, 0x30, 0xf, 0xff, 0xff, 0x39, 0x0,
 
     /* U+007D "}" */
-    0x5f, 0xfd, 0x50, 0x0, 0x28, 0xaf, 0xf2, 0x0,
-    0x0, 0xd, 0xf6, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0xa, 0xf8, 0x0,
-    0x0, 0x9, 0xfa, 0x0, 0x0, 0x6, 0xfe, 0x0,
-    0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x2d, 0xfc,
-    0x0, 0x0, 0x4e, 0xfb, 0x0, 0x1, 0xff, 0x60,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0xa, 0xf9, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0xf, 0xf6, 0x0,
-    0x29, 0xcf, 0xf1, 0x0, 0x5f, 0xfd, 0x40, 0x0,
+    0x5f, 0xf6, 0xa8, 0x4, 0xee, 0x52, 0xa2, 0x0,
+    0x14, 0x51, 0x2, 0x0, 0x73, 0x7, 0x0, 0x7f,
+    0xf4, 0x44, 0x3, 0xe3, 0x2, 0x0, 0xef, 0x4,
+    0x0, 0xe6, 0x11, 0x48, 0x7, 0x61, 0x36, 0x0,
+    0x66, 0x30, 0x70, 0x8, 0x6c, 0x66, 0xc0, 0x26,
+    0x2, 0x60, 0xd, 0xa0, 0x80, 0x1c, 0x20, 0x20,
+    0x1f, 0xfd, 0x17, 0x0, 0xf8, 0xc3, 0x80, 0x5,
+    0x38, 0x0, 0x70, 0x3, 0xb1, 0x95, 0x88, 0x0,
 
     /* U+007E "~" */
-    0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0x92, 0x0, 0x2, 0xc2, 0xd, 0xff,
-    0xff, 0xff, 0xa4, 0x5e, 0xfc, 0x3f, 0xe4, 0x3,
-    0xaf, 0xff, 0xff, 0xe2, 0x2, 0x30, 0x0, 0x2,
-    0x9e, 0xea, 0x20
+    0x0, 0x84, 0x80, 0x3f, 0xc3, 0x5d, 0xbf, 0x24,
+    0x1, 0x16, 0x10, 0x62, 0x80, 0x4d, 0xb4, 0x8b,
+    0x87, 0xc6, 0x43, 0x7f, 0x8a, 0xb, 0x74, 0x22,
+    0xe3, 0xdd, 0x20, 0x1d, 0x6b, 0x8, 0x97, 0x8,
 };
 
 
@@ -1674,99 +1145,99 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 264, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 264, .box_w = 4, .box_h = 21, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 42, .adv_w = 264, .box_w = 7, .box_h = 7, .ofs_x = 5, .ofs_y = 14},
-    {.bitmap_index = 67, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 225, .adv_w = 264, .box_w = 15, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 420, .adv_w = 264, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 616, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 795, .adv_w = 264, .box_w = 4, .box_h = 7, .ofs_x = 6, .ofs_y = 14},
-    {.bitmap_index = 809, .adv_w = 264, .box_w = 8, .box_h = 26, .ofs_x = 5, .ofs_y = -4},
-    {.bitmap_index = 913, .adv_w = 264, .box_w = 8, .box_h = 26, .ofs_x = 4, .ofs_y = -4},
-    {.bitmap_index = 1017, .adv_w = 264, .box_w = 10, .box_h = 10, .ofs_x = 3, .ofs_y = 11},
-    {.bitmap_index = 1067, .adv_w = 264, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1165, .adv_w = 264, .box_w = 5, .box_h = 9, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 1188, .adv_w = 264, .box_w = 10, .box_h = 3, .ofs_x = 3, .ofs_y = 7},
-    {.bitmap_index = 1203, .adv_w = 264, .box_w = 4, .box_h = 4, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 1211, .adv_w = 264, .box_w = 10, .box_h = 23, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 1326, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1463, .adv_w = 264, .box_w = 12, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 1589, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1726, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1863, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2010, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2147, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2284, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2421, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2568, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2705, .adv_w = 264, .box_w = 4, .box_h = 12, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 2729, .adv_w = 264, .box_w = 4, .box_h = 16, .ofs_x = 6, .ofs_y = -4},
-    {.bitmap_index = 2761, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 2859, .adv_w = 264, .box_w = 14, .box_h = 8, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2915, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 1},
-    {.bitmap_index = 3013, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3150, .adv_w = 264, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3326, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3505, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3663, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3821, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3979, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4137, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4284, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4452, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4620, .adv_w = 264, .box_w = 12, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4746, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4883, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5051, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5188, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5346, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5493, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5661, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5819, .adv_w = 264, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6003, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6161, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6329, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6487, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6645, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6824, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6992, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7171, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7339, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7497, .adv_w = 264, .box_w = 6, .box_h = 24, .ofs_x = 6, .ofs_y = -3},
-    {.bitmap_index = 7569, .adv_w = 264, .box_w = 10, .box_h = 23, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 7684, .adv_w = 264, .box_w = 6, .box_h = 24, .ofs_x = 5, .ofs_y = -3},
-    {.bitmap_index = 7756, .adv_w = 264, .box_w = 15, .box_h = 11, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 7839, .adv_w = 264, .box_w = 16, .box_h = 2, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 7855, .adv_w = 264, .box_w = 6, .box_h = 7, .ofs_x = 5, .ofs_y = 16},
-    {.bitmap_index = 7876, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7974, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8117, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8215, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8358, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8456, .adv_w = 264, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8621, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 8758, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8901, .adv_w = 264, .box_w = 12, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9027, .adv_w = 264, .box_w = 8, .box_h = 27, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 9135, .adv_w = 264, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9289, .adv_w = 264, .box_w = 12, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9421, .adv_w = 264, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9534, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9632, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9730, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 9867, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 10004, .adv_w = 264, .box_w = 11, .box_h = 15, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 10087, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10185, .adv_w = 264, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10325, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10423, .adv_w = 264, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10528, .adv_w = 264, .box_w = 17, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10656, .adv_w = 264, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10761, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 10908, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11006, .adv_w = 264, .box_w = 8, .box_h = 24, .ofs_x = 4, .ofs_y = -3},
-    {.bitmap_index = 11102, .adv_w = 264, .box_w = 3, .box_h = 27, .ofs_x = 7, .ofs_y = -5},
-    {.bitmap_index = 11143, .adv_w = 264, .box_w = 8, .box_h = 24, .ofs_x = 4, .ofs_y = -3},
-    {.bitmap_index = 11239, .adv_w = 264, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 7}
+    {.bitmap_index = 32, .adv_w = 264, .box_w = 7, .box_h = 7, .ofs_x = 5, .ofs_y = 14},
+    {.bitmap_index = 58, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 191, .adv_w = 264, .box_w = 15, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 328, .adv_w = 264, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 488, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 635, .adv_w = 264, .box_w = 4, .box_h = 7, .ofs_x = 6, .ofs_y = 14},
+    {.bitmap_index = 649, .adv_w = 264, .box_w = 8, .box_h = 26, .ofs_x = 5, .ofs_y = -4},
+    {.bitmap_index = 737, .adv_w = 264, .box_w = 8, .box_h = 26, .ofs_x = 4, .ofs_y = -4},
+    {.bitmap_index = 824, .adv_w = 264, .box_w = 10, .box_h = 10, .ofs_x = 3, .ofs_y = 11},
+    {.bitmap_index = 872, .adv_w = 264, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 901, .adv_w = 264, .box_w = 5, .box_h = 9, .ofs_x = 4, .ofs_y = -5},
+    {.bitmap_index = 921, .adv_w = 264, .box_w = 10, .box_h = 3, .ofs_x = 3, .ofs_y = 7},
+    {.bitmap_index = 929, .adv_w = 264, .box_w = 4, .box_h = 4, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 936, .adv_w = 264, .box_w = 10, .box_h = 23, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 1014, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1126, .adv_w = 264, .box_w = 12, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 1170, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1273, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1382, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1475, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1566, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1680, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1769, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1900, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2012, .adv_w = 264, .box_w = 4, .box_h = 12, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 2029, .adv_w = 264, .box_w = 4, .box_h = 16, .ofs_x = 6, .ofs_y = -4},
+    {.bitmap_index = 2054, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 2126, .adv_w = 264, .box_w = 14, .box_h = 8, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 2146, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 1},
+    {.bitmap_index = 2219, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2314, .adv_w = 264, .box_w = 16, .box_h = 22, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2475, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2607, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2709, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2817, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2901, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2948, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2984, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3110, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3142, .adv_w = 264, .box_w = 12, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3181, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3236, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3344, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3367, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3453, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3541, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3656, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3731, .adv_w = 264, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3863, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3959, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4090, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4121, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4184, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4318, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4472, .adv_w = 264, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4611, .adv_w = 264, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4704, .adv_w = 264, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4799, .adv_w = 264, .box_w = 6, .box_h = 24, .ofs_x = 6, .ofs_y = -3},
+    {.bitmap_index = 4819, .adv_w = 264, .box_w = 10, .box_h = 23, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 4895, .adv_w = 264, .box_w = 6, .box_h = 24, .ofs_x = 5, .ofs_y = -3},
+    {.bitmap_index = 4914, .adv_w = 264, .box_w = 15, .box_h = 11, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 4977, .adv_w = 264, .box_w = 16, .box_h = 2, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4986, .adv_w = 264, .box_w = 6, .box_h = 7, .ofs_x = 5, .ofs_y = 16},
+    {.bitmap_index = 5007, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5090, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5175, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5253, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5342, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5424, .adv_w = 264, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5491, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 5607, .adv_w = 264, .box_w = 13, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5659, .adv_w = 264, .box_w = 12, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5703, .adv_w = 264, .box_w = 8, .box_h = 27, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 5745, .adv_w = 264, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5824, .adv_w = 264, .box_w = 12, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5859, .adv_w = 264, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5910, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5955, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6042, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 6132, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 6222, .adv_w = 264, .box_w = 11, .box_h = 15, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 6256, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6344, .adv_w = 264, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6404, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6448, .adv_w = 264, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6535, .adv_w = 264, .box_w = 17, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6650, .adv_w = 264, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6739, .adv_w = 264, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 6852, .adv_w = 264, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6915, .adv_w = 264, .box_w = 8, .box_h = 24, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 6978, .adv_w = 264, .box_w = 3, .box_h = 27, .ofs_x = 7, .ofs_y = -5},
+    {.bitmap_index = 6985, .adv_w = 264, .box_w = 8, .box_h = 24, .ofs_x = 4, .ofs_y = -3},
+    {.bitmap_index = 7049, .adv_w = 264, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 7}
 };
 
 /*---------------------
@@ -1808,7 +1279,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 1,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
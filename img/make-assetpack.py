@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+皮肤资源包生成脚本
+将调色板、字体包和 PNG 图标打包为一个资源包 (格式见 app/asset_pack.h)，
+烧录到 skin 分区后由固件直接映射使用，无需拷贝到 RAM
+
+使用方法:
+    python3 make-assetpack.py skin.json [-o skin.bin]
+
+skin.json 示例:
+    {
+        "name": "carbon",
+        "palettes": {
+            "day":   {"bg": "0xFFFFFF", "text_main": "0x000000", ...},
+            "night": {"bg": "0x000000", "text_main": "0xFFFFFF", ...}
+        },
+        "fonts": {
+            "speed": "speed_48.bin"
+        },
+        "images": {
+            "left_turn": "left_turn.png",
+            "gauge_bg": "gauge_bg.png"
+        }
+    }
+
+    未列出的资源使用固件内置资源。字体包由 fonts/make-fontpack.py 生成。
+    相对路径以 skin.json 所在目录为基准。
+
+烧录:
+    parttool.py write_partition --partition-name skin --input skin.bin
+
+模拟器:
+    将 skin.bin 放到 $EBIKE_ASSET_DIR 目录下 (默认 ../fonts/out)
+
+依赖:
+    - pypng: pip3 install pypng
+    - lz4: pip3 install lz4 (如果使用 LZ4 压缩)
+"""
+
+import argparse
+import binascii
+import json
+import struct
+import sys
+from pathlib import Path
+
+# 添加 simulator/lvgl/scripts 目录到路径，以便导入 LVGLImage
+script_dir = Path(__file__).parent
+lvgl_scripts_dir = script_dir.parent / "simulator" / "lvgl" / "scripts"
+sys.path.insert(0, str(lvgl_scripts_dir))
+
+try:
+    from LVGLImage import (
+        LVGLImage, ColorFormat, CompressMethod, LVGLCompressData
+    )
+except ImportError as e:
+    print(f"错误: 无法导入 LVGLImage 模块: {e}")
+    print("请确保 simulator/lvgl/scripts/LVGLImage.py 存在")
+    sys.exit(1)
+
+# 与 app/asset_pack.h 保持一致
+PACK_MAGIC = 0x50414245  # "EBAP"
+PACK_VERSION = 1
+HEADER_FMT = "<IHHII16s"
+ENTRY_FMT = "<HHII"
+
+TYPE_PALETTE = 1
+TYPE_FONT = 2
+TYPE_IMAGE = 3
+
+PALETTE_IDS = {"day": 0, "night": 1}
+PALETTE_FIELDS = ["bg", "text_main", "text_dim", "line", "border",
+                  "text_alert", "needle", "energy_regen", "energy_consume"]
+FONT_IDS = {"title": 0, "value": 1, "clock": 2, "speed": 3, "energy": 4}
+IMAGE_IDS = {"left_turn": 0, "right_turn": 1, "high_beam": 2, "gauge_bg": 3}
+
+LV_IMAGE_HEADER_MAGIC = 0x19
+LV_IMAGE_FLAGS_COMPRESSED = 0x0008
+
+
+def parse_color(v) -> int:
+    """颜色可以是整数或 "0xRRGGBB" / "#RRGGBB" 字符串"""
+    if isinstance(v, int):
+        return v
+    return int(v.replace("#", "0x"), 0)
+
+
+def build_palette(name: str, colors: dict) -> bytes:
+    missing = [f for f in PALETTE_FIELDS if f not in colors]
+    if missing:
+        raise ValueError(f"调色板 {name} 缺少颜色: {', '.join(missing)}")
+    return struct.pack("<9I", *[parse_color(colors[f]) for f in PALETTE_FIELDS])
+
+
+def build_image(png: Path, cf: ColorFormat, compress: CompressMethod) -> bytes:
+    """lv_image_header_t + 像素数据，与 LVGL 的 .bin 图片格式相同"""
+    img = LVGLImage().from_png(str(png), cf)
+    img.adjust_stride(align=1)
+
+    flags = 0
+    data = img.data
+    if compress != CompressMethod.NONE:
+        data = LVGLCompressData(img.cf, compress, img.data).compressed
+        flags |= LV_IMAGE_FLAGS_COMPRESSED
+
+    header = struct.pack("<BBHHHHH", LV_IMAGE_HEADER_MAGIC, img.cf.value,
+                         flags, img.w, img.h, img.stride, 0)
+    return header + bytes(data)
+
+
+def align4(n: int) -> int:
+    return (n + 3) & ~3
+
+
+def build_pack(skin: dict, base_dir: Path, cf: ColorFormat,
+               compress: CompressMethod) -> bytes:
+    name = skin.get("name", "")
+    if not name or len(name.encode("utf-8")) > 15:
+        raise ValueError("name 不能为空，且不超过 15 字节")
+
+    entries = []  # (type, id, data)
+    for key, colors in skin.get("palettes", {}).items():
+        if key not in PALETTE_IDS:
+            raise ValueError(f"未知调色板: {key}")
+        entries.append((TYPE_PALETTE, PALETTE_IDS[key],
+                        build_palette(key, colors)))
+    for key, path in skin.get("fonts", {}).items():
+        if key not in FONT_IDS:
+            raise ValueError(f"未知字体: {key}")
+        entries.append((TYPE_FONT, FONT_IDS[key],
+                        (base_dir / path).read_bytes()))
+    for key, path in skin.get("images", {}).items():
+        if key not in IMAGE_IDS:
+            raise ValueError(f"未知图片: {key}")
+        entries.append((TYPE_IMAGE, IMAGE_IDS[key],
+                        build_image(base_dir / path, cf, compress)))
+
+    # 每个条目按 4 字节对齐，固件直接按结构体访问
+    header_size = struct.calcsize(HEADER_FMT)
+    offset = align4(header_size + len(entries) * struct.calcsize(ENTRY_FMT))
+    table = b""
+    body = b""
+    for etype, eid, data in entries:
+        table += struct.pack(ENTRY_FMT, etype, eid, offset, len(data))
+        padded = data + b"\0" * (align4(len(data)) - len(data))
+        body += padded
+        offset += len(padded)
+
+    payload = table
+    payload += b"\0" * (align4(header_size + len(table)) - header_size - len(table))
+    payload += body
+    total = header_size + len(payload)
+    crc = binascii.crc32(payload) & 0xFFFFFFFF
+    header = struct.pack(HEADER_FMT, PACK_MAGIC, PACK_VERSION, len(entries),
+                         total, crc, name.encode("utf-8"))
+    return header + payload
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='皮肤资源包生成工具 - 将调色板、字体包和图标打包为 skin.bin'
+    )
+    parser.add_argument('skin', type=str, help='皮肤描述文件 (JSON)')
+    parser.add_argument('-o', '--output', type=str, default='skin.bin',
+                        help='输出文件 (默认: skin.bin)')
+    parser.add_argument('--cf', type=str, default='ARGB8888',
+                        help='图片颜色格式 (默认: ARGB8888)')
+    parser.add_argument('--compress', type=str, default='NONE',
+                        choices=['NONE', 'RLE', 'LZ4'],
+                        help='图片压缩方式 (默认: NONE, 直接从 flash 绘制)')
+    parser.add_argument('--max-size', type=lambda x: int(x, 0), default=0x40000,
+                        help='分区大小 (默认: 0x40000)')
+    args = parser.parse_args()
+
+    skin_path = Path(args.skin)
+    skin = json.loads(skin_path.read_text(encoding='utf-8'))
+
+    try:
+        pack = build_pack(skin, skin_path.parent, ColorFormat[args.cf],
+                          CompressMethod[args.compress])
+    except (ValueError, KeyError, OSError) as e:
+        print(f"错误: {e}")
+        sys.exit(1)
+
+    if len(pack) > args.max_size:
+        print(f"错误: 资源包 {len(pack)} 字节，超过分区大小 {args.max_size} 字节")
+        sys.exit(1)
+
+    Path(args.output).write_bytes(pack)
+    print(f"完成! 已生成 {args.output} ({len(pack)} 字节)")
+
+
+if __name__ == "__main__":
+    main()
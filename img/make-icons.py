@@ -7,9 +7,12 @@ LVGL 图标生成脚本
     python3 make-icons.py [选项]
 
 示例:
-    # 使用默认参数 (ARGB8888, 无压缩)
+    # 使用默认参数 (ARGB8888, LZ4 压缩)
     python3 make-icons.py
 
+    # 不压缩
+    python3 make-icons.py --compress NONE
+
     # 使用 RGB565 格式，LZ4 压缩
     python3 make-icons.py --cf RGB565 --compress LZ4
 
@@ -51,7 +54,7 @@ class IconsGenerator:
                  output_c: str = None,
                  output_h: str = None,
                  color_format: str = "ARGB8888",
-                 compress: str = "NONE",
+                 compress: str = "LZ4",
                  align: int = 1,
                  premultiply: bool = False,
                  background: int = 0x000000,
@@ -305,9 +308,9 @@ def main():
     parser.add_argument(
         '--compress',
         type=str,
-        default='NONE',
+        default='LZ4',
         choices=['NONE', 'RLE', 'LZ4'],
-        help='压缩方式 (默认: NONE)'
+        help='压缩方式 (默认: LZ4, 运行时由 LVGL 解码并缓存)'
     )
     parser.add_argument(
         '--align',
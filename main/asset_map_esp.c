@@ -0,0 +1,41 @@
+/*
+ * Asset mapping on the ESP32-S3: each asset blob lives in its own data
+ * partition and is mapped into the data address space through the flash
+ * cache, so it can be used in place.
+ */
+
+#include "../app/asset_map.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+
+static const char* TAG = "asset_map";
+
+bool asset_map_open(const char* name, asset_map_t* map) {
+    const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+    if (part == NULL) {
+        ESP_LOGW(TAG, "partition '%s' not found", name);
+        return false;
+    }
+
+    const void*                   ptr    = NULL;
+    esp_partition_mmap_handle_t handle = 0;
+    esp_err_t                     err    = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "mmap of '%s' failed: %s", name, esp_err_to_name(err));
+        return false;
+    }
+
+    map->data   = ptr;
+    map->size   = part->size;
+    map->handle = (void*)(uintptr_t)handle;
+    return true;
+}
+
+void asset_map_close(asset_map_t* map) {
+    if (map->data) {
+        esp_partition_munmap((esp_partition_mmap_handle_t)(uintptr_t)map->handle);
+    }
+    map->data   = NULL;
+    map->size   = 0;
+    map->handle = NULL;
+}
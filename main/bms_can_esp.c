@@ -0,0 +1,81 @@
+/*
+ * BMS bus on the ESP32-S3: the TWAI controller with a hardware acceptance
+ * filter for the BMS's ID window, so other nodes' frames never reach the
+ * CPU. A receive task blocks in twai_receive() and decodes each frame as it
+ * arrives.
+ */
+
+#include "../app/bms_can.h"
+#include "driver/twai.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "bms";
+
+#define BMS_TASK_STACK    3072
+#define BMS_TASK_PRIORITY 3 /* above the LVGL task, with the controller link */
+#define BMS_RX_QUEUE_LEN  32 /* a full cell report burst and then some */
+
+#if CONFIG_DASH_BMS_CAN_125K
+#define BMS_CAN_TIMING TWAI_TIMING_CONFIG_125KBITS()
+#elif CONFIG_DASH_BMS_CAN_250K
+#define BMS_CAN_TIMING TWAI_TIMING_CONFIG_250KBITS()
+#elif CONFIG_DASH_BMS_CAN_500K
+#define BMS_CAN_TIMING TWAI_TIMING_CONFIG_500KBITS()
+#else
+#define BMS_CAN_TIMING TWAI_TIMING_CONFIG_1MBITS()
+#endif
+
+static void bms_rx_task(void* arg) {
+    (void)arg;
+    twai_message_t msg;
+    for (;;) {
+        if (twai_receive(&msg, portMAX_DELAY) != ESP_OK) {
+            continue;
+        }
+        if (msg.extd || msg.rtr) {
+            continue;
+        }
+        bms_can_frame(msg.identifier, msg.data, msg.data_length_code, lv_tick_get());
+    }
+}
+
+bool bms_can_platform_init(void) {
+    if (CONFIG_DASH_BMS_CAN_RX_GPIO < 0 || CONFIG_DASH_BMS_CAN_TX_GPIO < 0) {
+        ESP_LOGI(TAG, "no CAN bus fitted");
+        return false;
+    }
+
+    twai_general_config_t g_cfg =
+        TWAI_GENERAL_CONFIG_DEFAULT(CONFIG_DASH_BMS_CAN_TX_GPIO, CONFIG_DASH_BMS_CAN_RX_GPIO, TWAI_MODE_NORMAL);
+    g_cfg.rx_queue_len = BMS_RX_QUEUE_LEN;
+    g_cfg.tx_queue_len = 0;
+    twai_timing_config_t t_cfg = BMS_CAN_TIMING;
+    /* Standard IDs sit in bits 31..21; the low bits of the window are
+     * don't-care, the RTR and data bytes too */
+    twai_filter_config_t f_cfg = {
+        .acceptance_code = (uint32_t)CONFIG_DASH_BMS_CAN_BASE << 21,
+        .acceptance_mask = ((uint32_t)(BMS_CAN_IDS - 1) << 21) | 0x1FFFFF,
+        .single_filter   = true,
+    };
+
+    esp_err_t err = twai_driver_install(&g_cfg, &t_cfg, &f_cfg);
+    if (err == ESP_OK) {
+        err = twai_start();
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "TWAI: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    if (xTaskCreate(bms_rx_task, "bms_rx", BMS_TASK_STACK, NULL, BMS_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "receive task not created");
+        return false;
+    }
+    ESP_LOGI(TAG, "CAN on GPIO %d/%d, IDs 0x%03X..0x%03X", CONFIG_DASH_BMS_CAN_TX_GPIO, CONFIG_DASH_BMS_CAN_RX_GPIO,
+             CONFIG_DASH_BMS_CAN_BASE, CONFIG_DASH_BMS_CAN_BASE + BMS_CAN_IDS - 1);
+    return true;
+}
@@ -0,0 +1,96 @@
+/*
+ * Motor controller link on the ESP32-S3: the UART driver's interrupt moves
+ * the RX FIFO into the driver ring, and a receive task reads from there
+ * straight into the decoder ring (ctrl_rx_reserve) and decodes in place.
+ * The task blocks in uart_read_bytes() and only wakes when bytes arrive or
+ * the read times out, so an idle or missing controller costs nothing. The
+ * time spent decoding is measured and reported once a second
+ * (ctrl_stats_t.load_ppm, shown on the settings page).
+ */
+
+#include "../app/ctrl_uart.h"
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "ctrl";
+
+#define CTRL_UART_PORT      CONFIG_DASH_CTRL_UART_PORT
+#define CTRL_TASK_STACK     3072
+#define CTRL_TASK_PRIORITY  3 /* above the LVGL task: the ring must not fill */
+#define CTRL_READ_WAIT_MS   10 /* latency bound for a frame split across reads */
+#define CTRL_LOAD_WINDOW_US 1000000
+
+static int64_t busy_us;
+
+static void ctrl_decode_timed(void) {
+    int64_t t0 = esp_timer_get_time();
+    ctrl_decode(lv_tick_get());
+    busy_us += esp_timer_get_time() - t0;
+}
+
+static void ctrl_rx_task(void* arg) {
+    (void)arg;
+    int64_t window_start = esp_timer_get_time();
+    for (;;) {
+        uint32_t space;
+        uint8_t* dst = ctrl_rx_reserve(&space);
+        if (space == 0) {
+            /* Not reached: every read is decoded before the next one */
+            ctrl_decode_timed();
+            continue;
+        }
+        int n = uart_read_bytes(CTRL_UART_PORT, dst, space, pdMS_TO_TICKS(CTRL_READ_WAIT_MS));
+        if (n > 0) {
+            ctrl_rx_commit((uint32_t)n);
+            ctrl_decode_timed();
+        }
+
+        int64_t now = esp_timer_get_time();
+        if (now - window_start >= CTRL_LOAD_WINDOW_US) {
+            ctrl_report_load((uint32_t)busy_us, (uint32_t)(now - window_start));
+            busy_us = 0;
+            window_start = now;
+        }
+    }
+}
+
+bool ctrl_platform_init(void) {
+    if (CONFIG_DASH_CTRL_UART_RX_GPIO < 0) {
+        ESP_LOGI(TAG, "no controller link fitted");
+        return false;
+    }
+
+    const uart_config_t cfg = {
+        .baud_rate  = CONFIG_DASH_CTRL_UART_BAUD,
+        .data_bits  = UART_DATA_8_BITS,
+        .parity     = UART_PARITY_DISABLE,
+        .stop_bits  = UART_STOP_BITS_1,
+        .flow_ctrl  = UART_HW_FLOWCTRL_DISABLE,
+        .source_clk = UART_SCLK_DEFAULT,
+    };
+    esp_err_t err = uart_driver_install(CTRL_UART_PORT, 2 * CTRL_RX_RING, 0, 0, NULL, 0);
+    if (err == ESP_OK) {
+        err = uart_param_config(CTRL_UART_PORT, &cfg);
+    }
+    if (err == ESP_OK) {
+        err = uart_set_pin(CTRL_UART_PORT, UART_PIN_NO_CHANGE, CONFIG_DASH_CTRL_UART_RX_GPIO, UART_PIN_NO_CHANGE,
+                           UART_PIN_NO_CHANGE);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "UART%d: %s", CTRL_UART_PORT, esp_err_to_name(err));
+        return false;
+    }
+
+    if (xTaskCreate(ctrl_rx_task, "ctrl_rx", CTRL_TASK_STACK, NULL, CTRL_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "receive task not created");
+        return false;
+    }
+    ESP_LOGI(TAG, "UART%d RX on GPIO %d, %d baud", CTRL_UART_PORT, CONFIG_DASH_CTRL_UART_RX_GPIO,
+             CONFIG_DASH_CTRL_UART_BAUD);
+    return true;
+}
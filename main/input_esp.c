@@ -0,0 +1,96 @@
+/*
+ * Switch input on the ESP32-S3: every fitted switch has a GPIO interrupt on
+ * both edges. The ISR time stamps and queues the edge and wakes the LVGL
+ * task, which runs input_process() before its next lv_timer_handler().
+ * Idle switches cost nothing: there is no polling timer.
+ */
+
+#include <stdint.h>
+#include "../app/input.h"
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "input";
+
+#if CONFIG_DASH_INPUT_ACTIVE_LOW
+#define INPUT_ACTIVE_LEVEL 0
+#else
+#define INPUT_ACTIVE_LEVEL 1
+#endif
+
+/* Task woken on every edge; the LVGL task, set in app_main */
+TaskHandle_t input_notify_task;
+
+static const int input_gpios[INPUT_COUNT] = {
+    [INPUT_LEFT_TURN]  = CONFIG_DASH_INPUT_GPIO_LEFT,
+    [INPUT_RIGHT_TURN] = CONFIG_DASH_INPUT_GPIO_RIGHT,
+    [INPUT_HIGH_BEAM]  = CONFIG_DASH_INPUT_GPIO_HIGH_BEAM,
+    [INPUT_GEAR_UP]    = CONFIG_DASH_INPUT_GPIO_GEAR_UP,
+    [INPUT_GEAR_DOWN]  = CONFIG_DASH_INPUT_GPIO_GEAR_DOWN,
+};
+
+uint32_t input_now_us(void) {
+    return (uint32_t)esp_timer_get_time();
+}
+
+/* All switch interrupts are served by the GPIO ISR service on one core, so
+ * there is a single producer for the edge queue */
+static void input_gpio_isr(void* arg) {
+    input_id_t id = (input_id_t)(uintptr_t)arg;
+    bool active   = gpio_get_level(input_gpios[id]) == INPUT_ACTIVE_LEVEL;
+
+    input_edge(id, active, input_now_us());
+    if (input_notify_task) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(input_notify_task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void input_platform_init(void) {
+    uint64_t mask = 0;
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        if (input_gpios[i] >= 0) {
+            mask |= 1ULL << input_gpios[i];
+        }
+    }
+    if (mask == 0) {
+        ESP_LOGI(TAG, "no switch inputs fitted");
+        return;
+    }
+
+    gpio_config_t cfg = {
+        .pin_bit_mask = mask,
+        .mode         = GPIO_MODE_INPUT,
+        .pull_up_en   = INPUT_ACTIVE_LEVEL == 0 ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+        .pull_down_en = INPUT_ACTIVE_LEVEL == 0 ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE,
+        .intr_type    = GPIO_INTR_ANYEDGE,
+    };
+    ESP_ERROR_CHECK(gpio_config(&cfg));
+
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "GPIO ISR service: %s", esp_err_to_name(err));
+        return;
+    }
+
+    /* Switches already on at power-up, queued before any ISR is attached so
+     * the single-producer rule holds. Buttons held at power-up are ignored. */
+    for (int i = 0; i <= INPUT_HIGH_BEAM; i++) {
+        if (input_gpios[i] >= 0 && gpio_get_level(input_gpios[i]) == INPUT_ACTIVE_LEVEL) {
+            input_edge((input_id_t)i, true, input_now_us());
+        }
+    }
+
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        if (input_gpios[i] < 0) {
+            continue;
+        }
+        ESP_ERROR_CHECK(gpio_isr_handler_add(input_gpios[i], input_gpio_isr, (void*)(uintptr_t)i));
+        ESP_LOGI(TAG, "%s on GPIO %d", input_name((input_id_t)i), input_gpios[i]);
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Journal area on the ESP32-S3: the "journal" data partition, accessed
+ * through the partition API (not memory-mapped, the journal is small and
+ * only read at boot).
+ */
+
+#include "../app/journal.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+
+static const char* TAG = "journal";
+
+static const esp_partition_t* journal_part;
+
+uint32_t journal_platform_open(void) {
+    journal_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "journal");
+    if (journal_part == NULL) {
+        ESP_LOGW(TAG, "partition 'journal' not found, odometer is not persisted");
+        return 0;
+    }
+    if (journal_part->erase_size != JOURNAL_SECTOR_SIZE) {
+        ESP_LOGE(TAG, "unexpected erase size %u", (unsigned)journal_part->erase_size);
+        journal_part = NULL;
+        return 0;
+    }
+    return journal_part->size;
+}
+
+bool journal_platform_read(uint32_t addr, void* buf, uint32_t len) {
+    return journal_part && esp_partition_read(journal_part, addr, buf, len) == ESP_OK;
+}
+
+bool journal_platform_write(uint32_t addr, const void* buf, uint32_t len) {
+    if (journal_part == NULL) {
+        return false;
+    }
+    esp_err_t err = esp_partition_write(journal_part, addr, buf, len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "write at 0x%x failed: %s", (unsigned)addr, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+bool journal_platform_erase(uint32_t addr) {
+    if (journal_part == NULL) {
+        return false;
+    }
+    esp_err_t err = esp_partition_erase_range(journal_part, addr, JOURNAL_SECTOR_SIZE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "erase at 0x%x failed: %s", (unsigned)addr, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
@@ -19,6 +19,7 @@
 #include "sdkconfig.h"
 
 #include "../app/dashboard.h"
+#include "../app/input.h"
 
 static const char* TAG = "example";
 
@@ -120,6 +121,7 @@ static void example_lvgl_port_task(void* arg) {
     uint32_t time_till_next_ms = 0;
     while (1) {
         _lock_acquire(&lvgl_api_lock);
+        input_process();
         time_till_next_ms = lv_timer_handler();
         _lock_release(&lvgl_api_lock);
 
@@ -128,7 +130,8 @@ static void example_lvgl_port_task(void* arg) {
             time_till_next_ms = 10;
         }
 
-        usleep(1000 * time_till_next_ms);
+        // switch edges end the wait early (see input_esp.c)
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(time_till_next_ms));
     }
 }
 
@@ -150,6 +153,7 @@ static void example_bsp_set_lcd_backlight(uint32_t level) {
 
 
 extern void example_lvgl_demo_ui(lv_obj_t* parent);
+extern TaskHandle_t input_notify_task;
 
 void app_main(void) {
     ESP_LOGI(TAG, "Turn off LCD backlight");
@@ -274,7 +278,7 @@ void app_main(void) {
     ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, EXAMPLE_LVGL_TICK_PERIOD_MS * 1000));
 
     ESP_LOGI(TAG, "Create LVGL task");
-    xTaskCreate(example_lvgl_port_task, "LVGL", EXAMPLE_LVGL_TASK_STACK_SIZE, NULL, EXAMPLE_LVGL_TASK_PRIORITY, NULL);
+    xTaskCreate(example_lvgl_port_task, "LVGL", EXAMPLE_LVGL_TASK_STACK_SIZE, NULL, EXAMPLE_LVGL_TASK_PRIORITY, &input_notify_task);
 
     ESP_LOGI(TAG, "Display LVGL UI");
 
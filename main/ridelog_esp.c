@@ -0,0 +1,307 @@
+/*
+ * Ride log storage on the ESP32-S3, chosen in menuconfig: the "ridelog"
+ * data partition, which holds the latest log and is erased just ahead of
+ * the writes, or a FAT formatted SD card on SPI with one RIDEnnnn.BIN file
+ * per log. Opening, writing and closing are queued, in order, to a low
+ * priority task, so the LVGL task never waits for the card, and
+ * ridelog_platform_close() returns at once.
+ *
+ * The partition is different: while internal flash is written or erased
+ * the cache is disabled on both cores, and every task running from flash,
+ * the LVGL task included, is suspended until the operation is done. A page
+ * write takes under a millisecond; a sector erase typically 45 ms and up
+ * to a few hundred, once per 4 KB of log, about every 11 s of riding, which
+ * shows as a dropped frame or two. Only interrupts registered as IRAM safe
+ * are served meanwhile. The SD card has no such stall.
+ */
+
+#include <string.h>
+#include "../app/ridelog.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+#if CONFIG_DASH_RIDELOG_PARTITION
+#include "esp_partition.h"
+#elif CONFIG_DASH_RIDELOG_SD
+#include <stdio.h>
+#include <sys/stat.h>
+#include "driver/sdspi_host.h"
+#include "esp_vfs_fat.h"
+#include "sdmmc_cmd.h"
+#endif
+
+static const char* TAG = "ridelog";
+
+#define RIDELOG_TASK_STACK    3072
+#define RIDELOG_TASK_PRIORITY 1 /* below the LVGL task */
+#define RIDELOG_QUEUE_LEN     8 /* blocks, several seconds of riding */
+#define RIDELOG_QUEUE_RESERVE 2 /* slots writes leave for an open and a close */
+
+#if CONFIG_DASH_RIDELOG_PARTITION
+
+static const esp_partition_t* log_part;
+static uint32_t erased_end;
+
+static bool storage_init(void) {
+    log_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "ridelog");
+    if (log_part == NULL) {
+        ESP_LOGW(TAG, "partition 'ridelog' not found, rides are not logged");
+        return false;
+    }
+    return true;
+}
+
+static uint32_t storage_capacity(void) {
+    return log_part->size;
+}
+
+static bool storage_open(void) {
+    erased_end = 0;
+    return true;
+}
+
+/* The log is written front to back, so whatever lies past the erased part
+ * is the previous log; erasing sector by sector spreads the cost */
+static bool storage_write(uint32_t addr, const void* buf, uint32_t len) {
+    esp_err_t err;
+    while (addr + len > erased_end) {
+        err = esp_partition_erase_range(log_part, erased_end, log_part->erase_size);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "erase at 0x%x failed: %s", (unsigned)erased_end, esp_err_to_name(err));
+            return false;
+        }
+        erased_end += log_part->erase_size;
+    }
+    err = esp_partition_write(log_part, addr, buf, len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "write at 0x%x failed: %s", (unsigned)addr, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+static void storage_close(void) {
+}
+
+#elif CONFIG_DASH_RIDELOG_SD
+
+#define MOUNT_POINT "/sdcard"
+#define LOG_FILES   10000
+
+static FILE* log_file;
+static unsigned next_log;
+
+static void log_path(char* path, size_t size, unsigned n) {
+    snprintf(path, size, MOUNT_POINT "/RIDE%04u.BIN", n % LOG_FILES);
+}
+
+static bool storage_init(void) {
+    spi_bus_config_t bus = {
+        .mosi_io_num     = CONFIG_DASH_RIDELOG_SD_MOSI_GPIO,
+        .miso_io_num     = CONFIG_DASH_RIDELOG_SD_MISO_GPIO,
+        .sclk_io_num     = CONFIG_DASH_RIDELOG_SD_SCLK_GPIO,
+        .quadwp_io_num   = -1,
+        .quadhd_io_num   = -1,
+        .max_transfer_sz = 4000,
+    };
+    sdmmc_host_t host = SDSPI_HOST_DEFAULT();
+    esp_err_t err     = spi_bus_initialize(host.slot, &bus, SDSPI_DEFAULT_DMA);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "SPI bus init failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    sdspi_device_config_t dev = SDSPI_DEVICE_CONFIG_DEFAULT();
+    dev.gpio_cs               = CONFIG_DASH_RIDELOG_SD_CS_GPIO;
+    dev.host_id               = host.slot;
+    esp_vfs_fat_sdmmc_mount_config_t mount = {
+        .format_if_mount_failed = false,
+        .max_files              = 2,
+        .allocation_unit_size   = 16 * 1024,
+    };
+    sdmmc_card_t* card;
+    err = esp_vfs_fat_sdspi_mount(MOUNT_POINT, &host, &dev, &mount, &card);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "no SD card (%s), rides are not logged", esp_err_to_name(err));
+        return false;
+    }
+
+    /* Number the logs on after the ones already on the card */
+    char path[32];
+    struct stat st;
+    for (next_log = 0; next_log < LOG_FILES; next_log++) {
+        log_path(path, sizeof(path), next_log);
+        if (stat(path, &st) != 0) {
+            break;
+        }
+    }
+    return true;
+}
+
+static uint32_t storage_capacity(void) {
+    return UINT32_MAX;
+}
+
+static bool storage_open(void) {
+    char path[32];
+    log_path(path, sizeof(path), next_log++);
+    log_file = fopen(path, "w+b");
+    if (log_file == NULL) {
+        ESP_LOGE(TAG, "cannot create %s", path);
+        return false;
+    }
+    ESP_LOGI(TAG, "recording to %s", path);
+    return true;
+}
+
+static bool storage_write(uint32_t addr, const void* buf, uint32_t len) {
+    if (log_file == NULL || fseek(log_file, (long)addr, SEEK_SET) != 0 || fwrite(buf, 1, len, log_file) != len) {
+        ESP_LOGE(TAG, "write at 0x%x failed", (unsigned)addr);
+        return false;
+    }
+    return fflush(log_file) == 0;
+}
+
+static void storage_close(void) {
+    if (log_file) {
+        fclose(log_file);
+        log_file = NULL;
+    }
+}
+
+#endif
+
+#if CONFIG_DASH_RIDELOG_PARTITION || CONFIG_DASH_RIDELOG_SD
+
+typedef enum {
+    REQ_OPEN,
+    REQ_WRITE,
+    REQ_CLOSE,
+} req_kind_t;
+
+typedef struct {
+    uint8_t kind;
+    uint32_t log; /* log_seq of the log it belongs to */
+    uint32_t addr;
+    uint32_t len;
+    uint8_t data[RIDELOG_BLOCK];
+} write_req_t;
+
+static QueueHandle_t write_queue;
+static uint32_t log_seq;            /* LVGL task: current log */
+static volatile uint32_t failed_log; /* writer: last log that failed */
+
+/* Requests are handled in order, so a close finishes the previous log
+ * before the next open; after a failure the rest of that log is dropped */
+static void ridelog_task(void* arg) {
+    static write_req_t req;
+    (void)arg;
+    for (;;) {
+        xQueueReceive(write_queue, &req, portMAX_DELAY);
+        switch (req.kind) {
+            case REQ_OPEN:
+                if (!storage_open()) {
+                    failed_log = req.log;
+                }
+                break;
+            case REQ_WRITE:
+                if (failed_log != req.log && !storage_write(req.addr, req.data, req.len)) {
+                    failed_log = req.log;
+                }
+                break;
+            default:
+                storage_close();
+                break;
+        }
+    }
+}
+
+/* Open and close always find a slot: writes leave RIDELOG_QUEUE_RESERVE
+ * free, and the LVGL task is the only producer */
+static bool queue_request(uint8_t kind) {
+    static write_req_t req;
+    req.kind = kind;
+    req.log  = log_seq;
+    return xQueueSend(write_queue, &req, 0) == pdTRUE;
+}
+
+bool ridelog_platform_init(void) {
+    if (!storage_init()) {
+        return false;
+    }
+    write_queue = xQueueCreate(RIDELOG_QUEUE_LEN + RIDELOG_QUEUE_RESERVE, sizeof(write_req_t));
+    if (write_queue == NULL ||
+        xTaskCreate(ridelog_task, "ridelog", RIDELOG_TASK_STACK, NULL, RIDELOG_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "cannot start the writer task");
+        return false;
+    }
+    return true;
+}
+
+/* The storage is opened by the writer once the previous log is closed; if
+ * that fails, the first write of the log reports it */
+uint32_t ridelog_platform_open(void) {
+    log_seq++;
+    if (!queue_request(REQ_OPEN)) {
+        return 0;
+    }
+    return storage_capacity();
+}
+
+/* A full queue fails the write rather than block the caller; the logger
+ * then gives the log up */
+bool ridelog_platform_write(uint32_t addr, const void* buf, uint32_t len) {
+    static write_req_t req;
+    const uint8_t* src = buf;
+
+    while (len > 0) {
+        uint32_t n = len < RIDELOG_BLOCK ? len : RIDELOG_BLOCK;
+        req.kind   = REQ_WRITE;
+        req.log    = log_seq;
+        req.addr   = addr;
+        req.len    = n;
+        memcpy(req.data, src, n);
+        if (failed_log == log_seq || uxQueueSpacesAvailable(write_queue) <= RIDELOG_QUEUE_RESERVE ||
+            xQueueSend(write_queue, &req, 0) != pdTRUE) {
+            ESP_LOGW(TAG, "write queue full or storage failed, log ends here");
+            return false;
+        }
+        addr += n;
+        src += n;
+        len -= n;
+    }
+    return true;
+}
+
+/* Queued behind the log's last writes; does not wait for them */
+void ridelog_platform_close(void) {
+    if (!queue_request(REQ_CLOSE)) {
+        ESP_LOGW(TAG, "cannot queue the close, the log may be incomplete");
+    }
+}
+
+#else
+
+bool ridelog_platform_init(void) {
+    return false;
+}
+
+uint32_t ridelog_platform_open(void) {
+    return 0;
+}
+
+bool ridelog_platform_write(uint32_t addr, const void* buf, uint32_t len) {
+    (void)addr;
+    (void)buf;
+    (void)len;
+    return false;
+}
+
+void ridelog_platform_close(void) {
+}
+
+#endif
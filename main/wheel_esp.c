@@ -0,0 +1,114 @@
+/*
+ * Wheel sensor on the ESP32-S3: the MCPWM capture unit latches the capture
+ * timer on each falling edge, so pulse intervals carry no interrupt latency
+ * jitter. The ISR converts the captured count to the esp_timer microsecond
+ * base and queues it; a task runs wheel_update() every
+ * CONFIG_DASH_WHEEL_UPDATE_MS.
+ */
+
+#include "../app/wheel.h"
+#include "driver/mcpwm_cap.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "wheel";
+
+#define WHEEL_TASK_STACK    2048
+#define WHEEL_TASK_PRIORITY 3 /* above the LVGL task, with the other sources */
+#define WHEEL_RESYNC_US     1000 /* capture time drifting this far from esp_timer */
+
+static uint32_t ticks_per_us;
+
+/* Capture intervals give the pulse times; esp_timer anchors them, again
+ * after a pause longer than the 32-bit capture counter wraps (~53 s) */
+static bool wheel_capture_isr(mcpwm_cap_channel_handle_t chan, const mcpwm_capture_event_data_t* edata, void* ctx) {
+    static bool anchored;
+    static uint32_t last_cap;
+    static int64_t last_us;
+    int64_t now_us = esp_timer_get_time();
+    int64_t t_us   = now_us;
+    (void)chan;
+    (void)ctx;
+
+    if (anchored) {
+        t_us = last_us + (edata->cap_value - last_cap) / ticks_per_us;
+        if (t_us > now_us || now_us - t_us > WHEEL_RESYNC_US) {
+            t_us = now_us;
+        }
+    }
+    anchored = true;
+    last_cap = edata->cap_value;
+    last_us  = t_us;
+    wheel_pulse((uint32_t)t_us);
+    return false;
+}
+
+static void wheel_task(void* arg) {
+    (void)arg;
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(CONFIG_DASH_WHEEL_UPDATE_MS));
+        wheel_update((uint32_t)esp_timer_get_time(), lv_tick_get());
+    }
+}
+
+bool wheel_platform_init(void) {
+    if (CONFIG_DASH_WHEEL_GPIO < 0) {
+        ESP_LOGI(TAG, "no wheel sensor fitted");
+        return false;
+    }
+
+    mcpwm_cap_timer_handle_t timer = NULL;
+    mcpwm_capture_timer_config_t timer_cfg = {
+        .group_id = 0,
+        .clk_src  = MCPWM_CAPTURE_CLK_SRC_DEFAULT,
+    };
+    mcpwm_cap_channel_handle_t chan = NULL;
+    mcpwm_capture_channel_config_t chan_cfg = {
+        .gpio_num       = CONFIG_DASH_WHEEL_GPIO,
+        .prescale       = 1,
+        .flags.neg_edge = true,
+        .flags.pull_up  = true,
+    };
+    mcpwm_capture_event_callbacks_t cbs = {
+        .on_cap = wheel_capture_isr,
+    };
+    uint32_t resolution = 0;
+
+    esp_err_t err = mcpwm_new_capture_timer(&timer_cfg, &timer);
+    if (err == ESP_OK) {
+        err = mcpwm_capture_timer_get_resolution(timer, &resolution);
+    }
+    if (err == ESP_OK) {
+        ticks_per_us = resolution / 1000000;
+        err = mcpwm_new_capture_channel(timer, &chan_cfg, &chan);
+    }
+    if (err == ESP_OK) {
+        err = mcpwm_capture_channel_register_event_callbacks(chan, &cbs, NULL);
+    }
+    if (err == ESP_OK) {
+        err = mcpwm_capture_channel_enable(chan);
+    }
+    if (err == ESP_OK) {
+        err = mcpwm_capture_timer_enable(timer);
+    }
+    if (err == ESP_OK) {
+        err = mcpwm_capture_timer_start(timer);
+    }
+    if (err != ESP_OK || ticks_per_us == 0) {
+        ESP_LOGE(TAG, "capture: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    if (xTaskCreate(wheel_task, "wheel", WHEEL_TASK_STACK, NULL, WHEEL_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "update task not created");
+        return false;
+    }
+    ESP_LOGI(TAG, "sensor on GPIO %d, %d mm, %d pulse(s)/rev", CONFIG_DASH_WHEEL_GPIO,
+             CONFIG_DASH_WHEEL_CIRCUMFERENCE_MM, CONFIG_DASH_WHEEL_PULSES_PER_REV);
+    return true;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file asset_map_host.c
+ * Asset mapping for the simulator: "<name>.bin" in $EBIKE_ASSET_DIR
+ * (default ../fonts/out) is memory-mapped read-only, standing in for the
+ * flash partition of the same name.
+ */
+
+#include "asset_map.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define ASSET_DIR_DEFAULT "../fonts/out"
+
+static void asset_path(const char *name, char *buf, size_t len) {
+  const char *dir = getenv("EBIKE_ASSET_DIR");
+  snprintf(buf, len, "%s/%s.bin", dir ? dir : ASSET_DIR_DEFAULT, name);
+}
+
+#ifdef _WIN32
+
+bool asset_map_open(const char *name, asset_map_t *map) {
+  char path[512];
+  asset_path(name, path, sizeof(path));
+
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  HANDLE mapping = NULL;
+  const void *data = NULL;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping)
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (mapping)
+    CloseHandle(mapping); /* the view keeps the mapping alive */
+  CloseHandle(file);
+  if (data == NULL)
+    return false;
+
+  map->data = data;
+  map->size = (size_t)size.QuadPart;
+  map->handle = NULL;
+  return true;
+}
+
+void asset_map_close(asset_map_t *map) {
+  if (map->data)
+    UnmapViewOfFile(map->data);
+  map->data = NULL;
+  map->size = 0;
+}
+
+#else
+
+bool asset_map_open(const char *name, asset_map_t *map) {
+  char path[512];
+  struct stat st;
+  asset_path(name, path, sizeof(path));
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return false;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+
+  void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); /* the mapping stays valid */
+  if (data == MAP_FAILED)
+    return false;
+
+  map->data = data;
+  map->size = (size_t)st.st_size;
+  map->handle = NULL;
+  return true;
+}
+
+void asset_map_close(asset_map_t *map) {
+  if (map->data)
+    munmap((void *)map->data, map->size);
+  map->data = NULL;
+  map->size = 0;
+}
+
+#endif
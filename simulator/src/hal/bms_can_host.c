@@ -0,0 +1,148 @@
+/**
+ * @file bms_can_host.c
+ * BMS bus for the simulator: a reader thread replays a candump log from
+ * $EBIKE_CANDUMP in place of the CAN controller, keeping the recorded frame
+ * timing and starting over at the end of the file. Both candump formats
+ * are read:
+ *
+ *   (1700000000.123456) can0 100#C4130A00E5021E00      candump -l
+ *     can0  100   [8]  C4 13 0A 00 E5 02 1E 00          candump
+ *
+ * Without the variable no bus is configured and the demo sources run. Not
+ * available on Windows.
+ */
+
+#include "bms_can.h"
+#include "lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+
+bool bms_can_platform_init(void) {
+  if (getenv("EBIKE_CANDUMP"))
+    fprintf(stderr, "bms: EBIKE_CANDUMP is not supported on Windows\n");
+  return false;
+}
+
+#else
+
+#include <ctype.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static int hex_nibble(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  c = (char)tolower((unsigned char)c);
+  return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+/* Hex bytes, optionally separated by blanks; returns the count */
+static int parse_bytes(const char *s, uint8_t *out) {
+  int n = 0;
+  while (*s && n < 8) {
+    if (isspace((unsigned char)*s)) {
+      s++;
+      continue;
+    }
+    int hi = hex_nibble(s[0]), lo = hex_nibble(s[1]);
+    if (hi < 0 || lo < 0)
+      break;
+    out[n++] = (uint8_t)(hi << 4 | lo);
+    s += 2;
+  }
+  return n;
+}
+
+/* One log line; false if it is not a classic CAN data frame. `t_us` is
+ * left alone for the format without time stamps. */
+static bool parse_line(const char *line, uint64_t *t_us, uint32_t *id,
+                       uint8_t *data, uint8_t *dlc) {
+  unsigned long sec, usec, can_id;
+  char iface[16], payload[40];
+  unsigned len;
+
+  if (sscanf(line, " (%lu.%lu) %15s %lx#%39s", &sec, &usec, iface, &can_id,
+             payload) == 5) {
+    if (payload[0] == '#' || payload[0] == 'R')
+      return false; /* CAN FD or remote frame */
+    *t_us = (uint64_t)sec * 1000000u + usec;
+    *id = (uint32_t)can_id;
+    *dlc = (uint8_t)parse_bytes(payload, data);
+    return true;
+  }
+  if (sscanf(line, " %15s %lx [%u]", iface, &can_id, &len) == 3 && len <= 8) {
+    const char *p = strchr(line, ']');
+    *id = (uint32_t)can_id;
+    *dlc = (uint8_t)parse_bytes(p + 1, data);
+    return *dlc == len;
+  }
+  return false;
+}
+
+static uint64_t now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static void *bms_replay_thread(void *arg) {
+  const char *path = arg;
+  char line[128];
+
+  for (;;) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+      perror("bms: candump");
+      return NULL;
+    }
+    uint64_t log_start = 0, log_t = 0, wall_start = now_us();
+    bool first = true;
+    unsigned frames = 0;
+    while (fgets(line, sizeof(line), f)) {
+      uint32_t id;
+      uint8_t data[8], dlc;
+      if (!parse_line(line, &log_t, &id, data, &dlc))
+        continue;
+      if (first) {
+        log_start = log_t;
+        first = false;
+      }
+      /* Hold each frame until its recorded time; logs without time stamps
+       * play at 1 ms per frame */
+      uint64_t due = wall_start + (log_t != 0 ? log_t - log_start
+                                              : (uint64_t)frames * 1000u);
+      uint64_t now = now_us();
+      if (due > now)
+        usleep((useconds_t)(due - now));
+      bms_can_frame(id, data, dlc, lv_tick_get());
+      frames++;
+    }
+    fclose(f);
+    if (frames == 0) {
+      fprintf(stderr, "bms: no CAN frames in %s\n", path);
+      return NULL;
+    }
+  }
+}
+
+bool bms_can_platform_init(void) {
+  static char path[256];
+  const char *env = getenv("EBIKE_CANDUMP");
+  if (env == NULL || env[0] == '\0')
+    return false;
+  snprintf(path, sizeof(path), "%s", env);
+
+  pthread_t th;
+  if (pthread_create(&th, NULL, bms_replay_thread, path) != 0) {
+    perror("bms: pthread_create");
+    return false;
+  }
+  pthread_detach(th);
+  return true;
+}
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file ctrl_uart_host.c
+ * Motor controller link for the simulator: a reader thread stands in for
+ * the UART. It reads the byte stream from $EBIKE_CTRL_UART, which may be
+ *
+ *   - a pty or serial device, e.g. one end of
+ *       socat -d -d pty,raw,echo=0,link=ctrl-a pty,raw,echo=0,link=ctrl-b
+ *     with a controller or generator writing to the other end;
+ *   - a FIFO, reopened after each writer;
+ *   - a capture file, read through once at disk speed.
+ *
+ * Without the variable no link is configured and the demo sources run.
+ * Reads go straight into the decoder ring, as the DMA does on the MCU, and
+ * the decode time is reported once a second as on the MCU. Not available
+ * on Windows.
+ */
+
+#include "ctrl_uart.h"
+#include "lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+
+bool ctrl_platform_init(void) {
+  if (getenv("EBIKE_CTRL_UART"))
+    fprintf(stderr, "ctrl: EBIKE_CTRL_UART is not supported on Windows\n");
+  return false;
+}
+
+#else
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define LOAD_WINDOW_US 1000000u
+
+static uint64_t mono_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static int ctrl_open(const char *path) {
+  int fd = open(path, O_RDONLY | O_NOCTTY);
+  if (fd >= 0 && isatty(fd)) {
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+      cfmakeraw(&tio);
+      tcsetattr(fd, TCSANOW, &tio);
+    }
+  }
+  return fd;
+}
+
+static void *ctrl_reader_thread(void *arg) {
+  const char *path = arg;
+  struct stat st;
+  bool reopen = stat(path, &st) == 0 && S_ISFIFO(st.st_mode);
+  uint64_t window_start = mono_us();
+  uint64_t busy_us = 0;
+
+  do {
+    int fd = ctrl_open(path);
+    if (fd < 0) {
+      perror("ctrl: open");
+      return NULL;
+    }
+    for (;;) {
+      uint32_t space;
+      uint8_t *dst = ctrl_rx_reserve(&space);
+      ssize_t n = read(fd, dst, space);
+      if (n <= 0)
+        break;
+      ctrl_rx_commit((uint32_t)n);
+      uint64_t t0 = mono_us();
+      ctrl_decode(lv_tick_get());
+      uint64_t now = mono_us();
+      busy_us += now - t0;
+      if (now - window_start >= LOAD_WINDOW_US) {
+        ctrl_report_load((uint32_t)busy_us, (uint32_t)(now - window_start));
+        busy_us = 0;
+        window_start = now;
+      }
+    }
+    close(fd);
+  } while (reopen);
+  return NULL;
+}
+
+bool ctrl_platform_init(void) {
+  static char path[256];
+  const char *env = getenv("EBIKE_CTRL_UART");
+  if (env == NULL || env[0] == '\0')
+    return false;
+  snprintf(path, sizeof(path), "%s", env);
+
+  pthread_t th;
+  if (pthread_create(&th, NULL, ctrl_reader_thread, path) != 0) {
+    perror("ctrl: pthread_create");
+    return false;
+  }
+  pthread_detach(th);
+  return true;
+}
+
+#endif
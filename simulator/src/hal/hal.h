@@ -33,6 +33,36 @@ extern "C" {
  */
 lv_display_t * sdl_hal_init(int32_t w, int32_t h);
 
+/**
+ * Set up the time base from $EBIKE_TIME and install it as the LVGL tick,
+ * see vclock_host.c; call after sdl_hal_init()
+ */
+void vclock_host_init(void);
+
+/**
+ * End of a loop iteration of the LVGL task: sleep for the loop period, or
+ * advance the stepped clock by one step
+ */
+void vclock_host_wait(void);
+
+/**
+ * Display frames drawn since vclock_host_init()
+ */
+uint32_t vclock_host_frames(void);
+
+/**
+ * Unless $EBIKE_JOURNAL names a journal, start from a blank one in `path`
+ * instead of the simulator's default; call before dashboard_create()
+ */
+void journal_host_scratch(const char *path);
+
+/**
+ * Start replaying the ride log named by $EBIKE_REPLAY, see
+ * replay_host.c; call after vclock_host_init() and before dashboard_create().
+ * Returns false when no replay is configured or the log cannot be read.
+ */
+bool replay_host_init(void);
+
 /**********************
  *      MACROS
  **********************/
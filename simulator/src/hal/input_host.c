@@ -0,0 +1,97 @@
+/**
+ * @file input_host.c
+ * Switch input for the simulator: a reader thread stands in for the GPIO
+ * interrupts. Each line "<switch> <0|1>" (switch: left, right, high,
+ * gear_up, gear_down) is one edge, e.g.
+ *
+ *   echo "left 1" > ebike-input
+ *
+ * The lines come from the FIFO $EBIKE_INPUT_FIFO (default "ebike-input" in
+ * the working directory, created if missing), or from stdin on Windows.
+ * The LVGL task picks the edges up within one loop iteration. Edges are
+ * stamped with the simulator's clock (vclock.h), so debouncing follows a
+ * time factor or the stepped clock like everything else.
+ */
+
+#include "input.h"
+#include "vclock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define INPUT_FIFO_DEFAULT "ebike-input"
+
+uint32_t input_now_us(void) { return (uint32_t)vclock_us(); }
+
+static void input_parse_line(const char *line) {
+  char name[16];
+  int level;
+  if (sscanf(line, "%15s %d", name, &level) != 2)
+    return;
+  for (int i = 0; i < INPUT_COUNT; i++) {
+    if (strcmp(name, input_name((input_id_t)i)) == 0) {
+      input_edge((input_id_t)i, level != 0, input_now_us());
+      return;
+    }
+  }
+  fprintf(stderr, "input: unknown switch '%s'\n", name);
+}
+
+#ifdef _WIN32
+
+static DWORD WINAPI input_reader_thread(LPVOID arg) {
+  char line[64];
+  (void)arg;
+  while (fgets(line, sizeof(line), stdin))
+    input_parse_line(line);
+  return 0;
+}
+
+void input_platform_init(void) {
+  HANDLE th = CreateThread(NULL, 0, input_reader_thread, NULL, 0, NULL);
+  if (th)
+    CloseHandle(th);
+}
+
+#else
+
+static void *input_reader_thread(void *arg) {
+  const char *path = arg;
+  char line[64];
+  for (;;) {
+    /* Blocks until a writer opens the FIFO; reopened after each writer */
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+      return NULL;
+    while (fgets(line, sizeof(line), f))
+      input_parse_line(line);
+    fclose(f);
+  }
+}
+
+void input_platform_init(void) {
+  static char path[256];
+  const char *env = getenv("EBIKE_INPUT_FIFO");
+  snprintf(path, sizeof(path), "%s", env ? env : INPUT_FIFO_DEFAULT);
+
+  struct stat st;
+  if (stat(path, &st) != 0 && mkfifo(path, 0600) != 0) {
+    perror("input: mkfifo");
+    return;
+  }
+
+  pthread_t th;
+  if (pthread_create(&th, NULL, input_reader_thread, path) == 0)
+    pthread_detach(th);
+}
+
+#endif
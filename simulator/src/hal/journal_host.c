@@ -0,0 +1,103 @@
+/**
+ * @file journal_host.c
+ * Journal area for the simulator: the file $EBIKE_JOURNAL (default
+ * "ebike-journal.bin" in the working directory) stands in for the "journal"
+ * flash partition. It is created erased (0xFF) on first use, and writes AND
+ * into the existing bytes like NOR flash, so torn-write handling behaves as
+ * on the MCU. Delete the file to start from a blank journal.
+ *
+ * Replays and stepped runs keep their trips apart in a scratch journal,
+ * see journal_host_scratch().
+ */
+
+#include "hal.h"
+#include "journal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JOURNAL_FILE_DEFAULT "ebike-journal.bin"
+#define JOURNAL_HOST_SECTORS 16 /* as the partition in partitions.csv */
+#define JOURNAL_HOST_SIZE (JOURNAL_HOST_SECTORS * JOURNAL_SECTOR_SIZE)
+
+static FILE *journal_file;
+static const char *scratch_path;
+
+void journal_host_scratch(const char *path) {
+  if (getenv("EBIKE_JOURNAL") != NULL)
+    return;
+  remove(path);
+  scratch_path = path;
+}
+
+static bool fill_erased(uint32_t addr, uint32_t len) {
+  uint8_t blank[JOURNAL_SECTOR_SIZE];
+  memset(blank, 0xFF, sizeof(blank));
+  if (fseek(journal_file, (long)addr, SEEK_SET) != 0)
+    return false;
+  while (len > 0) {
+    uint32_t n = len < sizeof(blank) ? len : (uint32_t)sizeof(blank);
+    if (fwrite(blank, 1, n, journal_file) != n)
+      return false;
+    len -= n;
+  }
+  return fflush(journal_file) == 0;
+}
+
+uint32_t journal_platform_open(void) {
+  const char *path = getenv("EBIKE_JOURNAL");
+  if (path == NULL)
+    path = scratch_path ? scratch_path : JOURNAL_FILE_DEFAULT;
+
+  journal_file = fopen(path, "r+b");
+  if (journal_file == NULL)
+    journal_file = fopen(path, "w+b");
+  if (journal_file == NULL || fseek(journal_file, 0, SEEK_END) != 0) {
+    fprintf(stderr, "journal: cannot open %s\n", path);
+    return 0;
+  }
+
+  /* New or shorter than the partition: the rest is erased flash */
+  long size = ftell(journal_file);
+  if (size >= 0 && size < JOURNAL_HOST_SIZE &&
+      !fill_erased((uint32_t)size, JOURNAL_HOST_SIZE - (uint32_t)size)) {
+    fprintf(stderr, "journal: cannot extend %s\n", path);
+    return 0;
+  }
+  return JOURNAL_HOST_SIZE;
+}
+
+bool journal_platform_read(uint32_t addr, void *buf, uint32_t len) {
+  if (journal_file == NULL || addr + len > JOURNAL_HOST_SIZE)
+    return false;
+  if (fseek(journal_file, (long)addr, SEEK_SET) != 0)
+    return false;
+  return fread(buf, 1, len, journal_file) == len;
+}
+
+bool journal_platform_write(uint32_t addr, const void *buf, uint32_t len) {
+  uint8_t cur[JOURNAL_RECORD_SIZE];
+  const uint8_t *src = (const uint8_t *)buf;
+
+  while (len > 0) {
+    uint32_t n = len < sizeof(cur) ? len : (uint32_t)sizeof(cur);
+    if (!journal_platform_read(addr, cur, n))
+      return false;
+    for (uint32_t i = 0; i < n; i++)
+      cur[i] &= src[i];
+    if (fseek(journal_file, (long)addr, SEEK_SET) != 0 ||
+        fwrite(cur, 1, n, journal_file) != n)
+      return false;
+    addr += n;
+    src += n;
+    len -= n;
+  }
+  return fflush(journal_file) == 0;
+}
+
+bool journal_platform_erase(uint32_t addr) {
+  if (journal_file == NULL || addr % JOURNAL_SECTOR_SIZE != 0 ||
+      addr >= JOURNAL_HOST_SIZE)
+    return false;
+  return fill_erased(addr, JOURNAL_SECTOR_SIZE);
+}
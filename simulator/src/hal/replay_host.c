@@ -0,0 +1,99 @@
+/**
+ * @file replay_host.c
+ * Ride log replay in the simulator, configured from the environment:
+ *
+ *   EBIKE_REPLAY       ride log to replay (ridelog_host.c writes them);
+ *                      without it the simulator runs its demo sources
+ *   EBIKE_REPLAY_FROM  start position: seconds into the ride, or a distance
+ *                      such as "12.5km" (default the start)
+ *   EBIKE_REPLAY_EXIT  quit at the end of the log after the summary
+ *
+ * The replay runs on the LVGL tick, which every timer and telemetry
+ * timestamp uses, so EBIKE_TIME (vclock_host.c) replays at a time factor,
+ * or stepped as fast as the host allows. The trip computer integrates the
+ * queued speed and power samples between their recorded timestamps, so
+ * distance, ride time, energy and consumption come out the same at any
+ * rate. The SOC, the ride segmentation and the usage histograms sample the
+ * latest readings on a timer instead, and can differ by a timer period
+ * where the host falls behind. Unless EBIKE_JOURNAL is set the replay
+ * keeps its odometer and trips in a scratch journal, which is cleared on
+ * each run, rather than adding the replayed distance to the simulator's own.
+ */
+
+#include "hal.h"
+#include "replay.h"
+#include "vclock.h"
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REPLAY_JOURNAL "ebike-replay-journal.bin"
+
+static FILE *replay_file;
+static uint32_t wall_start;
+static bool exit_at_end;
+
+static bool file_read(void *ctx, uint32_t addr, void *buf, uint32_t len) {
+  FILE *f = ctx;
+  return fseek(f, (long)addr, SEEK_SET) == 0 && fread(buf, 1, len, f) == len;
+}
+
+static void replay_end(void) {
+  replay_stats_t s;
+  uint32_t wall_ms = SDL_GetTicks() - wall_start;
+
+  replay_get_stats(&s);
+  printf("replay: end of log at %u.%03u s, %u.%03u km\n", s.t_ms / 1000,
+         s.t_ms % 1000, s.dist_m / 1000, s.dist_m % 1000);
+  printf("replay: %u records, %u samples in %u.%03u s wall time, "
+         "%u frames drawn\n",
+         s.records, s.published, wall_ms / 1000, wall_ms % 1000,
+         vclock_host_frames());
+  fclose(replay_file);
+  replay_file = NULL;
+  if (exit_at_end)
+    exit(0);
+}
+
+bool replay_host_init(void) {
+  const char *path = getenv("EBIKE_REPLAY");
+  const char *env;
+  ridelog_seek_t by = RIDELOG_BY_TIME;
+  uint32_t from = 0;
+
+  if (path == NULL || path[0] == '\0')
+    return false;
+
+  if ((env = getenv("EBIKE_REPLAY_FROM")) != NULL) {
+    char *unit;
+    from = (uint32_t)(strtod(env, &unit) * 1000); /* s to ms, km to m */
+    if (strcmp(unit, "km") == 0)
+      by = RIDELOG_BY_DIST;
+  }
+  exit_at_end = getenv("EBIKE_REPLAY_EXIT") != NULL;
+
+  replay_file = fopen(path, "rb");
+  if (replay_file == NULL || fseek(replay_file, 0, SEEK_END) != 0) {
+    fprintf(stderr, "replay: cannot open %s\n", path);
+    return false;
+  }
+  long size = ftell(replay_file);
+  if (size <= 0 || !replay_start(file_read, replay_file, (uint32_t)size, by,
+                                 from)) {
+    fprintf(stderr, "replay: %s is not a ride log or ends before the start "
+                    "position\n",
+            path);
+    fclose(replay_file);
+    replay_file = NULL;
+    return false;
+  }
+
+  journal_host_scratch(REPLAY_JOURNAL);
+  wall_start = SDL_GetTicks();
+  replay_set_handler(replay_end);
+
+  printf("replay: %s from %s %u\n", path, by == RIDELOG_BY_DIST ? "m" : "ms",
+         from);
+  return true;
+}
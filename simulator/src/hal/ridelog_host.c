@@ -0,0 +1,50 @@
+/**
+ * @file ridelog_host.c
+ * Ride log storage for the simulator: each log is a file
+ * ride-YYYYMMDD-HHMMSS.bin in the directory $EBIKE_RIDELOG, named after the
+ * local time it was started (vclock_time(), the time the dashboard shows).
+ * Without the variable nothing is logged.
+ */
+
+#include "ridelog.h"
+#include "vclock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const char *log_dir;
+static FILE *log_file;
+
+bool ridelog_platform_init(void) {
+  log_dir = getenv("EBIKE_RIDELOG");
+  return log_dir != NULL && log_dir[0] != '\0';
+}
+
+uint32_t ridelog_platform_open(void) {
+  char path[512], stamp[32];
+  time_t now = vclock_time();
+
+  strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", localtime(&now));
+  snprintf(path, sizeof(path), "%s/ride-%s.bin", log_dir, stamp);
+  log_file = fopen(path, "w+b");
+  if (log_file == NULL) {
+    fprintf(stderr, "ridelog: cannot create %s\n", path);
+    return 0;
+  }
+  printf("ridelog: recording to %s\n", path);
+  return UINT32_MAX;
+}
+
+bool ridelog_platform_write(uint32_t addr, const void *buf, uint32_t len) {
+  if (log_file == NULL || fseek(log_file, (long)addr, SEEK_SET) != 0 ||
+      fwrite(buf, 1, len, log_file) != len)
+    return false;
+  return fflush(log_file) == 0;
+}
+
+void ridelog_platform_close(void) {
+  if (log_file) {
+    fclose(log_file);
+    log_file = NULL;
+  }
+}
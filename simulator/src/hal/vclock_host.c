@@ -0,0 +1,120 @@
+/**
+ * @file vclock_host.c
+ * Simulator time base (vclock.h), configured from the environment:
+ *
+ *   EBIKE_TIME           time factor, e.g. 10 (default 1), or "step" for
+ *                        the stepped virtual clock
+ *   EBIKE_TIME_STEP      stepped: ms per loop iteration (default 5, the
+ *                        loop's delay in real time)
+ *   EBIKE_TIME_START     stepped: Unix time the clock starts at (default
+ *                        2024-06-01 08:00 UTC; set TZ too for the same
+ *                        clock display on every host)
+ *   EBIKE_TIME_DECIMATE  draw every n-th display frame (default 1)
+ *   EBIKE_TIME_END       quit after this many seconds of clock time with a
+ *                        summary of the frames drawn and the wall time
+ *
+ * The clock paces the LVGL task, and the demo sources and a replayed ride
+ * (replay_host.c) run on it. The thread sources (EBIKE_WHEEL,
+ * EBIKE_CANDUMP, the controller link) pace themselves on the host clock, so
+ * with them a faster run is not faithful and a stepped one not
+ * reproducible.
+ *
+ * Stepped, the LVGL task does not sleep between iterations. The FreeRTOS
+ * tick keeps running on the host timer; tasks below the LVGL task's
+ * priority do not get to run meanwhile, and none of them produces anything
+ * the dashboard shows. Unless EBIKE_JOURNAL is set, a stepped run starts
+ * from a blank scratch journal, so the odometer of earlier runs does not
+ * change what is drawn.
+ */
+
+#include "hal.h"
+#include "dashboard.h"
+#include "vclock.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOOP_MS 5
+#define STEP_START_DEFAULT 1717228800 /* 2024-06-01 08:00 UTC */
+#define STEP_JOURNAL "ebike-step-journal.bin"
+
+static uint64_t host_offset_us;
+static uint32_t step_us = LOOP_MS * 1000u;
+static uint64_t end_us;
+static uint32_t wall_start;
+static uint32_t frames;
+
+/* The performance counter in us, continuing from SDL_GetTicks() so the
+ * LVGL tick does not jump when the clock takes over */
+static uint64_t perf_us(void) {
+  uint64_t c = SDL_GetPerformanceCounter();
+  uint64_t f = SDL_GetPerformanceFrequency();
+  return c / f * 1000000u + c % f * 1000000u / f;
+}
+
+static uint64_t host_us(void) { return perf_us() + host_offset_us; }
+
+static void render_ready_cb(lv_event_t *e) {
+  LV_UNUSED(e);
+  frames++;
+}
+
+void vclock_host_init(void) {
+  const char *env = getenv("EBIKE_TIME");
+  uint32_t decimate = 1;
+
+  host_offset_us = (uint64_t)SDL_GetTicks() * 1000u - perf_us();
+  if (env != NULL && strcmp(env, "step") != 0 && atof(env) > 0)
+    vclock_run_scaled(host_us, (uint32_t)(atof(env) * 1000 + 0.5));
+  else
+    vclock_run_scaled(host_us, 1000);
+
+  if (env != NULL && strcmp(env, "step") == 0) {
+    const char *start = getenv("EBIKE_TIME_START");
+    if ((env = getenv("EBIKE_TIME_STEP")) != NULL && atoi(env) > 0)
+      step_us = (uint32_t)atoi(env) * 1000u;
+    vclock_run_stepped(start ? (time_t)atoll(start) : STEP_START_DEFAULT);
+    journal_host_scratch(STEP_JOURNAL);
+  }
+  if ((env = getenv("EBIKE_TIME_DECIMATE")) != NULL && atoi(env) > 0)
+    decimate = (uint32_t)atoi(env);
+  if ((env = getenv("EBIKE_TIME_END")) != NULL && atof(env) > 0)
+    end_us = vclock_us() + (uint64_t)(atof(env) * 1000000);
+
+  /* After sdl_hal_init(): the SDL driver installs its own tick callback */
+  lv_tick_set_cb(vclock_ms);
+  dashboard_set_frame_decimation(decimate);
+  lv_display_add_event_cb(lv_display_get_default(), render_ready_cb,
+                          LV_EVENT_RENDER_READY, NULL);
+  wall_start = SDL_GetTicks();
+
+  if (vclock_stepped())
+    printf("time: stepped, %u ms per iteration, drawing every %u. frame\n",
+           step_us / 1000, decimate);
+  else if (vclock_rate() != 1000 || decimate > 1)
+    printf("time: x%u.%u, drawing every %u. frame\n", vclock_rate() / 1000,
+           vclock_rate() % 1000 / 100, decimate);
+}
+
+uint32_t vclock_host_frames(void) { return frames; }
+
+void vclock_host_wait(void) {
+  if (end_us && vclock_us() >= end_us) {
+    uint32_t wall_ms = SDL_GetTicks() - wall_start;
+    printf("time: end after %u s, %u.%03u s wall time, %u frames drawn\n",
+           (unsigned)(vclock_us() / 1000000u), wall_ms / 1000, wall_ms % 1000,
+           frames);
+    exit(0);
+  }
+
+  if (vclock_stepped()) {
+    vclock_advance(step_us);
+  } else {
+    /* The same LOOP_MS of clock time per iteration, at least one RTOS tick */
+    TickType_t ticks = pdMS_TO_TICKS(LOOP_MS * 1000u / vclock_rate());
+    vTaskDelay(ticks > 0 ? ticks : 1);
+  }
+}
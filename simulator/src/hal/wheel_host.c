@@ -0,0 +1,120 @@
+/**
+ * @file wheel_host.c
+ * Wheel sensor for the simulator: a generator thread produces the pulses a
+ * wheel of CONFIG_DASH_WHEEL_CIRCUMFERENCE_MM would, with some timing jitter,
+ * and runs wheel_update() every CONFIG_DASH_WHEEL_UPDATE_MS. $EBIKE_WHEEL
+ * selects the speed:
+ *
+ *   sweep   standing for 5 s, then 0 to 80 km/h and back at 20 km/h/s
+ *   <kmh>   constant speed, e.g. EBIKE_WHEEL=3 to watch period mode
+ *
+ * Without the variable there is no sensor and the demo sources run. Not
+ * available on Windows.
+ */
+
+#include "app_config.h"
+#include "lvgl.h"
+#include "wheel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+bool wheel_platform_init(void) {
+  if (getenv("EBIKE_WHEEL"))
+    fprintf(stderr, "wheel: EBIKE_WHEEL is not supported on Windows\n");
+  return false;
+}
+
+#else
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SWEEP_WAIT_US 5000000u
+#define SWEEP_MAX_X100 8000
+#define SWEEP_RATE_X100 2000 /* per second */
+
+static int32_t const_x100 = -1; /* < 0: sweep */
+
+static uint64_t now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static int32_t profile_x100(uint64_t t_us) {
+  if (const_x100 >= 0)
+    return const_x100;
+  if (t_us < SWEEP_WAIT_US)
+    return 0;
+  uint64_t period_us = 2ull * SWEEP_MAX_X100 * 1000000u / SWEEP_RATE_X100;
+  uint64_t phase = (t_us - SWEEP_WAIT_US) % period_us;
+  if (phase > period_us / 2)
+    phase = period_us - phase;
+  return (int32_t)(phase * SWEEP_RATE_X100 / 1000000u);
+}
+
+#define STEP_US 1000u
+#define UM_PER_PULSE                                                           \
+  ((uint64_t)CONFIG_DASH_WHEEL_CIRCUMFERENCE_MM * 1000u /                      \
+   CONFIG_DASH_WHEEL_PULSES_PER_REV)
+
+/* The wheel turns STEP_US at a time, or however long the sleep took; every
+ * pulse distance the travel crosses in the step is stamped where it was
+ * crossed, give or take 1% of the step, so the pulse rate holds at any
+ * speed and pulse count per revolution */
+static void *wheel_generator_thread(void *arg) {
+  (void)arg;
+  uint64_t start = now_us();
+  uint64_t now = start;
+  uint64_t next_update = start + CONFIG_DASH_WHEEL_UPDATE_MS * 1000u;
+  uint64_t travel = 0; /* um x 360 since the last pulse */
+  uint64_t last_pulse = 0;
+
+  for (;;) {
+    usleep(STEP_US);
+    uint64_t prev = now;
+    now = now_us();
+    int32_t v = profile_x100(now - start);
+    if (v > 0) {
+      travel += (uint64_t)v * (now - prev);
+      while (travel >= UM_PER_PULSE * 360u) {
+        travel -= UM_PER_PULSE * 360u;
+        uint64_t t = now - travel / (uint64_t)v;
+        t += (now - prev) * (uint64_t)(rand() % 3) / 100u;
+        if (t > now)
+          t = now;
+        if (t <= last_pulse) /* the jitter must not reorder pulses */
+          t = last_pulse + 1;
+        last_pulse = t;
+        wheel_pulse((uint32_t)t);
+      }
+    }
+    if (now >= next_update) {
+      wheel_update((uint32_t)now, lv_tick_get());
+      next_update += CONFIG_DASH_WHEEL_UPDATE_MS * 1000u;
+    }
+  }
+  return NULL;
+}
+
+bool wheel_platform_init(void) {
+  const char *env = getenv("EBIKE_WHEEL");
+  if (env == NULL || env[0] == '\0')
+    return false;
+  if (strcmp(env, "sweep") != 0)
+    const_x100 = atoi(env) * 100;
+
+  pthread_t th;
+  if (pthread_create(&th, NULL, wheel_generator_thread, NULL) != 0) {
+    perror("wheel: pthread_create");
+    return false;
+  }
+  pthread_detach(th);
+  return true;
+}
+
+#endif
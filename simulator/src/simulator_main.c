@@ -125,6 +125,7 @@ void create_hello_world_screen() {
  */
 
 #include "dashboard.h"
+#include "input.h"
 
 void lvgl_task(void *pvParameters) {
 
@@ -133,6 +134,10 @@ void lvgl_task(void *pvParameters) {
 
   /*Initialize the HAL (display, input devices, tick) for LVGL*/
   sdl_hal_init(480, 272);
+  /* Scaled or stepped clock in place of the SDL tick */
+  vclock_host_init();
+  /* A recorded ride in place of the demo sources, if one is configured */
+  replay_host_init();
   /* Show the e-bike dashboard screen */
   /* Create a clean screen */
   lv_obj_t *scr_root = lv_obj_create(NULL);
@@ -141,8 +146,9 @@ void lvgl_task(void *pvParameters) {
   dashboard_create(scr_root);
 
   while (true) {
+    input_process();              /* Debounced switch events */
     lv_timer_handler();           /* Handle LVGL tasks */
-    vTaskDelay(pdMS_TO_TICKS(5)); /* Short delay for the RTOS scheduler */
+    vclock_host_wait();           /* Short delay, or one clock step */
   }
 }
 
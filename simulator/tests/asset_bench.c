@@ -0,0 +1,286 @@
+/**
+ * @file asset_bench.c
+ * Footprint and render cost of the compressed assets (fonts/out, img/icons.c)
+ *
+ * Every font is expanded back into the plain 4 bpp format at start-up, so
+ * the two formats are compared on the same glyphs:
+ *
+ *   plain    bytes and ns per glyph of the plain font (4 bpp to A8 on every
+ *            draw, the format the fonts had before)
+ *   rle      bytes and ns per glyph of the compressed font, decoded on every
+ *            draw; the size includes the last glyph at its plain size, so it
+ *            is an upper bound
+ *   cached   ns per glyph through glyph_cache.c once the glyphs are decoded,
+ *            which is what the dashboard pays for a value that is redrawn
+ *
+ * The icons are listed with their stored and decoded size and the cost of
+ * one uncached decode. The benchmark fails if a compressed glyph does not
+ * decode to the plain one, so it runs as a test as well.
+ */
+
+#include "glyph_cache.h"
+#include "lvgl.h"
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_TEXT "0123456789.:-%kmhWV"
+#define BENCH_ROUNDS 2000
+#define GLYPH_BUF_W 128
+#define GLYPH_BUF_H 128
+
+LV_FONT_DECLARE(lv_font_jetbrains_mono_26)
+LV_FONT_DECLARE(lv_font_jetbrains_mono_30)
+LV_FONT_DECLARE(lv_font_jetbrains_mono_36)
+LV_FONT_DECLARE(lv_font_jetbrains_mono_extra_bold_42)
+LV_FONT_DECLARE(lv_font_pf_din_mono_30)
+LV_IMAGE_DECLARE(high_beam);
+LV_IMAGE_DECLARE(left_turn);
+LV_IMAGE_DECLARE(right_turn);
+
+typedef struct {
+  const char *name;
+  const lv_font_t *font;
+} bench_font_t;
+
+static const bench_font_t fonts[] = {
+    {"jetbrains_mono_26", &lv_font_jetbrains_mono_26},
+    {"jetbrains_mono_30", &lv_font_jetbrains_mono_30},
+    {"jetbrains_mono_36", &lv_font_jetbrains_mono_36},
+    {"jetbrains_mono_extra_bold_42", &lv_font_jetbrains_mono_extra_bold_42},
+    {"pf_din_mono_30", &lv_font_pf_din_mono_30},
+};
+
+static lv_draw_buf_t *glyph_buf;
+
+#if LV_USE_OS == LV_OS_FREERTOS
+#include "FreeRTOS.h"
+
+/* lv_init() only creates its mutexes; the scheduler is never started */
+void vApplicationMallocFailedHook(void) {
+  fprintf(stderr, "malloc failed\n");
+  exit(1);
+}
+#endif
+
+static uint64_t now_ns(void) {
+  uint64_t c = SDL_GetPerformanceCounter();
+  uint64_t f = SDL_GetPerformanceFrequency();
+  return c / f * 1000000000u + c % f * 1000000000u / f;
+}
+
+static uint32_t glyph_count(const lv_font_fmt_txt_dsc_t *fd) {
+  const lv_font_fmt_txt_cmap_t *last = &fd->cmaps[fd->cmap_num - 1];
+  uint32_t n = last->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY ||
+                       last->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+                   ? last->range_length
+                   : last->list_length;
+  return last->glyph_id_start + n; /* id 0 is reserved */
+}
+
+/* Draw a glyph the way lv_draw_label does: into the shared A8 buffer
+ * reshaped to the glyph box */
+static const uint8_t *draw_glyph(lv_font_glyph_dsc_t *g) {
+  if (g->box_w == 0 || g->box_h == 0)
+    return NULL;
+  if (lv_draw_buf_reshape(glyph_buf, LV_COLOR_FORMAT_A8, g->box_w, g->box_h,
+                          LV_STRIDE_AUTO) == NULL) {
+    fprintf(stderr, "glyph of %ux%u does not fit the buffer\n", g->box_w,
+            g->box_h);
+    exit(1);
+  }
+  const void *res = lv_font_get_glyph_bitmap(g, glyph_buf);
+  return res == glyph_buf ? glyph_buf->data : res;
+}
+
+/* A plain 4 bpp copy of a compressed font, decoded through the font itself.
+ * Returns the size of the plain bitmaps. */
+static uint32_t make_plain(const lv_font_t *src, lv_font_t *out,
+                           lv_font_fmt_txt_dsc_t *out_dsc) {
+  const lv_font_fmt_txt_dsc_t *fd = src->dsc;
+  uint32_t n = glyph_count(fd);
+  lv_font_fmt_txt_glyph_dsc_t *gd = malloc(n * sizeof(*gd));
+  uint32_t total = 0;
+
+  for (uint32_t id = 0; id < n; id++)
+    total += ((uint32_t)fd->glyph_dsc[id].box_w * fd->glyph_dsc[id].box_h *
+                  fd->bpp + 7) / 8;
+  uint8_t *bitmap = calloc(total > 0 ? total : 1, 1);
+
+  lv_font_glyph_dsc_t g;
+  uint32_t pos = 0;
+  for (uint32_t id = 0; id < n; id++) {
+    gd[id] = fd->glyph_dsc[id];
+    gd[id].bitmap_index = pos;
+    memset(&g, 0, sizeof(g));
+    g.resolved_font = src;
+    g.gid.index = id;
+    g.box_w = gd[id].box_w;
+    g.box_h = gd[id].box_h;
+    const uint8_t *a8 = id > 0 ? draw_glyph(&g) : NULL;
+    uint32_t px = (uint32_t)g.box_w * g.box_h;
+    for (uint32_t i = 0; a8 != NULL && i < px; i++) {
+      uint8_t v = (uint8_t)((a8[(i / g.box_w) * glyph_buf->header.stride +
+                               i % g.box_w] + 8) / 17);
+      bitmap[pos + i / 2] |= (uint8_t)(i % 2 ? v : v << 4);
+    }
+    pos += (px * fd->bpp + 7) / 8;
+  }
+
+  *out_dsc = *fd;
+  out_dsc->glyph_bitmap = bitmap;
+  out_dsc->glyph_dsc = gd;
+  out_dsc->bitmap_format = LV_FONT_FMT_TXT_PLAIN;
+  *out = *src;
+  out->dsc = out_dsc;
+  return total;
+}
+
+static uint32_t rle_size(const lv_font_t *font) {
+  const lv_font_fmt_txt_dsc_t *fd = font->dsc;
+  uint32_t n = glyph_count(fd);
+  uint32_t end = 0;
+
+  for (uint32_t id = 1; id < n; id++) {
+    const lv_font_fmt_txt_glyph_dsc_t *gd = &fd->glyph_dsc[id];
+    uint32_t e = gd->bitmap_index +
+                 ((uint32_t)gd->box_w * gd->box_h * fd->bpp + 7) / 8;
+    if (e > end)
+      end = e;
+  }
+  return end;
+}
+
+/* ns per glyph for BENCH_TEXT, BENCH_ROUNDS times */
+static uint32_t time_text(const lv_font_t *font) {
+  lv_font_glyph_dsc_t g;
+  uint32_t glyphs = 0;
+  uint64_t t0 = now_ns();
+
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (const char *c = BENCH_TEXT; *c; c++) {
+      if (!lv_font_get_glyph_dsc(font, &g, (uint32_t)*c, 0))
+        continue;
+      draw_glyph(&g);
+      glyphs++;
+    }
+  }
+  return glyphs ? (uint32_t)((now_ns() - t0) / glyphs) : 0;
+}
+
+/* Every glyph of the compressed font must decode to the plain one */
+static bool same_glyphs(const lv_font_t *a, const lv_font_t *b) {
+  static uint8_t first[GLYPH_BUF_W * GLYPH_BUF_H];
+  lv_font_glyph_dsc_t g;
+  uint32_t n = glyph_count(a->dsc);
+
+  for (uint32_t id = 1; id < n; id++) {
+    memset(&g, 0, sizeof(g));
+    g.gid.index = id;
+    g.box_w = ((const lv_font_fmt_txt_dsc_t *)a->dsc)->glyph_dsc[id].box_w;
+    g.box_h = ((const lv_font_fmt_txt_dsc_t *)a->dsc)->glyph_dsc[id].box_h;
+    g.resolved_font = a;
+    const uint8_t *p = draw_glyph(&g);
+    uint32_t size = glyph_buf->header.stride * (uint32_t)g.box_h;
+    if (p == NULL)
+      continue;
+    memcpy(first, p, size);
+    g.resolved_font = b;
+    p = draw_glyph(&g);
+    if (p == NULL || memcmp(first, p, size) != 0)
+      return false;
+  }
+  return true;
+}
+
+static bool bench_fonts(void) {
+  uint32_t plain_total = 0, rle_total = 0;
+  bool ok = true;
+
+  printf("%-30s %8s %8s %9s %9s %9s\n", "font", "plain B", "rle B",
+         "plain ns", "rle ns", "cached ns");
+  for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+    const lv_font_t *font = fonts[i].font;
+    lv_font_t plain, cached;
+    lv_font_fmt_txt_dsc_t plain_dsc;
+    glyph_cache_stats_t st;
+
+    uint32_t plain_size = make_plain(font, &plain, &plain_dsc);
+    uint32_t rle = rle_size(font);
+    if (!same_glyphs(font, &plain)) {
+      fprintf(stderr, "%s: compressed glyphs differ from the plain ones\n",
+              fonts[i].name);
+      ok = false;
+    }
+
+    glyph_cache_wrap_font(&cached, font);
+    glyph_cache_invalidate(&cached);
+    time_text(&cached); /* fill the cache */
+    glyph_cache_reset_stats();
+
+    uint32_t plain_ns = time_text(&plain);
+    uint32_t rle_ns = time_text(font);
+    uint32_t cached_ns = time_text(&cached);
+    glyph_cache_get_stats(&st);
+    if (st.misses > 0 || st.bypass > 0) {
+      fprintf(stderr, "%s: %u misses, %u bypassed with a warm cache\n",
+              fonts[i].name, st.misses, st.bypass);
+      ok = false;
+    }
+    glyph_cache_invalidate(&cached);
+
+    printf("%-30s %8u %8u %9u %9u %9u\n", fonts[i].name, plain_size, rle,
+           plain_ns, rle_ns, cached_ns);
+    plain_total += plain_size;
+    rle_total += rle;
+    free((void *)plain_dsc.glyph_bitmap);
+    free((void *)plain_dsc.glyph_dsc);
+  }
+  printf("%-30s %8u %8u (%u%%)\n\n", "total", plain_total, rle_total,
+         plain_total ? rle_total * 100 / plain_total : 0);
+  return ok;
+}
+
+static bool bench_icons(void) {
+  const lv_image_dsc_t *icons[] = {&high_beam, &left_turn, &right_turn};
+  const char *names[] = {"high_beam", "left_turn", "right_turn"};
+  bool ok = true;
+
+  printf("%-30s %8s %8s %9s\n", "icon", "raw B", "stored B", "decode ns");
+  for (size_t i = 0; i < sizeof(icons) / sizeof(icons[0]); i++) {
+    lv_image_decoder_args_t args;
+    lv_image_decoder_dsc_t dsc;
+    uint32_t raw = icons[i]->header.stride * icons[i]->header.h;
+
+    memset(&args, 0, sizeof(args));
+    args.no_cache = true;
+    uint64_t t0 = now_ns();
+    if (lv_image_decoder_open(&dsc, icons[i], &args) != LV_RESULT_OK) {
+      fprintf(stderr, "%s: cannot decode\n", names[i]);
+      ok = false;
+      continue;
+    }
+    uint32_t ns = (uint32_t)(now_ns() - t0);
+    if (dsc.decoded == NULL || dsc.decoded->data_size < raw) {
+      fprintf(stderr, "%s: decoded to the wrong size\n", names[i]);
+      ok = false;
+    }
+    lv_image_decoder_close(&dsc);
+    printf("%-30s %8u %8u %9u\n", names[i], raw, icons[i]->data_size, ns);
+  }
+  return ok;
+}
+
+int main(void) {
+  lv_init();
+  glyph_buf = lv_draw_buf_create(GLYPH_BUF_W, GLYPH_BUF_H, LV_COLOR_FORMAT_A8,
+                                 LV_STRIDE_AUTO);
+
+  bool ok = bench_fonts();
+  ok = bench_icons() && ok;
+
+  lv_draw_buf_destroy(glyph_buf);
+  lv_deinit();
+  return ok ? 0 : 1;
+}
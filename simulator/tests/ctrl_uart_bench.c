@@ -0,0 +1,130 @@
+/**
+ * @file ctrl_uart_bench.c
+ * Throughput of the controller frame decoder (app/ctrl_uart.c) on the host
+ *
+ * Each stream is copied into the ring in 120 byte reads, the UART driver's
+ * RX threshold on the MCU, and decoded after each read, as the receive task
+ * does. Reported per stream: ns per byte, and the share of one host core
+ * the decoder would take at 115200 and 921600 baud (10 bits per byte) with
+ * the line saturated:
+ *
+ *   frames   back-to-back status, battery and temperature frames
+ *   damaged  the same with 1 % of the frames corrupted
+ *   noise    random bytes, i.e. a wrong baud rate or a floating line: the
+ *            resynchronisation path only
+ *
+ * On the MCU the decoder measures itself (ctrl_stats_t.load_ppm on the
+ * settings page).
+ */
+
+#include "crc.h"
+#include "ctrl_uart.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STREAM_SIZE (16u << 20)
+#define READ_SIZE 120
+#define PASSES 3
+
+static volatile uint32_t sink;
+static uint32_t rng = 0x9E3779B9;
+
+bool ctrl_platform_init(void) { return true; }
+
+void telemetry_publish(telemetry_topic_t topic, int32_t value,
+                       uint32_t now_ms) {
+  sink += (uint32_t)value + (uint32_t)topic + now_ms;
+}
+
+static uint32_t rand32(void) {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t make_frames(uint8_t *out, uint32_t size, uint32_t damage_ppm) {
+  static const uint8_t lens[] = {5, 4, 2};
+  uint32_t n = 0;
+
+  while (n + CTRL_FRAME_OVERHEAD + 5 <= size) {
+    uint32_t k = rand32() % 3;
+    uint8_t *f = out + n;
+    f[0] = CTRL_SYNC;
+    f[1] = (uint8_t)(CTRL_FRAME_STATUS + k);
+    f[2] = lens[k];
+    for (uint8_t i = 0; i < lens[k]; i++)
+      f[3 + i] = (uint8_t)rand32();
+    f[3 + lens[k]] = crc8_update(0, f + 1, 2u + lens[k]);
+    if (rand32() % 1000000 < damage_ppm)
+      f[rand32() % (CTRL_FRAME_OVERHEAD + lens[k])] ^= 0x10;
+    n += CTRL_FRAME_OVERHEAD + lens[k];
+  }
+  return n;
+}
+
+/* Best of PASSES, ns per byte x 100 */
+static uint32_t run(const uint8_t *stream, uint32_t size, ctrl_stats_t *st) {
+  uint64_t best = UINT64_MAX;
+
+  for (int pass = 0; pass < PASSES; pass++) {
+    ctrl_init(0);
+    uint64_t t0 = now_ns();
+    for (uint32_t pos = 0; pos < size;) {
+      uint32_t space;
+      uint8_t *dst = ctrl_rx_reserve(&space);
+      if (space > READ_SIZE)
+        space = READ_SIZE;
+      if (space > size - pos)
+        space = size - pos;
+      memcpy(dst, stream + pos, space);
+      ctrl_rx_commit(space);
+      ctrl_decode(0);
+      pos += space;
+    }
+    uint64_t t = now_ns() - t0;
+    if (t < best)
+      best = t;
+  }
+  ctrl_get_stats(st);
+  return (uint32_t)(best * 100 / size);
+}
+
+static void report(const char *name, const uint8_t *stream, uint32_t size) {
+  ctrl_stats_t st;
+  uint32_t ns_x100 = run(stream, size, &st);
+  /* bytes/s = baud / 10; load % = ns/byte x bytes/s / 1e7 */
+  uint32_t load_115k = ns_x100 * 11520u / 1000000u;  /* % x 1000 */
+  uint32_t load_921k = ns_x100 * 92160u / 1000000u;
+
+  printf("%-8s %3u.%02u ns/byte  %u.%03u %% at 115200  %u.%03u %% at 921600"
+         "  (%u frames, %u skipped)\n",
+         name, ns_x100 / 100, ns_x100 % 100, load_115k / 1000,
+         load_115k % 1000, load_921k / 1000, load_921k % 1000, st.frames,
+         st.skipped);
+}
+
+int main(void) {
+  uint8_t *stream = malloc(STREAM_SIZE);
+  uint32_t size;
+
+  size = make_frames(stream, STREAM_SIZE, 0);
+  report("frames", stream, size);
+  size = make_frames(stream, STREAM_SIZE, 10000);
+  report("damaged", stream, size);
+  for (uint32_t i = 0; i < STREAM_SIZE; i++)
+    stream[i] = (uint8_t)rand32();
+  report("noise", stream, STREAM_SIZE);
+
+  free(stream);
+  return 0;
+}
@@ -0,0 +1,294 @@
+/**
+ * @file ctrl_uart_test.c
+ * Controller frame decoder (app/ctrl_uart.c) against generated streams:
+ *
+ *   clean  200k random frames of every type, some with extra payload bytes
+ *          and some of an unknown type, fed in random 1-64 byte chunks:
+ *          every field must be published exactly, in order, and nothing
+ *          skipped
+ *   fuzz   20 rounds of 60k status frames, 1.2 % of them damaged by a bit
+ *          flip, a dropped byte, a truncation or garbage inserted before
+ *          them: every undamaged frame must decode, except the few a
+ *          spurious frame swallows, and spurious frames (a resync candidate
+ *          passing the 8-bit CRC, about 1 in 256) must stay rare
+ *
+ * Exits non-zero on failure. Configure with -DCMAKE_C_FLAGS=
+ * "-fsanitize=address,undefined" to check the ring accesses as well.
+ */
+
+#include "crc.h"
+#include "ctrl_uart.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CLEAN_FRAMES 200000
+#define FUZZ_ROUNDS 20
+#define FUZZ_FRAMES 60000 /* < 65536: the speed field is the frame number */
+#define FUZZ_DAMAGE_PPM 12000
+#define FRAME_TYPE_UNKNOWN 0x7E
+
+typedef struct {
+  uint8_t topic;
+  int32_t value;
+} pub_t;
+
+static uint32_t rng = 0x12345678;
+static pub_t *expected;
+static uint32_t expected_n;
+static uint32_t checked;
+static uint32_t mismatches;
+
+/* Fuzz: fields of the status frame being published */
+static bool fuzz_mode;
+static int fuzz_fields; /* published so far, 0 when none is open */
+static int32_t fuzz_speed, fuzz_power;
+static uint8_t *fuzz_seen;
+static uint32_t fuzz_spurious;
+
+static uint32_t rand32(void) {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint32_t rand_below(uint32_t n) { return rand32() % n; }
+
+bool ctrl_platform_init(void) { return true; }
+
+static int32_t fuzz_power_of(uint32_t serial) {
+  return (int16_t)(serial * 7919u ^ 0x5A5Au);
+}
+
+static uint8_t fuzz_assist_of(uint32_t serial) {
+  return (uint8_t)(1 + serial % 3);
+}
+
+static void fuzz_close(bool complete) {
+  if (fuzz_fields == 0)
+    return;
+  uint32_t serial = (uint32_t)fuzz_speed;
+  if (complete && serial < FUZZ_FRAMES &&
+      fuzz_power == fuzz_power_of(serial) && !fuzz_seen[serial])
+    fuzz_seen[serial] = 1;
+  else
+    fuzz_spurious++;
+  fuzz_fields = 0;
+}
+
+void telemetry_publish(telemetry_topic_t topic, int32_t value,
+                       uint32_t now_ms) {
+  (void)now_ms;
+  if (!fuzz_mode) {
+    if (checked >= expected_n || expected[checked].topic != topic ||
+        expected[checked].value != value) {
+      if (mismatches++ < 5)
+        fprintf(stderr, "clean: sample %u is topic %d = %d\n", checked,
+                (int)topic, (int)value);
+    }
+    checked++;
+    return;
+  }
+
+  /* Status frames publish speed, power, assist; anything else is a frame
+   * the decoder made up */
+  if (topic == TELEMETRY_SPEED) {
+    fuzz_close(false);
+    fuzz_speed = value;
+    fuzz_fields = 1;
+  } else if (topic == TELEMETRY_POWER && fuzz_fields == 1) {
+    fuzz_power = value;
+    fuzz_fields = 2;
+  } else if (topic == TELEMETRY_ASSIST && fuzz_fields == 2) {
+    fuzz_close(value == fuzz_assist_of((uint32_t)fuzz_speed));
+  } else {
+    fuzz_close(false);
+    fuzz_spurious++;
+  }
+}
+
+static void expect(telemetry_topic_t topic, int32_t value) {
+  expected[expected_n].topic = (uint8_t)topic;
+  expected[expected_n].value = value;
+  expected_n++;
+}
+
+/* Frame with `len` payload bytes at `out`; returns its size */
+static uint32_t frame_put(uint8_t *out, uint8_t type, const uint8_t *payload,
+                          uint8_t len) {
+  out[0] = CTRL_SYNC;
+  out[1] = type;
+  out[2] = len;
+  memcpy(out + 3, payload, len);
+  out[3 + len] = crc8_update(0, out + 1, 2u + len);
+  return CTRL_FRAME_OVERHEAD + len;
+}
+
+/* Feed `stream` in random chunks and decode after each */
+static void feed(const uint8_t *stream, uint32_t size) {
+  uint32_t pos = 0;
+  while (pos < size) {
+    uint32_t n = 1 + rand_below(64);
+    if (n > size - pos)
+      n = size - pos;
+    ctrl_rx_write(stream + pos, n);
+    ctrl_decode(0);
+    pos += n;
+  }
+}
+
+static bool test_clean(void) {
+  uint8_t *stream = malloc((size_t)CLEAN_FRAMES * 40);
+  uint32_t size = 0, known = 0, unknown = 0;
+  ctrl_stats_t st;
+
+  expected = malloc((size_t)CLEAN_FRAMES * 3 * sizeof(pub_t));
+  expected_n = checked = mismatches = 0;
+  for (uint32_t i = 0; i < CLEAN_FRAMES; i++) {
+    uint8_t p[CTRL_MAX_PAYLOAD];
+    uint32_t kind = rand_below(10);
+    uint8_t extra = rand_below(8) == 0 ? (uint8_t)rand_below(8) : 0;
+    uint8_t type, len;
+
+    for (int b = 0; b < CTRL_MAX_PAYLOAD; b++)
+      p[b] = (uint8_t)rand32();
+    if (kind < 5) {
+      type = CTRL_FRAME_STATUS;
+      len = 5 + extra;
+      expect(TELEMETRY_SPEED, p[0] | p[1] << 8);
+      expect(TELEMETRY_POWER, (int16_t)(p[2] | p[3] << 8));
+      if (p[4] != 0)
+        expect(TELEMETRY_ASSIST, p[4]);
+    } else if (kind < 8) {
+      type = CTRL_FRAME_BATTERY;
+      len = 4 + extra;
+      expect(TELEMETRY_PACK_VOLTAGE, (p[0] | p[1] << 8) * 10);
+      expect(TELEMETRY_PACK_CURRENT, (int16_t)(p[2] | p[3] << 8) * 10);
+    } else if (kind < 9) {
+      type = CTRL_FRAME_TEMPS;
+      len = 2 + extra;
+      expect(TELEMETRY_MOTOR_TEMP, (int8_t)p[0]);
+      expect(TELEMETRY_CTRL_TEMP, (int8_t)p[1]);
+    } else {
+      type = FRAME_TYPE_UNKNOWN;
+      len = (uint8_t)rand_below(CTRL_MAX_PAYLOAD + 1);
+    }
+    if (type == FRAME_TYPE_UNKNOWN)
+      unknown++;
+    else
+      known++;
+    size += frame_put(stream + size, type, p, len);
+  }
+
+  ctrl_init(0);
+  feed(stream, size);
+  ctrl_get_stats(&st);
+  free(stream);
+  free(expected);
+
+  bool ok = mismatches == 0 && checked == expected_n && st.frames == known &&
+            st.unknown == unknown && st.skipped == 0 && st.crc_errors == 0 &&
+            st.overruns == 0 && st.bytes == size;
+  printf("clean: %u frames, %u samples, %u mismatches, %u skipped: %s\n",
+         st.frames + st.unknown, checked, mismatches, st.skipped,
+         ok ? "ok" : "FAIL");
+  return ok;
+}
+
+static bool test_fuzz(void) {
+  uint8_t *stream = malloc((size_t)FUZZ_FRAMES * 24);
+  uint8_t *damaged = malloc(FUZZ_FRAMES);
+  uint32_t total_damaged = 0, total_missed = 0, total_spurious = 0;
+  uint32_t total_frames = 0;
+  bool ok = true;
+
+  fuzz_mode = true;
+  fuzz_seen = malloc(FUZZ_FRAMES);
+  for (int round = 0; round < FUZZ_ROUNDS; round++) {
+    uint32_t size = 0;
+    ctrl_stats_t st;
+
+    memset(damaged, 0, FUZZ_FRAMES);
+    memset(fuzz_seen, 0, FUZZ_FRAMES);
+    fuzz_spurious = 0;
+    for (uint32_t i = 0; i < FUZZ_FRAMES; i++) {
+      uint8_t p[5] = {(uint8_t)i, (uint8_t)(i >> 8),
+                      (uint8_t)fuzz_power_of(i),
+                      (uint8_t)(fuzz_power_of(i) >> 8), fuzz_assist_of(i)};
+      uint8_t *f = stream + size;
+      uint32_t n = frame_put(f, CTRL_FRAME_STATUS, p, sizeof(p));
+
+      if (rand_below(1000000) < FUZZ_DAMAGE_PPM) {
+        switch (rand_below(4)) {
+        case 0: /* bit flip */
+          f[rand_below(n)] ^= (uint8_t)(1u << rand_below(8));
+          damaged[i] = 1;
+          break;
+        case 1: { /* dropped byte */
+          uint32_t at = rand_below(n);
+          memmove(f + at, f + at + 1, n - at - 1);
+          n--;
+          damaged[i] = 1;
+          break;
+        }
+        case 2: /* truncated */
+          n = 1 + rand_below(n - 1);
+          damaged[i] = 1;
+          break;
+        default: { /* garbage in front; the frame itself is intact */
+          uint32_t g = 1 + rand_below(8);
+          memmove(f + g, f, n);
+          for (uint32_t b = 0; b < g; b++)
+            f[b] = rand_below(4) == 0 ? CTRL_SYNC : (uint8_t)rand32();
+          n += g;
+          break;
+        }
+        }
+      }
+      size += n;
+    }
+
+    ctrl_init(0);
+    fuzz_fields = 0;
+    feed(stream, size);
+    /* Frames at the end may still wait for bytes the damage took */
+    static const uint8_t pad[CTRL_MAX_PAYLOAD + CTRL_FRAME_OVERHEAD];
+    ctrl_rx_write(pad, sizeof(pad));
+    ctrl_decode(0);
+    fuzz_close(false);
+    ctrl_get_stats(&st);
+    if (st.overruns != 0)
+      ok = false;
+
+    for (uint32_t i = 0; i < FUZZ_FRAMES; i++) {
+      total_damaged += damaged[i];
+      if (!damaged[i] && !fuzz_seen[i])
+        total_missed++;
+    }
+    total_spurious += fuzz_spurious;
+    total_frames += FUZZ_FRAMES;
+  }
+  fuzz_mode = false;
+  free(fuzz_seen);
+  free(damaged);
+  free(stream);
+
+  /* A spurious frame swallows the frames it overlaps: a handful per 256
+   * resync candidates. 2 % of the damage leaves an order of magnitude of
+   * margin over what the CRC lets through. */
+  uint32_t limit = total_damaged / 50;
+  ok = ok && total_missed <= limit && total_spurious <= limit;
+  printf("fuzz: %u frames, %u damaged, %u undamaged missed, %u spurious "
+         "(limit %u): %s\n",
+         total_frames, total_damaged, total_missed, total_spurious, limit,
+         ok ? "ok" : "FAIL");
+  return ok;
+}
+
+int main(void) {
+  bool ok = test_clean();
+  ok = test_fuzz() && ok;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file ride_log_test.c
+ * Ride segmentation (app/ride.c), trip computer and ride log from power-up,
+ * on a RAM-backed log platform
+ *
+ * The modules are wired the way dashboard.c's ride_state_cb() wires them: a
+ * trip and a log open on ride_opens_trip(), the log closes on
+ * ride_closes_trip(). Samples come every 20 ms, as from the trip timer and
+ * the logger timer. The bike boots, stands for 10 min with 100 W of lights
+ * and then rides once for 10 min:
+ *
+ *   - no log exists while parked, and the ride opens one: the first ride
+ *     after power-up is recorded
+ *   - the trip holds the ride's energy only; what was drawn while parked
+ *     is in the lifetime figure
+ *   - cut off mid-ride, as when the rider switches off before the ride has
+ *     ended, the log has a header and records and reads from the start
+ *   - after CONFIG_DASH_RIDE_END_S of standing it is closed with an index:
+ *     every record decodes, the distance matches the trip, and a seek by
+ *     distance lands on the right record
+ *   - a second ride opens a second log
+ *
+ * Exits non-zero on failure.
+ */
+
+#include "app_config.h"
+#include "ride.h"
+#include "ridelog.h"
+#include "telemetry.h"
+#include "trip.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TICK_MS 20
+#define LOG_SIZE (1u << 20)
+#define PARKED_W 100
+#define RIDE_W 250
+#define CRUISE_X100 2500
+
+static uint8_t log_ram[LOG_SIZE];
+static uint32_t log_used; /* bytes written, as a file size */
+static uint32_t log_closes;
+static uint32_t now_ms = 1000;
+static uint32_t rng = 0x3C6EF372;
+static uint32_t failures;
+
+static uint32_t rand32(void) {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static void fail(const char *fmt, ...) {
+  va_list ap;
+
+  failures++;
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
+
+/* RAM log platform: one log, erased when a new one opens */
+bool ridelog_platform_init(void) { return true; }
+
+uint32_t ridelog_platform_open(void) {
+  memset(log_ram, 0xFF, sizeof(log_ram));
+  log_used = 0;
+  return LOG_SIZE;
+}
+
+bool ridelog_platform_write(uint32_t addr, const void *buf, uint32_t len) {
+  if (addr > LOG_SIZE || len > LOG_SIZE - addr)
+    return false;
+  memcpy(log_ram + addr, buf, len);
+  if (addr + len > log_used)
+    log_used = addr + len;
+  return true;
+}
+
+void ridelog_platform_close(void) { log_closes++; }
+
+static bool ram_read(void *ctx, uint32_t addr, void *buf, uint32_t len) {
+  const uint8_t *ram = ctx;
+  if (addr > log_used || len > log_used - addr)
+    return false;
+  memcpy(buf, ram + addr, len);
+  return true;
+}
+
+/* As dashboard.c's ride_state_cb() */
+static void ride_state_cb(ride_state_t from, ride_state_t to) {
+  if (ride_opens_trip(from, to)) {
+    trip_reset();
+    ridelog_start(now_ms, 0);
+  }
+  if (ride_closes_trip(from, to))
+    ridelog_stop();
+}
+
+/* `s` seconds at about `speed_x100` drawing `power_w` */
+static void run(uint32_t s, uint32_t speed_x100, int32_t power_w) {
+  for (uint32_t t = 0; t < s * 1000u; t += TICK_MS) {
+    uint32_t v = speed_x100 ? speed_x100 + rand32() % 100 : 0;
+    now_ms += TICK_MS;
+    telemetry_publish(TELEMETRY_SPEED, (int32_t)v, now_ms);
+    telemetry_publish(TELEMETRY_POWER, power_w, now_ms);
+    trip_sample((uint16_t)v, power_w, TICK_MS * 1000u);
+    ride_update((uint16_t)v, power_w, now_ms);
+    ridelog_update(now_ms);
+  }
+}
+
+/* Decode every record; false if the log does not open */
+static bool read_log(ridelog_reader_t *r, uint32_t size, uint32_t *records) {
+  if (!ridelog_open(r, ram_read, log_ram, size))
+    return false;
+  *records = 0;
+  while (ridelog_next(r))
+    (*records)++;
+  return true;
+}
+
+int main(void) {
+  static ridelog_reader_t r;
+  ridelog_stats_t st;
+  trip_snapshot_t trip;
+  uint32_t records;
+
+  if (!ridelog_init())
+    fail("boot: no log platform");
+  ride_set_handler(ride_state_cb);
+
+  /* Parked after power-up */
+  run(600, 0, PARKED_W);
+  ridelog_get_stats(&st);
+  if (ridelog_active() || st.logs != 0)
+    fail("parked: a log is open before the first ride");
+
+  /* First ride */
+  run(600, CRUISE_X100, RIDE_W);
+  ridelog_get_stats(&st);
+  trip_get_snapshot(&trip);
+  if (!ridelog_active() || st.logs != 1)
+    fail("first ride: not logged (%u logs)", st.logs);
+  int32_t ride_wh = RIDE_W * (600 - CONFIG_DASH_RIDE_START_MS / 1000) / 3600;
+  int32_t parked_wh = PARKED_W * 600 / 3600;
+  if (trip.drive_wh < ride_wh - 1 || trip.drive_wh > ride_wh + 1)
+    fail("first ride: trip drew %d Wh, the ride %d Wh", trip.drive_wh,
+         ride_wh);
+  if ((int32_t)trip.life_drive_wh < ride_wh + parked_wh - 1)
+    fail("first ride: lifetime drew %u Wh, expected %d Wh",
+         trip.life_drive_wh, ride_wh + parked_wh);
+
+  /* Switched off now: the log is cut short, as after a power loss */
+  if (!read_log(&r, log_used, &records))
+    fail("cut short: no log header");
+  else if (r.index_count != 0 || records == 0 || r.frame.dist == 0)
+    fail("cut short: %u records, %u index entries", records, r.index_count);
+  uint32_t cut_records = records;
+
+  /* Standing until the ride ends */
+  run(CONFIG_DASH_RIDE_END_S + 10, 0, 0);
+  ridelog_get_stats(&st);
+  if (ridelog_active() || log_closes != 1)
+    fail("ride end: log still open");
+  if (!read_log(&r, log_used, &records)) {
+    fail("closed: no log header");
+  } else {
+    uint32_t log_m = (uint32_t)(r.frame.dist / RIDELOG_UNITS_PER_M);
+    if (r.index_count == 0)
+      fail("closed: no index");
+    if (records != st.records || records < cut_records)
+      fail("closed: %u records decoded, %u written", records, st.records);
+    if (log_m * 200 < trip.trip_m * 199 || log_m * 200 > trip.trip_m * 201)
+      fail("closed: log distance %u m, trip %u m", log_m, trip.trip_m);
+    if (!ridelog_seek(&r, RIDELOG_BY_DIST, 2000) ||
+        r.frame.dist / RIDELOG_UNITS_PER_M > 2000 ||
+        r.frame.dist / RIDELOG_UNITS_PER_M < 1990)
+      fail("closed: seek to 2000 m found %u m",
+           (uint32_t)(r.frame.dist / RIDELOG_UNITS_PER_M));
+  }
+  printf("first ride: %u records, %u bytes, %u index entries, %u m\n",
+         st.records, log_used, r.index_count, trip.trip_m);
+
+  /* Second ride */
+  run(60, CRUISE_X100, RIDE_W);
+  ridelog_get_stats(&st);
+  if (!ridelog_active() || st.logs != 2)
+    fail("second ride: not logged (%u logs)", st.logs);
+
+  printf("ride log from power-up: %s\n", failures ? "FAIL" : "ok");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file soc_test.c
+ * SOC estimator (app/soc.c) against a simulated pack on synthetic discharge
+ * curves
+ *
+ * The pack model has a true capacity, the OCV curve of soc.c's table, a
+ * series resistance that rises towards empty and an RC polarisation that
+ * relaxes over a minute after the current stops, so the terminal voltage
+ * only reaches the OCV after a real rest. The current sensor has a gain
+ * error and an offset; the estimator sees the sensor's mA and the terminal
+ * voltage every 20 ms, as the dashboard samples it. A ride draws 2-25 A in
+ * random steps with regeneration and short stops; a charge is -4 A.
+ *
+ * soc.c keeps its state in statics, so each scenario runs in its own
+ * process (soc_test <scenario>):
+ *
+ *   ride   exact sensor, rated capacity, three rides from 98 % to 10 %
+ *          and charges back without a rest: the coulomb count alone must
+ *          track the true SOC within 0.5 %, and the cycle count the charge
+ *          drawn
+ *   drift  3 % gain error and 150 mA offset (below the rest threshold):
+ *          the error grows while riding, and every rest must bring the SOC
+ *          back within 0.5 % of the truth
+ *   fade   pack faded to 17 Ah of 20 Ah rated, with the same sensor errors,
+ *          eight cycles between 95 % and 15 % with rests at both ends: the
+ *          learnt capacity must converge within 1.5 % of the true one (in
+ *          the sensor's scale, which is what the count is in), and the SOC
+ *          at the end of the last rides within 2 % before the rest
+ *   bms    a SOC and capacity reported by the BMS override the estimate
+ *
+ * Exits non-zero on failure.
+ */
+
+#include "app_config.h"
+#include "soc.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DT_US 20000u
+#define DT_S (DT_US / 1e6)
+#define REST_S (CONFIG_DASH_SOC_REST_S + 60)
+
+typedef struct {
+  double capacity_mah; /* true */
+  double soc;          /* true, 0..1 */
+  double r0_mohm;      /* series resistance at full */
+  double r1_mohm;      /* polarisation */
+  double tau_s;
+  double v1_mv;        /* polarisation voltage */
+  double gain;         /* current sensor */
+  double offset_ma;
+  double drawn_mah;    /* as measured, positive only */
+} pack_t;
+
+static pack_t pack;
+static uint32_t rng = 0x6A09E667;
+static uint32_t failures;
+static double max_err_pct;
+
+static uint32_t rand32(void) {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint32_t rand_range(uint32_t lo, uint32_t hi) {
+  return lo + rand32() % (hi - lo + 1);
+}
+
+static void fail(const char *fmt, ...) {
+  va_list ap;
+
+  if (failures++ >= 10)
+    return;
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
+
+/* Pack OCV, mV: soc.c's cell table, interpolated between its 0.1 % steps */
+static double pack_ocv_mv(double soc) {
+  double x = soc * 1000;
+  int32_t lo = (int32_t)floor(x);
+  double a = soc_cell_ocv(lo), b = soc_cell_ocv(lo + 1);
+  return (a + (b - a) * (x - lo)) * CONFIG_DASH_BATT_CELLS_S;
+}
+
+static double estimate_err_pct(void) {
+  soc_state_t st;
+  soc_get(&st);
+  return st.soc_x10 / 10.0 - pack.soc * 100;
+}
+
+/* Draw `ma` (< 0: charge) for `s` seconds, feeding the estimator; stops
+ * early once the true SOC reaches `stop_soc` from either side */
+static void run(double ma, double s, double stop_soc, bool track) {
+  bool down = pack.soc > stop_soc;
+
+  for (double t = 0; t < s; t += DT_S) {
+    if (down ? pack.soc <= stop_soc : pack.soc >= stop_soc)
+      return;
+    double r0 = pack.r0_mohm * (pack.soc < 0.2 ? 1.5 : 1.0);
+    pack.soc -= ma * DT_S / 3600 / pack.capacity_mah;
+    pack.v1_mv += (ma * pack.r1_mohm / 1000 - pack.v1_mv) * DT_S / pack.tau_s;
+    double mv = pack_ocv_mv(pack.soc) - ma * r0 / 1000 - pack.v1_mv;
+    double sensed = ma * pack.gain + pack.offset_ma;
+    soc_sample((int32_t)lround(sensed), (int32_t)lround(mv), DT_US);
+    if (sensed > 0)
+      pack.drawn_mah += sensed * DT_S / 3600;
+    if (track) {
+      double err = fabs(estimate_err_pct());
+      if (err > max_err_pct)
+        max_err_pct = err;
+    }
+  }
+}
+
+/* Random riding down to `to_soc`, stops shorter than a rest */
+static void ride(double to_soc, bool track) {
+  while (pack.soc > to_soc) {
+    uint32_t k = rand_range(0, 9);
+    if (k == 0)
+      run(0, rand_range(5, 120), to_soc, track);
+    else if (k == 1)
+      run(-(double)rand_range(1000, 6000), rand_range(2, 8), to_soc, track);
+    else
+      run(rand_range(2000, 25000), rand_range(5, 60), to_soc, track);
+  }
+}
+
+static void rest(void) { run(0, REST_S, -1, false); }
+
+static void pack_init(double capacity_mah, double soc, double gain,
+                      double offset_ma) {
+  memset(&pack, 0, sizeof(pack));
+  pack.capacity_mah = capacity_mah;
+  pack.soc = soc;
+  pack.r0_mohm = 60;
+  pack.r1_mohm = 40;
+  pack.tau_s = 60;
+  pack.gain = gain;
+  pack.offset_ma = offset_ma;
+  /* Seeded from the voltage of a rested pack */
+  run(0, DT_S, -1, false);
+}
+
+static void check_rested(const char *when) {
+  soc_state_t st;
+  soc_get(&st);
+  double err = estimate_err_pct();
+  if (!st.rested)
+    fail("%s: no rest correction at %.1f %%", when, pack.soc * 100);
+  if (fabs(err) > 0.5)
+    fail("%s: SOC off by %.2f %% after a rest at %.1f %%", when, err,
+         pack.soc * 100);
+}
+
+static bool scenario_ride(void) {
+  pack_init(CONFIG_DASH_BATT_CAPACITY_MAH, 0.98, 1.0, 0);
+  for (int i = 0; i < 3; i++) {
+    ride(0.10, true);
+    run(-4000, 8 * 3600, 0.98, true);
+    rest();
+  }
+  soc_state_t st;
+  soc_get(&st);
+  double cycles_x10 = pack.drawn_mah * 10 / CONFIG_DASH_BATT_CAPACITY_MAH;
+  if (max_err_pct > 0.5)
+    fail("ride: SOC off by up to %.2f %% without a rest", max_err_pct);
+  if (fabs(st.cycles_x10 - cycles_x10) > 1)
+    fail("ride: %d cycles x10, drawn %.2f", st.cycles_x10, cycles_x10);
+  printf("ride: max SOC error %.2f %%, %d.%d cycles: %s\n", max_err_pct,
+         st.cycles_x10 / 10, st.cycles_x10 % 10, failures ? "FAIL" : "ok");
+  return failures == 0;
+}
+
+static bool scenario_drift(void) {
+  double worst_before = 0;
+
+  pack_init(CONFIG_DASH_BATT_CAPACITY_MAH, 0.98, 1.03, 150);
+  while (pack.soc > 0.15) {
+    max_err_pct = 0;
+    for (int i = 0; i < 30 && pack.soc > 0.15; i++)
+      run(rand_range(2000, 25000), 60, 0.15, true);
+    if (max_err_pct > worst_before)
+      worst_before = max_err_pct;
+    rest();
+    check_rested("drift");
+  }
+  printf("drift: up to %.2f %% off while riding, within 0.5 %% after each "
+         "rest: %s\n",
+         worst_before, failures ? "FAIL" : "ok");
+  return failures == 0;
+}
+
+static bool scenario_fade(void) {
+  const double true_mah = 17000, gain = 1.03;
+  double end_err = 0;
+
+  pack_init(true_mah, 0.95, gain, 100);
+  rest();
+  for (int cycle = 0; cycle < 8; cycle++) {
+    ride(0.15, false);
+    if (cycle >= 6 && fabs(estimate_err_pct()) > fabs(end_err))
+      end_err = estimate_err_pct();
+    rest();
+    check_rested("fade, empty");
+    run(-4000, 8 * 3600, 0.95, false);
+    rest();
+    check_rested("fade, full");
+  }
+
+  soc_state_t st;
+  soc_get(&st);
+  double want = true_mah * gain;
+  if (fabs(st.capacity_mah - want) > want * 0.015)
+    fail("fade: learnt %d mAh, true %.0f mAh in the sensor's scale",
+         st.capacity_mah, want);
+  if (fabs(end_err) > 2)
+    fail("fade: SOC off by %.2f %% at the end of a ride", end_err);
+  printf("fade: learnt %d mAh (true %.0f, %d %% health), SOC %.2f %% off "
+         "before the last rests: %s\n",
+         st.capacity_mah, want, st.health_pct, end_err,
+         failures ? "FAIL" : "ok");
+  return failures == 0;
+}
+
+static bool scenario_bms(void) {
+  soc_state_t st;
+
+  pack_init(CONFIG_DASH_BATT_CAPACITY_MAH, 0.80, 1.0, 0);
+  soc_get(&st);
+  int32_t learnt = st.capacity_mah;
+  soc_report(523, 18000);
+  soc_get(&st);
+  if (st.soc_x10 != 523 || st.capacity_mah != 18000 ||
+      st.remaining_mah != 18000 * 523 / 1000 ||
+      st.health_pct != 18000 * 100 / CONFIG_DASH_BATT_CAPACITY_MAH)
+    fail("bms: %d, %d mAh instead of the report", st.soc_x10,
+         st.capacity_mah);
+  soc_report(1200, 0);
+  soc_get(&st);
+  if (st.soc_x10 != 1000 || st.capacity_mah != learnt)
+    fail("bms: %d, %d mAh: SOC not clamped or learnt capacity lost",
+         st.soc_x10, st.capacity_mah);
+  printf("bms: %s\n", failures ? "FAIL" : "ok");
+  return failures == 0;
+}
+
+int main(int argc, char **argv) {
+  static const struct {
+    const char *name;
+    bool (*run)(void);
+  } scenarios[] = {
+      {"ride", scenario_ride},
+      {"drift", scenario_drift},
+      {"fade", scenario_fade},
+      {"bms", scenario_bms},
+  };
+
+  for (size_t i = 0; argc == 2 && i < sizeof(scenarios) / sizeof(scenarios[0]);
+       i++)
+    if (strcmp(argv[1], scenarios[i].name) == 0)
+      return scenarios[i].run() ? 0 : 1;
+  fprintf(stderr, "usage: soc_test ride|drift|fade|bms\n");
+  return 2;
+}
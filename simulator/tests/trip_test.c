@@ -0,0 +1,224 @@
+/**
+ * @file trip_test.c
+ * Trip computer (app/trip.c) against a double-precision reference over a
+ * generated 10,000 km ride
+ *
+ * The ride alternates riding stretches of 30 s to 10 min at a random cruise
+ * speed with stops. Speed wanders around the cruise value, power follows
+ * speed with regeneration when slowing, and samples come every 1 to 40 ms,
+ * so both the 1 kHz rate of a fast producer and the dashboard's 20 ms
+ * period are covered. The reference integrates the same quantised samples
+ * in double precision. At the first stop past every 1000 km and at the end
+ * each snapshot value must match the reference truncated the same way,
+ * within one unit of the value's last digit; the trip is reset half way,
+ * and the odometer must carry on and survive trip_get_odometer() /
+ * trip_set_odometer().
+ *
+ * Also reports the cost of trip_sample() over a stored run of samples.
+ * Exits non-zero on failure.
+ */
+
+#include "trip.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define RIDE_KM 10000
+#define CHECK_KM 1000
+#define RESET_KM 5000
+#define BENCH_SAMPLES (1u << 20)
+#define BENCH_PASSES 16
+
+typedef struct {
+  double dist_m;
+  double ride_s;
+  double drive_wh;
+  double regen_wh;
+  uint16_t max_speed_x100;
+} ref_t;
+
+static uint32_t rng = 0x2545F491;
+static ref_t ref_trip, ref_odo;
+static uint32_t failures;
+
+static uint32_t rand32(void) {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static uint32_t rand_range(uint32_t lo, uint32_t hi) {
+  return lo + rand32() % (hi - lo + 1);
+}
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void ref_sample(ref_t *r, uint16_t speed_x100, int32_t power_w,
+                       uint32_t dt_us) {
+  double dt_s = dt_us / 1e6;
+
+  r->dist_m += speed_x100 / 100.0 / 3.6 * dt_s;
+  if (power_w >= 0)
+    r->drive_wh += power_w * dt_s / 3600.0;
+  else
+    r->regen_wh += -power_w * dt_s / 3600.0;
+  if (speed_x100 != 0)
+    r->ride_s += dt_s;
+  if (speed_x100 > r->max_speed_x100)
+    r->max_speed_x100 = speed_x100;
+}
+
+static void expect(const char *what, double km, int64_t got, double want) {
+  /* The reference sits within a rounding error of the exact value, which
+   * may fall either side of a unit boundary */
+  int64_t w = (int64_t)floor(want);
+  if (got < w - 1 || got > w + 1) {
+    if (failures < 10)
+      fprintf(stderr, "at %.0f km: %s is %lld, reference %.3f\n", km, what,
+              (long long)got, want);
+    failures++;
+  }
+}
+
+static void check(double km) {
+  trip_snapshot_t s;
+  const ref_t *t = &ref_trip;
+  const ref_t *o = &ref_odo;
+  double trip_net = t->drive_wh - t->regen_wh;
+  double odo_net = o->drive_wh - o->regen_wh;
+
+  trip_get_snapshot(&s);
+  expect("odometer, 0.1 km", km, s.odo_x10, o->dist_m / 100);
+  expect("trip, 0.1 km", km, s.trip_x10, t->dist_m / 100);
+  expect("trip, m", km, s.trip_m, t->dist_m);
+  expect("ride time, s", km, s.ride_time_s, t->ride_s);
+  expect("max speed, km/h", km, s.max_speed_kmh, t->max_speed_x100 / 100);
+  expect("average speed, 0.1 km/h", km, s.avg_speed_x10,
+         t->dist_m * 36 / t->ride_s);
+  expect("used, Wh", km, s.used_wh, trip_net);
+  expect("drive, Wh", km, s.drive_wh, t->drive_wh);
+  expect("regen, Wh", km, s.regen_wh, t->regen_wh);
+  expect("lifetime drive, Wh", km, s.life_drive_wh, o->drive_wh);
+  expect("lifetime regen, Wh", km, s.life_regen_wh, o->regen_wh);
+  expect("trip, 0.1 Wh/km", km, s.trip_avg_x10, trip_net * 1e4 / t->dist_m);
+  expect("lifetime, 0.1 Wh/km", km, s.hist_avg_x10, odo_net * 1e4 / o->dist_m);
+  expect("recovered, 0.1 %", km, s.recovered_x10,
+         t->regen_wh * 1000 / t->drive_wh);
+  expect("lifetime recovered, 0.1 %", km, s.life_recovered_x10,
+         o->regen_wh * 1000 / o->drive_wh);
+}
+
+/* ns per trip_sample() x 100, best of BENCH_PASSES; leaves the trip reset */
+static uint32_t bench(void) {
+  uint16_t *speed = malloc(BENCH_SAMPLES * sizeof(*speed));
+  int32_t *power = malloc(BENCH_SAMPLES * sizeof(*power));
+  uint64_t best = UINT64_MAX;
+
+  for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+    speed[i] = (uint16_t)rand_range(0, 5000);
+    power[i] = (int32_t)rand_range(0, 1500) - 300;
+  }
+  for (int pass = 0; pass < BENCH_PASSES; pass++) {
+    uint64_t t0 = now_ns();
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+      trip_sample(speed[i], power[i], 1000);
+    uint64_t t = now_ns() - t0;
+    if (t < best)
+      best = t;
+  }
+  trip_reset();
+  free(speed);
+  free(power);
+  return (uint32_t)(best * 100 / BENCH_SAMPLES);
+}
+
+/* Round trip through the persistent form, as the journal does */
+static void check_odometer_restore(void) {
+  trip_snapshot_t before, after;
+  uint32_t odo_m;
+  uint64_t drive_uj, regen_uj;
+
+  trip_get_snapshot(&before);
+  trip_get_odometer(&odo_m, &drive_uj, &regen_uj);
+  trip_set_odometer(odo_m, drive_uj, regen_uj);
+  trip_get_snapshot(&after);
+  /* The odometer is stored in whole metres */
+  if (after.odo_x10 < before.odo_x10 - 1 || after.odo_x10 > before.odo_x10 ||
+      after.life_drive_wh != before.life_drive_wh ||
+      after.life_regen_wh != before.life_regen_wh ||
+      after.trip_m != before.trip_m) {
+    fprintf(stderr, "odometer restore: %d -> %d (0.1 km)\n", before.odo_x10,
+            after.odo_x10);
+    failures++;
+  }
+  /* The fraction of a metre is dropped, in the reference too */
+  ref_odo.dist_m = odo_m;
+}
+
+int main(void) {
+  uint64_t samples = 0;
+  double next_check_m = CHECK_KM * 1000.0;
+  int reset_done = 0;
+
+  while (ref_odo.dist_m < RIDE_KM * 1000.0) {
+    /* Riding stretch, then a stop */
+    uint32_t cruise_x100 = rand_range(800, 4500);
+    uint64_t ride_us = (uint64_t)rand_range(30, 600) * 1000000u;
+    uint64_t stop_us = (uint64_t)rand_range(0, 120) * 1000000u;
+    uint32_t speed_x100 = cruise_x100;
+
+    for (uint64_t t = 0; t < ride_us + stop_us;) {
+      uint32_t dt_us = rand_range(1, 40) * 1000u + rand_range(0, 999);
+      uint32_t prev = speed_x100;
+      int32_t power_w;
+
+      if (t >= ride_us) {
+        speed_x100 = 0;
+      } else {
+        speed_x100 += rand_range(0, 40);
+        speed_x100 = speed_x100 > 20 ? speed_x100 - 20 : 0;
+        if (speed_x100 > cruise_x100 + 500)
+          speed_x100 = cruise_x100 + 500;
+      }
+      /* About 10 Wh/km at cruise, regeneration when slowing down */
+      power_w = (int32_t)(speed_x100 / 10) +
+                (int32_t)((int32_t)speed_x100 - (int32_t)prev) * 8;
+      if (speed_x100 == 0)
+        power_w = 3;
+
+      trip_sample((uint16_t)speed_x100, power_w, dt_us);
+      ref_sample(&ref_trip, (uint16_t)speed_x100, power_w, dt_us);
+      ref_sample(&ref_odo, (uint16_t)speed_x100, power_w, dt_us);
+      samples++;
+      t += dt_us;
+    }
+
+    if (ref_odo.dist_m >= next_check_m) {
+      check(ref_odo.dist_m / 1000);
+      next_check_m += CHECK_KM * 1000.0;
+      if (!reset_done && ref_odo.dist_m >= RESET_KM * 1000.0) {
+        check_odometer_restore();
+        trip_reset();
+        ref_trip = (ref_t){0};
+        reset_done = 1;
+      }
+    }
+  }
+  check(ref_odo.dist_m / 1000);
+
+  trip_snapshot_t s;
+  trip_get_snapshot(&s);
+  uint32_t ns_x100 = bench();
+  printf("trip: %llu samples, odometer %d.%d km, lifetime %d.%d Wh/km, "
+         "%u.%02u ns per sample: %s\n",
+         (unsigned long long)samples, s.odo_x10 / 10, s.odo_x10 % 10,
+         s.hist_avg_x10 / 10, s.hist_avg_x10 % 10, ns_x100 / 100,
+         ns_x100 % 100, failures ? "FAIL" : "ok");
+  return failures ? 1 : 0;
+}